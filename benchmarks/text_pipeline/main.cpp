@@ -0,0 +1,335 @@
+#include <nodes/ui/label.h>
+#include <resources/default_resource.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+    #include <windows.h>
+    // Has to be included after windows.h.
+    #include <psapi.h>
+#else
+    #include <sys/resource.h>
+#endif
+
+using namespace Flint;
+
+// Count the C++ heap allocations of the process, so that they can be reported per call. Libraries allocating with
+// malloc() directly, like HarfBuzz, FriBidi and stb, are not counted.
+namespace {
+
+std::atomic<uint64_t> cpp_allocation_count = 0;
+
+} // namespace
+
+void *operator new(size_t size) {
+    cpp_allocation_count.fetch_add(1, std::memory_order_relaxed);
+
+    if (auto ptr = std::malloc(size ? size : 1)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void *ptr) noexcept {
+    std::free(ptr);
+}
+
+void operator delete(void *ptr, size_t) noexcept {
+    std::free(ptr);
+}
+
+/// Peak resident set size of the process in KiB.
+size_t get_peak_rss_kb() {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS counters;
+    if (GetProcessMemoryInfo(GetCurrentProcess(), &counters, sizeof(counters))) {
+        return counters.PeakWorkingSetSize / 1024;
+    }
+    return 0;
+#else
+    rusage usage{};
+    getrusage(RUSAGE_SELF, &usage);
+    #ifdef __APPLE__
+    // In bytes on macOS.
+    return usage.ru_maxrss / 1024;
+    #else
+    return usage.ru_maxrss;
+    #endif
+#endif
+}
+
+struct Corpus {
+    std::string name;
+    std::string text;
+};
+
+struct Result {
+    std::string case_name;
+    std::string corpus_name;
+    size_t codepoints = 0;
+    size_t glyphs = 0;
+    uint64_t iterations = 0;
+    double ns_per_call = 0;
+    /// Calls of caret queries, glyphs of the others.
+    double ns_per_unit = 0;
+    /// Only operator new, see cpp_allocation_count.
+    double cpp_allocations_per_call = 0;
+    size_t peak_rss_kb = 0;
+};
+
+/// Run a call repeatedly for at least the minimum duration, after a warm-up call.
+template <typename F>
+Result measure(const std::string &case_name, const Corpus &corpus, F &&call) {
+    // Also makes sure lazily created data (fonts, caches) isn't counted.
+    call();
+
+    constexpr auto MIN_DURATION = std::chrono::milliseconds(200);
+    constexpr uint64_t MIN_ITERATIONS = 5;
+
+    Result result;
+    result.case_name = case_name;
+    result.corpus_name = corpus.name;
+
+    auto allocations_before = cpp_allocation_count.load();
+    auto start = std::chrono::steady_clock::now();
+
+    std::chrono::steady_clock::duration elapsed{};
+    while (result.iterations < MIN_ITERATIONS || elapsed < MIN_DURATION) {
+        call();
+        result.iterations++;
+        elapsed = std::chrono::steady_clock::now() - start;
+    }
+
+    auto allocations = cpp_allocation_count.load() - allocations_before;
+
+    result.ns_per_call = std::chrono::duration<double, std::nano>(elapsed).count() / result.iterations;
+    result.cpp_allocations_per_call = double(allocations) / result.iterations;
+    result.peak_rss_kb = get_peak_rss_kb();
+
+    return result;
+}
+
+/// Number the lines, so that the paragraphs are all different and shaping can't reuse the cached ones.
+std::string repeat_line(const std::string &line, size_t count) {
+    std::string result;
+    for (size_t i = 0; i < count; i++) {
+        result += std::to_string(i + 1) + ". " + line;
+    }
+    return result;
+}
+
+std::string escape_json(const std::string &text) {
+    std::string result;
+    for (auto c : text) {
+        if (c == '"' || c == '\\') {
+            result += '\\';
+        }
+        result += c;
+    }
+    return result;
+}
+
+void write_json(std::ostream &os, const std::string &font_name, const std::vector<Result> &results) {
+    os << "{\n";
+    os << "  \"font\": \"" << escape_json(font_name) << "\",\n";
+    os << "  \"peak_rss_kb\": " << get_peak_rss_kb() << ",\n";
+    os << "  \"results\": [\n";
+
+    for (size_t i = 0; i < results.size(); i++) {
+        const auto &r = results[i];
+        os << "    {\"case\": \"" << r.case_name << "\", \"corpus\": \"" << r.corpus_name
+           << "\", \"codepoints\": " << r.codepoints << ", \"glyphs\": " << r.glyphs
+           << ", \"iterations\": " << r.iterations << ", \"ns_per_call\": " << r.ns_per_call
+           << ", \"ns_per_unit\": " << r.ns_per_unit << ", \"cpp_allocations_per_call\": " << r.cpp_allocations_per_call
+           << ", \"peak_rss_kb\": " << r.peak_rss_kb << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+
+    os << "  ]\n";
+    os << "}\n";
+}
+
+void print_usage() {
+    std::cout << "Usage: text_pipeline_benchmark [--font <font file>] [--json <output file>]" << std::endl;
+    std::cout << "The default font lacks most non-Latin scripts, which are then shaped as missing glyphs." << std::endl;
+}
+
+int main(int argc, char **argv) {
+    std::string font_path;
+    std::string json_path;
+
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        if (arg == "--font" && i + 1 < argc) {
+            font_path = argv[++i];
+        } else if (arg == "--json" && i + 1 < argc) {
+            json_path = argv[++i];
+        } else {
+            print_usage();
+            return 1;
+        }
+    }
+
+    // A font covering all the scripts makes the shaping realistic.
+    if (!font_path.empty()) {
+        auto font = std::make_shared<Font>(font_path);
+        if (!font->is_valid()) {
+            std::cout << "Failed to load font " << font_path << std::endl;
+            return 1;
+        }
+        DefaultResource::get_singleton()->set_default_font(font);
+    }
+
+    auto font = DefaultResource::get_singleton()->get_default_font();
+
+    const uint32_t font_size = 24;
+    const float wrap_width = 320;
+
+    struct Script {
+        const char *name;
+        std::string line;
+    };
+
+    std::vector<Script> scripts = {
+        {"latin", "The quick brown fox jumps over the lazy dog, then naps in the warm afternoon sun.\n"},
+        {"arabic", "مرحبا بالعالم! هذا نص عربي طويل لاختبار تشكيل الحروف واتجاه الكتابة من اليمين.\n"},
+        {"devanagari", "नमस्ते दुनिया! यह देवनागरी लिपि में संयुक्ताक्षर और मात्राओं का परीक्षण है।\n"},
+        {"thai", "สวัสดีชาวโลก! ภาษาไทยไม่มีการเว้นวรรคระหว่างคำจึงต้องตัดคำด้วยพจนานุกรม\n"},
+        {"cjk", "你好世界！こんにちは世界！안녕하세요 세계！漢字とかなが混ざった文章の折り返しを試す。\n"},
+        {"emoji", "Ship it 🚀🚀 looks good 👍😁😂 family 👨‍👩‍👧‍👦 flags 🇯🇵🇫🇷 skin 👋🏽✌🏿\n"},
+    };
+
+    // Line counts of the short, medium and long corpora.
+    std::vector<std::pair<const char *, size_t>> lengths = {{"short", 1}, {"medium", 16}, {"long", 256}};
+
+    std::vector<Corpus> corpora;
+    for (const auto &script : scripts) {
+        for (const auto &[length_name, line_count] : lengths) {
+            corpora.push_back({std::string(script.name) + "/" + length_name, repeat_line(script.line, line_count)});
+        }
+    }
+
+    std::vector<Result> results;
+
+    std::cout << "new/call counts C++ allocations only, not the malloc() calls of HarfBuzz, FriBidi and stb."
+              << std::endl;
+
+    std::cout << std::left << std::setw(18) << "case" << std::setw(20) << "corpus" << std::right << std::setw(8)
+              << "glyphs" << std::setw(14) << "ns/call" << std::setw(12) << "ns/unit" << std::setw(12)
+              << "new/call" << std::setw(14) << "peak RSS KiB" << std::endl;
+
+    auto add_result = [&](Result result, size_t codepoints, size_t glyphs, size_t units) {
+        result.codepoints = codepoints;
+        result.glyphs = glyphs;
+        result.ns_per_unit = result.ns_per_call / std::max<size_t>(units, 1);
+
+        std::cout << std::left << std::setw(18) << result.case_name << std::setw(20) << result.corpus_name
+                  << std::right << std::setw(8) << glyphs << std::fixed << std::setprecision(0) << std::setw(14)
+                  << result.ns_per_call << std::setprecision(1) << std::setw(12) << result.ns_per_unit
+                  << std::setw(12) << result.cpp_allocations_per_call << std::setw(14) << result.peak_rss_kb
+                  << std::endl;
+
+        results.push_back(result);
+    };
+
+    for (const auto &corpus : corpora) {
+        std::u32string text_u32;
+        utf8_to_utf32(corpus.text, text_u32);
+
+        GlyphRun glyphs;
+        std::vector<Line> paragraphs;
+        font->get_glyphs(corpus.text, font_size, glyphs, paragraphs);
+
+        auto glyph_count = glyphs.size();
+
+        // Shaping without any cached paragraph.
+        add_result(measure("get_glyphs_cold",
+                           corpus,
+                           [&] {
+                               font->get_shaping_cache().clear();
+                               font->get_glyphs(corpus.text, font_size, glyphs, paragraphs);
+                           }),
+                   text_u32.size(),
+                   glyph_count,
+                   glyph_count);
+
+        // Shaping with all the paragraphs cached, as when a text is set again.
+        add_result(measure("get_glyphs_warm",
+                           corpus,
+                           [&] { font->get_glyphs(corpus.text, font_size, glyphs, paragraphs); }),
+                   text_u32.size(),
+                   glyph_count,
+                   glyph_count);
+
+        // Measuring and laying out a label, without word wrap.
+        auto label = std::make_shared<Label>();
+        label->set_font_size(font_size);
+        label->set_multi_line(true);
+
+        add_result(measure("label_layout",
+                           corpus,
+                           [&] {
+                               font->get_shaping_cache().clear();
+                               label->set_text("");
+                               label->set_text(corpus.text);
+                               label->update(0);
+                           }),
+                   text_u32.size(),
+                   glyph_count,
+                   glyph_count);
+
+        // Rewrapping a shaped label at alternating widths, as when a window is resized.
+        label->set_word_wrap(true);
+        label->set_size({wrap_width, 0});
+        label->update(0);
+
+        bool wider = false;
+        add_result(measure("label_word_wrap",
+                           corpus,
+                           [&] {
+                               wider = !wider;
+                               label->set_size({wrap_width + (wider ? 1.0f : 0.0f), label->get_size().y});
+                               label->update(0);
+                           }),
+                   text_u32.size(),
+                   glyph_count,
+                   glyph_count);
+
+        // Caret queries of the wrapped label, in both directions.
+        const size_t caret_query_count = std::min<size_t>(text_u32.size() + 1, 256);
+
+        add_result(measure("caret_queries",
+                           corpus,
+                           [&] {
+                               for (size_t i = 0; i < caret_query_count; i++) {
+                                   auto caret_index = uint32_t(i * text_u32.size() / caret_query_count);
+                                   auto position = label->get_caret_position(caret_index);
+                                   label->get_caret_index(position + Vec2F(0, font_size * 0.5f));
+                               }
+                           }),
+                   text_u32.size(),
+                   glyph_count,
+                   caret_query_count * 2);
+    }
+
+    std::cout << "Peak RSS: " << get_peak_rss_kb() << " KiB" << std::endl;
+
+    if (!json_path.empty()) {
+        std::ofstream file(json_path);
+        if (!file) {
+            std::cout << "Failed to write " << json_path << std::endl;
+            return 1;
+        }
+        write_json(file, font_path.empty() ? "default" : font_path, results);
+    }
+
+    return 0;
+}
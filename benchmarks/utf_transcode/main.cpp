@@ -0,0 +1,146 @@
+#include <common/utf.h>
+
+#include <chrono>
+#include <codecvt>
+#include <iostream>
+#include <locale>
+#include <string>
+#include <vector>
+
+using namespace Flint;
+
+// The codecvt-based conversions that were used before.
+namespace Legacy {
+
+std::u32string utf8_to_utf32(const std::string &source) {
+    std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> convertor;
+    return convertor.from_bytes(source);
+}
+
+std::string utf32_to_utf8(const std::u32string &source) {
+    std::wstring_convert<std::codecvt_utf8<char32_t>, char32_t> convertor;
+    return convertor.to_bytes(source);
+}
+
+std::u16string utf8_to_utf16(const std::string &source) {
+    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convertor;
+    return convertor.from_bytes(source);
+}
+
+std::string utf16_to_utf8(const std::u16string &source) {
+    std::wstring_convert<std::codecvt_utf8_utf16<char16_t>, char16_t> convertor;
+    return convertor.to_bytes(source);
+}
+
+} // namespace Legacy
+
+template <typename F>
+double measure_ms(int iterations, F &&func) {
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < iterations; i++) {
+        func();
+    }
+    auto end = std::chrono::steady_clock::now();
+
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+std::string repeat(const std::string &text, size_t target_size) {
+    std::string result;
+    while (result.size() < target_size) {
+        result += text;
+    }
+    return result;
+}
+
+void report(const char *name, double legacy_ms, double new_ms) {
+    std::cout << "  " << name << ": codecvt " << legacy_ms << " ms, utf " << new_ms << " ms, x" << legacy_ms / new_ms
+              << std::endl;
+}
+
+int main() {
+    struct Corpus {
+        const char *name;
+        std::string text;
+    };
+
+    std::vector<Corpus> corpora = {
+        {"ascii", repeat("The quick brown fox jumps over the lazy dog. 0123456789\n", 64 * 1024)},
+        {"mixed", repeat("Hello 你好世界！ مرحبا بالعالم! Привет, мир! 👍😁\n", 64 * 1024)},
+        {"cjk", repeat("こんにちは世界！你好世界！안녕 세계\n", 64 * 1024)},
+    };
+
+    const int iterations = 50;
+
+    for (auto &corpus : corpora) {
+        const auto &text = corpus.text;
+
+        std::u32string text_u32;
+        utf8_to_utf32(text, text_u32);
+
+        std::u16string text_u16;
+        utf8_to_utf16(text, text_u16);
+
+        // Make sure both implementations agree before timing them.
+        if (text_u32 != Legacy::utf8_to_utf32(text) || utf32_to_utf8(text_u32) != text ||
+            text_u16 != Legacy::utf8_to_utf16(text) || utf16_to_utf8(text_u16) != text) {
+            std::cout << "Mismatched conversion result for corpus " << corpus.name << std::endl;
+            return 1;
+        }
+
+        std::cout << corpus.name << " (" << text.size() << " bytes, " << text_u32.size() << " codepoints)"
+                  << std::endl;
+
+        // Keep the results alive so the conversions are not optimized away.
+        size_t sink = 0;
+
+        report("utf8 -> utf32",
+               measure_ms(iterations, [&] { sink += Legacy::utf8_to_utf32(text).size(); }),
+               measure_ms(iterations, [&] {
+                   std::u32string result;
+                   utf8_to_utf32(text, result);
+                   sink += result.size();
+               }));
+
+        report("utf32 -> utf8",
+               measure_ms(iterations, [&] { sink += Legacy::utf32_to_utf8(text_u32).size(); }),
+               measure_ms(iterations, [&] { sink += utf32_to_utf8(text_u32).size(); }));
+
+        report("utf8 -> utf16",
+               measure_ms(iterations, [&] { sink += Legacy::utf8_to_utf16(text).size(); }),
+               measure_ms(iterations, [&] {
+                   std::u16string result;
+                   utf8_to_utf16(text, result);
+                   sink += result.size();
+               }));
+
+        report("utf16 -> utf8",
+               measure_ms(iterations, [&] { sink += Legacy::utf16_to_utf8(text_u16).size(); }),
+               measure_ms(iterations, [&] { sink += utf16_to_utf8(text_u16).size(); }));
+
+        // Conversion into a reused buffer, which doesn't allocate at all.
+        std::vector<char32_t> buffer(utf32_capacity_for_utf8(text.size()));
+        report("utf8 -> utf32 (reused buffer)",
+               measure_ms(iterations, [&] { sink += Legacy::utf8_to_utf32(text).size(); }),
+               measure_ms(iterations, [&] { sink += convert_utf8_to_utf32(text, buffer).written; }));
+
+        // Per-codepoint encoding, as done for typed characters.
+        report("codepoint -> utf8",
+               measure_ms(iterations, [&] {
+                   for (size_t i = 0; i < 4096; i++) {
+                       sink += Legacy::utf32_to_utf8(std::u32string(1, text_u32[i])).size();
+                   }
+               }),
+               measure_ms(iterations, [&] {
+                   for (size_t i = 0; i < 4096; i++) {
+                       sink += codepoint_to_utf8(text_u32[i]).size();
+                   }
+               }));
+
+        if (sink == 0) {
+            std::cout << "Nothing converted" << std::endl;
+        }
+    }
+
+    return 0;
+}
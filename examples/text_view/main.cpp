@@ -0,0 +1,38 @@
+#include "app.h"
+
+using namespace Flint;
+
+using Pathfinder::Vec2;
+using Pathfinder::Vec3;
+
+class MyNode : public Node {
+    void custom_ready() override {
+        auto panel = std::make_shared<Panel>();
+        panel->set_position({50, 50});
+        panel->set_size({540, 380});
+        add_child(panel);
+
+        auto text_view = std::make_shared<TextView>();
+        text_view->set_anchor_flag(AnchorFlag::FullRect);
+        text_view->set_word_wrap(true);
+        panel->add_child(text_view);
+
+        // A log of a million lines, of which only the visible ones are shaped.
+        std::string text;
+        for (int i = 0; i < 1000000; i++) {
+            text += "[" + std::to_string(i) + "] Connection accepted from 127.0.0.1, request handled in " +
+                    std::to_string(i % 97) + " ms.\n";
+        }
+        text_view->set_text(std::move(text));
+    }
+};
+
+int main() {
+    App app({640, 480});
+
+    app.get_tree()->replace_root(std::make_shared<MyNode>());
+
+    app.main_loop();
+
+    return EXIT_SUCCESS;
+}
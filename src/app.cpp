@@ -1,7 +1,9 @@
 #include "app.h"
 
+#include <chrono>
 #include <cstdint>
 #include <memory>
+#include <thread>
 
 #include "common/load_file.h"
 #include "resources/default_resource.h"
@@ -9,6 +11,7 @@
 #include "servers/engine.h"
 #include "servers/input_server.h"
 #include "servers/render_server.h"
+#include "servers/text_server.h"
 #include "servers/vector_server.h"
 
 namespace Flint {
@@ -52,6 +55,9 @@ App::App(Vec2I primary_window_size) {
 }
 
 App::~App() {
+    // Persist the glyphs decoded in this run, if a glyph cache file is in use.
+    TextServer::get_singleton()->get_glyph_disk_cache().save();
+
     // Clean up the scene tree.
     tree.reset();
 
@@ -92,10 +98,22 @@ std::shared_ptr<Pathfinder::Window> get_primary_window() {
 
 void App::main_loop() {
     auto render_server = RenderServer::get_singleton();
+    auto engine = Engine::get_singleton();
+
+    // Draw the first frame in any case.
+    engine->request_redraw();
+
+    auto last_frame_time = std::chrono::steady_clock::now();
 
     while (!get_primary_window()->should_close()) {
         InputServer::get_singleton()->clear_events();
-        RenderServer::get_singleton()->window_builder_->poll_events();
+
+        if (engine->is_on_demand_rendering()) {
+            // Sleep until there's an event or the requested frame is due.
+            render_server->window_builder_->wait_events(engine->get_redraw_wait_time());
+        } else {
+            render_server->window_builder_->poll_events();
+        }
 
         auto primary_window = get_primary_window();
 
@@ -108,15 +126,38 @@ void App::main_loop() {
                 vector_target_ = RenderServer::get_singleton()->device_->create_texture(
                     {primary_window->get_physical_size(), Pathfinder::TextureFormat::Rgba8Unorm}, "dst texture");
                 VectorServer::get_singleton()->set_canvas_size(primary_window->get_physical_size());
+
+                engine->request_redraw();
+            }
+        }
+
+        if (engine->is_on_demand_rendering()) {
+            // Take the request first, so that it's cleared when there's input as well.
+            bool redraw_requested = engine->take_redraw_request();
+            bool has_input = !InputServer::get_singleton()->input_queue.empty();
+
+            if (!redraw_requested && !has_input && !primary_window->get_resize_flag()) {
+                continue;
             }
         }
 
+        // Cap the frame rate.
+        if (engine->get_max_fps() > 0) {
+            auto frame_duration = std::chrono::duration<double>(1.0 / engine->get_max_fps());
+            std::this_thread::sleep_until(
+                last_frame_time + std::chrono::duration_cast<std::chrono::steady_clock::duration>(frame_duration));
+        }
+        last_frame_time = std::chrono::steady_clock::now();
+
         // Engine processing.
         Engine::get_singleton()->tick();
 
         // Get frame time.
         auto dt = Engine::get_singleton()->get_delta();
 
+        // Merge the bursts of mouse events if enabled, keeping the raw ones around.
+        InputServer::get_singleton()->coalesce_events();
+
         // Update the scene tree.
         tree->process(dt);
 
@@ -126,6 +167,8 @@ void App::main_loop() {
         {
             // Acquire next swap chain image.
             if (!primary_swap_chain->acquire_image()) {
+                // Don't lose the frame in the on-demand rendering mode.
+                engine->request_redraw();
                 continue;
             }
 
@@ -133,7 +176,7 @@ void App::main_loop() {
             vector_server->set_dst_texture(vector_target_);
 
             auto render_server = RenderServer::get_singleton();
-            vector_server->submit_and_clear();
+            vector_server->submit_damage_and_clear();
 
             auto encoder = render_server->device_->create_command_encoder("Main encoder");
 
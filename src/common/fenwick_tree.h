@@ -0,0 +1,79 @@
+#ifndef FLINT_FENWICK_TREE_H
+#define FLINT_FENWICK_TREE_H
+
+#include <bit>
+#include <cstddef>
+#include <vector>
+
+namespace Flint {
+
+/// Fenwick tree over an array of values, for prefix sums and lookups in logarithmic time.
+template <typename T>
+class FenwickTree {
+public:
+    /// Build the tree over the values in linear time, by adding each node to its parent.
+    template <typename U>
+    void assign(const std::vector<U> &values) {
+        nodes.assign(values.size() + 1, 0);
+
+        for (size_t node = 1; node < nodes.size(); node++) {
+            nodes[node] += values[node - 1];
+
+            size_t parent = node + lowest_bit(node);
+            if (parent < nodes.size()) {
+                nodes[parent] += nodes[node];
+            }
+        }
+    }
+
+    /// Number of values.
+    size_t size() const {
+        return nodes.empty() ? 0 : nodes.size() - 1;
+    }
+
+    /// Add a delta to the value at the index. Unsigned sums wrap around, so negative deltas work as well.
+    void add(size_t index, T delta) {
+        for (size_t node = index + 1; node < nodes.size(); node += lowest_bit(node)) {
+            nodes[node] += delta;
+        }
+    }
+
+    /// Sum of the first `count` values.
+    T get_prefix_sum(size_t count) const {
+        T sum = 0;
+        for (size_t node = count; node > 0; node -= lowest_bit(node)) {
+            sum += nodes[node];
+        }
+
+        return sum;
+    }
+
+    /// Largest count of leading values whose sum is not greater than the given sum. For non-zero values, this is
+    /// the index of the value whose range contains the sum, or size() if the sum is past the end.
+    size_t find(T sum) const {
+        // Descend the tree, taking each node that still fits.
+        size_t count = 0;
+        for (size_t step = std::bit_floor(size()); step > 0; step >>= 1) {
+            size_t node = count + step;
+            if (node < nodes.size() && nodes[node] <= sum) {
+                count = node;
+                sum -= nodes[node];
+            }
+        }
+
+        return count;
+    }
+
+private:
+    /// Lowest set bit, which is the range covered by a node.
+    static size_t lowest_bit(size_t value) {
+        return value & (~value + 1);
+    }
+
+    /// Node i covers the values [i - lowest_bit(i), i). Node 0 is unused.
+    std::vector<T> nodes;
+};
+
+} // namespace Flint
+
+#endif // FLINT_FENWICK_TREE_H
@@ -0,0 +1,416 @@
+#include "line_break.h"
+
+#include <algorithm>
+
+namespace Flint {
+
+using LBC = LineBreakClass;
+
+namespace {
+
+struct LineBreakRange {
+    char32_t first;
+    char32_t last;
+    LineBreakClass cls;
+};
+
+// Sorted, non-overlapping. Hangul syllables are handled separately since LV and LVT alternate.
+constexpr LineBreakRange LINE_BREAK_RANGES[] = {
+    {0x0000, 0x0008, LBC::CM},    {0x0009, 0x0009, LBC::BA},    {0x000A, 0x000A, LBC::LF},
+    {0x000B, 0x000C, LBC::BK},    {0x000D, 0x000D, LBC::CR},    {0x000E, 0x001F, LBC::CM},
+    {0x0020, 0x0020, LBC::SP},    {0x0021, 0x0021, LBC::EX},    {0x0022, 0x0022, LBC::QU},
+    {0x0024, 0x0024, LBC::PR},    {0x0025, 0x0025, LBC::PO},    {0x0027, 0x0027, LBC::QU},
+    {0x0028, 0x0028, LBC::OP},    {0x0029, 0x0029, LBC::CP},    {0x002B, 0x002B, LBC::PR},
+    {0x002C, 0x002C, LBC::IS},    {0x002D, 0x002D, LBC::HY},    {0x002E, 0x002E, LBC::IS},
+    {0x002F, 0x002F, LBC::SY},    {0x0030, 0x0039, LBC::NU},    {0x003A, 0x003B, LBC::IS},
+    {0x003F, 0x003F, LBC::EX},    {0x005B, 0x005B, LBC::OP},    {0x005C, 0x005C, LBC::PR},
+    {0x005D, 0x005D, LBC::CP},    {0x007B, 0x007B, LBC::OP},    {0x007C, 0x007C, LBC::BA},
+    {0x007D, 0x007D, LBC::CL},    {0x007F, 0x0084, LBC::CM},    {0x0085, 0x0085, LBC::NL},
+    {0x0086, 0x009F, LBC::CM},    {0x00A0, 0x00A0, LBC::GL},    {0x00A1, 0x00A1, LBC::OP},
+    {0x00A2, 0x00A2, LBC::PO},    {0x00A3, 0x00A5, LBC::PR},    {0x00AB, 0x00AB, LBC::QU},
+    {0x00AD, 0x00AD, LBC::BA},    {0x00B0, 0x00B0, LBC::PO},    {0x00B1, 0x00B1, LBC::PR},
+    {0x00B4, 0x00B4, LBC::BB},    {0x00BB, 0x00BB, LBC::QU},    {0x00BF, 0x00BF, LBC::OP},
+    {0x0300, 0x034E, LBC::CM},    {0x034F, 0x034F, LBC::GL},    {0x0350, 0x036F, LBC::CM},
+    {0x0483, 0x0489, LBC::CM},    {0x0591, 0x05BD, LBC::CM},    {0x05BE, 0x05BE, LBC::BA},
+    {0x05BF, 0x05C7, LBC::CM},    {0x05D0, 0x05EA, LBC::HL},    {0x05EF, 0x05F2, LBC::HL},
+    {0x0600, 0x0605, LBC::AL},    {0x0609, 0x060B, LBC::PO},    {0x060C, 0x060D, LBC::IS},
+    {0x0610, 0x061A, LBC::CM},    {0x061B, 0x061B, LBC::EX},    {0x061F, 0x061F, LBC::EX},
+    {0x064B, 0x065F, LBC::CM},    {0x0660, 0x0669, LBC::NU},    {0x066A, 0x066A, LBC::PO},
+    {0x066B, 0x066C, LBC::NU},    {0x0670, 0x0670, LBC::CM},    {0x06D4, 0x06D4, LBC::EX},
+    {0x06D6, 0x06DC, LBC::CM},    {0x06DF, 0x06E4, LBC::CM},    {0x06E7, 0x06E8, LBC::CM},
+    {0x06EA, 0x06ED, LBC::CM},    {0x06F0, 0x06F9, LBC::NU},    {0x0900, 0x0903, LBC::CM},
+    {0x093A, 0x093C, LBC::CM},    {0x093E, 0x094F, LBC::CM},    {0x0951, 0x0957, LBC::CM},
+    {0x0962, 0x0963, LBC::CM},    {0x0964, 0x0965, LBC::BA},    {0x0966, 0x096F, LBC::NU},
+    {0x0981, 0x0983, LBC::CM},    {0x09BC, 0x09BC, LBC::CM},    {0x09BE, 0x09CD, LBC::CM},
+    {0x09D7, 0x09D7, LBC::CM},    {0x09E2, 0x09E3, LBC::CM},    {0x09E6, 0x09EF, LBC::NU},
+    {0x09F2, 0x09F3, LBC::PO},    {0x0E01, 0x0E3A, LBC::SA},    {0x0E3F, 0x0E3F, LBC::PR},
+    {0x0E40, 0x0E4E, LBC::SA},    {0x0E4F, 0x0E4F, LBC::AL},    {0x0E50, 0x0E59, LBC::NU},
+    {0x0E5A, 0x0E5B, LBC::BA},    {0x1100, 0x115F, LBC::JL},    {0x1160, 0x11A7, LBC::JV},
+    {0x11A8, 0x11FF, LBC::JT},    {0x1AB0, 0x1AFF, LBC::CM},    {0x1DC0, 0x1DFF, LBC::CM},
+    {0x2000, 0x2006, LBC::BA},    {0x2007, 0x2007, LBC::GL},    {0x2008, 0x200A, LBC::BA},
+    {0x200B, 0x200B, LBC::ZW},    {0x200C, 0x200C, LBC::CM},    {0x200D, 0x200D, LBC::ZWJ},
+    {0x200E, 0x200F, LBC::CM},    {0x2010, 0x2010, LBC::BA},    {0x2011, 0x2011, LBC::GL},
+    {0x2012, 0x2013, LBC::BA},    {0x2014, 0x2014, LBC::B2},    {0x2018, 0x2019, LBC::QU},
+    {0x201A, 0x201A, LBC::OP},    {0x201B, 0x201D, LBC::QU},    {0x201E, 0x201E, LBC::OP},
+    {0x201F, 0x201F, LBC::QU},    {0x2024, 0x2026, LBC::IN},    {0x2027, 0x2027, LBC::BA},
+    {0x2028, 0x2029, LBC::BK},    {0x202A, 0x202E, LBC::CM},    {0x202F, 0x202F, LBC::GL},
+    {0x2030, 0x2037, LBC::PO},    {0x2039, 0x203A, LBC::QU},    {0x203C, 0x203D, LBC::NS},
+    {0x2044, 0x2044, LBC::IS},    {0x2045, 0x2045, LBC::OP},    {0x2046, 0x2046, LBC::CL},
+    {0x2047, 0x2049, LBC::NS},    {0x2060, 0x2060, LBC::WJ},    {0x2066, 0x206F, LBC::CM},
+    {0x20A0, 0x20CF, LBC::PR},    {0x20D0, 0x20F0, LBC::CM},    {0x2103, 0x2103, LBC::PO},
+    {0x2109, 0x2109, LBC::PO},    {0x2116, 0x2116, LBC::PR},    {0x231A, 0x231B, LBC::ID},
+    {0x2329, 0x2329, LBC::OP},    {0x232A, 0x232A, LBC::CL},    {0x23F0, 0x23F3, LBC::ID},
+    {0x2600, 0x2603, LBC::ID},    {0x2614, 0x2615, LBC::ID},    {0x261D, 0x261D, LBC::EB},
+    {0x2639, 0x263B, LBC::ID},    {0x2668, 0x2668, LBC::ID},    {0x267F, 0x267F, LBC::ID},
+    {0x26BD, 0x26C8, LBC::ID},    {0x26CD, 0x26CD, LBC::ID},    {0x26CF, 0x26D1, LBC::ID},
+    {0x26D3, 0x26D4, LBC::ID},    {0x26D8, 0x26D9, LBC::ID},    {0x26DC, 0x26DC, LBC::ID},
+    {0x26DF, 0x26E1, LBC::ID},    {0x26EA, 0x26EA, LBC::ID},    {0x26F1, 0x26F5, LBC::ID},
+    {0x26F7, 0x26F8, LBC::ID},    {0x26F9, 0x26F9, LBC::EB},    {0x26FA, 0x26FA, LBC::ID},
+    {0x26FD, 0x2704, LBC::ID},    {0x2708, 0x2709, LBC::ID},    {0x270A, 0x270D, LBC::EB},
+    {0x275B, 0x2760, LBC::QU},    {0x2762, 0x2763, LBC::EX},    {0x2768, 0x2768, LBC::OP},
+    {0x2769, 0x2769, LBC::CL},    {0x276A, 0x276A, LBC::OP},    {0x276B, 0x276B, LBC::CL},
+    {0x2E80, 0x2FFF, LBC::ID},    {0x3000, 0x3000, LBC::BA},    {0x3001, 0x3002, LBC::CL},
+    {0x3003, 0x3004, LBC::ID},    {0x3005, 0x3005, LBC::NS},    {0x3006, 0x3007, LBC::ID},
+    {0x3008, 0x3008, LBC::OP},    {0x3009, 0x3009, LBC::CL},    {0x300A, 0x300A, LBC::OP},
+    {0x300B, 0x300B, LBC::CL},    {0x300C, 0x300C, LBC::OP},    {0x300D, 0x300D, LBC::CL},
+    {0x300E, 0x300E, LBC::OP},    {0x300F, 0x300F, LBC::CL},    {0x3010, 0x3010, LBC::OP},
+    {0x3011, 0x3011, LBC::CL},    {0x3012, 0x3013, LBC::ID},    {0x3014, 0x3014, LBC::OP},
+    {0x3015, 0x3015, LBC::CL},    {0x3016, 0x3016, LBC::OP},    {0x3017, 0x3017, LBC::CL},
+    {0x3018, 0x3018, LBC::OP},    {0x3019, 0x3019, LBC::CL},    {0x301A, 0x301A, LBC::OP},
+    {0x301B, 0x301B, LBC::CL},    {0x301C, 0x301C, LBC::NS},    {0x301D, 0x301D, LBC::OP},
+    {0x301E, 0x301F, LBC::CL},    {0x3020, 0x3029, LBC::ID},    {0x302A, 0x302F, LBC::CM},
+    {0x3030, 0x303A, LBC::ID},    {0x303B, 0x303C, LBC::NS},    {0x303D, 0x303F, LBC::ID},
+    {0x3041, 0x3041, LBC::CJ},    {0x3042, 0x3042, LBC::ID},    {0x3043, 0x3043, LBC::CJ},
+    {0x3044, 0x3044, LBC::ID},    {0x3045, 0x3045, LBC::CJ},    {0x3046, 0x3046, LBC::ID},
+    {0x3047, 0x3047, LBC::CJ},    {0x3048, 0x3048, LBC::ID},    {0x3049, 0x3049, LBC::CJ},
+    {0x304A, 0x3062, LBC::ID},    {0x3063, 0x3063, LBC::CJ},    {0x3064, 0x3082, LBC::ID},
+    {0x3083, 0x3083, LBC::CJ},    {0x3084, 0x3084, LBC::ID},    {0x3085, 0x3085, LBC::CJ},
+    {0x3086, 0x3086, LBC::ID},    {0x3087, 0x3087, LBC::CJ},    {0x3088, 0x308D, LBC::ID},
+    {0x308E, 0x308E, LBC::CJ},    {0x308F, 0x3094, LBC::ID},    {0x3095, 0x3096, LBC::CJ},
+    {0x3099, 0x309A, LBC::CM},    {0x309B, 0x309E, LBC::NS},    {0x309F, 0x309F, LBC::ID},
+    {0x30A0, 0x30A0, LBC::NS},    {0x30A1, 0x30A1, LBC::CJ},    {0x30A2, 0x30A2, LBC::ID},
+    {0x30A3, 0x30A3, LBC::CJ},    {0x30A4, 0x30A4, LBC::ID},    {0x30A5, 0x30A5, LBC::CJ},
+    {0x30A6, 0x30A6, LBC::ID},    {0x30A7, 0x30A7, LBC::CJ},    {0x30A8, 0x30A8, LBC::ID},
+    {0x30A9, 0x30A9, LBC::CJ},    {0x30AA, 0x30C2, LBC::ID},    {0x30C3, 0x30C3, LBC::CJ},
+    {0x30C4, 0x30E2, LBC::ID},    {0x30E3, 0x30E3, LBC::CJ},    {0x30E4, 0x30E4, LBC::ID},
+    {0x30E5, 0x30E5, LBC::CJ},    {0x30E6, 0x30E6, LBC::ID},    {0x30E7, 0x30E7, LBC::CJ},
+    {0x30E8, 0x30ED, LBC::ID},    {0x30EE, 0x30EE, LBC::CJ},    {0x30EF, 0x30F4, LBC::ID},
+    {0x30F5, 0x30F6, LBC::CJ},    {0x30F7, 0x30FA, LBC::ID},    {0x30FB, 0x30FB, LBC::NS},
+    {0x30FC, 0x30FC, LBC::CJ},    {0x30FD, 0x30FE, LBC::NS},    {0x30FF, 0x30FF, LBC::ID},
+    {0x3100, 0x31EF, LBC::ID},    {0x31F0, 0x31FF, LBC::CJ},    {0x3200, 0x4DBF, LBC::ID},
+    {0x4E00, 0x9FFF, LBC::ID},    {0xA000, 0xA48F, LBC::ID},    {0xA960, 0xA97F, LBC::JL},
+    {0xD7B0, 0xD7C6, LBC::JV},    {0xD7CB, 0xD7FB, LBC::JT},    {0xF900, 0xFAFF, LBC::ID},
+    {0xFE00, 0xFE0F, LBC::CM},    {0xFE10, 0xFE10, LBC::IS},    {0xFE11, 0xFE12, LBC::CL},
+    {0xFE13, 0xFE14, LBC::IS},    {0xFE15, 0xFE16, LBC::EX},    {0xFE20, 0xFE2F, LBC::CM},
+    {0xFEFF, 0xFEFF, LBC::WJ},    {0xFF01, 0xFF01, LBC::EX},    {0xFF02, 0xFF03, LBC::ID},
+    {0xFF04, 0xFF04, LBC::PR},    {0xFF05, 0xFF05, LBC::PO},    {0xFF06, 0xFF07, LBC::ID},
+    {0xFF08, 0xFF08, LBC::OP},    {0xFF09, 0xFF09, LBC::CL},    {0xFF0A, 0xFF0B, LBC::ID},
+    {0xFF0C, 0xFF0C, LBC::CL},    {0xFF0D, 0xFF0D, LBC::ID},    {0xFF0E, 0xFF0E, LBC::CL},
+    {0xFF0F, 0xFF19, LBC::ID},    {0xFF1A, 0xFF1B, LBC::NS},    {0xFF1C, 0xFF1E, LBC::ID},
+    {0xFF1F, 0xFF1F, LBC::EX},    {0xFF20, 0xFF3A, LBC::ID},    {0xFF3B, 0xFF3B, LBC::OP},
+    {0xFF3C, 0xFF3C, LBC::ID},    {0xFF3D, 0xFF3D, LBC::CL},    {0xFF3E, 0xFF5A, LBC::ID},
+    {0xFF5B, 0xFF5B, LBC::OP},    {0xFF5C, 0xFF5C, LBC::ID},    {0xFF5D, 0xFF5D, LBC::CL},
+    {0xFF5E, 0xFF5E, LBC::ID},    {0xFF5F, 0xFF5F, LBC::OP},    {0xFF60, 0xFF61, LBC::CL},
+    {0xFF62, 0xFF62, LBC::OP},    {0xFF63, 0xFF64, LBC::CL},    {0xFF65, 0xFF65, LBC::NS},
+    {0xFF66, 0xFF66, LBC::ID},    {0xFF67, 0xFF70, LBC::CJ},    {0xFF71, 0xFF9D, LBC::ID},
+    {0xFF9E, 0xFF9F, LBC::NS},    {0xFFE0, 0xFFE0, LBC::PO},    {0xFFE1, 0xFFE1, LBC::PR},
+    {0xFFE5, 0xFFE6, LBC::PR},    {0xFFFC, 0xFFFC, LBC::CB},    {0x1F000, 0x1F1E5, LBC::ID},
+    {0x1F1E6, 0x1F1FF, LBC::RI},  {0x1F200, 0x1F384, LBC::ID},  {0x1F385, 0x1F385, LBC::EB},
+    {0x1F386, 0x1F3C1, LBC::ID},  {0x1F3C2, 0x1F3C4, LBC::EB},  {0x1F3C5, 0x1F3C6, LBC::ID},
+    {0x1F3C7, 0x1F3C7, LBC::EB},  {0x1F3C8, 0x1F3C9, LBC::ID},  {0x1F3CA, 0x1F3CC, LBC::EB},
+    {0x1F3CD, 0x1F3FA, LBC::ID},  {0x1F3FB, 0x1F3FF, LBC::EM},  {0x1F400, 0x1F441, LBC::ID},
+    {0x1F442, 0x1F443, LBC::EB},  {0x1F444, 0x1F445, LBC::ID},  {0x1F446, 0x1F450, LBC::EB},
+    {0x1F451, 0x1F465, LBC::ID},  {0x1F466, 0x1F478, LBC::EB},  {0x1F479, 0x1F47B, LBC::ID},
+    {0x1F47C, 0x1F47C, LBC::EB},  {0x1F47D, 0x1F480, LBC::ID},  {0x1F481, 0x1F483, LBC::EB},
+    {0x1F484, 0x1F484, LBC::ID},  {0x1F485, 0x1F487, LBC::EB},  {0x1F488, 0x1F4A9, LBC::ID},
+    {0x1F4AA, 0x1F4AA, LBC::EB},  {0x1F4AB, 0x1F573, LBC::ID},  {0x1F574, 0x1F575, LBC::EB},
+    {0x1F576, 0x1F579, LBC::ID},  {0x1F57A, 0x1F57A, LBC::EB},  {0x1F57B, 0x1F58F, LBC::ID},
+    {0x1F590, 0x1F590, LBC::EB},  {0x1F591, 0x1F594, LBC::ID},  {0x1F595, 0x1F596, LBC::EB},
+    {0x1F597, 0x1F644, LBC::ID},  {0x1F645, 0x1F647, LBC::EB},  {0x1F648, 0x1F64A, LBC::ID},
+    {0x1F64B, 0x1F64F, LBC::EB},  {0x1F650, 0x1F6A2, LBC::ID},  {0x1F6A3, 0x1F6A3, LBC::EB},
+    {0x1F6A4, 0x1F6B3, LBC::ID},  {0x1F6B4, 0x1F6B6, LBC::EB},  {0x1F6B7, 0x1F6BF, LBC::ID},
+    {0x1F6C0, 0x1F6C0, LBC::EB},  {0x1F6C1, 0x1F6CB, LBC::ID},  {0x1F6CC, 0x1F6CC, LBC::EB},
+    {0x1F6CD, 0x1F90B, LBC::ID},  {0x1F90C, 0x1F90C, LBC::EB},  {0x1F90D, 0x1F90E, LBC::ID},
+    {0x1F90F, 0x1F90F, LBC::EB},  {0x1F910, 0x1F917, LBC::ID},  {0x1F918, 0x1F91F, LBC::EB},
+    {0x1F920, 0x1F925, LBC::ID},  {0x1F926, 0x1F926, LBC::EB},  {0x1F927, 0x1F92F, LBC::ID},
+    {0x1F930, 0x1F939, LBC::EB},  {0x1F93A, 0x1F93B, LBC::ID},  {0x1F93C, 0x1F93E, LBC::EB},
+    {0x1F93F, 0x1F976, LBC::ID},  {0x1F977, 0x1F977, LBC::EB},  {0x1F978, 0x1F9B4, LBC::ID},
+    {0x1F9B5, 0x1F9B6, LBC::EB},  {0x1F9B7, 0x1F9B7, LBC::ID},  {0x1F9B8, 0x1F9B9, LBC::EB},
+    {0x1F9BA, 0x1F9BA, LBC::ID},  {0x1F9BB, 0x1F9BB, LBC::EB},  {0x1F9BC, 0x1F9CC, LBC::ID},
+    {0x1F9CD, 0x1F9CF, LBC::EB},  {0x1F9D0, 0x1F9D0, LBC::ID},  {0x1F9D1, 0x1F9DD, LBC::EB},
+    {0x1F9DE, 0x1FAFF, LBC::ID},  {0x20000, 0x3FFFD, LBC::ID},  {0xE0001, 0xE007F, LBC::CM},
+    {0xE0100, 0xE01EF, LBC::CM},
+};
+
+/// LB1: resolve the classes that have no pair rules of their own.
+LineBreakClass resolve_class(LineBreakClass cls, char32_t codepoint) {
+    switch (cls) {
+        case LBC::AI:
+        case LBC::XX:
+            return LBC::AL;
+        case LBC::CJ:
+            return LBC::NS;
+        case LBC::SA: {
+            // Thai vowel signs and tone marks attach to the preceding consonant.
+            bool is_mark = codepoint == 0x0E31 || (codepoint >= 0x0E34 && codepoint <= 0x0E3A) ||
+                           (codepoint >= 0x0E47 && codepoint <= 0x0E4E);
+            return is_mark ? LBC::CM : LBC::AL;
+        }
+        default:
+            return cls;
+    }
+}
+
+bool is_hard_break(LineBreakClass cls) {
+    return cls == LBC::BK || cls == LBC::CR || cls == LBC::LF || cls == LBC::NL;
+}
+
+bool is_alphabetic(LineBreakClass cls) {
+    return cls == LBC::AL || cls == LBC::HL;
+}
+
+bool is_hangul(LineBreakClass cls) {
+    return cls == LBC::JL || cls == LBC::JV || cls == LBC::JT || cls == LBC::H2 || cls == LBC::H3;
+}
+
+/// Pair rules LB11 to LB31 for two adjacent non-space classes, or a space before `after`.
+/// `before_spaces` is the class before any spaces preceding `after`, which is the same as `before` if there are none.
+bool is_break_allowed(LineBreakClass before, LineBreakClass before_spaces, LineBreakClass after) {
+    bool after_spaces = before == LBC::SP;
+
+    // LB11
+    if (after == LBC::WJ || before == LBC::WJ) {
+        return false;
+    }
+
+    // LB12, LB12a
+    if (before == LBC::GL) {
+        return false;
+    }
+    if (after == LBC::GL && before != LBC::SP && before != LBC::BA && before != LBC::HY) {
+        return false;
+    }
+
+    // LB13
+    if (after == LBC::CL || after == LBC::CP || after == LBC::EX || after == LBC::IS || after == LBC::SY) {
+        return false;
+    }
+
+    // LB14 to LB17, which apply across spaces.
+    if (before_spaces == LBC::OP) {
+        return false;
+    }
+    if (before_spaces == LBC::QU && after == LBC::OP) {
+        return false;
+    }
+    if ((before_spaces == LBC::CL || before_spaces == LBC::CP) && after == LBC::NS) {
+        return false;
+    }
+    if (before_spaces == LBC::B2 && after == LBC::B2) {
+        return false;
+    }
+
+    // LB18
+    if (after_spaces) {
+        return true;
+    }
+
+    // LB19
+    if (after == LBC::QU || before == LBC::QU) {
+        return false;
+    }
+
+    // LB20
+    if (after == LBC::CB || before == LBC::CB) {
+        return true;
+    }
+
+    // LB21, LB21a, LB21b
+    if (after == LBC::BA || after == LBC::HY || after == LBC::NS || before == LBC::BB) {
+        return false;
+    }
+    if (before == LBC::SY && after == LBC::HL) {
+        return false;
+    }
+
+    // LB22
+    if (after == LBC::IN) {
+        return false;
+    }
+
+    // LB23, LB23a
+    if ((is_alphabetic(before) && after == LBC::NU) || (before == LBC::NU && is_alphabetic(after))) {
+        return false;
+    }
+    if (before == LBC::PR && (after == LBC::ID || after == LBC::EB || after == LBC::EM)) {
+        return false;
+    }
+    if ((before == LBC::ID || before == LBC::EB || before == LBC::EM) && after == LBC::PO) {
+        return false;
+    }
+
+    // LB24
+    if ((before == LBC::PR || before == LBC::PO) && is_alphabetic(after)) {
+        return false;
+    }
+    if (is_alphabetic(before) && (after == LBC::PR || after == LBC::PO)) {
+        return false;
+    }
+
+    // LB25, in its pair form.
+    if ((before == LBC::CL || before == LBC::CP || before == LBC::NU) && (after == LBC::PO || after == LBC::PR)) {
+        return false;
+    }
+    if ((before == LBC::PO || before == LBC::PR) && (after == LBC::OP || after == LBC::NU)) {
+        return false;
+    }
+    if ((before == LBC::HY || before == LBC::IS || before == LBC::NU || before == LBC::SY) && after == LBC::NU) {
+        return false;
+    }
+
+    // LB26
+    if (before == LBC::JL && (after == LBC::JL || after == LBC::JV || after == LBC::H2 || after == LBC::H3)) {
+        return false;
+    }
+    if ((before == LBC::JV || before == LBC::H2) && (after == LBC::JV || after == LBC::JT)) {
+        return false;
+    }
+    if ((before == LBC::JT || before == LBC::H3) && after == LBC::JT) {
+        return false;
+    }
+
+    // LB27
+    if ((is_hangul(before) && after == LBC::PO) || (before == LBC::PR && is_hangul(after))) {
+        return false;
+    }
+
+    // LB28, LB29
+    if ((is_alphabetic(before) || before == LBC::IS) && is_alphabetic(after)) {
+        return false;
+    }
+
+    // LB30
+    if ((is_alphabetic(before) || before == LBC::NU) && after == LBC::OP) {
+        return false;
+    }
+    if (before == LBC::CP && (is_alphabetic(after) || after == LBC::NU)) {
+        return false;
+    }
+
+    // LB30b (LB30a needs the regional indicator count and is handled by the caller).
+    if (before == LBC::EB && after == LBC::EM) {
+        return false;
+    }
+
+    // LB31
+    return true;
+}
+
+} // namespace
+
+LineBreakClass get_line_break_class(char32_t codepoint) {
+    // Hangul syllables: every 28th one is LV, the rest are LVT.
+    if (codepoint >= 0xAC00 && codepoint <= 0xD7A3) {
+        return (codepoint - 0xAC00) % 28 == 0 ? LBC::H2 : LBC::H3;
+    }
+
+    auto it = std::upper_bound(std::begin(LINE_BREAK_RANGES),
+                               std::end(LINE_BREAK_RANGES),
+                               codepoint,
+                               [](char32_t cp, const LineBreakRange &range) { return cp < range.first; });
+
+    if (it != std::begin(LINE_BREAK_RANGES)) {
+        const auto &range = *(it - 1);
+        if (codepoint <= range.last) {
+            return range.cls;
+        }
+    }
+
+    return LBC::AL;
+}
+
+void find_line_break_opportunities(std::u32string_view text, std::vector<bool> &break_opportunities) {
+    break_opportunities.assign(text.size(), false);
+
+    if (text.empty()) {
+        return;
+    }
+
+    // LB2: never break at the start of text.
+    LineBreakClass before = resolve_class(get_line_break_class(text[0]), text[0]);
+    if (before == LBC::CM || before == LBC::ZWJ) {
+        before = LBC::AL; // LB10
+    }
+
+    // Raw class of the previous character, since LB8a looks at a ZWJ even when it's absorbed by LB9.
+    LineBreakClass previous_raw = before;
+    LineBreakClass before_spaces = before;
+
+    // Regional indicators in the current sequence, for LB30a.
+    size_t regional_indicator_count = before == LBC::RI ? 1 : 0;
+
+    for (size_t i = 1; i < text.size(); i++) {
+        LineBreakClass raw = resolve_class(get_line_break_class(text[i]), text[i]);
+        LineBreakClass after = raw;
+
+        bool allowed;
+
+        // Combining characters absorbed into the previous character's class.
+        bool absorbed = false;
+
+        if (before == LBC::CR && after == LBC::LF) {
+            // LB5
+            allowed = false;
+        } else if (is_hard_break(before)) {
+            // LB4, LB5
+            allowed = true;
+        } else if (is_hard_break(after) || after == LBC::SP || after == LBC::ZW) {
+            // LB6, LB7
+            allowed = false;
+        } else if (before_spaces == LBC::ZW) {
+            // LB8
+            allowed = true;
+        } else if (previous_raw == LBC::ZWJ) {
+            // LB8a
+            allowed = false;
+            if (after == LBC::CM || after == LBC::ZWJ) {
+                after = before;
+                absorbed = true;
+            }
+        } else if ((after == LBC::CM || after == LBC::ZWJ) && before != LBC::SP && before != LBC::ZW) {
+            // LB9: a combining sequence takes the class of its base.
+            allowed = false;
+            after = before;
+            absorbed = true;
+        } else {
+            if (after == LBC::CM || after == LBC::ZWJ) {
+                after = LBC::AL; // LB10
+            }
+
+            if (before == LBC::RI && after == LBC::RI) {
+                // LB30a: regional indicators pair up into flags.
+                allowed = regional_indicator_count % 2 == 0;
+            } else {
+                allowed = is_break_allowed(before, before_spaces, after);
+            }
+        }
+
+        break_opportunities[i] = allowed;
+
+        if (absorbed) {
+            // Keep the regional indicator count.
+        } else if (after == LBC::RI) {
+            regional_indicator_count = before == LBC::RI ? regional_indicator_count + 1 : 1;
+        } else {
+            regional_indicator_count = 0;
+        }
+
+        if (after != LBC::SP) {
+            before_spaces = after;
+        }
+        before = after;
+        previous_raw = raw;
+    }
+}
+
+} // namespace Flint
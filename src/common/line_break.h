@@ -0,0 +1,79 @@
+#ifndef FLINT_LINE_BREAK_H
+#define FLINT_LINE_BREAK_H
+
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace Flint {
+
+/// Line breaking classes from UAX #14, see https://www.unicode.org/reports/tr14/.
+enum class LineBreakClass : uint8_t {
+    // Non-tailorable.
+    BK, // Mandatory break
+    CR, // Carriage return
+    LF, // Line feed
+    NL, // Next line
+    SP, // Space
+    ZW, // Zero width space
+    WJ, // Word joiner
+    GL, // Non-breaking glue
+    CM, // Combining mark
+    ZWJ, // Zero width joiner
+
+    // Break opportunities.
+    BA, // Break after
+    BB, // Break before
+    B2, // Break on either side, but not pair
+    HY, // Hyphen
+    CB, // Contingent break
+
+    // Characters prohibiting certain breaks.
+    CL, // Close punctuation
+    CP, // Close parenthesis
+    EX, // Exclamation/interrogation
+    IN, // Inseparable
+    NS, // Nonstarter
+    OP, // Open punctuation
+    QU, // Quotation
+
+    // Numeric context.
+    IS, // Infix numeric separator
+    NU, // Numeric
+    PO, // Postfix numeric
+    PR, // Prefix numeric
+    SY, // Symbols allowing break after
+
+    // Others.
+    AL, // Alphabetic
+    HL, // Hebrew letter
+    ID, // Ideographic
+    EB, // Emoji base
+    EM, // Emoji modifier
+    RI, // Regional indicator
+    H2, // Hangul LV syllable
+    H3, // Hangul LVT syllable
+    JL, // Hangul L jamo
+    JV, // Hangul V jamo
+    JT, // Hangul T jamo
+
+    // Resolved to other classes before breaking.
+    SA, // Complex context (South East Asian)
+    CJ, // Conditional Japanese starter
+    AI, // Ambiguous
+    XX, // Unknown
+};
+
+/// Line breaking class of a codepoint, from a table covering the scripts supported by the text pipeline.
+/// Codepoints outside the table are AL.
+LineBreakClass get_line_break_class(char32_t codepoint);
+
+/// Find the line break opportunities in a paragraph with the pair rules of UAX #14 (LB2 to LB31).
+/// After this, `break_opportunities[i]` is true if a line may start at codepoint i. A mandatory break (e.g. after a
+/// line feed) is also an opportunity.
+/// @note SA characters are not segmented by a dictionary, so Thai words are not broken.
+void find_line_break_opportunities(std::u32string_view text, std::vector<bool> &break_opportunities);
+
+} // namespace Flint
+
+#endif // FLINT_LINE_BREAK_H
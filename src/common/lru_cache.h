@@ -0,0 +1,147 @@
+#ifndef FLINT_LRU_CACHE_H
+#define FLINT_LRU_CACHE_H
+
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <unordered_map>
+
+namespace Flint {
+
+struct LruCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+
+    size_t entry_count = 0;
+
+    /// Total size of the entries, in the unit of SizeFn.
+    size_t size = 0;
+    size_t budget = 0;
+};
+
+/// Least recently used cache, which evicts entries once their total size exceeds the budget.
+/// The most recently used entry is always kept, so that a reference returned by insert() stays valid until the next
+/// insertion.
+/// @tparam SizeFn Returns the size of a value, e.g. its estimated memory usage in bytes, or 1 to limit the entry
+/// count. It's called once when the value is inserted.
+/// @tparam Hash A transparent hash and key equality allow finding entries by other types, e.g. views of the keys.
+template <typename Key,
+          typename Value,
+          typename SizeFn,
+          typename Hash = std::hash<Key>,
+          typename KeyEqual = std::equal_to<Key>>
+class LruCache {
+public:
+    explicit LruCache(size_t budget) : budget_(budget) {
+    }
+
+    /// Returns nullptr if the key is not cached. A hit marks the entry as the most recently used one.
+    /// @note The returned pointer is only valid until the next insertion.
+    template <typename K>
+    Value *find(const K &key) {
+        auto iter = entries.find(key);
+        if (iter == entries.end()) {
+            misses_++;
+            return nullptr;
+        }
+
+        hits_++;
+
+        // Move the entry to the front without reallocating it.
+        lru_list.splice(lru_list.begin(), lru_list, iter->second);
+
+        return &iter->second->value;
+    }
+
+    /// Cache a value, replacing the old one of the key if there's any and evicting the least recently used entries
+    /// if the budget is exceeded.
+    /// @note The returned reference is only valid until the next insertion.
+    Value &insert(Key key, Value value) {
+        auto iter = entries.find(key);
+        if (iter != entries.end()) {
+            size_ -= iter->second->size;
+            lru_list.erase(iter->second);
+            entries.erase(iter);
+        }
+
+        size_t value_size = SizeFn()(value);
+
+        lru_list.push_front({std::move(key), std::move(value), value_size});
+        entries[lru_list.front().key] = lru_list.begin();
+        size_ += value_size;
+
+        evict();
+
+        return lru_list.front().value;
+    }
+
+    void set_budget(size_t new_budget) {
+        budget_ = new_budget;
+
+        evict();
+    }
+
+    size_t get_budget() const {
+        return budget_;
+    }
+
+    LruCacheStats get_stats() const {
+        LruCacheStats stats;
+        stats.hits = hits_;
+        stats.misses = misses_;
+        stats.evictions = evictions_;
+        stats.entry_count = lru_list.size();
+        stats.size = size_;
+        stats.budget = budget_;
+
+        return stats;
+    }
+
+    void reset_stats() {
+        hits_ = 0;
+        misses_ = 0;
+        evictions_ = 0;
+    }
+
+    void clear() {
+        lru_list.clear();
+        entries.clear();
+        size_ = 0;
+    }
+
+private:
+    struct Entry {
+        Key key;
+        Value value;
+        size_t size;
+    };
+
+    void evict() {
+        while (size_ > budget_ && lru_list.size() > 1) {
+            auto &last = lru_list.back();
+
+            size_ -= last.size;
+            entries.erase(last.key);
+            lru_list.pop_back();
+
+            evictions_++;
+        }
+    }
+
+    // The front is the most recently used entry.
+    std::list<Entry> lru_list;
+
+    std::unordered_map<Key, typename std::list<Entry>::iterator, Hash, KeyEqual> entries;
+
+    size_t budget_;
+    size_t size_ = 0;
+
+    uint64_t hits_ = 0;
+    uint64_t misses_ = 0;
+    uint64_t evictions_ = 0;
+};
+
+} // namespace Flint
+
+#endif // FLINT_LRU_CACHE_H
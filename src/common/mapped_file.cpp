@@ -0,0 +1,111 @@
+#include "mapped_file.h"
+
+#ifdef _WIN32
+    #define WIN32_LEAN_AND_MEAN
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+#include "utils.h"
+
+namespace Flint {
+
+#ifdef _WIN32
+
+MappedFile::MappedFile(const std::string &path) {
+    HANDLE file = CreateFileA(
+        path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (file == INVALID_HANDLE_VALUE) {
+        Logger::error("Failed to open file: " + path, "Flint");
+        return;
+    }
+    file_handle = file;
+
+    LARGE_INTEGER file_size;
+    if (!GetFileSizeEx(file, &file_size) || file_size.QuadPart == 0) {
+        return;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (mapping == nullptr) {
+        Logger::error("Failed to map file: " + path, "Flint");
+        return;
+    }
+    mapping_handle = mapping;
+
+    auto view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == nullptr) {
+        Logger::error("Failed to map file: " + path, "Flint");
+        return;
+    }
+
+    data_ = static_cast<const char *>(view);
+    size_ = (size_t)file_size.QuadPart;
+}
+
+MappedFile::~MappedFile() {
+    if (data_) {
+        UnmapViewOfFile(data_);
+    }
+    if (mapping_handle) {
+        CloseHandle(mapping_handle);
+    }
+    if (file_handle) {
+        CloseHandle(file_handle);
+    }
+}
+
+#else
+
+MappedFile::MappedFile(const std::string &path) {
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        Logger::error("Failed to open file: " + path, "Flint");
+        return;
+    }
+
+    struct stat file_stat {};
+    if (fstat(fd, &file_stat) != 0 || file_stat.st_size == 0) {
+        close(fd);
+        return;
+    }
+
+    void *mapping = mmap(nullptr, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+    // The mapping stays valid after closing the file descriptor.
+    close(fd);
+
+    if (mapping == MAP_FAILED) {
+        Logger::error("Failed to map file: " + path, "Flint");
+        return;
+    }
+
+    data_ = static_cast<const char *>(mapping);
+    size_ = (size_t)file_stat.st_size;
+}
+
+MappedFile::~MappedFile() {
+    if (data_) {
+        munmap(const_cast<char *>(data_), size_);
+    }
+}
+
+#endif
+
+bool MappedFile::is_valid() const {
+    return data_ != nullptr && size_ > 0;
+}
+
+const char *MappedFile::data() const {
+    return data_;
+}
+
+size_t MappedFile::size() const {
+    return size_;
+}
+
+} // namespace Flint
@@ -0,0 +1,39 @@
+#ifndef FLINT_MAPPED_FILE_H
+#define FLINT_MAPPED_FILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace Flint {
+
+/// A read-only memory mapping of a whole file. The data stays valid until the mapping is destroyed.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string &path);
+
+    ~MappedFile();
+
+    MappedFile(const MappedFile &) = delete;
+
+    MappedFile &operator=(const MappedFile &) = delete;
+
+    /// False if the file couldn't be opened or mapped, or is empty.
+    bool is_valid() const;
+
+    const char *data() const;
+
+    size_t size() const;
+
+private:
+    const char *data_ = nullptr;
+    size_t size_ = 0;
+
+#ifdef _WIN32
+    void *file_handle = nullptr;
+    void *mapping_handle = nullptr;
+#endif
+};
+
+} // namespace Flint
+
+#endif // FLINT_MAPPED_FILE_H
@@ -0,0 +1,541 @@
+#include "utf.h"
+
+#include <cstdint>
+#include <stdexcept>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+    #define FLINT_UTF_SSE2
+    #include <emmintrin.h>
+#endif
+
+namespace Flint {
+
+namespace {
+
+bool is_continuation_byte(unsigned char byte) {
+    return (byte & 0xC0) == 0x80;
+}
+
+/// Decode a codepoint at the start of the source. Returns the sequence length, or zero if the sequence is invalid.
+size_t decode_utf8(const unsigned char *src, size_t length, char32_t &codepoint) {
+    unsigned char lead = src[0];
+
+    if (lead < 0x80) {
+        codepoint = lead;
+        return 1;
+    }
+
+    // Continuation bytes and the overlong leads 0xC0/0xC1.
+    if (lead < 0xC2) {
+        return 0;
+    }
+
+    if (lead < 0xE0) {
+        if (length < 2 || !is_continuation_byte(src[1])) {
+            return 0;
+        }
+        codepoint = (lead & 0x1F) << 6 | (src[1] & 0x3F);
+        return 2;
+    }
+
+    if (lead < 0xF0) {
+        if (length < 3 || !is_continuation_byte(src[1]) || !is_continuation_byte(src[2])) {
+            return 0;
+        }
+        codepoint = (lead & 0x0F) << 12 | (src[1] & 0x3F) << 6 | (src[2] & 0x3F);
+
+        // Overlong forms and surrogates.
+        if (codepoint < 0x800 || (codepoint >= 0xD800 && codepoint <= 0xDFFF)) {
+            return 0;
+        }
+        return 3;
+    }
+
+    if (lead < 0xF5) {
+        if (length < 4 || !is_continuation_byte(src[1]) || !is_continuation_byte(src[2]) ||
+            !is_continuation_byte(src[3])) {
+            return 0;
+        }
+        codepoint = (lead & 0x07) << 18 | (src[1] & 0x3F) << 12 | (src[2] & 0x3F) << 6 | (src[3] & 0x3F);
+
+        // Overlong forms and codepoints beyond U+10FFFF.
+        if (codepoint < 0x10000 || codepoint > 0x10FFFF) {
+            return 0;
+        }
+        return 4;
+    }
+
+    return 0;
+}
+
+/// Doesn't check the codepoint or the destination size.
+size_t encode_utf8_unchecked(char32_t codepoint, char *dest) {
+    if (codepoint < 0x80) {
+        dest[0] = (char)codepoint;
+        return 1;
+    }
+    if (codepoint < 0x800) {
+        dest[0] = (char)(0xC0 | codepoint >> 6);
+        dest[1] = (char)(0x80 | (codepoint & 0x3F));
+        return 2;
+    }
+    if (codepoint < 0x10000) {
+        dest[0] = (char)(0xE0 | codepoint >> 12);
+        dest[1] = (char)(0x80 | (codepoint >> 6 & 0x3F));
+        dest[2] = (char)(0x80 | (codepoint & 0x3F));
+        return 3;
+    }
+    dest[0] = (char)(0xF0 | codepoint >> 18);
+    dest[1] = (char)(0x80 | (codepoint >> 12 & 0x3F));
+    dest[2] = (char)(0x80 | (codepoint >> 6 & 0x3F));
+    dest[3] = (char)(0x80 | (codepoint & 0x3F));
+    return 4;
+}
+
+size_t utf8_sequence_length(char32_t codepoint) {
+    if (codepoint < 0x80) {
+        return 1;
+    }
+    if (codepoint < 0x800) {
+        return 2;
+    }
+    if (codepoint < 0x10000) {
+        return 3;
+    }
+    return 4;
+}
+
+bool is_valid_codepoint(char32_t codepoint) {
+    return codepoint <= 0x10FFFF && (codepoint < 0xD800 || codepoint > 0xDFFF);
+}
+
+#ifdef FLINT_UTF_SSE2
+
+/// Skip a run of ASCII bytes, 16 at a time. Returns the number of bytes skipped.
+size_t skip_ascii(const char *src, size_t length) {
+    size_t i = 0;
+    for (; i + 16 <= length; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *)(src + i));
+        if (_mm_movemask_epi8(chunk) != 0) {
+            break;
+        }
+    }
+    return i;
+}
+
+/// Widen a run of ASCII bytes into UTF-32, 16 at a time. Returns the number of code units converted.
+size_t widen_ascii_to_utf32(const char *src, size_t length, char32_t *dest, size_t dest_length) {
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 16 <= length && i + 16 <= dest_length; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *)(src + i));
+        if (_mm_movemask_epi8(chunk) != 0) {
+            break;
+        }
+
+        __m128i low = _mm_unpacklo_epi8(chunk, zero);
+        __m128i high = _mm_unpackhi_epi8(chunk, zero);
+
+        auto out = (__m128i *)(dest + i);
+        _mm_storeu_si128(out, _mm_unpacklo_epi16(low, zero));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(low, zero));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(high, zero));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(high, zero));
+    }
+    return i;
+}
+
+/// Widen a run of ASCII bytes into UTF-16, 16 at a time. Returns the number of code units converted.
+size_t widen_ascii_to_utf16(const char *src, size_t length, char16_t *dest, size_t dest_length) {
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 16 <= length && i + 16 <= dest_length; i += 16) {
+        __m128i chunk = _mm_loadu_si128((const __m128i *)(src + i));
+        if (_mm_movemask_epi8(chunk) != 0) {
+            break;
+        }
+
+        auto out = (__m128i *)(dest + i);
+        _mm_storeu_si128(out, _mm_unpacklo_epi8(chunk, zero));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi8(chunk, zero));
+    }
+    return i;
+}
+
+/// Narrow a run of ASCII codepoints into UTF-8, 16 at a time. Returns the number of code units converted.
+size_t narrow_ascii_from_utf32(const char32_t *src, size_t length, char *dest, size_t dest_length) {
+    const __m128i non_ascii_mask = _mm_set1_epi32(~0x7F);
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 16 <= length && i + 16 <= dest_length; i += 16) {
+        auto in = (const __m128i *)(src + i);
+        __m128i a = _mm_loadu_si128(in);
+        __m128i b = _mm_loadu_si128(in + 1);
+        __m128i c = _mm_loadu_si128(in + 2);
+        __m128i d = _mm_loadu_si128(in + 3);
+
+        __m128i all = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(all, non_ascii_mask), zero)) != 0xFFFF) {
+            break;
+        }
+
+        __m128i packed = _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+        _mm_storeu_si128((__m128i *)(dest + i), packed);
+    }
+    return i;
+}
+
+/// Narrow a run of ASCII UTF-16 code units into UTF-8, 16 at a time. Returns the number of code units converted.
+size_t narrow_ascii_from_utf16(const char16_t *src, size_t length, char *dest, size_t dest_length) {
+    const __m128i non_ascii_mask = _mm_set1_epi16(~0x7F);
+    const __m128i zero = _mm_setzero_si128();
+
+    size_t i = 0;
+    for (; i + 16 <= length && i + 16 <= dest_length; i += 16) {
+        auto in = (const __m128i *)(src + i);
+        __m128i a = _mm_loadu_si128(in);
+        __m128i b = _mm_loadu_si128(in + 1);
+
+        __m128i all = _mm_or_si128(a, b);
+        if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_and_si128(all, non_ascii_mask), zero)) != 0xFFFF) {
+            break;
+        }
+
+        _mm_storeu_si128((__m128i *)(dest + i), _mm_packus_epi16(a, b));
+    }
+    return i;
+}
+
+#else
+
+size_t skip_ascii(const char *, size_t) {
+    return 0;
+}
+
+size_t widen_ascii_to_utf32(const char *, size_t, char32_t *, size_t) {
+    return 0;
+}
+
+size_t widen_ascii_to_utf16(const char *, size_t, char16_t *, size_t) {
+    return 0;
+}
+
+size_t narrow_ascii_from_utf32(const char32_t *, size_t, char *, size_t) {
+    return 0;
+}
+
+size_t narrow_ascii_from_utf16(const char16_t *, size_t, char *, size_t) {
+    return 0;
+}
+
+#endif
+
+} // namespace
+
+bool validate_utf8(std::string_view source) {
+    auto src = (const unsigned char *)source.data();
+    size_t length = source.size();
+
+    size_t i = 0;
+    while (i < length) {
+        if (src[i] < 0x80) {
+            i += skip_ascii(source.data() + i, length - i);
+
+            // The rest of the ASCII run.
+            while (i < length && src[i] < 0x80) {
+                i++;
+            }
+            continue;
+        }
+
+        char32_t codepoint;
+        size_t sequence_length = decode_utf8(src + i, length - i, codepoint);
+        if (sequence_length == 0) {
+            return false;
+        }
+        i += sequence_length;
+    }
+
+    return true;
+}
+
+TranscodeResult convert_utf8_to_utf32(std::string_view source, std::span<char32_t> dest) {
+    auto src = (const unsigned char *)source.data();
+    size_t length = source.size();
+    size_t dest_length = dest.size();
+
+    TranscodeResult result;
+
+    size_t i = 0, o = 0;
+    while (i < length && o < dest_length) {
+        if (src[i] < 0x80) {
+            size_t ascii_count = widen_ascii_to_utf32(source.data() + i, length - i, dest.data() + o, dest_length - o);
+            i += ascii_count;
+            o += ascii_count;
+
+            // The rest of the ASCII run.
+            while (i < length && o < dest_length && src[i] < 0x80) {
+                dest[o++] = src[i++];
+            }
+            continue;
+        }
+
+        char32_t codepoint;
+        size_t sequence_length = decode_utf8(src + i, length - i, codepoint);
+        if (sequence_length == 0) {
+            result.valid = false;
+            break;
+        }
+
+        dest[o++] = codepoint;
+        i += sequence_length;
+    }
+
+    result.read = i;
+    result.written = o;
+
+    return result;
+}
+
+TranscodeResult convert_utf32_to_utf8(std::u32string_view source, std::span<char> dest) {
+    const char32_t *src = source.data();
+    size_t length = source.size();
+    size_t dest_length = dest.size();
+
+    TranscodeResult result;
+
+    size_t i = 0, o = 0;
+    while (i < length) {
+        char32_t codepoint = src[i];
+
+        if (codepoint < 0x80) {
+            size_t ascii_count = narrow_ascii_from_utf32(src + i, length - i, dest.data() + o, dest_length - o);
+            i += ascii_count;
+            o += ascii_count;
+
+            // The rest of the ASCII run.
+            while (i < length && o < dest_length && src[i] < 0x80) {
+                dest[o++] = (char)src[i++];
+            }
+            if (i < length && src[i] < 0x80) {
+                // Destination is full.
+                break;
+            }
+            continue;
+        }
+
+        if (!is_valid_codepoint(codepoint)) {
+            result.valid = false;
+            break;
+        }
+
+        if (o + utf8_sequence_length(codepoint) > dest_length) {
+            break;
+        }
+
+        o += encode_utf8_unchecked(codepoint, dest.data() + o);
+        i++;
+    }
+
+    result.read = i;
+    result.written = o;
+
+    return result;
+}
+
+TranscodeResult convert_utf8_to_utf16(std::string_view source, std::span<char16_t> dest) {
+    auto src = (const unsigned char *)source.data();
+    size_t length = source.size();
+    size_t dest_length = dest.size();
+
+    TranscodeResult result;
+
+    size_t i = 0, o = 0;
+    while (i < length && o < dest_length) {
+        if (src[i] < 0x80) {
+            size_t ascii_count = widen_ascii_to_utf16(source.data() + i, length - i, dest.data() + o, dest_length - o);
+            i += ascii_count;
+            o += ascii_count;
+
+            // The rest of the ASCII run.
+            while (i < length && o < dest_length && src[i] < 0x80) {
+                dest[o++] = src[i++];
+            }
+            continue;
+        }
+
+        char32_t codepoint;
+        size_t sequence_length = decode_utf8(src + i, length - i, codepoint);
+        if (sequence_length == 0) {
+            result.valid = false;
+            break;
+        }
+
+        if (codepoint < 0x10000) {
+            dest[o++] = (char16_t)codepoint;
+        } else {
+            // Surrogate pair.
+            if (o + 2 > dest_length) {
+                break;
+            }
+            codepoint -= 0x10000;
+            dest[o++] = (char16_t)(0xD800 | codepoint >> 10);
+            dest[o++] = (char16_t)(0xDC00 | (codepoint & 0x3FF));
+        }
+        i += sequence_length;
+    }
+
+    result.read = i;
+    result.written = o;
+
+    return result;
+}
+
+TranscodeResult convert_utf16_to_utf8(std::u16string_view source, std::span<char> dest) {
+    const char16_t *src = source.data();
+    size_t length = source.size();
+    size_t dest_length = dest.size();
+
+    TranscodeResult result;
+
+    size_t i = 0, o = 0;
+    while (i < length) {
+        char32_t codepoint = src[i];
+
+        if (codepoint < 0x80) {
+            size_t ascii_count = narrow_ascii_from_utf16(src + i, length - i, dest.data() + o, dest_length - o);
+            i += ascii_count;
+            o += ascii_count;
+
+            // The rest of the ASCII run.
+            while (i < length && o < dest_length && src[i] < 0x80) {
+                dest[o++] = (char)src[i++];
+            }
+            if (i < length && src[i] < 0x80) {
+                // Destination is full.
+                break;
+            }
+            continue;
+        }
+
+        size_t unit_count = 1;
+
+        if (codepoint >= 0xD800 && codepoint <= 0xDBFF) {
+            // A high surrogate must be followed by a low one.
+            if (i + 1 >= length || src[i + 1] < 0xDC00 || src[i + 1] > 0xDFFF) {
+                result.valid = false;
+                break;
+            }
+            codepoint = 0x10000 + ((codepoint - 0xD800) << 10 | (src[i + 1] - 0xDC00));
+            unit_count = 2;
+        } else if (codepoint >= 0xDC00 && codepoint <= 0xDFFF) {
+            result.valid = false;
+            break;
+        }
+
+        if (o + utf8_sequence_length(codepoint) > dest_length) {
+            break;
+        }
+
+        o += encode_utf8_unchecked(codepoint, dest.data() + o);
+        i += unit_count;
+    }
+
+    result.read = i;
+    result.written = o;
+
+    return result;
+}
+
+size_t encode_utf8(char32_t codepoint, std::span<char, 4> dest) {
+    if (!is_valid_codepoint(codepoint)) {
+        return 0;
+    }
+
+    return encode_utf8_unchecked(codepoint, dest.data());
+}
+
+void utf8_to_utf32(std::string_view source, std::u32string &result) {
+    result.resize(utf32_capacity_for_utf8(source.size()));
+
+    auto transcode_result = convert_utf8_to_utf32(source, result);
+    if (!transcode_result.valid) {
+        throw std::runtime_error("Invalid UTF-8 in utf8-to-utf32 conversion!");
+    }
+
+    result.resize(transcode_result.written);
+}
+
+void utf8_to_utf32_lossy(std::string_view source, std::u32string &result) {
+    // An invalid byte becomes a single replacement character, so the capacity is still enough.
+    result.resize(utf32_capacity_for_utf8(source.size()));
+
+    size_t written = 0;
+    while (!source.empty()) {
+        auto transcode_result = convert_utf8_to_utf32(source, std::span(result).subspan(written));
+        written += transcode_result.written;
+        source.remove_prefix(transcode_result.read);
+
+        if (!transcode_result.valid) {
+            result[written++] = 0xFFFD;
+            source.remove_prefix(1);
+        }
+    }
+
+    result.resize(written);
+}
+
+std::string utf32_to_utf8(std::u32string_view source) {
+    std::string result;
+    result.resize(utf8_capacity_for_utf32(source.size()));
+
+    auto transcode_result = convert_utf32_to_utf8(source, result);
+    if (!transcode_result.valid) {
+        throw std::runtime_error("Invalid codepoint in utf32-to-utf8 conversion!");
+    }
+
+    result.resize(transcode_result.written);
+
+    return result;
+}
+
+void utf8_to_utf16(std::string_view source, std::u16string &result) {
+    result.resize(utf16_capacity_for_utf8(source.size()));
+
+    auto transcode_result = convert_utf8_to_utf16(source, result);
+    if (!transcode_result.valid) {
+        throw std::runtime_error("Invalid UTF-8 in utf8-to-utf16 conversion!");
+    }
+
+    result.resize(transcode_result.written);
+}
+
+std::string utf16_to_utf8(std::u16string_view source) {
+    std::string result;
+    result.resize(utf8_capacity_for_utf16(source.size()));
+
+    auto transcode_result = convert_utf16_to_utf8(source, result);
+    if (!transcode_result.valid) {
+        throw std::runtime_error("Invalid UTF-16 in utf16-to-utf8 conversion!");
+    }
+
+    result.resize(transcode_result.written);
+
+    return result;
+}
+
+std::string codepoint_to_utf8(char32_t codepoint) {
+    char utf8[4];
+
+    size_t length = encode_utf8(codepoint, utf8);
+    if (length == 0) {
+        throw std::runtime_error("Bad codepoint-to-utf8 conversion!");
+    }
+
+    return {utf8, length};
+}
+
+} // namespace Flint
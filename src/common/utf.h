@@ -0,0 +1,72 @@
+#ifndef FLINT_UTF_H
+#define FLINT_UTF_H
+
+#include <cstddef>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace Flint {
+
+/// Result of a bulk conversion. Conversion stops at the first invalid sequence or when the destination is full.
+struct TranscodeResult {
+    bool valid = true;
+
+    /// Code units consumed from the source.
+    size_t read = 0;
+
+    /// Code units written to the destination.
+    size_t written = 0;
+};
+
+/// Destination capacities that are always large enough for a whole source of the given length.
+constexpr size_t utf32_capacity_for_utf8(size_t utf8_length) {
+    return utf8_length;
+}
+
+constexpr size_t utf16_capacity_for_utf8(size_t utf8_length) {
+    return utf8_length;
+}
+
+constexpr size_t utf8_capacity_for_utf32(size_t utf32_length) {
+    return utf32_length * 4;
+}
+
+constexpr size_t utf8_capacity_for_utf16(size_t utf16_length) {
+    return utf16_length * 3;
+}
+
+/// Check if the text is well-formed UTF-8 (no overlong forms, surrogates or codepoints beyond U+10FFFF).
+bool validate_utf8(std::string_view source);
+
+/// Bulk conversions into caller-provided buffers, which don't allocate.
+/// ASCII runs are converted 16 code units at a time with SSE2 when available.
+TranscodeResult convert_utf8_to_utf32(std::string_view source, std::span<char32_t> dest);
+
+TranscodeResult convert_utf32_to_utf8(std::u32string_view source, std::span<char> dest);
+
+TranscodeResult convert_utf8_to_utf16(std::string_view source, std::span<char16_t> dest);
+
+TranscodeResult convert_utf16_to_utf8(std::u16string_view source, std::span<char> dest);
+
+/// Encode a single codepoint. Returns the number of bytes written, or zero for an invalid codepoint.
+size_t encode_utf8(char32_t codepoint, std::span<char, 4> dest);
+
+/// Convenience wrappers around the bulk conversions. Throw std::runtime_error on invalid input.
+
+void utf8_to_utf32(std::string_view source, std::u32string &result);
+
+std::string utf32_to_utf8(std::u32string_view source);
+
+void utf8_to_utf16(std::string_view source, std::u16string &result);
+
+std::string utf16_to_utf8(std::u16string_view source);
+
+std::string codepoint_to_utf8(char32_t codepoint);
+
+/// Like utf8_to_utf32, but replaces each invalid byte with U+FFFD instead of throwing, e.g. for logs.
+void utf8_to_utf32_lossy(std::string_view source, std::u32string &result);
+
+} // namespace Flint
+
+#endif // FLINT_UTF_H
@@ -0,0 +1,100 @@
+#include "worker_pool.h"
+
+#include <algorithm>
+
+namespace Flint {
+
+WorkerPool::WorkerPool() {
+    // The calling thread takes tasks too.
+    size_t worker_count = std::max(std::thread::hardware_concurrency(), 1u) - 1;
+
+    for (size_t i = 0; i < worker_count; i++) {
+        workers.emplace_back(&WorkerPool::work, this);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard lock(mutex);
+        quitting = true;
+    }
+    job_condition.notify_all();
+
+    for (auto &worker : workers) {
+        worker.join();
+    }
+}
+
+size_t WorkerPool::get_worker_count() const {
+    return workers.size();
+}
+
+void WorkerPool::run_job(Job &job) {
+    for (size_t i = job.next_index++; i < job.count; i = job.next_index++) {
+        (*job.task)(i);
+    }
+}
+
+void WorkerPool::parallel_for(size_t count, const std::function<void(size_t)> &task) {
+    if (count == 0) {
+        return;
+    }
+
+    Job job;
+    job.task = &task;
+    job.count = count;
+
+    if (count == 1 || workers.empty()) {
+        run_job(job);
+        return;
+    }
+
+    {
+        std::lock_guard lock(mutex);
+        current_job = &job;
+        job_generation++;
+    }
+    job_condition.notify_all();
+
+    run_job(job);
+
+    // No worker may join the job after this, so it's done when the busy workers are.
+    std::unique_lock lock(mutex);
+    current_job = nullptr;
+    done_condition.wait(lock, [this] { return busy_worker_count == 0; });
+}
+
+void WorkerPool::work() {
+    uint64_t last_generation = 0;
+
+    std::unique_lock lock(mutex);
+
+    while (true) {
+        job_condition.wait(lock, [&] { return quitting || job_generation != last_generation; });
+
+        if (quitting) {
+            return;
+        }
+
+        last_generation = job_generation;
+
+        // The job may have finished before this worker woke up.
+        Job *job = current_job;
+        if (job == nullptr) {
+            continue;
+        }
+
+        busy_worker_count++;
+        lock.unlock();
+
+        run_job(*job);
+
+        lock.lock();
+        busy_worker_count--;
+        if (busy_worker_count == 0) {
+            done_condition.notify_all();
+        }
+    }
+}
+
+} // namespace Flint
@@ -0,0 +1,64 @@
+#ifndef FLINT_WORKER_POOL_H
+#define FLINT_WORKER_POOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Flint {
+
+/// A fixed set of worker threads which help the main thread with data-parallel work.
+class WorkerPool {
+public:
+    static WorkerPool *get_singleton() {
+        static WorkerPool singleton;
+        return &singleton;
+    }
+
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool &) = delete;
+
+    WorkerPool &operator=(const WorkerPool &) = delete;
+
+    /// Run `task(i)` for every i in [0, count) on the workers and the calling thread.
+    /// Returns when all the tasks have finished. Tasks must not throw or call parallel_for.
+    void parallel_for(size_t count, const std::function<void(size_t)> &task);
+
+    /// Not including the calling thread.
+    size_t get_worker_count() const;
+
+private:
+    WorkerPool();
+
+    struct Job {
+        const std::function<void(size_t)> *task = nullptr;
+        size_t count = 0;
+        std::atomic<size_t> next_index{0};
+    };
+
+    /// Take tasks from the job until there are none left.
+    static void run_job(Job &job);
+
+    void work();
+
+    std::vector<std::thread> workers;
+
+    std::mutex mutex;
+    std::condition_variable job_condition;
+    std::condition_variable done_condition;
+
+    // Guarded by the mutex.
+    Job *current_job = nullptr;
+    uint64_t job_generation = 0;
+    size_t busy_worker_count = 0;
+    bool quitting = false;
+};
+
+} // namespace Flint
+
+#endif // FLINT_WORKER_POOL_H
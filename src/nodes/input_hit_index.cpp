@@ -0,0 +1,328 @@
+#include "input_hit_index.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "sub_window.h"
+#include "ui/node_ui.h"
+
+namespace Flint {
+
+namespace {
+
+bool rect_contains_point(RectF rect, Vec2F point) {
+    return rect.contains_point(point);
+}
+
+bool is_finite_rect(const RectF &rect) {
+    return std::isfinite(rect.left) && std::isfinite(rect.top) && std::isfinite(rect.right) &&
+           std::isfinite(rect.bottom) && rect.is_valid();
+}
+
+} // namespace
+
+void InputHitIndex::invalidate() {
+    valid_ = false;
+}
+
+bool InputHitIndex::is_mouse_event(const InputEvent &event) {
+    switch (event.type) {
+        case InputEventType::MouseMotion:
+        case InputEventType::MouseButton:
+        case InputEventType::MouseScroll:
+            return true;
+        default:
+            return false;
+    }
+}
+
+void InputHitIndex::dispatch(Node *root, InputEvent &event) {
+    if (root == nullptr) {
+        return;
+    }
+
+    if (!valid_ || root != root_ || structure_version_ != Node::get_structure_version() ||
+        visibility_version_ != Node::get_visibility_version()) {
+        build(root);
+    }
+
+    auto cursor_position = InputServer::get_singleton()->cursor_position;
+
+    // Scroll events are handled at the cursor.
+    Vec2F point = cursor_position;
+    if (event.type == InputEventType::MouseMotion) {
+        point = event.args.mouse_motion.position;
+    } else if (event.type == InputEventType::MouseButton) {
+        point = event.args.mouse_button.position;
+    }
+
+    stamp_++;
+    candidates.clear();
+
+    for (auto entry_index : engaged_entries) {
+        collect_candidate(entry_index);
+    }
+
+    for (auto entry_index : large_entries) {
+        if (rect_contains_point(entries[entry_index].rect, point)) {
+            collect_candidate(entry_index);
+        }
+    }
+
+    if (auto cell = get_cell(point)) {
+        for (auto i = cell_starts[*cell]; i < cell_starts[*cell + 1]; i++) {
+            auto entry_index = cell_entries[i];
+            if (rect_contains_point(entries[entry_index].rect, point)) {
+                collect_candidate(entry_index);
+            }
+        }
+    }
+
+    std::sort(candidates.begin(), candidates.end(), [this](uint32_t a, uint32_t b) {
+        return entries[a].order < entries[b].order;
+    });
+
+    auto structure_version = Node::get_structure_version();
+    auto visibility_version = Node::get_visibility_version();
+
+    for (auto entry_index : candidates) {
+        const auto &entry = entries[entry_index];
+
+        // Destroyed since the index has been built, maybe by an earlier handler.
+        auto owner = entry.owner.lock();
+        if (owner == nullptr && entry.node != root) {
+            continue;
+        }
+
+        bool changed = structure_version != Node::get_structure_version() ||
+                       visibility_version != Node::get_visibility_version();
+        if (changed && !is_reachable(entry.node)) {
+            continue;
+        }
+
+        if (!is_inside_clip(entry, cursor_position)) {
+            continue;
+        }
+
+        entry.node->input(event);
+    }
+
+    // The following events only have to reach the nodes which have to see them leave, e.g. the hovered ones.
+    engaged_entries.clear();
+    for (auto entry_index : candidates) {
+        auto ui_node = entries[entry_index].ui_node;
+        if (ui_node == nullptr || ui_node->wants_mouse_input_outside_rect()) {
+            engaged_entries.push_back(entry_index);
+        }
+    }
+}
+
+void InputHitIndex::build(Node *root) {
+    root_ = root;
+    valid_ = true;
+    structure_version_ = Node::get_structure_version();
+    visibility_version_ = Node::get_visibility_version();
+
+    // Keep the capacities.
+    entries.clear();
+    engaged_entries.clear();
+    large_entries.clear();
+    next_order_ = 0;
+
+    add_subtree(root, nullptr, -1);
+
+    for (uint32_t i = 0; i < entries.size(); i++) {
+        auto ui_node = entries[i].ui_node;
+        if (ui_node == nullptr || ui_node->wants_mouse_input_outside_rect()) {
+            engaged_entries.push_back(i);
+        }
+    }
+
+    bin_entries();
+}
+
+void InputHitIndex::add_subtree(Node *node, const std::shared_ptr<Node> &owner, int32_t clip_entry) {
+    if (!node->get_visibility()) {
+        return;
+    }
+
+    auto entry_index = (uint32_t)entries.size();
+
+    Entry entry{node, owner, nullptr, RectF(), clip_entry, 0, 0};
+
+    if (node->is_ui_node()) {
+        entry.ui_node = dynamic_cast<NodeUi *>(node);
+
+        auto global_position = entry.ui_node->get_global_position();
+        entry.rect = RectF(global_position, global_position + entry.ui_node->get_size());
+    }
+
+    entries.push_back(entry);
+
+    // Mouse events outside of such a node don't reach its descendants.
+    auto child_clip_entry = clip_entry;
+    if (entry.ui_node && entry.ui_node->ignore_mouse_input_outside_rect()) {
+        child_clip_entry = (int32_t)entry_index;
+    }
+
+    for (size_t i = 0; i < node->get_all_child_count(); i++) {
+        const auto &child = node->get_all_child(i);
+
+        if (typeid(*child) == typeid(SubWindow)) {
+            continue;
+        }
+
+        add_subtree(child.get(), child, child_clip_entry);
+    }
+
+    // Children before their parents.
+    entries[entry_index].order = next_order_++;
+}
+
+void InputHitIndex::bin_entries() {
+    grid_width = 0;
+    grid_height = 0;
+    cell_starts.clear();
+    cell_entries.clear();
+
+    // Nodes without a proper rect can't be hit.
+    auto is_binned = [](const Entry &entry) { return entry.ui_node != nullptr && is_finite_rect(entry.rect); };
+
+    std::optional<RectF> bounds;
+    for (const auto &entry : entries) {
+        if (!is_binned(entry)) {
+            continue;
+        }
+
+        const auto &rect = entry.rect;
+
+        if (bounds) {
+            bounds = RectF(std::min(bounds->left, rect.left),
+                           std::min(bounds->top, rect.top),
+                           std::max(bounds->right, rect.right),
+                           std::max(bounds->bottom, rect.bottom));
+        } else {
+            bounds = rect;
+        }
+    }
+
+    if (!bounds) {
+        return;
+    }
+
+    grid_bounds = *bounds;
+
+    cell_size = std::max({CELL_SIZE,
+                          grid_bounds.width() / MAX_GRID_DIMENSION,
+                          grid_bounds.height() / MAX_GRID_DIMENSION});
+
+    grid_width = std::min((uint32_t)(grid_bounds.width() / cell_size) + 1, MAX_GRID_DIMENSION);
+    grid_height = std::min((uint32_t)(grid_bounds.height() / cell_size) + 1, MAX_GRID_DIMENSION);
+
+    auto get_cell_range = [this](const RectF &rect, uint32_t &x0, uint32_t &y0, uint32_t &x1, uint32_t &y1) {
+        x0 = std::min((uint32_t)((rect.left - grid_bounds.left) / cell_size), grid_width - 1);
+        y0 = std::min((uint32_t)((rect.top - grid_bounds.top) / cell_size), grid_height - 1);
+        x1 = std::min((uint32_t)((rect.right - grid_bounds.left) / cell_size), grid_width - 1);
+        y1 = std::min((uint32_t)((rect.bottom - grid_bounds.top) / cell_size), grid_height - 1);
+    };
+
+    // Count the entries of each cell first, then fill them in.
+    cell_starts.assign(grid_width * grid_height + 1, 0);
+
+    for (uint32_t i = 0; i < entries.size(); i++) {
+        const auto &entry = entries[i];
+        if (!is_binned(entry)) {
+            continue;
+        }
+
+        uint32_t x0, y0, x1, y1;
+        get_cell_range(entry.rect, x0, y0, x1, y1);
+
+        if ((x1 - x0 + 1) * (y1 - y0 + 1) > MAX_CELLS_PER_NODE) {
+            large_entries.push_back(i);
+            continue;
+        }
+
+        for (auto y = y0; y <= y1; y++) {
+            for (auto x = x0; x <= x1; x++) {
+                cell_starts[y * grid_width + x + 1]++;
+            }
+        }
+    }
+
+    for (size_t i = 1; i < cell_starts.size(); i++) {
+        cell_starts[i] += cell_starts[i - 1];
+    }
+
+    cell_entries.resize(cell_starts.back());
+
+    // Write positions of the cells.
+    cell_cursors.assign(cell_starts.begin(), cell_starts.end() - 1);
+
+    uint32_t large_index = 0;
+    for (uint32_t i = 0; i < entries.size(); i++) {
+        const auto &entry = entries[i];
+        if (!is_binned(entry)) {
+            continue;
+        }
+
+        if (large_index < large_entries.size() && large_entries[large_index] == i) {
+            large_index++;
+            continue;
+        }
+
+        uint32_t x0, y0, x1, y1;
+        get_cell_range(entry.rect, x0, y0, x1, y1);
+
+        for (auto y = y0; y <= y1; y++) {
+            for (auto x = x0; x <= x1; x++) {
+                cell_entries[cell_cursors[y * grid_width + x]++] = i;
+            }
+        }
+    }
+}
+
+std::optional<uint32_t> InputHitIndex::get_cell(Vec2F point) const {
+    if (grid_width == 0 || !rect_contains_point(grid_bounds, point)) {
+        return {};
+    }
+
+    auto x = std::min((uint32_t)((point.x - grid_bounds.left) / cell_size), grid_width - 1);
+    auto y = std::min((uint32_t)((point.y - grid_bounds.top) / cell_size), grid_height - 1);
+
+    return y * grid_width + x;
+}
+
+void InputHitIndex::collect_candidate(uint32_t entry_index) {
+    auto &entry = entries[entry_index];
+    if (entry.stamp == stamp_) {
+        return;
+    }
+
+    entry.stamp = stamp_;
+    candidates.push_back(entry_index);
+}
+
+bool InputHitIndex::is_reachable(Node *node) const {
+    while (node != root_) {
+        if (node == nullptr || !node->get_visibility()) {
+            return false;
+        }
+        node = node->get_parent();
+    }
+
+    return root_->get_visibility();
+}
+
+bool InputHitIndex::is_inside_clip(const Entry &entry, Vec2F cursor_position) const {
+    // Like propagate_input(), which tests the cursor position.
+    for (auto clip_entry = entry.clip_entry; clip_entry != -1; clip_entry = entries[clip_entry].clip_entry) {
+        if (!rect_contains_point(entries[clip_entry].rect, cursor_position)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+} // namespace Flint
@@ -0,0 +1,111 @@
+#ifndef FLINT_INPUT_HIT_INDEX_H
+#define FLINT_INPUT_HIT_INDEX_H
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+#include "../common/geometry.h"
+#include "node.h"
+
+namespace Flint {
+
+class NodeUi;
+
+/// Spatial index of the UI nodes of a window, so that a mouse event only visits the nodes under the cursor instead
+/// of the whole tree.
+///
+/// The global rects of the last transform pass are binned into a uniform grid. Besides the nodes whose rects
+/// contain the event position, an event reaches the non-UI nodes and the UI nodes which want mouse input outside
+/// their rects, see NodeUi::wants_mouse_input_outside_rect(). The nodes are visited in the same order as the other
+/// input events (children before their parents) and skipped outside of the nodes which ignore mouse input outside
+/// their rects, so what the nodes get is the same as when visiting all of them.
+/// @note The index is rebuilt lazily after invalidate(), which the input system calls every frame, and whenever
+/// the structure or the visibility of the nodes has changed meanwhile.
+class InputHitIndex {
+public:
+    /// Nominal size of the grid cells, which grows for large windows to limit the cell count.
+    static constexpr float CELL_SIZE = 64;
+
+    static constexpr uint32_t MAX_GRID_DIMENSION = 64;
+
+    /// Nodes covering more cells than this are tested one by one instead, like the full-rect containers.
+    static constexpr uint32_t MAX_CELLS_PER_NODE = 16;
+
+    /// Rebuild the index before the next event, e.g. when the nodes may have moved.
+    void invalidate();
+
+    /// Send a mouse event to the candidate nodes of the subtree of the root.
+    void dispatch(Node *root, InputEvent &event);
+
+    static bool is_mouse_event(const InputEvent &event);
+
+private:
+    struct Entry {
+        Node *node;
+        /// Locked to keep the node alive when it's removed during the dispatch, without keeping removed nodes alive
+        /// in the index. Empty for the root.
+        std::weak_ptr<Node> owner;
+        /// Null for non-UI nodes, which have no rect.
+        NodeUi *ui_node;
+        RectF rect;
+        /// Entry of the nearest ancestor ignoring mouse input outside its rect, or -1.
+        int32_t clip_entry;
+        /// Visiting order, as in propagate_input().
+        uint32_t order;
+        /// The last event the entry has been collected for.
+        uint32_t stamp;
+    };
+
+    void build(Node *root);
+
+    void add_subtree(Node *node, const std::shared_ptr<Node> &owner, int32_t clip_entry);
+
+    void bin_entries();
+
+    /// Returns none if the point is outside the grid.
+    std::optional<uint32_t> get_cell(Vec2F point) const;
+
+    void collect_candidate(uint32_t entry_index);
+
+    /// If the node is still visible and in the tree, as input handlers may hide or remove nodes.
+    bool is_reachable(Node *node) const;
+
+    bool is_inside_clip(const Entry &entry, Vec2F cursor_position) const;
+
+    Node *root_ = nullptr;
+
+    bool valid_ = false;
+
+    uint64_t structure_version_ = 0;
+    uint64_t visibility_version_ = 0;
+
+    /// In preorder, so that the clip entries come before the entries they clip.
+    std::vector<Entry> entries;
+
+    /// Entries visited by every mouse event.
+    std::vector<uint32_t> engaged_entries;
+
+    /// Entries tested one by one.
+    std::vector<uint32_t> large_entries;
+
+    RectF grid_bounds;
+    float cell_size = CELL_SIZE;
+    uint32_t grid_width = 0;
+    uint32_t grid_height = 0;
+
+    /// Entries of the cell i are cell_entries[cell_starts[i]..cell_starts[i + 1]).
+    std::vector<uint32_t> cell_starts;
+    std::vector<uint32_t> cell_entries;
+    std::vector<uint32_t> cell_cursors;
+
+    uint32_t next_order_ = 0;
+
+    uint32_t stamp_ = 0;
+
+    std::vector<uint32_t> candidates;
+};
+
+} // namespace Flint
+
+#endif // FLINT_INPUT_HIT_INDEX_H
@@ -1,8 +1,11 @@
 #include "node.h"
 
 #include <string>
+#include <typeinfo>
 
+#include "../servers/engine.h"
 #include "../servers/render_server.h"
+#include "../servers/vector_server.h"
 #include "sub_window.h"
 
 namespace Flint {
@@ -29,6 +32,7 @@ const char *NodeNames[] = {
 
     "Label",
     "TextEdit",
+    "TextView",
     "SpinBox",
     "Panel",
     "TextureRect",
@@ -45,6 +49,15 @@ std::string get_node_type_name(NodeType type) {
     return NodeNames[(uint32_t)type];
 }
 
+namespace {
+
+// Starts from one, so that a cache which has never been updated is out of date.
+uint64_t structure_version = 1;
+
+uint64_t visibility_version = 1;
+
+} // namespace
+
 void dfs_preorder_ltr_traversal(Node *node, std::vector<Node *> &ordered_nodes) {
     if (node == nullptr) {
         return;
@@ -55,8 +68,8 @@ void dfs_preorder_ltr_traversal(Node *node, std::vector<Node *> &ordered_nodes)
 
     ordered_nodes.push_back(node);
 
-    for (auto &child : node->get_all_children()) {
-        dfs_preorder_ltr_traversal(child.get(), ordered_nodes);
+    for (size_t i = 0; i < node->get_all_child_count(); i++) {
+        dfs_preorder_ltr_traversal(node->get_all_child(i).get(), ordered_nodes);
     }
 }
 
@@ -65,8 +78,8 @@ void dfs_postorder_ltr_traversal(Node *node, std::vector<Node *> &ordered_nodes)
         return;
     }
 
-    for (auto &child : node->get_all_children()) {
-        dfs_postorder_ltr_traversal(child.get(), ordered_nodes);
+    for (size_t i = 0; i < node->get_all_child_count(); i++) {
+        dfs_postorder_ltr_traversal(node->get_all_child(i).get(), ordered_nodes);
     }
 
     // Debug print.
@@ -80,8 +93,8 @@ void dfs_postorder_rtl_traversal(Node *node, std::vector<Node *> &ordered_nodes)
         return;
     }
 
-    for (auto riter = node->get_all_children().rbegin(); riter != node->get_all_children().rend(); ++riter) {
-        dfs_postorder_rtl_traversal(riter->get(), ordered_nodes);
+    for (size_t i = node->get_all_child_count(); i > 0; i--) {
+        dfs_postorder_rtl_traversal(node->get_all_child(i - 1).get(), ordered_nodes);
     }
 
     // Debug print.
@@ -90,6 +103,41 @@ void dfs_postorder_rtl_traversal(Node *node, std::vector<Node *> &ordered_nodes)
     ordered_nodes.push_back(node);
 }
 
+void NodeTraversalCache::update(Node *root) {
+    if (root == root_ && structure_version_ == structure_version) {
+        return;
+    }
+
+    root_ = root;
+    structure_version_ = structure_version;
+
+    // Keep the capacities.
+    preorder.clear();
+    postorder.clear();
+    sub_windows.clear();
+
+    dfs_preorder_ltr_traversal(root, preorder);
+    dfs_postorder_ltr_traversal(root, postorder);
+
+    for (auto &node : preorder) {
+        if (typeid(*node) == typeid(SubWindow)) {
+            sub_windows.push_back(static_cast<SubWindow *>(node));
+        }
+    }
+}
+
+const std::vector<Node *> &NodeTraversalCache::get_preorder() const {
+    return preorder;
+}
+
+const std::vector<Node *> &NodeTraversalCache::get_postorder() const {
+    return postorder;
+}
+
+const std::vector<SubWindow *> &NodeTraversalCache::get_sub_windows() const {
+    return sub_windows;
+}
+
 void Node::input(InputEvent &event) {
     custom_input(event);
 }
@@ -126,6 +174,17 @@ std::vector<std::shared_ptr<Node>> Node::get_all_children() {
     return all_children;
 }
 
+size_t Node::get_all_child_count() const {
+    return embedded_children.size() + children.size();
+}
+
+const std::shared_ptr<Node> &Node::get_all_child(size_t index) const {
+    if (index < embedded_children.size()) {
+        return embedded_children[index];
+    }
+    return children[index - embedded_children.size()];
+}
+
 void Node::add_child(const std::shared_ptr<Node> &new_child) {
     assert(new_child && new_child.get() != this);
 
@@ -139,6 +198,9 @@ void Node::add_child(const std::shared_ptr<Node> &new_child) {
     new_child->tree_ = tree_;
 
     children.push_back(new_child);
+    structure_version++;
+
+    mark_layout_dirty();
 }
 
 void Node::add_embedded_child(const std::shared_ptr<Node> &new_child) {
@@ -152,6 +214,9 @@ void Node::add_embedded_child(const std::shared_ptr<Node> &new_child) {
     new_child->tree_ = tree_;
 
     embedded_children.push_back(new_child);
+    structure_version++;
+
+    mark_layout_dirty();
 }
 
 std::shared_ptr<Node> Node::get_child(size_t index) {
@@ -166,15 +231,35 @@ void Node::remove_child(size_t index) {
     if (index < 0 || index >= children.size()) {
         return;
     }
+    children[index]->damage_drawn_area();
+
     children.erase(children.begin() + index);
+    structure_version++;
+
+    mark_layout_dirty();
 }
 
 void Node::remove_all_children() {
+    for (auto &child : children) {
+        child->damage_drawn_area();
+    }
+
     children.clear();
+    structure_version++;
+
+    mark_layout_dirty();
 }
 
 void Node::set_visibility(bool visible) {
+    if (visible_ == visible) {
+        return;
+    }
+
     visible_ = visible;
+    visibility_version++;
+
+    // Containers skip invisible children.
+    mark_layout_dirty();
 }
 
 bool Node::get_visibility() const {
@@ -229,6 +314,73 @@ void Node::when_subtree_changed() {
     }
 }
 
+void Node::mark_layout_dirty() {
+    Engine::get_singleton()->request_redraw();
+
+    // The ancestors of a dirty node are dirty already.
+    for (auto node = this; node && !node->minimum_size_dirty; node = node->parent) {
+        node->minimum_size_dirty = true;
+        node->children_layout_dirty = true;
+    }
+}
+
+bool Node::is_minimum_size_dirty() const {
+    return minimum_size_dirty;
+}
+
+void Node::queue_redraw() {
+    redraw_queued_ = true;
+
+    Engine::get_singleton()->request_redraw();
+}
+
+void Node::queue_redraw_rect(const RectF &rect) {
+    VectorServer::get_singleton()->add_damage_rect(rect);
+
+    Engine::get_singleton()->request_redraw();
+}
+
+void Node::damage_drawn_area() {
+    // Descendants aren't drawn without their ancestors.
+    if (!drawn_rect_) {
+        return;
+    }
+
+    VectorServer::get_singleton()->add_damage_rect(*drawn_rect_);
+    drawn_rect_.reset();
+
+    for (size_t i = 0; i < get_all_child_count(); i++) {
+        get_all_child(i)->damage_drawn_area();
+    }
+
+    Engine::get_singleton()->request_redraw();
+}
+
+RectF Node::get_redraw_rect() const {
+    return {};
+}
+
+void Node::update_drawn_area() {
+    if (!visible_) {
+        // Hidden since the last frame, with the descendants.
+        damage_drawn_area();
+        return;
+    }
+
+    auto rect = get_redraw_rect();
+
+    if (!drawn_rect_ || !(*drawn_rect_ == rect) || redraw_queued_) {
+        auto vector_server = VectorServer::get_singleton();
+        if (drawn_rect_) {
+            vector_server->add_damage_rect(*drawn_rect_);
+        }
+        vector_server->add_damage_rect(rect);
+    }
+
+    drawn_rect_ = rect;
+    redraw_queued_ = false;
+}
+
 void Node::connect_signal(const std::string &signal, const AnyCallable<void> &callback) {
     if (signal == "subtree_changed") {
         subtree_changed_callbacks.push_back(callback);
@@ -243,4 +395,12 @@ SceneTree *Node::get_tree() const {
     return tree_;
 }
 
+uint64_t Node::get_structure_version() {
+    return structure_version;
+}
+
+uint64_t Node::get_visibility_version() {
+    return visibility_version;
+}
+
 } // namespace Flint
@@ -2,9 +2,11 @@
 #define FLINT_NODE_H
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "../common/any_callable.h"
+#include "../common/geometry.h"
 #include "../common/utils.h"
 #include "../servers/engine.h"
 #include "../servers/input_server.h"
@@ -36,6 +38,7 @@ enum class NodeType {
 
     Label,
     TextEdit,
+    TextView,
     SpinBox,
     Panel,
     TextureRect,
@@ -56,6 +59,10 @@ class SceneTree;
 class Node {
     friend class SceneTree;
 
+    friend void calc_minimum_size(Node *root);
+
+    friend void propagate_draw(Node *node);
+
 public:
     std::string name;
 
@@ -110,6 +117,12 @@ public:
     std::vector<std::shared_ptr<Node>> get_embedded_children();
     std::vector<std::shared_ptr<Node>> get_all_children();
 
+    /// Number of embedded children and children, to visit them without copying them like get_all_children().
+    size_t get_all_child_count() const;
+
+    /// Embedded children come first, as in get_all_children().
+    const std::shared_ptr<Node> &get_all_child(size_t index) const;
+
     virtual std::shared_ptr<Node> get_child(size_t index);
 
     void remove_child(size_t index);
@@ -137,10 +150,36 @@ public:
      */
     void when_subtree_changed();
 
+    /// Recalculate the minimum sizes of this node and its ancestors, and adjust their layouts, in the next layout
+    /// pass. Call it whenever something the minimum size depends on changes.
+    void mark_layout_dirty();
+
+    /// If the minimum size is waiting to be recalculated.
+    bool is_minimum_size_dirty() const;
+
+    /// Request a frame which redraws the node, also in the partial redraw mode when it hasn't moved or resized.
+    /// Call it whenever the node looks different.
+    void queue_redraw();
+
+    /// Like queue_redraw(), but only a global rect inside what the node draws has changed, e.g. a blinking caret.
+    void queue_redraw_rect(const RectF &rect);
+
+    /// Report what this node and its descendants drew in the last frame as damaged, e.g. when they're removed.
+    void damage_drawn_area();
+
+    /// Global rect covering what the node draws by itself, for partial redraw. Empty for nodes which don't draw.
+    virtual RectF get_redraw_rect() const;
+
     virtual void connect_signal(const std::string &signal, const AnyCallable<void> &callback);
 
     SceneTree *get_tree() const;
 
+    /// Changes whenever a child is added to or removed from any node, which invalidates cached traversal orders.
+    static uint64_t get_structure_version();
+
+    /// Changes whenever any node is shown or hidden.
+    static uint64_t get_visibility_version();
+
     int render_layer = 0;
 
 protected:
@@ -150,6 +189,21 @@ protected:
 
     bool visible_ = true;
 
+    /// Set with the ancestors, so that the layout pass can skip clean subtrees. Nodes start dirty.
+    bool minimum_size_dirty = true;
+
+    /// If a container has to adjust the layout of its children.
+    bool children_layout_dirty = true;
+
+    /// Redraw rect of the last frame in which the node has been drawn. None if it hasn't been drawn since then.
+    std::optional<RectF> drawn_rect_;
+
+    bool redraw_queued_ = false;
+
+    /// Called by the draw pass after drawing the node. Reports the old and the new redraw rects as damaged if the
+    /// node has changed, and the drawn areas of the subtree if it has been hidden.
+    void update_drawn_area();
+
     std::vector<std::shared_ptr<Node>> children;
 
     std::vector<std::shared_ptr<Node>> embedded_children;
@@ -164,6 +218,36 @@ protected:
     std::vector<AnyCallable<void>> subtree_changed_callbacks;
 };
 
+class NodeUi;
+class SubWindow;
+
+/// Nodes of a subtree in the orders they're processed in, so that the systems don't walk the tree every frame.
+/// The orders are only rebuilt when the root or the structure of the nodes has changed.
+/// @note Changing the structure doesn't change the orders until the next update, so they can be iterated meanwhile.
+class NodeTraversalCache {
+public:
+    /// Rebuild the orders if they're out of date.
+    void update(Node *root);
+
+    /// Depth-first preorder from left to right.
+    const std::vector<Node *> &get_preorder() const;
+
+    /// Depth-first postorder from left to right.
+    const std::vector<Node *> &get_postorder() const;
+
+    /// Sub-windows in preorder.
+    const std::vector<SubWindow *> &get_sub_windows() const;
+
+private:
+    Node *root_ = nullptr;
+
+    uint64_t structure_version_ = 0;
+
+    std::vector<Node *> preorder;
+    std::vector<Node *> postorder;
+    std::vector<SubWindow *> sub_windows;
+};
+
 /// Perform a depth-first-search preorder traversal from left-to-right.
 /// Usages: draw nodes back-to-front, propagate transform.
 /// See: https://faculty.cs.niu.edu/~mcmahon/CS241/Notes/Data_Structures/binary_tree_traversals.html
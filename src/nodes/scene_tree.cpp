@@ -1,5 +1,6 @@
 #include "scene_tree.h"
 
+#include "../common/worker_pool.h"
 #include "../servers/render_server.h"
 #include "sub_window.h"
 
@@ -19,57 +20,52 @@ void propagate_input(Node* node, InputEvent& event) {
         return;
     }
 
-    for (auto& child : node->get_all_children()) {
+    // Index the children instead of copying them, as input handling may add or remove children.
+    // Children added meanwhile are not visited.
+    auto child_count = node->get_all_child_count();
+
+    for (size_t i = 0; i < child_count && i < node->get_all_child_count(); i++) {
+        // Keep the child alive even if it's removed meanwhile.
+        auto child = node->get_all_child(i);
+
         if (typeid(*child) == typeid(SubWindow) || !node->get_visibility()) {
             continue;
         }
 
-        // Do not propagate out-of-bounds mouse input events if they are explicitly ignored.
-        if (node->is_ui_node()) {
-            auto ui_node = dynamic_cast<NodeUi*>(node);
-
-            if (ui_node->ignore_mouse_input_outside_rect()) {
-                // Intercept out-of-scope mouse input events.
-                auto global_position = ui_node->get_global_position();
-
-                auto active_rect = RectF(global_position, global_position + ui_node->get_size());
-
-                switch (event.type) {
-                    case InputEventType::MouseMotion:
-                    case InputEventType::MouseButton:
-                    case InputEventType::MouseScroll: {
-                        if (!active_rect.contains_point(InputServer::get_singleton()->cursor_position)) {
-                            continue;
-                        }
-                    } break;
-                    default:
-                        break;
-                }
-            }
-        }
-
         propagate_input(child.get(), event);
     }
 
     node->input(event);
 }
 
-void input_system(Node* root, std::vector<InputEvent>& input_queue) {
-    // Collect all sub-windows.
-    std::vector<SubWindow*> sub_windows;
-    {
-        std::vector<Node*> nodes;
-        dfs_preorder_ltr_traversal(root, nodes);
-
-        for (auto& node : nodes) {
-            if (typeid(*node) == typeid(SubWindow)) {
-                auto sub_window = dynamic_cast<SubWindow*>(node);
-                sub_windows.push_back(sub_window);
-            }
-        }
+/// Mouse events go through the hit index of their window, the other events visit all the nodes.
+void dispatch_input(Node* root, InputHitIndex& hit_index, InputEvent& event) {
+    if (InputHitIndex::is_mouse_event(event)) {
+        hit_index.dispatch(root, event);
+    } else {
+        propagate_input(root, event);
     }
+}
+
+void input_system(NodeTraversalCache& traversal,
+                  std::vector<InputHitIndex>& hit_indices,
+                  Node* root,
+                  std::vector<InputEvent>& input_queue) {
+    traversal.update(root);
+
+    // One index for the primary window, then one for each sub-window.
+    auto& sub_windows = traversal.get_sub_windows();
+    hit_indices.resize(sub_windows.size() + 1);
+
+    // The nodes may have moved since the last frame.
+    for (auto& hit_index : hit_indices) {
+        hit_index.invalidate();
+    }
+
+    // The cached sub-windows don't change until the next update of the traversal cache.
+    for (size_t i = 0; i < sub_windows.size(); i++) {
+        auto w = sub_windows[i];
 
-    for (auto& w : sub_windows) {
         if (!w->get_visibility()) {
             continue;
         }
@@ -79,7 +75,7 @@ void input_system(Node* root, std::vector<InputEvent>& input_queue) {
                 continue;
             }
 
-            propagate_input(w, event);
+            dispatch_input(w, hit_indices[i + 1], event);
         }
     }
 
@@ -88,82 +84,62 @@ void input_system(Node* root, std::vector<InputEvent>& input_queue) {
         //     continue;
         // }
 
-        propagate_input(root, event);
+        dispatch_input(root, hit_indices[0], event);
     }
 }
 
-void propagate_transform(NodeUi* node, Vec2F parent_global_transform) {
-    if (node == nullptr) {
+void transform_system(NodeTraversalCache& traversal, Node* root) {
+    if (root == nullptr) {
         return;
     }
 
-    node->calc_global_position(parent_global_transform);
+    traversal.update(root);
 
-    for (auto& child : node->get_all_children()) {
-        if (child->is_ui_node()) {
-            auto ui_child = dynamic_cast<NodeUi*>(child.get());
-            propagate_transform(ui_child, node->get_global_position());
+    // Parents come before their children in preorder.
+    for (auto& node : traversal.get_preorder()) {
+        if (!node->is_ui_node()) {
+            continue;
         }
-    }
-}
 
-void transform_system(Node* root) {
-    if (root == nullptr) {
-        return;
-    }
+        auto ui_node = dynamic_cast<NodeUi*>(node);
 
-    // Collect all orphan UI nodes.
-    std::vector<Node*> nodes;
-    std::vector<NodeUi*> orphan_ui_nodes;
-    dfs_preorder_ltr_traversal(root, nodes);
-    for (auto& node : nodes) {
-        if (node->is_ui_node()) {
-            // Has no parent or no UI parent.
-            if (node->get_parent() == nullptr || !node->get_parent()->is_ui_node()) {
-                auto ui_node = dynamic_cast<NodeUi*>(node);
-                orphan_ui_nodes.push_back(ui_node);
-            }
+        // UI nodes without any UI parent are placed relative to the origin.
+        auto parent = node->get_parent();
+        if (parent == nullptr || !parent->is_ui_node()) {
+            ui_node->calc_global_position(Vec2F{});
+        } else {
+            ui_node->calc_global_position(dynamic_cast<NodeUi*>(parent)->get_global_position());
         }
     }
-
-    for (auto& ui_node : orphan_ui_nodes) {
-        propagate_transform(ui_node, Vec2F{});
-    }
 }
 
 void propagate_draw(Node* node) {
     node->draw();
 
+    if (VectorServer::get_singleton()->get_partial_redraw_enabled()) {
+        node->update_drawn_area();
+    }
+
     node->pre_draw_children();
 
-    for (auto& child : node->get_all_children()) {
+    for (size_t i = 0; i < node->get_all_child_count(); i++) {
+        auto child = node->get_all_child(i).get();
+
         if (typeid(*child) == typeid(SubWindow) || !node->get_visibility()) {
             continue;
         }
 
-        propagate_draw(child.get());
+        propagate_draw(child);
     }
 
     node->post_draw_children();
 }
 
-void draw_system(Node* root) {
-    // Collect all sub-windows.
-
-    std::vector<SubWindow*> sub_windows;
-    {
-        std::vector<Node*> nodes;
-        dfs_preorder_ltr_traversal(root, nodes);
-        for (auto& node : nodes) {
-            if (typeid(*node) == typeid(SubWindow)) {
-                auto sub_window = dynamic_cast<SubWindow*>(node);
-                sub_windows.push_back(sub_window);
-            }
-        }
-    }
+void draw_system(NodeTraversalCache& traversal, Node* root) {
+    traversal.update(root);
 
     // Draw sub-windows.
-    for (auto& w : sub_windows) {
+    for (auto& w : traversal.get_sub_windows()) {
         if (!w->get_visibility()) {
             continue;
         }
@@ -181,17 +157,50 @@ void draw_system(Node* root) {
     propagate_draw(root);
 }
 
-void calc_minimum_size(Node* root) {
-    std::vector<Node*> descendants;
-    dfs_postorder_ltr_traversal(root, descendants);
-    for (auto& node : descendants) {
-        if (node->is_ui_node()) {
-            auto ui_node = dynamic_cast<NodeUi*>(node);
-            ui_node->calc_minimum_size();
-            // std::cout << "Node: " << get_node_type_name(node->type)
-            //           << ", size: " << ui_node->get_effective_minimum_size() << std::endl;
+void shaping_system(NodeTraversalCache& traversal, Node* root) {
+    traversal.update(root);
+
+    std::vector<Label*> labels;
+    for (auto& node : traversal.get_preorder()) {
+        if (node->get_node_type() == NodeType::Label) {
+            auto label = static_cast<Label*>(node);
+            if (label->is_remeasure_pending()) {
+                labels.push_back(label);
+            }
         }
     }
+
+    // A single label is shaped lazily as usual.
+    if (labels.size() < 2) {
+        return;
+    }
+
+    std::vector<LabelShapingResult> results(labels.size());
+
+    WorkerPool::get_singleton()->parallel_for(labels.size(), [&](size_t i) { labels[i]->shape_text(results[i]); });
+
+    // Commit on the main thread, so the labels end up the same as if they were shaped one by one.
+    for (size_t i = 0; i < labels.size(); i++) {
+        labels[i]->commit_shaping(std::move(results[i]));
+    }
+}
+
+void calc_minimum_size(Node* root) {
+    // Clean subtrees have no dirty node, as marking a node marks its ancestors.
+    if (root == nullptr || !root->minimum_size_dirty) {
+        return;
+    }
+
+    root->minimum_size_dirty = false;
+
+    for (size_t i = 0; i < root->get_all_child_count(); i++) {
+        calc_minimum_size(root->get_all_child(i).get());
+    }
+
+    if (root->is_ui_node()) {
+        auto ui_node = dynamic_cast<NodeUi*>(root);
+        ui_node->calc_minimum_size();
+    }
 }
 
 void SceneTree::process(double dt) {
@@ -205,36 +214,34 @@ void SceneTree::process(double dt) {
     }
 
     // Get ready from-back-to-front.
-    {
-        std::vector<Node*> nodes;
-        dfs_preorder_ltr_traversal(root.get(), nodes);
-        for (auto& node : nodes) {
-            node->ready();
-        }
+    // Nodes added meanwhile are not in the order until the next update of it, as when the nodes were collected.
+    traversal.update(root.get());
+    for (auto& node : traversal.get_preorder()) {
+        node->ready();
     }
 
-    input_system(root.get(), InputServer::get_singleton()->input_queue);
+    input_system(traversal, hit_indices, root.get(), InputServer::get_singleton()->input_queue);
+
+    // Shape the labels waiting for it in parallel, instead of one by one in their updates.
+    shaping_system(traversal, root.get());
 
-    // Run calc_minimum_size() depth-first.
+    // Run calc_minimum_size() depth-first for the dirty nodes.
     calc_minimum_size(root.get());
 
     // Update global transform.
-    transform_system(root.get());
+    transform_system(traversal, root.get());
 
     // Update from-back-to-front.
-    {
-        std::vector<Node*> nodes;
-        dfs_preorder_ltr_traversal(root.get(), nodes);
-        for (auto& node : nodes) {
-            if (!node->ready_) {
-                continue;
-            }
-            node->update(dt);
+    traversal.update(root.get());
+    for (auto& node : traversal.get_preorder()) {
+        if (!node->ready_) {
+            continue;
         }
+        node->update(dt);
     }
 
     // Draw from-back-to-front.
-    draw_system(root.get());
+    draw_system(traversal, root.get());
 }
 
 void SceneTree::notify_primary_window_size_changed(Vec2I new_size) const {
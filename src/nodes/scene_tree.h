@@ -2,6 +2,7 @@
 #define FLINT_SCENE_TREE_H
 
 #include "file_dialog.h"
+#include "input_hit_index.h"
 #include "node.h"
 #include "timer.h"
 #include "ui/button.h"
@@ -18,6 +19,7 @@
 #include "ui/progress_bar.h"
 #include "ui/spin_box.h"
 #include "ui/text_edit.h"
+#include "ui/text_view.h"
 #include "ui/texture_rect.h"
 #include "ui/tree.h"
 
@@ -27,11 +29,16 @@ class Window;
 
 namespace Flint {
 
-void transform_system(Node* root);
+/// The systems below process the subtree of the root in the orders of the traversal cache, updating it first.
 
-void draw_system(Node* root);
+void transform_system(NodeTraversalCache& traversal, Node* root);
 
-/// Run calc_minimum_size() depth-first.
+void draw_system(NodeTraversalCache& traversal, Node* root);
+
+/// Shape the text of all the labels which need it at once, on the worker pool.
+void shaping_system(NodeTraversalCache& traversal, Node* root);
+
+/// Run calc_minimum_size() depth-first for the nodes marked dirty, skipping clean subtrees.
 void calc_minimum_size(Node* root);
 
 /// Processing order: Input -> Update -> Draw.
@@ -58,6 +65,12 @@ public:
 private:
     std::shared_ptr<Node> root;
 
+    /// Nodes of the tree in processing orders, which are only rebuilt when the tree structure changes.
+    NodeTraversalCache traversal;
+
+    /// Hit indices of the mouse events, one of the primary window and one of each sub-window.
+    std::vector<InputHitIndex> hit_indices;
+
     bool quited = false;
 };
 
@@ -110,11 +110,7 @@ void SubWindow::post_draw_children() {
 }
 
 void SubWindow::set_visibility(bool visible) {
-    if (visible_ == visible) {
-        return;
-    }
-
-    visible_ = visible;
+    Node::set_visibility(visible);
 }
 
 std::shared_ptr<Pathfinder::Window> SubWindow::get_raw_window() const {
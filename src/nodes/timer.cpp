@@ -2,6 +2,7 @@
 
 #include <string>
 
+#include "../servers/engine.h"
 #include "sub_window.h"
 
 namespace Flint {
@@ -12,6 +13,9 @@ void Timer::start_timer(float time) {
     }
     remaining_time_ = time;
     is_stopped_ = false;
+
+    // Wake up the main loop in time for the timeout.
+    Engine::get_singleton()->request_redraw(time);
 }
 
 void Timer::update(double dt) {
@@ -19,6 +23,10 @@ void Timer::update(double dt) {
 
     if (!is_stopped_ && remaining_time_ > 0) {
         remaining_time_ -= dt;
+
+        if (remaining_time_ > 0) {
+            Engine::get_singleton()->request_redraw(remaining_time_);
+        }
     }
 
     if (!is_stopped_ && remaining_time_ <= 0) {
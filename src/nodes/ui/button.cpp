@@ -64,6 +64,9 @@ void Button::calc_minimum_size() {
 void Button::input(InputEvent &event) {
     auto global_position = get_global_position();
 
+    bool was_hovered = hovered;
+    bool was_pressed = pressed;
+
     bool consume_flag = false;
 
     if (event.type == InputEventType::MouseMotion) {
@@ -134,6 +137,10 @@ void Button::input(InputEvent &event) {
         }
     }
 
+    if (hovered != was_hovered || pressed != was_pressed) {
+        queue_redraw();
+    }
+
     NodeUi::input(event);
 
     if (consume_flag) {
@@ -141,6 +148,11 @@ void Button::input(InputEvent &event) {
     }
 }
 
+bool Button::wants_mouse_input_outside_rect() const {
+    // Moving out ends the hover and the press of a normal button.
+    return hovered || pressed_inside || (pressed && !toggle_mode) || NodeUi::wants_mouse_input_outside_rect();
+}
+
 void Button::update(double dt) {
     NodeUi::update(dt);
 
@@ -268,6 +280,7 @@ void Button::set_toggle_mode(bool enable) {
 void Button::press() {
     if (toggle_mode) {
         pressed = !pressed;
+        queue_redraw();
         when_toggled(pressed);
     } else {
         when_pressed();
@@ -277,10 +290,12 @@ void Button::press() {
 void ButtonGroup::update() {
     // We should not trigger any button signals when changing their states from ButtonGroup.
     for (auto &b : buttons) {
-        if (b.lock() == pressed_button.lock()) {
-            b.lock()->pressed = true;
-        } else {
-            b.lock()->pressed = false;
+        auto button = b.lock();
+        bool pressed = button == pressed_button.lock();
+
+        if (button->pressed != pressed) {
+            button->pressed = pressed;
+            button->queue_redraw();
         }
     }
 }
@@ -7,8 +7,6 @@ void BoxContainer::adjust_layout() {
         return;
     }
 
-    auto path = get_node_path();
-
     Vec2F total_size;
     std::vector<NodeUi *> expanding_children;
 
@@ -222,6 +220,7 @@ void BoxContainer::set_separation(float new_separation) {
     }
 
     separation = new_separation;
+    mark_layout_dirty();
 }
 
 } // namespace Flint
@@ -81,6 +81,9 @@ void CollapseContainer::set_collapse(bool collapse) {
     } else {
         theme_title_bar_->corner_radii = {8, 8, 0, 0};
     }
+
+    mark_layout_dirty();
+    queue_redraw();
 }
 
 void CollapseContainer::calc_minimum_size() {
@@ -115,9 +118,7 @@ void CollapseContainer::set_title(std::string title) {
 }
 
 void CollapseContainer::update(double dt) {
-    NodeUi::update(dt);
-
-    adjust_layout();
+    Container::update(dt);
 }
 
 void CollapseContainer::draw() {
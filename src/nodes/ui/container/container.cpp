@@ -42,7 +42,11 @@ void Container::calc_minimum_size() {
 void Container::update(double dt) {
     NodeUi::update(dt);
 
-    adjust_layout();
+    if (children_layout_dirty || size != laid_out_size) {
+        children_layout_dirty = false;
+        adjust_layout();
+        laid_out_size = size;
+    }
 }
 
 } // namespace Flint
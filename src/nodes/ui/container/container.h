@@ -22,7 +22,12 @@ protected:
 
     /// The most important method for containers. Adjusts its own size (but not position),
     /// adjusts its children's sizes and local positions.
+    /// Only called by update() when the layout is dirty or the size has changed.
     virtual void adjust_layout();
+
+private:
+    /// Size after the last adjust_layout().
+    Vec2F laid_out_size{-1};
 };
 
 } // namespace Flint
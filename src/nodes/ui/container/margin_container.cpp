@@ -39,11 +39,15 @@ void MarginContainer::adjust_layout() {
 }
 
 void MarginContainer::set_margin_all(float margin) {
-    margin_ = {margin, margin, margin, margin};
+    set_margin({margin, margin, margin, margin});
 }
 
 void MarginContainer::set_margin(const RectF &margin) {
+    if (margin_ == margin) {
+        return;
+    }
     margin_ = margin;
+    mark_layout_dirty();
 }
 
 } // namespace Flint
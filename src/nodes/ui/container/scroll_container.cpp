@@ -96,9 +96,7 @@ void ScrollContainer::input(InputEvent &event) {
 }
 
 void ScrollContainer::update(double dt) {
-    NodeUi::update(dt);
-
-    adjust_layout();
+    Container::update(dt);
 
     if (children.empty() || !children.front()->is_ui_node()) {
         return;
@@ -184,6 +182,7 @@ void ScrollContainer::set_hscroll(int32_t value) {
     }
 
     hscroll = value;
+    queue_redraw();
 }
 
 int32_t ScrollContainer::get_hscroll() const {
@@ -196,6 +195,7 @@ void ScrollContainer::set_vscroll(int32_t value) {
     }
 
     vscroll = value;
+    queue_redraw();
 }
 
 int32_t ScrollContainer::get_vscroll() const {
@@ -217,22 +217,12 @@ void ScrollContainer::pre_draw_children() {
     }
 
     auto global_pos = get_global_position();
-    float dpi_scale = RenderServer::get_singleton()->window_builder_->get_dpi_scaling_factor(get_window_index());
-    auto size = get_size() * dpi_scale;
 
     auto vector_server = VectorServer::get_singleton();
     vector_server->set_render_layer(render_layer);
 
-    auto canvas = vector_server->get_canvas();
-
-    // Use a RenderTarget to achieve content clip, instead of using clip path.
-    Pathfinder::RenderTargetDesc render_target_desc = {size.to_i32(), "ScrollContainer render target"};
-
-    // Draw all children onto the temporary render target.
-    temp_draw_data.render_target_id = canvas->get_scene()->push_render_target(render_target_desc);
-
-    // For the temporary render target, we need to offset all child nodes back to the origin.
-    vector_server->global_transform_offset = Transform2::from_translation(-global_pos);
+    // Clip the children by a scissor rect, which needs neither a clip path nor a render target.
+    vector_server->push_clip_rect({global_pos, global_pos + get_size()});
 }
 
 void ScrollContainer::post_draw_children() {
@@ -240,24 +230,11 @@ void ScrollContainer::post_draw_children() {
         return;
     }
 
-    auto global_pos = get_global_position();
-    auto size = get_size();
-
     auto vector_server = VectorServer::get_singleton();
 
-    auto canvas = vector_server->get_canvas();
-
     draw_scroll_bar();
 
-    vector_server->global_transform_offset = Transform2();
-
-    // Don't draw on the temporary render target anymore.
-    canvas->get_scene()->pop_render_target();
-
-    float dpi_scale = RenderServer::get_singleton()->window_builder_->get_dpi_scaling_factor(get_window_index());
-
-    auto dst_rect = RectF(global_pos * dpi_scale, (global_pos + size) * dpi_scale);
-    vector_server->get_canvas()->draw_render_target(temp_draw_data.render_target_id, dst_rect);
+    vector_server->pop_clip_rect();
 
     vector_server->set_render_layer(0);
 }
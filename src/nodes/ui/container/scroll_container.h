@@ -48,10 +48,6 @@ protected:
 
     StyleBox theme_scroll_bar;
     StyleBox theme_scroll_grabber;
-
-    struct {
-        Pathfinder::RenderTargetId render_target_id{};
-    } temp_draw_data;
 };
 
 } // namespace Flint
@@ -98,7 +98,11 @@ void TabContainer::calc_minimum_size() {
 }
 
 void TabContainer::set_current_tab(int32_t index) {
+    if (current_tab == index) {
+        return;
+    }
     current_tab = index;
+    mark_layout_dirty();
 }
 
 void TabContainer::draw() {
@@ -1,5 +1,8 @@
 #include "label.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <list>
 #include <string>
 
@@ -15,196 +18,68 @@ enum class Bidi {
     RightToLeft,
 };
 
-std::vector<Pathfinder::Range> get_line_breakable_groups(const std::vector<LayoutGlyph> &glyphs, int offset) {
-    std::vector<Pathfinder::Range> groups;
-
-    bool rtl = false;
-
-    if (rtl) {
-        //        uint32_t group_start = glyphs.size() - 1;
-        //
-        //        for (int g_idx = glyphs.size() - 1; g_idx >= 0; g_idx--) {
-        //            auto &g = glyphs[g_idx];
-        //
-        //            if (g.line_breakable_ && g_idx != glyphs.size() - 1) {
-        //                Pathfinder::Range group = {group_start, group_start - g_idx};
-        //                group_start = g_idx;
-        //                groups.push_back(group);
-        //            }
-        //        }
-        //
-        //        Pathfinder::Range group = {group_start, group_start + 1};
-        //        groups.push_back(group);
-        //
-        //        for (auto &r : groups) {
-        //            r.begin = r.begin + 1 - r.length;
-        //        }
-    } else {
-        uint32_t group_start = 0;
-
-        for (int g_idx = 0; g_idx < glyphs.size(); g_idx++) {
-            auto &g = glyphs[g_idx];
-
-            if (g.line_breakable_ && g_idx != 0) {
-                Pathfinder::Range group = {offset + group_start, offset + static_cast<unsigned long long>(g_idx)};
-                group_start = g_idx;
-                groups.push_back(group);
-            }
-        }
-
-        Pathfinder::Range group = {offset + group_start, offset + (uint32_t)glyphs.size()};
-        groups.push_back(group);
-    }
-
-    return groups;
-}
-
-/// PARAs -> LINEs
-std::vector<Line> get_lines_with_word_wrap(float limited_width,
-                                           const std::vector<Line> &original_paras,
-                                           const std::vector<LayoutGlyph> &glyphs,
-                                           Vec2F &out_text_size) {
-    float tracking = 0;
-
-    std::vector<Line> wrapped_lines;
-
-    Vec2F text_size{};
-
-    for (const auto &para : original_paras) {
-        const auto &para_range = para.glyph_ranges;
-
-        // Get glyphs in this paragraph.
-        std::vector<LayoutGlyph> para_glyphs;
-        for (int glyph_idx = para_range.start; glyph_idx < para_range.end; glyph_idx++) {
-            para_glyphs.push_back(glyphs[glyph_idx]);
-        }
+void wrap_paragraph(float limited_width,
+                    const Line &para,
+                    const GlyphRun &glyphs,
+                    const std::vector<float> &advance_sums,
+                    std::vector<Line> &lines) {
+    lines.clear();
 
-        // Get line-breakable groups in this paragraph.
-        auto groups_in_para = get_line_breakable_groups(para_glyphs, para_range.start);
+    size_t para_glyph_start = para.glyph_ranges.start;
+    size_t glyph_count = para.glyph_ranges.length();
 
-        std::vector<float> group_widths_in_para;
+    // Lines are filled in logical order, which is right to left for RTL paragraphs.
+    // A position is a glyph count along that order.
+    auto get_glyph = [&](size_t position) {
+        return para_glyph_start + (para.rtl ? glyph_count - 1 - position : position);
+    };
 
-        // For RTL paragraphs, we handle the groups reversely.
+    // Width of the glyphs in the position range [from, to).
+    auto get_width = [&](size_t from, size_t to) {
         if (para.rtl) {
-            std::reverse(groups_in_para.begin(), groups_in_para.end());
+            return advance_sums[glyph_count - from] - advance_sums[glyph_count - to];
         }
+        return advance_sums[to] - advance_sums[from];
+    };
 
-        // Break groups that are too long.
-        for (auto p_group = groups_in_para.begin(); p_group != groups_in_para.end(); p_group++) {
-            auto group = *p_group;
+    // The break flag is on the visually latter glyph of the two glyphs around the break.
+    auto can_break_before = [&](size_t position) {
+        size_t glyph = para.rtl ? glyph_count - position : position;
+        return glyphs.has_flag(para_glyph_start + glyph, GlyphRun::FLAG_LINE_BREAKABLE);
+    };
 
-            float group_width = 0;
+    auto add_line = [&](size_t from, size_t to) {
+        Pathfinder::Range range = para.rtl ? Pathfinder::Range{glyph_count - to, glyph_count - from}
+                                           : Pathfinder::Range{from, to};
+        lines.push_back({range, para.rtl, get_width(from, to)});
+    };
 
-            for (int j = para.rtl ? p_group->length() - 1 : 0; para.rtl ? j >= 0 : j < p_group->length();
-                 para.rtl ? j-- : j++) {
-                int glyph_idx = p_group->start + j;
+    size_t line_start = 0;
 
-                const Glyph &glyph = glyphs[glyph_idx].glyph_;
-                float glyph_width = glyph.x_advance;
+    // The last break opportunity in the current line. Not valid if not after the line start.
+    size_t last_break = 0;
 
-                // Handle some abonormal graphs which are too wide.
-                if (group_width == 0 && glyph_width > limited_width) {
-                    break;
-                }
-
-                // Break the current group if it is too wide.
-                if ((group_width + glyph_width + tracking) > limited_width) {
-                    // Break the current group into two ones.
-                    Pathfinder::Range range_pre;
-                    Pathfinder::Range range_next;
-
-                    if (para.rtl) {
-                        range_pre = {p_group->start + j + 1, p_group->start + p_group->length()};
-                        range_next = {p_group->start, p_group->start + j + 1};
-                    } else {
-                        range_pre = {p_group->start, p_group->start + j};
-                        range_next = {p_group->start + j, p_group->start + p_group->length()};
-                    }
-
-                    // Replace the old group with the two newly created groups.
-                    *p_group = range_next;
-                    p_group = groups_in_para.insert(p_group, range_pre);
-
-                    // Move on to handle the next group.
-                    break;
-                }
-
-                group_width += glyph_width;
-                group_width += tracking;
-            }
-
-            group_width -= tracking;
-            group_widths_in_para.push_back(group_width);
+    for (size_t position = 0; position < glyph_count; position++) {
+        if (position > line_start && can_break_before(position)) {
+            last_break = position;
         }
 
-        // Up to this point, all the groups in the paragraph meet the width requirement.
-        // We can start breaking the paragraph into lines.
-
-        int current_group_idx = 0;
-        float current_line_width = 0;
-        std::vector<Pathfinder::Range> current_line_groups;
-
-        while (!groups_in_para.empty()) {
-            Pathfinder::Range current_group;
-
-            current_group = groups_in_para.front();
-            groups_in_para.erase(groups_in_para.begin());
-
-            float current_group_width = group_widths_in_para[current_group_idx];
-
-            // Handle some abonormal graphs which are too wide.
-            if (current_line_groups.empty() && current_group_width > limited_width) {
-                Pathfinder::Range new_range = {current_group.start, current_group.end};
-                wrapped_lines.push_back({new_range, para.rtl, current_group_width});
-
-                text_size.x = std::max(current_group_width, text_size.x);
-                current_group_idx++;
-                continue;
-            }
-
-            // Finish a line.
-            if (current_line_width + current_group_width + tracking > limited_width) {
-                uint32_t line_start = current_line_groups.front().start;
-                uint32_t line_end = current_line_groups.front().end;
-
-                for (auto &group : current_line_groups) {
-                    line_start = std::min(line_start, (uint32_t)group.start);
-                    line_end = std::max(line_end, (uint32_t)group.end);
-                }
-
-                Pathfinder::Range new_range = {line_start, line_end};
-                wrapped_lines.push_back({new_range, para.rtl, current_line_width});
-
-                text_size.x = std::max(current_line_width, text_size.x);
-
-                current_line_groups.clear();
-                current_line_width = 0;
-            }
-
-            current_line_groups.push_back(current_group);
-            current_line_width += current_group_width + tracking;
-            current_group_idx++;
+        // Trailing spaces may hang past the limit.
+        if (glyphs.has_flag(get_glyph(position), GlyphRun::FLAG_SPACE)) {
+            continue;
         }
 
-        if (!current_line_groups.empty()) {
-            uint32_t line_start = current_line_groups.front().start;
-            uint32_t line_end = current_line_groups.front().end;
+        // The first glyph of a line is always accepted, even if it's too wide by itself.
+        while (position > line_start && get_width(line_start, position + 1) > limited_width) {
+            // Break the word at the current glyph if it doesn't fit in a line.
+            size_t line_end = last_break > line_start ? last_break : position;
 
-            for (auto &group : current_line_groups) {
-                line_start = std::min(line_start, (uint32_t)group.start);
-                line_end = std::max(line_end, (uint32_t)group.end);
-            }
-
-            Pathfinder::Range new_range = {line_start, line_end};
-            wrapped_lines.push_back({new_range, para.rtl, current_line_width});
-
-            text_size.x = std::max(current_line_width, text_size.x);
+            add_line(line_start, line_end);
+            line_start = line_end;
         }
     }
 
-    out_text_size = text_size;
-
-    return wrapped_lines;
+    add_line(line_start, glyph_count);
 }
 
 Label::Label() {
@@ -213,6 +88,7 @@ Label::Label() {
     debug_size_box.border_color = ColorU::blue();
 
     text_ = "Label";
+    utf8_to_utf32(text_, text_u32_);
 
     font = DefaultResource::get_singleton()->get_default_font();
     // emoji_font = ResourceManager::get_singleton()->load<Font>("assets/fonts/EmojiOneColor.otf");
@@ -226,14 +102,16 @@ Label::Label() {
 
 void Label::set_text(const std::string &new_text) {
     // Only update glyphs when text has changed.
-    if (text_ == new_text || font == nullptr) {
+    if (get_text() == new_text || font == nullptr) {
         return;
     }
 
     text_ = new_text;
+    text_is_dirty_ = false;
     utf8_to_utf32(text_, text_u32_);
 
     need_to_remeasure = true;
+    mark_layout_dirty();
 }
 
 void Label::insert_text(uint32_t codepint_position, const std::string &new_text) {
@@ -246,19 +124,147 @@ void Label::insert_text(uint32_t codepint_position, const std::string &new_text)
     std::u32string new_text_u32;
     utf8_to_utf32(new_text, new_text_u32);
 
-    text_u32_.insert(codepint_position, new_text_u32);
-    text_ = utf32_to_utf8(text_u32_);
-
-    need_to_remeasure = true;
+    replace_text(codepint_position, 0, new_text_u32);
 }
 
 void Label::remove_text(uint32_t codepint_position, uint32_t count) {
     assert((codepint_position + count) <= text_u32_.size() && "Codepoint index is out of bounds!");
 
-    text_u32_.erase(codepint_position, count);
-    text_ = utf32_to_utf8(text_u32_);
+    if (count == 0) {
+        return;
+    }
 
-    need_to_remeasure = true;
+    replace_text(codepint_position, count, {});
+}
+
+void Label::replace_text(uint32_t codepoint_position, uint32_t count, const std::u32string &new_text_u32) {
+    // Find the affected paragraphs before changing the text.
+    // Removing a line break merges the paragraph with the next one, which contains the end of the removed range.
+    size_t first_para = find_paragraph(codepoint_position);
+    size_t last_para = find_paragraph(codepoint_position + count);
+
+    size_t para_count = label_paragraphs_.size();
+    uint32_t text_start = first_para < para_count ? label_paragraphs_[first_para].text_range.start : text_u32_.size();
+    uint32_t text_end = last_para < para_count ? label_paragraphs_[last_para].text_range.end : text_u32_.size();
+
+    text_u32_.replace(codepoint_position, count, new_text_u32);
+    text_is_dirty_ = true;
+
+    // No need to reshape anything if a full remeasure is pending.
+    if (need_to_remeasure) {
+        return;
+    }
+
+    int64_t text_length_delta = (int64_t)new_text_u32.size() - count;
+
+    reshape_paragraphs({first_para, std::min(last_para + 1, para_count)},
+                       {text_start, (uint64_t)(text_end + text_length_delta)},
+                       text_length_delta);
+
+    layout_is_dirty = true;
+    mark_layout_dirty();
+}
+
+size_t Label::find_paragraph(uint32_t codepoint_position) const {
+    // The first paragraph ending after the position.
+    auto iter = std::upper_bound(
+        label_paragraphs_.begin(),
+        label_paragraphs_.end(),
+        codepoint_position,
+        [](uint32_t position, const LabelParagraph &para) { return position < para.text_range.end; });
+
+    if (iter != label_paragraphs_.end()) {
+        return iter - label_paragraphs_.begin();
+    }
+
+    // Text appended to the last paragraph joins it, unless the paragraph ends with a line break.
+    if (!label_paragraphs_.empty() && text_u32_[label_paragraphs_.back().text_range.end - 1] != '\n') {
+        return label_paragraphs_.size() - 1;
+    }
+
+    return label_paragraphs_.size();
+}
+
+void Label::shape_paragraphs(Pathfinder::Range text_range, LabelShapingResult &result) const {
+    auto &new_paragraphs = result.paragraphs;
+
+    size_t glyph_count = 0;
+
+    // Separation into paragraphs, the same way as Font::get_glyphs.
+    uint32_t para_start = text_range.start;
+    for (uint32_t char_idx = text_range.start; char_idx < text_range.end; char_idx++) {
+        if (text_u32_[char_idx] != '\n' && char_idx != text_range.end - 1) {
+            continue;
+        }
+
+        uint32_t para_end = char_idx + 1;
+
+        auto para_text_u32 = std::u32string_view(text_u32_).substr(para_start, para_end - para_start);
+
+        // The glyphs are referenced, not copied.
+        LabelParagraph label_para;
+        label_para.text_range = {para_start, para_end};
+        label_para.glyph_start = glyph_count;
+        label_para.shaped = font->get_shaped_paragraph(para_text_u32, font_size_);
+
+        glyph_count += label_para.shaped->glyphs.size();
+
+        new_paragraphs.push_back(std::move(label_para));
+
+        para_start = para_end;
+    }
+
+    add_emoji_data(new_paragraphs);
+
+    // Prefix sums for word wrap, after emoji glyphs have changed the advances.
+    for (auto &label_para : new_paragraphs) {
+        const auto &glyphs = label_para.shaped->glyphs;
+        auto &advance_sums = label_para.advance_sums;
+
+        advance_sums.resize(glyphs.size() + 1);
+        advance_sums[0] = 0;
+        for (size_t i = 0; i < glyphs.size(); i++) {
+            advance_sums[i + 1] = advance_sums[i] + glyphs.x_advances[i];
+        }
+    }
+}
+
+void Label::reshape_paragraphs(Pathfinder::Range para_range, Pathfinder::Range text_range, int64_t text_length_delta) {
+    LabelShapingResult shaped;
+    shape_paragraphs(text_range, shaped);
+
+    auto &new_paragraphs = shaped.paragraphs;
+
+    // Glyph range of the replaced paragraphs.
+    size_t para_count = label_paragraphs_.size();
+    size_t glyph_start =
+        para_range.start < para_count ? label_paragraphs_[para_range.start].glyph_start : get_glyph_count();
+    size_t glyph_end = para_range.end < para_count ? label_paragraphs_[para_range.end].glyph_start : get_glyph_count();
+
+    size_t new_glyph_count = 0;
+    for (auto &label_para : new_paragraphs) {
+        label_para.glyph_start += glyph_start;
+        new_glyph_count += label_para.shaped->glyphs.size();
+    }
+
+    // Splice the new paragraphs in.
+    label_paragraphs_.erase(label_paragraphs_.begin() + para_range.start,
+                            label_paragraphs_.begin() + para_range.end);
+    label_paragraphs_.insert(label_paragraphs_.begin() + para_range.start,
+                             std::make_move_iterator(new_paragraphs.begin()),
+                             std::make_move_iterator(new_paragraphs.end()));
+
+    // Shift the following paragraphs. Their layout is relative, so it's kept.
+    int64_t glyph_delta = (int64_t)new_glyph_count - (int64_t)(glyph_end - glyph_start);
+
+    for (size_t i = para_range.start + new_paragraphs.size(); i < label_paragraphs_.size(); i++) {
+        auto &label_para = label_paragraphs_[i];
+        label_para.glyph_start += glyph_delta;
+        label_para.text_range = {label_para.text_range.start + text_length_delta,
+                                 label_para.text_range.end + text_length_delta};
+    }
+
+    glyphs_dirty_ = true;
 }
 
 std::string Label::get_sub_text(uint32_t codepint_position, uint32_t count) const {
@@ -271,10 +277,15 @@ std::string Label::get_sub_text(uint32_t codepint_position, uint32_t count) cons
 }
 
 std::string Label::get_text() const {
+    if (text_is_dirty_) {
+        text_ = utf32_to_utf8(text_u32_);
+        text_is_dirty_ = false;
+    }
+
     return text_;
 }
 
-std::u32string Label::get_text_u32() const {
+const std::u32string &Label::get_text_u32() const {
     return text_u32_;
 }
 
@@ -288,144 +299,227 @@ void Label::set_size(Vec2F new_size) {
     size = new_size.max(get_effective_minimum_size());
 }
 
-/// A very crude way for line-breaking.
-std::vector<LayoutGlyph> convert_to_in_context_glyphs(const std::vector<Glyph> &glyphs,
-                                                      const std::vector<Line> &paragraphs) {
-    std::vector<LayoutGlyph> in_context_glyphs;
-    in_context_glyphs.resize(glyphs.size());
-
-    // Add line-breaking info.
-    for (auto &para : paragraphs)
-        for (int glyph_idx = para.glyph_ranges.start; glyph_idx < para.glyph_ranges.end; glyph_idx++) {
-            const auto &glyph = glyphs[glyph_idx];
-
-            LayoutGlyph in_context_glyph;
-            in_context_glyph.glyph_ = glyph;
-            in_context_glyph.line_breakable_ = false;
-
-            if (glyph.script == Script::Cjk) {
-                in_context_glyph.line_breakable_ = true;
-            } else {
-                if (para.rtl) {
-                    if (glyph_idx < para.glyph_ranges.end - 1) {
-                        auto &previous_glyph = glyphs[glyph_idx + 1];
-                        if (previous_glyph.text == " ") {
-                            in_context_glyph.line_breakable_ = true;
-                        }
-                    }
-                } else {
-                    if (glyph_idx > para.glyph_ranges.start) {
-                        auto &previous_glyph = glyphs[glyph_idx - 1];
-                        if (previous_glyph.text == " ") {
-                            in_context_glyph.line_breakable_ = true;
-                        }
-                    }
-                }
-            }
+void Label::measure() {
+    LabelShapingResult shaped;
+    shape_text(shaped);
+    commit_shaping(std::move(shaped));
+}
 
-            in_context_glyphs[glyph_idx] = in_context_glyph;
-        }
+void Label::shape_text(LabelShapingResult &result) const {
+    shape_paragraphs({0, text_u32_.size()}, result);
+}
+
+void Label::commit_shaping(LabelShapingResult &&result) {
+    label_paragraphs_ = std::move(result.paragraphs);
+    glyphs_dirty_ = true;
 
-    return in_context_glyphs;
+    need_to_remeasure = false;
+    layout_is_dirty = true;
+    mark_layout_dirty();
 }
 
-void Label::measure() {
-    font->get_glyphs(text_, font_size_, glyphs_, paragraphs_);
-
-    // Add emoji data.
-    if (emoji_font && emoji_font->is_valid()) {
-        for (auto &glyph : glyphs_) {
-            if (glyph.codepoints.size() == 1 && glyph.index == 0) {
-                uint16_t glyph_index = emoji_font->find_glyph_index_by_codepoint(glyph.codepoints.front());
-                if (glyph_index == 0) {
-                    continue;
-                }
-                glyph.emoji = true;
+void Label::add_emoji_data(std::vector<LabelParagraph> &label_paragraphs) const {
+    if (!emoji_font || !emoji_font->is_valid()) {
+        return;
+    }
 
-                glyph.svg = emoji_font->get_glyph_svg(glyph_index);
-                if (!glyph.svg.empty() && glyph.index == 0) {
-                    glyph.x_advance = font_size_;
-                    glyph.box = {0, 0, (float)font_size_, (float)font_size_};
-                }
+    for (auto &label_para : label_paragraphs) {
+        const auto &glyphs = label_para.shaped->glyphs;
+        auto para_text_start = label_para.text_range.start;
+
+        // Copy of the shared glyphs, made on the first change.
+        std::shared_ptr<ShapedParagraph> own_shaped;
+
+        for (size_t i = 0; i < glyphs.size(); i++) {
+            if (glyphs.cluster_ends[i] - glyphs.cluster_starts[i] != 1 || glyphs.glyph_indices[i] != 0) {
+                continue;
+            }
+
+            auto codepoint = text_u32_[para_text_start + glyphs.cluster_starts[i]];
+            uint16_t glyph_index = emoji_font->find_glyph_index_by_codepoint(codepoint);
+            if (glyph_index == 0 || !emoji_font->has_glyph_svg(glyph_index)) {
+                continue;
+            }
+
+            if (!own_shaped) {
+                own_shaped = std::make_shared<ShapedParagraph>(*label_para.shaped);
             }
+            auto &own_glyphs = own_shaped->glyphs;
+
+            // Keep the baseline of the replaced glyph.
+            auto emoji_run_font = glyphs.get_font(i);
+            emoji_run_font.font = emoji_font;
+            emoji_run_font.font_id = emoji_font->get_id();
+            emoji_run_font.font_size = font_size_;
+
+            own_glyphs.glyph_indices[i] = glyph_index;
+            own_glyphs.font_indices[i] = own_glyphs.add_font(emoji_run_font);
+            own_glyphs.x_advances[i] = font_size_;
+            own_glyphs.set_flag(i, GlyphRun::FLAG_EMOJI, true);
         }
-    }
 
-    layout_glyphs_ = convert_to_in_context_glyphs(glyphs_, paragraphs_);
+        if (own_shaped) {
+            label_para.shaped = std::move(own_shaped);
+        }
+    }
 }
 
 void Label::make_layout() {
-    // Reset text's layout box.
-    layout_box = RectF();
-
-    glyph_positions.clear();
-
     glyph_boxes.clear();
     character_boxes.clear();
 
     float line_height = font_size_;
 
-    float cursor_x = 0;
-    float cursor_y = 0;
+    // Without word wrap, each paragraph is a single line.
+    float wrap_width = word_wrap_ ? size.x : std::numeric_limits<float>::infinity();
+
+    // Only rewrap paragraphs that have been reshaped or whose wrap width has changed.
+    line_count_ = 0;
+    max_line_width_ = 0;
+
+    for (auto &label_para : label_paragraphs_) {
+        if (label_para.wrap_width != wrap_width) {
+            wrap_paragraph(wrap_width,
+                           label_para.shaped->line,
+                           label_para.shaped->glyphs,
+                           label_para.advance_sums,
+                           label_para.wrapped_lines);
+            label_para.wrap_width = wrap_width;
+            label_para.layout_dirty = true;
+
+            label_para.max_line_width = 0;
+            label_para.has_rtl_lines = false;
+            for (const auto &line : label_para.wrapped_lines) {
+                label_para.max_line_width = std::max(label_para.max_line_width, line.width);
+                label_para.has_rtl_lines |= line.rtl;
+            }
+        }
 
-    if (word_wrap_) {
-        Vec2F text_size{};
-        lines_ = get_lines_with_word_wrap(size.x, paragraphs_, layout_glyphs_, text_size);
+        line_count_ += label_para.wrapped_lines.size();
+        max_line_width_ = std::max(max_line_width_, label_para.max_line_width);
     }
 
-    const auto &effective_line_ranges = word_wrap_ ? lines_ : paragraphs_;
+    // Lines are aligned in the widest line without word wrap, so they move when it changes. With auto alignment,
+    // only RTL lines do.
+    float align_width = word_wrap_ ? size.x : max_line_width_;
 
-    float effective_max_line_width = 0;
-    if (word_wrap_) {
-        effective_max_line_width = size.x;
-    } else {
-        for (const auto &line : effective_line_ranges) {
-            effective_max_line_width = std::max(effective_max_line_width, line.width);
+    if (align_width != layout_align_width_ && bidi_alignment_ != BidiAlignment::Begin) {
+        for (auto &label_para : label_paragraphs_) {
+            if (bidi_alignment_ != BidiAlignment::Auto || label_para.has_rtl_lines) {
+                label_para.layout_dirty = true;
+            }
+        }
+    }
+    layout_align_width_ = align_width;
+
+    // Reset text's layout box.
+    layout_box = RectF();
+
+    // Paragraphs moved by the lines added or removed before them keep their layout, which is relative.
+    uint32_t first_line = 0;
+
+    for (auto &label_para : label_paragraphs_) {
+        if (label_para.layout_dirty) {
+            layout_paragraph(label_para, align_width);
+        }
+
+        label_para.first_line = first_line;
+
+        // The whole text's layout box.
+        if (!label_para.shaped->glyphs.empty()) {
+            layout_box = layout_box.union_rect(label_para.layout_box + Vec2F(0, first_line * line_height));
         }
+
+        first_line += label_para.wrapped_lines.size();
     }
+}
 
-    glyph_positions.resize(glyphs_.size());
+void Label::layout_paragraph(LabelParagraph &label_para, float align_width) {
+    const auto &glyphs = label_para.shaped->glyphs;
 
-    // Build layout.
-    for (const auto &line : effective_line_ranges) {
-        const auto &range = line.glyph_ranges;
+    float line_height = font_size_;
+
+    label_para.glyph_positions.resize(glyphs.size());
+    label_para.glyph_left_edges.resize(glyphs.size());
+    label_para.glyph_lines.resize(glyphs.size());
+
+    // Lines of RTL paragraphs don't start with the first glyph.
+    bool has_layout_box = false;
+
+    for (size_t line_idx = 0; line_idx < label_para.wrapped_lines.size(); line_idx++) {
+        const auto &line = label_para.wrapped_lines[line_idx];
+
+        float cursor_x = 0;
+        float cursor_y = line_idx * line_height;
 
         switch (bidi_alignment_) {
             case BidiAlignment::Auto: {
                 if (line.rtl) {
-                    cursor_x = effective_max_line_width - line.width;
+                    cursor_x = align_width - line.width;
                 }
             } break;
             case BidiAlignment::Begin: {
             } break;
             case BidiAlignment::Center: {
-                cursor_x = effective_max_line_width * 0.5f - line.width * 0.5f;
+                cursor_x = align_width * 0.5f - line.width * 0.5f;
             } break;
             case BidiAlignment::End: {
-                cursor_x = effective_max_line_width - line.width;
+                cursor_x = align_width - line.width;
             } break;
         }
 
-        for (int i = range.start; i < range.end; i++) {
-            const auto &g = glyphs_[i];
+        for (auto i = line.glyph_ranges.start; i < line.glyph_ranges.end; i++) {
+            float x_offset = glyphs.x_offsets[i];
+            float y_offset = glyphs.y_offsets[i];
+            float x_advance = glyphs.x_advances[i];
 
-            // The glyph's layout box in the text's local coordinates.
-            // The origin is the top-left corner of the text box.
+            // The glyph's layout box relative to the paragraph.
             RectF glyph_layout_box =
-                RectF(cursor_x + g.x_offset, cursor_y + g.y_offset, cursor_x + g.x_advance, cursor_y + line_height);
+                RectF(cursor_x + x_offset, cursor_y + y_offset, cursor_x + x_advance, cursor_y + line_height);
 
-            glyph_positions[i] = {cursor_x + g.x_offset, cursor_y + g.y_offset};
+            label_para.glyph_positions[i] = {cursor_x + x_offset, cursor_y + y_offset};
+            label_para.glyph_left_edges[i] = cursor_x;
+            label_para.glyph_lines[i] = line_idx;
 
-            // The whole text's layout box.
-            layout_box = layout_box.union_rect(glyph_layout_box);
+            label_para.layout_box =
+                has_layout_box ? label_para.layout_box.union_rect(glyph_layout_box) : glyph_layout_box;
+            has_layout_box = true;
 
             // Advance x.
-            cursor_x += g.x_advance;
+            cursor_x += x_advance;
         }
+    }
 
-        cursor_x = 0;
-        cursor_y += line_height;
+    // Map codepoints to the visually first glyph of their clusters. Codepoints without one map to the first glyph.
+    label_para.codepoint_glyphs.assign(label_para.text_range.length(), 0);
+    for (size_t i = glyphs.size(); i > 0; i--) {
+        for (auto c = glyphs.cluster_starts[i - 1]; c < glyphs.cluster_ends[i - 1]; c++) {
+            label_para.codepoint_glyphs[c] = i - 1;
+        }
     }
+
+    label_para.layout_dirty = false;
+}
+
+size_t Label::find_paragraph_by_glyph(size_t glyph_index) const {
+    // The last paragraph starting at or before the glyph.
+    auto iter = std::upper_bound(
+        label_paragraphs_.begin(),
+        label_paragraphs_.end(),
+        glyph_index,
+        [](size_t glyph, const LabelParagraph &para) { return glyph < para.glyph_start; });
+
+    return iter - label_paragraphs_.begin() - 1;
+}
+
+size_t Label::get_glyph_count() const {
+    if (label_paragraphs_.empty()) {
+        return 0;
+    }
+
+    const auto &last_para = label_paragraphs_.back();
+
+    return last_para.glyph_start + last_para.shaped->glyphs.size();
 }
 
 void Label::set_font(std::shared_ptr<Font> new_font) {
@@ -436,6 +530,7 @@ void Label::set_font(std::shared_ptr<Font> new_font) {
     font = std::move(new_font);
 
     need_to_remeasure = true;
+    mark_layout_dirty();
 }
 
 void Label::consider_alignment() {
@@ -472,6 +567,15 @@ void Label::consider_alignment() {
 void Label::update(double dt) {
     NodeUi::update(dt);
 
+    update_layout();
+
+    auto min_size = get_text_minimum_size();
+    size = size.max(min_size);
+
+    consider_alignment();
+}
+
+void Label::update_layout() {
     if (need_to_remeasure) {
         need_to_remeasure = false;
         measure();
@@ -479,17 +583,20 @@ void Label::update(double dt) {
     }
     if (layout_is_dirty) {
         layout_is_dirty = false;
+
+        // Wrapping the text into other lines changes the minimum size.
+        auto old_text_minimum_size = get_text_minimum_size();
         make_layout();
+        queue_redraw();
+        if (get_text_minimum_size() != old_text_minimum_size) {
+            mark_layout_dirty();
+        }
     }
-
-    auto min_size = get_text_minimum_size();
-    size = size.max(min_size);
-
-    consider_alignment();
 }
 
 void Label::set_text_style(TextStyle _text_style) {
     text_style = _text_style;
+    queue_redraw();
 }
 
 void Label::draw() {
@@ -506,13 +613,21 @@ void Label::draw() {
     auto translation = Transform2::from_translation(global_position + alignment_shift);
 
     RectF clip_box;
-    //    if (clip) {
-    //        clip_box = {{}, size};
-    //    } else {
-    //        clip_box = {{}, calc_minimum_size()};
-    //    }
+    if (clip) {
+        // The glyphs are drawn with the alignment shift.
+        clip_box = {-alignment_shift, size - alignment_shift};
+    }
+
+    // The paragraphs are drawn as one text, from the glyphs shared with the shaping cache.
+    float line_height = font_size_;
 
-    vector_server->draw_glyphs(glyphs_, glyph_positions, text_style, translation, clip_box, alpha);
+    placed_glyph_runs_.clear();
+    for (const auto &label_para : label_paragraphs_) {
+        placed_glyph_runs_.push_back(
+            {&label_para.shaped->glyphs, &label_para.glyph_positions, Vec2F(0, label_para.first_line * line_height)});
+    }
+
+    vector_server->draw_glyph_runs(placed_glyph_runs_, text_style, translation, clip_box, alpha);
 
     NodeUi::draw();
 }
@@ -523,6 +638,7 @@ void Label::set_horizontal_alignment(Alignment alignment) {
     }
 
     horizontal_alignment = alignment;
+    queue_redraw();
 }
 
 void Label::set_vertical_alignment(Alignment alignment) {
@@ -531,6 +647,7 @@ void Label::set_vertical_alignment(Alignment alignment) {
     }
 
     vertical_alignment = alignment;
+    queue_redraw();
 }
 
 void Label::calc_minimum_size() {
@@ -543,15 +660,8 @@ void Label::calc_minimum_size() {
 }
 
 Vec2F Label::get_text_minimum_size() const {
-    float effective_max_para_width = 0;
-
-    const auto &effecttive_lines = word_wrap_ ? lines_ : paragraphs_;
-
-    for (const auto &line : effecttive_lines) {
-        effective_max_para_width = std::max(effective_max_para_width, line.width);
-    }
-
-    Vec2F text_bbox = {effective_max_para_width, effecttive_lines.size() * (float)font_size_};
+    // As of the last layout.
+    Vec2F text_bbox = {max_line_width_, line_count_ * (float)font_size_};
 
     if (word_wrap_) {
         return Vec2F(0, text_bbox.y);
@@ -560,7 +670,17 @@ Vec2F Label::get_text_minimum_size() const {
     return text_bbox;
 }
 
-std::vector<Glyph> &Label::get_glyphs() {
+const GlyphRun &Label::get_glyph_run() const {
+    // Concatenate the glyphs of the paragraphs.
+    if (glyphs_dirty_) {
+        glyphs_.clear();
+        for (const auto &label_para : label_paragraphs_) {
+            glyphs_.splice(glyphs_.size(), glyphs_.size(), label_para.shaped->glyphs);
+        }
+
+        glyphs_dirty_ = false;
+    }
+
     return glyphs_;
 }
 
@@ -570,57 +690,194 @@ std::shared_ptr<Font> Label::get_font() const {
 
 float Label::get_glyph_right_edge_position(int32_t glyph_index) {
     assert(glyph_index >= 0 && "Invalid glyph index!");
+    assert((size_t)glyph_index < get_glyph_count() && "Out of bounds glyph index!");
 
-    float pos = 0;
+    update_layout();
 
-    assert(glyph_index < glyphs_.size() && "Out of bounds glyph index!");
-
-    for (int i = 0; i <= glyph_index; i++) {
-        pos += glyphs_[i].x_advance;
-    }
+    const auto &label_para = label_paragraphs_[find_paragraph_by_glyph(glyph_index)];
+    auto para_glyph_index = glyph_index - label_para.glyph_start;
 
-    return pos;
+    return label_para.glyph_left_edges[para_glyph_index] + label_para.shaped->glyphs.x_advances[para_glyph_index];
 }
 
 float Label::get_glyph_left_edge_position(int32_t glyph_index) {
     assert(glyph_index >= 0 && "Invalid glyph index!");
+    assert((size_t)glyph_index < get_glyph_count() && "Out of bounds glyph index!");
 
-    float pos = 0;
+    update_layout();
 
-    for (int i = 0; i < glyph_index; i++) {
-        pos += glyphs_[i].x_advance;
-    }
+    const auto &label_para = label_paragraphs_[find_paragraph_by_glyph(glyph_index)];
 
-    return pos;
+    return label_para.glyph_left_edges[glyph_index - label_para.glyph_start];
 }
 
 float Label::get_codepoint_right_edge_position(int32_t codepoint_index) {
     assert(codepoint_index >= 0 && "Invalid codepoint index!");
+    assert((size_t)codepoint_index < text_u32_.size() && "Out of bounds codepoint index!");
 
-    float pos = 0;
+    update_layout();
 
-    int32_t glyph_group_start = 0;
-    int32_t glyph_group_size = 0;
+    auto para_idx = find_paragraph(codepoint_index);
+    const auto &label_para = label_paragraphs_[para_idx];
 
-    for (int i = 0; i < glyphs_.size(); i++) {
-        const auto &glyph = glyphs_[i];
+    if (label_para.shaped->glyphs.size() == 0) {
+        return 0;
+    }
 
-        if (codepoint_index >= glyph.start && codepoint_index < glyph.end) {
-            glyph_group_start = i;
-            glyph_group_size = codepoint_index - glyph.start + 1;
-            break;
-        }
+    uint32_t line;
+    auto box = get_cluster_box(para_idx, label_para.codepoint_glyphs[codepoint_index - label_para.text_range.start]);
+
+    // The right edge is the trailing edge in LTR text.
+    return get_codepoint_edge_position(codepoint_index, !box.rtl, line);
+}
+
+Label::ClusterBox Label::get_cluster_box(size_t para_idx, size_t glyph_index) const {
+    const auto &label_para = label_paragraphs_[para_idx];
+    const auto &glyphs = label_para.shaped->glyphs;
+    const auto &glyph_lines = label_para.glyph_lines;
+
+    auto cluster_start = glyphs.cluster_starts[glyph_index];
+    uint32_t line = glyph_lines[glyph_index];
+
+    auto in_cluster = [&](size_t i) {
+        return glyphs.cluster_starts[i] == cluster_start && glyph_lines[i] == line;
+    };
+
+    // Glyphs of a cluster are adjacent.
+    size_t first = glyph_index;
+    while (first > 0 && in_cluster(first - 1)) {
+        first--;
+    }
+    size_t last = glyph_index;
+    while (last + 1 < glyphs.size() && in_cluster(last + 1)) {
+        last++;
     }
 
-    for (int i = 0; i < glyphs_.size(); i++) {
-        const auto &glyph = glyphs_[i];
+    auto para_text_start = label_para.text_range.start;
 
-        if (i < (glyph_group_start + glyph_group_size)) {
-            pos += glyph.x_advance;
-        }
+    ClusterBox box;
+    box.text_range = {para_text_start + cluster_start, para_text_start + glyphs.cluster_ends[glyph_index]};
+    box.left = label_para.glyph_left_edges[first];
+    box.width = label_para.glyph_left_edges[last] + glyphs.x_advances[last] - box.left;
+    box.line = label_para.first_line + line;
+
+    // Clusters decrease along RTL runs.
+    if (last + 1 < glyphs.size() && glyph_lines[last + 1] == line) {
+        box.rtl = glyphs.cluster_starts[last + 1] < cluster_start;
+    } else if (first > 0 && glyph_lines[first - 1] == line) {
+        box.rtl = glyphs.cluster_starts[first - 1] > cluster_start;
+    } else {
+        box.rtl = label_para.shaped->line.rtl;
+    }
+
+    return box;
+}
+
+float Label::get_codepoint_edge_position(uint32_t codepoint_index, bool trailing, uint32_t &line) const {
+    auto para_idx = find_paragraph(codepoint_index);
+    const auto &label_para = label_paragraphs_[para_idx];
+
+    // A paragraph without glyphs, e.g. if the font has none for its text, has nothing to measure.
+    if (label_para.shaped->glyphs.size() == 0) {
+        line = label_para.first_line;
+        return 0;
+    }
+
+    auto box = get_cluster_box(para_idx, label_para.codepoint_glyphs[codepoint_index - label_para.text_range.start]);
+    line = box.line;
+
+    // Codepoints in a cluster (e.g. a ligature) divide it evenly.
+    float fraction = float(codepoint_index - box.text_range.start + (trailing ? 1 : 0)) / box.text_range.length();
+
+    return box.rtl ? box.left + box.width * (1 - fraction) : box.left + box.width * fraction;
+}
+
+Vec2F Label::get_caret_position(uint32_t caret_index) {
+    update_layout();
+
+    if (text_u32_.empty()) {
+        return {};
+    }
+
+    caret_index = std::min(caret_index, (uint32_t)text_u32_.size());
+
+    float line_height = font_size_;
+    uint32_t line = 0;
+    float x;
+
+    if (caret_index == 0) {
+        x = get_codepoint_edge_position(0, false, line);
+    } else if (text_u32_[caret_index - 1] != '\n') {
+        x = get_codepoint_edge_position(caret_index - 1, true, line);
+    } else if (caret_index < text_u32_.size()) {
+        // After a line break, the caret is at the start of the next line.
+        x = get_codepoint_edge_position(caret_index, false, line);
+    } else {
+        // There are no glyphs after a trailing line break.
+        get_codepoint_edge_position(caret_index - 1, false, line);
+        return {0, (line + 1) * line_height};
+    }
+
+    return {x, line * line_height};
+}
+
+uint32_t Label::get_caret_index(Vec2F position) {
+    update_layout();
+
+    if (line_count_ == 0 || get_glyph_count() == 0) {
+        return 0;
+    }
+
+    float line_height = font_size_;
+
+    // Lines have the same height.
+    int32_t line_idx = std::floor(position.y / line_height);
+
+    // The line after a trailing line break has no glyphs.
+    if (line_idx >= (int32_t)line_count_ && text_u32_.back() == '\n') {
+        return text_u32_.size();
+    }
+
+    line_idx = std::clamp(line_idx, 0, (int32_t)line_count_ - 1);
+
+    // The paragraph containing the line.
+    auto para_iter = std::upper_bound(
+                         label_paragraphs_.begin(),
+                         label_paragraphs_.end(),
+                         (uint32_t)line_idx,
+                         [](uint32_t line, const LabelParagraph &para) { return line < para.first_line; }) -
+                     1;
+    const auto &label_para = *para_iter;
+
+    // A line without glyphs only has the caret stop at the start of its paragraph.
+    const auto &range = label_para.wrapped_lines[line_idx - label_para.first_line].glyph_ranges;
+    if (range.length() == 0) {
+        return label_para.text_range.start;
+    }
+
+    // The last glyph starting at or before the position.
+    const auto &left_edges = label_para.glyph_left_edges;
+    auto edges_begin = left_edges.begin() + range.start;
+    auto iter = std::upper_bound(edges_begin, left_edges.begin() + range.end, position.x);
+    size_t glyph = range.start + std::max<ptrdiff_t>(iter - edges_begin - 1, 0);
+
+    auto box = get_cluster_box(para_iter - label_paragraphs_.begin(), glyph);
+
+    // The closest caret stop between the codepoints of the cluster.
+    uint32_t codepoint_count = box.text_range.length();
+    float fraction = box.width > 0 ? (position.x - box.left) / box.width : 0;
+    uint32_t offset = std::clamp<int32_t>(std::round(fraction * codepoint_count), 0, codepoint_count);
+    if (box.rtl) {
+        offset = codepoint_count - offset;
+    }
+
+    uint32_t caret_index = box.text_range.start + offset;
+
+    if (caret_index > box.text_range.start && text_u32_[caret_index - 1] == '\n') {
+        caret_index--;
     }
 
-    return pos;
+    return caret_index;
 }
 
 } // namespace Flint
@@ -27,11 +27,66 @@ enum class Alignment {
     End,
 };
 
-struct LayoutGlyph {
-    Glyph glyph_;
-    bool line_breakable_ = false;
+/// Bookkeeping for a paragraph of the label text, so that an edit only reshapes and lays out the paragraphs it
+/// touches.
+struct LabelParagraph {
+    /// Codepoint range in the text, including the trailing line break.
+    Pathfinder::Range text_range;
+
+    /// Index of the paragraph's first glyph in the label's glyphs.
+    size_t glyph_start = 0;
+
+    /// Shaped glyphs, shared with the font's shaping cache. Replaced by a copy if any glyph is changed, e.g. by
+    /// emoji substitution.
+    std::shared_ptr<const ShapedParagraph> shaped;
+
+    /// Prefix sums of the glyph advances in visual order, with one more element than the glyphs.
+    std::vector<float> advance_sums;
+
+    /// Wrapped lines with glyph ranges relative to the paragraph. Only valid for the wrap width, which is infinite
+    /// without word wrap.
+    std::vector<Line> wrapped_lines;
+    float wrap_width = -1;
+    float max_line_width = 0;
+    /// If any of the wrapped lines is RTL, which moves with the align width.
+    bool has_rtl_lines = false;
+
+    /// Index of the paragraph's first line in the layout.
+    uint32_t first_line = 0;
+
+    /// Union of the glyph layout boxes, relative to the top of the paragraph's first line.
+    RectF layout_box;
+
+    /// If the glyphs of the paragraph have to be laid out again, e.g. after reshaping or rewrapping.
+    bool layout_dirty = true;
+
+    // Layout of the glyphs, relative to the top of the paragraph's first line, so that it's kept when the paragraph
+    // moves to other lines.
+    std::vector<Vec2F> glyph_positions;
+    // Left edge of each glyph's advance, which increases along a line.
+    std::vector<float> glyph_left_edges;
+    // Line index of each glyph in the paragraph.
+    std::vector<uint32_t> glyph_lines;
+    // Visually first glyph of the cluster containing each codepoint of the paragraph.
+    std::vector<uint32_t> codepoint_glyphs;
 };
 
+/// Shaped text of a label, which can be produced away from the label, e.g. on a worker thread.
+struct LabelShapingResult {
+    /// Glyph starts are relative to the result.
+    std::vector<LabelParagraph> paragraphs;
+};
+
+/// Break a paragraph into lines no wider than the limit, greedily at the break opportunities marked at shaping.
+/// Runs in linear time and doesn't allocate once `lines` has grown to its capacity.
+/// @param advance_sums Prefix sums of the paragraph's glyph advances in visual order.
+/// @param lines Wrapped lines with glyph ranges relative to the paragraph.
+void wrap_paragraph(float limited_width,
+                    const Line &para,
+                    const GlyphRun &glyphs,
+                    const std::vector<float> &advance_sums,
+                    std::vector<Line> &lines);
+
 class Label : public NodeUi {
 public:
     Label();
@@ -45,7 +100,7 @@ public:
 
     std::string get_text() const;
 
-    std::u32string get_text_u32() const;
+    const std::u32string &get_text_u32() const;
 
     void insert_text(uint32_t codepint_position, const std::string &new_text);
 
@@ -58,7 +113,13 @@ public:
     void set_font(std::shared_ptr<Font> new_font);
 
     void set_font_size(uint32_t new_font_size) {
+        if (font_size_ == new_font_size) {
+            return;
+        }
+
         font_size_ = new_font_size;
+        need_to_remeasure = true;
+        mark_layout_dirty();
     }
 
     uint32_t get_font_size() const {
@@ -77,10 +138,12 @@ public:
 
     void calc_minimum_size() override;
 
-    std::vector<Glyph> &get_glyphs();
+    const GlyphRun &get_glyph_run() const;
 
     std::shared_ptr<Font> get_font() const;
 
+    /// Positions below are in the text's local coordinates, before alignment.
+
     float get_glyph_left_edge_position(int32_t glyph_index);
 
     float get_glyph_right_edge_position(int32_t glyph_index);
@@ -88,33 +151,107 @@ public:
     /// Get the caret position of a given codepoint index.
     float get_codepoint_right_edge_position(int32_t codepoint_index);
 
+    /// Position of a caret before the codepoint index. The Y is the top of the caret's line.
+    /// The index may be the codepoint count, which puts the caret at the end of the text.
+    Vec2F get_caret_position(uint32_t caret_index);
+
+    /// The caret index closest to a point, which is never after a line break.
+    uint32_t get_caret_index(Vec2F position);
+
     bool get_word_wrap() const {
         return word_wrap_;
     }
 
     void set_word_wrap(bool word_wrap) {
+        if (word_wrap_ == word_wrap) {
+            return;
+        }
+
         word_wrap_ = word_wrap;
+        layout_is_dirty = true;
+        mark_layout_dirty();
     }
 
     void set_multi_line(bool enabled) {
         multi_line_ = enabled;
     }
 
+    /// Hide the glyphs outside the label's rect.
+    void set_clip(bool enabled) {
+        clip = enabled;
+    }
+
+    /// If the whole text is waiting to be shaped.
+    bool is_remeasure_pending() const {
+        return need_to_remeasure;
+    }
+
+    /// Shape the whole text without changing the label. Safe to call from other threads,
+    /// as long as the label isn't changed meanwhile.
+    void shape_text(LabelShapingResult &result) const;
+
+    /// Take a result of shape_text as the label's shaped text.
+    void commit_shaping(LabelShapingResult &&result);
+
     StyleBox theme_background;
 
 private:
     void measure();
 
+    /// Replace `count` codepoints at the position with new text, reshaping only the affected paragraphs.
+    void replace_text(uint32_t codepoint_position, uint32_t count, const std::u32string &new_text_u32);
+
+    /// Shape the text in the codepoint range as new paragraphs, replacing the paragraphs in the paragraph range.
+    void reshape_paragraphs(Pathfinder::Range para_range, Pathfinder::Range text_range, int64_t text_length_delta);
+
+    /// Shape the text in the codepoint range, which consists of whole paragraphs.
+    void shape_paragraphs(Pathfinder::Range text_range, LabelShapingResult &result) const;
+
+    /// Index of the paragraph containing the codepoint position. Returns the paragraph count if there's none.
+    size_t find_paragraph(uint32_t codepoint_position) const;
+
+    /// Index of the paragraph containing the glyph.
+    size_t find_paragraph_by_glyph(size_t glyph_index) const;
+
+    size_t get_glyph_count() const;
+
+    /// Replace glyphs missing from the font with the emoji font's glyphs.
+    void add_emoji_data(std::vector<LabelParagraph> &label_paragraphs) const;
+
+    /// Remeasure and lay out the text if needed.
+    void update_layout();
+
+    /// Lay out the paragraphs which have changed, and move the following ones by the lines added or removed.
     void make_layout();
 
+    /// Lay out the glyphs of a paragraph relative to its first line.
+    void layout_paragraph(LabelParagraph &label_para, float align_width);
+
+    /// Visual extent of the cluster containing a glyph, within the glyph's line.
+    struct ClusterBox {
+        /// Codepoint range in the text.
+        Pathfinder::Range text_range;
+        float left = 0;
+        float width = 0;
+        bool rtl = false;
+        uint32_t line = 0;
+    };
+
+    /// @param glyph_index Glyph index in the paragraph.
+    ClusterBox get_cluster_box(size_t para_idx, size_t glyph_index) const;
+
+    /// X of a codepoint's leading or trailing edge, in reading order.
+    float get_codepoint_edge_position(uint32_t codepoint_index, bool trailing, uint32_t &line) const;
+
     void consider_alignment();
 
     /// The minimum size of the text box, which is determined by the text content.
     Vec2F get_text_minimum_size() const;
 
 private:
-    // Raw text.
-    std::string text_;
+    // Raw text. Rebuilt from text_u32_ lazily after edits.
+    mutable std::string text_;
+    mutable bool text_is_dirty_ = false;
     // Codepoint separated text.
     std::u32string text_u32_;
 
@@ -132,18 +269,20 @@ private:
     bool word_wrap_ = false;
 
     // Layout-independent. Glyph count will not necessarily be the same as the character count.
-    std::vector<Glyph> glyphs_;
+    // The glyphs are kept in the paragraphs, and only concatenated on request by get_glyph_run().
+    mutable GlyphRun glyphs_;
+    mutable bool glyphs_dirty_ = true;
 
-    std::vector<LayoutGlyph> layout_glyphs_;
+    std::vector<LabelParagraph> label_paragraphs_;
 
-    // Layout-dependent. Ranges for glyphs, not for characters.
-    std::vector<Line> paragraphs_;
+    // Layout-dependent. Wrapped lines are kept in the paragraphs.
+    uint32_t line_count_ = 0;
+    float max_line_width_ = 0;
+    // Width the lines are aligned in.
+    float layout_align_width_ = -1;
 
-    // If word_wrap is enabled, use this instead of para_ranges.
-    std::vector<Line> lines_;
-
-    // Layout-dependent.
-    std::vector<Vec2F> glyph_positions;
+    // Scratch buffer of the paragraphs to draw.
+    std::vector<PlacedGlyphRun> placed_glyph_runs_;
 
     mutable RectF layout_box;
 
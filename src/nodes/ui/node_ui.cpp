@@ -2,6 +2,7 @@
 
 #include "../../common/geometry.h"
 #include "../../resources/default_resource.h"
+#include "../../servers/engine.h"
 #include "../scene_tree.h"
 
 using Pathfinder::Rect;
@@ -17,7 +18,6 @@ NodeUi::NodeUi() {
     debug_size_box.corner_radius = 0;
 }
 
-/// Runs once per frame.
 void NodeUi::calc_minimum_size() {
     calculated_minimum_size = {};
 }
@@ -41,6 +41,10 @@ void NodeUi::calc_minimum_size_recursively() {
     calc_minimum_size();
 }
 
+RectF NodeUi::get_redraw_rect() const {
+    return RectF(calculated_glocal_position, calculated_glocal_position + size).dilate(REDRAW_MARGIN);
+}
+
 Vec2F NodeUi::get_effective_minimum_size() const {
     // Take both custom_minimum_size and calculated_minimum_size into account.
     return custom_minimum_size.max(calculated_minimum_size);
@@ -119,6 +123,11 @@ void NodeUi::input(InputEvent &event) {
     Node::input(event);
 }
 
+bool NodeUi::wants_mouse_input_outside_rect() const {
+    return type == NodeType::NodeUi || is_cursor_inside || is_pressed_inside || focused ||
+           !callbacks_focus_released.empty();
+}
+
 Vec2F NodeUi::get_global_position() const {
     return calculated_glocal_position;
 }
@@ -132,7 +141,12 @@ void NodeUi::set_mouse_filter(MouseFilter filter) {
 }
 
 void NodeUi::set_position(Vec2F new_position) {
+    if (position == new_position) {
+        return;
+    }
+
     position = new_position;
+    Engine::get_singleton()->request_redraw();
 }
 
 void NodeUi::set_size(Vec2F new_size) {
@@ -141,6 +155,7 @@ void NodeUi::set_size(Vec2F new_size) {
     }
 
     size = new_size.max(get_effective_minimum_size());
+    Engine::get_singleton()->request_redraw();
 }
 
 Vec2F NodeUi::get_position() const {
@@ -152,7 +167,11 @@ Vec2F NodeUi::get_size() const {
 }
 
 void NodeUi::set_custom_minimum_size(Vec2F new_size) {
+    if (custom_minimum_size == new_size) {
+        return;
+    }
     custom_minimum_size = new_size;
+    mark_layout_dirty();
 }
 
 Vec2F NodeUi::get_custom_minimum_size() const {
@@ -165,6 +184,7 @@ Vec2F NodeUi::get_local_mouse_position() const {
 
 void NodeUi::grab_focus() {
     focused = true;
+    queue_redraw();
 }
 
 void NodeUi::release_focus() {
@@ -177,6 +197,7 @@ void NodeUi::release_focus() {
     }
 
     focused = false;
+    queue_redraw();
 }
 
 ColorU NodeUi::get_global_modulate() {
@@ -84,7 +84,8 @@ public:
 
     Vec2F get_effective_minimum_size() const;
 
-    /// Runs once per frame.
+    /// Runs in the frames in which the node has been marked dirty.
+    /// Overrides have to call mark_layout_dirty() when anything they depend on changes.
     virtual void calc_minimum_size();
 
     /// Only for secondary (off-tree) nodes.
@@ -98,10 +99,21 @@ public:
 
     void calc_global_position(Vec2F parent_global_position);
 
+    /// The global rect, extended by the margin.
+    RectF get_redraw_rect() const override;
+
+    /// Borders and anti-aliasing reach a bit outside of the nodes.
+    static constexpr float REDRAW_MARGIN = 4;
+
     virtual bool ignore_mouse_input_outside_rect() const {
         return false;
     }
 
+    /// If the node needs the next mouse events outside its rect too, e.g. to end a hover, a drag or the focus.
+    /// Mouse events only reach the nodes under the cursor and these ones, see InputHitIndex. Plain UI nodes always
+    /// want them, as their custom input may handle clicks anywhere.
+    virtual bool wants_mouse_input_outside_rect() const;
+
     virtual void draw();
 
     void set_mouse_filter(MouseFilter filter);
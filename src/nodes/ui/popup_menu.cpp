@@ -134,7 +134,8 @@ void PopupMenu::input(InputEvent &event) {
 }
 
 void PopupMenu::set_visibility(bool visible) {
-    visible_ = visible;
+    Node::set_visibility(visible);
+
     if (visible_) {
         // TODO: we should not do this manually in here.
         margin_container_->calc_minimum_size_recursively();
@@ -69,6 +69,8 @@ void ProgressBar::set_value(float new_value) {
     ratio = (value - min_value) / (max_value - min_value);
 
     label->set_text(std::to_string((int)round(ratio * 100)) + "%");
+
+    queue_redraw();
 }
 
 float ProgressBar::get_value() const {
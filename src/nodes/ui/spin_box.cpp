@@ -46,6 +46,8 @@ void SpinBox::input(InputEvent &event) {
     auto global_position = get_global_position();
     auto active_rect = RectF(global_position, global_position + size);
 
+    bool was_focused = focused;
+
     bool consume_flag = false;
 
     if (event.type == InputEventType::MouseMotion) {
@@ -101,9 +103,18 @@ void SpinBox::input(InputEvent &event) {
         }
     }
 
+    if (focused != was_focused) {
+        queue_redraw();
+    }
+
     NodeUi::input(event);
 }
 
+bool SpinBox::wants_mouse_input_outside_rect() const {
+    // Dragging adjusts the value wherever the cursor is.
+    return pressed_inside || focused || NodeUi::wants_mouse_input_outside_rect();
+}
+
 void SpinBox::update(double dt) {
     NodeUi::update(dt);
 }
@@ -27,6 +27,8 @@ public:
 
     void input(InputEvent& event) override;
 
+    bool wants_mouse_input_outside_rect() const override;
+
     void update(double dt) override;
 
     void draw() override;
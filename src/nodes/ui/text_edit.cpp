@@ -2,7 +2,9 @@
 
 #include <string>
 
+#include "../../common/utf.h"
 #include "../../common/utils.h"
+#include "../../servers/engine.h"
 #include "../../servers/input_server.h"
 #include "container/margin_container.h"
 
@@ -60,10 +62,14 @@ void TextEdit::input(InputEvent &event) {
     // Handle mouse input propagation.
     bool consume_flag = false;
 
-    int32_t codepoint_count = label->get_text_u32().size();
+    auto codepoint_count = (uint32_t)label->get_text_u32().size();
 
     auto global_position = get_global_position();
 
+    bool was_focused = focused;
+    auto old_caret_index = current_caret_index;
+    auto old_selection_start_index = selection_start_index;
+
     auto active_rect = RectF(global_position, global_position + size);
 
     switch (event.type) {
@@ -114,7 +120,7 @@ void TextEdit::input(InputEvent &event) {
                     delete_selection();
                 }
 
-                label->insert_text(current_caret_index, cpp11_codepoint_to_utf8(event.args.text.codepoint));
+                label->insert_text(current_caret_index, codepoint_to_utf8(event.args.text.codepoint));
 
                 current_caret_index++;
                 selection_start_index = current_caret_index;
@@ -195,7 +201,7 @@ void TextEdit::input(InputEvent &event) {
                     }
                     auto clipboard_text = input_server->get_clipboard(get_window_index());
                     std::u32string clipboard_text_u32;
-                    utf8_to_utf16(clipboard_text, clipboard_text_u32);
+                    utf8_to_utf32(clipboard_text, clipboard_text_u32);
                     label->insert_text(current_caret_index, clipboard_text);
                     current_caret_index += clipboard_text_u32.size();
                     selection_start_index = current_caret_index;
@@ -214,6 +220,18 @@ void TextEdit::input(InputEvent &event) {
             break;
     }
 
+    // The text is redrawn by the label. Selection boxes and the focus style cover the whole node, but a moved
+    // caret only needs its old and new areas.
+    bool caret_moved = current_caret_index != old_caret_index || selection_start_index != old_selection_start_index;
+    bool had_selection = old_selection_start_index != old_caret_index;
+    bool has_selection = selection_start_index != current_caret_index;
+
+    if (focused != was_focused || (caret_moved && (had_selection || has_selection))) {
+        queue_redraw();
+    } else if (caret_moved) {
+        queue_caret_redraw();
+    }
+
     NodeUi::input(event);
 
     if (consume_flag) {
@@ -227,6 +245,19 @@ void TextEdit::update(double dt) {
     margin_container->set_size(size);
 
     caret_blink_timer += dt;
+
+    // Draw again when the caret blinks, which is when the phase passes a multiple of pi.
+    if (focused && editable) {
+        float blink_period = Pathfinder::PI / CARET_BLINK_SPEED;
+        float next_blink_time = (std::floor(caret_blink_timer / blink_period) + 1) * blink_period;
+        Engine::get_singleton()->request_redraw(next_blink_time - caret_blink_timer);
+
+        bool caret_shown = std::sin(caret_blink_timer * CARET_BLINK_SPEED) > 0;
+        if (caret_shown != caret_shown_) {
+            caret_shown_ = caret_shown;
+            queue_caret_redraw();
+        }
+    }
 }
 
 void TextEdit::draw() {
@@ -244,14 +275,24 @@ void TextEdit::draw() {
         }
     }
 
-    // Draw selection box.
+    // Draw selection box, with one box per line.
     if (focused) {
         if (selection_start_index != current_caret_index) {
             auto start = calculate_caret_position(std::min(current_caret_index, selection_start_index));
             auto end = calculate_caret_position(std::max(current_caret_index, selection_start_index));
-            auto box_position = label->get_global_position() + start;
-            auto box_size = Vec2F(0, label->get_font_size()) + (end - start);
-            vector_server->draw_style_box(theme_selection_box, box_position, box_size);
+            float line_height = label->get_font_size();
+
+            for (float line_y = start.y; line_y <= end.y; line_y += line_height) {
+                float box_start_x = line_y == start.y ? start.x : 0;
+                float box_end_x = line_y == end.y ? end.x : label->get_size().x;
+                if (box_end_x < box_start_x) {
+                    std::swap(box_start_x, box_end_x);
+                }
+
+                auto box_position = label->get_global_position() + Vec2F(box_start_x, line_y);
+                auto box_size = Vec2F(box_end_x - box_start_x, line_height);
+                vector_server->draw_style_box(theme_selection_box, box_position, box_size);
+            }
         }
     }
 
@@ -262,18 +303,12 @@ void TextEdit::draw() {
 
     // Draw blinking caret.
     if (focused && editable) {
-        theme_caret.color.a_ = 255.0f * std::ceil(std::sin(caret_blink_timer * 5.0f));
+        theme_caret.color.a_ = 255.0f * std::ceil(std::sin(caret_blink_timer * CARET_BLINK_SPEED));
 
-        float current_codepoint_right_edge = 0;
-        if (current_caret_index > 0) {
-            current_codepoint_right_edge = label->get_codepoint_right_edge_position(current_caret_index - 1);
-        } else {
-            current_codepoint_right_edge = 0;
-        }
-
-        auto start = label->get_global_position() + Vec2F(current_codepoint_right_edge, 3);
-        auto end = start + Vec2F(0, label->get_font_size() - 6);
+        auto [start, end] = get_caret_line(current_caret_index);
         vector_server->draw_style_line(theme_caret, start, end);
+
+        caret_drawn_rect_ = get_caret_rect(current_caret_index);
     }
 
     NodeUi::draw();
@@ -284,41 +319,27 @@ void TextEdit::calc_minimum_size() {
 }
 
 uint32_t TextEdit::calculate_caret_index(Vec2F local_cursor_position_to_label) {
-    uint32_t closest_codepoint_index = 0;
-    float closest_distance = std::numeric_limits<float>::max();
-
-    const auto &codepoints = label->get_text_u32();
-
-    for (int i = 0; i < codepoints.size(); i++) {
-        float codepoint_right_edge = label->get_codepoint_right_edge_position(i);
-
-        // Cursor position to the right boundary of the codepoint.
-        auto distance = abs(local_cursor_position_to_label.x - codepoint_right_edge);
-
-        if (distance < closest_distance) {
-            closest_distance = distance;
-            closest_codepoint_index = i;
-        }
-    }
-
-    if (codepoints.empty()) {
-        return 0;
-    }
+    return label->get_caret_index(local_cursor_position_to_label);
+}
 
-    // Caret is before the first codepoint.
-    if (abs(local_cursor_position_to_label.x) < closest_distance) {
-        return 0;
-    }
+Vec2F TextEdit::calculate_caret_position(int32_t target_caret_index) {
+    return label->get_caret_position(target_caret_index);
+}
 
-    return closest_codepoint_index + 1;
+std::pair<Vec2F, Vec2F> TextEdit::get_caret_line(uint32_t caret_index) {
+    auto start = label->get_global_position() + calculate_caret_position(caret_index) + Vec2F(0, 3);
+    auto end = start + Vec2F(0, label->get_font_size() - 6);
+    return {start, end};
 }
 
-Vec2F TextEdit::calculate_caret_position(int32_t target_caret_index) {
-    if (target_caret_index > 0) {
-        return {label->get_codepoint_right_edge_position(target_caret_index - 1), 0};
-    }
+RectF TextEdit::get_caret_rect(uint32_t caret_index) {
+    auto [start, end] = get_caret_line(caret_index);
+    return RectF(start, end).dilate(theme_caret.width);
+}
 
-    return {0, 0};
+void TextEdit::queue_caret_redraw() {
+    queue_redraw_rect(caret_drawn_rect_);
+    queue_redraw_rect(get_caret_rect(current_caret_index));
 }
 
 void TextEdit::grab_focus() {
@@ -331,6 +352,7 @@ void TextEdit::release_focus() {
 
 void TextEdit::set_editable(bool new_value) {
     editable = new_value;
+    queue_redraw();
 }
 
 void TextEdit::delete_selection() {
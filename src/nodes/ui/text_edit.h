@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <utility>
 
 #include "../../common/geometry.h"
 #include "../../resources/style_box.h"
@@ -55,10 +56,28 @@ private:
     std::shared_ptr<MarginContainer> margin_container;
     std::shared_ptr<Label> label;
 
+    /// The caret is shown while the sine of the timer times the speed is positive.
+    static constexpr float CARET_BLINK_SPEED = 5.0f;
+
     float caret_blink_timer = 0;
 
+    /// Blink state of the last update, for redrawing only when it changes.
+    bool caret_shown_ = false;
+
+    /// Where the caret was drawn in the last frame.
+    RectF caret_drawn_rect_;
+
     void delete_selection();
 
+    /// Global end points of the caret line at a codepoint.
+    std::pair<Vec2F, Vec2F> get_caret_line(uint32_t caret_index);
+
+    /// Global rect covered by the caret line at a codepoint, inflated by the caret width.
+    RectF get_caret_rect(uint32_t caret_index);
+
+    /// Redraw only where the caret was drawn and where it is now.
+    void queue_caret_redraw();
+
     /// Get the closest codepoint to a mouse click.
     /// We have to pass the cursor position local to the label (the label is a child of a margin container).
     uint32_t calculate_caret_index(Vec2F local_cursor_position_to_label);
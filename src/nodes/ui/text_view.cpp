@@ -0,0 +1,496 @@
+#include "text_view.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "../../common/utf.h"
+#include "../../resources/default_resource.h"
+#include "label.h"
+
+using Pathfinder::Transform2;
+
+namespace Flint {
+
+TextView::TextView() {
+    type = NodeType::TextView;
+
+    font_ = DefaultResource::get_singleton()->get_default_font();
+    font_size_ = DefaultResource::get_singleton()->get_default_theme()->font_size;
+
+    text_style_.color = {163, 163, 163, 255};
+
+    theme_background = DefaultResource::get_singleton()->get_default_theme()->label.styles["background"];
+
+    theme_scroll_bar.bg_color = ColorU(100, 100, 100, 50);
+    theme_scroll_bar.corner_radius = 8;
+
+    theme_scroll_grabber.bg_color = ColorU(163, 163, 163, 255);
+    theme_scroll_grabber.corner_radius = 8;
+
+    index_paragraphs();
+}
+
+void TextView::set_text(std::string new_text) {
+    owned_text_ = std::move(new_text);
+    mapped_file_.reset();
+    text_ = owned_text_;
+
+    index_paragraphs();
+}
+
+bool TextView::load_file(const std::string &path) {
+    auto file = std::make_unique<MappedFile>(path);
+    if (!file->is_valid()) {
+        Logger::error("Failed to map text file: " + path, "Flint");
+        return false;
+    }
+
+    owned_text_ = {};
+    mapped_file_ = std::move(file);
+    text_ = {mapped_file_->data(), mapped_file_->size()};
+
+    index_paragraphs();
+
+    return true;
+}
+
+std::string_view TextView::get_text() const {
+    return text_;
+}
+
+void TextView::set_font(std::shared_ptr<Font> new_font) {
+    if (new_font == nullptr || new_font == font_) {
+        return;
+    }
+
+    font_ = std::move(new_font);
+
+    shaped_byte_count_ = 0;
+    shaped_width_ = 0;
+    need_to_reestimate_ = true;
+    queue_redraw();
+}
+
+void TextView::set_font_size(uint32_t new_font_size) {
+    if (font_size_ == new_font_size) {
+        return;
+    }
+
+    // Keep the same text at the top.
+    vscroll_ = vscroll_ / font_size_ * new_font_size;
+
+    font_size_ = new_font_size;
+
+    shaped_byte_count_ = 0;
+    shaped_width_ = 0;
+    need_to_reestimate_ = true;
+    queue_redraw();
+}
+
+void TextView::set_text_style(TextStyle new_text_style) {
+    text_style_ = new_text_style;
+    queue_redraw();
+}
+
+void TextView::set_word_wrap(bool word_wrap) {
+    if (word_wrap_ == word_wrap) {
+        return;
+    }
+
+    word_wrap_ = word_wrap;
+    need_to_reestimate_ = true;
+    queue_redraw();
+}
+
+void TextView::set_vscroll(double value) {
+    if (vscroll_ == value) {
+        return;
+    }
+
+    vscroll_ = value;
+    view_is_dirty_ = true;
+    queue_redraw();
+}
+
+double TextView::get_vscroll() const {
+    return vscroll_;
+}
+
+void TextView::set_hscroll(float value) {
+    if (hscroll_ == value) {
+        return;
+    }
+
+    hscroll_ = value;
+    view_is_dirty_ = true;
+    queue_redraw();
+}
+
+float TextView::get_hscroll() const {
+    return hscroll_;
+}
+
+size_t TextView::get_paragraph_count() const {
+    return para_offsets_.size() - 1;
+}
+
+void TextView::scroll_to_paragraph(size_t para_index) {
+    update_view();
+
+    para_index = std::min(para_index, get_paragraph_count());
+    set_vscroll(get_line_offset(para_index) * (double)font_size_);
+}
+
+void TextView::set_size(Vec2F new_size) {
+    if (size == new_size) {
+        return;
+    }
+
+    NodeUi::set_size(new_size);
+    view_is_dirty_ = true;
+}
+
+void TextView::index_paragraphs() {
+    para_offsets_.clear();
+    para_offsets_.push_back(0);
+
+    // Paragraphs are separated the same way as in Label, with the line break at the end of a paragraph.
+    size_t position = 0;
+    while (position < text_.size()) {
+        auto line_break = (const char *)std::memchr(text_.data() + position, '\n', text_.size() - position);
+        position = line_break ? line_break - text_.data() + 1 : text_.size();
+        para_offsets_.push_back(position);
+    }
+
+    // Counts are rebuilt from scratch, so there's no paragraph to keep in place.
+    line_counts_.clear();
+    vscroll_ = 0;
+    hscroll_ = 0;
+
+    shaped_byte_count_ = 0;
+    shaped_width_ = 0;
+    need_to_reestimate_ = true;
+    queue_redraw();
+}
+
+void TextView::reestimate_line_counts() {
+    size_t para_count = get_paragraph_count();
+    float line_height = font_size_;
+
+    // Where the top of the view is, relative to its paragraph.
+    size_t top_para = 0;
+    double top_offset = 0;
+    if (line_counts_.size() == para_count && para_count > 0) {
+        top_para = find_paragraph_at_line(vscroll_ / line_height);
+        top_offset = vscroll_ - get_line_offset(top_para) * (double)line_height;
+    }
+
+    view_paragraphs_.clear();
+    wrap_width_ = size.x;
+    max_line_width_ = 0;
+
+    measured_.assign(para_count, false);
+    line_counts_.resize(para_count);
+    for (size_t i = 0; i < para_count; i++) {
+        line_counts_[i] = estimate_line_count(i);
+    }
+
+    line_count_tree_.assign(line_counts_);
+
+    vscroll_ = get_line_offset(top_para) * (double)line_height + top_offset;
+    view_is_dirty_ = true;
+}
+
+uint32_t TextView::estimate_line_count(size_t para_index) const {
+    if (!word_wrap_ || wrap_width_ <= 0) {
+        return 1;
+    }
+
+    uint64_t byte_count = para_offsets_[para_index + 1] - para_offsets_[para_index];
+
+    // Average advance per byte of the text shaped so far, or a guess if there's none yet.
+    double advance_per_byte = shaped_byte_count_ > 0 ? shaped_width_ / shaped_byte_count_ : font_size_ * 0.5;
+
+    double line_count = std::ceil(byte_count * advance_per_byte / wrap_width_);
+
+    return (uint32_t)std::clamp(line_count, 1.0, (double)UINT32_MAX);
+}
+
+const TextView::ViewParagraph &TextView::shape_paragraph(size_t para_index) {
+    auto iter = view_paragraphs_.find(para_index);
+    if (iter != view_paragraphs_.end()) {
+        return iter->second;
+    }
+
+    auto para_text = text_.substr(para_offsets_[para_index], para_offsets_[para_index + 1] - para_offsets_[para_index]);
+
+    std::u32string para_text_u32;
+    utf8_to_utf32_lossy(para_text, para_text_u32);
+
+    ViewParagraph view_para;
+    view_para.shaped = font_->get_shaped_paragraph(para_text_u32, font_size_);
+
+    const auto &glyphs = view_para.shaped->glyphs;
+    const auto &para = view_para.shaped->line;
+
+    if (word_wrap_) {
+        std::vector<float> advance_sums(glyphs.size() + 1);
+        for (size_t i = 0; i < glyphs.size(); i++) {
+            advance_sums[i + 1] = advance_sums[i] + glyphs.x_advances[i];
+        }
+
+        wrap_paragraph(wrap_width_, para, glyphs, advance_sums, view_para.lines);
+    } else {
+        view_para.lines = {para};
+    }
+
+    float line_height = font_size_;
+
+    view_para.glyph_positions.resize(glyphs.size());
+    for (size_t line_idx = 0; line_idx < view_para.lines.size(); line_idx++) {
+        const auto &line = view_para.lines[line_idx];
+
+        float cursor_x = 0;
+        float cursor_y = line_idx * line_height;
+        for (size_t i = line.glyph_ranges.start; i < line.glyph_ranges.end; i++) {
+            view_para.glyph_positions[i] = {cursor_x + glyphs.x_offsets[i], cursor_y + glyphs.y_offsets[i]};
+            cursor_x += glyphs.x_advances[i];
+        }
+
+        max_line_width_ = std::max(max_line_width_, line.width);
+    }
+
+    if (!measured_[para_index]) {
+        measured_[para_index] = true;
+        shaped_byte_count_ += para_text.size();
+        shaped_width_ += para.width;
+    }
+
+    set_line_count(para_index, std::max<size_t>(view_para.lines.size(), 1));
+
+    return view_paragraphs_.emplace(para_index, std::move(view_para)).first->second;
+}
+
+void TextView::update_view() {
+    if (word_wrap_ && wrap_width_ != size.x) {
+        need_to_reestimate_ = true;
+    }
+
+    if (need_to_reestimate_) {
+        need_to_reestimate_ = false;
+        reestimate_line_counts();
+    }
+
+    if (!view_is_dirty_) {
+        return;
+    }
+    view_is_dirty_ = false;
+
+    frame_glyphs_.clear();
+    frame_glyph_positions_.clear();
+
+    size_t para_count = get_paragraph_count();
+    if (para_count == 0) {
+        view_paragraphs_.clear();
+        return;
+    }
+
+    float line_height = font_size_;
+
+    vscroll_ = std::clamp(vscroll_, 0.0, get_max_vscroll());
+
+    uint64_t top_line = vscroll_ / line_height;
+    size_t top_para = find_paragraph_at_line(top_line);
+
+    // Shape the margin above the view. The measured heights move everything below them,
+    // so scroll along to keep the visible text still.
+    size_t first_para = find_paragraph_at_line(top_line > MARGIN_LINES ? top_line - MARGIN_LINES : 0);
+    for (size_t i = first_para; i < top_para; i++) {
+        uint32_t old_line_count = line_counts_[i];
+        shape_paragraph(i);
+        vscroll_ += ((double)line_counts_[i] - old_line_count) * line_height;
+    }
+
+    // Shape the view and the margin below.
+    uint64_t end_line = (vscroll_ + size.y) / line_height + 1 + MARGIN_LINES;
+    size_t end_para = top_para;
+    for (uint64_t line = get_line_offset(top_para); end_para < para_count && line < end_line; end_para++) {
+        shape_paragraph(end_para);
+        line += line_counts_[end_para];
+    }
+
+    // Drop the paragraphs which have gone out of the margins.
+    for (auto iter = view_paragraphs_.begin(); iter != view_paragraphs_.end();) {
+        if (iter->first < first_para || iter->first >= end_para) {
+            iter = view_paragraphs_.erase(iter);
+        } else {
+            ++iter;
+        }
+    }
+
+    vscroll_ = std::clamp(vscroll_, 0.0, get_max_vscroll());
+    hscroll_ = word_wrap_ ? 0 : std::clamp(hscroll_, 0.0f, std::max(max_line_width_ - size.x, 0.0f));
+
+    // Collect the glyphs of the visible paragraphs, positioned relative to the view.
+    size_t para_index = find_paragraph_at_line(vscroll_ / line_height);
+    double para_top = get_line_offset(para_index) * (double)line_height;
+
+    for (; para_index < para_count && para_top < vscroll_ + size.y; para_index++) {
+        const auto &view_para = shape_paragraph(para_index);
+
+        size_t glyph_start = frame_glyphs_.size();
+        frame_glyphs_.splice(glyph_start, glyph_start, view_para.shaped->glyphs);
+        frame_glyph_positions_.resize(frame_glyphs_.size());
+
+        float y = para_top - vscroll_;
+
+        for (const auto &line : view_para.lines) {
+            // RTL lines are aligned to the right of the view.
+            float x = (line.rtl ? std::max(size.x - line.width, 0.0f) : 0) - hscroll_;
+
+            for (size_t i = line.glyph_ranges.start; i < line.glyph_ranges.end; i++) {
+                frame_glyph_positions_[glyph_start + i] = view_para.glyph_positions[i] + Vec2F(x, y);
+            }
+        }
+
+        para_top += line_counts_[para_index] * (double)line_height;
+    }
+}
+
+void TextView::set_line_count(size_t para_index, uint32_t line_count) {
+    int64_t delta = (int64_t)line_count - line_counts_[para_index];
+    if (delta == 0) {
+        return;
+    }
+
+    line_counts_[para_index] = line_count;
+
+    line_count_tree_.add(para_index, delta);
+}
+
+uint64_t TextView::get_line_offset(size_t para_index) const {
+    return line_count_tree_.get_prefix_sum(para_index);
+}
+
+size_t TextView::find_paragraph_at_line(uint64_t line) const {
+    // The most paragraphs whose lines all come before the line.
+    return std::min(line_count_tree_.find(line), line_count_tree_.size() - 1);
+}
+
+uint64_t TextView::get_total_line_count() const {
+    return get_line_offset(get_paragraph_count());
+}
+
+double TextView::get_max_vscroll() const {
+    return std::max(get_total_line_count() * (double)font_size_ - size.y, 0.0);
+}
+
+void TextView::input(InputEvent &event) {
+    NodeUi::input(event);
+
+    auto global_position = get_global_position();
+
+    auto active_rect = RectF(global_position, global_position + size);
+
+    // Handle mouse input propagation.
+    bool consume_flag = false;
+
+    switch (event.type) {
+        case InputEventType::MouseScroll: {
+            float delta = event.args.mouse_scroll.y_delta;
+
+            if (active_rect.contains_point(InputServer::get_singleton()->cursor_position)) {
+                if (!event.is_consumed()) {
+                    float scroll_step = delta * font_size_ * SCROLL_LINES;
+
+                    if (InputServer::get_singleton()->is_key_pressed(KeyCode::LeftShift)) {
+                        set_hscroll(hscroll_ - scroll_step);
+                    } else {
+                        set_vscroll(vscroll_ - scroll_step);
+                    }
+                }
+
+                // Will stop input propagation.
+                if (mouse_filter == MouseFilter::Stop) {
+                    consume_flag = true;
+                }
+            }
+        } break;
+        default:
+            break;
+    }
+
+    if (consume_flag) {
+        event.consume();
+    }
+}
+
+void TextView::update(double dt) {
+    NodeUi::update(dt);
+
+    update_view();
+}
+
+void TextView::draw() {
+    if (!visible_) {
+        return;
+    }
+
+    auto global_position = get_global_position();
+
+    auto vector_server = VectorServer::get_singleton();
+
+    vector_server->draw_style_box(theme_background, global_position, size, alpha);
+
+    auto translation = Transform2::from_translation(global_position);
+
+    vector_server->draw_glyphs(frame_glyphs_, frame_glyph_positions_, text_style_, translation, RectF({}, size), alpha);
+
+    draw_scroll_bar();
+
+    NodeUi::draw();
+}
+
+void TextView::draw_scroll_bar() {
+    auto vector_server = VectorServer::get_singleton();
+
+    auto global_pos = get_global_position();
+
+    // Vertical.
+    double content_height = get_total_line_count() * (double)font_size_;
+    if (content_height > size.y) {
+        float bar_width = 4.0;
+
+        auto scroll_bar_pos = Vec2F(size.x - bar_width, 0) + global_pos;
+        auto scroll_bar_size = Vec2F(bar_width, size.y);
+
+        vector_server->draw_style_box(theme_scroll_bar, scroll_bar_pos, scroll_bar_size);
+
+        // Keep the grabber grabbable for very long documents.
+        float grabber_length = std::max(size.y / content_height * size.y, (double)bar_width);
+        float grabber_y = vscroll_ / get_max_vscroll() * (size.y - grabber_length);
+
+        auto grabber_pos = Vec2F(size.x - bar_width, grabber_y) + global_pos;
+        auto grabber_size = Vec2F(bar_width, grabber_length);
+
+        vector_server->draw_style_box(theme_scroll_grabber, grabber_pos, grabber_size);
+    }
+
+    // Horizontal.
+    if (!word_wrap_ && max_line_width_ > size.x) {
+        auto scroll_bar_pos = Vec2F(0, size.y - 8) + global_pos;
+        auto scroll_bar_size = Vec2F(size.x, 8);
+
+        vector_server->draw_style_box(theme_scroll_bar, scroll_bar_pos, scroll_bar_size);
+
+        auto grabber_length = size.x / max_line_width_ * size.x;
+
+        auto grabber_pos = Vec2F(size.x / max_line_width_ * hscroll_, size.y - 8) + global_pos;
+        auto grabber_size = Vec2F(grabber_length, 8);
+
+        vector_server->draw_style_box(theme_scroll_grabber, grabber_pos, grabber_size);
+    }
+}
+
+} // namespace Flint
@@ -0,0 +1,177 @@
+#ifndef FLINT_TEXT_VIEW_H
+#define FLINT_TEXT_VIEW_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "../../common/fenwick_tree.h"
+#include "../../common/mapped_file.h"
+#include "../../resources/font.h"
+#include "../../resources/style_box.h"
+#include "node_ui.h"
+
+namespace Flint {
+
+/// Read-only scrolling view of a large text, e.g. a log or a source file.
+///
+/// Only the paragraphs intersecting the viewport (plus a margin) are shaped and laid out, so the per-frame cost and
+/// the memory of shaped text are proportional to the visible lines. The text itself is only indexed by paragraph.
+/// The height of paragraphs that have never been shaped is estimated, and refined when they are shaped.
+/// @note A single paragraph is always shaped as a whole.
+class TextView : public NodeUi {
+public:
+    TextView();
+
+    void set_text(std::string new_text);
+
+    /// Show a file without reading it into memory, by mapping it. Returns false if the file couldn't be mapped.
+    bool load_file(const std::string &path);
+
+    std::string_view get_text() const;
+
+    void set_font(std::shared_ptr<Font> new_font);
+
+    void set_font_size(uint32_t new_font_size);
+
+    uint32_t get_font_size() const {
+        return font_size_;
+    }
+
+    void set_text_style(TextStyle new_text_style);
+
+    void set_word_wrap(bool word_wrap);
+
+    bool get_word_wrap() const {
+        return word_wrap_;
+    }
+
+    /// Scroll offsets in pixels. Double precision, as a large document can be taller than floats count exactly.
+    void set_vscroll(double value);
+
+    double get_vscroll() const;
+
+    void set_hscroll(float value);
+
+    float get_hscroll() const;
+
+    /// Paragraphs separated by line breaks, including the trailing line break.
+    size_t get_paragraph_count() const;
+
+    /// Scroll so that the paragraph is at the top of the view.
+    void scroll_to_paragraph(size_t para_index);
+
+    void input(InputEvent &event) override;
+
+    void update(double dt) override;
+
+    void draw() override;
+
+    void set_size(Vec2F new_size) override;
+
+    StyleBox theme_background;
+
+    StyleBox theme_scroll_bar;
+    StyleBox theme_scroll_grabber;
+
+private:
+    /// A shaped paragraph and its layout, kept while the paragraph is around the viewport.
+    struct ViewParagraph {
+        std::shared_ptr<const ShapedParagraph> shaped;
+
+        /// Lines with glyph ranges relative to the paragraph.
+        std::vector<Line> lines;
+
+        /// Glyph positions relative to the top-left of the paragraph, before RTL lines are aligned to the right.
+        std::vector<Vec2F> glyph_positions;
+    };
+
+    /// Split the text into paragraphs and estimate their heights.
+    void index_paragraphs();
+
+    /// Throw away shaped paragraphs and estimate the paragraph heights again, e.g. after the wrap width has changed.
+    /// The paragraph at the top of the view stays there.
+    void reestimate_line_counts();
+
+    /// Estimated line count of a paragraph that hasn't been shaped with the current settings.
+    uint32_t estimate_line_count(size_t para_index) const;
+
+    /// Shape and lay out a paragraph if it isn't yet. Refines its line count.
+    const ViewParagraph &shape_paragraph(size_t para_index);
+
+    /// Shape the paragraphs around the viewport, drop the others, and collect the visible glyphs.
+    void update_view();
+
+    void set_line_count(size_t para_index, uint32_t line_count);
+
+    /// Number of lines before a paragraph, from the line count tree.
+    uint64_t get_line_offset(size_t para_index) const;
+
+    /// Index of the paragraph containing a line, or the last paragraph if the line is past the end.
+    size_t find_paragraph_at_line(uint64_t line) const;
+
+    uint64_t get_total_line_count() const;
+
+    double get_max_vscroll() const;
+
+    void draw_scroll_bar();
+
+private:
+    // Either owned_text_ or the mapped file.
+    std::string_view text_;
+    std::string owned_text_;
+    std::unique_ptr<MappedFile> mapped_file_;
+
+    /// Byte offsets of the paragraph starts, with the text size at the end.
+    std::vector<uint64_t> para_offsets_;
+
+    /// Line counts of the paragraphs, estimated until measured_ is set.
+    std::vector<uint32_t> line_counts_;
+    std::vector<bool> measured_;
+
+    /// Fenwick tree over line_counts_, for paragraph offsets and lookups in logarithmic time.
+    FenwickTree<uint64_t> line_count_tree_;
+
+    /// Shaped paragraphs by index.
+    std::unordered_map<size_t, ViewParagraph> view_paragraphs_;
+
+    /// Shaped text so far, which makes the estimates of unshaped paragraphs better.
+    uint64_t shaped_byte_count_ = 0;
+    double shaped_width_ = 0;
+
+    /// Visible glyphs, positioned relative to the view.
+    GlyphRun frame_glyphs_;
+    std::vector<Vec2F> frame_glyph_positions_;
+
+    std::shared_ptr<Font> font_;
+
+    uint32_t font_size_;
+
+    TextStyle text_style_;
+
+    bool word_wrap_ = false;
+
+    /// Width the current line counts are for.
+    float wrap_width_ = 0;
+
+    /// Widest shaped line, which bounds the horizontal scroll.
+    float max_line_width_ = 0;
+
+    double vscroll_ = 0;
+    float hscroll_ = 0;
+
+    bool need_to_reestimate_ = true;
+    bool view_is_dirty_ = true;
+
+    /// Lines shaped beyond each edge of the viewport, so that scrolling a bit doesn't have to shape first.
+    static constexpr uint32_t MARGIN_LINES = 32;
+
+    /// Lines scrolled per mouse wheel step.
+    static constexpr uint32_t SCROLL_LINES = 3;
+};
+
+} // namespace Flint
+
+#endif // FLINT_TEXT_VIEW_H
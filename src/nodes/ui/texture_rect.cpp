@@ -16,6 +16,8 @@ TextureRect::TextureRect() {
 void TextureRect::set_texture(const std::shared_ptr<Image> &new_image) {
     // Texture can be null.
     texture = new_image;
+    mark_layout_dirty();
+    queue_redraw();
 }
 
 std::shared_ptr<Image> TextureRect::get_texture() const {
@@ -111,7 +113,12 @@ void TextureRect::calc_minimum_size() {
 }
 
 void TextureRect::set_stretch_mode(TextureRect::StretchMode new_stretch_mode) {
+    if (stretch_mode == new_stretch_mode) {
+        return;
+    }
     stretch_mode = new_stretch_mode;
+    mark_layout_dirty();
+    queue_redraw();
 }
 
 } // namespace Flint
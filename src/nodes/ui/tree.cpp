@@ -48,6 +48,7 @@ std::shared_ptr<TreeItem> Tree::create_item(const std::shared_ptr<TreeItem> &par
         root = std::make_shared<TreeItem>();
         root->set_text(text);
         root->tree = this;
+        mark_layout_dirty();
         return root;
     }
 
@@ -56,12 +57,17 @@ std::shared_ptr<TreeItem> Tree::create_item(const std::shared_ptr<TreeItem> &par
     parent->add_child(item);
     item->parent = parent.get();
     item->tree = this;
+    mark_layout_dirty();
 
     return item;
 }
 
 void Tree::set_item_height(float new_item_height) {
+    if (item_height == new_item_height) {
+        return;
+    }
     item_height = new_item_height;
+    mark_layout_dirty();
 }
 
 float Tree::get_item_height() {
@@ -104,6 +110,11 @@ TreeItem::TreeItem() {
         } else {
             collapse_button->set_icon_normal(expanded_tex);
         }
+        // Items are shown or hidden.
+        if (tree) {
+            tree->mark_layout_dirty();
+            tree->queue_redraw();
+        }
     };
     collapse_button->connect_signal("pressed", callback);
 
@@ -191,17 +202,20 @@ void TreeItem::propagate_draw(float folding_width, uint32_t depth, float &offset
     container->set_position(Vec2F(offset_x, offset_y) + global_position);
     container->set_size({item_height, item_height});
 
+    // The minimum size of the tree depends on the ones of the items.
+    if (container->is_minimum_size_dirty()) {
+        tree->mark_layout_dirty();
+    }
     calc_minimum_size(container.get());
 
-    transform_system(container.get());
+    transform_system(container_traversal, container.get());
 
-    std::vector<Node *> nodes;
-    dfs_preorder_ltr_traversal(container.get(), nodes);
-    for (auto &node : nodes) {
+    container_traversal.update(container.get());
+    for (auto &node : container_traversal.get_preorder()) {
         node->update(0);
     }
 
-    draw_system(container.get());
+    draw_system(container_traversal, container.get());
 
     offset_y += item_height;
 
@@ -249,6 +263,7 @@ void TreeItem::input(InputEvent &event, Vec2F global_position) {
             if (item_global_rect.contains_point(button_event.position)) {
                 selected = true;
                 tree->selected_item = this;
+                tree->queue_redraw();
                 Logger::verbose("Item selected: " + label->get_text(), "Flint");
             }
         }
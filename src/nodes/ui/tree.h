@@ -61,10 +61,13 @@ private:
 
     std::shared_ptr<HBoxContainer> container;
 
+    /// Nodes of the container, which is processed like a scene tree when the item is drawn.
+    NodeTraversalCache container_traversal;
+
     std::vector<std::shared_ptr<TreeItem>> children;
-    TreeItem *parent;
+    TreeItem *parent{};
 
-    Tree *tree;
+    Tree *tree{};
 
     StyleBox theme_selected;
 };
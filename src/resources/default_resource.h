@@ -1,19 +1,21 @@
 #ifndef FLINT_DEFAULT_RESOURCE_H
 #define FLINT_DEFAULT_RESOURCE_H
 
+#include "../servers/text_server.h"
 #include "opensans_regular_ttf.h"
 #include "theme.h"
 
 namespace Flint {
 
-class Font;
-
 class DefaultResource {
 public:
     DefaultResource() {
         default_theme = std::make_shared<Theme>();
-        default_font =
-            std::make_shared<Font>(std::vector<char>(std::begin(DEFAULT_FONT_DATA), std::end(DEFAULT_FONT_DATA)));
+
+        // Use the embedded font data in place.
+        auto default_face = TextServer::get_singleton()->load_font_from_static_memory(
+            "default", DEFAULT_FONT_DATA, sizeof(DEFAULT_FONT_DATA));
+        default_font = std::make_shared<Font>(default_face);
     }
 
     static DefaultResource *get_singleton() {
@@ -0,0 +1,45 @@
+#include "emoji_scene_cache.h"
+
+#include "font.h"
+
+namespace Flint {
+
+EmojiSceneCache::EmojiSceneCache(size_t capacity) : cache(capacity) {
+}
+
+std::shared_ptr<Pathfinder::SvgScene> EmojiSceneCache::get_scene(Font &font,
+                                                                 uint16_t glyph_index,
+                                                                 Pathfinder::Canvas &canvas) {
+    auto key = make_key(font.get_id(), glyph_index);
+
+    if (auto cached_scene = cache.find(key)) {
+        return *cached_scene;
+    }
+
+    std::shared_ptr<Pathfinder::SvgScene> scene;
+
+    auto svg = font.get_glyph_svg(glyph_index);
+    if (!svg.empty()) {
+        scene = std::make_shared<Pathfinder::SvgScene>(svg, canvas);
+    }
+
+    return cache.insert(key, scene);
+}
+
+void EmojiSceneCache::set_capacity(size_t new_capacity) {
+    cache.set_budget(new_capacity);
+}
+
+size_t EmojiSceneCache::get_capacity() const {
+    return cache.get_budget();
+}
+
+size_t EmojiSceneCache::get_entry_count() const {
+    return cache.get_stats().entry_count;
+}
+
+void EmojiSceneCache::clear() {
+    cache.clear();
+}
+
+} // namespace Flint
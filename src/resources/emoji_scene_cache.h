@@ -0,0 +1,53 @@
+#ifndef FLINT_EMOJI_SCENE_CACHE_H
+#define FLINT_EMOJI_SCENE_CACHE_H
+
+#include <pathfinder/prelude.h>
+
+#include <cstdint>
+#include <memory>
+
+#include "../common/lru_cache.h"
+
+namespace Flint {
+
+class Font;
+
+/// An LRU cache for parsed emoji SVG documents, keyed by (font, glyph index).
+/// Each document is parsed once, and drawing an emoji only appends the cached scene with a transform.
+class EmojiSceneCache {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 256;
+
+    explicit EmojiSceneCache(size_t capacity = DEFAULT_CAPACITY);
+
+    /// Get the parsed scene of a glyph, parsing its SVG document if necessary.
+    /// Returns nullptr if the glyph has no SVG document.
+    std::shared_ptr<Pathfinder::SvgScene> get_scene(Font &font, uint16_t glyph_index, Pathfinder::Canvas &canvas);
+
+    /// Maximum number of cached scenes.
+    void set_capacity(size_t new_capacity);
+
+    size_t get_capacity() const;
+
+    size_t get_entry_count() const;
+
+    void clear();
+
+private:
+    struct SceneCount {
+        size_t operator()(const std::shared_ptr<Pathfinder::SvgScene> &) const {
+            return 1;
+        }
+    };
+
+    static uint64_t make_key(uint32_t font_id, uint16_t glyph_index) {
+        return (uint64_t)font_id << 16 | glyph_index;
+    }
+
+    // Null for glyphs without a document, so they're not looked up again.
+    LruCache<uint64_t, std::shared_ptr<Pathfinder::SvgScene>, SceneCount> cache;
+};
+
+} // namespace Flint
+
+#endif // FLINT_EMOJI_SCENE_CACHE_H
@@ -1,8 +1,11 @@
 #include "font.h"
 
+#include <atomic>
 #include <string>
+#include <string_view>
 #include <vector>
 
+#include "../common/line_break.h"
 #include "../common/load_file.h"
 #include "../common/utils.h"
 
@@ -24,6 +27,7 @@
         #include <unicode/uclean.h>
         #include <unicode/udata.h>
         #include <unicode/uscript.h>
+        #include <unicode/utf16.h>
         #include <unicode/utypes.h>
     #endif
 #else
@@ -31,15 +35,19 @@
 #endif
 
 #include <hb.h>
+#include <pathfinder/core/stroke.h>
 
 #include <gzip/decompress.hpp>
 #include <gzip/utils.hpp>
 #include <optional>
 
+#include "../servers/text_server.h"
 #include "default_resource.h"
 
 namespace Flint {
 
+static std::atomic<uint32_t> next_font_id{1};
+
 hb_script_t to_harfbuzz_script(Script script) {
     switch (script) {
         case Script::Arabic: {
@@ -69,131 +77,88 @@ hb_script_t to_harfbuzz_script(Script script) {
     }
 }
 
-std::vector<std::pair<Script, Pathfinder::Range>> get_text_script(const std::u32string &utf32_text) {
-    std::vector<Script> scripts;
-
-    for (auto &codepoint : utf32_text) {
-        if (codepoint >= 0x0600 && codepoint <= 0x06FF) {
-            scripts.push_back(Script::Arabic);
-        } else if (codepoint >= 0x0981 && codepoint <= 0x09FB) {
-            scripts.push_back(Script::Bengali);
-        } else if (codepoint >= 0x0901 && codepoint <= 0x097F) {
-            scripts.push_back(Script::Devanagari);
-        } else if (codepoint >= 0x0590 && codepoint <= 0x05FF) {
-            scripts.push_back(Script::Hebrew);
-        } else if (codepoint >= 0x4E00 && codepoint <= 0x9FFF) {
-            scripts.push_back(Script::Cjk);
-        } else if (codepoint >= 0x3040 && codepoint <= 0x309F) {
-            scripts.push_back(Script::Hiragana);
-        } else if (codepoint >= 0x30A0 && codepoint <= 0x30FF) {
-            scripts.push_back(Script::Katakana);
-        } else if (codepoint >= 0x0E00 && codepoint <= 0x0E7F) {
-            scripts.push_back(Script::Thai);
-        } else {
-            scripts.push_back(Script::Common);
-        }
+Script get_codepoint_script(char32_t codepoint) {
+    if (codepoint >= 0x0600 && codepoint <= 0x06FF) {
+        return Script::Arabic;
+    } else if (codepoint >= 0x0981 && codepoint <= 0x09FB) {
+        return Script::Bengali;
+    } else if (codepoint >= 0x0901 && codepoint <= 0x097F) {
+        return Script::Devanagari;
+    } else if (codepoint >= 0x0590 && codepoint <= 0x05FF) {
+        return Script::Hebrew;
+    } else if (codepoint >= 0x4E00 && codepoint <= 0x9FFF) {
+        return Script::Cjk;
+    } else if (codepoint >= 0x3040 && codepoint <= 0x309F) {
+        return Script::Hiragana;
+    } else if (codepoint >= 0x30A0 && codepoint <= 0x30FF) {
+        return Script::Katakana;
+    } else if (codepoint >= 0x0E00 && codepoint <= 0x0E7F) {
+        return Script::Thai;
+    } else {
+        return Script::Common;
+    }
+}
+
+/// Split the text into ranges of the same script, written to a vector which may be reused.
+void get_text_script(std::u32string_view utf32_text, std::vector<std::pair<Script, Pathfinder::Range>> &script_groups) {
+    script_groups.clear();
+
+    if (utf32_text.empty()) {
+        return;
     }
 
-    std::vector<std::pair<Script, Pathfinder::Range>> script_groups;
-    auto current_script = scripts.front();
+    auto current_script = get_codepoint_script(utf32_text.front());
     uint32_t current_codepoint_start = 0;
-    for (uint32_t idx = 0; idx < scripts.size(); idx++) {
-        const auto &s = scripts[idx];
+    for (uint32_t idx = 1; idx < utf32_text.size(); idx++) {
+        auto script = get_codepoint_script(utf32_text[idx]);
 
-        if (s != current_script) {
+        if (script != current_script) {
             script_groups.emplace_back(current_script, Pathfinder::Range{current_codepoint_start, idx});
 
-            current_script = s;
+            current_script = script;
             current_codepoint_start = idx;
         }
     }
 
-    script_groups.emplace_back(current_script, Pathfinder::Range{current_codepoint_start, scripts.size()});
-
-    return script_groups;
+    script_groups.emplace_back(current_script, Pathfinder::Range{current_codepoint_start, utf32_text.size()});
 }
 
-bool glyphs_exist_in_font(std::u32string codepoints, Font *font) {
-    assert(font != nullptr);
+std::vector<std::pair<Script, Pathfinder::Range>> get_text_script(const std::u32string &utf32_text) {
+    std::vector<std::pair<Script, Pathfinder::Range>> script_groups;
+    get_text_script(utf32_text, script_groups);
 
-    for (const auto &c : codepoints) {
-        // Skip line breaks.
-        if (c == 0x000A) {
-            continue;
-        }
-        if (font->find_glyph_index_by_codepoint(c) == 0) {
-            return false;
-        }
-    }
-    return true;
+    return script_groups;
 }
 
-struct HarfBuzzData {
-    hb_blob_t *blob{};
-    hb_face_t *face{};
-    hb_font_t *font{};
-
-    HarfBuzzData() = default;
-
-    explicit HarfBuzzData(const std::vector<char> &bytes) {
-        // We need to keep bytes.data() valid for HarfBuzz to work properly.
-        blob = hb_blob_create(bytes.data(), bytes.size(), HB_MEMORY_MODE_READONLY, nullptr, nullptr);
-        face = hb_face_create(blob, 0);
-        font = hb_font_create(face);
-    }
-
-    ~HarfBuzzData() {
-        if (font) {
-            hb_font_destroy(font);
-        }
-        if (face) {
-            hb_face_destroy(face);
-        }
-        if (blob) {
-            hb_blob_destroy(blob);
-        }
-    }
-};
-
 Font::Font(const std::string &path) : Resource(path) {
-    font_data = Pathfinder::load_file_as_bytes(path.c_str());
-
-    auto byte_size = font_data.size() * sizeof(unsigned char);
-    assert(byte_size != 0);
-
-    stbtt_buffer = static_cast<unsigned char *>(malloc(byte_size));
-    memcpy(stbtt_buffer, font_data.data(), byte_size);
+    face = TextServer::get_singleton()->load_font_from_file(path);
 
-    // Prepare font info.
-    stbtt_info = new stbtt_fontinfo;
-    if (!stbtt_InitFont(stbtt_info, stbtt_buffer, 0)) {
-        Logger::error("Failed to prepare font info!", "Flint");
-    }
-
-    harfbuzz_data = std::make_shared<HarfBuzzData>(font_data);
+    init();
 }
 
 Font::Font(const std::vector<char> &bytes) {
-    font_data = bytes;
-
-    auto byte_size = font_data.size() * sizeof(unsigned char);
+    // Fonts with the same data share a face.
+    auto font_id = "memory:" + std::to_string(std::hash<std::string_view>()({bytes.data(), bytes.size()}));
+    face = TextServer::get_singleton()->load_font_from_memory(font_id, bytes);
 
-    stbtt_buffer = static_cast<unsigned char *>(malloc(byte_size));
-    memcpy(stbtt_buffer, font_data.data(), byte_size);
+    init();
+}
 
-    // Prepare font info.
-    stbtt_info = new stbtt_fontinfo;
-    if (!stbtt_InitFont(stbtt_info, stbtt_buffer, 0)) {
-        Logger::error("Failed to prepare font info!", "Flint");
-    }
+Font::Font(std::shared_ptr<FontFace> font_face) {
+    face = std::move(font_face);
 
-    harfbuzz_data = std::make_shared<HarfBuzzData>(font_data);
+    init();
 }
 
-Font::~Font() {
-    free(stbtt_buffer);
+Font::~Font() = default;
+
+void Font::init() {
+    stbtt_info = face->get_stbtt_info();
+
+    int unscaled_line_gap;
+    stbtt_GetFontVMetrics(stbtt_info, &unscaled_ascent, &unscaled_descent, &unscaled_line_gap);
 
-    delete stbtt_info;
+    id = next_font_id++;
 }
 
 float Font::update_metrics(uint32_t size, float &ascent, float &descent) {
@@ -202,11 +167,6 @@ float Font::update_metrics(uint32_t size, float &ascent, float &descent) {
 
     // The origin is baseline and the Y axis points upward.
     // So, ascent is usually positive, and descent negative.
-    int unscaled_ascent;
-    int unscaled_descent;
-    int unscaled_line_gap;
-    stbtt_GetFontVMetrics(stbtt_info, &unscaled_ascent, &unscaled_descent, &unscaled_line_gap);
-
     // Take scale into account.
     ascent = float(unscaled_ascent) * scale;
     descent = float(unscaled_descent) * scale;
@@ -231,9 +191,21 @@ std::string Font::get_glyph_svg(uint16_t glyph_index) const {
     return {};
 }
 
-Pathfinder::Path2d Font::get_glyph_path(uint16_t glyph_index, float scale) const {
+bool Font::has_glyph_svg(uint16_t glyph_index) const {
+    const char *data{};
+    return stbtt_GetGlyphSVG(stbtt_info, glyph_index, &data) > 0;
+}
+
+/// Decode a glyph outline from the font file.
+/// @param point_count Number of points in the decoded path, which is used to estimate the memory usage.
+static Pathfinder::Path2d decode_glyph_path(const stbtt_fontinfo *stbtt_info,
+                                            uint16_t glyph_index,
+                                            float scale,
+                                            size_t &point_count) {
     Pathfinder::Path2d path;
 
+    point_count = 0;
+
     stbtt_vertex *vertices{};
     int num_vertices = stbtt_GetGlyphShape(stbtt_info, glyph_index, &vertices);
 
@@ -250,15 +222,19 @@ Pathfinder::Path2d Font::get_glyph_path(uint16_t glyph_index, float scale) const
                 // Close the last contour in the outline (if there's any).
                 path.close_path();
                 path.move_to(v.x * scale, v.y * -scale);
+                point_count += 1;
             } break;
             case STBTT_vline: {
                 path.line_to(v.x * scale, v.y * -scale);
+                point_count += 1;
             } break;
             case STBTT_vcurve: {
                 path.quadratic_to(v.cx * scale, v.cy * -scale, v.x * scale, v.y * -scale);
+                point_count += 2;
             } break;
             case STBTT_vcubic: {
                 path.cubic_to(v.cx * scale, v.cy * -scale, v.cx1 * scale, v.cy1 * -scale, v.x * scale, v.y * -scale);
+                point_count += 3;
             } break;
         }
     }
@@ -271,38 +247,171 @@ Pathfinder::Path2d Font::get_glyph_path(uint16_t glyph_index, float scale) const
     return path;
 }
 
+Pathfinder::Path2d Font::get_glyph_path(uint16_t glyph_index, float scale) const {
+    size_t point_count;
+    return decode_glyph_path(stbtt_info, glyph_index, scale, point_count);
+}
+
+CachedGlyph &Font::get_cached_glyph(uint16_t glyph_index, uint32_t font_size) {
+    auto cached_glyph = glyph_cache.find(glyph_index, font_size);
+    if (cached_glyph) {
+        return *cached_glyph;
+    }
+
+    CachedGlyph new_glyph;
+
+    // Try the glyphs persisted by previous runs before decoding.
+    auto &disk_cache = TextServer::get_singleton()->get_glyph_disk_cache();
+    auto font_hash = disk_cache.is_open() ? face->get_data_hash() : 0;
+
+    if (disk_cache.is_open() && disk_cache.find(font_hash, glyph_index, font_size, new_glyph)) {
+        for (const auto &contour : Pathfinder::Path2d(new_glyph.path).into_outline().contours) {
+            new_glyph.point_count += contour.points.size();
+        }
+    } else {
+        float scale = stbtt_ScaleForPixelHeight(stbtt_info, (float)font_size);
+
+        new_glyph.path = decode_glyph_path(stbtt_info, glyph_index, scale, new_glyph.point_count);
+
+        new_glyph.bbox = get_glyph_bounds(glyph_index, scale).to_f32();
+
+        new_glyph.advance = get_glyph_advance(glyph_index, scale);
+
+        disk_cache.add(font_hash, glyph_index, font_size, new_glyph);
+    }
+
+    return glyph_cache.insert(glyph_index, font_size, std::move(new_glyph));
+}
+
+const Pathfinder::Outline &Font::get_stroked_glyph(uint16_t glyph_index,
+                                                   uint32_t font_size,
+                                                   const GlyphStroke &stroke) {
+    auto stroked_glyph = stroked_glyph_cache.find(glyph_index, font_size, stroke);
+    if (stroked_glyph) {
+        return *stroked_glyph;
+    }
+
+    auto outline = get_cached_glyph(glyph_index, font_size).path.into_outline();
+
+    if (stroke.skew != 0) {
+        outline.transform(Transform2({1, 0, stroke.skew, 1}, {}));
+    }
+
+    auto style = Pathfinder::StrokeStyle();
+    style.line_width = stroke.width;
+    style.line_join = stroke.join;
+
+    auto stroke_to_fill = Pathfinder::OutlineStrokeToFill(outline, style);
+    stroke_to_fill.offset();
+
+    return stroked_glyph_cache.insert(glyph_index, font_size, stroke, stroke_to_fill.into_outline());
+}
+
+uint32_t Font::get_id() const {
+    return id;
+}
+
+GlyphCache &Font::get_glyph_cache() {
+    return glyph_cache;
+}
+
+StrokedGlyphCache &Font::get_stroked_glyph_cache() {
+    return stroked_glyph_cache;
+}
+
+ShapingCache &Font::get_shaping_cache() {
+    return shaping_cache;
+}
+
+/// Temporary buffers for shaping, reused by all the paragraphs shaped on a thread.
+/// The vectors only grow, so shaping doesn't allocate once they are large enough for the paragraphs.
+struct ShapingScratch {
+    hb_buffer_t *hb_buffer = hb_buffer_create();
+
+    std::vector<bool> break_opportunities;
+    std::vector<size_t> break_boundaries;
+
+    std::vector<std::pair<Script, Pathfinder::Range>> script_ranges;
+
+#ifdef FLINT_USE_FRIBIDI
+    std::vector<FriBidiLevel> embedding_levels;
+    std::vector<FriBidiStrIndex> visual_to_logical;
+
+    /// Bidi runs in logical order and then in visual order.
+    std::vector<Pathfinder::Range> logical_runs;
+    std::vector<FriBidiLevel> logical_run_levels;
+    std::vector<Pathfinder::Range> visual_runs;
+    std::vector<FriBidiLevel> visual_run_levels;
+
+    /// Index of the run starting at each codepoint, or -1.
+    std::vector<int32_t> run_starting_at;
+#else
+    /// Codepoint offsets in a paragraph by UTF-16 offset.
+    std::vector<uint32_t> codepoint_offsets;
+
+    /// Paragraph text in UTF-16 and the text of a bidi run in UTF-32.
+    std::u16string para_text_u16;
+    std::u32string run_text_u32;
+#endif
+
+    ShapingScratch() = default;
+
+    ShapingScratch(const ShapingScratch &) = delete;
+
+    ShapingScratch &operator=(const ShapingScratch &) = delete;
+
+    ~ShapingScratch() {
+        hb_buffer_destroy(hb_buffer);
+    }
+
+    static ShapingScratch &get() {
+        thread_local ShapingScratch scratch;
+        return scratch;
+    }
+};
+
 #ifndef FLINT_USE_FRIBIDI
 
 // Not font fallback when using ICU.
 
 void Font::get_glyphs(const std::string &text,
                       uint32_t font_size,
-                      std::vector<Glyph> &glyphs,
+                      GlyphRun &glyphs,
                       std::vector<Line> &paragraphs) {
+    std::u16string text_u16;
+    utf8_to_utf16(text, text_u16);
+
+    get_glyphs_u16(text_u16, font_size, glyphs, paragraphs);
+}
+
+void Font::get_glyphs_u16(std::u16string_view text_u16,
+                          uint32_t font_size,
+                          GlyphRun &glyphs,
+                          std::vector<Line> &paragraphs) {
     glyphs.clear();
     paragraphs.clear();
 
     #ifdef ICU_STATIC_DATA
-    static bool icu_data_loaded = false;
-    if (!icu_data_loaded) {
+    // Initialized once, even when shaping from multiple threads.
+    static const bool icu_data_loaded = [] {
         UErrorCode err = U_ZERO_ERROR;
         u_init(&err); // Do not check for errors, since we only load part of the data.
-        icu_data_loaded = true;
-    }
+        return true;
+    }();
+    (void)icu_data_loaded;
     #else
     // Load data manually.
     #endif
 
-    uint32_t units_per_em = hb_face_get_upem(harfbuzz_data->face);
+    uint32_t units_per_em = hb_face_get_upem(face->get_hb_face());
 
     // Note: don't use icu::UnicodeString, it doesn't work. Use plain UChar* instead.
 
-    std::u16string text_u16;
-    utf8_to_utf16(text, text_u16);
-
-    const UChar *uchar_data = text_u16.c_str();
+    const UChar *uchar_data = text_u16.data();
     const int32_t uchar_count = text_u16.length();
 
+    auto &scratch = ShapingScratch::get();
+
     // Bidi for the whole text (paragraphs).
     UBiDi *para_bidi = ubidi_open();
     // Bidi for a paragraph (lines).
@@ -355,6 +464,44 @@ void Font::get_glyphs(const std::string &text,
             // The first glyph in the new paragraph.
             size_t para_glyph_start = glyphs.size();
 
+            // Line break opportunities (UAX #14) in the paragraph. Unit: u16char.
+            auto &break_opportunities = scratch.break_opportunities;
+            break_opportunities.assign(para_end - para_start, false);
+            UBreakIterator *break_iter =
+                ubrk_open(UBRK_LINE, nullptr, uchar_data + para_start, para_end - para_start, &error_code);
+            if (U_SUCCESS(error_code)) {
+                for (int32_t pos = ubrk_first(break_iter); pos != UBRK_DONE; pos = ubrk_next(break_iter)) {
+                    if (pos > 0 && pos < para_end - para_start) {
+                        break_opportunities[pos] = true;
+                    }
+                }
+                ubrk_close(break_iter);
+            } else {
+                Logger::error("ubrk_open() failed!", "Flint");
+                error_code = U_ZERO_ERROR;
+            }
+
+            // Visual glyph boundaries where a line can break.
+            auto &break_boundaries = scratch.break_boundaries;
+            break_boundaries.clear();
+
+            // Codepoint offsets in the paragraph by UTF-16 offset, as the clusters of the glyph run are codepoint
+            // offsets like with fribidi, while HarfBuzz gives UTF-16 offsets in the whole text.
+            auto &codepoint_offsets = scratch.codepoint_offsets;
+            codepoint_offsets.resize(para_end - para_start + 1);
+            {
+                uint32_t codepoint_offset = 0;
+                for (int32_t i = 0; i < para_end - para_start; i++) {
+                    // The trailing surrogate belongs to the codepoint of the leading one.
+                    bool is_trail = i > 0 && U16_IS_TRAIL(uchar_data[para_start + i]) &&
+                                    U16_IS_LEAD(uchar_data[para_start + i - 1]);
+                    codepoint_offsets[i] = is_trail ? codepoint_offset - 1 : codepoint_offset++;
+                }
+                codepoint_offsets.back() = codepoint_offset;
+            }
+
+            Line para{};
+
             // Get run count in the current paragraph.
             int32_t run_count = ubidi_countRuns(line_bidi, &error_code);
 
@@ -369,44 +516,44 @@ void Font::get_glyphs(const std::string &text,
                 para_is_rtl |= run_is_rtl;
 
                 // Get run text from the whole text.
-                std::u16string run_text_u16 = text_u16.substr(para_start + logical_start, length);
-
-                std::string run_text = utf16_to_utf8(run_text_u16);
-
-                std::u32string run_text_u32;
-                utf8_to_utf32(run_text, run_text_u32);
-
-                //                std::cout << "Visual run in paragraph: \t" << run_index << "\t" << run_is_rtl << "\t"
-                //                << logical_start
-                //                          << '\t' << length << '\t' << run_text << std::endl;
+                auto &run_text_u32 = scratch.run_text_u32;
+                run_text_u32.clear();
+                for (int32_t i = para_start + logical_start; i < para_start + logical_start + length;) {
+                    UChar32 codepoint;
+                    U16_NEXT(uchar_data, i, para_start + logical_start + length, codepoint);
+                    run_text_u32.push_back(codepoint);
+                }
 
-                auto run_script = get_text_script(run_text_u32).front().first;
+                get_text_script(run_text_u32, scratch.script_ranges);
+                auto run_script = scratch.script_ranges.front().first;
 
                 float ascent, descent;
                 float scale = update_metrics(font_size, ascent, descent);
 
+                uint16_t font_index = glyphs.add_font({weak_from_this(), id, font_size, ascent, descent});
+
                 // Buffers are sequences of Unicode characters that use the same font
                 // and have the same text direction, script, and language.
-                hb_buffer_t *hb_buffer = hb_buffer_create();
+                // The buffer is reused, which keeps its allocations.
+                hb_buffer_t *hb_buffer = scratch.hb_buffer;
+                hb_buffer_clear_contents(hb_buffer);
 
                 // Item offset and length should represent a specific run.
-                hb_buffer_add_utf16(
-                    hb_buffer, reinterpret_cast<const uint16_t *>(uchar_data), -1, para_start + logical_start, length);
+                hb_buffer_add_utf16(hb_buffer,
+                                    reinterpret_cast<const uint16_t *>(uchar_data),
+                                    uchar_count,
+                                    para_start + logical_start,
+                                    length);
 
                 hb_buffer_set_direction(hb_buffer, run_is_rtl ? HB_DIRECTION_RTL : HB_DIRECTION_LTR);
                 hb_buffer_set_script(hb_buffer, to_harfbuzz_script(run_script));
 
-                hb_shape(harfbuzz_data->font, hb_buffer, nullptr, 0);
+                hb_shape(face->get_hb_font(), hb_buffer, nullptr, 0);
 
                 unsigned int glyph_count;
                 hb_glyph_info_t *glyph_info = hb_buffer_get_glyph_infos(hb_buffer, &glyph_count);
                 hb_glyph_position_t *glyph_pos = hb_buffer_get_glyph_positions(hb_buffer, &glyph_count);
 
-                std::vector<hb_glyph_info_t> debug_glyph_info(glyph_count);
-                for (int i = 0; i < glyph_count; i++) {
-                    debug_glyph_info[i] = glyph_info[i];
-                }
-
                 // Shaped glyph positions will always be in one line (regardless of line breaks).
                 for (int i = 0; i < glyph_count; i++) {
                     auto &info = glyph_info[i];
@@ -442,86 +589,59 @@ void Font::get_glyphs(const std::string &text,
                         }
                     }
 
-                    std::u16string glyph_text_u16 = text_u16.substr(current_cluster->start, current_cluster->length());
+                    std::u16string_view glyph_text_u16 =
+                        text_u16.substr(current_cluster->start, current_cluster->length());
 
-                    std::string glyph_text = utf16_to_utf8(glyph_text_u16);
-                    //                    std::cout << "Glyph text: " << glyph_text << std::endl;
+                    Pathfinder::Range cluster_in_para = {codepoint_offsets[current_cluster->start - para_start],
+                                                         codepoint_offsets[current_cluster->end - para_start]};
+                    para.clusters.push_back(cluster_in_para);
 
-                    // One glyph may have multiple codepoints.
-                    // E.g. स् = स + ्
-                    std::u32string glyph_text_u32;
-                    utf8_to_utf32(glyph_text, glyph_text_u32);
+                    size_t glyph = glyphs.add_glyph();
 
-                    Glyph glyph;
+                    // One glyph may have multiple codepoints.
+                    glyphs.cluster_starts[glyph] = cluster_in_para.start;
+                    glyphs.cluster_ends[glyph] = cluster_in_para.end;
 
-                    glyph.codepoints = glyph_text_u32;
+                    // Codepoint property is replaced with glyph ID after shaping.
+                    glyphs.glyph_indices[glyph] = info.codepoint;
 
-                    glyph.text = glyph_text;
+                    glyphs.font_indices[glyph] = font_index;
 
-                    // Codepoint property is replaced with glyph ID after shaping.
-                    glyph.index = info.codepoint;
+                    glyphs.scripts[glyph] = run_script;
 
-                    glyph.script = run_script;
+                    if (break_opportunities[info.cluster - para_start]) {
+                        // Only the logically first glyph of a cluster has the break before it.
+                        if (!run_is_rtl && (i == 0 || glyph_info[i - 1].cluster != info.cluster)) {
+                            break_boundaries.push_back(glyph);
+                        }
+                        if (run_is_rtl && (i == glyph_count - 1 || glyph_info[i + 1].cluster != info.cluster)) {
+                            break_boundaries.push_back(glyph + 1);
+                        }
+                    }
 
                     // Mark line breaks, so they're not drawn.
-                    if (glyph_text == "\n") {
-                        glyph.skip_drawing = true;
+                    if (glyph_text_u16 == u"\n") {
+                        glyphs.set_flag(glyph, GlyphRun::FLAG_SKIP_DRAWING, true);
                     } else {
-                        glyph.x_offset = (float)pos.x_offset * scale;
-                        glyph.y_offset = (float)pos.y_offset * scale * -1.0;
-
-                        glyph.x_advance = (float)pos.x_advance * scale;
-
-                        // Debug
-                        // {
-                        //     int bitmap_width;
-                        //     int bitmap_height;
-                        //     int bitmap_xoffset;
-                        //     int bitmap_yoffset;
-                        //
-                        //     auto bitmap_data = stbtt_GetGlyphBitmap(&stbtt_info,
-                        //                                             scale,
-                        //                                             scale,
-                        //                                             glyph.index,
-                        //                                             &bitmap_width,
-                        //                                             &bitmap_height,
-                        //                                             &bitmap_xoffset,
-                        //                                             &bitmap_yoffset);
-                        //
-                        //     stbi_write_png(("glyph_bitmap_" + glyph.text + ".png").c_str(),
-                        //                    bitmap_width,
-                        //                    bitmap_height,
-                        //                    1,
-                        //                    bitmap_data,
-                        //                    bitmap_width);
-                        //
-                        //     int _ = 0;
-                        // }
-
-                        para_width += glyph.x_advance;
-
-                        // Get glyph path.
-                        glyph.path = get_glyph_path(glyph.index, scale);
-
-                        // The glyph's layout box in the glyph's local coordinates.
-                        // The origin is the baseline. The Y axis is downward.
-                        glyph.box = RectF(0, (float)-ascent, glyph.x_advance, (float)-descent);
-
-                        // Get the glyph path's bounding box. The Y axis points down.
-                        RectI bounding_box = get_glyph_bounds(glyph.index, scale);
-
-                        // BBox in the glyph's local coordinates.
-                        glyph.bbox = bounding_box.to_f32();
-                    }
+                        glyphs.set_flag(glyph, GlyphRun::FLAG_SPACE, glyph_text_u16 == u" ");
+
+                        glyphs.x_offsets[glyph] = (float)pos.x_offset * scale;
+                        glyphs.y_offsets[glyph] = (float)pos.y_offset * scale * -1.0;
+
+                        glyphs.x_advances[glyph] = (float)pos.x_advance * scale;
 
-                    glyphs.push_back(glyph);
+                        para_width += glyphs.x_advances[glyph];
+                    }
                 }
+            }
 
-                hb_buffer_destroy(hb_buffer);
+            for (auto boundary : break_boundaries) {
+                if (boundary < glyphs.size()) {
+                    glyphs.set_flag(boundary, GlyphRun::FLAG_LINE_BREAKABLE, true);
+                }
             }
 
             // Record glyph start and end in the new paragraph.
-            Line para{};
             para.glyph_ranges = {para_glyph_start, glyphs.size()};
             para.rtl = para_is_rtl;
             para.width = para_width;
@@ -533,348 +653,381 @@ void Font::get_glyphs(const std::string &text,
     ubidi_close(para_bidi);
 }
 
-#else
-
-    #define FRIBIDI_MAX_STR_LEN 65000
-
-void Font::get_glyphs(const std::string &text,
-                      uint32_t font_size,
-                      std::vector<Glyph> &glyphs,
-                      std::vector<Line> &paragraphs) {
-    glyphs.clear();
-    paragraphs.clear();
-
-    // uint32_t units_per_em = hb_face_get_upem(harfbuzz_data->face);
-
-    std::u32string text_u32;
-    utf8_to_utf32(text, text_u32);
-
-    // Separation into paragraphs.
-    std::vector<Pathfinder::Range> para_ranges_unicode;
-    {
-        int new_para_start_idx = 0;
-        for (int char_idx = 0; char_idx < text_u32.size(); char_idx++) {
-            if (text_u32[char_idx] == 10) {
-                para_ranges_unicode.emplace_back((uint32_t)new_para_start_idx, (uint32_t)char_idx + 1);
-                new_para_start_idx = char_idx + 1;
-            }
-        }
-
-        if (!text_u32.empty() && text_u32.back() != 10) {
-            para_ranges_unicode.emplace_back((uint32_t)new_para_start_idx, (uint32_t)text_u32.size());
+void Font::shape_paragraph(std::u32string_view para_text_u32, uint32_t font_size, GlyphRun &glyphs, Line &para) {
+    // ICU and the HarfBuzz clusters work with UTF-16.
+    auto &para_text_u16 = ShapingScratch::get().para_text_u16;
+    para_text_u16.clear();
+    for (char32_t codepoint : para_text_u32) {
+        if (codepoint > 0xFFFF) {
+            para_text_u16.push_back((char16_t)U16_LEAD(codepoint));
+            para_text_u16.push_back((char16_t)U16_TRAIL(codepoint));
+        } else {
+            para_text_u16.push_back((char16_t)codepoint);
         }
     }
 
-    int para_count = para_ranges_unicode.size();
+    std::vector<Line> paragraphs;
+    get_glyphs_u16(para_text_u16, font_size, glyphs, paragraphs);
 
-    // Go through paragraphs.
-    for (int para_index = 0; para_index < para_count; para_index++) {
-        // Paragraph start and end in the whole text. Unit: u32char.
-        int para_start = para_ranges_unicode[para_index].start;
-        int para_end = para_ranges_unicode[para_index].end;
-        int para_length = para_end - para_start;
+    para = paragraphs.empty() ? Line{} : std::move(paragraphs.front());
+    para.glyph_ranges = {0, glyphs.size()};
+}
 
-        auto para_text_u32 = text_u32.substr(para_start, para_length);
-        auto para_text = utf32_to_utf8(para_text_u32);
-
-        // Get FriBidiChar data.
-        std::vector<FriBidiChar> fribidi_in_char(FRIBIDI_MAX_STR_LEN);
-        const FriBidiStrIndex fribidi_len = fribidi_charset_to_unicode(
-            FRIBIDI_CHAR_SET_UTF8, para_text.c_str(), para_text.size(), fribidi_in_char.data());
-
-        assert(fribidi_len < FRIBIDI_MAX_STR_LEN && fribidi_len == para_text_u32.size());
-        fribidi_in_char.resize(fribidi_len);
-
-        std::vector<FriBidiChar> fribidi_visual_char(fribidi_len);
-        std::vector<FriBidiLevel> embedding_level_list(fribidi_len);
-        std::vector<FriBidiStrIndex> position_logical_to_visual_list(fribidi_len);
-        std::vector<FriBidiStrIndex> position_visual_to_logical_list(fribidi_len);
-
-        // See https://www.unicode.org/reports/tr9/#Bidirectional_Character_Types
-        FriBidiCharType fribidi_pbase_dir = fribidi_get_bidi_type(fribidi_in_char.front());
-
-        // Logical list to visual list.
-        // This function only handles one-line paragraphs.
-        const FriBidiLevel max_level = fribidi_log2vis(fribidi_in_char.data(),
-                                                       fribidi_len,
-                                                       &fribidi_pbase_dir,
-                                                       fribidi_visual_char.data(),
-                                                       position_logical_to_visual_list.data(),
-                                                       position_visual_to_logical_list.data(),
-                                                       embedding_level_list.data());
-        assert(max_level != 0);
-
-        // if (max_level) {
-        //     std::string string_formatted_ptr(FRIBIDI_MAX_STR_LEN, 0);
-        //     const FriBidiStrIndex new_len = fribidi_unicode_to_charset(
-        //         FRIBIDI_CHAR_SET_UTF8, fribidi_visual_char.data(), fribidi_len, string_formatted_ptr.data());
-        //     assert(new_len < FRIBIDI_MAX_STR_LEN);
-        //     string_formatted_ptr.resize(new_len);
-        // }
+#else
 
-        // std::string para_text = utf32_to_utf8(text_u32.substr(para_start, para_end));
-        // std::cout << "Paragraph text: " << para_text << std::endl;
-        // std::cout << "Paragraph range: " << para_start << " -> " << para_end << std::endl;
+    #define FRIBIDI_MAX_STR_LEN 65000
 
-        bool para_is_rtl = false;
+static_assert(sizeof(FriBidiChar) == sizeof(char32_t), "FriBidiChar should be UTF-32!");
 
-        // The width of the paragraph in a single line.
-        float para_width = 0;
+void Font::shape_paragraph(std::u32string_view para_text_u32, uint32_t font_size, GlyphRun &glyphs, Line &para) {
+    auto &scratch = ShapingScratch::get();
 
-        // The first glyph in the new paragraph.
-        size_t para_glyph_start = glyphs.size();
+    glyphs.clear();
+    glyphs.reserve(para_text_u32.size());
+
+    para.clusters.clear();
+
+    int para_length = para_text_u32.size();
+
+    // FriBidiChar is UTF-32 already, so no charset conversion is needed.
+    auto fribidi_in_char = reinterpret_cast<const FriBidiChar *>(para_text_u32.data());
+    const FriBidiStrIndex fribidi_len = para_length;
+    assert(fribidi_len < FRIBIDI_MAX_STR_LEN);
+
+    auto &embedding_level_list = scratch.embedding_levels;
+    auto &position_visual_to_logical_list = scratch.visual_to_logical;
+    embedding_level_list.resize(fribidi_len);
+    position_visual_to_logical_list.resize(fribidi_len);
+
+    // See https://www.unicode.org/reports/tr9/#Bidirectional_Character_Types
+    FriBidiCharType fribidi_pbase_dir = fribidi_get_bidi_type(fribidi_in_char[0]);
+
+    // Logical list to visual list. Only the visual order and the levels are needed, not the visual text.
+    // This function only handles one-line paragraphs.
+    const FriBidiLevel max_level = fribidi_log2vis(fribidi_in_char,
+                                                   fribidi_len,
+                                                   &fribidi_pbase_dir,
+                                                   nullptr,
+                                                   nullptr,
+                                                   position_visual_to_logical_list.data(),
+                                                   embedding_level_list.data());
+    assert(max_level != 0);
+
+    bool para_is_rtl = false;
+
+    // The width of the paragraph in a single line.
+    float para_width = 0;
+
+    // Split the paragraph into runs of the same level.
+    auto &logical_para_runs = scratch.logical_runs;
+    auto &logical_para_levels = scratch.logical_run_levels;
+    logical_para_runs.clear();
+    logical_para_levels.clear();
+    {
+        FriBidiLevel current_level = embedding_level_list[0];
+        logical_para_levels.push_back(current_level);
 
-        // Get run count in the current paragraph.
+        int new_run_start_idx = 0;
 
-        std::vector<Pathfinder::Range> logical_para_runs;
-        std::vector<signed char> logical_para_levels;
-        {
-            signed char current_level = embedding_level_list[0];
-            logical_para_levels.push_back(current_level);
+        for (int char_idx = 0; char_idx < para_length; char_idx++) {
+            FriBidiLevel level = embedding_level_list[char_idx];
+            if (level != current_level) {
+                logical_para_runs.push_back({(uint32_t)new_run_start_idx, (uint32_t)char_idx});
+                new_run_start_idx = char_idx;
+                current_level = level;
 
-            int new_run_start_idx = 0;
+                logical_para_levels.push_back(level);
+            }
+        }
 
-            for (int char_idx = 0; char_idx < para_length; char_idx++) {
-                signed char level = embedding_level_list[char_idx];
-                if (level != current_level) {
-                    logical_para_runs.push_back({(uint32_t)new_run_start_idx, (uint32_t)char_idx});
-                    new_run_start_idx = char_idx;
-                    current_level = level;
+        logical_para_runs.push_back({(uint32_t)new_run_start_idx, (uint32_t)para_length});
+    }
 
-                    logical_para_levels.push_back(level);
-                }
-            }
+    // Reorder runs from logical to visual, in the visual order of their first codepoints.
+    auto &run_starting_at = scratch.run_starting_at;
+    run_starting_at.assign(para_length, -1);
+    for (size_t run_idx = 0; run_idx < logical_para_runs.size(); run_idx++) {
+        run_starting_at[logical_para_runs[run_idx].start] = run_idx;
+    }
 
-            logical_para_runs.push_back({(uint32_t)new_run_start_idx, (uint32_t)para_end});
+    auto &para_runs = scratch.visual_runs;
+    auto &para_levels = scratch.visual_run_levels;
+    para_runs.clear();
+    para_levels.clear();
+    for (const auto &char_idx : position_visual_to_logical_list) {
+        int32_t run_idx = run_starting_at[char_idx];
+        if (run_idx >= 0) {
+            para_runs.push_back(logical_para_runs[run_idx]);
+            para_levels.push_back(logical_para_levels[run_idx]);
         }
+    }
 
-        // Reorder runs from logical to visual.
-        std::vector<Pathfinder::Range> para_runs;
-        std::vector<signed char> para_levels;
-        for (const auto &char_idx : position_visual_to_logical_list) {
-            for (int run_idx = 0; run_idx < logical_para_runs.size(); run_idx++) {
-                auto run = logical_para_runs[run_idx];
-                auto level = logical_para_levels[run_idx];
-
-                if (char_idx == run.start) {
-                    para_runs.push_back(run);
-                    para_levels.push_back(level);
-                }
-            }
-        }
+    int32_t run_count = para_levels.size();
 
-        int32_t run_count = para_levels.size();
+    for (int32_t run_index = 0; run_index < run_count; run_index++) {
+        para_is_rtl |= para_levels[run_index] % 2 == 1;
+    }
 
-        for (int32_t run_index = 0; run_index < run_count; run_index++) {
-            signed char level = para_levels[run_index];
+    // Line break opportunities (UAX #14), which are kept in the shaping cache with the glyphs.
+    auto &break_opportunities = scratch.break_opportunities;
+    find_line_break_opportunities(para_text_u32, break_opportunities);
 
-            bool run_is_rtl = level % 2 == 1;
+    // Visual glyph boundaries where a line can break.
+    auto &break_boundaries = scratch.break_boundaries;
+    break_boundaries.clear();
 
-            para_is_rtl |= run_is_rtl;
-        }
+    hb_buffer_t *hb_buffer = scratch.hb_buffer;
 
-        std::vector<Pathfinder::Range> para_clusters;
+    // Go through runs.
+    for (int32_t run_index = 0; run_index < run_count; run_index++) {
+        FriBidiLevel level = para_levels[run_index];
+        auto run_range = para_runs[run_index];
 
-        // Go through runs.
-        for (int32_t run_index = 0; run_index < run_count; run_index++) {
-            signed char level = para_levels[run_index];
-            auto run_range = para_runs[run_index];
+        // Run start and end in the paragraph.
+        int32_t run_start = run_range.start;
+        int32_t run_length = run_range.end - run_range.start;
 
-            // Run start and end in the paragraph.
-            int32_t run_start = run_range.start;
-            int32_t run_length = run_range.end - run_range.start;
+        bool run_is_rtl = level % 2 == 1;
 
-            bool run_is_rtl = level % 2 == 1;
+        // Separate the run into script groups, so we can fall back font when necessary.
+        auto &run_script_ranges = scratch.script_ranges;
+        get_text_script(para_text_u32.substr(run_start, run_length), run_script_ranges);
 
-            // Get run text from the whole text.
-            std::u32string run_text_u32 = para_text_u32.substr(run_range.start, run_length);
+        if (run_is_rtl) {
+            std::reverse(run_script_ranges.begin(), run_script_ranges.end());
+        }
 
-            // Separate the run into script groups, so we can fall back font when necessary.
-            auto run_script_ranges = get_text_script(run_text_u32);
+        for (const auto &script_range : run_script_ranges) {
+            auto script = script_range.first;
+            auto script_range_in_run = script_range.second;
 
-            if (run_is_rtl) {
-                std::reverse(run_script_ranges.begin(), run_script_ranges.end());
-            }
+            uint32_t script_start = run_start + script_range_in_run.start;
+            uint32_t script_end = run_start + script_range_in_run.end;
+            uint32_t script_length = script_end - script_start;
 
-            for (const auto &script_range : run_script_ranges) {
-                auto script = script_range.first;
-                auto script_range_in_run = script_range.second;
+            auto script_text_u32 = para_text_u32.substr(script_start, script_length);
+            bool use_fallback_font = !face->get_coverage().contains_all(script_text_u32);
 
-                uint32_t script_start = run_start + script_range_in_run.start;
-                uint32_t script_end = run_start + script_range_in_run.end;
-                uint32_t script_length = script_end - script_start;
+            // Keep the fallback font alive while using it.
+            std::shared_ptr<Font> fallback_font;
 
-                std::u32string script_text_u32 = para_text_u32.substr(script_start, script_length);
-                bool use_fallback_font = !glyphs_exist_in_font(script_text_u32, this);
+            Font *font_to_use;
+            if (allow_fallback && use_fallback_font) {
+                fallback_font = TextServer::get_singleton()->find_fallback_font(script_text_u32);
+                font_to_use = fallback_font.get();
+            } else {
+                font_to_use = this;
+            }
 
-                Font *font_to_use;
-                if (allow_fallback && use_fallback_font) {
-                    font_to_use = DefaultResource::get_singleton()->get_default_font().get();
+            float ascent, descent;
+            float scale = font_to_use->update_metrics(font_size, ascent, descent);
+
+            uint16_t font_index =
+                glyphs.add_font({font_to_use->weak_from_this(), font_to_use->get_id(), font_size, ascent, descent});
+
+            // Buffers are sequences of Unicode characters that use the same font
+            // and have the same text direction, script, and language.
+            // The buffer is reused, which keeps its allocations.
+            hb_buffer_clear_contents(hb_buffer);
+
+            // Item offset and length should represent a specific run.
+            hb_buffer_add_utf32(hb_buffer,
+                                reinterpret_cast<const uint32_t *>(para_text_u32.data()),
+                                para_length,
+                                script_start,
+                                script_length);
+
+            hb_buffer_set_direction(hb_buffer, run_is_rtl ? HB_DIRECTION_RTL : HB_DIRECTION_LTR);
+            hb_buffer_set_script(hb_buffer, to_harfbuzz_script(script));
+
+            hb_shape(font_to_use->face->get_hb_font(), hb_buffer, nullptr, 0);
+
+            unsigned int glyph_count;
+            hb_glyph_info_t *glyph_info = hb_buffer_get_glyph_infos(hb_buffer, &glyph_count);
+            hb_glyph_position_t *glyph_pos = hb_buffer_get_glyph_positions(hb_buffer, &glyph_count);
+
+            // Shaped glyph positions will always be in one line (regardless of line breaks).
+            for (uint32_t i = 0; i < glyph_count; i++) {
+                auto &info = glyph_info[i];
+                auto &pos = glyph_pos[i];
+
+                // Cluster unit is u32char, so it should be worked with std::u32string instead of std::string.
+                std::optional<Pathfinder::Range> current_cluster;
+                if (!run_is_rtl) {
+                    if (i < glyph_count - 1) {
+                        // Multiple glyphs may share the same cluster.
+                        for (uint32_t j = 1; i + j < glyph_count; j++) {
+                            if (info.cluster != glyph_info[i + j].cluster) {
+                                current_cluster = {info.cluster, glyph_info[i + j].cluster};
+                                break;
+                            }
+                        }
+                    }
+                    if (!current_cluster.has_value()) {
+                        current_cluster = {info.cluster, run_range.start + script_range_in_run.end};
+                    }
                 } else {
-                    font_to_use = this;
+                    if (i > 0) {
+                        // Multiple glyphs may share the same cluster.
+                        for (uint32_t j = 1; j <= i; j++) {
+                            if (info.cluster != glyph_info[i - j].cluster) {
+                                current_cluster = {info.cluster, glyph_info[i - j].cluster};
+                                break;
+                            }
+                        }
+                    }
+                    if (!current_cluster.has_value()) {
+                        current_cluster = {info.cluster, run_range.start + script_range_in_run.end};
+                    }
                 }
 
-                float ascent, descent;
-                float scale = font_to_use->update_metrics(font_size, ascent, descent);
+                para.clusters.push_back(*current_cluster);
 
-                // Buffers are sequences of Unicode characters that use the same font
-                // and have the same text direction, script, and language.
-                hb_buffer_t *hb_buffer = hb_buffer_create();
+                auto glyph_text_u32 = para_text_u32.substr(current_cluster->start, current_cluster->length());
 
-                // Item offset and length should represent a specific run.
-                hb_buffer_add_utf32(hb_buffer,
-                                    reinterpret_cast<const uint32_t *>(para_text_u32.c_str()),
-                                    -1,
-                                    script_start,
-                                    script_length);
+                size_t glyph = glyphs.add_glyph();
 
-                hb_buffer_set_direction(hb_buffer, run_is_rtl ? HB_DIRECTION_RTL : HB_DIRECTION_LTR);
-                hb_buffer_set_script(hb_buffer, to_harfbuzz_script(script));
+                // One glyph may have multiple codepoints.
+                // E.g. स् = स + ्
+                glyphs.cluster_starts[glyph] = current_cluster->start;
+                glyphs.cluster_ends[glyph] = current_cluster->end;
 
-                hb_shape(font_to_use->harfbuzz_data->font, hb_buffer, nullptr, 0);
+                // Codepoint property is replaced with glyph ID after shaping.
+                glyphs.glyph_indices[glyph] = info.codepoint;
 
-                unsigned int glyph_count;
-                hb_glyph_info_t *glyph_info = hb_buffer_get_glyph_infos(hb_buffer, &glyph_count);
-                hb_glyph_position_t *glyph_pos = hb_buffer_get_glyph_positions(hb_buffer, &glyph_count);
+                glyphs.font_indices[glyph] = font_index;
 
-                std::vector<hb_glyph_info_t> debug_glyph_info(glyph_count);
-                for (int i = 0; i < glyph_count; i++) {
-                    debug_glyph_info[i] = glyph_info[i];
+                glyphs.scripts[glyph] = script;
+
+                if (break_opportunities[info.cluster]) {
+                    // Only the logically first glyph of a cluster has the break before it.
+                    if (!run_is_rtl && (i == 0 || glyph_info[i - 1].cluster != info.cluster)) {
+                        break_boundaries.push_back(glyph);
+                    }
+                    if (run_is_rtl && (i == glyph_count - 1 || glyph_info[i + 1].cluster != info.cluster)) {
+                        break_boundaries.push_back(glyph + 1);
+                    }
                 }
 
-                // Shaped glyph positions will always be in one line (regardless of line breaks).
-                for (int i = 0; i < glyph_count; i++) {
-                    auto &info = glyph_info[i];
-                    auto &pos = glyph_pos[i];
+                // Mark line breaks, so they're not drawn.
+                if (glyph_text_u32 == U"\n") {
+                    glyphs.set_flag(glyph, GlyphRun::FLAG_SKIP_DRAWING, true);
+                } else {
+                    glyphs.set_flag(glyph, GlyphRun::FLAG_SPACE, glyph_text_u32 == U" ");
 
-                    // Cluster unit is u32char, so it should be worked with std::u32string instead of std::string.
-                    std::optional<Pathfinder::Range> current_cluster;
-                    if (!run_is_rtl) {
-                        if (i < glyph_count - 1) {
-                            // Multiple glyphs may share the same cluster.
-                            for (int j = 1; i + j < glyph_count; j++) {
-                                if (info.cluster != glyph_info[i + j].cluster) {
-                                    current_cluster = {info.cluster, glyph_info[i + j].cluster};
-                                    break;
-                                }
-                            }
-                        }
-                        if (!current_cluster.has_value()) {
-                            current_cluster = {info.cluster, run_range.start + script_range_in_run.end};
-                        }
-                    } else {
-                        if (i > 0) {
-                            // Multiple glyphs may share the same cluster.
-                            for (int j = 1; i - j >= 0; j++) {
-                                if (info.cluster != glyph_info[i - j].cluster) {
-                                    current_cluster = {info.cluster, glyph_info[i - j].cluster};
-                                    break;
-                                }
-                            }
-                        }
-                        if (!current_cluster.has_value()) {
-                            current_cluster = {info.cluster, run_range.start + script_range_in_run.end};
-                        }
-                    }
+                    glyphs.x_offsets[glyph] = (float)pos.x_offset * scale;
+                    glyphs.y_offsets[glyph] = (float)pos.y_offset * scale * -1.0;
 
-                    para_clusters.push_back(*current_cluster);
+                    glyphs.x_advances[glyph] = (float)pos.x_advance * scale;
 
-                    std::u32string glyph_text_u32 =
-                        para_text_u32.substr(current_cluster->start, current_cluster->length());
+                    para_width += glyphs.x_advances[glyph];
+                }
+            }
+        }
+    }
 
-                    std::string glyph_text = utf32_to_utf8(glyph_text_u32);
-                    //                    std::cout << "Glyph text: " << glyph_text << std::endl;
+    // A break before a logical cluster is after it visually in RTL runs.
+    for (auto boundary : break_boundaries) {
+        if (boundary < glyphs.size()) {
+            glyphs.set_flag(boundary, GlyphRun::FLAG_LINE_BREAKABLE, true);
+        }
+    }
 
-                    Glyph glyph;
+    // Record glyph start and end in the paragraph.
+    para.glyph_ranges = {0, glyphs.size()};
+    para.rtl = para_is_rtl;
+    para.width = para_width;
+}
 
-                    glyph.start = current_cluster->start;
-                    glyph.end = current_cluster->end;
+void Font::get_glyphs(const std::string &text,
+                      uint32_t font_size,
+                      GlyphRun &glyphs,
+                      std::vector<Line> &paragraphs) {
+    glyphs.clear();
+    paragraphs.clear();
 
-                    glyph.ascent = ascent;
-                    glyph.descent = descent;
+    // uint32_t units_per_em = hb_face_get_upem(face->get_hb_face());
 
-                    // One glyph may have multiple codepoints.
-                    // E.g. स् = स + ्
-                    glyph.codepoints = glyph_text_u32;
+    std::u32string text_u32;
+    utf8_to_utf32(text, text_u32);
 
-                    glyph.text = glyph_text;
+    // Separation into paragraphs.
+    std::vector<Pathfinder::Range> para_ranges_unicode;
+    {
+        size_t new_para_start_idx = 0;
+        for (size_t char_idx = 0; char_idx < text_u32.size(); char_idx++) {
+            if (text_u32[char_idx] == 10) {
+                para_ranges_unicode.emplace_back((uint32_t)new_para_start_idx, (uint32_t)char_idx + 1);
+                new_para_start_idx = char_idx + 1;
+            }
+        }
 
-                    // Codepoint property is replaced with glyph ID after shaping.
-                    glyph.index = info.codepoint;
+        if (!text_u32.empty() && text_u32.back() != 10) {
+            para_ranges_unicode.emplace_back((uint32_t)new_para_start_idx, (uint32_t)text_u32.size());
+        }
+    }
 
-                    glyph.script = script;
+    int para_count = para_ranges_unicode.size();
 
-                    // Mark line breaks, so they're not drawn.
-                    if (glyph_text == "\n") {
-                        glyph.skip_drawing = true;
-                    } else {
-                        glyph.x_offset = (float)pos.x_offset * scale;
-                        glyph.y_offset = (float)pos.y_offset * scale * -1.0;
-
-                        glyph.x_advance = (float)pos.x_advance * scale;
-
-                        // Debug
-                        // {
-                        //     int bitmap_width;
-                        //     int bitmap_height;
-                        //     int bitmap_xoffset;
-                        //     int bitmap_yoffset;
-                        //
-                        //     auto bitmap_data = stbtt_GetGlyphBitmap(&stbtt_info,
-                        //                                             scale,
-                        //                                             scale,
-                        //                                             glyph.index,
-                        //                                             &bitmap_width,
-                        //                                             &bitmap_height,
-                        //                                             &bitmap_xoffset,
-                        //                                             &bitmap_yoffset);
-                        //
-                        //     stbi_write_png(("glyph_bitmap_" + glyph.text + ".png").c_str(),
-                        //                    bitmap_width,
-                        //                    bitmap_height,
-                        //                    1,
-                        //                    bitmap_data,
-                        //                    bitmap_width);
-                        //
-                        //     int _ = 0;
-                        // }
-
-                        para_width += glyph.x_advance;
-
-                        // Get glyph path.
-                        glyph.path = font_to_use->get_glyph_path(glyph.index, scale);
-
-                        // The glyph's layout box in the glyph's local coordinates.
-                        // The origin is the baseline. The Y axis is downward.
-                        glyph.box = RectF(0, -ascent, glyph.x_advance, -descent);
-
-                        // Get the glyph path's bounding box. The Y axis points down.
-                        RectI bounding_box = font_to_use->get_glyph_bounds(glyph.index, scale);
-
-                        // BBox in the glyph's local coordinates.
-                        glyph.bbox = bounding_box.to_f32();
-                    }
+    // Go through paragraphs.
+    for (int para_index = 0; para_index < para_count; para_index++) {
+        // Paragraph start and end in the whole text. Unit: u32char.
+        int para_start = para_ranges_unicode[para_index].start;
+        int para_end = para_ranges_unicode[para_index].end;
+        int para_length = para_end - para_start;
 
-                    glyphs.push_back(glyph);
-                }
+        auto shaped_para = get_shaped_paragraph(text_u32.substr(para_start, para_length), font_size);
 
-                hb_buffer_destroy(hb_buffer);
-            }
-        }
+        // The first glyph in the new paragraph.
+        size_t para_glyph_start = glyphs.size();
 
-        // Record glyph start and end in the new paragraph.
-        Line para{};
+        glyphs.splice(glyphs.size(), glyphs.size(), shaped_para->glyphs);
+
+        // Record glyph start and end in the whole text.
+        Line para = shaped_para->line;
         para.glyph_ranges = {para_glyph_start, glyphs.size()};
-        para.rtl = para_is_rtl;
-        para.width = para_width;
-        para.clusters = para_clusters;
         paragraphs.push_back(para);
     }
 }
 
 #endif
 
+std::shared_ptr<const ShapedParagraph> Font::get_shaped_paragraph(std::u32string_view para_text_u32,
+                                                                  uint32_t font_size) {
+    {
+        std::lock_guard lock(shaping_cache_mutex);
+
+        // Cached shaping results are only valid for the fallback fonts they were shaped with.
+        auto default_font = DefaultResource::get_singleton()->get_default_font();
+        auto fallback_version = TextServer::get_singleton()->get_fallback_version();
+        if (shaping_cache_fallback_font.lock() != default_font || shaping_cache_fallback_version != fallback_version) {
+            shaping_cache.clear();
+            shaping_cache_fallback_font = default_font;
+            shaping_cache_fallback_version = fallback_version;
+        }
+
+        auto shaped_para = shaping_cache.find(font_size, para_text_u32);
+        if (shaped_para) {
+            return shaped_para;
+        }
+    }
+
+    // Shape without holding the lock, so that other threads can shape with the font meanwhile.
+    // If two threads shape the same paragraph, their results are the same.
+    auto new_shaped_para = std::make_shared<ShapedParagraph>();
+    shape_paragraph(para_text_u32, font_size, new_shaped_para->glyphs, new_shaped_para->line);
+
+    std::lock_guard lock(shaping_cache_mutex);
+    shaping_cache.insert(font_size, para_text_u32, new_shaped_para);
+
+    return new_shaped_para;
+}
+
 uint16_t Font::find_glyph_index_by_codepoint(int codepoint) {
+    if (!face->get_coverage().contains(codepoint)) {
+        return 0;
+    }
+
     return stbtt_FindGlyphIndex(stbtt_info, codepoint);
 }
 
@@ -909,7 +1062,11 @@ float Font::get_glyph_advance(uint16_t glyph_index, float scale) const {
 }
 
 bool Font::is_valid() const {
-    return !font_data.empty();
+    return face->is_valid();
+}
+
+std::shared_ptr<FontFace> Font::get_face() const {
+    return face;
 }
 
 } // namespace Flint
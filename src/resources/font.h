@@ -3,83 +3,25 @@
 
 #include <pathfinder/prelude.h>
 
-#include <codecvt>
 #include <cstdio>
 #include <cstdlib>
-#include <locale>
+#include <mutex>
+#include <string_view>
 
 #include "../common/geometry.h"
+#include "../common/utf.h"
 #include "../common/utils.h"
+#include "font_face.h"
+#include "glyph_cache.h"
+#include "glyph_run.h"
 #include "resource.h"
+#include "shaping_cache.h"
+#include "stroked_glyph_cache.h"
 
 struct stbtt_fontinfo;
 
 namespace Flint {
 
-template <typename T>
-void utf8_to_utf16(const std::string &source, std::basic_string<T> &result) {
-    std::wstring_convert<std::codecvt_utf8_utf16<T>, T> convertor;
-    result = convertor.from_bytes(source);
-
-    if (convertor.converted() < source.size()) {
-        throw std::runtime_error("Incomplete utf16-to-utf8 conversion!");
-    }
-}
-
-template <typename T>
-std::string utf16_to_utf8(const std::basic_string<T> &source) {
-    std::wstring_convert<std::codecvt_utf8_utf16<T>, T> convertor;
-    std::string result = convertor.to_bytes(source);
-
-    if (convertor.converted() < source.size()) {
-        throw std::runtime_error("Incomplete utf8-to-utf16 conversion!");
-    }
-
-    return result;
-}
-
-template <typename T>
-void utf8_to_utf32(const std::string &source, std::basic_string<T> &result) {
-    std::wstring_convert<std::codecvt_utf8<char32_t>, T> convertor;
-    result = convertor.from_bytes(source);
-
-    if (convertor.converted() < source.size()) {
-        throw std::runtime_error("Incomplete utf8-to-utf32 conversion!");
-    }
-}
-
-template <typename T>
-std::string utf32_to_utf8(const std::basic_string<T> &source) {
-    std::wstring_convert<std::codecvt_utf8<char32_t>, T> convertor;
-    std::string result = convertor.to_bytes(source);
-
-    if (convertor.converted() < source.size()) {
-        throw std::runtime_error("Incomplete utf32-to-utf8 conversion!");
-    }
-
-    return result;
-}
-
-// // This should convert to whatever the system-wide character encoding
-// // is for the platform (UTF-32/Linux - UCS-2/Windows)
-// std::string ws_to_utf8(std::wstring const &s) {
-//     std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> cnv;
-//     std::string utf8 = cnv.to_bytes(s);
-//     if (cnv.converted() < s.size()) {
-//         throw std::runtime_error("Incomplete wstring-to-utf8 conversion!");
-//     }
-//     return utf8;
-// }
-//
-// std::wstring utf8_to_ws(std::string const &utf8) {
-//     std::wstring_convert<std::codecvt_utf8<wchar_t>, wchar_t> cnv;
-//     std::wstring s = cnv.from_bytes(utf8);
-//     if (cnv.converted() < utf8.size()) {
-//         throw std::runtime_error("Incomplete utf8-to-wstring conversion!");
-//     }
-//     return s;
-// }
-
 struct TextStyle {
     ColorU color = ColorU::white();
     ColorU stroke_color;
@@ -89,67 +31,6 @@ struct TextStyle {
     bool debug = false;
 };
 
-enum class Script {
-    Common = 0,
-    Arabic,
-    Bengali,
-    Devanagari,
-    Hebrew,
-    Cjk,
-    Hiragana,
-    Katakana,
-    Thai,
-};
-
-// Text-context-dependent glyph data.
-struct Glyph {
-    // Glyph index (font specific). Zero for invalid glyphs.
-    // A particular glyph ID within the font does not necessarily correlate to a predictable Unicode codepoint.
-    uint16_t index = 0;
-
-    std::u32string codepoints;
-
-    std::string text;
-
-    // Start codepoint index in the text.
-    int start = 0;
-
-    // End codepoint index in the text.
-    int end = 0;
-
-    bool emoji = false;
-
-    Script script = Script::Common;
-
-    float x_offset = 0; // Offset from the origin of the glyph on baseline.
-    float y_offset = 0;
-
-    float x_advance = 0; // Advance to the next glyph along baseline (x for horizontal layout, y for vertical).
-    float y_advance = 0;
-
-    float ascent = 0;
-    float descent = 0;
-
-    bool skip_drawing = false;
-
-    // Glyph path. The points are in the glyph's baseline coordinates.
-    Pathfinder::Path2d path;
-
-    // Only emojis have SVG data.
-    //
-    // The points' origin is not top-left (like normal SVG images) but the font baseline,
-    // so the points don't fall in the view box specified by the image.
-    // Therefore, we need to pass an appropriate transform when appending the SVG scene.
-    std::string svg;
-
-    /// Glyph box in the baseline coordinates, which has nothing to do with the glyph position in the text paragraph.
-    RectF box;
-
-    /// Glyph path's bounding box in the baseline coordinates, which has nothing to do with the glyph position in the
-    /// text paragraph.
-    RectF bbox;
-};
-
 struct Line {
     Pathfinder::Range glyph_ranges;
     bool rtl = false;
@@ -157,15 +38,22 @@ struct Line {
     std::vector<Pathfinder::Range> clusters;
 };
 
-struct HarfBuzzData;
+/// Shaping result of a single paragraph. Glyph ranges and clusters are relative to the paragraph.
+struct ShapedParagraph {
+    GlyphRun glyphs;
+    Line line;
+};
 
 // A font is pointsize-carefree.
-class Font : public Resource {
+class Font : public Resource, public std::enable_shared_from_this<Font> {
 public:
     explicit Font(const std::string &path);
 
     explicit Font(const std::vector<char> &bytes);
 
+    /// Create a font using a face loaded by the TextServer.
+    explicit Font(std::shared_ptr<FontFace> font_face);
+
     ~Font() override;
 
     bool is_valid() const;
@@ -174,38 +62,98 @@ public:
 
     std::string get_glyph_svg(uint16_t glyph_index) const;
 
+    /// If the glyph has an SVG document, without copying it.
+    bool has_glyph_svg(uint16_t glyph_index) const;
+
     /// Paragraphs and lines are different concepts.
     /// Paragraphs are seperated by line breaks, while lines are produced by further layouting.
     /// A paragraph may contain one or more lines.
     void get_glyphs(const std::string &text,
                     uint32_t font_size,
-                    std::vector<Glyph> &glyphs,
+                    GlyphRun &glyphs,
                     std::vector<Line> &paragraphs);
 
+    /// Shape a single paragraph, whose only line break, if any, is the last codepoint.
+    /// Glyph ranges and clusters of the result are relative to the paragraph. Results are cached.
+    /// Can be called from multiple threads, e.g. by the shaping prepass of the scene tree.
+    std::shared_ptr<const ShapedParagraph> get_shaped_paragraph(std::u32string_view para_text_u32, uint32_t font_size);
+
     uint16_t find_glyph_index_by_codepoint(int codepoint);
 
     float get_glyph_advance(uint16_t glyph_index, float scale) const;
 
     RectI get_glyph_bounds(uint16_t glyph_index, float scale) const;
 
-    std::shared_ptr<HarfBuzzData> harfbuzz_data;
+    /// Get the path, bbox and advance of a glyph at a specific font size.
+    /// Glyph data is only decoded from the font file when it's not in the glyph cache.
+    /// @note The returned reference is only valid until the next call. It's not const as the canvas takes paths by
+    /// non-const reference.
+    CachedGlyph &get_cached_glyph(uint16_t glyph_index, uint32_t font_size);
+
+    /// Get the outline of a stroked glyph at a specific font size, which is filled with the winding rule.
+    /// The stroke is only converted to a fill when it's not in the stroked glyph cache.
+    /// @note The returned reference is only valid until the next call.
+    const Pathfinder::Outline &get_stroked_glyph(uint16_t glyph_index, uint32_t font_size, const GlyphStroke &stroke);
+
+    /// Unique among all the fonts created, so glyphs from different fonts can be told apart.
+    uint32_t get_id() const;
+
+    std::shared_ptr<FontFace> get_face() const;
+
+    GlyphCache &get_glyph_cache();
+
+    StrokedGlyphCache &get_stroked_glyph_cache();
+
+    /// @note Not synchronized with concurrent shaping.
+    ShapingCache &get_shaping_cache();
 
 private:
-    /// Stores font data, should not be freed until font is deleted.
-    unsigned char *stbtt_buffer{};
+    void init();
+
+    /// Font data and tables, shared with other fonts using the same data.
+    std::shared_ptr<FontFace> face;
 
-    stbtt_fontinfo *stbtt_info{};
+    /// Owned by the face.
+    const stbtt_fontinfo *stbtt_info{};
+
+    uint32_t id = 0;
 
     /// Will fall back to the default font for unfound glyphs.
     bool allow_fallback = true;
 
-    // Obsoleted, caching glyphs requires setting a font size, which we don't do to a font.
-    std::unordered_map<uint16_t, Glyph> glyph_cache;
+    /// Decoded glyphs of all the font sizes in use.
+    GlyphCache glyph_cache;
+
+    /// Stroked outlines of decoded glyphs, for outlined and pseudo bold text.
+    StrokedGlyphCache stroked_glyph_cache;
 
-    // Raw font data, read directly from a file or from memory.
-    std::vector<char> font_data;
+    /// Shaped paragraphs of all the font sizes in use.
+    ShapingCache shaping_cache;
+
+    /// The fallback fonts the cached paragraphs were shaped with.
+    std::weak_ptr<Font> shaping_cache_fallback_font;
+    uint64_t shaping_cache_fallback_version = 0;
+
+    /// Guards the shaping cache and its fallback state. Shaping itself runs outside of the lock.
+    std::mutex shaping_cache_mutex;
+
+    /// Unscaled vertical metrics, which are the same for all font sizes.
+    int unscaled_ascent = 0;
+    int unscaled_descent = 0;
 
     float update_metrics(uint32_t size, float &ascent, float &descent);
+
+    /// Shape a single paragraph with bidi and script itemization, bypassing the shaping cache.
+    /// Temporary buffers are kept per thread, so only the output is allocated once they have grown.
+    void shape_paragraph(std::u32string_view para_text_u32, uint32_t font_size, GlyphRun &glyphs, Line &para);
+
+#ifndef FLINT_USE_FRIBIDI
+    /// Like get_glyphs(), for text in UTF-16, which ICU and the HarfBuzz clusters work with.
+    void get_glyphs_u16(std::u16string_view text_u16,
+                        uint32_t font_size,
+                        GlyphRun &glyphs,
+                        std::vector<Line> &paragraphs);
+#endif
 };
 
 } // namespace Flint
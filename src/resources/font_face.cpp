@@ -0,0 +1,179 @@
+#include "font_face.h"
+
+#include <algorithm>
+
+#include <stb/stb_truetype.h>
+
+#include <hb.h>
+
+#include "../common/utils.h"
+
+namespace Flint {
+
+CodepointCoverage::CodepointCoverage() = default;
+
+void CodepointCoverage::add(char32_t codepoint) {
+    if (codepoint > MAX_CODEPOINT || contains(codepoint)) {
+        return;
+    }
+
+    auto &leaf_index = block_leaves[codepoint >> 8];
+    if (leaf_index == 0) {
+        leaves.push_back({});
+        leaf_index = leaves.size();
+    }
+
+    leaves[leaf_index - 1][(codepoint >> 6) & 3] |= uint64_t(1) << (codepoint & 63);
+    codepoint_count++;
+}
+
+bool CodepointCoverage::contains_all(std::u32string_view codepoints) const {
+    for (const auto &c : codepoints) {
+        // Skip line breaks.
+        if (c == 0x000A) {
+            continue;
+        }
+        if (!contains(c)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+size_t CodepointCoverage::get_codepoint_count() const {
+    return codepoint_count;
+}
+
+struct HarfBuzzData {
+    hb_blob_t *blob{};
+    hb_face_t *face{};
+    hb_font_t *font{};
+
+    HarfBuzzData() = default;
+
+    HarfBuzzData(const char *data, size_t size) {
+        // We need to keep the data valid for HarfBuzz to work properly.
+        blob = hb_blob_create(data, size, HB_MEMORY_MODE_READONLY, nullptr, nullptr);
+        face = hb_face_create(blob, 0);
+        font = hb_font_create(face);
+    }
+
+    ~HarfBuzzData() {
+        if (font) {
+            hb_font_destroy(font);
+        }
+        if (face) {
+            hb_face_destroy(face);
+        }
+        if (blob) {
+            hb_blob_destroy(blob);
+        }
+    }
+};
+
+FontFace::FontFace(std::vector<char> bytes) : owned_data(std::move(bytes)) {
+    font_data = owned_data.data();
+    font_data_size = owned_data.size();
+
+    init();
+}
+
+FontFace::FontFace(std::unique_ptr<MappedFile> file) : mapped_file(std::move(file)) {
+    if (mapped_file && mapped_file->is_valid()) {
+        font_data = mapped_file->data();
+        font_data_size = mapped_file->size();
+    }
+
+    init();
+}
+
+FontFace::FontFace(const void *static_data, size_t size) {
+    font_data = static_cast<const char *>(static_data);
+    font_data_size = size;
+
+    init();
+}
+
+void FontFace::init() {
+    // Prepare font info.
+    stbtt_info = new stbtt_fontinfo;
+    if (font_data_size == 0 ||
+        !stbtt_InitFont(stbtt_info, reinterpret_cast<const unsigned char *>(font_data), 0)) {
+        Logger::error("Failed to prepare font info!", "Flint");
+    }
+
+    harfbuzz_data = std::make_unique<HarfBuzzData>(font_data, font_data_size);
+
+    // Build the coverage from the cmap table once, so that fallback doesn't need to look up glyphs.
+    hb_set_t *unicodes = hb_set_create();
+    hb_face_collect_unicodes(harfbuzz_data->face, unicodes);
+
+    hb_codepoint_t codepoint = HB_SET_VALUE_INVALID;
+    while (hb_set_next(unicodes, &codepoint)) {
+        coverage.add(codepoint);
+    }
+
+    hb_set_destroy(unicodes);
+}
+
+FontFace::~FontFace() {
+    delete stbtt_info;
+}
+
+bool FontFace::is_valid() const {
+    return font_data_size > 0;
+}
+
+const stbtt_fontinfo *FontFace::get_stbtt_info() const {
+    return stbtt_info;
+}
+
+hb_face_t *FontFace::get_hb_face() const {
+    return harfbuzz_data->face;
+}
+
+hb_font_t *FontFace::get_hb_font() const {
+    return harfbuzz_data->font;
+}
+
+const CodepointCoverage &FontFace::get_coverage() const {
+    return coverage;
+}
+
+uint64_t FontFace::get_data_hash() const {
+    std::call_once(data_hash_flag, [this] {
+        // 64-bit FNV-1a.
+        uint64_t hash = 0xcbf29ce484222325ull;
+        auto hash_bytes = [&hash](const char *bytes, size_t count) {
+            for (size_t i = 0; i < count; i++) {
+                hash = (hash ^ (uint8_t)bytes[i]) * 0x100000001b3ull;
+            }
+        };
+
+        // Fingerprint a bounded part of the data instead of all of it, which would touch every mapped page.
+        // The table directory holds the checksum of each table, and the checksum adjustment of the head table
+        // covers the whole file.
+        hash_bytes(reinterpret_cast<const char *>(&font_data_size), sizeof(font_data_size));
+
+        auto data = reinterpret_cast<const uint8_t *>(font_data);
+        size_t font_start = stbtt_info->fontstart;
+
+        if (font_start + 12 <= font_data_size) {
+            size_t table_count = data[font_start + 4] << 8 | data[font_start + 5];
+            size_t directory_size = std::min<size_t>(12 + table_count * 16, font_data_size - font_start);
+            hash_bytes(font_data + font_start, directory_size);
+        }
+
+        // Checksum adjustment after the version and the revision.
+        size_t head = stbtt_info->head;
+        if (head != 0 && head + 12 <= font_data_size) {
+            hash_bytes(font_data + head + 8, 4);
+        }
+
+        data_hash = hash;
+    });
+
+    return data_hash;
+}
+
+} // namespace Flint
@@ -0,0 +1,120 @@
+#ifndef FLINT_FONT_FACE_H
+#define FLINT_FONT_FACE_H
+
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../common/mapped_file.h"
+
+struct stbtt_fontinfo;
+struct hb_face_t;
+struct hb_font_t;
+
+namespace Flint {
+
+/// Set of codepoints supported by a font, stored as a two-level sparse bitset.
+/// Blocks of 256 codepoints without any supported codepoint take no leaf.
+class CodepointCoverage {
+public:
+    CodepointCoverage();
+
+    void add(char32_t codepoint);
+
+    bool contains(char32_t codepoint) const {
+        if (codepoint > MAX_CODEPOINT) {
+            return false;
+        }
+
+        auto leaf_index = block_leaves[codepoint >> 8];
+        if (leaf_index == 0) {
+            return false;
+        }
+
+        return (leaves[leaf_index - 1][(codepoint >> 6) & 3] >> (codepoint & 63)) & 1;
+    }
+
+    /// Line breaks are ignored, as they're never drawn.
+    bool contains_all(std::u32string_view codepoints) const;
+
+    size_t get_codepoint_count() const;
+
+private:
+    static constexpr char32_t MAX_CODEPOINT = 0x10FFFF;
+
+    static constexpr size_t BLOCK_COUNT = (MAX_CODEPOINT + 1) / 256;
+
+    // One-based leaf index for each block of 256 codepoints. Zero means an empty block.
+    std::array<uint16_t, BLOCK_COUNT> block_leaves{};
+
+    std::vector<std::array<uint64_t, 4>> leaves;
+
+    size_t codepoint_count = 0;
+};
+
+struct HarfBuzzData;
+
+/// Font data and parsed font tables, shared by all fonts using the same font file.
+/// Faces are owned by the TextServer.
+class FontFace {
+public:
+    /// Use a copy of the font data.
+    explicit FontFace(std::vector<char> bytes);
+
+    /// Use a read-only file mapping in place.
+    explicit FontFace(std::unique_ptr<MappedFile> file);
+
+    /// Use static data in place, e.g. a font embedded in the binary. The data must outlive the face.
+    FontFace(const void *static_data, size_t size);
+
+    ~FontFace();
+
+    FontFace(const FontFace &) = delete;
+
+    FontFace &operator=(const FontFace &) = delete;
+
+    bool is_valid() const;
+
+    const stbtt_fontinfo *get_stbtt_info() const;
+
+    hb_face_t *get_hb_face() const;
+
+    hb_font_t *get_hb_font() const;
+
+    const CodepointCoverage &get_coverage() const;
+
+    /// Fingerprint of the font data, to identify the font across runs. Only hashes the size, the table directory
+    /// and the checksum adjustment, so it's cheap even for large fonts. Computed on the first call.
+    uint64_t get_data_hash() const;
+
+private:
+    void init();
+
+    // Font data owned by the face, if it was loaded as a copy.
+    std::vector<char> owned_data;
+
+    // File mapping owned by the face, if it was loaded from a file.
+    std::unique_ptr<MappedFile> mapped_file;
+
+    // Raw font data in use, read in place by both stb_truetype and HarfBuzz.
+    // Should not be freed until the face is deleted.
+    const char *font_data = nullptr;
+    size_t font_data_size = 0;
+
+    stbtt_fontinfo *stbtt_info{};
+
+    std::unique_ptr<HarfBuzzData> harfbuzz_data;
+
+    CodepointCoverage coverage;
+
+    mutable std::once_flag data_hash_flag;
+    mutable uint64_t data_hash = 0;
+};
+
+} // namespace Flint
+
+#endif // FLINT_FONT_FACE_H
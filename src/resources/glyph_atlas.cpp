@@ -0,0 +1,392 @@
+#include "glyph_atlas.h"
+
+#include <stb/stb_truetype.h>
+
+#include <algorithm>
+
+namespace Flint {
+
+/// Transparent pixels between glyphs, so that sampling never bleeds into a neighbour.
+constexpr int GLYPH_PADDING = 1;
+
+/// stbtt_vertex stores coordinates as shorts, so points are converted to fixed point.
+constexpr float FIXED_POINT_SCALE = 64.0f;
+
+/// Convert a glyph outline in pixels to stb_truetype vertices.
+/// Returns false if the outline doesn't fit in the fixed point range.
+static bool outline_to_stbtt_vertices(const Pathfinder::Outline &outline, std::vector<stbtt_vertex> &vertices) {
+    constexpr float MAX_COORDINATE = 32767.0f / FIXED_POINT_SCALE;
+
+    auto add_vertex = [&](unsigned char type, Vec2F p, Vec2F c0 = {}, Vec2F c1 = {}) {
+        stbtt_vertex v{};
+        v.type = type;
+        v.x = (stbtt_vertex_type)std::round(p.x * FIXED_POINT_SCALE);
+        v.y = (stbtt_vertex_type)std::round(p.y * FIXED_POINT_SCALE);
+        v.cx = (stbtt_vertex_type)std::round(c0.x * FIXED_POINT_SCALE);
+        v.cy = (stbtt_vertex_type)std::round(c0.y * FIXED_POINT_SCALE);
+        v.cx1 = (stbtt_vertex_type)std::round(c1.x * FIXED_POINT_SCALE);
+        v.cy1 = (stbtt_vertex_type)std::round(c1.y * FIXED_POINT_SCALE);
+        vertices.push_back(v);
+    };
+
+    for (const auto &contour : outline.contours) {
+        const auto &points = contour.points;
+        const auto &flags = contour.flags;
+        size_t n = points.size();
+
+        if (n == 0) {
+            continue;
+        }
+
+        for (const auto &p : points) {
+            if (std::abs(p.x) > MAX_COORDINATE || std::abs(p.y) > MAX_COORDINATE) {
+                return false;
+            }
+        }
+
+        // Index n wraps around to the start point, which closes the contour.
+        auto point_at = [&](size_t i) { return points[i % n]; };
+        auto flag_at = [&](size_t i) { return i < n ? flags[i] : Pathfinder::PointFlag::ON_CURVE_POINT; };
+
+        add_vertex(STBTT_vmove, points[0]);
+
+        size_t i = 1;
+        while (i <= n) {
+            if (flag_at(i) == Pathfinder::PointFlag::CONTROL_POINT_0) {
+                if (flag_at(i + 1) == Pathfinder::PointFlag::CONTROL_POINT_1) {
+                    add_vertex(STBTT_vcubic, point_at(i + 2), point_at(i), point_at(i + 1));
+                    i += 3;
+                } else {
+                    add_vertex(STBTT_vcurve, point_at(i + 1), point_at(i));
+                    i += 2;
+                }
+            } else {
+                add_vertex(STBTT_vline, point_at(i));
+                i += 1;
+            }
+        }
+    }
+
+    return true;
+}
+
+const GlyphAtlas::GlyphBitmap &GlyphAtlas::get_glyph_bitmap(Font &font,
+                                                            uint16_t glyph_index,
+                                                            uint32_t font_size,
+                                                            float scale,
+                                                            int subpixel_step) {
+    GlyphKey key{font.get_id(), font_size, scale, glyph_index, (uint16_t)subpixel_step};
+
+    auto iter = glyph_bitmaps.find(key);
+    if (iter != glyph_bitmaps.end()) {
+        return iter->second;
+    }
+
+    // Failures are cached too.
+    auto &glyph_bitmap = glyph_bitmaps[key];
+
+    // Transform the glyph path to pixels, with the subpixel offset applied.
+    auto path = font.get_cached_glyph(glyph_index, font_size).path;
+    auto outline = path.into_outline();
+    float subpixel_offset = (float)subpixel_step / SUBPIXEL_STEPS;
+    outline.transform(Transform2::from_scale({scale, scale}).translate({subpixel_offset, 0}));
+
+    std::vector<stbtt_vertex> vertices;
+    if (!outline_to_stbtt_vertices(outline, vertices)) {
+        return glyph_bitmap;
+    }
+
+    // Pixel bounds of the outline.
+    RectF bounds;
+    bool first_point = true;
+    for (const auto &contour : outline.contours) {
+        for (const auto &p : contour.points) {
+            if (first_point) {
+                bounds = RectF(p, p);
+                first_point = false;
+            } else {
+                bounds = bounds.union_rect(RectF(p, p));
+            }
+        }
+    }
+    RectI pixel_bounds = bounds.round_out();
+
+    // Glyphs without any coverage take no space.
+    if (pixel_bounds.width() <= 0 || pixel_bounds.height() <= 0) {
+        glyph_bitmap.valid = true;
+        return glyph_bitmap;
+    }
+
+    if (pixel_bounds.width() + GLYPH_PADDING * 2 > PAGE_SIZE || pixel_bounds.height() + GLYPH_PADDING * 2 > PAGE_SIZE) {
+        return glyph_bitmap;
+    }
+
+    glyph_bitmap.offset = pixel_bounds.origin();
+    glyph_bitmap.size = pixel_bounds.size();
+
+    // Rasterize the coverage.
+    glyph_bitmap.coverage.resize(pixel_bounds.area());
+
+    stbtt__bitmap bitmap;
+    bitmap.w = pixel_bounds.width();
+    bitmap.h = pixel_bounds.height();
+    bitmap.stride = pixel_bounds.width();
+    bitmap.pixels = glyph_bitmap.coverage.data();
+
+    stbtt_Rasterize(&bitmap,
+                    0.35f,
+                    vertices.data(),
+                    (int)vertices.size(),
+                    1.0f / FIXED_POINT_SCALE,
+                    1.0f / FIXED_POINT_SCALE,
+                    0,
+                    0,
+                    pixel_bounds.min_x(),
+                    pixel_bounds.min_y(),
+                    0,
+                    nullptr);
+
+    glyph_bitmap.valid = true;
+
+    return glyph_bitmap;
+}
+
+void GlyphAtlas::get_strips(const std::vector<AtlasGlyphInstance> &glyphs,
+                            float scale,
+                            std::vector<AtlasStrip> &strips,
+                            std::vector<int32_t> &glyph_strips) {
+    strips.clear();
+    glyph_strips.assign(glyphs.size(), -1);
+
+    strip_scale = scale;
+    glyph_bitmap_refs.assign(glyphs.size(), nullptr);
+    strip_glyph_indices.clear();
+
+    // Bounds of the coverage of the current strip on the screen.
+    RectI strip_bounds;
+    bool strip_has_coverage = false;
+
+    auto flush_strip = [&] {
+        if (strip_glyph_indices.empty()) {
+            return;
+        }
+
+        const auto &entry = get_strip(glyphs, strip_glyph_indices);
+
+        if (entry.valid) {
+            strips.push_back({entry.page, entry.rect, glyphs[strip_glyph_indices.front()].origin + entry.offset});
+
+            for (auto index : strip_glyph_indices) {
+                glyph_strips[index] = (int32_t)strips.size() - 1;
+            }
+        }
+
+        strip_glyph_indices.clear();
+        strip_has_coverage = false;
+    };
+
+    for (size_t i = 0; i < glyphs.size(); i++) {
+        const auto &glyph = glyphs[i];
+        if (glyph.font == nullptr) {
+            continue;
+        }
+
+        const auto &glyph_bitmap =
+            get_glyph_bitmap(*glyph.font, glyph.glyph_index, glyph.font_size, scale, glyph.subpixel_step);
+        if (!glyph_bitmap.valid) {
+            continue;
+        }
+        glyph_bitmap_refs[i] = &glyph_bitmap;
+
+        // A strip is on a single baseline.
+        if (!strip_glyph_indices.empty() && glyph.origin.y != glyphs[strip_glyph_indices.front()].origin.y) {
+            flush_strip();
+        }
+
+        if (glyph_bitmap.size.area() > 0) {
+            auto glyph_bounds = RectI(glyph.origin + glyph_bitmap.offset,
+                                      glyph.origin + glyph_bitmap.offset + glyph_bitmap.size);
+
+            if (strip_has_coverage) {
+                auto new_bounds = strip_bounds.union_rect(glyph_bounds);
+
+                // Start a new strip if this one would become too large for a page.
+                if (new_bounds.width() + GLYPH_PADDING * 2 > PAGE_SIZE ||
+                    new_bounds.height() + GLYPH_PADDING * 2 > PAGE_SIZE) {
+                    flush_strip();
+                    strip_bounds = glyph_bounds;
+                } else {
+                    strip_bounds = new_bounds;
+                }
+            } else {
+                strip_bounds = glyph_bounds;
+            }
+
+            strip_has_coverage = true;
+        }
+
+        strip_glyph_indices.push_back(i);
+    }
+
+    flush_strip();
+}
+
+const GlyphAtlas::StripEntry &GlyphAtlas::get_strip(const std::vector<AtlasGlyphInstance> &glyphs,
+                                                     const std::vector<size_t> &indices) {
+    auto strip_origin = glyphs[indices.front()].origin;
+
+    // Glyphs are placed relative to the first one, so the strip is found again wherever the line is moved.
+    strip_key.scale = strip_scale;
+    strip_key.glyphs.clear();
+    for (auto index : indices) {
+        const auto &glyph = glyphs[index];
+        strip_key.glyphs.push_back({glyph.font->get_id(),
+                                    glyph.font_size,
+                                    glyph.glyph_index,
+                                    (uint16_t)glyph.subpixel_step,
+                                    glyph.origin - strip_origin});
+    }
+
+    auto iter = strip_entries.find(strip_key);
+    if (iter != strip_entries.end()) {
+        return iter->second;
+    }
+
+    auto &entry = strip_entries[strip_key];
+
+    // Bounds of the coverage relative to the strip origin.
+    RectI bounds;
+    bool has_coverage = false;
+    for (auto index : indices) {
+        const auto &glyph_bitmap = *glyph_bitmap_refs[index];
+        if (glyph_bitmap.size.area() == 0) {
+            continue;
+        }
+
+        auto position = glyphs[index].origin - strip_origin + glyph_bitmap.offset;
+        auto glyph_bounds = RectI(position, position + glyph_bitmap.size);
+        bounds = has_coverage ? bounds.union_rect(glyph_bounds) : glyph_bounds;
+        has_coverage = true;
+    }
+
+    // Strips without any coverage take no space.
+    if (!has_coverage) {
+        entry.valid = true;
+        return entry;
+    }
+
+    Vec2I position;
+    if (!allocate(bounds.size() + GLYPH_PADDING * 2, entry.page, position)) {
+        return entry;
+    }
+
+    auto &image = *pages[entry.page].image;
+    auto padded_rect = RectI(position, position + bounds.size() + GLYPH_PADDING * 2);
+
+    // The page may be reused from before the last clear.
+    for (int y = padded_rect.min_y(); y < padded_rect.max_y(); y++) {
+        auto row = image.pixels.begin() + y * PAGE_SIZE;
+        std::fill(row + padded_rect.min_x(), row + padded_rect.max_x(), ColorU::transparent_black());
+    }
+
+    entry.valid = true;
+    entry.rect = RectI(position + GLYPH_PADDING, position + GLYPH_PADDING + bounds.size());
+    entry.offset = bounds.origin();
+
+    // Composite the coverage of the glyphs, which may overlap.
+    for (auto index : indices) {
+        const auto &glyph_bitmap = *glyph_bitmap_refs[index];
+        auto glyph_position =
+            entry.rect.origin() + glyphs[index].origin - strip_origin + glyph_bitmap.offset - bounds.origin();
+
+        for (int y = 0; y < glyph_bitmap.size.y; y++) {
+            for (int x = 0; x < glyph_bitmap.size.x; x++) {
+                auto &pixel = image.pixels[(glyph_position.y + y) * PAGE_SIZE + glyph_position.x + x];
+                uint32_t src = glyph_bitmap.coverage[y * glyph_bitmap.size.x + x];
+                uint32_t dst = pixel.a_;
+                pixel = ColorU(255, 255, 255, (uint8_t)(src + dst - src * dst / 255));
+            }
+        }
+    }
+
+    // Only the new strip is uploaded again.
+    image.mark_dirty(padded_rect);
+
+    return entry;
+}
+
+bool GlyphAtlas::allocate(Vec2I size, uint32_t &page, Vec2I &position) {
+    if (size.x > PAGE_SIZE || size.y > PAGE_SIZE) {
+        return false;
+    }
+
+    // Try the current shelf of the last page, then a new shelf.
+    if (used_page_count > 0) {
+        auto &last_page = pages[used_page_count - 1];
+
+        if (last_page.shelf_x + size.x > PAGE_SIZE) {
+            last_page.shelf_x = 0;
+            last_page.shelf_y += last_page.shelf_height;
+            last_page.shelf_height = 0;
+        }
+
+        if (last_page.shelf_y + size.y <= PAGE_SIZE) {
+            page = used_page_count - 1;
+            position = {last_page.shelf_x, last_page.shelf_y};
+
+            last_page.shelf_x += size.x;
+            last_page.shelf_height = std::max(last_page.shelf_height, size.y);
+
+            return true;
+        }
+    }
+
+    if (used_page_count >= MAX_PAGE_COUNT) {
+        full = true;
+        return false;
+    }
+
+    // Reuse a page kept from before the last clear.
+    if (used_page_count == pages.size()) {
+        Page new_page;
+        new_page.image = Pathfinder::Image::new_mutable(Vec2I(PAGE_SIZE), ColorU::transparent_black());
+        pages.push_back(std::move(new_page));
+    }
+
+    auto &new_page = pages[used_page_count];
+    new_page.shelf_x = size.x;
+    new_page.shelf_y = 0;
+    new_page.shelf_height = size.y;
+
+    page = used_page_count;
+    position = {0, 0};
+
+    used_page_count++;
+
+    return true;
+}
+
+std::shared_ptr<Pathfinder::Image> GlyphAtlas::get_page_image(uint32_t page) {
+    if (page >= used_page_count) {
+        return nullptr;
+    }
+
+    return pages[page].image;
+}
+
+size_t GlyphAtlas::get_page_count() const {
+    return used_page_count;
+}
+
+bool GlyphAtlas::is_full() const {
+    return full;
+}
+
+void GlyphAtlas::clear() {
+    used_page_count = 0;
+    glyph_bitmaps.clear();
+    strip_entries.clear();
+    full = false;
+}
+
+} // namespace Flint
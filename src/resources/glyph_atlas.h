@@ -0,0 +1,209 @@
+#ifndef FLINT_GLYPH_ATLAS_H
+#define FLINT_GLYPH_ATLAS_H
+
+#include <pathfinder/prelude.h>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "../common/geometry.h"
+#include "font.h"
+
+namespace Flint {
+
+/// A glyph to be drawn from the atlas.
+struct AtlasGlyphInstance {
+    /// Null for glyphs which aren't drawn from the atlas.
+    Font *font = nullptr;
+
+    uint16_t glyph_index = 0;
+
+    uint32_t font_size = 0;
+
+    /// Pixel-snapped glyph origin on the baseline, on the screen.
+    Vec2I origin;
+
+    /// Horizontal subpixel offset in [0, SUBPIXEL_STEPS).
+    int subpixel_step = 0;
+};
+
+/// Glyphs on the same baseline rasterized together, to be drawn as one textured rect.
+struct AtlasStrip {
+    uint32_t page = 0;
+
+    /// Strip bitmap in the page. Empty for strips without any coverage, e.g. spaces.
+    RectI rect;
+
+    /// Top-left corner of the bitmap on the screen.
+    Vec2I origin;
+};
+
+/// Coverage atlas for small glyphs, so that body text can be drawn as textured rects instead of glyph paths.
+/// Each (font, glyph, font size, scale, subpixel offset) is rasterized only once. The glyphs of a line are then
+/// composited into a strip in a page, so a line needs a single paint and rect. A strip is reused as long as its
+/// glyphs keep their relative positions, e.g. while the text is only moved by whole pixels.
+/// The coverage is stored in the alpha channel, and the text color is supplied by the paint drawing the strip.
+class GlyphAtlas {
+public:
+    static constexpr int PAGE_SIZE = 512;
+
+    /// Horizontal subpixel positions per pixel.
+    static constexpr int SUBPIXEL_STEPS = 4;
+
+    static constexpr uint32_t MAX_PAGE_COUNT = 4;
+
+    /// Get the strips of glyphs, compositing the new ones into the pages.
+    /// A strip takes the following glyphs on the same baseline as long as they fit in a page.
+    /// @param scale Scale from the glyphs' baseline coordinates to the screen.
+    /// @param glyph_strips Receives the strip index of each glyph, or -1 if the glyph has to be drawn as a path,
+    /// e.g. when it's too large or all pages are full.
+    void get_strips(const std::vector<AtlasGlyphInstance> &glyphs,
+                    float scale,
+                    std::vector<AtlasStrip> &strips,
+                    std::vector<int32_t> &glyph_strips);
+
+    /// Get the image of a page for drawing. It's a mutable image, which is changed in place when strips are added,
+    /// so that only the new strips are uploaded again.
+    std::shared_ptr<Pathfinder::Image> get_page_image(uint32_t page);
+
+    size_t get_page_count() const;
+
+    /// If a strip has failed to fit since the last clear. Clear the atlas between frames when it's full.
+    bool is_full() const;
+
+    /// Remove all glyphs and strips. The page images are kept and reused, so that they aren't uploaded whole again.
+    void clear();
+
+private:
+    struct GlyphKey {
+        uint32_t font_id;
+        uint32_t font_size;
+        float scale;
+        uint16_t glyph_index;
+        uint16_t subpixel_step;
+
+        bool operator==(const GlyphKey &other) const {
+            return font_id == other.font_id && font_size == other.font_size && scale == other.scale &&
+                   glyph_index == other.glyph_index && subpixel_step == other.subpixel_step;
+        }
+    };
+
+    struct GlyphKeyHash {
+        size_t operator()(const GlyphKey &key) const {
+            size_t hash = std::hash<float>()(key.scale);
+            hash = hash * 31 + key.font_id;
+            hash = hash * 31 + key.font_size;
+            hash = hash * 31 + key.glyph_index;
+            hash = hash * 31 + key.subpixel_step;
+            return hash;
+        }
+    };
+
+    /// Rasterized coverage of a glyph.
+    struct GlyphBitmap {
+        /// False if the glyph can't be drawn from the atlas.
+        bool valid = false;
+
+        /// Top-left corner of the bitmap relative to the pixel-snapped glyph origin on the baseline.
+        Vec2I offset;
+
+        Vec2I size;
+
+        std::vector<uint8_t> coverage;
+    };
+
+    struct StripGlyph {
+        uint32_t font_id;
+        uint32_t font_size;
+        uint16_t glyph_index;
+        uint16_t subpixel_step;
+
+        /// Glyph origin relative to the origin of the strip's first glyph.
+        Vec2I position;
+
+        bool operator==(const StripGlyph &other) const {
+            return font_id == other.font_id && font_size == other.font_size && glyph_index == other.glyph_index &&
+                   subpixel_step == other.subpixel_step && position == other.position;
+        }
+    };
+
+    struct StripKey {
+        float scale = 0;
+        std::vector<StripGlyph> glyphs;
+
+        bool operator==(const StripKey &other) const {
+            return scale == other.scale && glyphs == other.glyphs;
+        }
+    };
+
+    struct StripKeyHash {
+        size_t operator()(const StripKey &key) const {
+            size_t hash = std::hash<float>()(key.scale);
+            for (const auto &glyph : key.glyphs) {
+                hash = hash * 31 + glyph.font_id;
+                hash = hash * 31 + glyph.font_size;
+                hash = hash * 31 + glyph.glyph_index;
+                hash = hash * 31 + glyph.subpixel_step;
+                hash = hash * 31 + (uint32_t)glyph.position.x;
+                hash = hash * 31 + (uint32_t)glyph.position.y;
+            }
+            return hash;
+        }
+    };
+
+    struct StripEntry {
+        /// False if the strip didn't fit.
+        bool valid = false;
+
+        uint32_t page = 0;
+
+        RectI rect;
+
+        /// Top-left corner of the bitmap relative to the origin of the strip's first glyph.
+        Vec2I offset;
+    };
+
+    struct Page {
+        std::shared_ptr<Pathfinder::Image> image;
+
+        // Shelf packing state.
+        int shelf_x = 0;
+        int shelf_y = 0;
+        int shelf_height = 0;
+    };
+
+    /// Rasterize a glyph if necessary.
+    const GlyphBitmap &get_glyph_bitmap(Font &font,
+                                        uint16_t glyph_index,
+                                        uint32_t font_size,
+                                        float scale,
+                                        int subpixel_step);
+
+    /// Get the strip of glyphs, compositing it if necessary.
+    const StripEntry &get_strip(const std::vector<AtlasGlyphInstance> &glyphs, const std::vector<size_t> &indices);
+
+    /// Find a place for a bitmap of the given size, adding a new page if necessary.
+    bool allocate(Vec2I size, uint32_t &page, Vec2I &position);
+
+    /// Pages after the used ones are kept from before the last clear.
+    std::vector<Page> pages;
+
+    uint32_t used_page_count = 0;
+
+    bool full = false;
+
+    std::unordered_map<GlyphKey, GlyphBitmap, GlyphKeyHash> glyph_bitmaps;
+
+    std::unordered_map<StripKey, StripEntry, StripKeyHash> strip_entries;
+
+    // Scratch buffers for get_strips().
+    float strip_scale = 0;
+    StripKey strip_key;
+    std::vector<const GlyphBitmap *> glyph_bitmap_refs;
+    std::vector<size_t> strip_glyph_indices;
+};
+
+} // namespace Flint
+
+#endif // FLINT_GLYPH_ATLAS_H
@@ -0,0 +1,51 @@
+#include "glyph_cache.h"
+
+namespace Flint {
+
+size_t GlyphCache::GlyphSize::operator()(const CachedGlyph &glyph) const {
+    // Each point comes with a flag.
+    return sizeof(CachedGlyph) + glyph.point_count * (sizeof(Vec2F) + sizeof(Pathfinder::PointFlag));
+}
+
+GlyphCache::GlyphCache(size_t memory_budget) : cache(memory_budget) {
+}
+
+CachedGlyph *GlyphCache::find(uint16_t glyph_index, uint32_t font_size) {
+    return cache.find(make_key(glyph_index, font_size));
+}
+
+CachedGlyph &GlyphCache::insert(uint16_t glyph_index, uint32_t font_size, CachedGlyph glyph) {
+    return cache.insert(make_key(glyph_index, font_size), std::move(glyph));
+}
+
+void GlyphCache::set_memory_budget(size_t new_budget) {
+    cache.set_budget(new_budget);
+}
+
+size_t GlyphCache::get_memory_budget() const {
+    return cache.get_budget();
+}
+
+GlyphCacheStats GlyphCache::get_stats() const {
+    auto cache_stats = cache.get_stats();
+
+    GlyphCacheStats stats;
+    stats.hits = cache_stats.hits;
+    stats.misses = cache_stats.misses;
+    stats.evictions = cache_stats.evictions;
+    stats.entry_count = cache_stats.entry_count;
+    stats.memory_usage = cache_stats.size;
+    stats.memory_budget = cache_stats.budget;
+
+    return stats;
+}
+
+void GlyphCache::reset_stats() {
+    cache.reset_stats();
+}
+
+void GlyphCache::clear() {
+    cache.clear();
+}
+
+} // namespace Flint
@@ -0,0 +1,80 @@
+#ifndef FLINT_GLYPH_CACHE_H
+#define FLINT_GLYPH_CACHE_H
+
+#include <pathfinder/prelude.h>
+
+#include <cstdint>
+
+#include "../common/geometry.h"
+#include "../common/lru_cache.h"
+
+namespace Flint {
+
+/// Size-dependent glyph data which is expensive to decode from the font file.
+struct CachedGlyph {
+    /// Glyph path. The points are in the glyph's baseline coordinates.
+    Pathfinder::Path2d path;
+
+    /// Glyph path's bounding box in the baseline coordinates. The Y axis points down.
+    RectF bbox;
+
+    /// Advance width from the font's metrics. Shaping may still adjust the actual advance.
+    float advance = 0;
+
+    /// Number of points in the path, for estimating the memory usage.
+    size_t point_count = 0;
+};
+
+struct GlyphCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+
+    size_t entry_count = 0;
+
+    /// Estimated memory usage in bytes.
+    size_t memory_usage = 0;
+    size_t memory_budget = 0;
+};
+
+/// An LRU cache for decoded glyphs, keyed by (glyph index, font size in pixels).
+class GlyphCache {
+public:
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 4 * 1024 * 1024;
+
+    explicit GlyphCache(size_t memory_budget = DEFAULT_MEMORY_BUDGET);
+
+    /// Returns nullptr if the glyph is not cached. A hit marks the entry as the most recently used one.
+    /// @note The returned pointer is only valid until the next insertion.
+    CachedGlyph *find(uint16_t glyph_index, uint32_t font_size);
+
+    /// Caches a glyph, evicting the least recently used entries if the memory budget is exceeded.
+    /// @note The returned reference is only valid until the next insertion.
+    CachedGlyph &insert(uint16_t glyph_index, uint32_t font_size, CachedGlyph glyph);
+
+    void set_memory_budget(size_t new_budget);
+
+    size_t get_memory_budget() const;
+
+    GlyphCacheStats get_stats() const;
+
+    void reset_stats();
+
+    void clear();
+
+private:
+    /// Estimated memory usage in bytes.
+    struct GlyphSize {
+        size_t operator()(const CachedGlyph &glyph) const;
+    };
+
+    static uint64_t make_key(uint16_t glyph_index, uint32_t font_size) {
+        return (uint64_t)font_size << 16 | glyph_index;
+    }
+
+    LruCache<uint64_t, CachedGlyph, GlyphSize> cache;
+};
+
+} // namespace Flint
+
+#endif // FLINT_GLYPH_CACHE_H
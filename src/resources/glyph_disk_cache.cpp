@@ -0,0 +1,326 @@
+#include "glyph_disk_cache.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include "../common/utils.h"
+
+namespace Flint {
+
+namespace {
+
+constexpr char FILE_MAGIC[4] = {'F', 'L', 'G', 'C'};
+
+struct FileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t entry_count;
+    uint32_t padding;
+};
+
+/// Followed by the contours, each as its point count, closed flag, points and point flags.
+struct GlyphHeader {
+    float bbox[4];
+    float advance;
+    uint32_t contour_count;
+};
+
+struct ContourHeader {
+    uint32_t point_count;
+    uint32_t closed;
+};
+
+size_t align_to_4(size_t size) {
+    return (size + 3) & ~(size_t)3;
+}
+
+template <typename T>
+void append_bytes(std::vector<char> &bytes, const T *data, size_t count) {
+    auto start = reinterpret_cast<const char *>(data);
+    bytes.insert(bytes.end(), start, start + sizeof(T) * count);
+}
+
+} // namespace
+
+bool GlyphDiskCache::open(const std::string &path) {
+    close();
+
+    path_ = path;
+
+    // No file yet, e.g. on the first run.
+    if (!std::filesystem::exists(path)) {
+        return false;
+    }
+
+    auto file = std::make_unique<MappedFile>(path);
+    if (!file->is_valid() || file->size() < sizeof(FileHeader)) {
+        return false;
+    }
+
+    FileHeader header;
+    std::memcpy(&header, file->data(), sizeof(FileHeader));
+
+    if (std::memcmp(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC)) != 0 || header.version != FORMAT_VERSION) {
+        Logger::warn("Ignored glyph cache file of another format: " + path, "Flint");
+        return false;
+    }
+
+    if (sizeof(FileHeader) + (size_t)header.entry_count * sizeof(FileEntry) > file->size()) {
+        Logger::error("Truncated glyph cache file: " + path, "Flint");
+        return false;
+    }
+
+    // The mapping is page-aligned, so the entry table following the header is aligned too.
+    file_entries = reinterpret_cast<const FileEntry *>(file->data() + sizeof(FileHeader));
+    file_entry_count = header.entry_count;
+
+    mapped_file = std::move(file);
+
+    return true;
+}
+
+bool GlyphDiskCache::save() {
+    if (path_.empty()) {
+        return false;
+    }
+
+    // The glyphs of the file and the new ones, sorted by key for binary search.
+    std::vector<std::pair<Key, std::string_view>> glyphs;
+    glyphs.reserve(file_entry_count + new_entries.size());
+
+    for (uint32_t i = 0; i < file_entry_count; i++) {
+        const auto &entry = file_entries[i];
+
+        Key key{entry.font_hash, entry.font_size, entry.glyph_index};
+        if (new_entries.find(key) == new_entries.end()) {
+            glyphs.emplace_back(key, std::string_view(mapped_file->data() + entry.offset, entry.size));
+        }
+    }
+
+    for (const auto &[key, bytes] : new_entries) {
+        glyphs.emplace_back(key, std::string_view(bytes.data(), bytes.size()));
+    }
+
+    std::sort(glyphs.begin(), glyphs.end(), [](const auto &a, const auto &b) { return a.first < b.first; });
+
+    FileHeader header{};
+    std::memcpy(header.magic, FILE_MAGIC, sizeof(FILE_MAGIC));
+    header.version = FORMAT_VERSION;
+    header.entry_count = glyphs.size();
+
+    std::vector<FileEntry> entries;
+    entries.reserve(glyphs.size());
+
+    size_t offset = sizeof(FileHeader) + sizeof(FileEntry) * glyphs.size();
+
+    for (const auto &[key, bytes] : glyphs) {
+        entries.push_back({key.font_hash, key.font_size, key.glyph_index, 0, (uint32_t)offset, (uint32_t)bytes.size()});
+        offset += bytes.size();
+    }
+
+    if (offset > UINT32_MAX) {
+        Logger::error("Glyph cache is too large to save!", "Flint");
+        return false;
+    }
+
+    // Write a temporary file first, as the old file is still mapped and being read.
+    auto temp_path = path_ + ".tmp";
+    {
+        std::ofstream file(temp_path, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            Logger::error("Failed to write glyph cache file: " + temp_path, "Flint");
+            return false;
+        }
+
+        file.write(reinterpret_cast<const char *>(&header), sizeof(FileHeader));
+        file.write(reinterpret_cast<const char *>(entries.data()), sizeof(FileEntry) * entries.size());
+
+        for (const auto &[key, bytes] : glyphs) {
+            file.write(bytes.data(), bytes.size());
+        }
+
+        if (!file) {
+            Logger::error("Failed to write glyph cache file: " + temp_path, "Flint");
+            return false;
+        }
+    }
+
+    // Unmap the old file so that it can be replaced.
+    glyphs.clear();
+
+    file_entries = nullptr;
+    file_entry_count = 0;
+    mapped_file.reset();
+
+    std::error_code error;
+    std::filesystem::rename(temp_path, path_, error);
+    if (error) {
+        Logger::error("Failed to replace glyph cache file: " + path_, "Flint");
+    }
+
+    // All the glyphs are in the new file now.
+    new_entries.clear();
+
+    auto path = path_;
+    open(path);
+
+    return !error;
+}
+
+void GlyphDiskCache::close() {
+    path_.clear();
+
+    file_entries = nullptr;
+    file_entry_count = 0;
+    mapped_file.reset();
+
+    new_entries.clear();
+}
+
+bool GlyphDiskCache::is_open() const {
+    return !path_.empty();
+}
+
+bool GlyphDiskCache::find(uint64_t font_hash, uint16_t glyph_index, uint32_t font_size, CachedGlyph &glyph) {
+    Key key{font_hash, font_size, glyph_index};
+
+    if (auto entry = find_file_entry(key)) {
+        if (deserialize_glyph(mapped_file->data() + entry->offset, entry->size, glyph)) {
+            return true;
+        }
+    }
+
+    auto iter = new_entries.find(key);
+    if (iter != new_entries.end()) {
+        return deserialize_glyph(iter->second.data(), iter->second.size(), glyph);
+    }
+
+    return false;
+}
+
+void GlyphDiskCache::add(uint64_t font_hash, uint16_t glyph_index, uint32_t font_size, const CachedGlyph &glyph) {
+    if (!is_open()) {
+        return;
+    }
+
+    new_entries[{font_hash, font_size, glyph_index}] = serialize_glyph(glyph);
+}
+
+size_t GlyphDiskCache::get_entry_count() const {
+    return file_entry_count + new_entries.size();
+}
+
+const GlyphDiskCache::FileEntry *GlyphDiskCache::find_file_entry(const Key &key) const {
+    auto end = file_entries + file_entry_count;
+
+    auto iter = std::lower_bound(file_entries, end, key, [](const FileEntry &entry, const Key &key) {
+        return Key{entry.font_hash, entry.font_size, entry.glyph_index} < key;
+    });
+
+    if (iter == end || !(Key{iter->font_hash, iter->font_size, iter->glyph_index} == key)) {
+        return nullptr;
+    }
+
+    // Don't trust a damaged file.
+    if ((size_t)iter->offset + iter->size > mapped_file->size()) {
+        return nullptr;
+    }
+
+    return iter;
+}
+
+std::vector<char> GlyphDiskCache::serialize_glyph(const CachedGlyph &glyph) {
+    // Copy the path, as taking its outline modifies it.
+    auto outline = Pathfinder::Path2d(glyph.path).into_outline();
+
+    GlyphHeader header{};
+    header.bbox[0] = glyph.bbox.left;
+    header.bbox[1] = glyph.bbox.top;
+    header.bbox[2] = glyph.bbox.right;
+    header.bbox[3] = glyph.bbox.bottom;
+    header.advance = glyph.advance;
+    header.contour_count = outline.contours.size();
+
+    std::vector<char> bytes;
+    append_bytes(bytes, &header, 1);
+
+    for (const auto &contour : outline.contours) {
+        ContourHeader contour_header{(uint32_t)contour.points.size(), (uint32_t)contour.closed};
+        append_bytes(bytes, &contour_header, 1);
+
+        append_bytes(bytes, contour.points.data(), contour.points.size());
+
+        for (auto flag : contour.flags) {
+            bytes.push_back((char)flag);
+        }
+        bytes.resize(align_to_4(bytes.size()));
+    }
+
+    return bytes;
+}
+
+bool GlyphDiskCache::deserialize_glyph(const char *data, size_t size, CachedGlyph &glyph) {
+    size_t offset = 0;
+
+    // Copy out of the data, which doesn't have to be aligned.
+    auto read = [&](void *dst, size_t length) {
+        if (offset + length > size) {
+            return false;
+        }
+        std::memcpy(dst, data + offset, length);
+        offset += length;
+        return true;
+    };
+
+    GlyphHeader header;
+    if (!read(&header, sizeof(GlyphHeader))) {
+        return false;
+    }
+
+    // Check the counts against the remaining bytes before allocating anything, as the file may be damaged.
+    if (header.contour_count > (size - offset) / sizeof(ContourHeader)) {
+        return false;
+    }
+
+    Pathfinder::Outline outline;
+
+    for (uint32_t i = 0; i < header.contour_count; i++) {
+        ContourHeader contour_header;
+        if (!read(&contour_header, sizeof(ContourHeader))) {
+            return false;
+        }
+
+        auto point_count = contour_header.point_count;
+
+        // Each point takes its position and a flag byte.
+        if (point_count > (size - offset) / (sizeof(Vec2F) + 1)) {
+            return false;
+        }
+
+        Pathfinder::Contour contour;
+        contour.closed = contour_header.closed;
+
+        std::vector<Vec2F> points(point_count);
+        if (!read(points.data(), sizeof(Vec2F) * point_count)) {
+            return false;
+        }
+
+        for (uint32_t j = 0; j < point_count; j++) {
+            contour.push_point(points[j], (Pathfinder::PointFlag)data[offset + j], true);
+        }
+        offset = align_to_4(offset + point_count);
+
+        outline.push_contour(contour);
+    }
+
+    glyph.path = Pathfinder::Path2d();
+    glyph.path.add_outline(outline, Transform2());
+    glyph.bbox = RectF(header.bbox[0], header.bbox[1], header.bbox[2], header.bbox[3]);
+    glyph.advance = header.advance;
+
+    return true;
+}
+
+} // namespace Flint
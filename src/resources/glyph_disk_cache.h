@@ -0,0 +1,113 @@
+#ifndef FLINT_GLYPH_DISK_CACHE_H
+#define FLINT_GLYPH_DISK_CACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../common/mapped_file.h"
+#include "glyph_cache.h"
+
+namespace Flint {
+
+/// A file of decoded glyphs, so that text can be drawn at startup without decoding glyphs from the font files.
+///
+/// The file is memory-mapped when opened, and glyphs are read from it when fonts miss them in their glyph caches.
+/// Glyphs decoded afterward are kept until the file is saved, which writes both the old and the new glyphs.
+/// Glyphs are keyed by (fingerprint of the font data, glyph index, font size), so a changed font doesn't use stale
+/// glyphs.
+/// @note The file is in the byte order of the machine, and a file of another format version is ignored.
+class GlyphDiskCache {
+public:
+    static constexpr uint32_t FORMAT_VERSION = 2;
+
+    GlyphDiskCache() = default;
+
+    GlyphDiskCache(const GlyphDiskCache &) = delete;
+
+    GlyphDiskCache &operator=(const GlyphDiskCache &) = delete;
+
+    /// Use a cache file. Its glyphs are mapped if it exists and is valid. Either way, decoded glyphs are recorded
+    /// from now on. Returns true if the file has been mapped.
+    bool open(const std::string &path);
+
+    /// Write the file and keep using it. Returns false if it's not open or couldn't be written.
+    bool save();
+
+    /// Stop using the file without saving it.
+    void close();
+
+    bool is_open() const;
+
+    /// Returns false if the glyph is neither in the file nor recorded.
+    bool find(uint64_t font_hash, uint16_t glyph_index, uint32_t font_size, CachedGlyph &glyph);
+
+    /// Record a decoded glyph for the next save.
+    void add(uint64_t font_hash, uint16_t glyph_index, uint32_t font_size, const CachedGlyph &glyph);
+
+    /// Glyphs in the file and recorded ones.
+    size_t get_entry_count() const;
+
+private:
+    struct Key {
+        uint64_t font_hash;
+        uint32_t font_size;
+        uint16_t glyph_index;
+
+        bool operator==(const Key &other) const {
+            return font_hash == other.font_hash && font_size == other.font_size && glyph_index == other.glyph_index;
+        }
+
+        bool operator<(const Key &other) const {
+            if (font_hash != other.font_hash) {
+                return font_hash < other.font_hash;
+            }
+            if (font_size != other.font_size) {
+                return font_size < other.font_size;
+            }
+            return glyph_index < other.glyph_index;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const {
+            return key.font_hash ^ (((uint64_t)key.font_size << 16 | key.glyph_index) * 0x9e3779b97f4a7c15ull);
+        }
+    };
+
+    /// Entry of the sorted table following the file header.
+    struct FileEntry {
+        uint64_t font_hash;
+        uint32_t font_size;
+        uint16_t glyph_index;
+        uint16_t padding;
+        /// Glyph data range in the file.
+        uint32_t offset;
+        uint32_t size;
+    };
+
+    /// Binary search in the table of the mapped file. Returns nullptr if not found.
+    const FileEntry *find_file_entry(const Key &key) const;
+
+    /// Glyph data to and from bytes.
+    static std::vector<char> serialize_glyph(const CachedGlyph &glyph);
+
+    static bool deserialize_glyph(const char *data, size_t size, CachedGlyph &glyph);
+
+    std::string path_;
+
+    std::unique_ptr<MappedFile> mapped_file;
+
+    // Points into the mapped file.
+    const FileEntry *file_entries = nullptr;
+    uint32_t file_entry_count = 0;
+
+    /// Glyphs recorded since the file was opened.
+    std::unordered_map<Key, std::vector<char>, KeyHash> new_entries;
+};
+
+} // namespace Flint
+
+#endif // FLINT_GLYPH_DISK_CACHE_H
@@ -0,0 +1,120 @@
+#include "glyph_run.h"
+
+#include <algorithm>
+
+namespace Flint {
+
+size_t GlyphRun::size() const {
+    return glyph_indices.size();
+}
+
+bool GlyphRun::empty() const {
+    return glyph_indices.empty();
+}
+
+void GlyphRun::clear() {
+    glyph_indices.clear();
+    font_indices.clear();
+    cluster_starts.clear();
+    cluster_ends.clear();
+    x_advances.clear();
+    x_offsets.clear();
+    y_offsets.clear();
+    scripts.clear();
+    flags.clear();
+    fonts.clear();
+}
+
+void GlyphRun::reserve(size_t glyph_count) {
+    glyph_indices.reserve(glyph_count);
+    font_indices.reserve(glyph_count);
+    cluster_starts.reserve(glyph_count);
+    cluster_ends.reserve(glyph_count);
+    x_advances.reserve(glyph_count);
+    x_offsets.reserve(glyph_count);
+    y_offsets.reserve(glyph_count);
+    scripts.reserve(glyph_count);
+    flags.reserve(glyph_count);
+}
+
+uint16_t GlyphRun::add_font(const GlyphRunFont &font) {
+    for (size_t i = 0; i < fonts.size(); i++) {
+        auto &f = fonts[i];
+        if (f.font_id == font.font_id && f.font_size == font.font_size && f.ascent == font.ascent &&
+            f.descent == font.descent) {
+            return i;
+        }
+    }
+
+    fonts.push_back(font);
+
+    return fonts.size() - 1;
+}
+
+size_t GlyphRun::add_glyph() {
+    glyph_indices.push_back(0);
+    font_indices.push_back(0);
+    cluster_starts.push_back(0);
+    cluster_ends.push_back(0);
+    x_advances.push_back(0);
+    x_offsets.push_back(0);
+    y_offsets.push_back(0);
+    scripts.push_back(Script::Common);
+    flags.push_back(0);
+
+    return glyph_indices.size() - 1;
+}
+
+template <typename T>
+void splice_array(std::vector<T> &array, size_t start, size_t end, const std::vector<T> &other) {
+    // Overwrite in place as much as possible, so that equally sized replacements don't move the tail.
+    size_t common_count = std::min(end - start, other.size());
+    std::copy(other.begin(), other.begin() + common_count, array.begin() + start);
+
+    if (other.size() > common_count) {
+        array.insert(array.begin() + start + common_count, other.begin() + common_count, other.end());
+    } else {
+        array.erase(array.begin() + start + common_count, array.begin() + end);
+    }
+}
+
+void GlyphRun::splice(size_t start, size_t end, const GlyphRun &other) {
+    splice_array(glyph_indices, start, end, other.glyph_indices);
+    splice_array(cluster_starts, start, end, other.cluster_starts);
+    splice_array(cluster_ends, start, end, other.cluster_ends);
+    splice_array(x_advances, start, end, other.x_advances);
+    splice_array(x_offsets, start, end, other.x_offsets);
+    splice_array(y_offsets, start, end, other.y_offsets);
+    splice_array(scripts, start, end, other.scripts);
+    splice_array(flags, start, end, other.flags);
+
+    // Font indices of the other run need to be remapped to this run's fonts.
+    std::vector<uint16_t> font_index_map(other.fonts.size());
+    for (size_t i = 0; i < other.fonts.size(); i++) {
+        font_index_map[i] = add_font(other.fonts[i]);
+    }
+
+    std::vector<uint16_t> new_font_indices(other.font_indices.size());
+    for (size_t i = 0; i < other.font_indices.size(); i++) {
+        new_font_indices[i] = font_index_map[other.font_indices[i]];
+    }
+    splice_array(font_indices, start, end, new_font_indices);
+}
+
+RectF GlyphRun::get_glyph_box(size_t glyph) const {
+    const auto &font = get_font(glyph);
+
+    if (has_flag(glyph, FLAG_EMOJI)) {
+        return {0, 0, (float)font.font_size, (float)font.font_size};
+    }
+
+    return {0, -font.ascent, x_advances[glyph], -font.descent};
+}
+
+void GlyphRun::lock_fonts(std::vector<std::shared_ptr<Font>> &locked_fonts) const {
+    for (const auto &font : fonts) {
+        locked_fonts.push_back(font.font.lock());
+    }
+}
+
+} // namespace Flint
@@ -0,0 +1,133 @@
+#ifndef FLINT_GLYPH_RUN_H
+#define FLINT_GLYPH_RUN_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "../common/geometry.h"
+
+namespace Flint {
+
+class Font;
+
+enum class Script : uint8_t {
+    Common = 0,
+    Arabic,
+    Bengali,
+    Devanagari,
+    Hebrew,
+    Cjk,
+    Hiragana,
+    Katakana,
+    Thai,
+};
+
+/// A font used by the glyphs of a run.
+struct GlyphRunFont {
+    /// Not owned, so that cached runs don't keep their fonts alive.
+    std::weak_ptr<Font> font;
+
+    uint32_t font_id = 0;
+
+    // Font size in pixels the glyphs were shaped with.
+    uint32_t font_size = 0;
+
+    // The origin is the baseline and the Y axis points upward.
+    float ascent = 0;
+    float descent = 0;
+};
+
+/// Shaped glyphs stored as a structure of arrays. All the arrays have the same length.
+///
+/// Glyph outlines are not stored in the run. They are referenced by (font, glyph index, font size),
+/// and fetched from the font's glyph cache when needed.
+struct GlyphRun {
+    /// Line breaks and other glyphs that shouldn't be drawn.
+    static constexpr uint8_t FLAG_SKIP_DRAWING = 1 << 0;
+
+    /// The glyph index refers to an SVG glyph in the glyph's font.
+    static constexpr uint8_t FLAG_EMOJI = 1 << 1;
+
+    /// The glyph is a space.
+    static constexpr uint8_t FLAG_SPACE = 1 << 2;
+
+    /// A line can break between the glyph and the one before it in visual order.
+    /// Found with the UAX #14 rules at shaping time.
+    static constexpr uint8_t FLAG_LINE_BREAKABLE = 1 << 3;
+
+    // Glyph index (font specific). Zero for invalid glyphs.
+    std::vector<uint16_t> glyph_indices;
+
+    // Index into `fonts`.
+    std::vector<uint16_t> font_indices;
+
+    // Codepoint range of the glyph's cluster in the text. One cluster may contain multiple codepoints.
+    std::vector<uint32_t> cluster_starts;
+    std::vector<uint32_t> cluster_ends;
+
+    // Advance to the next glyph along the baseline.
+    std::vector<float> x_advances;
+
+    // Offset from the origin of the glyph on the baseline.
+    std::vector<float> x_offsets;
+    std::vector<float> y_offsets;
+
+    std::vector<Script> scripts;
+
+    std::vector<uint8_t> flags;
+
+    std::vector<GlyphRunFont> fonts;
+
+    size_t size() const;
+
+    bool empty() const;
+
+    void clear();
+
+    void reserve(size_t glyph_count);
+
+    /// Add a font to the font list if it's not there yet. Returns its index.
+    uint16_t add_font(const GlyphRunFont &font);
+
+    /// Append an empty glyph. Returns its index.
+    size_t add_glyph();
+
+    /// Replace the glyphs in [start, end) with all the glyphs of another run.
+    void splice(size_t start, size_t end, const GlyphRun &other);
+
+    bool has_flag(size_t glyph, uint8_t flag) const {
+        return flags[glyph] & flag;
+    }
+
+    void set_flag(size_t glyph, uint8_t flag, bool enabled) {
+        flags[glyph] = enabled ? flags[glyph] | flag : flags[glyph] & ~flag;
+    }
+
+    const GlyphRunFont &get_font(size_t glyph) const {
+        return fonts[font_indices[glyph]];
+    }
+
+    /// Glyph box in the glyph's baseline coordinates, which has nothing to do with the glyph position in the text.
+    /// The Y axis points downward.
+    RectF get_glyph_box(size_t glyph) const;
+
+    /// Lock the fonts for drawing, appending them to the buffer, which keeps its capacity when cleared.
+    /// The font of a glyph is at its font index past the buffer's previous size. Fonts that have been destroyed are
+    /// null.
+    void lock_fonts(std::vector<std::shared_ptr<Font>> &locked_fonts) const;
+};
+
+/// A glyph run placed in a text, e.g. a paragraph of a label. The run and the positions are not owned.
+struct PlacedGlyphRun {
+    const GlyphRun *glyphs = nullptr;
+
+    /// One for each glyph, relative to the offset.
+    const std::vector<Vec2F> *glyph_positions = nullptr;
+
+    Vec2F offset;
+};
+
+} // namespace Flint
+
+#endif // FLINT_GLYPH_RUN_H
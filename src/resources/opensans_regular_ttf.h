@@ -4,7 +4,7 @@
 #include <cstdint>
 
 namespace Flint {
-    static uint8_t DEFAULT_FONT_DATA[] = {0,1,0,0,0,18,1,0,0,4,0,32,71,68,69,70,180,200,177,96,0,1,176,104,0,0,1,190,71,80,79,83,91,170,114,112,0,1,178,40,0,0,57,116,71,83,85,66,131,237,153,151,0,1,235,156,0,0,15,6,79,83,47,50,150,64,131,44,0,1,107,156,0,0,0,96,83,84,65,84,94,251,67,53,0,1,250,164,0,0,0,94,99,109,97,112,195,56,31,128,0,1,107,252,0,0,3,246,99,118,116,32,61,63,44,200,0,1,130,40,0,0,0,252,102,112,103,109,226,25,158,90,0,1,111,244,0,0,15,148,103,97,115,112,0,21,0,35,0,1,176,88,0,0,0,16,103,108,121,102,183,58,171,163,0,0,1,44,0,1,79,56,104,101,97,100,27,157,52,186,0,1,89,112,0,0,0,54,104,104,101,97,13,200,8,246,0,1,107,120,0,0,0,36,104,109,116,120,83,236,67,87,0,1,89,168,0,0,17,206,108,111,99,97,146,78,64,130,0,1,80,132,0,0,8,234,109,97,120,112,7,251,16,165,0,1,80,100,0,0,0,32,110,97,109,101,169,157,204,70,0,1,131,36,0,0,5,198,112,111,115,116,38,172,156,156,0,1,136,236,0,0,39,106,112,114,101,112,133,253,123,233,0,1,127,136,0,0,2,159,0,2,0,150,255,228,1,132,5,182,0,3,0,15,0,22,64,10,1,1,7,7,13,11,114,2,2,114,0,43,43,50,17,51,124,47,48,49,65,35,3,51,3,52,54,51,50,22,21,20,6,35,34,38,1,69,109,46,201,221,68,51,50,69,69,50,51,68,1,150,4,32,250,178,70,59,59,70,69,63,63,0,0,2,0,135,3,166,2,169,5,182,0,3,0,7,0,16,182,5,1,128,4,3,2,114,0,43,50,26,205,50,48,49,65,3,35,3,33,3,35,3,1,59,38,105,37,2,34,37,105,37,5,182,253,240,2,16,253,240,2,16,0,2,0,52,0,0,4,246,5,182,0,27,0,31,0,57,64,27,1,28,28,14,0,31,31,25,21,21,18,18,15,4,8,8,11,11,14,14,10,23,19,2,6,10,8,0,63,51,63,51,18,57,47,51,17,51,17,51,206,50,17,51,17,51,50,17,51,17,51,17,51,48,49,65,3,33,21,33,3,35,19,33,3,35,19,33,53,33,19,33,53,33,19,51,3,33,19,51,3,33,21,1,33,19,33,3,212,65,1,27,254,204,85,135,85,254,207,82,133,79,254,250,1,31,67,254,234,1,45,83,137,83,1,51,83,132,83,1,9,252,228,1,49,66,254,207,3,131,254,172,127,254,80,1,176,254,80,1,176,127,1,84,125,1,182,254,74,1,182,254,74,125,254,172,1,84,0,3,0,127,255,137,4,23,6,18,0,36,0,44,0,53,0,40,64,20,27,46,46,40,44,9,28,45,13,6,1,20,18,17,37,8,8,35,0,1,0,47,205,51,51,17,51,47,205,51,18,23,57,51,17,51,48,49,69,53,38,38,39,53,22,22,23,17,46,2,53,52,54,54,55,53,51,21,22,22,23,7,38,38,39,17,30,2,21,20,6,7,21,17,54,54,53,52,38,38,39,39,17,14,2,21,20,22,22,2,6,115,209,66,69,216,105,132,173,86,97,176,118,122,107,176,75,52,68,158,80,134,181,92,214,193,123,121,47,106,91,122,75,102,51,45,101,119,210,2,36,29,162,32,48,2,1,184,37,95,138,98,102,145,82,6,173,171,3,41,32,139,27,38,7,254,75,39,88,130,103,146,179,19,218,1,110,12,95,78,56,72,53,24,208,1,135,5,46,74,51,59,79,55,0,5,0,102,255,236,6,55,5,203,0,11,0,23,0,27,0,39,0,51,0,34,64,17,40,28,46,34,13,114,26,12,18,6,0,27,27,12,0,5,114,0,43,50,50,47,16,204,50,63,43,50,204,50,48,49,65,50,22,21,20,6,35,34,38,53,52,54,23,34,6,21,20,22,51,50,54,53,52,38,37,1,35,1,19,50,22,21,20,6,35,34,38,53,52,54,23,34,6,21,20,22,51,50,54,53,52,38,1,143,150,155,150,155,144,153,146,151,81,76,76,81,84,82,81,3,73,252,213,146,3,43,107,149,156,150,155,145,152,145,152,81,76,76,81,84,82,81,5,203,239,218,218,243,243,218,218,239,119,169,169,169,172,172,169,168,170,98,250,74,5,182,253,203,239,218,217,243,243,217,218,239,120,168,169,169,171,169,171,168,169,0,0,3,0,111,255,236,5,201,5,205,0,37,0,48,0,60,0,43,64,25,7,30,55,3,0,18,48,15,8,38,5,11,11,0,45,22,11,114,16,10,114,49,0,3,114,0,43,50,43,43,50,17,57,47,23,57,18,23,57,48,49,65,50,22,22,21,20,6,7,1,54,54,55,51,6,6,7,1,35,39,14,2,35,34,38,38,53,52,54,54,55,46,2,53,52,54,54,19,14,2,21,20,22,51,50,54,55,1,34,6,21,20,22,23,54,54,53,52,38,2,111,108,157,85,169,130,1,150,55,70,24,168,32,101,76,1,37,225,181,64,147,179,115,140,206,113,78,144,100,47,84,52,91,167,25,78,111,59,158,132,136,191,67,254,160,91,113,82,76,125,113,105,5,205,75,140,99,130,180,74,254,118,64,169,99,132,222,84,254,225,177,59,89,49,92,178,129,106,152,118,56,52,107,123,74,100,142,76,252,245,45,88,110,78,117,141,90,64,4,43,95,85,76,128,78,69,129,87,79,98,0,1,0,135,3,166,1,59,5,182,0,3,0,10,179,1,3,2,114,0,43,205,48,49,65,3,35,3,1,59,38,105,37,5,182,253,240,2,16,0,0,1,0,82,254,188,2,30,5,182,0,16,0,10,179,13,4,2,114,0,43,47,48,49,83,52,18,18,55,51,6,2,21,20,18,18,23,35,38,2,2,82,65,134,102,159,145,146,65,129,95,157,102,134,65,2,49,169,1,64,1,34,122,190,254,48,245,160,254,201,254,224,128,120,1,27,1,60,0,1,0,62,254,188,2,10,5,182,0,17,0,10,179,13,2,114,5,0,47,43,48,49,65,20,2,2,7,35,54,18,18,53,52,2,2,39,51,22,18,18,2,10,65,133,103,157,96,129,65,66,129,97,159,103,133,65,2,51,167,254,195,254,228,119,127,1,34,1,55,160,163,1,60,1,36,127,123,254,223,254,193,0,0,1,0,89,2,134,4,10,6,20,0,14,0,27,64,16,5,9,7,4,10,11,3,13,1,2,12,11,6,8,128,0,0,47,26,205,50,23,57,48,49,65,3,37,23,5,19,7,3,3,39,19,37,55,5,3,2,139,38,1,139,26,254,134,244,162,181,166,168,242,254,136,28,1,133,39,6,20,254,115,115,175,39,254,187,89,1,100,254,156,89,1,69,39,175,115,1,141,0,1,0,103,0,230,4,40,4,192,0,11,0,14,180,10,9,9,5,6,0,47,51,51,17,51,48,49,65,33,21,33,17,35,17,33,53,33,17,51,2,140,1,156,254,100,137,254,100,1,156,137,3,22,136,254,88,1,168,136,1,170,0,1,0,83,254,248,1,122,0,238,0,10,0,12,179,5,128,1,0,0,47,50,26,205,48,49,101,23,14,2,7,35,62,2,55,1,109,13,18,55,65,33,124,21,40,33,10,238,23,73,166,167,73,80,177,173,72,0,0,1,0,82,1,220,2,66,2,112,0,3,0,8,177,1,0,0,47,50,48,49,83,53,33,21,82,1,240,1,220,148,148,0,0,1,0,150,255,228,1,132,0,233,0,11,0,10,179,3,9,11,114,0,43,50,48,49,119,52,54,51,50,22,21,20,6,35,34,38,150,68,49,51,70,70,51,49,68,104,70,59,59,70,69,63,63,0,0,1,0,21,0,0,2,217,5,182,0,3,0,11,180,3,2,114,1,8,0,63,43,48,49,65,1,35,1,2,217,253,224,164,2,33,5,182,250,74,5,182,0,2,0,103,255,236,4,43,5,205,0,16,0,32,0,16,183,29,13,5,114,21,5,13,114,0,43,50,43,50,48,49,65,20,2,6,6,35,34,38,2,53,52,18,54,51,50,22,18,5,20,18,22,51,50,54,18,53,52,2,38,35,34,6,2,4,43,54,116,184,129,163,213,105,95,212,174,165,214,104,252,227,62,139,113,113,139,63,62,138,115,115,138,61,2,221,178,254,232,194,101,178,1,81,238,234,1,81,181,179,254,175,236,204,254,240,135,134,1,16,205,201,1,15,137,137,254,241,0,1,0,185,0,0,2,207,5,182,0,13,0,21,64,10,11,10,10,6,12,4,114,0,12,114,0,43,43,50,50,47,51,48,49,97,35,17,52,54,54,55,6,6,7,7,39,1,51,2,207,162,1,3,3,31,54,40,167,87,1,140,138,4,12,59,85,71,37,32,45,33,134,113,1,49,0,1,0,101,0,0,4,35,5,203,0,29,0,23,64,11,10,18,5,114,27,2,28,28,1,12,114,0,43,50,17,51,51,43,50,48,49,97,33,53,1,62,2,53,52,38,35,34,6,7,39,62,2,51,50,22,22,21,20,6,6,7,1,21,33,4,35,252,66,1,135,109,149,78,147,120,105,162,85,89,58,137,157,89,135,196,107,92,166,111,254,194,2,235,139,1,141,110,172,167,100,124,131,72,66,112,49,76,44,94,174,120,116,199,195,109,254,195,7,0,0,1,0,92,255,236,4,26,5,203,0,46,0,31,64,15,5,4,28,28,27,27,12,36,44,5,114,19,12,13,114,0,43,50,43,50,17,57,47,51,18,57,57,48,49,65,20,6,6,7,21,22,22,21,20,6,6,35,34,38,39,53,22,22,51,50,54,53,52,38,38,35,35,53,51,50,54,54,53,52,38,35,34,6,6,7,39,54,54,51,50,22,3,237,76,136,92,174,175,119,245,191,116,197,90,91,214,100,200,178,99,185,130,146,147,119,166,87,148,127,78,128,112,56,84,80,230,146,224,224,4,97,98,144,91,18,8,22,180,146,127,196,111,37,43,156,45,51,159,138,95,117,55,142,70,127,87,111,121,32,56,37,114,62,90,204,0,2,0,44,0,0,4,108,5,190,0,10,0,22,0,31,64,15,6,22,9,9,5,1,1,2,18,7,4,114,2,12,114,0,43,43,50,17,57,47,51,51,17,51,51,48,49,65,35,17,35,17,33,53,1,51,17,51,33,17,52,62,2,55,35,6,6,7,1,4,108,219,162,253,61,2,184,173,219,254,131,2,4,3,1,8,19,49,25,254,61,1,83,254,173,1,83,140,3,223,252,43,1,222,55,89,77,70,34,40,89,35,253,129,0,1,0,132,255,236,4,29,5,182,0,33,0,35,64,17,26,25,25,22,22,31,0,0,8,30,27,4,114,15,8,13,114,0,43,50,43,50,17,57,47,51,51,17,51,17,51,48,49,65,50,22,22,21,20,6,6,35,34,38,39,53,22,22,51,50,54,54,53,52,38,35,34,6,7,39,19,33,21,33,3,54,54,2,51,149,220,121,130,244,170,114,196,67,73,208,98,111,167,93,179,193,62,148,48,84,56,2,215,253,183,37,38,120,3,126,101,192,137,150,217,117,40,40,158,44,52,71,145,110,146,159,20,12,55,2,174,152,254,71,8,17,0,2,0,116,255,236,4,48,5,203,0,34,0,49,0,31,64,15,18,17,41,41,22,22,6,35,30,13,114,13,6,5,114,0,43,50,43,50,18,57,47,51,17,51,51,48,49,83,52,62,3,51,50,22,23,21,38,38,35,34,6,2,7,51,62,2,51,50,22,22,21,20,6,6,35,34,46,2,1,50,54,53,52,38,35,34,6,6,21,20,30,2,116,37,88,152,227,159,45,104,34,37,95,48,186,213,94,7,11,31,96,137,91,128,191,105,112,207,143,107,180,133,74,1,236,136,164,146,147,100,148,82,39,80,122,2,113,132,252,217,164,93,9,10,143,13,12,162,254,235,173,50,81,48,104,198,141,151,220,119,82,162,241,254,167,174,176,144,168,83,126,65,66,136,116,70,0,1,0,93,0,0,4,44,5,182,0,6,0,19,64,9,5,2,2,3,4,114,0,12,114,0,43,43,50,17,51,48,49,97,1,33,53,33,21,1,1,34,2,88,252,227,3,207,253,172,5,30,152,128,250,202,0,3,0,103,255,236,4,41,5,203,0,31,0,46,0,60,0,26,64,14,43,24,8,54,4,0,35,16,13,114,47,0,5,114,0,43,50,43,50,17,23,57,48,49,65,50,22,22,21,20,6,6,7,30,2,21,20,6,6,35,34,38,38,53,52,54,54,55,46,2,53,52,54,54,3,20,22,51,50,54,53,52,38,38,39,39,14,2,1,34,6,21,20,22,22,23,62,2,53,52,38,2,72,127,196,111,77,130,79,94,151,88,119,214,144,155,217,113,86,142,84,73,121,71,113,197,194,158,160,152,166,76,140,95,36,92,129,68,1,60,118,150,73,126,78,76,118,68,149,5,203,80,155,113,89,133,99,39,43,108,146,100,123,179,96,93,175,123,101,149,108,37,40,102,137,91,111,155,81,251,167,112,145,145,118,73,111,88,36,13,38,93,118,3,131,113,106,76,105,75,32,32,77,106,74,106,112,0,0,2,0,103,255,235,4,37,5,203,0,34,0,49,0,31,64,15,17,18,41,41,22,22,6,35,30,5,114,13,6,13,114,0,43,50,43,50,17,57,47,51,17,51,51,48,49,65,20,14,3,35,34,38,39,53,22,22,51,50,54,18,55,35,14,2,35,34,38,38,53,52,54,54,51,50,30,2,1,34,6,21,20,22,51,50,54,54,53,52,46,2,4,37,37,89,152,229,159,43,110,35,37,100,48,187,214,94,6,12,30,97,138,92,127,189,105,115,208,141,108,180,133,73,254,18,133,165,142,148,102,149,81,39,80,122,3,71,133,252,218,164,93,11,10,144,13,15,161,1,21,173,48,81,49,104,198,140,151,221,120,82,163,240,1,88,174,175,145,168,82,126,66,66,136,115,71,0,0,2,0,150,255,228,1,132,4,98,0,11,0,23,0,16,183,21,15,7,114,3,9,11,114,0,43,50,43,50,48,49,119,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,150,68,49,51,70,70,51,49,68,68,49,51,70,70,51,49,68,104,70,59,59,70,69,63,63,3,188,72,59,59,72,68,62,62,0,2,0,65,254,248,1,128,4,98,0,10,0,22,0,18,183,20,14,7,114,1,5,128,10,0,47,26,205,57,43,50,48,49,101,23,14,2,7,35,62,2,55,3,52,54,51,50,22,21,20,6,35,34,38,1,92,14,18,56,65,32,126,21,40,35,10,25,68,49,53,68,68,53,49,68,238,23,72,167,167,73,79,177,174,72,2,241,72,59,59,72,68,62,62,0,0,1,0,103,0,243,4,41,4,216,0,6,0,18,183,2,5,1,3,4,3,6,0,0,47,50,206,50,23,57,48,49,101,1,53,1,21,1,1,4,41,252,62,3,194,252,242,3,14,243,1,170,95,1,220,148,254,143,254,179,0,2,0,115,1,193,4,29,3,225,0,3,0,7,0,12,179,1,0,4,5,0,47,51,206,50,48,49,83,53,33,21,1,53,33,21,115,3,170,252,86,3,170,3,90,135,135,254,103,135,135,0,0,1,0,103,0,243,4,41,4,216,0,6,0,18,183,5,1,4,3,2,3,0,6,0,47,51,206,50,23,57,48,49,83,1,1,53,1,21,1,103,3,15,252,241,3,194,252,62,1,134,1,75,1,115,148,254,36,95,254,86,0,2,0,31,255,228,3,60,5,203,0,31,0,43,0,23,64,11,31,31,35,35,41,11,114,12,19,3,114,0,43,50,43,50,17,51,47,48,49,65,53,52,54,54,55,62,2,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,6,7,14,2,21,21,3,52,54,51,50,22,21,20,6,35,34,38,1,32,30,75,67,78,91,40,134,122,99,154,71,58,82,192,118,193,212,60,110,75,66,70,26,177,66,52,49,69,69,49,52,66,1,150,52,80,115,100,56,65,91,92,65,104,111,50,35,134,43,54,191,167,93,131,109,61,56,85,89,62,33,254,210,70,59,59,70,69,63,63,0,0,2,0,118,255,71,6,183,5,180,0,65,0,79,0,41,64,19,73,76,76,22,19,37,62,3,114,9,69,69,29,5,5,12,128,46,53,0,47,51,26,204,50,47,51,50,17,51,43,50,204,50,50,17,51,48,49,65,20,14,2,35,34,38,39,35,6,6,35,34,38,53,52,54,54,51,50,22,23,3,6,6,21,20,22,51,50,54,54,53,52,2,36,35,34,4,6,2,21,20,18,4,51,50,54,55,21,6,6,35,34,36,2,53,52,18,54,36,51,50,4,18,1,20,22,51,50,54,55,19,38,38,35,34,6,6,6,183,43,88,131,89,93,110,11,9,38,147,107,156,169,107,195,133,89,168,50,20,1,2,77,55,67,91,48,154,254,241,176,175,254,241,187,96,145,1,25,202,122,226,89,88,218,131,241,254,170,182,119,225,1,65,201,215,1,75,189,251,238,106,94,116,109,8,12,29,83,45,103,127,58,2,218,95,181,145,86,108,74,79,103,207,172,134,207,119,30,18,254,109,37,39,11,108,75,105,177,108,191,1,14,142,110,201,254,236,167,204,254,226,149,54,34,130,37,47,181,1,84,238,193,1,68,238,131,177,254,185,254,154,133,124,174,143,1,5,9,13,98,156,0,2,0,0,0,0,5,13,5,188,0,7,0,18,0,27,64,13,13,3,18,2,2,3,5,2,114,7,3,8,114,0,43,50,43,17,57,47,51,17,57,48,49,97,3,33,3,35,1,51,1,1,3,46,2,39,14,2,7,3,4,93,180,253,182,179,172,2,60,153,2,56,254,105,171,6,27,28,9,10,23,22,8,174,1,208,254,48,5,188,250,68,2,103,1,205,18,82,88,27,41,81,69,24,254,51,0,3,0,200,0,0,4,188,5,182,0,18,0,27,0,37,0,31,64,15,9,8,19,19,28,28,0,29,18,8,114,27,0,2,114,0,43,50,43,50,18,57,47,51,18,57,57,48,49,83,33,32,4,21,20,6,6,7,21,30,2,21,20,6,6,35,33,19,33,50,54,53,52,38,35,35,17,17,33,50,54,53,52,38,38,35,200,1,158,1,18,1,20,65,124,91,96,148,84,125,228,156,254,9,170,1,24,191,147,175,191,252,1,48,195,162,73,163,136,5,182,164,197,85,135,88,17,10,15,80,144,111,135,186,95,3,67,126,121,125,110,253,143,253,221,153,130,83,118,63,0,1,0,125,255,236,4,203,5,203,0,31,0,16,183,0,25,3,114,9,16,9,114,0,43,50,43,50,48,49,65,34,14,2,21,20,18,22,51,50,54,55,21,6,6,35,34,36,2,53,52,18,54,36,51,50,22,23,7,38,38,3,57,121,193,135,72,115,229,172,98,173,82,80,176,121,223,254,213,149,93,179,1,5,169,111,206,83,68,70,167,5,53,83,157,222,139,184,254,241,148,33,25,148,30,29,185,1,82,230,166,1,19,200,109,44,41,144,32,47,0,2,0,200,0,0,5,81,5,182,0,10,0,20,0,16,183,16,6,2,114,17,5,8,114,0,43,50,43,50,48,49,65,20,2,4,35,33,17,33,50,4,18,7,52,2,38,35,35,17,51,32,0,5,81,180,254,171,243,254,115,1,185,223,1,66,175,179,131,253,183,245,207,1,46,1,47,2,233,247,254,181,167,5,182,163,254,193,241,197,1,0,125,251,109,1,42,0,0,1,0,200,0,0,3,246,5,182,0,11,0,25,64,12,6,9,9,1,5,2,2,114,10,1,8,114,0,43,50,43,50,17,57,47,51,48,49,97,33,17,33,21,33,17,33,21,33,17,33,3,246,252,210,3,46,253,124,2,95,253,161,2,132,5,182,150,254,39,148,253,227,0,0,1,0,200,0,0,3,246,5,182,0,9,0,23,64,11,6,9,9,1,5,2,2,114,1,8,114,0,43,43,50,17,57,47,51,48,49,97,35,17,33,21,33,17,33,21,33,1,114,170,3,46,253,124,2,93,253,163,5,182,150,253,232,149,0,1,0,125,255,236,5,56,5,203,0,33,0,25,64,12,33,0,0,5,20,13,3,114,28,5,9,114,0,43,50,43,50,17,57,47,51,48,49,65,33,17,6,6,35,34,36,2,53,52,18,36,51,50,22,23,7,38,38,35,34,6,2,21,20,18,22,51,50,54,55,17,33,3,57,1,255,115,243,150,228,254,199,162,179,1,83,238,122,219,94,65,81,195,104,179,255,135,118,250,197,99,142,58,254,171,2,254,253,59,39,38,182,1,81,232,227,1,82,187,45,41,148,35,50,148,254,242,185,183,254,241,150,23,16,1,192,0,0,1,0,200,0,0,5,28,5,182,0,11,0,25,64,12,8,3,3,5,11,6,2,114,1,5,8,114,0,43,50,43,50,17,57,47,51,48,49,97,35,17,33,17,35,17,51,17,33,17,51,5,28,170,253,0,170,170,3,0,170,2,177,253,79,5,182,253,145,2,111,0,0,1,0,200,0,0,1,114,5,182,0,3,0,12,181,1,2,114,0,8,114,0,43,43,48,49,115,17,51,17,200,170,5,182,250,74,0,1,255,92,254,127,1,106,5,182,0,17,0,12,180,13,2,114,7,0,0,47,50,43,48,49,67,34,38,39,53,22,22,51,50,54,54,53,17,51,17,20,6,6,11,50,76,27,32,74,43,56,94,56,171,91,167,254,127,14,12,145,10,11,44,106,93,5,174,250,95,137,180,89,0,1,0,200,0,0,4,230,5,182,0,14,0,26,64,14,3,2,8,14,4,5,13,6,2,114,1,5,8,114,0,43,50,43,50,18,23,57,48,49,97,35,1,7,17,35,17,51,17,54,54,55,1,51,1,4,230,201,253,241,156,170,170,57,120,59,1,171,199,253,186,2,199,140,253,197,5,182,253,39,65,129,66,1,213,253,134,0,0,1,0,200,0,0,3,251,5,182,0,5,0,14,182,1,2,114,3,0,8,114,0,43,50,43,48,49,115,17,51,17,33,21,200,170,2,137,5,182,250,226,152,0,0,1,0,200,0,0,6,106,5,182,0,23,0,28,64,15,11,12,21,1,4,8,14,10,2,114,23,16,8,8,114,0,43,50,50,43,50,18,23,57,48,49,97,1,35,30,2,21,17,35,17,51,1,51,1,51,17,35,17,52,54,54,55,35,1,3,75,254,21,8,4,6,4,158,252,1,207,7,1,214,250,168,4,6,3,8,254,15,5,14,41,118,139,72,252,100,5,182,251,64,4,192,250,74,3,168,65,131,117,43,250,244,0,1,0,200,0,0,5,63,5,182,0,19,0,23,64,11,2,12,9,19,11,2,114,1,9,8,114,0,43,50,43,50,18,57,57,48,49,97,35,1,35,30,2,21,17,35,17,51,1,51,46,2,53,17,51,5,63,196,252,227,8,3,8,5,158,195,3,26,7,2,6,5,160,4,204,49,125,141,73,252,184,5,182,251,56,35,129,149,64,3,79,0,0,2,0,125,255,236,5,188,5,205,0,17,0,32,0,16,183,29,14,3,114,22,5,9,114,0,43,50,43,50,48,49,65,20,2,6,6,35,34,38,38,2,53,52,18,36,51,50,4,18,5,20,18,22,51,50,54,18,53,16,2,35,34,6,2,5,188,86,169,250,165,170,253,167,83,148,1,45,227,217,1,41,153,251,116,106,219,169,170,217,104,237,251,170,220,107,2,221,169,254,235,199,108,108,200,1,22,169,224,1,82,188,186,254,175,229,186,254,240,148,148,1,16,186,1,27,1,63,146,254,243,0,0,2,0,200,0,0,4,102,5,182,0,12,0,22,0,23,64,11,15,9,9,11,14,12,2,114,11,8,114,0,43,43,50,17,57,47,51,48,49,65,32,4,21,20,14,2,35,35,17,35,17,5,35,17,51,50,54,54,53,52,38,2,70,1,27,1,5,61,136,221,160,178,170,1,110,196,159,140,187,94,186,5,182,221,206,93,167,127,73,253,193,5,182,145,253,172,60,135,112,146,143,0,0,2,0,125,254,164,5,188,5,205,0,22,0,37,0,25,64,12,34,19,3,114,4,7,27,27,5,10,9,114,0,43,204,51,18,57,57,43,50,48,49,65,20,2,6,7,1,35,1,34,6,35,34,38,38,2,53,52,18,36,51,50,4,18,5,20,18,22,51,50,54,18,53,16,2,35,34,6,2,5,188,98,193,144,1,88,243,254,229,13,27,13,170,253,167,83,148,1,45,227,217,1,41,153,251,116,106,219,169,170,217,104,237,251,170,220,107,2,221,180,254,220,202,46,254,151,1,74,2,108,200,1,22,169,224,1,82,188,186,254,175,229,186,254,240,148,148,1,16,186,1,27,1,63,146,254,243,0,0,2,0,200,0,0,4,206,5,182,0,15,0,24,0,29,64,14,8,18,18,12,12,14,17,15,2,114,10,14,8,114,0,43,50,43,50,17,57,47,51,18,57,48,49,65,50,22,22,21,20,6,6,7,1,35,1,33,17,35,17,5,35,17,51,50,54,53,52,38,2,83,180,235,116,84,136,77,1,145,198,254,154,254,208,170,1,129,215,232,179,169,179,5,182,89,182,141,116,155,96,26,253,111,2,98,253,158,5,182,147,253,207,146,142,149,124,0,0,1,0,105,255,236,4,1,5,203,0,47,0,28,64,16,16,0,20,44,40,25,6,4,36,29,3,114,12,4,9,114,0,43,50,43,50,18,23,57,48,49,65,20,6,6,35,34,38,38,39,53,22,22,51,50,54,54,53,52,38,38,39,46,3,53,52,54,54,51,50,22,23,7,38,38,35,34,6,6,21,20,22,22,23,30,2,4,1,129,232,157,83,148,124,47,75,216,118,110,152,79,66,153,132,93,142,96,49,119,211,137,117,199,83,53,79,177,94,94,129,68,65,143,118,129,180,94,1,133,130,183,96,16,30,22,163,31,53,59,111,78,75,101,83,47,33,79,100,132,85,117,167,89,44,37,146,33,44,55,100,69,77,102,79,43,47,105,151,0,0,1,0,18,0,0,4,83,5,182,0,7,0,19,64,9,7,3,3,4,2,114,1,8,114,0,43,43,50,17,51,48,49,97,35,17,33,53,33,21,33,2,137,171,254,52,4,65,254,54,5,32,150,150,0,1,0,185,255,236,5,26,5,182,0,19,0,16,183,19,9,2,114,14,5,9,114,0,43,50,43,50,48,49,65,17,20,6,6,35,32,0,53,17,51,17,20,22,51,50,54,54,53,17,5,26,125,252,190,254,241,254,229,171,197,196,134,171,83,5,182,252,78,155,242,139,1,38,246,3,174,252,77,186,202,97,175,115,3,180,0,1,0,0,0,0,4,197,5,182,0,14,0,19,64,9,9,2,14,3,2,114,2,8,114,0,43,43,50,18,57,48,49,65,1,35,1,51,1,30,2,23,62,2,55,1,4,197,253,243,171,253,243,178,1,86,21,33,26,10,10,26,34,21,1,84,5,182,250,74,5,182,252,61,58,106,98,46,46,99,107,59,3,192,0,1,0,30,0,0,7,69,5,182,0,41,0,27,64,14,8,23,36,3,15,41,30,16,2,114,2,15,8,114,0,43,50,43,50,50,17,23,57,48,49,65,1,35,1,46,3,39,14,3,7,1,35,1,51,19,30,3,23,62,3,55,1,51,1,30,3,23,62,2,55,19,7,69,254,121,171,254,222,13,23,20,13,3,2,11,17,23,13,254,230,171,254,124,177,235,12,21,17,14,6,5,16,19,23,13,1,7,175,1,18,14,24,19,15,6,7,20,27,16,235,5,182,250,74,3,216,42,85,77,59,15,15,58,76,86,44,252,41,5,182,252,107,46,89,84,80,38,39,85,88,90,45,3,139,252,110,47,92,87,79,35,49,108,118,63,3,148,0,1,0,6,0,0,4,152,5,182,0,11,0,26,64,14,2,5,11,8,4,1,10,6,2,114,1,4,8,114,0,43,50,43,50,18,23,57,48,49,97,35,1,1,35,1,1,51,1,1,51,1,4,152,193,254,117,254,111,181,1,231,254,59,189,1,109,1,111,180,254,60,2,132,253,124,2,250,2,188,253,185,2,71,253,71,0,1,0,0,0,0,4,121,5,182,0,8,0,23,64,12,6,3,0,3,4,2,7,2,114,4,8,114,0,43,43,50,18,23,57,48,49,65,1,51,1,17,35,17,1,51,2,61,1,133,183,254,25,170,254,24,186,2,217,2,221,252,129,253,201,2,47,3,135,0,0,1,0,78,0,0,4,69,5,182,0,9,0,25,64,12,7,4,4,5,2,114,2,8,8,1,8,114,0,43,50,17,51,43,50,17,51,48,49,97,33,53,1,33,53,33,21,1,33,4,69,252,9,3,19,253,8,3,199,252,236,3,41,128,4,158,152,128,251,98,0,1,0,166,254,188,2,107,5,182,0,7,0,14,181,5,2,2,114,6,1,0,47,51,43,50,48,49,65,33,17,33,21,33,17,33,2,107,254,59,1,197,254,221,1,35,254,188,6,250,136,250,24,0,0,1,0,21,0,0,2,219,5,182,0,3,0,12,181,3,2,114,1,8,114,0,43,43,48,49,83,1,35,1,185,2,34,165,253,223,5,182,250,74,5,182,0,1,0,51,254,188,1,249,5,182,0,7,0,14,181,0,7,3,4,2,114,0,43,50,47,51,48,49,87,33,17,33,53,33,17,33,51,1,35,254,221,1,198,254,58,186,5,232,136,249,6,0,0,1,0,80,2,37,4,68,5,193,0,6,0,14,181,5,4,0,1,17,114,0,43,205,50,57,48,49,83,1,51,1,35,1,1,80,1,183,96,1,221,149,254,138,254,172,2,37,3,156,252,100,2,234,253,22,0,1,255,252,254,205,3,133,255,72,0,3,0,8,177,1,2,0,47,51,48,49,65,33,53,33,3,133,252,119,3,137,254,205,123,0,0,1,0,82,4,217,1,231,6,33,0,12,0,18,183,11,4,0,128,15,6,1,6,0,47,93,26,205,57,57,48,49,65,30,2,23,21,35,46,3,39,53,1,24,24,71,79,33,113,36,85,84,68,19,6,33,46,113,107,38,24,29,80,89,81,29,20,0,0,2,0,94,255,236,3,203,4,90,0,29,0,40,0,35,64,18,7,37,37,11,30,19,19,0,11,11,114,4,10,114,23,0,7,114,0,43,50,43,43,18,57,47,51,17,51,17,51,48,49,65,50,22,21,17,35,39,35,14,2,35,34,38,38,53,52,36,37,55,53,52,38,35,34,6,7,39,54,54,1,7,6,6,21,20,22,51,50,54,53,2,73,196,190,121,32,8,46,100,131,95,100,155,89,1,4,1,10,189,122,111,86,156,70,51,74,192,1,72,167,205,168,114,94,146,186,4,90,176,193,253,23,162,60,81,41,70,142,109,164,176,8,8,67,142,114,50,34,126,38,54,253,194,7,8,118,108,94,90,162,162,0,2,0,175,255,236,4,115,6,20,0,22,0,36,0,37,64,20,22,0,114,21,10,114,18,19,31,31,15,11,114,5,4,23,23,8,7,114,0,43,50,17,51,51,43,50,17,51,51,43,43,48,49,65,17,20,6,7,51,54,54,51,50,18,17,20,6,6,35,34,38,39,35,7,35,17,1,34,6,6,21,21,20,22,51,50,54,53,52,38,1,85,7,2,9,45,170,132,206,245,112,204,139,130,167,45,13,34,120,1,230,119,140,61,138,182,153,153,151,6,20,254,123,67,126,35,74,102,254,227,254,231,185,254,130,97,70,147,6,20,253,188,93,187,143,9,207,219,224,208,212,214,0,1,0,114,255,236,3,146,4,92,0,29,0,16,183,15,8,7,114,23,0,11,114,0,43,50,43,50,48,49,69,34,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,6,21,20,22,22,51,50,54,55,21,6,6,2,102,148,226,126,133,234,149,82,153,49,50,50,131,57,114,151,75,73,145,109,87,140,57,55,135,20,122,250,190,199,253,122,33,25,139,20,32,98,190,139,133,188,99,37,25,148,28,30,0,0,2,0,114,255,236,4,53,6,20,0,23,0,36,0,37,64,20,17,10,114,16,0,114,11,10,31,31,6,7,114,19,20,24,24,0,11,114,0,43,50,17,51,51,43,50,17,51,51,43,43,48,49,69,34,2,17,16,18,51,50,22,22,23,51,38,38,53,17,51,17,35,39,35,14,2,39,50,54,53,53,52,38,35,34,6,21,20,22,2,53,208,243,248,206,87,130,94,32,12,4,8,166,134,25,7,31,95,131,63,176,146,139,183,153,152,151,20,1,28,1,24,1,27,1,33,46,77,49,31,108,34,1,183,249,236,156,49,80,47,138,200,197,30,209,224,235,203,202,220,0,2,0,114,255,236,4,19,4,92,0,23,0,31,0,25,64,12,27,6,6,0,9,16,11,114,24,0,7,114,0,43,50,43,50,18,57,47,51,48,49,65,50,22,22,21,21,33,22,22,51,50,54,55,21,6,6,35,34,38,38,53,52,18,54,23,34,6,7,33,46,2,2,85,140,200,106,253,11,3,186,169,104,160,86,83,163,111,158,235,130,119,217,145,133,158,15,2,68,1,59,120,4,92,124,223,149,103,193,202,38,37,146,37,34,129,250,181,177,1,3,140,136,174,156,98,149,83,0,1,0,30,0,0,3,14,6,31,0,24,0,27,64,14,6,5,1,1,23,6,114,19,12,1,114,3,10,114,0,43,43,50,43,50,17,51,57,48,49,65,33,17,35,17,35,53,55,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,21,33,2,151,254,239,166,194,194,82,156,112,63,105,40,43,34,85,44,95,91,1,17,3,198,252,58,3,198,80,55,73,138,173,82,22,14,131,11,19,123,131,80,0,0,3,0,31,254,20,4,47,4,94,0,47,0,63,0,75,0,45,64,22,34,12,64,64,32,6,57,57,41,41,0,26,23,23,70,19,7,114,48,0,15,114,0,43,50,43,50,50,17,51,17,57,47,51,18,57,198,50,17,57,57,48,49,65,34,38,53,52,54,55,38,38,53,52,54,55,38,38,53,52,54,54,51,50,22,22,23,33,21,7,22,22,21,20,6,35,34,39,6,6,21,20,22,22,51,51,50,22,21,20,4,37,50,54,54,53,52,38,38,35,35,34,6,6,21,20,22,19,50,54,53,52,38,35,34,6,21,20,22,1,225,216,234,131,116,43,61,67,69,86,107,98,186,132,29,59,54,20,1,120,202,30,40,222,194,46,48,49,51,39,74,52,193,179,191,254,216,254,237,136,179,89,60,116,84,190,74,110,59,150,182,119,120,122,119,114,123,124,254,20,161,145,103,146,24,20,80,52,60,91,42,35,167,111,118,167,88,5,9,6,107,25,39,110,67,164,193,8,27,66,43,32,38,17,150,144,182,194,130,55,103,71,66,67,23,46,90,67,89,93,3,108,120,115,123,123,127,122,112,120,0,1,0,175,0,0,4,65,6,20,0,26,0,27,64,14,26,0,114,15,25,10,114,4,5,19,19,9,7,114,0,43,50,17,51,51,43,50,43,48,49,65,17,20,6,7,51,62,2,51,50,22,22,21,17,35,17,52,38,35,34,6,6,21,17,35,17,1,85,4,5,11,34,105,134,75,132,177,89,164,125,129,122,145,63,166,6,20,254,47,40,81,34,58,79,41,84,176,140,253,54,2,191,137,136,93,180,130,253,195,6,20,0,2,0,160,0,0,1,104,5,226,0,3,0,15,0,16,183,4,10,3,6,114,2,10,114,0,43,43,206,50,48,49,65,17,35,17,19,50,22,21,20,6,35,34,38,53,52,54,1,85,166,85,41,59,59,41,43,57,57,4,72,251,184,4,72,1,154,53,56,55,54,54,55,56,53,0,0,2,255,144,254,20,1,104,5,226,0,16,0,28,0,19,64,9,20,26,11,6,114,7,0,15,114,0,43,50,43,206,50,48,49,83,34,38,39,53,22,22,51,50,54,53,17,51,17,20,6,6,19,52,54,51,50,22,21,20,6,35,34,38,43,51,76,28,31,64,40,68,84,166,64,132,15,57,43,41,59,59,41,43,57,254,20,15,10,135,10,11,76,100,4,249,251,11,100,143,76,7,97,56,53,53,56,55,54,54,0,1,0,175,0,0,4,36,6,20,0,18,0,32,64,19,18,0,114,15,14,4,5,11,8,6,10,13,13,17,10,114,10,6,114,0,43,43,50,17,18,23,57,43,48,49,65,17,20,6,7,51,54,54,55,1,51,1,1,35,1,7,17,35,17,1,84,6,2,7,21,81,28,1,108,195,254,71,1,217,200,254,125,133,165,6,20,252,216,40,115,44,26,102,31,1,132,254,44,253,140,2,7,122,254,115,6,20,0,1,0,175,0,0,1,86,6,20,0,3,0,12,181,2,0,114,1,10,114,0,43,43,48,49,97,35,17,51,1,86,167,167,6,20,0,1,0,175,0,0,6,194,4,92,0,39,0,40,64,23,28,29,36,37,4,19,19,33,9,0,7,114,33,7,114,26,6,114,14,5,25,10,114,0,43,50,50,43,43,43,50,17,51,17,23,51,48,49,65,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,52,38,38,35,34,6,6,21,17,35,17,51,23,51,62,2,51,50,22,23,51,54,54,5,85,181,184,164,115,113,159,144,165,51,101,77,109,132,59,166,134,25,9,33,100,124,70,125,169,38,9,54,188,4,92,189,209,253,50,2,198,133,133,184,179,253,155,2,198,89,118,59,90,177,129,253,188,4,72,155,57,78,40,93,95,95,93,0,0,1,0,175,0,0,4,65,4,92,0,21,0,27,64,14,15,6,114,5,14,10,114,18,17,9,9,0,7,114,0,43,50,17,51,51,43,50,43,48,49,65,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,51,23,51,62,2,2,182,195,200,164,125,129,182,148,166,134,25,9,35,108,134,4,92,191,211,253,54,2,191,137,136,206,196,253,194,4,72,158,58,79,41,0,2,0,114,255,236,4,96,4,92,0,17,0,32,0,16,183,30,14,7,114,22,5,11,114,0,43,50,43,50,48,49,65,20,14,2,35,34,46,2,53,52,54,54,51,50,22,22,5,20,22,22,51,50,54,54,53,52,38,38,35,34,6,4,96,70,132,187,118,110,183,133,73,122,227,157,150,225,125,252,190,70,146,115,114,147,70,70,146,116,171,159,2,38,135,212,146,77,77,146,212,135,180,253,133,134,253,179,132,194,106,106,194,132,131,191,104,226,0,2,0,175,254,22,4,115,4,92,0,24,0,40,0,37,64,20,18,6,114,17,14,114,11,12,34,34,7,11,114,21,20,25,25,0,7,114,0,43,50,17,51,51,43,50,17,51,51,43,43,48,49,65,50,18,17,20,6,6,35,34,38,38,39,35,22,22,21,17,35,17,51,23,51,62,2,23,34,6,6,7,21,20,22,22,51,50,54,54,53,52,38,2,178,205,244,112,203,138,87,132,94,31,12,3,9,167,137,22,8,32,92,133,62,114,139,64,2,61,141,119,102,136,67,151,4,92,254,230,254,229,187,254,130,46,78,46,39,110,41,254,62,6,50,162,50,83,49,140,88,175,132,32,139,192,100,110,197,128,194,229,0,2,0,113,254,22,4,52,4,92,0,22,0,36,0,37,64,20,22,14,114,21,6,114,19,18,31,31,15,7,114,4,5,23,23,8,11,114,0,43,50,17,51,51,43,50,17,51,51,43,43,48,49,65,17,52,54,55,35,6,6,35,34,2,17,52,54,54,51,50,22,23,51,55,51,17,1,50,54,54,55,53,52,38,35,34,6,21,20,22,3,142,4,5,11,46,170,134,201,244,112,205,137,131,166,47,8,25,132,254,25,116,140,65,2,144,179,154,150,150,254,22,1,214,39,102,37,76,102,1,28,1,26,185,254,131,103,74,157,249,206,2,96,87,176,131,35,212,219,235,201,201,223,0,0,1,0,175,0,0,3,38,4,92,0,21,0,25,64,13,15,6,114,14,10,114,18,17,7,7,0,7,114,0,43,50,17,51,51,43,43,48,49,65,50,22,23,7,38,38,35,34,14,2,21,17,35,17,51,23,51,62,2,2,161,33,72,28,21,27,66,29,66,117,88,50,167,138,18,7,34,96,127,4,92,7,6,154,7,8,53,99,139,85,253,180,4,72,202,61,101,60,0,1,0,103,255,236,3,116,4,92,0,42,0,26,64,14,14,18,39,22,4,4,32,25,7,114,11,4,11,114,0,43,50,43,50,18,23,57,48,49,65,20,6,6,35,34,38,39,53,22,22,51,50,54,53,52,38,38,39,46,2,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,22,23,30,2,3,116,105,195,135,115,168,63,67,186,97,142,128,51,120,106,105,153,83,225,183,99,173,75,56,68,154,80,115,123,57,126,103,103,150,81,1,44,105,143,72,36,33,153,33,54,92,79,45,69,65,39,40,79,114,91,139,149,39,33,133,29,40,76,66,51,66,58,39,38,81,115,0,0,1,0,32,255,236,2,171,5,70,0,24,0,29,64,14,14,18,13,21,21,16,15,18,6,114,0,7,11,114,0,43,50,43,50,205,51,17,51,18,57,48,49,101,50,54,55,21,6,6,35,34,38,38,53,17,35,53,55,55,51,21,33,21,33,17,20,22,2,17,41,86,27,29,103,49,87,142,85,156,157,66,100,1,65,254,191,95,116,14,10,129,13,18,61,146,129,2,138,81,65,238,254,130,253,123,103,102,0,1,0,163,255,236,4,56,4,72,0,23,0,27,64,14,23,13,6,114,3,4,18,18,8,11,114,1,10,114,0,43,43,50,17,51,51,43,50,48,49,65,17,35,39,35,14,2,35,34,38,38,53,17,51,17,20,22,51,50,54,54,53,17,4,56,136,24,9,34,108,135,76,130,176,89,168,124,127,122,145,64,4,72,251,184,154,57,78,39,84,176,138,2,206,253,62,137,135,92,179,130,2,65,0,1,0,0,0,0,3,255,4,72,0,13,0,21,64,10,7,6,0,12,1,6,114,0,10,114,0,43,43,50,18,57,57,48,49,97,1,51,19,22,22,23,51,54,54,55,19,51,1,1,160,254,96,178,241,25,52,10,7,12,56,23,241,178,254,95,4,72,253,105,68,164,50,50,165,67,2,151,251,184,0,1,0,24,0,2,6,27,4,74,0,42,0,27,64,14,21,34,6,3,14,41,29,15,6,114,42,14,10,114,0,43,50,43,50,50,18,23,57,48,49,101,3,46,3,39,35,14,3,7,3,35,1,51,19,30,2,23,51,62,3,55,19,51,19,30,2,23,51,62,2,55,19,51,1,4,43,195,13,23,19,15,5,7,4,14,19,22,14,204,187,254,210,172,158,16,29,21,5,8,6,15,19,22,11,202,179,195,15,29,24,5,8,4,22,29,16,160,169,254,209,2,2,126,41,79,73,63,23,23,63,74,81,41,253,133,4,72,253,163,60,117,103,38,25,70,79,79,35,2,123,253,134,48,104,97,38,34,100,120,62,2,93,251,184,0,0,1,0,39,0,0,4,9,4,72,0,11,0,28,64,15,9,6,0,3,4,1,8,8,11,10,114,5,1,6,114,0,43,50,43,50,17,18,23,57,48,49,65,1,51,1,1,51,1,1,35,1,1,35,1,180,254,133,190,1,33,1,32,188,254,133,1,144,190,254,205,254,203,188,2,49,2,23,254,90,1,166,253,233,253,207,1,191,254,65,0,1,0,2,254,19,4,2,4,72,0,29,0,26,64,14,6,29,28,13,4,0,24,17,15,114,12,0,6,114,0,43,50,43,50,18,23,57,48,49,83,51,19,30,2,23,51,54,54,55,19,51,1,14,2,35,34,38,39,53,22,22,51,50,54,54,55,55,2,178,242,21,36,28,8,7,14,52,30,229,179,254,35,38,101,144,102,47,72,26,22,63,34,62,91,66,24,60,4,72,253,132,56,103,94,44,50,163,85,2,123,251,23,101,150,81,11,7,133,5,8,47,90,62,154,0,0,1,0,80,0,0,3,111,4,72,0,9,0,25,64,12,7,4,4,5,6,114,2,8,8,1,10,114,0,43,50,17,51,43,50,17,51,48,49,97,33,53,1,33,53,33,21,1,33,3,111,252,225,2,89,253,205,2,236,253,175,2,94,110,3,88,130,123,252,180,0,1,0,57,254,188,2,190,5,182,0,37,0,29,64,13,28,29,10,10,9,9,0,20,19,2,114,37,0,0,47,50,43,50,18,57,47,51,18,57,57,48,49,65,46,2,53,17,52,38,38,35,53,62,2,53,17,52,54,54,51,21,14,2,21,17,20,6,7,21,22,22,21,17,20,22,22,23,2,190,124,179,95,56,110,81,81,110,56,100,179,119,74,105,55,106,110,112,104,54,105,75,254,188,1,71,142,107,1,50,71,87,40,138,1,39,86,71,1,52,107,141,70,136,2,42,86,68,254,211,104,126,20,12,19,126,105,254,205,68,85,40,1,0,0,1,1,236,254,16,2,119,6,21,0,3,0,8,177,0,2,0,47,47,48,49,65,51,17,35,1,236,139,139,6,21,247,251,0,1,0,67,254,188,2,200,5,182,0,37,0,29,64,13,10,9,28,28,29,29,0,18,19,2,114,1,0,0,47,50,43,50,18,57,47,51,18,57,57,48,49,83,53,62,2,53,17,52,54,55,53,38,38,53,17,52,38,38,39,53,30,2,21,17,20,22,22,51,21,34,6,6,21,17,20,6,6,67,74,104,55,107,109,111,105,54,104,75,124,178,95,56,111,81,81,111,56,100,178,254,188,138,2,41,85,68,1,47,105,126,19,12,20,126,104,1,48,69,86,41,1,136,1,70,141,108,254,208,72,87,40,138,40,86,70,254,202,106,142,71,0,1,0,103,2,81,4,41,3,83,0,25,0,29,64,12,20,19,19,3,10,23,128,7,6,6,16,23,0,47,51,51,47,51,26,16,205,50,50,47,51,48,49,65,38,38,35,34,6,7,53,54,54,51,50,22,23,22,22,51,50,54,55,21,6,6,35,34,38,2,42,71,98,47,57,127,51,50,123,73,62,117,88,73,96,45,59,126,50,48,122,74,60,118,2,146,32,25,68,52,149,53,54,27,38,31,26,68,52,147,52,57,26,0,0,2,0,150,254,138,1,132,4,92,0,3,0,15,0,19,183,0,0,7,7,13,7,114,2,0,47,43,50,17,51,125,47,48,49,83,51,19,35,19,20,6,35,34,38,53,52,54,51,50,22,212,111,46,203,222,69,50,50,69,69,50,50,69,2,169,251,225,5,79,70,59,59,70,68,63,63,0,0,1,0,185,255,236,3,221,5,203,0,35,0,20,183,26,24,16,23,34,8,0,1,0,47,205,51,51,47,51,205,51,48,49,65,21,22,22,23,7,38,38,35,34,6,6,21,20,22,22,51,50,54,55,21,6,6,7,21,35,53,46,2,53,52,54,54,55,53,2,208,77,141,51,48,55,133,56,115,152,75,74,147,110,88,136,62,55,119,80,128,125,182,98,100,182,123,5,203,165,3,32,23,139,21,31,96,191,143,142,185,91,34,26,145,27,32,2,199,204,18,125,234,180,183,239,129,18,173,0,0,1,0,68,0,0,4,68,5,201,0,35,0,37,64,18,23,19,19,22,30,11,11,29,14,14,0,22,12,114,7,0,5,114,0,43,50,43,18,57,47,51,51,17,51,17,51,17,51,48,49,65,50,22,23,7,38,38,35,34,6,21,17,33,21,33,21,20,6,6,7,33,21,33,53,62,2,53,53,35,53,51,17,52,54,54,2,174,111,176,70,60,61,149,83,121,126,1,160,254,96,40,65,38,3,24,252,0,61,94,53,199,199,101,184,5,201,47,34,134,29,47,128,142,254,225,127,222,84,111,67,22,152,141,14,68,120,91,224,127,1,49,124,174,93,0,0,2,0,121,1,6,4,23,4,161,0,35,0,51,0,74,64,35,33,30,30,40,21,24,24,40,40,27,22,23,23,32,31,27,15,12,12,48,3,6,6,48,48,9,14,13,13,4,5,9,9,27,12,0,63,51,47,206,50,50,17,51,17,51,17,51,17,51,17,51,17,51,16,206,50,50,17,51,17,51,17,51,17,51,17,51,17,51,48,49,83,52,54,55,39,55,23,54,54,51,50,22,23,55,23,7,22,22,21,20,6,7,23,7,39,6,6,35,34,38,39,7,39,55,38,38,55,20,22,22,51,50,54,54,53,52,38,38,35,34,6,6,183,41,34,137,92,138,49,120,66,64,116,50,139,92,135,33,43,39,37,133,90,139,48,118,64,66,122,47,138,91,136,34,41,128,73,125,76,78,126,74,74,126,77,77,125,73,2,211,63,119,49,141,90,134,35,39,39,35,134,90,140,48,119,65,64,121,49,138,89,134,34,39,39,36,135,89,139,49,119,64,77,125,73,74,125,76,78,126,75,75,126,0,0,1,0,31,0,0,4,112,5,182,0,22,0,44,64,21,0,20,20,17,10,7,7,13,16,3,6,6,17,17,12,1,21,4,114,12,12,0,63,43,50,18,57,47,51,17,51,206,50,50,17,51,17,51,17,51,48,49,65,1,51,1,33,21,33,21,33,21,33,17,35,17,33,53,33,53,33,53,33,1,51,2,72,1,121,175,254,92,1,8,254,197,1,59,254,197,162,254,196,1,60,254,196,1,4,254,96,177,2,229,2,209,252,253,123,174,123,254,241,1,15,123,174,123,3,3,0,2,1,236,254,16,2,119,6,21,0,3,0,7,0,12,179,4,6,3,0,0,47,50,47,51,48,49,65,51,17,35,17,51,17,35,1,236,139,139,139,139,6,21,252,247,254,14,252,246,0,2,0,122,255,247,3,143,6,30,0,54,0,69,0,26,64,15,47,33,51,30,60,67,3,23,8,44,36,16,9,1,114,0,43,50,47,51,23,57,48,49,83,52,54,55,38,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,22,23,30,2,21,20,6,7,22,22,21,20,6,35,34,38,39,53,30,2,51,50,54,53,52,38,38,39,46,2,55,20,22,22,23,23,54,54,53,52,38,38,39,6,6,140,102,67,76,86,207,192,113,158,75,51,69,141,96,125,108,52,121,101,104,150,81,95,62,73,81,231,209,113,169,64,45,116,128,64,155,119,44,117,109,105,152,82,143,58,129,106,54,52,85,59,142,125,62,96,3,41,101,126,31,39,111,85,122,142,39,30,128,28,39,68,62,41,62,58,37,37,87,116,84,104,134,35,37,109,80,139,155,36,31,144,21,39,24,92,62,42,62,61,40,39,84,119,108,53,80,69,40,19,29,95,70,54,84,74,38,16,96,0,0,2,1,54,5,16,3,107,5,210,0,11,0,23,0,14,180,15,21,21,3,9,0,47,51,51,17,51,48,49,65,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,1,54,52,38,39,53,53,39,38,52,1,128,52,37,38,54,54,38,37,52,5,114,50,46,46,50,49,49,49,49,50,46,46,50,49,49,49,0,0,3,0,100,255,236,6,68,5,203,0,19,0,46,0,66,0,27,64,13,34,27,57,10,3,114,40,20,128,47,0,9,114,0,43,50,26,204,50,43,50,204,50,48,49,69,34,36,38,2,53,52,18,54,36,51,50,4,22,18,21,20,2,6,4,3,34,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,50,54,55,21,6,6,7,50,62,2,53,52,46,2,35,34,14,2,21,20,30,2,3,84,163,254,237,203,111,112,203,1,19,162,157,1,17,206,116,112,203,254,237,130,202,204,97,185,132,66,130,57,56,50,98,47,127,140,127,137,50,115,52,49,104,103,133,233,176,100,95,172,235,140,140,235,173,95,94,173,235,20,112,202,1,19,162,163,1,19,202,112,113,203,254,238,162,162,254,237,202,112,1,38,249,208,133,205,117,32,29,116,26,27,177,154,160,172,26,21,122,22,28,192,96,175,237,141,134,234,180,101,96,175,237,141,134,235,179,101,0,2,0,68,3,19,2,110,5,199,0,28,0,39,0,31,64,14,6,36,36,18,29,0,5,5,9,192,22,0,3,114,0,43,50,26,204,50,47,17,57,57,50,17,51,48,49,65,50,22,21,17,35,39,6,6,35,34,38,38,53,52,54,54,55,55,53,52,38,35,34,6,7,39,54,54,19,7,6,6,21,20,22,51,50,54,53,1,104,130,132,91,23,39,114,77,64,95,51,70,144,109,112,85,62,55,103,46,43,52,130,212,98,124,90,62,53,104,93,5,199,110,119,254,62,87,43,57,44,90,67,68,92,50,4,4,47,69,56,29,24,95,26,33,254,151,4,4,64,58,53,49,99,83,0,2,0,79,0,122,3,171,3,197,0,6,0,13,0,36,64,18,11,12,12,5,9,8,8,6,13,3,10,0,7,6,2,1,4,5,0,47,51,204,50,23,57,50,17,51,17,51,17,51,48,49,83,1,23,1,1,7,1,37,1,23,1,1,7,1,79,1,84,119,254,225,1,31,119,254,172,1,142,1,89,117,254,226,1,30,117,254,167,2,44,1,153,68,254,159,254,159,69,1,151,27,1,153,68,254,159,254,159,69,1,151,0,1,0,103,1,7,4,36,3,22,0,5,0,14,180,1,1,4,4,5,0,47,51,17,51,47,48,49,65,17,35,17,33,53,4,36,134,252,201,3,22,253,241,1,135,136,255,255,0,82,1,220,2,66,2,112,6,6,0,16,0,0,0,4,0,100,255,236,6,68,5,203,0,13,0,22,0,42,0,62,0,35,64,18,12,8,14,3,0,22,1,53,33,3,114,10,0,128,43,23,9,114,0,43,50,26,204,50,43,50,204,50,17,23,57,48,49,65,17,33,50,22,21,20,6,7,19,35,3,35,17,17,51,50,54,53,52,38,35,35,19,34,36,38,2,53,52,18,54,36,51,50,4,22,18,21,20,2,6,4,39,50,62,2,53,52,46,2,35,34,14,2,21,20,30,2,2,63,1,5,163,156,99,64,237,164,207,138,111,83,95,88,92,109,132,163,254,237,203,111,112,203,1,19,162,157,1,17,206,116,112,203,254,237,162,133,233,176,100,95,172,235,140,140,235,173,95,94,173,235,1,28,3,125,131,132,97,113,25,254,117,1,100,254,156,1,218,82,70,77,68,251,205,112,202,1,19,162,163,1,19,202,112,113,203,254,238,162,162,254,237,202,112,102,96,175,237,141,134,234,180,101,96,175,237,141,134,235,179,101,0,1,255,250,6,20,4,6,6,147,0,3,0,8,177,2,1,0,47,51,48,49,65,33,53,33,4,6,251,244,4,12,6,20,127,0,0,2,0,117,3,91,2,248,5,203,0,15,0,27,0,16,182,16,0,192,22,8,3,114,0,43,50,26,204,50,48,49,65,34,38,38,53,52,54,54,51,50,22,22,21,20,6,6,39,50,54,53,52,38,35,34,6,21,20,22,1,182,96,144,81,79,144,98,95,145,82,82,145,93,98,98,101,95,101,98,97,3,91,78,141,92,93,141,79,79,141,93,92,141,78,114,109,88,92,109,109,92,88,109,0,2,0,103,0,0,4,42,4,197,0,3,0,15,0,27,64,11,14,4,13,13,9,7,10,10,1,1,0,0,47,50,17,51,47,51,51,51,17,51,51,48,49,115,53,33,21,1,33,21,33,17,35,17,33,53,33,17,51,103,3,195,254,98,1,156,254,100,137,254,100,1,156,137,135,135,3,27,136,254,88,1,168,136,1,170,0,1,0,50,3,84,2,115,6,211,0,26,0,18,183,2,25,25,0,120,10,17,119,0,63,51,228,50,17,51,48,49,65,33,53,55,62,2,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,6,7,7,33,2,115,253,191,237,82,88,33,78,66,61,103,53,67,60,140,86,130,148,55,107,77,170,1,154,3,84,104,232,80,102,82,47,66,71,47,41,89,50,60,129,112,68,114,116,73,164,0,0,1,0,37,3,69,2,141,6,211,0,41,0,27,64,12,6,7,29,29,26,26,20,13,120,35,0,119,0,63,50,228,50,57,47,51,18,57,57,48,49,65,50,22,21,20,6,7,21,22,22,21,20,6,35,34,38,39,53,22,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,1,83,143,146,89,62,81,95,171,178,75,131,61,68,138,62,108,103,119,108,119,119,104,97,85,64,64,111,55,68,62,140,6,211,126,98,84,106,19,6,16,105,83,119,148,26,30,121,32,36,87,75,76,69,106,82,67,65,64,43,35,89,45,54,0,0,1,0,82,4,217,1,231,6,33,0,12,0,18,183,1,8,12,128,15,6,1,6,0,47,93,26,205,57,57,48,49,65,21,14,3,7,35,53,62,2,55,1,231,20,69,84,85,36,111,32,76,72,24,6,33,20,29,81,89,80,29,24,38,107,113,46,0,0,1,0,175,254,20,4,67,4,72,0,29,0,33,64,17,17,12,11,4,3,24,24,8,11,114,1,10,114,20,0,6,114,0,43,50,43,43,50,17,51,51,51,51,47,48,49,65,17,35,39,35,14,2,35,34,38,39,35,30,2,21,17,35,17,51,17,20,22,51,50,54,54,53,17,4,67,135,26,9,34,94,125,81,86,121,40,8,3,4,2,166,166,128,129,124,142,61,4,72,251,184,152,54,77,41,54,46,24,71,89,53,254,177,6,52,253,60,133,137,93,179,129,2,65,0,0,1,0,122,254,252,4,93,6,20,0,18,0,18,182,6,9,9,3,17,5,0,0,47,50,47,51,57,47,51,48,49,65,35,17,35,17,35,17,6,6,35,34,38,38,53,52,54,54,51,33,4,93,111,216,112,31,78,37,125,184,101,110,198,133,2,42,254,252,6,173,249,83,3,69,9,9,97,217,180,189,220,94,0,255,255,0,150,2,70,1,132,3,75,6,7,0,17,0,0,2,98,0,1,0,28,254,20,1,171,0,0,0,22,0,16,181,19,16,10,3,192,18,0,47,26,204,50,57,57,48,49,65,20,6,35,34,38,39,53,22,22,51,50,54,53,52,38,39,55,51,7,30,2,1,171,150,145,31,56,17,19,60,30,75,80,107,83,89,111,54,50,81,48,254,226,97,109,7,4,105,4,6,44,52,55,50,9,176,112,10,42,70,0,0,1,0,76,3,84,1,225,6,193,0,13,0,18,64,9,11,10,12,7,4,2,120,13,119,0,63,228,23,57,48,49,65,17,35,17,52,54,54,55,6,6,7,7,39,37,1,225,135,2,3,2,21,52,29,109,66,1,11,6,193,252,147,2,54,36,63,61,29,19,42,19,77,94,185,0,0,2,0,67,3,19,2,189,5,200,0,12,0,24,0,16,182,16,3,3,22,9,3,114,0,43,50,50,47,51,48,49,65,20,6,35,34,38,53,52,54,51,50,22,22,5,20,22,51,50,54,53,52,38,35,34,6,2,189,173,147,139,175,170,148,97,141,78,253,255,92,102,102,93,92,102,101,94,4,111,164,184,179,169,166,179,81,154,110,121,125,125,121,120,122,120,0,2,0,77,0,122,3,169,3,197,0,6,0,13,0,26,64,15,2,9,10,13,7,0,6,4,3,11,10,5,12,1,8,0,47,51,204,50,23,57,48,49,65,1,39,1,1,55,1,5,1,39,1,1,55,1,3,169,254,167,116,1,30,254,226,116,1,89,254,111,254,170,117,1,30,254,226,117,1,86,2,18,254,104,69,1,98,1,96,68,254,104,27,254,104,69,1,98,1,96,68,254,104,0,0,4,0,66,0,0,5,217,5,182,0,3,0,17,0,28,0,37,0,54,64,28,21,30,30,24,24,19,34,27,27,22,18,3,3,18,12,114,13,12,14,9,4,4,15,1,1,15,4,114,0,43,50,47,16,204,23,57,43,50,47,16,204,57,47,57,51,51,17,51,17,51,48,49,97,1,51,1,3,17,52,54,54,55,6,6,7,7,39,37,51,17,1,53,33,53,1,51,17,51,21,35,21,1,33,53,52,54,55,6,6,7,1,7,3,110,144,252,145,70,2,3,2,21,52,29,109,66,1,11,137,2,245,254,110,1,149,139,128,128,254,103,1,11,2,3,11,61,23,5,182,250,74,2,74,2,54,36,63,61,29,19,42,20,76,94,184,252,148,253,182,205,98,2,68,253,204,114,205,1,63,207,44,110,49,25,94,34,0,3,0,44,0,0,5,208,5,182,0,3,0,18,0,45,0,38,64,20,20,43,43,28,35,19,12,114,14,13,15,10,4,4,16,1,1,16,4,114,0,43,50,47,16,204,23,57,43,204,50,51,17,51,48,49,115,1,51,1,3,17,52,62,2,55,6,6,7,7,39,37,51,17,1,53,55,62,2,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,6,7,7,33,21,208,3,111,143,252,145,38,1,3,3,1,22,51,29,109,66,1,11,138,1,206,237,82,88,34,80,65,62,102,53,66,59,141,85,130,148,56,106,77,170,1,154,5,182,250,74,2,74,2,54,27,49,46,45,22,19,42,20,76,94,184,252,148,253,182,104,232,80,102,82,47,66,71,47,41,89,50,60,129,112,68,114,116,73,164,119,0,4,0,33,0,0,6,40,5,201,0,3,0,45,0,56,0,65,0,63,64,31,49,58,58,52,52,47,62,55,55,50,46,3,3,46,12,114,39,40,20,20,17,17,11,4,33,26,1,1,33,5,114,0,43,50,47,50,16,204,50,57,47,51,18,57,57,43,50,47,16,204,57,47,57,51,51,17,51,17,51,48,49,97,1,51,1,3,34,38,39,53,22,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,7,21,22,22,21,20,6,1,53,33,53,1,51,17,51,21,35,21,1,33,53,52,54,55,6,6,7,1,100,3,111,143,252,146,200,74,132,61,68,139,62,108,103,120,108,119,119,104,97,85,64,64,110,56,68,62,141,94,142,146,88,62,80,96,172,3,60,254,110,1,149,139,128,128,254,104,1,10,3,3,13,60,23,5,182,250,74,2,58,27,30,121,33,35,86,76,76,69,106,82,67,65,64,43,35,88,46,54,127,98,83,106,19,7,16,104,83,119,149,253,198,205,98,2,68,253,204,114,205,1,63,207,44,110,49,25,94,34,0,2,0,53,254,119,3,82,4,94,0,31,0,43,0,22,64,9,0,0,35,35,41,7,114,12,19,0,47,51,43,50,17,51,125,47,48,49,65,21,20,6,6,7,14,2,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,54,54,55,62,2,53,53,19,20,6,35,34,38,53,52,54,51,50,22,2,81,30,75,67,78,92,39,135,121,99,154,71,58,82,191,119,193,212,60,111,74,67,69,26,177,65,53,49,69,69,49,53,65,2,172,52,79,116,100,56,65,91,92,65,104,111,51,34,134,43,54,191,167,93,131,109,61,56,85,89,62,33,1,46,70,59,59,70,69,63,63,255,255,0,0,0,0,5,13,7,144,6,38,0,36,0,0,1,7,0,67,1,41,1,111,0,10,179,25,5,2,114,0,43,206,48,49,255,255,0,0,0,0,5,13,7,144,6,38,0,36,0,0,1,7,0,118,1,192,1,111,0,10,179,25,5,2,114,0,43,206,48,49,255,255,0,0,0,0,5,13,7,143,6,38,0,36,0,0,1,7,1,74,0,231,1,111,0,10,179,31,5,2,114,0,43,206,48,49,255,255,0,0,0,0,5,13,7,76,6,38,0,36,0,0,1,7,1,81,0,187,1,111,0,10,179,36,5,2,114,0,43,206,48,49,255,255,0,0,0,0,5,13,7,65,6,38,0,36,0,0,1,7,0,106,0,52,1,111,0,12,180,40,28,5,2,114,0,43,206,206,48,49,255,255,0,0,0,0,5,13,7,10,6,38,0,36,0,0,0,7,1,79,1,84,0,130,0,2,255,254,0,0,6,129,5,182,0,15,0,19,0,43,64,21,19,9,9,16,3,10,13,3,13,3,13,5,6,2,114,14,1,1,5,8,114,0,43,50,17,51,43,17,57,57,47,47,17,51,17,51,50,17,51,48,49,97,33,17,33,3,35,1,33,21,33,17,33,21,33,17,33,1,33,17,35,6,129,253,4,254,7,222,176,2,175,3,212,253,174,2,43,253,213,2,82,251,77,1,183,115,1,208,254,48,5,182,150,254,39,148,253,227,1,209,2,183,255,255,0,125,254,20,4,203,5,203,6,38,0,38,0,0,0,7,0,122,2,22,0,0,255,255,0,200,0,0,3,246,7,144,6,38,0,40,0,0,1,7,0,67,1,21,1,111,0,10,179,18,2,2,114,0,43,206,48,49,255,255,0,200,0,0,3,246,7,144,6,38,0,40,0,0,1,7,0,118,1,173,1,111,0,10,179,18,2,2,114,0,43,206,48,49,255,255,0,200,0,0,3,246,7,143,6,38,0,40,0,0,1,7,1,74,0,211,1,111,0,10,179,18,2,2,114,0,43,206,48,49,255,255,0,200,0,0,3,246,7,65,6,38,0,40,0,0,1,7,0,106,0,33,1,111,0,12,180,33,21,2,2,114,0,43,206,206,48,49,255,255,255,244,0,0,1,137,7,144,6,38,0,44,0,0,1,7,0,67,255,162,1,111,0,10,179,10,1,2,114,0,43,206,48,49,255,255,0,180,0,0,2,73,7,144,6,38,0,44,0,0,1,7,0,118,0,98,1,111,0,10,179,10,1,2,114,0,43,206,48,49,255,255,255,206,0,0,2,111,7,143,6,38,0,44,0,0,1,7,1,74,255,124,1,111,0,10,179,10,1,2,114,0,43,206,48,49,255,255,0,6,0,0,2,59,7,65,6,38,0,44,0,0,1,7,0,106,254,208,1,111,0,12,180,13,25,1,2,114,0,43,206,206,48,49,0,2,0,58,0,0,5,81,5,182,0,14,0,28,0,31,64,15,12,17,17,11,20,20,9,16,14,2,114,21,9,8,114,0,43,50,43,50,17,57,47,51,51,17,51,48,49,65,50,4,18,21,20,2,4,35,33,17,35,53,51,17,5,35,17,33,21,33,17,51,32,0,17,52,2,38,2,129,222,1,67,175,180,254,170,244,254,130,155,155,1,146,233,1,116,254,140,195,1,47,1,46,132,253,5,182,163,254,193,235,247,254,181,167,2,137,149,2,152,145,253,249,149,254,9,1,42,1,39,197,1,0,125,0,255,255,0,200,0,0,5,63,7,76,6,38,0,49,0,0,1,7,1,81,1,60,1,111,0,10,179,20,10,2,114,0,43,206,48,49,255,255,0,125,255,236,5,188,7,144,6,38,0,50,0,0,1,7,0,67,1,194,1,111,0,10,179,39,14,3,114,0,43,206,48,49,255,255,0,125,255,236,5,188,7,144,6,38,0,50,0,0,1,7,0,118,2,88,1,111,0,10,179,40,14,3,114,0,43,206,48,49,255,255,0,125,255,236,5,188,7,143,6,38,0,50,0,0,1,7,1,74,1,127,1,111,0,10,179,45,14,3,114,0,43,206,48,49,255,255,0,125,255,236,5,188,7,76,6,38,0,50,0,0,1,7,1,81,1,82,1,111,0,10,179,50,14,3,114,0,43,206,48,49,255,255,0,125,255,236,5,188,7,65,6,38,0,50,0,0,1,7,0,106,0,204,1,111,0,12,180,54,42,14,3,114,0,43,206,206,48,49,0,1,0,133,1,16,4,10,4,150,0,11,0,36,64,19,7,9,1,3,8,11,2,5,8,10,6,0,0,10,10,6,4,4,6,0,47,51,47,17,51,47,51,47,17,18,23,57,48,49,65,23,1,1,7,1,1,39,1,1,55,1,3,172,94,254,158,1,97,95,254,156,254,163,99,1,97,254,158,99,1,96,4,150,97,254,158,254,158,97,1,96,254,160,97,1,98,1,96,99,254,156,0,3,0,125,255,194,5,188,5,247,0,26,0,37,0,48,0,57,64,28,42,30,30,24,24,21,21,45,45,23,22,18,3,114,31,41,41,11,11,8,8,34,34,10,9,5,9,114,0,43,206,50,51,17,51,17,51,17,51,17,51,43,206,50,51,17,51,17,51,17,51,17,51,48,49,65,20,2,6,6,35,34,38,39,7,39,55,38,2,53,52,18,36,51,50,22,23,55,23,7,22,18,7,52,38,39,1,22,22,51,50,54,18,37,20,22,23,1,38,38,35,34,6,2,5,188,86,169,250,165,118,192,74,102,116,110,91,90,148,1,45,227,107,186,75,98,115,106,93,99,179,56,55,253,95,56,146,91,170,217,104,252,39,52,52,2,158,54,138,85,170,220,107,2,221,169,254,235,199,108,51,51,144,76,156,100,1,31,178,224,1,82,188,51,46,139,79,148,98,254,225,182,134,217,76,252,76,40,45,148,1,16,186,130,211,77,3,174,38,40,146,254,243,0,255,255,0,185,255,236,5,26,7,144,6,38,0,56,0,0,1,7,0,67,1,143,1,111,0,10,179,26,9,2,114,0,43,206,48,49,255,255,0,185,255,236,5,26,7,144,6,38,0,56,0,0,1,7,0,118,2,38,1,111,0,10,179,27,9,2,114,0,43,206,48,49,255,255,0,185,255,236,5,26,7,143,6,38,0,56,0,0,1,7,1,74,1,77,1,111,0,10,179,33,9,2,114,0,43,206,48,49,255,255,0,185,255,236,5,26,7,65,6,38,0,56,0,0,1,7,0,106,0,155,1,111,0,12,180,41,29,9,2,114,0,43,206,206,48,49,255,255,0,0,0,0,4,121,7,144,6,38,0,60,0,0,1,7,0,118,1,120,1,111,0,10,179,16,7,2,114,0,43,206,48,49,0,2,0,200,0,0,4,103,5,182,0,14,0,24,0,31,64,15,15,6,24,11,6,11,6,11,8,9,2,114,8,8,114,0,43,43,17,57,57,47,47,17,51,17,51,48,49,65,20,14,2,35,35,17,35,17,51,17,51,32,4,1,51,50,54,54,53,52,38,35,35,4,103,60,135,223,163,176,170,170,209,1,34,1,2,253,11,158,144,187,92,183,203,195,3,14,94,167,127,73,254,191,5,182,255,0,221,253,249,61,135,111,147,141,0,1,0,175,255,236,4,157,6,31,0,60,0,21,64,11,46,57,1,114,52,10,114,26,18,11,114,0,43,50,43,43,50,48,49,65,20,14,3,21,20,22,22,23,30,2,21,20,6,6,35,34,38,39,53,30,2,51,50,54,53,52,38,38,39,46,2,53,52,62,3,53,52,38,35,34,6,6,21,17,35,17,52,54,54,51,50,22,22,4,26,58,85,85,58,29,79,74,72,106,57,94,169,113,97,144,54,37,93,106,54,116,103,37,85,71,83,98,42,56,84,83,56,145,115,77,128,76,166,116,202,129,129,192,107,4,244,71,102,78,66,65,40,31,48,61,49,48,98,119,83,112,146,71,35,32,151,21,38,24,99,84,53,78,75,46,54,88,89,56,65,89,68,64,79,56,88,82,43,103,91,251,89,4,167,137,165,74,67,133,255,255,0,94,255,236,3,203,6,33,6,38,0,68,0,0,1,7,0,67,0,220,0,0,0,10,179,47,0,7,114,0,43,206,48,49,255,255,0,94,255,236,3,203,6,33,6,38,0,68,0,0,1,7,0,118,1,116,0,0,0,10,179,47,0,7,114,0,43,206,48,49,255,255,0,94,255,236,3,203,6,32,6,38,0,68,0,0,1,7,1,74,0,154,0,0,0,10,179,53,0,7,114,0,43,206,48,49,255,255,0,94,255,236,3,203,5,221,6,38,0,68,0,0,1,6,1,81,109,0,0,10,179,58,0,7,114,0,43,206,48,49,255,255,0,94,255,236,3,203,5,210,6,38,0,68,0,0,1,6,0,106,232,0,0,12,180,62,50,0,7,114,0,43,206,206,48,49,255,255,0,94,255,236,3,203,6,136,6,38,0,68,0,0,1,7,1,79,1,10,0,0,0,13,183,3,2,41,0,1,1,128,86,0,43,52,52,0,0,3,0,94,255,236,6,125,4,92,0,49,0,61,0,69,0,51,64,26,9,16,16,24,65,6,37,44,7,114,33,50,6,50,6,0,57,24,11,114,47,62,62,0,7,114,0,43,50,17,51,43,50,18,57,57,47,47,51,43,50,17,51,17,51,17,51,48,49,65,50,22,22,7,21,33,22,22,51,50,54,55,21,6,6,35,34,38,38,39,14,2,35,34,38,38,53,52,54,54,55,55,53,52,38,35,34,6,7,39,54,54,51,50,22,23,54,54,1,7,6,6,21,20,22,51,50,54,54,53,1,34,6,7,33,54,38,38,4,211,133,191,102,1,253,59,4,166,156,100,154,81,82,157,101,96,159,121,40,45,111,152,107,100,157,90,111,223,167,186,126,108,81,157,70,52,74,199,100,129,165,39,53,174,254,169,157,193,160,109,91,90,140,80,1,200,121,146,11,2,17,1,54,112,4,92,124,222,146,105,202,195,38,37,146,37,34,55,107,78,73,108,59,70,142,109,109,151,83,5,8,71,139,113,49,35,126,39,53,90,101,91,102,253,192,7,8,118,108,94,90,72,144,108,2,29,169,161,99,149,82,0,255,255,0,114,254,20,3,146,4,92,6,38,0,70,0,0,0,7,0,122,1,94,0,0,255,255,0,114,255,236,4,19,6,33,6,38,0,72,0,0,1,7,0,67,0,234,0,0,0,10,179,38,0,7,114,0,43,206,48,49,255,255,0,114,255,236,4,19,6,33,6,38,0,72,0,0,1,7,0,118,1,129,0,0,0,10,179,38,0,7,114,0,43,206,48,49,255,255,0,114,255,236,4,19,6,32,6,38,0,72,0,0,1,7,1,74,0,168,0,0,0,10,179,44,0,7,114,0,43,206,48,49,255,255,0,114,255,236,4,19,5,210,6,38,0,72,0,0,1,6,0,106,246,0,0,12,180,53,41,0,7,114,0,43,206,206,48,49,255,255,255,248,0,0,1,141,6,33,6,38,3,175,0,0,1,6,0,67,166,0,0,10,179,10,2,6,114,0,43,206,48,49,255,255,0,143,0,0,2,36,6,33,6,38,3,175,0,0,1,6,0,118,61,0,0,10,179,10,2,6,114,0,43,206,48,49,255,255,255,181,0,0,2,86,6,32,6,38,3,175,0,0,1,7,1,74,255,99,0,0,0,10,179,16,2,6,114,0,43,206,48,49,255,255,255,231,0,0,2,28,5,210,6,38,3,175,0,0,1,7,0,106,254,177,0,0,0,12,180,25,13,2,6,114,0,43,206,206,48,49,0,2,0,113,255,236,4,91,6,29,0,36,0,52,0,33,64,19,37,4,5,36,3,33,6,30,32,31,9,22,22,0,45,14,11,114,0,0,47,43,50,18,57,47,23,57,51,48,49,65,22,22,23,55,23,7,22,22,18,21,20,2,6,35,34,38,38,53,52,54,54,51,50,22,22,23,55,38,38,39,5,39,55,38,38,39,19,34,6,6,21,20,22,22,51,50,54,53,52,46,2,1,183,68,130,58,235,72,204,95,143,79,120,226,159,146,225,126,118,215,145,75,122,95,32,9,32,137,89,254,245,71,231,43,96,49,245,115,148,71,71,147,114,171,162,39,80,125,6,29,31,74,43,137,102,119,89,233,254,228,165,190,254,252,132,120,223,152,153,220,119,27,54,41,3,121,206,81,154,104,133,30,57,25,253,149,84,162,117,104,160,89,208,198,62,111,87,50,255,255,0,175,0,0,4,65,5,221,6,38,0,81,0,0,1,7,1,81,0,172,0,0,0,10,179,39,0,7,114,0,43,206,48,49,255,255,0,114,255,236,4,96,6,33,6,38,0,82,0,0,1,7,0,67,1,12,0,0,0,10,179,39,14,7,114,0,43,206,48,49,255,255,0,114,255,236,4,96,6,33,6,38,0,82,0,0,1,7,0,118,1,164,0,0,0,10,179,39,14,7,114,0,43,206,48,49,255,255,0,114,255,236,4,96,6,32,6,38,0,82,0,0,1,7,1,74,0,202,0,0,0,10,179,45,14,7,114,0,43,206,48,49,255,255,0,114,255,236,4,96,5,221,6,38,0,82,0,0,1,7,1,81,0,158,0,0,0,10,179,50,14,7,114,0,43,206,48,49,255,255,0,114,255,236,4,96,5,210,6,38,0,82,0,0,1,6,0,106,24,0,0,12,180,42,54,14,7,114,0,43,206,206,48,49,0,3,0,103,0,253,4,42,4,165,0,3,0,15,0,27,0,20,183,4,10,0,22,16,1,1,0,0,47,50,16,206,50,16,206,50,48,49,83,53,33,21,1,34,38,53,52,54,51,50,22,21,20,6,3,34,38,53,52,54,51,50,22,21,20,6,103,3,195,254,30,46,62,62,46,44,62,62,44,46,62,62,46,44,62,62,2,142,136,136,254,111,57,61,65,52,52,65,61,57,2,190,57,61,64,52,52,64,61,57,0,3,0,114,255,189,4,96,4,133,0,24,0,34,0,45,0,53,64,26,29,38,38,22,22,32,32,21,20,16,7,114,39,28,28,10,10,7,7,42,42,9,8,4,11,114,0,43,206,50,51,17,51,17,51,17,51,17,51,43,206,50,51,17,51,17,51,17,51,48,49,65,20,6,6,35,34,38,39,7,39,55,38,38,53,16,0,51,50,22,23,55,23,7,22,22,5,20,22,23,1,38,38,35,34,6,5,52,38,39,1,22,22,51,50,54,54,4,96,123,227,157,79,135,57,88,109,97,61,67,1,15,235,78,138,56,85,112,97,60,68,252,190,25,28,1,212,37,96,58,171,159,2,150,26,26,254,44,35,97,57,114,147,70,2,38,180,255,135,37,37,121,75,132,75,205,130,1,14,1,40,40,38,119,73,132,73,202,127,82,137,52,2,128,27,30,226,200,79,134,51,253,127,27,28,106,194,0,255,255,0,163,255,236,4,56,6,33,6,38,0,88,0,0,1,7,0,67,1,24,0,0,0,10,179,30,13,6,114,0,43,206,48,49,255,255,0,163,255,236,4,56,6,33,6,38,0,88,0,0,1,7,0,118,1,175,0,0,0,10,179,31,13,6,114,0,43,206,48,49,255,255,0,163,255,236,4,56,6,32,6,38,0,88,0,0,1,7,1,74,0,213,0,0,0,10,179,30,13,6,114,0,43,206,48,49,255,255,0,163,255,236,4,56,5,210,6,38,0,88,0,0,1,6,0,106,35,0,0,12,180,45,33,13,6,114,0,43,206,206,48,49,255,255,0,2,254,19,4,2,6,33,6,38,0,92,0,0,1,7,0,118,1,59,0,0,0,10,179,37,0,6,114,0,43,206,48,49,0,2,0,175,254,22,4,115,6,20,0,28,0,42,0,33,64,18,22,32,32,26,7,114,16,0,114,15,14,114,9,39,39,4,11,114,0,43,50,17,51,43,43,43,50,17,51,48,49,65,20,6,6,35,34,38,38,39,35,30,2,21,17,35,17,51,17,20,6,7,51,62,2,51,50,18,3,52,38,35,34,6,7,21,20,22,51,50,54,54,4,115,112,202,137,88,132,94,32,12,2,6,4,167,167,4,2,7,32,93,132,90,205,244,171,149,156,172,147,2,142,179,103,135,67,2,39,187,254,130,46,77,47,18,69,72,24,254,55,7,254,254,51,31,98,29,49,81,49,254,226,254,235,212,211,197,194,36,208,223,101,194,255,255,0,2,254,19,4,2,5,210,6,38,0,92,0,0,1,6,0,106,175,0,0,12,180,51,39,0,6,114,0,43,206,206,48,49,255,255,0,0,0,0,5,13,6,208,6,38,0,36,0,0,1,7,1,76,1,7,1,111,0,10,179,21,5,2,114,0,43,206,48,49,255,255,0,94,255,236,3,203,5,97,6,38,0,68,0,0,1,7,1,76,0,186,0,0,0,10,179,43,0,7,114,0,43,206,48,49,255,255,0,0,0,0,5,13,7,86,6,38,0,36,0,0,1,7,1,77,1,4,1,111,0,10,179,23,5,2,114,0,43,206,48,49,255,255,0,94,255,236,3,203,5,231,6,38,0,68,0,0,1,7,1,77,0,183,0,0,0,10,179,45,0,7,114,0,43,206,48,49,255,255,0,0,254,62,5,13,5,188,6,38,0,36,0,0,0,7,1,80,3,112,0,0,255,255,0,94,254,62,3,254,4,90,6,38,0,68,0,0,0,7,1,80,2,97,0,0,255,255,0,125,255,236,4,203,7,144,6,38,0,38,0,0,1,7,0,118,2,67,1,111,0,10,179,38,25,3,114,0,43,206,48,49,255,255,0,114,255,236,3,146,6,33,6,38,0,70,0,0,1,7,0,118,1,129,0,0,0,10,179,36,8,7,114,0,43,206,48,49,255,255,0,125,255,236,4,203,7,143,6,38,0,38,0,0,1,7,1,74,1,105,1,111,0,10,179,44,25,3,114,0,43,206,48,49,255,255,0,114,255,236,3,154,6,32,6,38,0,70,0,0,1,7,1,74,0,167,0,0,0,10,179,42,8,7,114,0,43,206,48,49,255,255,0,125,255,236,4,203,7,81,6,38,0,38,0,0,1,7,1,78,2,86,1,111,0,10,179,38,25,3,114,0,43,206,48,49,255,255,0,114,255,236,3,146,5,226,6,38,0,70,0,0,1,7,1,78,1,146,0,0,0,10,179,36,8,7,114,0,43,206,48,49,255,255,0,125,255,236,4,203,7,143,6,38,0,38,0,0,1,7,1,75,1,102,1,111,0,10,179,32,25,3,114,0,43,206,48,49,255,255,0,114,255,236,3,150,6,32,6,38,0,70,0,0,1,7,1,75,0,163,0,0,0,10,179,30,8,7,114,0,43,206,48,49,255,255,0,200,0,0,5,81,7,143,6,38,0,39,0,0,1,7,1,75,1,62,1,111,0,10,179,21,6,2,114,0,43,206,48,49,255,255,0,114,255,236,5,112,6,20,6,38,0,71,0,0,1,7,2,52,2,251,0,0,0,11,182,2,49,15,0,0,0,86,0,43,52,0,255,255,0,58,0,0,5,81,5,182,6,6,0,146,0,0,0,2,0,114,255,236,4,208,6,20,0,31,0,44,0,42,64,21,21,18,18,24,15,15,6,26,10,19,0,114,39,10,6,7,27,32,32,0,11,0,63,50,17,51,63,51,51,43,63,17,57,47,51,51,17,51,48,49,69,34,2,17,16,18,51,50,22,22,23,51,38,38,53,53,33,53,33,53,51,21,51,21,35,17,35,39,35,14,2,39,50,54,53,53,52,38,35,34,6,21,20,22,2,53,208,243,248,205,87,130,95,32,12,5,7,254,69,1,187,166,155,155,136,24,8,31,94,131,61,176,144,138,183,153,151,150,20,1,27,1,21,1,31,1,28,46,78,48,31,108,36,131,125,186,186,125,251,35,156,49,80,47,138,197,196,32,210,220,230,204,202,219,255,255,0,200,0,0,3,246,6,208,6,38,0,40,0,0,1,7,1,76,0,244,1,111,0,10,179,14,2,2,114,0,43,206,48,49,255,255,0,114,255,236,4,19,5,97,6,38,0,72,0,0,1,7,1,76,0,201,0,0,0,10,179,34,0,7,114,0,43,206,48,49,255,255,0,200,0,0,3,246,7,86,6,38,0,40,0,0,1,7,1,77,0,240,1,111,0,10,179,16,2,2,114,0,43,206,48,49,255,255,0,114,255,236,4,19,5,231,6,38,0,72,0,0,1,7,1,77,0,198,0,0,0,10,179,36,0,7,114,0,43,206,48,49,255,255,0,200,0,0,3,246,7,81,6,38,0,40,0,0,1,7,1,78,1,190,1,111,0,10,179,18,2,2,114,0,43,206,48,49,255,255,0,114,255,236,4,19,5,226,6,38,0,72,0,0,1,7,1,78,1,147,0,0,0,10,179,38,0,7,114,0,43,206,48,49,255,255,0,200,254,62,3,246,5,182,6,38,0,40,0,0,0,7,1,80,2,79,0,0,0,3,0,114,254,62,4,19,4,92,0,21,0,45,0,53,0,41,64,20,35,18,17,17,31,31,38,49,28,28,22,3,10,38,11,114,46,22,7,114,0,43,50,43,204,50,18,57,47,51,17,51,17,51,17,51,51,48,49,69,20,22,51,50,54,55,21,6,6,35,34,38,53,52,54,54,55,55,14,2,3,50,22,22,21,21,33,22,22,51,50,54,55,21,6,6,35,34,38,38,53,52,18,54,23,34,6,7,33,46,2,3,20,50,45,33,49,16,28,57,39,105,101,58,88,44,151,80,89,35,191,140,200,106,253,11,3,186,169,104,160,86,83,163,111,158,235,130,119,217,145,133,158,15,2,68,1,59,120,241,47,49,9,4,108,7,11,100,90,58,109,93,33,17,64,99,85,5,34,124,223,149,103,193,202,38,37,146,37,34,129,250,181,177,1,3,140,136,174,156,98,149,83,0,255,255,0,200,0,0,3,246,7,143,6,38,0,40,0,0,1,7,1,75,0,208,1,111,0,10,179,12,2,2,114,0,43,206,48,49,255,255,0,114,255,236,4,19,6,32,6,38,0,72,0,0,1,7,1,75,0,164,0,0,0,10,179,32,0,7,114,0,43,206,48,49,255,255,0,125,255,236,5,56,7,143,6,38,0,42,0,0,1,7,1,74,1,157,1,111,0,10,179,46,13,3,114,0,43,206,48,49,255,255,0,31,254,20,4,47,6,32,6,38,0,74,0,0,1,6,1,74,110,0,0,11,182,3,82,19,1,1,123,86,0,43,52,0,255,255,0,125,255,236,5,56,7,86,6,38,0,42,0,0,1,7,1,77,1,186,1,111,0,10,179,38,13,3,114,0,43,206,48,49,255,255,0,31,254,20,4,47,5,231,6,38,0,74,0,0,1,7,1,77,0,135,0,0,0,11,182,3,80,19,1,1,123,86,0,43,52,0,255,255,0,125,255,236,5,56,7,81,6,38,0,42,0,0,1,7,1,78,2,137,1,111,0,10,179,40,13,3,114,0,43,206,48,49,255,255,0,31,254,20,4,47,5,226,6,38,0,74,0,0,1,7,1,78,1,92,0,0,0,11,182,3,82,19,1,1,150,86,0,43,52,0,255,255,0,125,254,59,5,56,5,203,6,38,0,42,0,0,0,7,4,113,1,66,0,0,255,255,0,31,254,20,4,47,6,32,4,38,2,54,29,0,3,6,0,74,0,0,0,10,179,5,31,7,114,0,43,206,48,49,255,255,0,200,0,0,5,28,7,143,6,38,0,43,0,0,1,7,1,74,1,86,1,111,0,10,179,24,6,2,114,0,43,206,48,49,255,255,255,183,0,0,4,65,7,237,6,38,0,75,0,0,1,7,1,74,255,101,1,205,0,11,182,1,33,26,1,1,146,86,0,43,52,0,0,2,0,0,0,0,5,228,5,182,0,19,0,23,0,39,64,19,11,4,7,7,14,1,23,18,20,20,0,9,5,2,114,16,0,8,114,0,43,50,43,50,17,57,47,51,206,50,50,50,17,51,51,48,49,115,17,35,53,51,53,51,21,33,53,51,21,51,21,35,17,35,17,33,17,17,33,53,33,200,200,200,170,3,0,170,200,200,170,253,0,3,0,253,0,4,53,137,248,248,248,248,137,251,203,2,177,253,79,3,71,238,0,1,0,20,0,0,4,65,6,20,0,34,0,35,64,18,33,30,30,1,4,4,13,34,0,114,19,29,10,114,23,13,6,114,0,43,50,43,50,43,18,57,47,51,51,17,51,48,49,65,21,33,21,33,21,20,6,7,51,62,2,51,50,22,22,21,17,35,17,52,38,35,34,6,6,21,17,35,17,35,53,51,53,1,85,1,185,254,71,4,5,11,34,105,135,76,131,176,89,164,125,129,122,145,63,166,155,155,6,20,187,126,189,40,79,34,58,79,42,85,177,140,253,90,2,155,137,136,93,179,130,253,230,4,219,126,187,0,255,255,255,173,0,0,2,148,7,76,6,38,0,44,0,0,1,7,1,81,255,91,1,111,0,11,182,1,4,1,1,1,149,86,0,43,52,0,255,255,255,137,0,0,2,112,5,221,6,38,3,175,0,0,1,7,1,81,255,55,0,0,0,10,179,21,2,6,114,0,43,206,48,49,255,255,255,243,0,0,2,74,6,208,6,38,0,44,0,0,1,7,1,76,255,161,1,111,0,11,182,1,6,1,1,1,148,86,0,43,52,0,255,255,255,214,0,0,2,45,5,97,6,38,3,175,0,0,1,6,1,76,132,0,0,10,179,6,2,6,114,0,43,206,48,49,255,255,255,231,0,0,2,85,7,86,6,38,0,44,0,0,1,7,1,77,255,149,1,111,0,11,182,1,8,1,1,1,146,86,0,43,52,0,255,255,255,211,0,0,2,65,5,231,6,38,3,175,0,0,1,6,1,77,129,0,0,10,179,8,2,6,114,0,43,206,48,49,255,255,0,88,254,62,1,163,5,182,6,38,0,44,0,0,0,6,1,80,6,0,255,255,0,49,254,62,1,124,5,226,6,38,0,76,0,0,0,6,1,80,223,0,255,255,0,189,0,0,1,133,7,81,6,38,0,44,0,0,1,7,1,78,0,107,1,111,0,11,182,1,10,1,1,1,193,86,0,43,52,0,255,255,0,200,254,127,3,166,5,182,4,38,0,44,0,0,0,7,0,45,2,60,0,0,255,255,0,160,254,20,3,109,5,226,4,38,0,76,0,0,0,7,0,77,2,5,0,0,255,255,255,92,254,127,2,105,7,143,6,38,0,45,0,0,1,7,1,74,255,118,1,111,0,10,179,30,12,2,114,0,43,206,48,49,255,255,255,144,254,20,2,86,6,32,6,38,3,176,0,0,1,7,1,74,255,99,0,0,0,10,179,29,11,6,114,0,43,206,48,49,255,255,0,200,254,59,4,230,5,182,6,38,0,46,0,0,0,7,4,113,0,171,0,0,255,255,0,175,254,59,4,36,6,20,6,38,0,78,0,0,0,6,4,113,43,0,0,1,0,175,0,0,4,36,4,72,0,18,0,27,64,15,5,4,13,1,17,5,7,18,8,6,114,3,7,10,114,0,43,50,43,50,18,23,57,48,49,65,1,1,35,1,7,17,35,17,51,17,20,6,7,51,54,54,55,1,4,2,254,97,1,193,198,254,144,143,176,176,7,5,4,20,45,19,1,142,4,72,254,28,253,156,1,249,124,254,131,4,72,254,226,82,159,47,27,55,25,1,211,0,255,255,0,167,0,0,3,251,7,144,6,38,0,47,0,0,1,7,0,118,0,85,1,111,0,10,179,12,1,2,114,0,43,206,48,49,255,255,0,143,0,0,2,36,7,238,6,38,0,79,0,0,1,7,0,118,0,61,1,205,0,10,179,11,2,0,114,0,43,206,48,49,255,255,0,200,254,59,3,251,5,182,6,38,0,47,0,0,0,6,4,113,112,0,255,255,0,131,254,59,1,125,6,20,6,38,0,79,0,0,0,7,4,113,255,15,0,0,255,255,0,200,0,0,3,251,5,182,6,38,0,47,0,0,1,7,2,52,1,131,255,162,0,11,182,1,18,1,0,0,0,86,0,43,52,0,255,255,0,175,0,0,2,153,6,20,6,38,0,79,0,0,1,6,2,52,36,0,0,11,182,1,16,2,0,0,0,86,0,43,52,0,255,255,0,200,0,0,3,251,5,182,6,38,0,47,0,0,0,7,1,78,2,84,253,110,255,255,0,175,0,0,2,114,6,20,4,38,0,79,0,0,0,7,1,78,1,88,253,150,0,1,0,26,0,0,3,251,5,182,0,13,0,28,64,17,2,1,3,10,4,7,9,8,8,0,5,2,114,11,0,8,114,0,43,50,43,18,23,57,48,49,115,17,7,39,55,17,51,17,37,23,5,17,33,21,200,107,67,174,170,1,33,68,254,155,2,137,2,2,62,113,106,3,23,253,77,172,120,209,254,50,152,0,0,1,255,242,0,0,2,23,6,20,0,11,0,26,64,16,2,1,3,10,4,9,7,8,8,0,5,0,114,0,10,114,0,43,43,18,23,57,48,49,115,17,7,39,55,17,51,17,55,23,7,17,164,110,68,178,166,135,70,205,2,84,69,112,115,3,34,253,73,93,112,139,253,65,255,255,0,200,0,0,5,63,7,144,6,38,0,49,0,0,1,7,0,118,2,62,1,111,0,10,179,26,10,2,114,0,43,206,48,49,255,255,0,175,0,0,4,65,6,33,6,38,0,81,0,0,1,7,0,118,1,178,0,0,0,10,179,29,0,7,114,0,43,206,48,49,255,255,0,200,254,59,5,63,5,182,6,38,0,49,0,0,0,7,4,113,1,16,0,0,255,255,0,175,254,59,4,65,4,92,6,38,0,81,0,0,0,7,4,113,0,129,0,0,255,255,0,200,0,0,5,63,7,143,6,38,0,49,0,0,1,7,1,75,1,97,1,111,0,10,179,20,10,2,114,0,43,206,48,49,255,255,0,175,0,0,4,65,6,32,6,38,0,81,0,0,1,7,1,75,0,213,0,0,0,10,179,22,0,7,114,0,43,206,48,49,255,255,0,2,0,0,4,194,5,182,4,39,0,81,0,129,0,0,0,6,2,6,232,0,0,1,0,200,254,127,5,63,5,182,0,33,0,27,64,14,11,22,12,3,19,29,21,2,114,19,8,114,7,0,0,47,50,43,43,50,18,23,57,48,49,65,34,38,39,53,22,22,51,50,54,54,53,1,35,30,2,21,17,35,17,51,1,51,46,2,53,17,51,17,20,6,6,3,198,50,79,28,32,80,45,56,98,63,252,191,8,3,8,5,158,195,3,26,7,3,6,4,160,92,169,254,127,14,13,143,9,11,42,104,91,4,202,41,138,158,72,252,205,5,182,251,91,45,131,150,72,3,23,250,85,134,176,86,0,1,0,175,254,20,4,67,4,92,0,36,0,33,64,18,23,24,24,14,14,28,7,114,21,6,114,20,10,114,7,0,15,114,0,43,50,43,43,43,50,17,51,17,51,48,49,65,34,38,39,53,22,22,51,50,54,53,17,52,38,35,34,6,6,21,17,35,17,51,23,51,62,2,51,50,22,22,21,17,20,6,6,3,37,49,68,26,27,59,36,62,79,124,128,121,146,65,166,134,27,9,35,105,133,75,133,176,89,63,126,254,20,15,10,135,10,11,76,100,3,114,137,134,92,178,130,253,192,4,72,158,58,79,41,84,176,140,252,135,100,143,76,0,255,255,0,125,255,236,5,188,6,208,6,38,0,50,0,0,1,7,1,76,1,159,1,111,0,10,179,35,14,3,114,0,43,206,48,49,255,255,0,114,255,236,4,96,5,97,6,38,0,82,0,0,1,7,1,76,0,234,0,0,0,10,179,35,14,7,114,0,43,206,48,49,255,255,0,125,255,236,5,188,7,86,6,38,0,50,0,0,1,7,1,77,1,156,1,111,0,10,179,37,14,3,114,0,43,206,48,49,255,255,0,114,255,236,4,96,5,231,6,38,0,82,0,0,1,7,1,77,0,231,0,0,0,10,179,37,14,7,114,0,43,206,48,49,255,255,0,125,255,236,5,188,7,144,6,38,0,50,0,0,1,7,1,82,1,210,1,111,0,12,180,39,52,14,3,114,0,43,206,206,48,49,255,255,0,114,255,236,4,96,6,33,6,38,0,82,0,0,1,7,1,82,1,29,0,0,0,12,180,39,52,14,7,114,0,43,206,206,48,49,0,2,0,125,255,238,6,235,5,203,0,24,0,40,0,45,64,24,37,34,34,17,9,114,7,10,10,3,11,14,8,114,6,3,2,114,38,25,25,0,3,114,0,43,50,17,51,43,50,43,50,18,57,47,51,43,50,17,51,48,49,65,50,22,23,33,21,33,17,33,21,33,17,33,21,33,6,6,35,34,36,2,53,52,18,36,23,34,14,2,21,20,18,22,51,50,54,55,17,38,38,3,21,52,97,45,3,20,253,164,2,53,253,203,2,92,252,245,44,98,52,227,254,213,147,147,1,39,237,129,189,123,61,107,222,170,56,102,40,41,98,5,203,10,11,150,254,39,148,253,227,150,8,10,188,1,83,226,226,1,80,186,150,82,156,222,140,186,254,241,147,17,15,4,118,16,14,0,0,3,0,112,255,236,7,42,4,90,0,36,0,51,0,59,0,45,64,22,33,37,37,55,6,6,22,52,0,0,30,7,114,19,44,44,9,16,16,22,11,114,0,43,50,17,51,50,17,51,43,50,17,51,17,57,47,51,50,17,51,48,49,65,50,22,22,21,21,33,22,22,51,50,54,55,21,6,6,35,34,38,39,6,6,35,34,38,38,53,52,54,54,51,50,22,23,62,2,5,34,6,21,20,22,22,51,50,54,54,53,52,38,38,37,34,6,7,33,52,38,38,5,114,139,196,105,253,30,4,175,164,107,157,83,83,158,108,146,214,62,60,211,140,145,222,125,120,224,154,136,206,58,38,113,146,253,64,166,151,67,141,112,111,140,67,68,141,2,166,128,152,13,2,46,56,117,4,90,123,222,149,103,202,193,38,37,146,37,34,122,119,118,123,134,255,181,179,252,133,124,116,76,107,57,138,217,209,140,193,99,98,189,138,142,193,98,2,167,161,99,148,81,0,255,255,0,200,0,0,4,206,7,144,6,38,0,53,0,0,1,7,0,118,1,183,1,111,0,10,179,32,15,2,114,0,43,206,48,49,255,255,0,175,0,0,3,38,6,33,6,38,0,85,0,0,1,7,0,118,1,33,0,0,0,10,179,29,15,6,114,0,43,206,48,49,255,255,0,200,254,59,4,206,5,182,6,38,0,53,0,0,0,7,4,113,0,167,0,0,255,255,0,125,254,59,3,38,4,92,6,38,0,85,0,0,0,7,4,113,255,9,0,0,255,255,0,200,0,0,4,206,7,143,6,38,0,53,0,0,1,7,1,75,0,218,1,111,0,10,179,25,15,2,114,0,43,206,48,49,255,255,0,149,0,0,3,54,6,32,6,38,0,85,0,0,1,6,1,75,67,0,0,10,179,22,15,6,114,0,43,206,48,49,255,255,0,105,255,236,4,1,7,144,6,38,0,54,0,0,1,7,0,118,1,130,1,111,0,10,179,55,29,3,114,0,43,206,48,49,255,255,0,103,255,236,3,116,6,33,6,38,0,86,0,0,1,7,0,118,1,36,0,0,0,10,179,50,25,7,114,0,43,206,48,49,255,255,0,105,255,236,4,1,7,143,6,38,0,54,0,0,1,7,1,74,0,169,1,111,0,10,179,61,29,3,114,0,43,206,48,49,255,255,0,103,255,236,3,116,6,32,6,38,0,86,0,0,1,6,1,74,74,0,0,10,179,55,25,7,114,0,43,206,48,49,255,255,0,105,254,20,4,1,5,203,6,38,0,54,0,0,0,7,0,122,1,47,0,0,255,255,0,103,254,20,3,116,4,92,6,38,0,86,0,0,0,7,0,122,1,7,0,0,255,255,0,105,255,236,4,1,7,143,6,38,0,54,0,0,1,7,1,75,0,165,1,111,0,10,179,48,29,3,114,0,43,206,48,49,255,255,0,103,255,236,3,116,6,32,6,38,0,86,0,0,1,6,1,75,70,0,0,10,179,43,25,7,114,0,43,206,48,49,255,255,0,18,254,59,4,83,5,182,6,38,0,55,0,0,0,6,4,113,64,0,255,255,0,32,254,59,2,171,5,70,6,38,0,87,0,0,0,6,4,113,189,0,255,255,0,18,0,0,4,83,7,143,6,38,0,55,0,0,1,7,1,75,0,145,1,111,0,10,179,8,4,2,114,0,43,206,48,49,255,255,0,32,255,236,3,172,6,20,6,38,0,87,0,0,0,7,2,52,1,55,0,0,0,1,0,18,0,0,4,83,5,182,0,15,0,33,64,16,10,6,6,14,2,2,11,3,3,0,7,2,114,0,8,114,0,43,43,17,57,47,51,51,17,51,50,17,51,48,49,97,17,33,53,33,17,33,53,33,21,33,17,33,21,33,17,1,221,254,197,1,59,254,53,4,65,254,51,1,57,254,199,2,161,140,1,241,152,152,254,15,140,253,95,0,0,2,0,32,255,236,2,171,5,70,0,3,0,28,0,37,64,18,16,25,25,22,18,19,19,0,1,128,21,22,6,114,4,11,11,114,0,43,50,43,205,26,204,50,51,17,51,17,51,17,51,48,49,83,53,33,21,3,50,54,55,21,6,6,35,34,38,38,53,17,35,53,55,55,51,21,33,21,33,17,20,22,48,2,95,126,41,86,27,29,103,49,87,142,85,156,157,66,100,1,65,254,191,95,2,62,127,127,254,54,14,10,129,13,18,61,146,129,2,138,81,65,238,254,130,253,123,103,102,0,255,255,0,185,255,236,5,26,7,76,6,38,0,56,0,0,1,7,1,81,1,38,1,111,0,10,179,20,9,2,114,0,43,206,48,49,255,255,0,163,255,236,4,56,5,221,6,38,0,88,0,0,1,7,1,81,0,173,0,0,0,10,179,24,13,6,114,0,43,206,48,49,255,255,0,185,255,236,5,26,6,208,6,38,0,56,0,0,1,7,1,76,1,109,1,111,0,10,179,22,9,2,114,0,43,206,48,49,255,255,0,163,255,236,4,56,5,97,6,38,0,88,0,0,1,7,1,76,0,246,0,0,0,10,179,26,13,6,114,0,43,206,48,49,255,255,0,185,255,236,5,26,7,86,6,38,0,56,0,0,1,7,1,77,1,106,1,111,0,10,179,24,9,2,114,0,43,206,48,49,255,255,0,163,255,236,4,56,5,231,6,38,0,88,0,0,1,7,1,77,0,243,0,0,0,10,179,28,13,6,114,0,43,206,48,49,255,255,0,185,255,236,5,26,7,247,6,38,0,56,0,0,1,7,1,79,1,189,1,111,0,13,183,2,1,20,19,1,1,147,86,0,43,52,52,0,255,255,0,163,255,236,4,56,6,136,6,38,0,88,0,0,1,7,1,79,1,70,0,0,0,13,183,2,1,24,23,1,1,146,86,0,43,52,52,0,255,255,0,185,255,236,5,26,7,144,6,38,0,56,0,0,1,7,1,82,1,160,1,111,0,12,180,27,40,9,2,114,0,43,206,206,48,49,255,255,0,163,255,236,4,76,6,33,6,38,0,88,0,0,1,7,1,82,1,40,0,0,0,12,180,31,44,13,6,114,0,43,206,206,48,49,0,2,0,185,254,62,5,26,5,182,0,21,0,41,0,31,64,15,41,31,2,114,18,17,17,36,36,3,10,10,27,9,114,0,43,50,47,51,50,17,51,17,51,43,50,48,49,69,20,22,51,50,54,55,21,6,6,35,34,38,53,52,54,54,55,55,14,2,1,17,20,6,6,35,32,0,53,17,51,17,20,22,51,50,54,54,53,17,3,178,51,45,33,48,17,28,57,39,106,100,65,94,43,118,60,82,42,1,104,125,252,190,254,241,254,229,171,197,196,134,171,83,222,62,53,9,4,108,7,11,105,103,65,126,104,31,18,67,109,97,6,97,252,78,155,242,139,1,38,246,3,174,252,77,186,202,97,175,115,3,180,0,255,255,0,163,254,62,4,74,4,72,6,38,0,88,0,0,0,7,1,80,2,173,0,0,255,255,0,30,0,0,7,69,7,143,6,38,0,58,0,0,1,7,1,74,2,18,1,111,0,10,179,55,16,2,114,0,43,206,48,49,255,255,0,24,0,2,6,27,6,32,6,38,0,90,0,0,1,7,1,74,1,125,0,0,0,10,179,55,15,6,114,0,43,206,48,49,255,255,0,0,0,0,4,121,7,143,6,38,0,60,0,0,1,7,1,74,0,158,1,111,0,10,179,21,7,2,114,0,43,206,48,49,255,255,0,2,254,19,4,2,6,32,6,38,0,92,0,0,1,6,1,74,98,0,0,10,179,36,0,6,114,0,43,206,48,49,255,255,0,0,0,0,4,121,7,65,6,38,0,60,0,0,1,7,0,106,255,236,1,111,0,12,180,30,18,7,2,114,0,43,206,206,48,49,255,255,0,78,0,0,4,69,7,144,6,38,0,61,0,0,1,7,0,118,1,141,1,111,0,10,179,17,5,2,114,0,43,206,48,49,255,255,0,80,0,0,3,111,6,33,6,38,0,93,0,0,1,7,0,118,1,26,0,0,0,10,179,17,5,6,114,0,43,206,48,49,255,255,0,78,0,0,4,69,7,81,6,38,0,61,0,0,1,7,1,78,1,159,1,111,0,10,179,16,5,2,114,0,43,206,48,49,255,255,0,80,0,0,3,111,5,226,6,38,0,93,0,0,1,7,1,78,1,45,0,0,0,10,179,16,5,6,114,0,43,206,48,49,255,255,0,78,0,0,4,69,7,143,6,38,0,61,0,0,1,7,1,75,0,175,1,111,0,10,179,10,5,2,114,0,43,206,48,49,255,255,0,80,0,0,3,111,6,32,6,38,0,93,0,0,1,6,1,75,61,0,0,10,179,10,5,6,114,0,43,206,48,49,0,1,0,175,0,0,2,217,6,31,0,16,0,14,182,0,10,1,114,5,10,114,0,43,43,50,48,49,65,34,6,21,17,35,17,52,54,54,51,50,22,23,7,38,38,2,18,89,99,167,88,160,109,61,97,39,42,32,83,5,148,113,132,251,97,4,160,137,169,77,23,14,132,11,19,0,0,1,0,190,254,20,4,14,5,203,0,37,0,35,64,16,32,33,33,11,30,14,14,11,11,0,26,19,15,114,7,0,0,47,50,43,50,18,57,47,51,17,51,17,51,17,51,48,49,65,50,22,23,7,38,38,35,34,6,21,21,33,21,33,17,20,6,6,35,34,38,39,53,22,22,51,50,54,53,17,35,53,55,53,52,54,54,3,65,62,104,39,41,34,82,44,93,87,1,21,254,239,77,148,106,40,73,27,31,65,34,88,82,213,213,79,154,5,203,27,14,130,11,21,102,131,146,130,252,50,127,156,70,12,7,139,8,11,95,121,3,204,80,56,139,139,163,71,0,4,255,254,0,0,5,18,7,172,0,18,0,30,0,42,0,55,0,38,64,19,19,25,1,13,31,4,17,17,7,18,8,15,8,48,48,55,55,37,7,0,47,51,51,47,51,47,63,63,18,57,47,23,57,51,48,49,99,1,38,38,53,52,54,51,50,22,21,20,6,7,1,35,3,33,3,19,33,3,46,2,39,14,3,7,19,50,54,53,52,38,35,34,6,21,20,22,3,53,62,2,55,51,21,14,3,7,2,2,22,50,58,124,97,97,131,58,50,2,21,177,174,253,161,168,228,1,241,178,10,25,26,11,8,19,18,17,7,67,54,67,67,54,52,68,64,32,30,67,62,22,200,17,62,76,79,35,4,214,25,95,69,101,115,114,101,67,96,25,251,40,1,146,254,110,2,42,1,175,24,65,74,35,27,56,54,47,17,1,67,64,58,57,62,62,57,57,65,1,135,18,34,87,90,39,16,24,66,71,67,24,0,5,0,94,255,236,3,203,7,168,0,29,0,40,0,52,0,65,0,77,0,52,64,26,6,37,37,19,30,30,0,11,11,114,5,10,67,77,77,73,71,71,41,53,47,60,23,0,7,114,0,43,50,222,50,204,50,50,47,51,51,17,51,63,43,17,57,47,51,50,17,51,48,49,65,50,22,21,17,35,39,35,14,2,35,34,38,38,53,52,36,37,55,53,52,38,35,34,6,7,39,54,54,1,7,6,6,21,20,22,51,50,54,53,3,34,6,21,20,22,51,50,54,53,52,38,39,50,22,22,21,20,6,35,34,38,53,52,54,1,21,14,2,7,35,53,62,2,55,2,73,196,190,121,32,8,46,100,131,95,100,155,89,1,4,1,10,189,122,111,86,156,70,51,74,192,1,72,167,205,168,114,94,146,186,227,52,68,63,57,52,66,68,50,64,101,59,127,97,98,124,124,1,159,23,111,127,47,120,30,68,62,22,4,90,176,193,253,23,162,60,81,41,70,142,109,164,176,8,8,67,142,114,50,34,126,38,54,253,194,7,8,118,108,94,90,162,162,4,106,64,55,55,65,65,55,55,64,95,52,95,66,102,115,114,102,100,114,1,40,12,26,77,77,26,15,28,71,73,31,255,255,255,254,0,0,6,129,7,144,6,38,0,136,0,0,1,7,0,118,3,24,1,111,0,10,179,27,6,2,114,0,43,206,48,49,255,255,0,94,255,236,6,125,6,33,6,38,0,168,0,0,1,7,0,118,2,186,0,0,0,10,179,77,44,7,114,0,43,206,48,49,255,255,0,125,255,194,5,188,7,144,6,38,0,154,0,0,1,7,0,118,2,90,1,111,0,10,179,56,18,3,114,0,43,206,48,49,255,255,0,114,255,189,4,96,6,33,6,38,0,186,0,0,1,7,0,118,1,164,0,0,0,10,179,53,16,7,114,0,43,206,48,49,255,255,0,105,254,59,4,1,5,203,6,38,0,54,0,0,0,6,4,113,29,0,255,255,0,103,254,59,3,116,4,92,6,38,0,86,0,0,0,6,4,113,245,0,0,1,0,82,4,217,2,243,6,32,0,18,0,23,64,11,9,4,14,3,18,128,6,15,12,1,12,0,47,93,51,26,205,23,57,48,49,65,30,2,23,21,35,38,38,39,6,6,7,35,53,62,2,55,1,245,25,90,100,39,118,54,114,54,54,111,54,114,38,97,89,26,6,32,45,113,108,39,22,35,102,55,55,101,36,22,40,108,112,45,0,1,0,82,4,217,2,243,6,32,0,18,0,27,64,12,9,0,14,4,4,12,6,128,15,0,1,0,0,47,93,26,205,50,50,17,51,17,57,48,49,65,46,2,39,53,51,22,22,23,54,54,55,51,21,14,2,7,1,76,26,90,97,37,114,54,115,50,54,114,54,118,39,100,90,25,4,217,46,110,107,39,25,37,103,56,56,103,37,25,39,107,110,46,0,1,0,82,4,219,2,169,5,97,0,3,0,12,180,3,15,2,1,2,0,47,93,51,48,49,65,21,33,53,2,169,253,169,5,97,134,134,0,1,0,82,4,217,2,192,5,231,0,16,0,18,183,16,8,128,12,15,4,1,4,0,47,93,51,26,204,50,48,49,65,14,2,35,34,38,39,51,30,2,51,50,54,54,55,2,192,7,77,136,96,147,151,8,104,6,50,88,62,55,88,56,7,5,231,81,121,68,146,124,56,58,21,23,59,53,0,1,0,82,5,8,1,26,5,226,0,11,0,12,180,0,15,6,1,6,0,47,93,51,48,49,83,50,22,21,20,6,35,34,38,53,52,54,182,41,59,59,41,43,57,57,5,226,53,56,55,54,54,55,56,53,0,2,0,82,4,218,2,16,6,136,0,11,0,23,0,14,180,18,6,192,12,0,0,47,50,26,204,50,48,49,65,34,38,53,52,54,51,50,22,21,20,6,39,50,54,53,52,38,35,34,6,21,20,22,1,47,97,124,123,98,95,130,128,97,53,67,69,51,50,69,62,4,218,114,102,100,114,114,98,103,115,96,65,55,55,64,64,55,55,65,0,1,0,82,254,62,1,157,0,30,0,20,0,14,180,3,10,192,18,17,0,47,51,26,204,50,48,49,87,20,22,51,50,54,55,21,6,6,35,34,38,53,52,54,54,55,23,6,6,219,50,46,33,48,17,28,58,39,105,101,58,88,44,92,70,75,241,47,49,9,4,108,7,11,100,90,58,109,92,31,30,64,112,0,0,1,0,82,4,220,3,57,5,221,0,25,0,29,64,13,22,13,13,5,17,128,25,25,10,15,17,1,17,0,47,93,51,51,47,26,16,205,50,47,50,48,49,83,62,3,51,50,30,2,51,50,54,55,51,6,6,35,34,46,2,35,34,6,7,82,6,34,56,77,47,46,84,76,71,33,48,53,14,98,13,112,95,44,82,76,73,35,49,52,14,4,220,60,94,66,35,37,47,37,59,64,117,139,37,47,37,59,63,0,0,2,0,82,4,217,3,36,6,33,0,12,0,25,0,31,64,14,1,14,14,12,25,128,8,6,6,21,15,19,1,19,0,47,93,51,51,17,51,26,205,50,50,17,51,48,49,65,21,14,3,7,35,53,62,2,55,35,21,14,3,7,35,53,62,2,55,3,36,17,62,77,79,34,96,30,68,64,21,175,17,62,77,79,34,96,30,67,64,22,6,33,20,28,81,89,81,29,24,39,107,112,46,20,28,81,89,81,29,24,39,107,112,46,0,1,2,8,4,217,3,25,6,113,0,12,0,14,180,8,6,128,1,0,0,47,50,26,204,50,48,49,65,53,62,3,55,51,21,14,2,7,2,8,14,29,25,20,6,179,11,56,70,34,4,217,27,38,96,104,101,42,22,47,138,144,57,0,0,3,1,32,5,16,3,144,6,180,0,11,0,23,0,35,0,23,64,9,24,30,30,18,11,128,6,12,18,0,47,51,220,26,204,17,51,17,51,48,49,65,21,14,2,7,35,53,62,2,55,7,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,38,53,52,54,3,30,20,63,74,37,81,16,35,32,9,238,38,51,51,38,38,51,51,1,227,36,54,54,36,40,49,49,6,180,20,43,107,111,48,23,42,106,111,47,226,46,50,49,49,49,49,50,46,46,50,49,49,49,49,50,46,255,255,0,0,0,0,5,13,6,4,6,38,0,36,0,0,0,7,1,83,254,19,255,147,255,255,0,150,3,93,1,132,4,98,6,7,0,17,0,0,3,121,255,255,255,254,0,0,4,153,6,4,4,39,0,40,0,163,0,0,0,7,1,83,253,246,255,147,255,255,255,254,0,0,5,191,6,4,4,39,0,43,0,163,0,0,0,7,1,83,253,246,255,147,255,255,255,254,0,0,2,25,6,4,4,39,0,44,0,167,0,0,0,7,1,83,253,246,255,147,255,255,255,254,255,236,6,17,6,4,4,38,0,50,85,0,0,7,1,83,253,246,255,147,255,255,255,254,0,0,5,174,6,4,4,39,0,60,1,53,0,0,0,7,1,83,253,246,255,147,255,255,255,242,0,0,6,56,6,6,4,38,1,117,70,0,0,7,1,83,253,234,255,149,255,255,255,213,255,236,2,147,6,180,6,38,1,133,0,0,1,7,1,84,254,181,0,0,0,16,64,9,3,2,1,47,16,1,1,175,86,0,43,52,52,52,255,255,0,0,0,0,5,13,5,188,6,6,0,36,0,0,255,255,0,200,0,0,4,188,5,182,6,6,0,37,0,0,0,1,0,200,0,0,3,253,5,182,0,5,0,14,182,2,5,2,114,4,8,114,0,43,43,50,48,49,65,21,33,17,35,17,3,253,253,117,170,5,182,152,250,226,5,182,0,2,0,37,0,0,4,125,5,182,0,5,0,16,0,25,64,12,11,3,5,2,114,1,4,16,16,3,8,114,0,43,50,18,57,57,43,17,57,48,49,65,1,21,33,53,9,2,46,2,39,14,2,7,1,2,165,1,216,251,168,1,215,1,197,254,238,20,36,30,11,12,28,33,19,254,234,5,182,250,176,102,104,5,78,250,224,3,32,60,114,106,47,47,105,110,57,252,216,0,255,255,0,200,0,0,3,246,5,182,6,6,0,40,0,0,255,255,0,78,0,0,4,69,5,182,6,6,0,61,0,0,255,255,0,200,0,0,5,28,5,182,6,6,0,43,0,0,0,3,0,125,255,236,5,188,5,205,0,3,0,21,0,36,0,25,64,12,3,2,2,9,33,18,3,114,26,9,9,114,0,43,50,43,50,17,57,47,51,48,49,65,21,33,53,5,20,2,6,6,35,34,38,38,2,53,52,18,36,51,50,4,18,5,20,18,22,51,50,54,18,53,16,2,35,34,6,2,4,85,253,141,3,218,86,169,250,165,170,253,167,83,148,1,45,227,217,1,41,153,251,116,106,219,169,170,217,104,237,251,170,220,107,3,49,148,148,84,169,254,235,199,108,108,200,1,22,169,224,1,82,188,186,254,175,229,186,254,240,148,148,1,16,186,1,27,1,63,146,254,243,0,255,255,0,200,0,0,1,114,5,182,6,6,0,44,0,0,255,255,0,200,0,0,4,230,5,182,6,6,0,46,0,0,0,1,0,0,0,0,4,209,5,182,0,14,0,19,64,9,7,2,14,2,114,2,13,8,114,0,43,50,43,17,57,48,49,65,1,35,1,46,2,39,14,2,7,1,35,1,2,192,2,17,179,254,175,21,38,32,13,10,30,38,21,254,178,180,2,15,5,182,250,74,3,181,61,114,105,47,47,105,113,60,252,73,5,182,255,255,0,200,0,0,6,106,5,182,6,6,0,48,0,0,255,255,0,200,0,0,5,63,5,182,6,6,0,49,0,0,0,3,0,67,0,0,4,36,5,182,0,3,0,7,0,11,0,25,64,12,5,4,4,0,8,9,2,114,1,0,8,114,0,43,50,43,50,17,57,47,51,48,49,115,53,33,21,1,53,33,21,1,53,33,21,67,3,225,252,154,2,235,252,195,3,143,150,150,2,178,149,149,2,110,150,150,255,255,0,125,255,236,5,188,5,205,6,6,0,50,0,0,0,1,0,200,0,0,5,9,5,182,0,7,0,16,183,6,1,2,114,4,0,8,114,0,43,50,43,50,48,49,115,17,33,17,35,17,33,17,200,4,65,168,253,17,5,182,250,74,5,32,250,224,255,255,0,200,0,0,4,102,5,182,6,6,0,51,0,0,0,1,0,72,0,0,4,90,5,182,0,18,0,39,64,19,3,11,11,7,7,12,2,0,4,2,114,1,13,13,16,16,0,8,114,0,43,50,17,51,17,51,43,18,57,57,51,17,51,17,51,48,49,115,53,1,1,53,33,21,33,34,34,38,39,1,1,50,54,51,33,21,72,1,234,254,34,3,203,253,230,31,93,88,24,1,215,254,20,75,150,79,2,38,140,2,112,2,45,141,152,1,1,253,222,253,150,2,150,0,255,255,0,18,0,0,4,83,5,182,6,6,0,55,0,0,255,255,0,0,0,0,4,121,5,182,6,6,0,60,0,0,0,3,0,105,255,236,5,245,5,203,0,24,0,33,0,42,0,33,64,16,34,1,1,25,23,24,3,114,35,10,10,33,13,12,9,114,0,43,205,50,50,17,51,43,205,50,50,17,51,48,49,65,21,22,4,22,21,20,14,2,7,21,35,53,46,3,53,52,62,2,55,53,17,14,2,21,20,22,22,23,19,17,62,2,53,52,38,38,3,131,232,1,18,120,64,144,241,177,168,181,242,142,61,66,147,240,173,166,199,88,97,201,155,168,160,200,94,88,199,5,203,180,4,144,242,153,104,196,157,95,3,225,225,3,98,158,194,100,111,195,149,87,3,180,254,188,4,99,176,120,126,183,101,5,3,46,252,210,5,104,184,124,121,175,97,0,255,255,0,6,0,0,4,152,5,182,6,6,0,59,0,0,0,1,0,111,0,0,5,238,5,182,0,29,0,31,64,15,24,21,21,6,9,9,8,29,23,15,2,114,8,8,114,0,43,43,50,50,18,57,47,51,51,17,51,48,49,65,17,20,14,2,35,17,35,17,34,46,2,53,17,51,17,20,22,22,23,17,51,17,62,2,53,17,5,238,61,143,240,179,166,179,239,140,60,170,94,198,156,166,159,198,92,5,182,254,31,110,194,147,85,254,67,1,189,86,148,193,107,1,227,254,33,132,173,85,1,3,102,252,154,1,86,172,129,1,226,0,0,1,0,79,0,0,5,242,5,205,0,39,0,31,64,15,0,20,3,114,32,28,28,31,31,8,11,11,10,8,114,0,43,50,17,51,50,17,51,17,51,43,50,48,49,65,34,6,6,21,20,22,22,23,21,33,53,33,46,2,53,52,18,36,51,50,4,18,21,20,2,6,7,33,21,33,53,62,2,53,52,38,38,3,31,165,217,106,71,156,127,253,182,1,119,90,147,86,158,1,43,211,215,1,44,156,85,146,91,1,118,253,182,129,156,71,108,219,5,55,125,232,161,142,241,207,91,136,150,68,194,255,156,202,1,41,163,161,254,216,203,157,255,0,195,67,150,136,90,208,243,140,162,232,124,0,255,255,0,6,0,0,2,59,7,65,6,38,0,44,0,0,1,7,0,106,254,208,1,111,0,12,180,13,25,1,2,114,0,43,206,206,48,49,255,255,0,0,0,0,4,121,7,65,6,38,0,60,0,0,1,7,0,106,255,236,1,111,0,12,180,30,18,7,2,114,0,43,206,206,48,49,255,255,0,114,255,236,4,199,6,113,6,38,1,125,0,0,1,6,1,83,35,0,0,10,179,52,20,7,114,0,43,206,48,49,255,255,0,89,255,236,3,140,6,113,6,38,1,129,0,0,1,6,1,83,202,0,0,10,179,45,31,7,114,0,43,206,48,49,255,255,0,175,254,20,4,65,6,113,6,38,1,131,0,0,1,6,1,83,66,0,0,10,179,24,0,7,114,0,43,206,48,49,255,255,0,168,255,236,2,147,6,113,6,38,1,133,0,0,1,7,1,83,254,175,0,0,0,10,179,17,16,6,114,0,43,206,48,49,255,255,0,163,255,236,4,111,6,180,6,38,1,145,0,0,1,6,1,84,35,0,0,14,181,30,54,42,5,6,114,0,43,206,206,206,48,49,0,2,0,114,255,236,4,199,4,92,0,13,0,51,0,39,64,20,27,6,114,23,24,24,8,8,20,7,114,36,44,44,48,0,0,14,11,114,0,43,50,17,51,50,17,51,43,50,17,51,17,51,43,48,49,101,50,54,54,53,53,52,38,35,34,6,21,20,22,23,34,2,17,16,18,51,50,22,23,51,54,54,55,51,14,2,21,17,20,22,51,50,54,55,21,14,2,35,34,38,39,35,14,2,2,79,115,139,64,139,179,155,150,147,131,204,246,246,221,122,163,52,12,8,32,22,132,15,23,13,50,37,16,37,10,10,36,43,22,76,95,19,13,31,89,131,118,90,185,141,16,210,216,222,212,210,214,138,1,28,1,24,1,21,1,39,88,86,38,84,32,46,142,160,75,254,81,70,56,7,4,122,6,11,8,76,100,48,80,48,0,2,0,175,254,20,4,166,6,31,0,24,0,48,0,41,64,21,8,7,41,41,42,42,0,20,15,114,18,30,33,33,15,11,114,25,0,1,114,0,43,50,43,50,17,51,57,43,18,57,47,51,18,57,57,48,49,65,50,22,22,21,20,6,7,21,22,22,21,20,6,6,35,34,38,39,17,35,17,52,54,54,23,34,6,6,21,17,22,22,51,50,54,53,52,38,38,35,35,53,51,50,54,53,52,38,2,150,136,209,119,158,149,182,189,119,222,157,117,164,69,167,125,220,138,87,144,85,73,158,105,179,167,89,162,112,110,91,161,152,160,6,31,87,173,129,147,175,25,8,21,200,185,139,195,102,40,35,253,220,6,53,162,208,100,139,63,148,129,252,142,40,48,162,148,108,141,68,141,154,130,128,130,0,0,1,0,9,254,20,4,11,4,72,0,23,0,21,64,10,17,10,6,23,11,6,114,6,15,114,0,43,43,50,18,57,57,48,49,65,1,14,2,21,35,52,54,54,55,1,51,19,30,2,23,51,62,2,55,19,4,11,254,108,32,45,24,180,27,47,30,254,67,173,242,21,44,35,7,8,7,33,40,17,226,4,72,251,217,84,190,180,71,60,175,189,82,4,58,253,169,51,124,113,36,33,116,123,44,2,95,0,0,2,0,112,255,236,4,93,6,22,0,36,0,51,0,28,64,16,34,14,30,37,49,41,6,0,45,22,11,114,7,0,0,114,0,43,50,43,50,18,23,57,48,49,65,50,22,23,7,38,38,35,34,6,21,20,22,22,23,30,2,21,20,6,6,35,34,38,38,53,52,54,54,55,46,2,53,52,54,19,14,2,21,20,22,22,51,50,54,54,53,52,38,2,139,136,198,82,72,78,170,103,97,93,54,122,100,122,173,92,125,227,154,146,225,128,110,195,126,79,115,63,208,182,90,181,120,78,146,102,107,149,78,143,6,22,67,41,131,44,58,88,62,52,81,84,55,67,148,183,121,161,223,116,107,205,145,130,197,136,37,45,97,118,76,140,145,253,73,22,95,172,138,94,144,80,84,161,115,142,178,0,0,1,0,89,255,236,3,140,4,92,0,44,0,31,64,15,23,24,44,44,2,2,17,38,31,7,114,10,17,11,114,0,43,50,43,50,17,57,47,51,18,57,57,48,49,65,21,35,34,6,6,21,20,22,22,51,50,54,55,21,6,6,35,34,38,53,52,54,55,53,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,2,206,146,106,141,70,77,134,85,112,173,68,62,176,124,231,222,143,100,94,110,107,188,120,116,168,81,62,67,143,94,127,128,171,146,2,128,136,44,88,66,68,84,38,52,32,147,32,41,181,136,122,121,28,10,28,123,97,94,129,67,39,37,133,31,40,84,80,93,81,0,1,0,114,254,113,3,162,6,20,0,41,0,27,64,12,21,25,25,26,26,38,12,3,27,0,114,3,0,47,43,18,57,57,51,17,51,17,51,48,49,69,20,6,7,35,62,2,53,52,38,38,39,46,2,53,52,62,2,55,14,2,35,33,53,33,21,6,2,6,6,21,20,22,22,23,30,2,3,160,77,50,165,33,58,35,36,107,108,131,177,89,96,170,224,128,12,91,126,66,254,251,2,242,210,255,133,46,82,157,112,104,128,59,90,88,156,65,43,96,92,36,32,51,42,19,23,107,183,134,151,254,227,218,116,1,3,3,138,125,178,254,232,226,190,87,116,126,62,23,20,63,89,0,0,1,0,175,254,20,4,65,4,92,0,23,0,27,64,15,17,6,114,16,10,114,5,15,114,19,10,10,0,7,114,0,43,50,17,51,43,43,43,48,49,65,50,22,22,21,17,35,17,52,38,35,34,6,6,21,17,35,17,51,23,51,62,2,2,182,130,176,89,164,124,130,120,145,65,166,134,25,9,35,108,134,4,92,84,177,141,251,74,4,171,137,136,92,179,131,253,194,4,72,158,58,79,41,0,3,0,113,255,236,4,73,6,33,0,13,0,20,0,27,0,25,64,12,24,18,18,4,21,11,1,114,14,4,11,114,0,43,50,43,50,17,57,47,51,48,49,65,20,2,6,35,34,2,17,52,18,54,51,50,18,1,50,18,19,33,18,18,19,34,2,3,33,2,2,4,73,100,218,177,250,239,100,216,173,251,244,254,17,164,156,7,253,120,5,150,166,160,151,10,2,134,10,154,3,8,252,254,156,188,1,162,1,121,252,1,99,187,254,99,251,240,1,49,1,49,254,210,254,204,5,36,254,227,254,229,1,27,1,29,0,1,0,168,255,236,2,147,4,72,0,16,0,14,182,16,6,114,4,11,11,114,0,43,50,43,48,49,65,17,20,22,51,50,54,55,21,6,6,35,34,38,38,53,17,1,76,79,85,43,94,26,28,106,51,90,138,78,4,72,252,249,103,102,15,8,129,13,17,59,147,131,3,11,255,255,0,175,0,0,4,36,4,72,6,6,0,249,0,0,0,1,255,244,255,236,4,74,6,33,0,45,0,30,64,17,2,17,1,40,4,13,22,30,11,114,5,13,1,114,0,10,114,0,43,43,50,43,50,18,23,57,48,49,99,1,39,38,38,35,34,6,7,53,62,2,51,50,22,22,23,1,30,2,51,50,54,55,21,14,2,35,34,38,38,39,3,46,3,39,35,6,6,7,1,12,1,217,57,34,79,86,36,55,21,18,42,47,24,101,124,85,41,1,105,14,29,36,23,15,35,10,14,35,39,23,48,70,51,21,162,12,29,28,22,6,7,18,57,32,254,248,4,56,161,91,98,8,5,135,5,7,5,70,146,114,252,11,38,48,23,7,3,124,6,11,6,32,72,58,1,201,36,83,84,76,28,67,154,76,253,159,255,255,0,175,254,20,4,67,4,72,6,6,0,119,0,0,0,1,0,0,0,0,4,1,4,72,0,17,0,21,64,10,7,6,0,17,10,114,12,0,6,114,0,43,50,43,17,57,57,48,49,81,51,19,30,2,23,51,54,18,18,53,51,20,2,2,7,35,172,234,17,43,39,9,8,127,148,64,164,79,191,168,178,4,72,253,137,44,123,118,38,127,1,32,1,81,202,217,254,139,254,173,167,0,0,1,0,112,254,113,3,159,6,20,0,60,0,37,64,17,5,4,30,30,33,33,48,22,13,13,17,17,18,18,19,0,114,0,43,50,17,51,17,51,17,51,47,57,47,51,18,57,57,48,49,83,52,54,54,55,53,46,2,53,52,54,54,55,14,2,35,35,53,33,21,35,34,14,2,21,20,22,51,51,21,35,34,6,6,21,20,22,22,23,30,2,21,20,6,7,35,62,2,53,52,38,38,39,46,2,112,81,133,78,69,100,54,84,140,83,27,79,93,47,67,2,191,56,88,171,138,83,157,184,166,171,126,175,91,87,160,110,105,124,55,76,45,158,33,55,32,35,109,110,132,179,91,1,167,104,156,104,23,11,19,72,112,79,98,127,78,23,3,5,3,138,129,39,79,121,82,109,114,128,83,144,93,105,110,54,23,22,65,88,58,87,157,65,45,95,92,37,31,49,43,20,23,102,166,0,255,255,0,114,255,236,4,96,4,92,6,6,0,82,0,0,0,1,0,25,255,236,4,245,4,72,0,24,0,29,64,16,12,17,21,3,16,16,18,6,114,14,10,114,0,7,11,114,0,43,50,43,43,50,17,23,51,48,49,101,50,54,55,21,6,6,35,34,38,53,17,33,17,35,17,35,53,55,33,21,35,17,20,22,4,127,28,46,15,16,68,47,108,113,254,36,164,223,150,4,70,217,54,116,13,7,132,8,16,129,127,2,209,252,67,3,189,75,64,139,253,60,73,60,0,2,0,164,254,20,4,94,4,92,0,21,0,34,0,29,64,15,22,18,7,114,13,15,114,7,26,26,29,29,4,11,114,0,43,50,17,51,17,51,43,43,50,48,49,65,20,6,6,35,34,38,39,35,22,22,21,17,35,17,52,54,54,51,50,22,22,37,34,6,21,17,22,22,51,50,54,53,52,38,4,94,116,216,150,87,158,59,9,5,4,168,117,217,149,141,212,118,254,34,157,151,60,157,86,164,149,145,2,37,185,254,130,49,45,37,141,89,254,213,4,33,185,244,122,130,253,243,209,206,254,172,51,52,218,213,214,213,0,1,0,114,254,113,3,164,4,92,0,38,0,20,64,10,26,18,30,14,4,21,7,0,7,114,0,43,50,47,23,57,48,49,65,50,22,23,7,38,38,35,34,6,21,20,22,22,23,30,2,21,20,6,7,35,62,2,53,52,38,38,39,46,3,53,52,18,54,2,127,81,155,57,52,55,125,68,183,163,59,155,142,105,125,55,77,44,158,33,55,34,36,108,108,87,148,109,60,132,236,4,92,33,24,139,20,31,230,218,122,144,82,31,22,65,88,59,88,160,61,44,95,92,38,32,50,43,20,17,69,118,177,125,204,1,7,128,0,2,0,114,255,236,4,179,4,72,0,17,0,32,0,23,64,11,29,15,30,30,12,6,114,22,4,11,114,0,43,50,43,50,17,51,51,48,49,65,20,6,6,35,34,38,38,53,52,54,36,51,33,21,33,22,22,5,20,22,22,51,50,54,53,52,38,38,39,35,34,6,4,93,115,225,166,151,224,122,143,1,11,184,1,239,254,248,80,98,252,193,68,146,116,173,158,40,77,55,67,214,208,1,249,150,238,137,126,242,174,203,253,118,139,79,224,132,118,182,104,215,169,90,162,142,61,201,0,1,0,20,255,234,3,144,4,72,0,21,0,23,64,11,20,2,19,19,21,6,114,6,13,11,114,0,43,50,43,50,17,51,51,48,49,65,21,33,17,20,22,51,50,54,55,21,6,6,35,34,38,38,53,17,33,53,55,3,144,254,84,108,91,45,95,32,29,108,59,95,156,93,254,217,150,4,72,141,253,147,121,100,13,9,125,12,20,58,147,133,2,127,77,64,0,1,0,163,255,236,4,111,4,72,0,23,0,16,183,17,5,6,114,10,0,11,114,0,43,50,43,50,48,49,69,34,38,38,53,17,51,17,20,22,51,50,54,53,52,38,39,51,30,2,21,16,0,2,112,177,201,83,166,148,160,167,163,33,31,167,21,29,15,254,254,20,134,233,148,2,89,253,173,181,204,239,250,141,228,122,81,152,165,100,254,196,254,210,0,2,0,114,254,20,5,74,4,92,0,29,0,41,0,33,64,17,22,15,114,8,23,23,34,20,11,114,1,0,0,30,12,7,114,0,43,50,50,17,51,43,50,50,17,51,43,48,49,65,23,6,6,21,20,22,22,23,17,52,54,51,50,22,22,21,20,2,6,7,17,35,17,46,2,53,52,18,5,34,6,21,17,62,2,53,52,38,38,1,67,128,77,94,96,165,101,168,148,124,177,95,150,250,150,162,155,238,135,118,2,216,66,90,110,172,100,58,102,4,83,89,100,223,145,150,184,89,9,2,111,184,191,135,243,162,195,254,254,133,9,254,39,1,217,9,121,248,196,167,1,19,19,106,129,253,143,9,105,197,145,130,180,94,0,1,255,240,254,20,4,78,4,80,0,38,0,34,64,18,13,20,20,25,8,28,5,4,0,27,15,114,32,0,0,7,6,114,0,43,50,47,51,43,17,23,57,50,17,51,48,49,83,50,22,22,23,19,1,51,1,19,30,2,51,50,54,55,21,6,6,35,34,38,38,39,3,1,35,1,3,38,38,35,34,6,7,53,54,54,176,64,82,60,29,150,1,63,177,254,87,195,25,48,64,48,26,46,18,22,58,41,87,112,74,32,154,254,152,178,1,206,177,29,67,51,19,35,14,21,60,4,80,55,105,77,254,133,2,96,253,0,254,18,64,83,41,5,3,129,6,11,64,121,85,1,146,253,96,3,70,1,199,80,87,6,6,131,7,10,0,1,0,163,254,20,5,138,6,18,0,31,0,33,64,18,8,8,24,6,114,17,15,114,30,19,19,1,16,11,114,0,0,114,0,43,43,50,50,17,51,43,43,50,47,48,49,65,17,62,2,53,52,38,39,51,22,22,21,20,2,6,7,17,35,17,46,2,53,17,51,17,20,22,22,23,17,3,89,123,178,97,34,32,165,32,32,147,253,161,162,158,240,134,164,99,167,102,6,18,250,105,10,103,195,147,141,238,139,135,241,136,207,254,253,126,9,254,37,1,219,6,117,247,199,2,32,253,220,154,182,84,7,5,153,0,0,1,0,115,255,236,5,189,4,72,0,48,0,35,64,17,35,35,15,48,23,6,114,12,11,41,41,8,8,30,15,11,114,0,43,50,50,17,51,17,51,51,43,50,18,57,47,48,49,65,30,2,21,20,6,6,35,34,38,39,35,6,6,35,34,38,38,53,52,54,54,55,51,6,2,21,20,22,51,50,54,54,53,17,51,17,20,22,22,51,50,54,54,53,52,2,39,5,67,42,54,26,86,171,128,114,141,33,9,31,143,112,124,173,89,27,54,42,169,64,61,124,106,69,89,43,159,46,89,63,73,104,56,61,65,4,72,94,179,186,107,161,249,140,96,91,91,96,137,247,166,107,186,178,95,144,254,251,163,203,207,70,123,79,1,58,254,198,87,121,64,93,183,134,163,1,5,144,255,255,255,233,255,236,2,147,5,210,6,38,1,133,0,0,1,7,0,106,254,179,0,0,0,12,180,38,26,16,6,114,0,43,206,206,48,49,255,255,0,163,255,236,4,111,5,210,6,38,1,145,0,0,1,6,0,106,33,0,0,12,180,45,33,5,6,114,0,43,206,206,48,49,255,255,0,114,255,236,4,96,6,113,6,38,0,82,0,0,1,6,1,83,20,0,0,10,179,33,14,7,114,0,43,206,48,49,255,255,0,163,255,236,4,111,6,113,6,38,1,145,0,0,1,6,1,83,29,0,0,10,179,24,5,6,114,0,43,206,48,49,255,255,0,115,255,236,5,189,6,113,6,38,1,149,0,0,1,7,1,83,0,192,0,0,0,10,179,49,23,6,114,0,43,206,48,49,255,255,0,200,0,0,3,246,7,65,6,38,0,40,0,0,1,7,0,106,0,33,1,111,0,12,180,33,21,2,2,114,0,43,206,206,48,49,0,1,0,18,255,236,5,65,5,182,0,32,0,33,64,17,16,25,25,0,24,20,20,21,2,114,18,8,114,7,0,9,114,0,43,50,43,43,50,17,51,17,57,47,51,48,49,69,34,38,39,53,22,22,51,50,54,54,53,53,52,38,35,33,17,35,17,33,53,33,21,33,17,33,50,22,21,21,20,6,3,210,47,82,24,31,69,46,50,94,62,122,145,254,128,168,254,172,3,197,254,55,1,142,203,218,206,20,13,10,148,10,10,40,103,94,135,122,119,253,24,5,32,150,150,254,94,189,181,145,201,198,255,255,0,200,0,0,3,253,7,144,6,38,1,96,0,0,1,7,0,118,1,168,1,111,0,10,179,13,5,2,114,0,43,206,48,49,0,1,0,125,255,236,4,226,5,205,0,35,0,25,64,12,5,8,8,20,0,29,3,114,13,20,9,114,0,43,50,43,50,17,57,47,51,48,49,65,34,14,2,7,33,21,33,30,3,51,50,54,55,21,6,6,35,34,36,2,53,52,18,54,36,51,50,22,23,7,38,38,3,65,112,183,135,82,12,2,212,253,39,5,70,131,192,127,102,180,85,80,193,116,235,254,210,145,93,181,1,10,172,128,201,84,69,74,171,5,53,64,127,185,122,148,133,207,143,75,33,25,148,30,29,188,1,83,226,168,1,21,199,108,48,41,146,37,46,0,255,255,0,105,255,236,4,1,5,203,6,6,0,54,0,0,255,255,0,200,0,0,1,114,5,182,6,6,0,44,0,0,255,255,0,6,0,0,2,59,7,65,6,38,0,44,0,0,1,7,0,106,254,208,1,111,0,12,180,13,25,1,2,114,0,43,206,206,48,49,255,255,255,92,254,127,1,106,5,182,6,6,0,45,0,0,0,2,0,1,255,233,7,41,5,182,0,38,0,48,0,31,64,16,39,27,8,114,48,18,18,0,29,16,2,114,7,0,9,114,0,43,50,43,50,17,57,47,51,43,50,48,49,87,34,38,39,53,22,22,51,50,54,54,55,54,54,18,18,55,33,17,51,50,22,22,21,20,4,33,33,17,33,14,4,7,14,2,37,51,50,54,53,52,38,38,35,35,131,35,68,27,23,57,32,62,73,43,17,14,34,38,41,21,2,167,139,208,245,106,255,0,254,239,254,174,254,145,12,25,28,28,27,14,27,76,127,3,132,147,193,183,89,180,136,118,23,14,10,143,10,14,98,157,86,71,209,1,5,1,44,160,253,146,106,186,121,196,231,5,32,89,194,195,187,166,67,139,195,103,169,139,142,99,116,50,0,2,0,200,0,0,7,88,5,182,0,19,0,29,0,35,64,17,7,3,3,29,18,18,0,6,1,2,114,20,16,16,0,8,114,0,43,50,17,51,43,50,17,57,47,51,51,17,51,48,49,115,17,51,17,33,17,51,17,51,50,22,22,21,20,4,33,33,17,33,17,37,51,50,54,53,52,38,38,35,35,200,170,2,130,172,137,208,244,107,255,0,254,241,254,171,253,126,3,46,147,191,183,89,179,136,117,5,182,253,146,2,110,253,146,106,186,121,196,231,2,178,253,78,146,139,142,99,116,50,0,1,0,18,0,0,5,65,5,182,0,19,0,29,64,14,2,18,18,14,3,3,16,19,2,114,9,16,8,114,0,43,50,43,17,57,47,51,50,17,51,48,49,65,21,33,17,33,50,22,21,17,35,17,52,38,35,33,17,35,17,33,53,4,11,254,3,1,151,200,212,169,116,140,254,118,170,254,174,5,182,152,254,94,186,183,253,245,1,247,123,116,253,26,5,30,152,0,255,255,0,200,0,0,4,224,7,144,6,38,1,179,0,0,1,7,0,118,1,224,1,111,0,10,179,18,5,2,114,0,43,206,48,49,255,255,0,22,255,236,4,241,7,122,6,38,1,188,0,0,1,7,2,51,0,56,1,111,0,10,179,34,17,2,114,0,43,206,48,49,0,1,0,200,254,130,5,9,5,182,0,11,0,21,64,10,11,6,2,114,8,2,1,5,8,114,0,43,50,204,51,43,50,48,49,97,33,17,35,17,33,17,51,17,33,17,51,5,9,254,50,175,254,60,170,2,239,168,254,130,1,126,5,182,250,226,5,30,255,255,0,0,0,0,5,13,5,188,6,6,0,36,0,0,0,2,0,200,0,0,4,119,5,182,0,13,0,23,0,25,64,12,5,23,23,0,4,1,2,114,14,0,8,114,0,43,50,43,50,17,57,47,51,48,49,115,17,33,21,33,17,51,50,22,22,21,20,6,33,39,51,50,54,53,52,38,38,35,35,200,3,91,253,79,227,211,238,97,241,254,233,253,235,198,165,80,172,140,206,5,182,150,254,40,104,186,123,202,225,146,139,142,99,116,50,0,255,255,0,200,0,0,4,188,5,182,6,6,0,37,0,0,255,255,0,200,0,0,3,253,5,182,6,6,1,96,0,0,0,2,0,12,254,130,5,74,5,182,0,15,0,23,0,26,64,12,17,15,2,114,10,1,22,22,4,7,6,8,0,63,205,50,51,17,51,51,43,50,48,49,65,17,51,17,35,17,33,17,35,17,51,54,26,2,55,5,33,6,10,2,7,33,4,150,180,163,252,8,163,112,75,131,103,65,9,1,242,254,164,9,62,97,119,66,2,189,5,182,250,226,253,234,1,126,254,130,2,22,128,1,63,1,93,1,96,162,153,124,254,207,254,192,254,218,114,0,255,255,0,200,0,0,3,246,5,182,6,6,0,40,0,0,0,1,0,4,0,0,6,181,5,182,0,17,0,34,64,19,0,9,3,15,12,6,6,1,14,14,11,17,8,114,8,5,1,2,114,0,43,50,50,43,50,50,17,18,23,57,48,49,65,1,51,1,17,51,17,1,51,1,1,35,1,17,35,17,1,35,2,86,253,196,189,2,52,164,2,52,189,253,196,2,81,196,253,190,164,253,189,196,2,240,2,198,253,60,2,196,253,60,2,196,253,59,253,15,2,229,253,27,2,229,253,27,0,1,0,79,255,236,4,59,5,203,0,46,0,31,64,15,4,3,27,27,26,26,11,35,43,3,114,19,11,9,114,0,43,50,43,50,17,57,47,51,18,57,57,48,49,65,20,6,7,21,22,22,21,20,6,4,35,34,38,39,53,30,2,51,50,54,53,52,38,35,35,53,51,50,54,54,53,52,38,35,34,6,7,39,62,2,51,50,22,22,4,29,184,154,180,188,129,254,254,192,119,216,90,62,144,149,68,198,205,237,214,210,203,144,190,95,167,134,139,182,86,82,58,148,180,104,155,212,110,4,95,149,173,26,7,26,180,146,129,195,108,37,43,157,30,44,23,153,139,143,131,143,67,123,84,115,124,71,56,116,42,69,41,93,164,0,0,1,0,202,0,0,5,77,5,182,0,21,0,26,64,14,7,8,18,19,4,0,12,20,8,114,10,0,2,114,0,43,50,43,50,17,23,57,48,49,83,51,17,20,14,2,7,51,1,51,17,35,17,52,62,2,55,35,1,35,202,159,2,4,5,2,8,3,46,187,159,4,5,6,1,9,252,209,188,5,182,252,179,48,113,108,88,24,4,202,250,74,3,67,53,119,112,89,24,251,48,0,255,255,0,202,0,0,5,77,7,122,6,38,1,177,0,0,1,7,2,51,0,214,1,111,0,10,179,26,0,2,114,0,43,206,48,49,0,1,0,200,0,0,4,224,5,182,0,10,0,25,64,13,2,7,10,3,4,9,5,2,114,1,4,8,114,0,43,50,43,50,18,23,57,48,49,97,35,1,17,35,17,51,17,1,51,1,4,224,206,253,96,170,170,2,143,195,253,121,2,230,253,26,5,182,253,60,2,196,253,58,0,1,0,1,255,233,4,216,5,182,0,29,0,21,64,11,3,28,2,114,19,12,9,114,0,8,114,0,43,43,50,43,50,48,49,97,35,17,33,14,3,7,14,2,35,34,38,39,53,22,22,51,50,54,54,55,54,54,18,18,55,33,4,216,170,254,38,14,32,34,34,17,26,77,127,104,35,69,26,23,57,32,63,73,43,16,13,34,38,41,20,3,18,5,32,112,244,242,216,84,139,195,103,14,10,143,10,14,101,156,82,68,208,1,9,1,46,160,255,255,0,200,0,0,6,106,5,182,6,6,0,48,0,0,255,255,0,200,0,0,5,28,5,182,6,6,0,43,0,0,255,255,0,125,255,236,5,188,5,205,6,6,0,50,0,0,255,255,0,200,0,0,5,9,5,182,6,6,1,109,0,0,255,255,0,200,0,0,4,102,5,182,6,6,0,51,0,0,255,255,0,125,255,236,4,203,5,203,6,6,0,38,0,0,255,255,0,18,0,0,4,83,5,182,6,6,0,55,0,0,0,1,0,22,255,236,4,241,5,182,0,29,0,23,64,11,23,16,5,29,17,2,114,12,5,9,114,0,43,50,43,50,18,57,57,48,49,65,1,14,2,35,34,38,39,53,22,22,51,50,54,54,55,1,51,1,30,2,23,51,62,2,55,1,4,241,254,36,62,128,176,135,58,99,39,40,93,52,77,110,84,38,253,204,186,1,160,8,18,18,7,7,6,15,16,6,1,103,5,182,251,220,140,188,94,17,13,169,19,21,47,103,85,4,64,252,207,15,39,41,20,15,40,40,14,3,55,0,255,255,0,105,255,236,5,245,5,203,6,6,1,114,0,0,255,255,0,6,0,0,4,152,5,182,6,6,0,59,0,0,0,1,0,200,254,130,5,184,5,182,0,11,0,23,64,11,10,5,2,114,11,7,7,1,4,8,114,0,43,204,51,17,51,43,50,48,49,101,17,35,17,33,17,51,17,33,17,51,17,5,184,163,251,179,170,2,239,168,150,253,236,1,126,5,182,250,226,5,30,250,224,0,0,1,0,167,0,0,4,195,5,182,0,19,0,29,64,14,17,14,14,2,5,5,0,19,9,2,114,0,8,114,0,43,43,50,17,57,47,51,51,17,51,48,49,97,35,17,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,17,51,4,195,169,117,210,128,207,221,170,129,146,123,195,120,169,2,94,42,52,191,179,2,68,253,212,121,123,45,42,2,201,0,1,0,200,0,0,7,119,5,182,0,11,0,23,64,11,11,7,2,2,114,8,4,4,1,8,114,0,43,50,17,51,43,50,50,48,49,97,33,17,51,17,33,17,51,17,33,17,51,7,119,249,81,170,2,87,170,2,88,172,5,182,250,226,5,30,250,226,5,30,0,1,0,200,254,130,8,12,5,182,0,15,0,27,64,13,14,10,5,2,114,15,11,7,7,1,4,8,114,0,43,204,51,17,51,51,43,50,50,48,49,101,17,35,17,33,17,51,17,33,17,51,17,33,17,51,17,8,12,163,249,95,170,2,74,172,2,75,170,150,253,236,1,126,5,182,250,226,5,30,250,226,5,30,250,224,0,2,0,15,0,0,5,20,5,182,0,13,0,23,0,25,64,12,23,5,5,0,2,3,2,114,14,0,8,114,0,43,50,43,50,17,57,47,51,48,49,97,17,33,53,33,17,51,50,22,22,21,20,6,33,37,51,50,54,53,52,38,38,35,35,1,100,254,171,1,254,239,199,234,103,248,254,249,254,248,245,182,172,84,169,128,218,5,32,150,253,146,107,187,119,196,231,146,139,142,99,116,50,0,0,3,0,200,0,0,5,250,5,182,0,11,0,21,0,25,0,27,64,13,21,3,3,0,23,1,2,114,22,12,0,8,114,0,43,50,50,43,50,17,57,47,51,48,49,115,17,51,17,51,50,22,22,21,20,6,33,37,51,50,54,53,52,38,38,35,35,1,17,51,17,200,170,234,198,234,102,247,254,248,254,255,240,181,171,83,167,127,215,3,222,170,5,182,253,146,107,187,119,196,231,145,140,142,99,115,49,253,78,5,182,250,74,0,0,2,0,200,0,0,4,168,5,182,0,11,0,21,0,23,64,11,21,3,3,0,1,2,114,12,0,8,114,0,43,50,43,17,57,47,51,48,49,115,17,51,17,33,50,22,22,21,20,4,33,37,33,50,54,53,52,38,38,35,33,200,170,1,22,198,239,107,254,254,254,249,254,211,1,27,182,182,90,173,127,254,255,5,182,253,146,107,187,119,196,231,146,139,142,99,116,50,0,1,0,63,255,236,4,140,5,203,0,35,0,25,64,12,30,29,29,7,23,16,9,114,0,7,3,114,0,43,50,43,50,18,57,47,51,48,49,65,34,6,7,39,54,54,51,50,4,22,18,21,20,2,4,35,34,38,39,53,22,22,51,50,62,2,55,33,53,33,46,3,1,218,101,171,69,70,85,214,114,175,1,3,170,84,156,254,199,235,127,177,84,85,177,100,134,203,138,73,3,253,45,2,209,9,78,132,179,5,53,46,32,143,41,44,107,196,254,246,159,237,254,164,190,29,30,148,23,35,74,144,208,134,150,116,183,128,67,0,0,2,0,200,255,236,7,227,5,205,0,23,0,39,0,33,64,18,15,10,10,5,36,20,3,114,13,2,114,12,8,114,28,5,9,114,0,43,50,43,43,43,50,17,57,47,51,48,49,65,20,2,6,6,35,34,36,2,39,33,17,35,17,51,17,33,54,18,36,51,50,4,18,5,20,18,22,51,50,54,18,53,52,2,38,35,34,6,2,7,227,81,162,241,159,208,254,229,149,8,254,154,170,170,1,105,14,151,1,20,201,211,1,31,148,251,167,99,206,160,164,208,98,97,206,163,162,207,100,2,221,169,254,235,200,107,175,1,63,214,253,80,5,182,253,144,196,1,35,160,187,254,174,224,187,254,239,149,148,1,16,186,186,1,14,146,145,254,243,0,0,2,0,46,0,0,4,71,5,182,0,14,0,24,0,29,64,14,3,23,23,0,0,2,16,10,2,114,13,2,8,114,0,43,50,43,50,17,57,47,51,18,57,48,49,65,1,35,1,46,2,53,52,36,33,33,17,35,17,17,35,34,6,6,21,20,22,51,51,2,113,254,132,199,1,153,80,139,85,1,17,1,14,1,145,170,225,121,167,86,184,189,226,2,99,253,157,2,130,25,93,164,128,200,210,250,74,2,99,2,194,56,120,97,139,149,255,255,0,94,255,236,3,203,4,90,6,6,0,68,0,0,0,2,0,118,255,236,4,82,6,30,0,34,0,50,0,44,64,21,46,42,42,22,17,18,18,22,22,7,35,30,11,114,13,8,8,4,7,1,114,0,43,50,50,17,51,43,50,18,57,125,47,51,17,51,17,51,17,51,48,49,83,52,18,54,55,54,36,55,23,14,3,7,14,2,7,51,62,2,51,50,22,22,21,20,6,6,35,34,46,2,1,50,54,54,53,52,38,35,34,6,6,7,20,30,2,118,90,189,149,128,1,8,125,29,63,138,138,122,47,85,123,71,7,12,30,104,144,90,142,190,96,123,222,150,116,183,127,67,1,250,95,137,75,133,146,91,148,102,23,30,74,131,2,146,234,1,75,201,37,35,51,19,146,9,23,25,27,14,23,114,200,152,44,86,57,123,222,149,179,244,123,90,174,252,254,134,80,173,139,174,197,77,106,42,102,192,154,90,0,3,0,175,0,0,4,59,4,72,0,17,0,26,0,35,0,31,64,15,4,3,32,32,22,22,12,31,13,6,114,23,12,10,114,0,43,50,43,50,17,57,47,51,18,57,57,48,49,65,20,6,7,21,22,22,21,20,6,6,35,33,17,33,50,22,22,3,52,38,35,33,17,33,50,54,3,52,38,35,33,17,33,50,54,4,22,120,95,103,149,90,192,154,254,40,1,212,118,181,104,136,147,140,254,231,1,29,138,145,33,114,130,254,221,1,6,135,138,3,53,103,115,20,8,14,119,122,94,144,82,4,72,53,120,253,165,97,86,254,144,85,2,70,78,77,254,197,78,0,0,1,0,175,0,0,3,72,4,72,0,5,0,14,182,2,5,6,114,4,10,114,0,43,43,50,48,49,65,21,33,17,35,17,3,72,254,14,167,4,72,141,252,69,4,72,0,2,0,39,254,133,4,111,4,72,0,14,0,21,0,27,64,12,16,14,6,10,1,21,21,7,4,128,5,10,0,63,26,205,50,51,17,51,51,63,51,48,49,65,17,51,17,35,17,33,17,35,17,51,54,18,18,55,5,33,6,2,2,7,33,3,210,157,161,252,248,159,86,94,124,64,2,1,152,254,252,9,67,110,73,2,7,4,72,252,69,253,248,1,123,254,133,2,8,130,1,54,1,85,174,132,146,254,210,254,239,102,255,255,0,114,255,236,4,19,4,92,6,6,0,72,0,0,0,1,0,4,0,0,5,218,4,72,0,17,0,32,64,18,1,10,16,13,7,4,6,6,17,15,11,6,114,6,3,9,10,114,0,43,50,50,43,50,50,18,23,57,48,49,65,1,1,35,1,17,35,17,1,35,1,1,51,1,17,51,17,1,5,179,254,56,1,239,190,254,32,155,254,33,190,1,239,254,55,183,1,192,155,1,194,4,72,253,235,253,205,2,44,253,212,2,44,253,212,2,51,2,21,253,236,2,20,253,236,2,20,0,0,1,0,67,255,236,3,128,4,92,0,47,0,31,64,15,7,8,34,34,33,33,0,24,16,11,114,41,0,7,114,0,43,50,43,50,18,57,47,51,18,57,57,48,49,65,50,22,22,21,20,6,7,21,30,2,21,20,6,6,35,34,38,38,39,53,22,22,51,50,54,54,53,52,38,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,1,201,123,180,98,108,95,67,109,65,100,204,156,77,138,112,42,70,188,109,84,134,79,70,139,106,147,121,141,168,130,121,90,138,80,59,86,188,4,92,67,128,92,99,118,26,8,18,67,109,81,92,147,84,17,32,22,151,34,52,39,87,71,65,85,41,136,80,95,82,81,37,34,133,38,38,0,1,0,175,0,0,4,100,4,72,0,18,0,23,64,11,15,6,16,8,18,6,114,10,16,10,114,0,43,50,43,50,18,57,57,48,49,65,17,20,14,2,7,1,51,17,35,17,52,54,54,55,1,35,17,1,77,2,4,3,2,2,86,204,155,2,4,1,253,172,205,4,72,253,79,20,63,71,65,21,3,161,251,184,2,160,32,100,97,27,252,96,4,72,255,255,0,175,0,0,4,100,6,11,6,38,1,209,0,0,1,6,2,51,80,0,0,10,179,23,18,6,114,0,43,206,48,49,0,1,0,175,0,0,4,11,4,72,0,10,0,25,64,13,5,10,2,3,7,1,8,6,114,4,7,10,114,0,43,50,43,50,18,23,57,48,49,65,51,1,1,35,1,17,35,17,51,17,3,46,183,254,39,1,255,195,254,14,167,167,4,72,253,239,253,201,2,44,253,212,4,72,253,236,0,1,0,13,255,243,3,229,4,72,0,22,0,21,64,11,3,21,6,114,15,8,11,114,0,10,114,0,43,43,50,43,50,48,49,97,35,17,33,2,2,6,6,35,34,38,39,53,22,22,51,50,62,2,18,55,33,3,229,169,254,179,20,61,91,129,89,27,48,17,13,29,16,45,75,61,48,37,14,2,134,3,189,254,253,254,143,233,109,6,7,126,4,4,75,152,233,1,61,201,0,1,0,174,0,0,5,52,4,72,0,20,0,27,64,14,19,6,10,3,16,20,18,6,114,9,2,16,10,114,0,43,50,50,43,50,18,23,57,48,49,65,17,35,17,52,54,55,35,1,35,1,35,22,22,21,17,35,17,51,1,1,5,52,150,5,4,6,254,148,141,254,157,6,3,3,151,223,1,98,1,103,4,72,251,184,2,202,44,91,46,252,129,3,127,46,91,50,253,60,4,72,252,128,3,128,0,1,0,175,0,0,4,95,4,72,0,11,0,25,64,12,1,8,8,10,4,11,6,114,6,10,10,114,0,43,50,43,50,17,57,47,51,48,49,65,17,33,17,51,17,35,17,33,17,35,17,1,86,2,99,166,166,253,157,167,4,72,254,52,1,204,251,184,1,239,254,17,4,72,255,255,0,114,255,236,4,96,4,92,6,6,0,82,0,0,0,1,0,175,0,0,4,69,4,72,0,7,0,16,183,4,7,6,114,2,6,10,114,0,43,50,43,50,48,49,65,17,35,17,33,17,35,17,4,69,167,253,184,167,4,72,251,184,3,185,252,71,4,72,255,255,0,175,254,22,4,115,4,92,6,6,0,83,0,0,255,255,0,114,255,236,3,146,4,92,6,6,0,70,0,0,0,1,0,41,0,0,3,154,4,72,0,7,0,19,64,9,1,5,5,6,6,114,3,10,114,0,43,43,50,17,51,48,49,65,33,17,35,17,33,53,33,3,154,254,151,164,254,156,3,113,3,187,252,69,3,187,141,0,255,255,0,2,254,19,4,2,4,72,6,6,0,92,0,0,0,3,0,112,254,20,5,71,6,20,0,21,0,30,0,38,0,37,64,20,31,22,22,1,20,7,114,32,9,9,30,12,11,114,10,15,114,0,0,114,0,43,43,43,50,50,17,51,43,50,50,17,51,48,49,65,17,30,2,21,20,6,6,7,17,35,17,46,2,53,52,54,54,55,17,17,14,2,21,20,22,22,23,19,17,62,2,53,52,38,3,44,163,242,134,129,241,169,162,163,241,134,129,242,172,127,164,79,80,164,126,157,126,163,79,182,6,20,254,68,14,141,242,167,164,244,142,14,254,36,1,220,12,141,244,167,167,243,141,13,1,188,253,186,11,106,182,127,127,183,106,12,3,84,252,172,13,108,182,125,190,215,255,255,0,39,0,0,4,9,4,72,6,6,0,91,0,0,0,1,0,175,254,133,4,218,4,72,0,11,0,25,64,12,9,4,6,114,10,6,6,0,128,3,10,114,0,43,26,204,51,17,51,43,50,48,49,65,35,17,33,17,51,17,33,17,51,17,51,4,218,162,252,119,167,2,69,166,153,254,133,1,123,4,72,252,69,3,187,252,67,0,0,1,0,154,0,0,4,44,4,72,0,19,0,29,64,14,7,4,4,12,15,15,10,9,19,6,114,10,10,114,0,43,43,50,17,57,47,51,51,17,51,48,49,65,17,20,22,51,50,54,55,17,51,17,35,17,6,6,35,34,38,53,17,1,64,113,108,104,170,87,166,166,92,178,124,169,185,4,72,254,118,103,98,64,55,1,220,251,184,1,235,59,68,176,150,1,150,0,0,1,0,175,0,0,6,109,4,72,0,11,0,23,64,11,11,8,3,6,114,9,5,5,2,10,114,0,43,50,17,51,43,50,50,48,49,65,17,33,17,51,17,33,17,51,17,33,17,6,109,250,66,166,1,229,167,1,230,4,72,251,184,4,72,252,69,3,187,252,69,3,187,0,0,1,0,175,254,135,7,9,4,72,0,15,0,29,64,14,15,12,7,6,114,13,1,9,9,3,128,6,10,114,0,43,26,204,51,17,51,51,43,50,50,48,49,65,17,51,17,35,17,33,17,51,17,33,17,51,17,33,17,6,108,157,167,250,77,166,1,229,167,1,230,4,72,252,67,253,252,1,121,4,72,252,69,3,187,252,69,3,187,0,0,2,0,38,0,0,5,20,4,72,0,14,0,23,0,25,64,12,16,1,1,11,13,14,6,114,17,11,10,114,0,43,50,43,50,17,57,47,51,48,49,65,17,33,50,22,22,21,20,6,6,35,33,17,33,53,1,33,17,33,50,54,53,52,38,2,38,1,61,147,192,94,90,193,155,254,34,254,166,3,54,254,202,1,56,128,146,137,4,72,254,60,70,138,102,102,150,82,3,187,141,253,176,254,143,89,102,100,78,0,0,3,0,175,0,0,5,118,4,72,0,12,0,21,0,25,0,27,64,13,21,3,3,0,23,1,6,114,22,13,0,10,114,0,43,50,50,43,50,17,57,47,51,48,49,115,17,51,17,33,50,22,22,21,20,6,6,35,37,33,50,54,53,52,38,35,33,1,17,51,17,175,167,1,44,140,181,88,87,185,148,254,223,1,17,124,148,138,129,254,234,3,122,166,4,72,254,60,70,138,102,102,150,82,135,88,103,101,79,254,6,4,72,251,184,0,0,2,0,175,0,0,4,73,4,72,0,12,0,21,0,23,64,11,17,0,0,10,11,6,114,18,10,10,114,0,43,50,43,17,57,47,51,48,49,65,33,50,22,22,21,20,6,6,35,33,17,51,1,52,38,35,33,17,33,50,54,1,86,1,80,140,186,93,91,189,149,254,19,167,2,76,143,128,254,195,1,62,120,150,2,132,70,138,102,102,150,82,4,72,252,254,101,79,254,141,89,0,0,1,0,65,255,236,3,132,4,92,0,31,0,25,64,12,13,12,12,0,17,24,7,114,7,0,11,114,0,43,50,43,50,17,57,47,51,48,49,69,34,38,39,53,22,22,51,50,54,54,55,33,53,33,38,38,35,34,6,7,39,54,54,51,50,22,22,21,20,6,6,1,98,93,137,59,62,142,88,112,161,91,7,253,212,2,42,13,168,164,59,141,56,46,58,161,82,155,234,131,138,245,20,30,28,145,25,36,82,167,125,137,173,167,33,21,136,26,35,116,249,201,191,254,125,0,0,2,0,175,255,236,6,48,4,92,0,22,0,38,0,33,64,18,14,9,9,4,35,19,7,114,12,6,114,11,10,114,27,4,11,114,0,43,50,43,43,43,50,17,57,47,51,48,49,65,20,2,6,35,34,38,38,39,33,17,35,17,51,17,33,62,2,51,50,22,22,5,20,22,22,51,50,54,54,53,52,38,38,35,34,6,6,6,48,115,214,149,139,207,119,9,254,221,166,166,1,37,14,120,204,138,144,213,117,252,242,63,135,108,107,135,63,64,134,107,107,135,64,2,38,179,255,0,135,120,230,165,254,17,4,72,254,52,152,214,114,135,253,178,138,193,101,100,193,139,137,190,99,99,190,0,0,2,0,34,0,0,3,191,4,72,0,14,0,23,0,29,64,14,2,18,18,14,14,1,21,9,6,114,12,1,10,114,0,43,50,43,50,17,57,47,51,18,57,48,49,115,35,1,46,2,53,52,54,51,33,17,35,17,33,1,20,22,51,33,17,33,34,6,228,194,1,60,69,118,73,211,173,1,229,166,254,234,254,248,140,130,1,16,254,211,128,113,1,206,15,73,128,95,158,165,251,184,1,184,1,76,98,95,1,122,103,0,255,255,0,114,255,236,4,19,5,210,6,38,0,72,0,0,1,6,0,106,246,0,0,12,180,53,41,0,7,114,0,43,206,206,48,49,0,1,0,20,254,20,4,67,6,20,0,47,0,41,64,21,24,28,28,21,29,29,39,35,14,14,39,25,0,114,20,10,114,7,0,15,114,0,43,50,43,43,47,51,17,51,17,57,47,51,51,17,51,48,49,65,34,38,39,53,22,22,51,50,54,53,17,52,38,35,34,6,6,21,17,35,17,35,53,51,53,51,21,33,21,33,21,20,6,7,51,62,2,51,50,22,22,21,17,20,6,6,3,46,45,66,25,27,55,32,58,75,124,128,121,145,64,168,155,155,166,1,149,254,107,4,3,9,34,106,135,75,132,177,89,62,123,254,20,15,10,137,10,11,76,98,3,78,137,134,93,179,130,253,230,4,221,124,187,187,124,191,39,79,35,58,79,42,84,177,139,252,173,101,144,76,255,255,0,175,0,0,3,72,6,33,6,38,1,204,0,0,1,7,0,118,1,56,0,0,0,10,179,13,5,6,114,0,43,206,48,49,0,1,0,114,255,236,3,172,4,92,0,32,0,25,64,12,19,22,22,0,15,8,7,114,26,0,11,114,0,43,50,43,50,17,57,47,51,48,49,69,34,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,6,7,33,21,33,30,2,51,50,54,55,21,6,6,2,121,154,234,131,137,239,152,83,157,58,49,57,136,59,109,150,83,11,2,42,253,212,6,78,150,112,90,144,61,58,139,20,120,249,193,200,254,120,32,26,137,23,29,76,151,113,137,123,167,84,36,25,145,28,30,0,255,255,0,103,255,236,3,116,4,92,6,6,0,86,0,0,255,255,0,160,0,0,1,104,5,226,6,6,0,76,0,0,255,255,255,231,0,0,2,28,5,210,6,38,3,175,0,0,1,7,0,106,254,177,0,0,0,12,180,25,13,2,6,114,0,43,206,206,48,49,255,255,255,144,254,20,1,104,5,226,6,6,0,77,0,0,0,2,0,13,255,243,6,73,4,72,0,31,0,40,0,31,64,16,33,1,1,18,13,31,6,114,25,18,11,114,34,11,10,114,0,43,50,43,50,43,50,17,57,47,51,48,49,65,17,33,50,22,22,21,20,6,6,35,33,17,33,2,2,6,6,35,34,38,39,53,22,22,51,50,62,2,18,55,1,35,17,51,50,54,53,52,38,3,162,1,10,141,183,89,89,191,154,254,99,254,243,19,61,91,128,87,30,47,17,11,29,16,45,75,62,48,38,14,3,46,235,238,125,150,142,4,72,254,60,70,138,102,102,150,82,3,187,254,253,254,144,232,109,6,7,124,3,5,75,153,234,1,61,201,253,176,254,143,89,102,100,78,0,2,0,175,0,0,6,172,4,72,0,20,0,29,0,35,64,17,1,18,18,22,13,13,15,20,16,6,114,23,11,11,15,10,114,0,43,50,17,51,43,50,17,57,47,51,51,17,51,48,49,65,17,33,50,22,22,21,20,6,6,35,33,17,33,17,35,17,51,17,33,17,1,35,17,51,50,54,53,52,38,4,5,1,6,144,184,89,87,190,154,254,92,254,0,170,170,2,4,1,151,243,243,126,149,139,4,72,254,58,69,137,102,102,150,82,1,242,254,14,4,72,254,54,1,202,253,176,254,143,89,102,100,78,255,255,0,20,0,0,4,65,6,20,6,6,0,233,0,0,255,255,0,175,0,0,4,11,6,33,6,38,1,211,0,0,1,7,0,118,1,108,0,0,0,10,179,18,8,6,114,0,43,206,48,49,255,255,0,2,254,19,4,2,6,11,6,38,0,92,0,0,1,6,2,51,185,0,0,10,179,34,0,6,114,0,43,206,48,49,0,1,0,175,254,135,4,72,4,72,0,11,0,21,64,10,7,2,6,114,10,9,4,1,10,114,0,43,50,50,204,43,50,48,49,97,33,17,51,17,33,17,51,17,33,17,35,2,47,254,128,167,2,76,166,254,137,162,4,72,252,69,3,187,251,184,254,135,0,1,0,200,0,0,4,12,6,227,0,7,0,16,183,2,0,5,2,114,4,8,114,0,43,43,204,51,48,49,65,17,33,17,35,17,33,17,4,12,253,102,170,2,165,6,227,254,59,250,226,5,182,1,45,0,0,1,0,175,0,0,3,75,5,137,0,7,0,16,183,2,0,5,6,114,4,10,114,0,43,43,204,51,48,49,65,17,33,17,35,17,33,17,3,75,254,11,167,1,250,5,137,254,61,252,58,4,72,1,65,0,255,255,0,30,0,0,7,69,7,144,6,38,0,58,0,0,1,7,0,67,2,85,1,111,0,10,179,48,16,2,114,0,43,206,48,49,255,255,0,24,0,2,6,27,6,33,6,38,0,90,0,0,1,7,0,67,1,192,0,0,0,10,179,49,28,6,114,0,43,206,48,49,255,255,0,30,0,0,7,69,7,144,6,38,0,58,0,0,1,7,0,118,2,237,1,111,0,10,179,48,16,2,114,0,43,206,48,49,255,255,0,24,0,2,6,27,6,33,6,38,0,90,0,0,1,7,0,118,2,87,0,0,0,10,179,49,15,6,114,0,43,206,48,49,255,255,0,30,0,0,7,69,7,65,6,38,0,58,0,0,1,7,0,106,1,96,1,111,0,12,180,63,51,16,2,114,0,43,206,206,48,49,255,255,0,24,0,2,6,27,5,210,6,38,0,90,0,0,1,7,0,106,0,203,0,0,0,12,180,64,52,15,6,114,0,43,206,206,48,49,255,255,0,0,0,0,4,121,7,144,6,38,0,60,0,0,1,7,0,67,0,224,1,111,0,10,179,15,7,2,114,0,43,206,48,49,255,255,0,2,254,19,4,2,6,33,6,38,0,92,0,0,1,7,0,67,0,165,0,0,0,10,179,36,0,6,114,0,43,206,48,49,0,1,0,82,1,220,3,174,2,112,0,3,0,8,177,1,0,0,47,50,48,49,83,53,33,21,82,3,92,1,220,148,148,0,0,1,0,82,1,220,7,174,2,112,0,3,0,8,177,1,0,0,47,50,48,49,83,53,33,21,82,7,92,1,220,148,148,0,255,255,0,82,1,220,7,174,2,112,6,6,2,2,0,0,0,2,255,252,254,61,3,74,255,188,0,3,0,7,0,12,179,1,2,6,5,0,47,51,206,50,48,49,65,33,53,33,53,33,53,33,3,74,252,178,3,78,252,178,3,78,254,61,123,138,122,0,0,1,0,27,3,193,1,66,5,182,0,10,0,14,181,1,0,128,5,2,114,0,43,26,205,57,48,49,83,39,62,2,55,51,14,2,7,39,12,18,56,66,33,122,20,41,34,11,3,193,22,73,167,167,72,77,178,175,71,0,0,1,0,26,3,193,1,65,5,182,0,11,0,14,181,1,5,128,11,2,114,0,43,26,205,57,48,49,65,23,14,2,7,35,62,3,55,1,50,15,18,56,66,33,122,15,31,28,23,8,5,182,22,73,167,166,73,57,130,134,126,54,255,255,0,65,254,248,1,104,0,237,4,7,2,6,0,39,251,55,0,1,0,27,3,193,1,68,5,182,0,10,0,14,181,9,4,128,10,2,114,0,43,26,205,51,48,49,83,30,2,23,35,46,2,39,55,218,10,34,41,21,123,33,67,56,18,14,5,182,71,176,178,76,73,166,167,73,22,0,0,2,0,27,3,193,2,177,5,182,0,10,0,21,0,23,64,10,17,16,16,6,4,128,10,21,2,114,0,43,50,26,204,50,50,17,51,48,49,65,14,2,7,35,39,62,2,55,35,14,2,7,35,39,62,2,55,2,177,21,41,34,10,177,15,18,57,67,34,246,21,41,34,10,176,12,18,55,66,34,5,182,77,179,174,71,22,73,166,167,73,77,179,174,71,22,73,166,167,73,0,2,0,26,3,193,2,176,5,182,0,10,0,22,0,23,64,10,1,12,12,17,5,128,10,22,2,114,0,43,50,26,204,50,51,17,51,48,49,65,23,14,2,7,35,62,2,55,35,23,14,2,7,35,62,3,55,2,161,15,18,56,66,33,125,21,42,34,10,192,14,17,57,66,33,120,15,31,27,23,7,5,182,22,74,167,165,73,76,178,176,71,22,74,167,165,73,57,130,134,126,54,255,255,0,65,254,248,2,215,0,237,4,7,2,10,0,39,251,55,0,1,0,130,0,0,3,143,6,20,0,11,0,23,64,9,4,1,1,7,10,10,3,8,3,0,47,47,18,57,47,51,51,17,51,48,49,65,37,19,35,19,5,53,5,3,51,3,37,3,143,254,160,47,188,45,254,179,1,77,45,188,47,1,96,3,234,29,251,249,4,7,29,165,28,1,161,254,95,28,0,1,0,121,0,0,3,150,6,20,0,21,0,39,64,17,9,0,0,6,3,11,20,20,14,17,3,17,3,17,5,15,5,0,47,47,18,57,57,47,47,17,51,51,17,51,17,51,51,17,51,48,49,65,37,21,37,19,35,19,5,53,5,3,19,5,53,5,3,51,3,37,21,37,19,2,55,1,95,254,161,45,190,44,254,167,1,89,39,39,254,167,1,89,44,190,45,1,95,254,161,38,1,234,27,160,26,254,129,1,127,26,160,27,1,40,1,25,28,161,28,1,128,254,128,28,161,28,254,231,0,1,0,171,1,251,2,87,3,220,0,15,0,8,177,4,12,0,47,51,48,49,83,52,54,54,51,50,22,22,21,20,6,6,35,34,38,38,171,56,97,61,61,97,56,56,97,61,61,97,56,2,236,87,105,48,48,106,86,84,107,50,50,106,255,255,0,150,255,228,5,163,0,233,4,38,0,17,0,0,0,39,0,17,2,17,0,0,0,7,0,17,4,31,0,0,0,7,0,102,255,236,8,248,5,203,0,11,0,23,0,27,0,39,0,51,0,63,0,75,0,44,64,23,64,52,70,58,13,114,40,28,46,34,13,114,26,12,18,6,0,27,27,12,0,5,114,0,43,50,50,47,16,204,50,63,43,50,204,50,43,50,204,50,48,49,65,50,22,21,20,6,35,34,38,53,52,54,23,34,6,21,20,22,51,50,54,53,52,38,37,1,35,1,19,50,22,21,20,6,35,34,38,53,52,54,23,34,6,21,20,22,51,50,54,53,52,38,37,50,22,21,20,6,35,34,38,53,52,54,23,34,6,21,20,22,51,50,54,53,52,38,1,143,150,155,150,155,144,153,146,151,81,76,76,81,84,82,81,3,73,252,213,146,3,43,107,149,156,150,155,145,152,145,152,81,76,76,81,84,82,81,2,109,149,155,149,155,145,152,145,152,82,76,76,82,83,82,81,5,203,239,218,218,243,243,218,218,239,119,169,169,169,172,172,169,168,170,98,250,74,5,182,253,203,239,218,217,243,243,217,218,239,120,168,169,169,171,169,171,168,169,120,239,218,217,243,243,217,218,239,120,168,169,169,171,169,171,168,169,0,1,0,80,3,169,2,4,5,182,0,3,0,10,179,2,1,2,114,0,43,205,48,49,65,51,1,35,1,90,170,254,187,111,5,182,253,243,0,2,0,80,3,169,3,102,5,182,0,3,0,7,0,14,181,7,0,2,6,2,114,0,43,50,206,50,48,49,65,1,51,1,33,1,51,1,1,177,1,11,170,254,186,254,48,1,10,170,254,187,3,169,2,13,253,243,2,13,253,243,0,1,0,79,0,122,2,26,3,197,0,6,0,16,183,4,6,3,0,2,5,1,5,0,47,204,23,57,48,49,83,1,23,1,1,7,1,79,1,84,119,254,225,1,31,119,254,172,2,44,1,153,68,254,159,254,159,69,1,151,0,1,0,77,0,122,2,24,3,197,0,6,0,16,183,4,2,5,1,6,5,0,3,0,47,204,23,57,48,49,83,1,21,1,39,1,1,194,1,86,254,170,117,1,30,254,226,3,197,254,104,27,254,104,69,1,98,1,96,0,255,255,0,150,255,228,3,83,5,182,4,38,0,4,0,0,0,7,0,4,1,207,0,0,0,1,254,132,0,0,2,129,5,182,0,3,0,11,180,2,18,114,0,2,0,63,43,48,49,65,1,35,1,2,129,252,145,142,3,110,5,182,250,74,5,182,0,1,0,114,2,76,2,196,4,234,0,20,0,25,64,10,18,17,9,9,14,4,0,16,16,0,0,47,50,47,16,204,50,51,17,51,51,48,49,65,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,51,23,51,54,54,1,195,127,130,107,81,84,118,96,108,87,16,6,34,122,4,234,115,127,254,84,1,166,82,82,124,118,254,168,2,146,95,52,55,0,1,0,94,0,0,4,35,5,182,0,17,0,32,64,15,1,16,16,4,13,9,12,12,0,8,5,4,114,0,12,0,63,43,50,18,57,47,51,206,50,50,17,51,48,49,97,17,35,53,51,17,33,21,33,17,33,21,33,21,33,21,33,17,1,14,176,176,3,21,253,144,2,73,253,183,1,64,254,192,1,16,124,4,42,150,253,242,149,241,124,254,240,0,0,1,0,70,0,0,4,70,5,201,0,41,0,44,64,21,11,37,37,14,34,18,30,30,15,33,33,25,26,22,22,25,12,7,0,5,114,0,43,50,63,51,17,51,17,57,47,51,51,17,51,206,50,50,17,51,48,49,65,50,22,23,7,38,38,35,34,6,21,21,33,21,33,21,33,21,33,20,6,6,7,33,21,33,53,62,2,53,35,53,51,53,35,53,51,53,52,54,54,2,178,112,176,68,59,64,148,83,115,131,1,156,254,100,1,156,254,98,36,63,43,3,24,252,0,67,93,49,200,200,200,200,85,182,5,201,45,33,131,29,39,126,142,178,124,177,126,92,124,77,22,152,141,13,77,136,100,126,177,124,139,141,200,107,0,3,0,158,255,236,5,223,5,182,0,12,0,21,0,46,0,45,64,22,30,37,11,114,44,45,45,23,42,26,26,46,23,15,9,9,11,14,12,2,114,11,0,47,43,50,18,57,47,51,47,205,51,17,51,17,51,17,51,43,50,48,49,65,32,22,21,20,14,2,35,35,17,35,17,23,35,17,51,50,54,53,52,38,1,21,51,21,35,17,20,22,51,50,54,55,21,6,6,35,34,38,38,53,17,35,53,55,55,1,163,1,13,243,55,126,209,154,64,165,250,85,54,196,190,173,2,147,227,227,56,66,31,79,22,24,86,61,75,107,58,159,161,58,5,182,221,206,95,167,128,72,253,195,5,182,146,253,172,143,164,147,142,254,255,213,128,254,73,81,83,12,7,124,11,19,61,122,93,1,206,77,67,197,0,1,0,52,255,236,4,117,5,202,0,54,0,43,64,21,51,48,48,15,39,24,24,42,21,12,15,15,0,28,35,13,114,7,0,5,114,0,43,50,43,50,17,57,47,51,206,50,50,17,51,17,51,17,51,48,49,65,50,22,23,7,38,38,35,34,14,2,7,33,21,33,6,6,21,20,22,23,33,21,33,30,2,51,50,54,55,21,6,6,35,34,38,38,39,35,53,51,38,38,53,52,54,53,35,53,51,62,2,3,14,102,175,82,70,57,152,80,78,130,100,70,19,1,248,253,251,1,1,1,1,1,206,254,65,23,105,168,115,79,158,64,62,153,97,163,233,143,29,167,152,1,1,2,152,165,25,144,235,5,202,45,47,136,31,50,50,102,153,102,124,20,41,22,21,46,22,124,121,170,90,38,28,149,27,37,126,236,166,124,25,36,27,23,47,14,124,169,249,136,0,4,0,135,255,246,6,4,5,193,0,3,0,15,0,27,0,54,0,37,64,18,48,28,35,42,3,3,35,4,114,25,13,7,19,1,1,7,12,114,0,43,50,47,50,16,204,50,43,50,47,50,16,204,50,48,49,65,1,35,1,1,20,6,35,34,38,53,52,54,51,50,22,5,20,22,51,50,54,53,52,38,35,34,6,1,34,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,50,54,55,21,6,6,5,24,252,213,147,3,43,1,127,173,143,133,175,171,143,134,176,254,19,84,97,93,86,83,96,97,84,253,202,149,197,93,162,101,53,102,38,33,37,87,39,112,110,108,109,53,98,40,39,104,5,182,250,74,5,182,251,152,165,179,178,166,165,179,177,167,107,133,132,108,109,130,130,1,86,164,175,123,154,72,21,15,101,14,17,123,118,118,119,19,16,101,18,20,0,2,0,112,255,236,3,152,5,203,0,35,0,45,0,34,64,19,16,13,32,17,20,43,6,8,39,25,5,114,3,3,0,0,8,13,114,0,43,50,17,51,47,43,50,18,23,57,48,49,101,50,54,55,51,14,2,35,34,38,38,53,53,6,6,7,53,54,54,55,17,52,54,54,51,50,22,21,20,6,6,7,17,20,22,19,52,38,35,34,6,21,17,54,54,2,118,76,105,9,100,5,71,132,99,84,140,84,47,98,48,52,96,45,59,127,101,118,138,100,175,113,82,178,64,64,77,55,128,132,110,97,118,109,155,81,69,154,129,240,17,29,12,113,14,31,16,1,237,86,136,80,157,143,132,219,163,49,254,232,108,122,4,44,96,97,104,89,254,78,67,217,0,4,0,197,0,0,7,193,5,182,0,19,0,23,0,37,0,49,0,38,64,18,44,31,38,24,20,21,13,3,0,9,9,1,2,114,12,12,0,8,0,63,50,47,43,50,47,17,57,57,47,51,222,50,204,50,48,49,115,17,51,1,51,46,2,53,17,51,17,35,1,35,30,2,21,17,33,53,33,21,1,34,38,38,53,52,54,51,50,22,22,21,20,6,39,50,54,53,52,38,35,34,6,21,20,22,197,188,2,174,7,2,7,4,151,184,253,75,8,3,7,5,4,48,2,6,254,252,88,136,77,164,144,88,136,78,166,139,91,84,83,92,91,86,85,5,182,251,61,52,138,137,50,3,74,250,74,4,199,54,140,139,55,252,189,131,131,1,18,80,155,112,167,178,80,153,112,168,179,112,120,115,116,114,114,116,115,120,0,2,0,31,2,229,5,133,5,182,0,20,0,28,0,43,64,21,27,23,23,3,15,12,3,24,7,14,14,0,0,21,24,5,2,2,24,2,114,0,43,50,47,51,16,204,50,17,51,17,51,17,23,57,51,17,51,48,49,65,17,51,19,19,51,17,35,17,52,54,55,35,3,35,3,35,22,22,21,17,33,17,35,53,33,21,35,17,2,146,179,198,204,174,122,4,1,7,211,102,201,8,2,3,253,236,209,2,29,211,2,229,2,209,253,204,2,52,253,47,1,158,23,98,29,253,204,2,52,35,85,20,254,88,2,105,104,104,253,151,255,255,0,79,0,0,5,242,5,205,6,6,1,117,0,0,0,2,0,102,255,221,4,139,4,72,0,25,0,34,0,25,64,12,34,14,14,0,30,9,6,114,18,0,11,114,0,43,50,43,50,18,57,47,51,48,49,69,34,38,2,53,52,62,2,51,50,22,22,21,33,17,22,22,51,50,54,55,23,14,2,19,17,38,38,35,34,6,7,17,2,121,173,237,121,93,156,188,94,151,239,140,252,197,44,161,92,149,177,69,72,48,120,172,172,38,157,106,101,147,47,35,160,1,2,147,148,214,138,66,138,253,175,254,156,47,76,123,111,41,76,127,76,2,139,1,21,40,79,71,46,254,233,0,0,5,0,62,255,241,5,244,5,182,0,3,0,17,0,31,0,56,0,68,0,46,64,25,57,51,39,25,4,63,45,32,18,3,3,32,13,114,13,14,9,3,4,15,1,1,15,4,114,0,43,50,47,16,204,23,57,43,50,47,50,16,204,50,23,57,48,49,115,1,51,1,3,17,52,54,54,55,6,6,7,7,39,37,51,17,1,50,54,53,52,38,39,39,14,2,21,20,22,23,34,38,53,52,54,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,21,20,6,3,54,54,53,52,38,35,34,6,21,20,22,233,3,111,143,252,146,45,2,4,1,22,50,29,110,66,1,12,137,2,240,88,86,91,83,27,48,65,32,86,89,147,158,42,73,46,66,69,165,114,113,160,85,65,83,96,168,132,65,77,78,68,68,77,84,5,182,250,74,2,74,2,54,36,63,61,29,19,42,20,76,94,184,252,148,254,18,76,61,60,82,26,10,21,51,65,41,60,77,107,131,113,57,86,64,23,40,90,78,108,117,109,110,76,100,32,34,112,84,113,137,2,19,24,71,58,56,62,62,56,56,72,0,0,5,0,37,255,241,6,24,5,201,0,3,0,45,0,59,0,84,0,96,0,57,64,30,52,53,67,79,85,5,91,73,60,46,3,3,60,13,114,40,39,20,20,17,17,11,4,33,26,1,1,33,5,114,0,43,50,47,50,16,204,50,57,47,51,18,57,57,43,50,47,50,16,204,50,23,57,48,49,97,1,51,1,3,34,38,39,53,22,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,7,21,22,22,21,20,6,1,50,54,53,52,38,39,39,14,2,21,20,22,23,34,38,53,52,54,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,21,20,6,3,54,54,53,52,38,35,34,6,21,20,22,1,49,3,111,142,252,146,144,75,131,61,68,138,62,108,103,119,108,119,119,104,97,85,64,64,111,55,68,62,140,94,143,146,89,62,81,95,171,3,4,89,85,91,83,27,47,65,33,86,89,146,159,42,74,46,66,69,165,113,113,161,86,65,83,97,168,133,65,77,78,68,68,77,85,5,182,250,74,2,58,27,30,121,33,35,86,76,76,69,106,82,67,65,64,43,35,88,46,54,127,98,83,106,19,7,16,104,83,119,149,254,34,76,61,60,82,26,10,21,51,65,41,60,77,107,131,113,57,86,64,23,40,90,78,108,117,109,110,76,100,32,34,112,84,113,137,2,19,24,71,58,56,62,62,56,56,72,0,5,0,72,255,241,6,22,5,182,0,3,0,34,0,48,0,73,0,85,0,61,64,32,41,42,56,68,74,5,80,62,49,35,3,3,49,13,114,20,21,21,17,17,26,29,29,11,4,22,25,1,1,22,4,114,0,43,50,47,50,16,204,50,57,47,51,51,17,51,17,51,43,50,47,50,16,204,50,23,57,48,49,97,1,51,1,3,34,38,39,53,22,22,51,50,54,53,52,38,35,34,6,7,39,19,33,21,33,7,54,54,51,50,22,21,20,6,1,50,54,53,52,38,39,39,14,2,21,20,22,23,34,38,53,52,54,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,21,20,6,3,54,54,53,52,38,35,34,6,21,20,22,1,42,3,111,142,252,146,116,67,142,44,56,137,56,95,111,110,101,52,77,30,61,33,1,235,254,132,20,26,61,36,137,181,173,2,252,89,85,91,83,26,48,65,33,86,90,147,159,42,74,46,66,69,165,113,113,161,86,65,83,97,168,133,65,78,79,68,68,77,85,5,182,250,74,2,55,29,26,128,33,38,85,91,81,89,17,8,39,1,167,105,234,5,9,143,128,142,157,254,37,76,61,60,82,26,10,21,51,65,41,60,77,107,131,113,57,86,64,23,40,90,78,108,117,109,110,76,100,32,34,112,84,113,137,2,19,24,71,58,56,62,62,56,56,72,0,0,5,0,94,255,241,6,4,5,182,0,3,0,10,0,24,0,48,0,60,0,45,64,24,17,18,31,43,49,5,55,37,25,11,3,3,25,13,114,9,6,4,7,1,1,7,4,114,0,43,50,47,16,204,51,51,43,50,47,50,16,204,50,23,57,48,49,115,1,51,1,3,1,33,53,33,21,1,1,50,54,53,52,38,39,39,14,2,21,20,22,23,34,38,53,52,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,21,20,6,3,54,54,53,52,38,35,34,6,21,20,22,209,3,111,142,252,146,152,1,96,254,54,2,87,254,159,3,126,89,85,90,83,28,48,65,32,86,90,146,159,92,69,66,69,165,113,113,162,86,65,83,96,168,133,65,77,77,68,69,76,83,5,182,250,74,2,74,2,249,115,94,252,242,254,18,76,61,60,82,26,10,21,51,65,41,60,77,107,131,113,86,109,35,40,90,78,108,117,109,110,76,100,32,34,112,84,113,137,2,19,24,71,58,56,62,62,56,56,72,0,0,2,0,101,255,236,4,50,5,200,0,38,0,54,0,31,64,15,52,24,39,39,21,21,0,47,11,19,114,31,0,3,114,0,43,50,43,50,18,57,47,51,17,51,51,48,49,65,50,30,2,21,20,2,14,2,35,34,38,38,53,52,62,3,51,50,22,23,54,54,53,46,2,35,34,6,7,53,62,2,19,34,14,2,21,20,22,51,50,62,2,55,38,38,2,139,121,163,97,42,44,93,145,201,130,135,158,67,36,76,122,172,113,93,145,45,2,2,1,62,123,93,61,141,53,34,91,103,36,94,137,89,43,93,103,83,135,102,68,15,22,122,5,200,85,151,198,114,123,254,247,248,199,117,110,179,105,78,175,168,136,81,90,74,22,49,18,133,179,90,44,35,159,17,27,17,253,169,99,157,176,77,109,143,98,162,197,99,86,119,255,255,0,37,0,0,4,125,5,182,6,6,1,97,0,0,0,1,0,199,254,17,5,33,5,182,0,7,0,14,181,6,1,2,114,4,0,0,47,50,43,50,48,49,83,17,33,17,35,17,33,17,199,4,90,170,252,249,254,17,7,165,248,91,7,13,248,243,0,1,0,74,254,17,4,218,5,182,0,11,0,29,64,13,3,7,7,8,2,0,4,2,114,1,9,9,0,0,47,50,17,51,43,18,57,57,51,17,51,48,49,83,53,1,1,53,33,21,33,1,1,33,21,74,2,121,253,152,4,62,252,175,2,68,253,165,3,169,254,17,105,3,158,3,52,106,150,252,253,252,138,150,0,1,0,103,2,142,4,42,3,22,0,3,0,8,177,1,0,0,47,50,48,49,83,53,33,21,103,3,195,2,142,136,136,0,0,1,0,37,255,242,4,190,6,153,0,8,0,23,64,10,2,3,5,2,3,3,6,0,19,114,0,43,47,57,47,17,57,17,51,48,49,69,1,35,53,33,19,1,51,1,1,241,254,233,181,1,29,238,2,5,137,253,177,14,3,14,133,253,80,5,196,249,89,0,0,3,0,117,1,147,5,45,4,13,0,26,0,38,0,50,0,39,64,19,30,18,18,7,45,27,21,4,4,42,24,24,4,36,10,10,48,4,18,0,63,51,51,17,51,17,51,47,51,18,23,57,51,17,51,48,49,65,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,54,54,51,50,22,23,54,54,51,50,22,5,38,38,35,34,6,21,20,22,51,50,54,37,52,38,35,34,6,7,22,22,51,50,54,5,45,74,133,89,91,154,65,62,153,88,88,135,76,75,135,89,86,154,64,59,156,95,132,163,253,98,52,110,71,83,96,92,88,68,112,2,84,98,82,67,110,55,51,112,70,82,97,2,208,86,145,86,106,116,106,112,80,142,94,88,142,84,105,115,104,113,174,137,101,91,111,82,79,112,93,96,83,109,92,100,98,94,110,0,1,0,9,254,20,2,247,6,20,0,29,0,14,181,22,15,0,114,7,0,0,47,50,43,50,48,49,83,34,38,39,53,22,22,51,50,54,53,17,52,54,54,51,50,22,23,21,38,38,35,34,6,6,21,17,20,6,146,37,74,26,23,65,34,96,83,78,146,100,33,69,23,22,60,32,63,77,34,177,254,20,12,9,136,8,15,130,111,5,28,129,161,75,9,8,139,9,14,60,109,75,250,229,192,172,255,255,0,103,1,142,4,41,4,27,6,39,0,97,0,0,0,200,2,7,0,97,0,0,255,61,0,1,0,103,0,165,4,40,5,2,0,19,0,39,64,17,1,0,0,2,19,19,5,16,15,11,10,10,9,12,12,6,15,0,47,51,51,17,51,51,47,51,16,206,50,50,17,51,51,47,51,48,49,65,23,7,33,21,33,3,33,21,33,3,39,55,33,53,33,19,33,53,33,3,3,123,111,1,25,254,170,131,1,217,253,232,132,122,109,254,232,1,86,127,254,43,2,20,5,2,57,232,135,254,238,135,254,228,55,229,135,1,18,135,255,255,0,103,255,255,4,42,4,221,6,38,0,31,0,5,0,7,2,42,0,0,253,113,255,255,0,103,255,255,4,42,4,221,6,38,0,33,0,5,0,7,2,42,0,0,253,113,0,2,0,108,0,0,4,58,5,193,0,5,0,9,0,25,64,13,4,9,1,7,4,0,8,2,2,114,6,0,8,0,63,50,43,50,18,23,57,48,49,97,1,1,51,1,1,39,9,2,2,47,254,61,1,195,73,1,194,254,62,36,1,66,254,190,254,192,2,223,2,226,253,30,253,33,199,2,24,2,25,253,231,0,0,1,0,217,4,217,3,194,6,11,0,15,0,18,183,15,9,128,12,15,4,1,4,0,47,93,51,26,204,50,48,49,65,14,2,35,34,38,38,39,51,22,22,51,50,54,55,3,194,9,83,160,125,129,157,75,7,156,11,96,108,96,110,11,6,11,101,136,69,67,136,103,110,80,84,106,0,1,1,137,4,205,2,117,6,20,0,12,0,14,180,1,7,12,128,5,0,47,26,205,57,57,48,49,65,21,14,2,7,35,53,62,3,55,2,117,9,46,59,31,91,11,21,20,15,4,6,20,17,39,111,114,46,23,29,76,85,81,33,0,255,255,255,131,254,59,0,125,255,131,4,7,4,113,254,15,0,0,0,1,1,129,4,216,2,125,6,32,0,11,0,14,180,1,11,128,7,6,0,47,51,26,205,50,48,49,65,21,14,2,7,35,53,62,2,55,2,125,16,36,29,6,165,11,47,65,37,6,32,23,34,110,117,44,19,38,111,115,45,0,0,2,0,21,3,84,2,181,6,199,0,10,0,19,0,29,64,13,6,11,11,9,9,4,1,1,3,120,15,7,119,0,63,51,228,57,47,51,51,17,51,17,51,48,49,65,35,21,35,53,33,53,1,51,17,51,33,53,52,54,55,6,6,7,3,2,181,128,142,254,110,1,149,139,128,254,242,3,3,11,61,23,177,4,33,205,205,98,2,68,253,204,207,44,110,49,25,94,34,254,255,0,0,1,0,62,3,66,2,139,6,193,0,30,0,31,64,14,29,28,28,25,25,3,6,6,19,12,120,2,30,119,0,63,51,228,50,57,47,51,51,17,51,17,51,48,49,65,21,33,7,54,54,51,50,22,21,20,6,35,34,38,39,53,22,22,51,50,54,53,52,38,35,34,6,7,39,19,2,98,254,132,19,26,61,36,137,180,172,164,67,140,46,56,138,55,95,112,109,101,54,76,31,60,33,6,193,106,233,5,8,142,128,142,157,28,26,128,33,38,86,90,81,89,16,8,38,1,168,0,0,1,0,58,3,84,2,146,6,193,0,6,0,16,182,5,1,1,6,120,3,119,0,63,228,51,17,51,48,49,83,1,33,53,33,21,1,163,1,97,254,54,2,88,254,158,3,84,2,250,115,94,252,241,0,3,0,52,3,69,2,148,6,208,0,25,0,39,0,51,0,23,64,12,39,26,20,6,46,5,33,12,120,40,0,119,0,63,50,228,50,23,57,48,49,65,50,22,21,20,6,7,22,22,21,20,6,35,34,38,38,53,52,54,54,55,38,38,53,52,54,19,14,2,21,20,22,51,50,54,53,52,38,39,19,34,6,21,20,22,23,54,54,53,52,38,1,101,113,161,86,65,83,97,168,135,97,137,71,42,74,46,66,69,165,84,48,65,33,86,86,89,85,91,83,1,68,77,85,64,65,78,79,6,208,109,110,76,100,32,34,112,84,113,137,59,110,75,57,86,64,23,40,90,78,108,117,254,27,21,51,65,41,60,77,76,61,60,81,27,1,134,62,56,56,72,25,24,71,58,56,62,0,22,0,84,254,129,7,193,5,238,0,5,0,11,0,17,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,83,0,95,0,111,0,120,0,129,0,144,0,39,64,18,18,24,24,44,44,28,28,12,19,7,57,57,53,53,33,33,1,17,0,63,51,17,51,17,51,17,51,63,51,17,51,17,51,17,51,48,49,83,17,33,21,35,21,37,53,33,17,35,53,1,17,51,21,51,21,33,53,51,53,51,17,33,53,33,21,33,53,33,21,1,53,33,21,1,35,17,51,17,35,17,51,1,53,33,21,1,35,17,51,1,53,33,21,51,53,33,21,1,35,17,51,53,35,17,51,1,35,17,51,5,20,6,35,34,38,53,52,54,51,50,22,5,20,22,51,50,54,53,52,38,35,34,6,37,51,50,22,21,20,6,7,21,22,22,21,20,6,35,35,19,51,50,54,53,52,38,35,35,21,21,51,50,54,53,52,38,35,1,34,39,53,22,22,51,50,54,53,17,51,17,20,6,84,1,47,192,5,206,1,48,109,249,0,111,192,5,14,195,109,253,73,1,17,251,225,1,14,254,242,1,14,4,183,109,109,109,109,251,194,1,16,252,48,111,111,2,192,1,16,119,1,17,250,168,111,111,111,111,6,254,109,109,251,159,127,135,135,127,127,135,135,127,254,115,66,69,71,64,64,71,69,66,1,225,172,110,111,46,44,45,62,109,94,207,123,66,46,36,42,47,59,74,49,37,38,52,1,94,48,32,16,32,20,37,49,125,111,4,190,1,48,111,193,193,111,254,208,193,249,2,1,47,194,109,109,194,254,209,109,109,109,109,6,254,111,111,250,168,1,14,2,2,1,15,250,59,109,109,1,166,1,14,4,74,111,111,111,111,252,47,1,16,121,1,15,253,104,1,16,73,135,166,166,135,137,164,164,137,92,105,105,92,92,104,104,201,67,83,49,66,8,8,9,57,69,80,90,1,98,34,32,34,29,227,154,43,37,32,42,254,250,10,102,3,5,36,50,1,146,254,114,101,93,0,0,3,0,84,254,193,7,170,6,20,0,3,0,33,0,45,0,23,64,9,33,37,2,23,15,43,43,2,0,0,47,47,57,47,57,57,18,57,51,48,49,65,9,2,5,53,52,54,55,62,2,53,52,38,35,34,6,6,7,23,54,54,51,50,22,21,20,6,7,6,6,21,21,3,20,22,51,50,54,53,52,38,35,34,6,3,254,3,172,252,84,252,86,3,235,42,67,59,78,39,189,163,57,121,112,46,82,68,127,55,63,62,53,68,76,67,27,81,60,56,83,83,56,60,81,6,20,252,86,252,87,3,169,251,47,50,62,52,47,84,98,67,137,152,27,44,27,178,34,46,58,47,58,71,53,61,113,80,59,254,237,72,63,63,72,76,61,61,255,255,255,144,254,20,2,83,6,32,6,38,3,176,0,0,1,7,1,75,255,96,0,0,0,10,179,17,11,6,114,0,43,206,48,49,255,255,0,26,3,193,1,65,5,182,6,6,2,6,0,0,0,2,0,12,255,236,4,206,6,33,0,59,0,71,0,46,64,21,31,28,28,32,35,5,67,67,8,52,35,52,35,52,0,45,16,9,114,60,0,0,47,50,43,50,17,57,57,47,125,47,17,51,51,17,51,17,51,51,17,51,48,49,65,50,30,2,23,51,21,35,22,22,21,20,2,6,6,35,34,46,2,53,52,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,6,21,20,22,51,50,54,18,53,52,38,39,38,36,38,53,52,54,54,23,34,6,21,20,22,22,23,46,3,2,68,110,172,126,81,18,143,132,2,2,66,135,208,141,105,142,86,37,15,14,38,33,25,51,16,36,35,95,52,97,81,14,15,102,113,124,167,85,2,2,252,254,204,140,74,155,116,93,90,104,232,191,13,61,89,114,6,33,80,153,220,140,139,22,56,30,161,254,238,202,112,58,101,129,70,57,111,99,35,48,38,17,9,118,17,24,104,80,47,107,117,62,93,134,137,1,20,206,24,57,22,3,113,193,121,85,137,80,137,93,82,80,126,73,2,109,170,117,60,0,1,0,0,0,0,4,128,5,195,0,29,0,27,64,15,24,27,0,3,26,28,2,114,26,8,114,16,9,3,114,0,43,50,43,43,18,23,57,48,49,65,62,3,55,62,2,51,50,22,23,21,38,38,35,34,6,7,14,3,7,17,35,17,1,51,2,57,35,75,74,66,26,28,61,77,52,29,44,16,12,32,14,29,57,37,24,78,90,90,37,173,254,33,186,2,206,81,175,168,139,45,49,66,34,8,8,133,3,3,36,65,42,149,189,207,100,253,224,2,47,3,135,0,0,2,0,22,255,236,6,124,4,72,0,27,0,52,0,45,64,23,40,40,17,2,28,28,24,24,26,27,6,114,13,14,36,36,17,11,114,46,10,11,114,0,43,50,43,50,17,51,51,43,50,50,17,51,17,51,17,57,47,48,49,65,21,35,30,2,21,20,6,6,35,34,38,39,35,6,6,35,34,38,53,52,54,54,55,33,53,55,5,33,14,2,21,20,22,51,50,54,53,53,51,21,20,22,22,51,50,54,53,52,38,38,6,124,249,35,51,28,87,171,128,113,143,33,7,34,143,111,186,199,33,58,37,254,236,146,4,56,252,237,33,57,35,123,108,100,100,161,49,90,63,107,120,27,48,4,72,139,79,166,169,85,156,213,109,96,91,91,96,237,241,85,171,166,77,74,65,139,71,163,171,85,195,154,153,119,200,200,87,121,64,157,192,85,169,162,255,255,0,200,0,0,6,106,7,144,6,38,0,48,0,0,1,7,0,118,2,214,1,111,0,10,179,31,9,2,114,0,43,206,48,49,255,255,0,175,0,0,6,194,6,33,6,38,0,80,0,0,1,7,0,118,3,6,0,0,0,10,179,47,33,7,114,0,43,206,48,49,255,255,0,0,253,211,5,13,5,188,6,38,0,36,0,0,0,7,2,83,1,52,0,0,255,255,0,94,253,211,3,203,4,90,6,38,0,68,0,0,1,7,2,83,0,199,0,0,0,16,181,3,2,47,11,1,1,184,255,150,176,86,0,43,52,52,0,2,0,117,253,211,2,53,255,130,0,11,0,23,0,16,180,12,0,192,18,6,0,124,47,51,26,24,204,50,48,49,65,34,38,53,52,54,51,50,22,21,20,6,39,50,54,53,52,38,35,34,6,21,20,22,1,82,97,124,123,98,95,132,130,97,53,67,70,50,52,67,61,253,211,114,101,100,116,116,98,103,114,96,64,55,57,63,63,57,55,64,0,2,0,125,255,236,6,98,6,20,0,28,0,43,0,27,64,13,23,21,17,26,5,40,14,3,114,33,5,9,114,0,43,50,43,50,18,57,57,206,50,48,49,65,20,2,6,6,35,34,38,38,2,53,52,18,36,51,50,22,23,62,2,53,51,23,6,6,7,22,22,5,20,18,22,51,50,54,18,53,16,2,35,34,6,2,5,186,85,169,249,165,171,253,167,82,148,1,44,228,167,253,85,56,58,22,178,14,21,116,125,47,47,251,118,105,219,170,171,216,102,234,252,171,220,106,2,221,169,254,235,199,108,108,200,1,22,169,224,1,82,188,114,102,16,79,118,74,21,125,198,47,88,217,127,186,254,240,148,148,1,16,186,1,26,1,64,146,254,242,0,2,0,114,255,236,5,24,4,240,0,26,0,41,0,27,64,13,20,18,14,24,4,39,11,7,114,31,4,11,114,0,43,50,43,50,18,57,57,206,50,48,49,65,20,6,6,35,34,38,38,53,16,0,51,50,22,23,62,2,53,51,23,14,2,7,22,22,5,20,22,22,51,50,54,54,53,52,38,38,35,34,6,4,96,123,227,157,146,226,127,1,15,235,109,181,65,59,60,20,176,14,16,62,101,76,34,37,252,190,69,147,115,116,146,69,69,146,117,172,158,2,38,180,255,135,135,255,180,1,14,1,40,74,68,19,81,118,72,21,94,146,102,29,65,162,95,140,193,99,100,193,139,138,190,98,217,0,0,1,0,185,255,236,6,120,6,20,0,31,0,29,64,14,7,5,31,31,1,12,17,21,2,114,26,17,9,114,0,43,50,43,18,57,57,51,47,206,50,48,49,65,21,62,2,53,51,23,14,3,7,17,20,6,6,35,32,0,53,17,51,17,20,22,51,50,54,54,53,17,5,26,65,69,27,175,14,12,45,79,124,90,117,244,192,254,235,254,221,171,201,200,134,168,78,5,182,200,11,76,124,83,21,73,129,103,70,16,253,140,155,242,139,1,38,246,3,174,252,75,184,202,97,174,114,3,182,0,0,1,0,163,255,236,5,143,4,242,0,34,0,41,64,21,1,0,28,28,30,6,14,19,6,114,9,10,10,24,24,14,11,114,7,10,114,0,43,43,50,17,51,17,51,43,18,57,57,51,47,204,50,48,49,65,23,14,3,7,17,35,39,35,14,2,35,34,38,38,53,17,51,17,20,22,51,50,54,53,17,51,21,62,2,53,5,129,14,11,45,78,121,88,136,24,9,34,106,134,75,132,178,89,168,124,127,182,149,167,64,66,24,4,242,22,72,132,106,70,10,252,170,154,57,78,39,84,176,138,2,204,253,64,137,135,206,195,2,63,122,12,78,124,80,0,0,1,253,5,4,184,254,115,6,145,0,21,0,21,64,9,6,3,12,19,192,15,4,1,4,0,47,93,26,204,50,57,57,48,49,65,20,6,7,7,35,39,54,54,53,52,38,35,34,6,7,53,54,54,51,50,22,254,115,94,73,9,104,13,77,87,77,59,28,55,18,20,56,39,121,130,5,218,77,85,17,111,173,13,49,49,49,36,5,4,100,6,7,91,255,255,0,200,0,0,3,246,7,144,6,38,0,40,0,0,1,7,0,67,1,21,1,111,0,10,179,18,2,2,114,0,43,206,48,49,255,255,0,202,0,0,5,77,7,144,6,38,1,177,0,0,1,7,0,67,1,194,1,111,0,10,179,28,0,2,114,0,43,206,48,49,255,255,0,114,255,236,4,19,6,33,6,38,0,72,0,0,1,7,0,67,0,234,0,0,0,10,179,38,0,7,114,0,43,206,48,49,255,255,0,175,0,0,4,100,6,33,6,38,1,209,0,0,1,7,0,67,1,61,0,0,0,10,179,25,18,6,114,0,43,206,48,49,0,1,0,52,255,245,7,30,5,182,0,43,0,30,64,16,31,20,20,26,11,42,16,4,0,5,2,114,37,0,9,114,0,43,50,43,18,23,57,51,17,51,48,49,69,38,10,2,39,51,22,26,2,23,51,54,54,55,19,46,2,39,51,22,26,2,23,51,54,18,18,19,51,10,2,7,35,46,3,39,1,1,232,84,150,118,75,9,176,10,67,96,108,50,10,14,49,31,207,12,21,13,2,177,6,67,102,120,58,7,84,126,72,3,178,5,93,172,125,150,51,99,90,74,26,254,224,11,147,1,90,1,125,1,143,200,189,254,147,254,179,254,229,107,58,153,84,2,44,71,148,144,63,176,254,153,254,172,254,215,115,165,1,143,1,208,1,3,254,234,253,244,254,40,199,84,200,213,210,93,252,224,0,1,0,39,0,0,6,14,4,74,0,40,0,31,64,17,40,30,30,35,21,26,9,27,5,11,16,6,114,5,11,10,114,0,43,50,43,18,23,57,51,17,51,48,49,65,6,2,2,7,35,46,2,39,3,35,38,38,2,2,39,51,22,18,18,23,51,62,2,55,19,38,38,39,51,22,18,18,23,51,54,18,18,55,6,14,9,89,160,117,156,42,85,73,26,246,151,64,123,100,64,6,164,12,85,116,57,6,13,35,37,17,155,25,27,3,166,5,70,109,62,8,76,122,77,10,4,74,200,254,138,254,158,170,72,172,179,82,254,7,102,248,1,26,1,50,160,197,254,158,254,220,105,35,71,73,37,1,56,101,219,100,168,254,176,254,198,135,117,1,43,1,91,190,0,2,0,20,0,0,4,252,5,182,0,19,0,29,0,36,64,10,7,10,10,4,1,29,11,11,0,5,184,255,255,180,114,20,0,8,114,0,43,50,43,18,57,47,51,205,50,50,17,51,48,49,97,17,33,53,33,53,51,21,33,21,33,17,51,50,22,22,21,20,6,33,39,51,50,54,53,52,38,38,35,35,1,87,254,189,1,67,172,1,164,254,92,205,209,243,104,249,254,235,235,215,194,176,85,177,137,186,4,83,143,212,212,143,254,245,107,187,119,196,231,145,140,142,98,115,50,0,0,2,0,20,0,0,4,159,5,39,0,19,0,28,0,33,64,16,21,5,5,1,22,14,10,114,16,4,4,19,17,1,6,114,0,43,50,205,51,17,51,43,50,17,57,47,51,48,49,65,21,33,21,33,17,33,50,22,21,20,6,6,35,33,17,35,53,51,53,1,33,17,33,50,54,53,52,38,1,172,1,93,254,163,1,65,220,214,91,194,155,254,33,244,244,1,214,254,206,1,51,128,156,147,5,39,223,139,254,197,156,152,102,150,82,3,189,139,223,252,209,254,143,89,102,100,78,0,0,1,0,200,255,236,7,37,5,203,0,42,0,39,64,21,11,28,28,4,31,31,0,23,16,3,114,8,2,114,7,8,114,36,0,9,114,0,43,50,43,43,43,50,18,57,47,51,51,17,51,48,49,69,34,36,2,39,33,17,35,17,51,17,33,62,3,55,50,22,23,7,38,38,35,34,14,2,7,33,21,33,30,3,51,50,54,55,21,6,6,5,120,222,254,218,149,7,254,154,170,170,1,107,14,103,177,249,159,112,201,81,68,71,163,98,113,180,131,80,14,2,191,253,61,5,69,129,189,124,99,171,84,80,176,20,176,1,61,214,253,81,5,182,253,143,144,237,171,93,1,51,41,145,35,52,66,127,184,119,149,132,207,145,75,33,25,148,30,29,0,1,0,175,255,236,5,175,4,92,0,39,0,38,64,20,22,15,7,114,26,10,10,29,5,5,7,8,6,114,7,10,33,0,11,114,0,43,50,63,43,18,57,47,51,51,17,51,43,50,48,49,69,34,38,38,39,33,17,35,17,51,17,33,62,2,51,50,22,23,7,38,38,35,34,6,6,7,33,21,33,30,2,51,50,54,55,21,6,6,4,135,147,225,133,9,254,209,167,167,1,49,17,140,222,139,83,152,55,48,55,128,59,108,148,81,11,2,30,253,224,6,79,149,110,88,135,60,56,132,20,111,228,174,254,19,4,72,254,51,166,213,102,33,25,137,23,29,75,150,113,142,122,165,84,36,25,145,28,30,0,2,0,0,0,0,5,92,5,182,0,11,0,24,0,35,64,17,4,7,7,12,11,18,18,9,11,2,114,2,6,6,9,8,114,0,43,50,17,51,43,18,57,47,18,57,51,17,51,48,49,65,1,35,1,35,17,35,17,35,1,35,1,23,14,3,7,7,33,39,46,3,3,0,2,92,180,254,236,153,155,154,254,233,175,2,92,81,6,21,25,27,12,80,1,88,88,11,23,22,20,5,182,250,74,2,166,253,90,2,166,253,90,5,182,169,23,65,72,72,30,206,222,29,60,61,63,0,0,2,0,7,0,0,4,106,4,72,0,11,0,23,0,35,64,17,4,7,7,12,11,18,18,9,11,6,114,2,6,6,9,10,114,0,43,50,17,51,43,18,57,47,18,57,51,17,51,48,49,65,1,35,3,35,17,35,17,35,3,35,1,23,35,14,2,7,7,33,39,46,2,2,157,1,205,170,201,114,150,120,197,171,1,204,105,8,10,22,25,15,63,1,22,63,15,28,21,4,72,251,184,1,227,254,29,1,227,254,29,4,72,116,33,63,66,36,161,159,40,73,63,0,0,2,0,200,0,0,7,97,5,182,0,19,0,32,0,48,64,23,26,17,17,12,4,8,8,20,15,12,12,14,19,15,2,114,2,6,6,10,10,14,8,0,63,51,17,51,17,51,43,50,18,57,47,18,57,51,17,51,17,51,17,51,48,49,65,1,35,1,35,17,35,17,35,1,35,1,33,17,35,17,51,17,33,1,23,14,3,7,7,33,39,46,3,5,6,2,91,186,254,237,148,154,151,254,234,181,1,26,254,84,170,170,1,235,1,3,81,7,19,21,25,15,81,1,79,84,12,23,21,19,5,182,250,74,2,172,253,84,2,172,253,84,2,172,253,84,5,182,253,140,2,116,169,30,59,61,65,36,210,220,32,61,59,59,0,2,0,175,0,0,6,14,4,72,0,19,0,31,0,46,64,22,26,17,17,12,4,8,8,21,12,12,14,19,15,6,114,2,6,6,9,9,14,10,0,63,51,17,51,17,51,43,50,17,57,47,57,51,17,51,17,51,17,51,48,49,65,1,35,3,35,17,35,17,35,3,35,19,33,17,35,17,51,17,33,19,23,35,14,2,7,7,33,39,46,2,4,66,1,204,169,203,114,150,114,204,170,206,254,218,163,163,1,99,195,105,7,9,24,27,16,61,1,20,62,15,27,20,4,72,251,184,1,234,254,22,1,234,254,22,1,234,254,22,4,72,254,46,1,210,116,26,69,77,38,142,156,40,71,62,0,2,0,23,0,0,5,175,5,182,0,30,0,33,0,38,64,18,33,2,2,28,28,13,16,16,21,32,30,2,114,8,15,15,21,8,0,63,51,17,51,43,50,17,57,47,51,51,17,51,17,51,48,49,65,21,1,30,2,23,19,35,3,46,2,35,17,35,17,34,6,6,7,3,35,19,62,3,55,1,53,5,33,1,5,42,254,89,135,157,92,35,137,173,137,30,67,117,106,171,105,115,65,30,136,180,137,26,61,90,136,100,254,97,3,190,253,14,1,121,5,182,126,254,11,8,91,163,115,254,54,1,197,98,109,43,253,65,2,191,44,108,98,254,59,1,202,85,134,96,56,6,1,245,126,153,254,57,0,2,0,12,0,0,5,3,4,72,0,29,0,32,0,38,64,18,32,2,2,27,27,13,16,16,21,31,29,6,114,8,15,15,21,10,0,63,51,17,51,43,50,18,57,47,51,51,17,51,17,51,48,49,65,21,1,30,2,23,19,35,3,46,2,35,17,35,17,34,6,6,7,3,35,19,62,2,55,1,53,5,33,1,4,125,254,176,112,124,72,32,130,167,128,27,59,94,83,154,86,94,55,29,130,165,129,33,72,125,110,254,176,3,27,253,183,1,36,4,72,100,254,152,10,77,127,85,254,175,1,74,72,82,35,253,249,2,7,34,83,72,254,182,1,81,83,127,78,11,1,104,100,137,254,191,0,2,0,200,0,0,7,195,5,182,0,35,0,38,0,63,64,31,1,34,34,37,35,35,30,38,2,2,32,32,27,13,16,16,27,27,29,30,2,114,29,8,8,15,15,22,22,28,8,0,63,51,17,51,17,51,63,43,18,57,47,51,17,51,17,51,17,51,17,51,17,51,17,51,51,17,51,48,49,65,21,1,30,2,23,19,35,3,46,2,35,17,35,17,34,6,6,7,3,35,19,54,54,55,33,17,35,17,51,17,33,1,53,5,33,1,7,60,254,90,135,157,91,35,139,168,139,32,71,117,104,172,104,118,67,29,136,178,145,27,57,39,254,62,170,170,2,214,254,103,3,191,253,16,1,121,5,182,126,254,9,7,91,162,115,254,54,1,197,103,106,39,253,67,2,189,45,108,95,254,59,1,209,87,109,31,253,76,5,182,253,148,1,238,126,153,254,55,0,2,0,175,0,0,6,173,4,72,0,35,0,38,0,58,64,28,1,34,34,37,35,35,30,38,2,2,13,13,16,16,32,27,27,28,30,6,114,8,15,15,22,22,28,10,0,63,51,17,51,17,51,43,18,57,47,51,51,17,51,17,51,17,51,17,51,17,51,51,17,51,48,49,65,21,1,30,2,23,19,35,3,46,2,35,17,35,17,34,6,6,7,3,35,19,54,54,55,33,17,35,17,51,17,33,1,53,5,33,1,6,40,254,176,112,124,71,32,130,166,128,27,59,94,83,153,84,96,57,28,130,166,130,20,45,26,254,191,163,163,2,56,254,178,3,27,253,182,1,37,4,72,100,254,150,10,76,126,85,254,175,1,74,71,81,35,253,251,2,5,34,82,71,254,182,1,81,52,85,25,254,13,4,72,254,54,1,102,100,137,254,197,0,0,1,0,64,254,79,4,55,6,209,0,90,0,61,64,29,36,32,32,47,17,16,64,64,55,25,47,61,61,10,43,47,7,0,0,82,84,128,87,78,78,71,10,3,114,0,43,50,50,17,51,26,204,50,50,47,51,47,51,18,57,47,18,57,57,51,18,57,57,17,51,17,51,48,49,65,50,22,23,21,38,38,35,34,6,7,22,22,21,20,6,7,21,22,22,21,20,14,2,7,14,2,21,20,22,51,50,54,54,51,50,22,23,21,38,38,35,34,6,6,35,34,38,38,53,52,54,54,55,54,54,53,52,38,35,35,53,51,50,54,54,53,52,38,35,34,6,7,39,54,54,55,46,2,39,53,51,22,22,23,62,2,3,87,32,50,17,13,38,18,49,111,47,180,191,194,155,180,199,66,137,214,149,114,118,42,75,103,84,127,117,67,86,103,30,22,109,97,64,110,123,86,134,156,66,88,196,162,202,189,243,208,210,205,143,190,95,168,135,124,193,87,83,76,178,111,34,82,79,31,122,50,122,52,40,88,101,6,209,9,5,109,5,6,89,68,23,194,140,149,175,26,7,26,175,147,96,155,111,62,4,4,33,53,35,49,59,7,7,21,17,162,17,33,5,6,67,116,73,80,115,66,5,5,141,142,145,125,143,67,123,84,115,124,71,56,116,52,77,14,41,87,82,30,25,33,109,55,49,93,61,0,0,1,0,27,254,123,3,128,5,77,0,91,0,59,64,28,36,32,32,47,16,17,66,66,55,25,47,63,63,10,43,47,7,0,0,83,85,128,88,79,72,10,6,114,0,43,50,50,50,26,204,50,50,47,51,47,51,18,57,47,18,57,57,51,18,57,57,17,51,17,51,48,49,65,50,22,23,21,38,38,35,34,6,7,22,22,21,20,6,7,21,30,2,21,20,6,6,7,14,2,21,20,22,51,50,54,54,51,50,22,23,21,38,38,35,34,6,6,35,34,38,38,53,52,54,54,55,62,2,53,52,38,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,55,46,2,39,53,51,22,22,23,62,2,2,251,31,50,15,12,38,16,48,103,46,122,141,112,95,67,110,67,98,207,162,105,108,38,73,93,72,130,117,49,68,79,21,25,91,49,47,125,142,73,115,132,54,71,165,140,99,148,81,70,141,106,145,121,143,167,131,120,81,148,80,59,64,121,69,29,70,69,29,121,50,110,56,39,88,102,5,77,8,5,110,5,5,80,62,25,140,107,99,119,26,8,17,65,106,80,92,142,83,4,2,29,49,34,48,47,6,5,21,19,140,20,22,6,6,67,106,59,69,109,67,4,3,38,84,70,65,83,39,137,80,94,82,81,36,35,133,27,36,8,37,79,74,26,25,36,100,56,49,90,58,0,255,255,0,111,0,0,5,238,5,182,6,6,1,116,0,0,255,255,0,163,254,20,5,138,6,18,6,6,1,148,0,0,0,3,0,125,255,236,5,188,5,205,0,17,0,26,0,34,0,25,64,12,31,23,23,5,27,14,3,114,18,5,9,114,0,43,50,43,50,17,57,47,51,48,49,65,20,2,6,6,35,34,38,38,2,53,52,18,36,51,50,4,18,1,50,54,54,55,33,30,2,19,34,6,6,7,33,38,2,5,188,86,169,250,165,170,253,167,83,148,1,45,227,217,1,41,153,253,98,160,212,110,7,252,44,8,109,213,164,158,211,114,11,3,210,17,235,2,221,169,254,235,199,108,108,200,1,22,169,224,1,82,188,186,254,175,252,189,131,245,169,169,244,132,4,184,125,231,160,243,1,17,0,3,0,114,255,236,4,96,4,92,0,14,0,23,0,31,0,25,64,12,27,20,20,4,24,11,7,114,15,4,11,114,0,43,50,43,50,17,57,47,51,48,49,65,20,6,6,35,34,38,38,53,16,0,51,50,22,22,1,50,54,54,55,33,30,2,19,34,6,7,33,46,2,4,96,123,227,157,146,226,127,1,15,235,150,225,125,254,9,108,141,74,6,253,108,6,75,143,106,157,158,14,2,147,9,77,140,2,38,180,255,135,135,255,180,1,14,1,40,134,253,253,157,87,168,120,120,168,87,3,90,176,168,111,153,80,0,1,0,0,0,0,5,70,5,195,0,29,0,23,64,12,0,23,3,114,13,6,7,2,114,6,8,114,0,43,43,18,57,43,50,48,49,65,34,6,6,7,1,35,1,51,1,30,2,23,62,3,55,19,62,2,51,50,22,23,21,38,38,4,227,48,64,53,31,254,180,194,253,239,178,1,88,24,36,29,12,8,21,24,27,16,172,46,81,114,96,35,63,24,24,48,5,54,59,124,100,251,229,5,182,252,67,68,112,99,50,38,80,86,94,51,2,31,148,178,81,14,6,140,8,11,0,1,0,0,0,0,4,62,4,84,0,27,0,23,64,12,19,13,14,6,114,13,10,114,7,0,7,114,0,43,50,43,43,18,57,48,49,65,50,22,23,21,38,38,35,34,6,6,7,1,35,1,51,1,22,22,23,51,54,54,55,19,62,2,3,239,23,39,17,13,37,17,31,46,37,19,254,253,218,254,103,173,1,10,29,41,6,7,9,33,23,151,35,66,93,4,84,6,5,131,5,6,37,76,59,252,219,4,72,253,34,83,126,32,43,141,69,1,208,105,118,47,255,255,0,0,0,0,5,70,7,144,6,38,2,113,0,0,1,7,4,12,4,207,1,111,0,12,180,36,49,7,2,114,0,43,206,206,48,49,255,255,0,0,0,0,4,62,6,33,6,38,2,114,0,0,1,7,4,12,4,98,0,0,0,12,180,34,47,14,6,114,0,43,206,206,48,49,0,3,0,125,254,19,9,156,5,205,0,17,0,33,0,63,0,38,64,22,63,40,41,3,34,58,51,15,45,6,114,34,6,114,30,14,3,114,22,5,9,114,0,43,50,43,50,43,43,63,51,18,23,57,48,49,65,20,2,6,6,35,34,38,38,2,53,52,18,36,51,50,4,18,5,20,18,22,51,50,54,18,53,52,2,38,35,34,6,2,37,51,19,30,2,23,51,54,54,55,19,51,1,14,2,35,34,38,39,53,22,22,51,50,54,54,55,55,5,77,79,155,230,152,156,232,153,75,135,1,20,209,200,1,16,140,251,225,94,195,151,153,192,91,91,192,150,152,196,95,4,114,175,248,21,36,27,9,8,11,54,30,226,175,254,39,38,102,144,101,49,72,27,24,61,35,62,91,67,24,60,2,221,169,254,235,199,108,108,200,1,22,169,224,1,82,188,186,254,175,229,186,254,240,148,148,1,16,186,189,1,13,144,146,254,243,176,253,128,54,102,94,44,50,161,84,2,127,251,23,101,150,81,11,7,133,5,8,47,90,62,154,255,255,0,114,254,19,8,169,4,92,4,38,0,82,0,0,0,7,0,92,4,167,0,0,0,2,0,125,255,140,6,4,6,40,0,29,0,56,0,39,64,19,33,36,30,36,36,3,0,27,9,114,49,46,43,43,15,12,18,3,114,0,43,50,205,51,16,205,51,43,205,51,51,17,51,16,205,48,49,69,34,38,39,46,2,2,53,52,18,36,55,54,54,51,50,22,23,22,22,18,21,20,14,2,7,6,6,3,54,54,51,50,22,23,62,2,53,52,2,39,6,6,35,34,38,39,14,2,21,20,22,22,3,69,54,71,11,141,215,146,74,133,1,1,187,11,71,53,51,71,13,179,254,135,76,145,211,135,13,72,187,17,67,52,47,69,17,130,174,88,199,193,16,70,47,52,67,16,131,178,91,90,178,116,49,56,20,124,195,1,0,151,202,1,57,197,27,56,46,46,56,28,197,254,199,203,151,253,194,125,21,56,49,1,1,45,38,39,44,27,157,247,161,244,1,50,39,46,39,39,45,25,156,246,161,162,248,156,0,2,0,114,255,151,4,193,4,174,0,26,0,51,0,39,64,19,37,34,31,31,20,17,23,7,114,46,49,43,49,49,10,7,4,11,114,0,43,205,51,51,17,51,16,205,43,50,205,51,16,205,51,48,49,65,20,6,6,7,6,6,35,34,38,39,46,2,53,52,18,55,54,54,51,50,22,23,30,2,7,52,38,38,39,6,6,35,34,38,39,6,6,21,20,22,23,54,54,51,50,22,23,54,54,4,193,101,192,135,9,61,52,54,59,9,130,194,107,228,205,8,59,53,51,62,9,131,192,105,172,55,114,89,13,58,49,51,58,11,135,126,126,136,11,58,50,48,60,12,134,124,2,38,157,236,145,23,49,45,44,52,22,143,235,159,235,1,32,34,51,40,40,53,22,146,232,155,113,171,110,20,40,34,35,41,30,212,174,175,216,30,41,33,34,38,31,216,0,3,0,126,255,236,7,169,8,64,0,22,0,41,0,107,0,67,64,35,76,102,9,114,85,92,3,114,12,13,13,19,6,128,22,22,35,24,23,58,51,3,114,105,73,70,70,67,71,71,67,67,42,9,114,0,43,50,17,51,47,17,51,17,51,51,43,50,222,50,204,50,47,26,204,50,51,17,51,43,50,43,50,48,49,65,53,52,62,2,51,50,30,2,51,51,21,35,34,46,2,35,34,6,21,19,53,54,54,53,52,46,2,53,52,54,51,50,22,21,20,6,6,1,34,38,2,53,52,18,54,54,51,50,22,23,7,38,38,35,34,14,2,21,20,18,22,51,50,54,55,17,51,17,22,22,51,50,54,18,53,52,46,2,35,34,6,7,39,54,54,51,50,22,22,18,21,20,2,6,6,35,34,38,39,6,6,2,173,32,60,86,55,60,112,114,128,77,16,20,86,139,115,98,45,57,58,95,59,62,29,39,29,51,42,55,65,53,106,254,222,188,251,125,72,137,193,121,79,151,61,65,47,107,60,86,135,93,48,95,188,139,67,116,52,171,53,119,69,139,187,95,49,93,134,86,61,107,47,65,61,151,79,122,193,136,72,70,141,210,141,108,176,71,72,175,7,74,28,54,81,55,28,36,48,36,119,34,46,34,61,60,254,187,71,18,52,28,20,19,16,27,27,37,37,68,59,53,88,65,249,212,194,1,90,226,168,1,16,193,104,49,42,128,35,41,82,155,221,139,187,254,237,150,49,41,1,190,254,66,43,47,150,1,19,187,139,221,155,82,41,35,128,42,49,104,193,254,240,168,170,254,231,204,111,63,61,61,63,0,0,3,0,119,255,236,6,184,7,0,0,18,0,41,0,103,0,61,64,32,76,98,11,114,83,90,7,114,25,26,26,32,19,128,35,35,0,8,7,58,51,7,114,101,66,70,70,66,66,42,11,114,0,43,50,17,51,47,17,51,43,50,222,50,204,50,47,26,204,50,51,17,51,43,50,43,50,48,49,65,50,22,21,20,6,6,7,53,54,54,53,52,46,2,53,52,54,39,50,30,2,51,51,21,35,34,46,2,35,34,6,21,35,53,52,62,2,3,34,46,2,53,52,18,54,51,50,22,23,7,38,38,35,34,6,21,20,30,2,51,50,54,55,17,51,17,30,2,51,50,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,18,21,20,6,6,35,34,38,39,6,6,3,129,54,66,54,106,78,59,61,29,38,29,49,56,60,112,114,127,76,18,21,87,139,114,98,45,56,58,122,31,60,87,155,109,174,120,64,105,195,135,68,113,49,55,47,86,42,128,135,41,79,113,72,74,109,57,167,38,73,81,50,96,135,71,136,129,40,84,47,56,48,112,69,136,195,105,113,210,144,116,165,53,55,162,6,39,68,58,54,89,64,19,69,20,54,28,20,19,15,25,27,38,37,217,36,46,36,121,35,46,35,59,63,29,54,81,54,27,248,236,75,145,210,134,184,1,0,134,33,27,128,22,26,220,212,98,158,111,59,52,57,1,72,254,186,39,49,23,104,191,131,212,220,26,23,129,27,33,134,255,0,184,179,252,133,83,64,66,81,0,255,255,0,52,255,245,7,30,7,19,6,38,2,93,0,0,1,7,3,137,1,101,1,111,0,10,179,55,5,2,114,0,43,206,48,49,255,255,0,39,0,0,6,14,5,166,6,38,2,94,0,0,1,7,3,137,0,194,0,2,0,10,179,52,16,6,114,0,43,206,48,49,0,1,0,124,254,20,4,226,5,203,0,32,0,19,64,9,16,22,9,114,21,7,0,3,114,0,43,50,47,43,50,48,49,65,50,22,23,7,38,38,35,34,14,2,21,20,18,22,51,50,54,55,17,35,17,34,46,3,53,52,18,54,36,3,74,113,211,84,69,71,170,101,124,198,140,73,112,236,186,47,85,37,170,152,233,169,108,51,96,185,1,10,5,203,45,40,146,34,45,83,157,222,139,183,254,244,146,10,13,253,120,1,216,72,133,186,230,131,165,1,19,201,110,0,0,1,0,114,254,20,3,166,4,92,0,29,0,21,64,11,15,21,11,114,20,15,114,7,0,7,114,0,43,50,43,43,50,48,49,65,50,22,23,7,38,38,35,34,6,6,21,20,22,22,51,50,54,55,17,35,17,34,46,2,53,52,54,54,2,130,81,159,52,48,53,136,60,117,156,78,81,157,114,61,82,38,166,130,200,138,71,137,238,4,92,33,25,139,20,32,93,190,144,147,186,89,23,16,253,115,1,216,67,137,213,145,200,254,120,0,0,1,0,109,255,254,4,110,5,5,0,19,0,12,179,5,12,10,0,0,47,47,57,57,48,49,65,23,3,5,7,37,3,5,7,37,3,39,19,37,55,5,19,37,55,5,3,151,113,186,1,32,65,254,227,210,1,30,63,254,225,185,114,185,254,225,63,1,33,209,254,224,64,1,31,5,5,64,254,190,166,109,166,254,150,168,109,166,254,193,63,1,67,166,109,168,1,108,166,111,168,0,0,8,0,43,254,195,7,191,5,143,0,13,0,27,0,41,0,55,0,69,0,83,0,97,0,111,0,24,64,12,73,17,87,45,3,59,6,31,108,101,38,31,0,47,51,47,51,18,23,57,48,49,65,54,54,51,50,22,23,35,38,38,35,34,6,7,1,54,54,51,50,22,23,35,38,38,35,34,6,7,1,54,54,51,50,22,23,35,38,38,35,34,6,7,1,54,54,51,50,22,23,35,38,38,35,34,6,7,19,54,54,51,50,22,23,35,38,38,35,34,6,7,1,54,54,51,50,22,23,35,38,38,35,34,6,7,19,54,54,51,50,22,23,35,38,38,35,34,6,7,1,54,54,51,50,22,23,35,38,38,35,34,6,7,5,94,5,101,101,97,107,7,76,7,76,52,61,67,7,251,55,5,101,101,97,107,7,76,7,76,52,61,67,7,1,246,5,101,100,98,107,6,75,7,77,52,61,66,8,252,201,5,101,101,97,107,7,76,7,77,51,61,67,7,106,5,101,101,97,107,7,76,7,76,52,61,67,7,4,57,5,101,101,97,107,7,76,7,76,52,61,67,7,119,5,100,102,96,108,7,76,7,77,51,61,67,8,252,183,5,100,101,98,106,7,75,7,77,52,61,66,8,3,180,89,102,106,85,56,35,31,60,252,37,89,102,105,86,56,35,31,60,254,234,88,102,106,84,56,35,32,59,3,10,89,101,105,85,57,34,31,60,1,231,89,102,106,85,56,35,31,60,252,37,89,102,105,86,56,35,31,60,1,244,89,101,106,84,56,35,31,60,3,4,89,101,104,86,56,35,31,60,0,8,0,43,254,127,7,127,5,211,0,9,0,19,0,28,0,37,0,47,0,56,0,66,0,76,0,24,64,12,47,10,25,65,53,4,6,34,70,76,37,34,0,47,51,47,51,18,23,57,48,49,65,23,6,6,7,39,55,62,2,1,23,7,14,2,7,39,54,54,1,22,22,23,21,7,38,38,39,1,23,6,6,7,35,54,54,55,37,23,30,2,23,7,38,38,39,1,22,22,23,7,39,38,38,39,1,30,2,23,21,38,38,39,53,1,6,6,7,35,39,62,2,55,6,119,66,75,163,60,92,2,45,109,115,251,217,92,3,44,109,115,54,65,74,164,254,76,85,192,73,14,76,181,79,4,8,11,19,67,35,92,22,40,10,2,5,17,27,54,51,20,63,46,108,44,252,46,46,107,45,92,17,40,81,31,4,230,51,115,117,53,85,191,74,254,33,21,40,10,130,11,13,38,46,23,4,162,65,45,107,45,92,16,27,55,52,252,1,91,17,26,55,51,21,64,45,108,2,50,22,39,11,130,11,20,66,35,253,164,14,76,181,79,85,192,73,217,2,45,109,114,53,66,74,164,59,4,159,74,164,60,91,2,68,173,80,253,217,12,39,45,24,92,21,40,10,130,3,78,85,191,74,14,51,115,117,53,0,2,0,200,254,130,6,14,7,95,0,23,0,39,0,39,64,19,35,29,128,32,24,7,17,9,19,11,2,114,21,0,2,2,9,8,114,0,43,50,16,206,51,43,50,18,57,57,222,50,26,204,50,48,49,65,19,35,17,52,54,54,55,35,1,35,17,51,17,20,6,6,7,51,1,51,17,51,3,1,34,38,38,39,51,22,22,51,50,54,55,51,14,2,4,181,157,165,5,8,4,9,252,206,187,159,5,6,2,8,3,46,186,196,151,253,147,128,156,73,7,152,10,98,108,95,111,10,157,7,84,161,254,130,1,126,3,67,58,145,142,50,251,50,5,182,252,177,64,145,129,43,4,204,250,224,253,236,7,171,66,136,104,110,79,83,106,101,136,69,0,2,0,175,254,135,5,29,6,11,0,21,0,37,0,39,64,19,33,26,128,30,22,7,16,8,17,10,6,114,19,2,2,0,8,10,114,0,43,206,51,17,51,43,50,18,57,57,222,50,26,205,50,48,49,65,19,35,17,52,54,54,55,1,35,17,51,17,20,6,6,7,1,51,17,51,3,1,34,38,38,39,51,22,22,51,50,54,55,51,14,2,3,237,128,164,2,4,1,253,171,204,158,3,5,3,2,86,204,185,134,254,2,128,156,75,7,154,9,99,107,95,112,10,157,8,83,161,254,135,1,121,2,161,40,96,90,31,252,94,4,72,253,106,42,94,91,40,3,161,252,69,253,250,6,82,67,136,103,110,80,84,106,101,136,69,0,2,0,44,0,0,4,119,5,182,0,19,0,29,0,32,64,15,21,5,18,1,1,15,4,4,14,19,2,114,22,14,8,0,63,51,43,18,57,47,51,51,17,51,206,50,48,49,65,21,33,21,33,17,51,50,22,22,21,20,4,33,33,17,35,53,51,53,1,35,17,51,50,54,53,52,38,38,1,114,1,70,254,186,197,214,252,110,254,248,254,234,254,111,156,156,1,125,211,221,190,185,90,172,5,182,192,148,254,230,105,186,122,202,225,4,98,148,192,252,252,253,223,140,142,98,115,50,0,2,0,29,0,0,4,82,6,20,0,20,0,29,0,32,64,14,19,16,16,1,4,4,15,20,22,5,5,23,15,8,0,63,51,51,47,51,47,18,57,47,51,51,17,51,48,49,65,21,33,21,33,17,33,50,22,22,21,20,6,6,35,33,17,35,53,51,53,1,33,17,33,50,54,53,52,38,1,95,1,39,254,217,1,64,148,193,94,92,195,155,254,32,155,155,1,215,254,208,1,49,129,154,144,6,20,247,127,253,230,70,138,102,102,150,82,4,158,127,247,251,228,254,143,89,102,100,78,0,0,2,0,200,0,0,4,115,5,182,0,16,0,31,0,55,64,27,3,24,24,17,22,23,23,17,6,21,21,17,17,10,5,4,4,10,10,12,31,13,2,114,12,8,114,0,43,43,50,17,57,47,51,17,51,17,51,17,51,17,51,17,51,17,51,17,51,17,51,48,49,65,20,6,7,23,7,39,6,6,35,35,17,35,17,33,32,4,1,51,50,54,55,39,55,23,54,54,53,52,38,35,35,4,115,104,115,117,99,143,52,116,70,187,170,1,139,1,24,1,8,252,255,172,45,78,37,104,106,132,60,67,191,198,204,4,11,119,204,61,155,82,189,14,14,253,193,5,182,221,253,248,5,5,139,80,171,35,121,93,146,143,0,2,0,175,254,22,4,115,4,92,0,29,0,50,0,57,64,30,13,30,30,18,7,114,11,6,114,10,14,114,44,43,43,45,42,42,4,39,39,24,27,27,25,26,26,0,11,114,0,43,50,17,51,50,17,51,50,17,51,51,17,51,51,17,51,43,43,43,50,17,51,48,49,69,34,38,38,39,35,22,22,21,17,35,17,51,23,51,62,2,51,50,18,17,20,6,7,23,7,39,6,6,3,34,6,6,7,21,20,22,22,51,50,54,55,39,55,23,54,54,53,52,38,2,174,87,132,94,31,12,5,7,167,137,24,7,32,93,132,90,205,244,93,84,113,99,128,35,82,70,114,139,64,2,61,141,119,26,48,22,120,104,126,50,49,151,20,46,78,46,44,114,32,254,62,6,50,162,50,83,49,254,230,254,229,171,240,70,156,78,172,13,15,3,228,88,175,131,33,139,192,100,9,8,158,78,165,54,173,120,212,211,0,1,0,46,0,0,4,10,5,182,0,13,0,29,64,14,11,3,3,10,6,6,8,2,13,2,114,8,8,114,0,43,43,50,17,57,47,51,51,17,51,48,49,65,21,33,17,33,21,33,17,35,17,35,53,51,17,4,10,253,104,1,169,254,87,170,154,154,5,182,152,254,0,149,253,119,2,137,149,2,152,0,0,1,0,16,0,0,3,74,4,72,0,13,0,29,64,14,11,3,3,10,6,6,8,2,13,6,114,8,10,114,0,43,43,50,17,57,47,51,51,17,51,48,49,65,21,33,17,33,21,33,17,35,17,35,53,51,17,3,74,254,10,1,91,254,165,166,158,158,4,72,141,254,168,129,254,30,1,226,129,1,229,0,0,1,0,200,254,0,4,222,5,182,0,38,0,31,64,15,3,0,0,10,13,13,30,23,9,6,2,114,5,8,114,0,43,43,50,47,51,57,47,51,51,17,51,48,49,65,34,6,7,17,35,17,33,21,33,17,54,54,51,50,30,2,21,20,14,2,35,34,38,39,53,22,22,51,50,62,2,53,52,38,38,2,51,46,115,32,170,3,77,253,93,39,124,58,164,246,163,82,79,144,199,120,91,129,59,63,125,71,94,144,97,49,117,225,2,143,11,5,253,129,5,182,152,253,242,8,13,92,171,241,150,166,249,166,82,24,25,152,25,24,66,130,191,124,164,224,116,0,0,1,0,175,254,10,3,255,4,72,0,33,0,35,64,18,30,27,27,3,6,6,14,2,33,6,114,32,10,114,21,14,15,114,0,43,50,43,43,50,17,57,47,51,51,17,51,48,49,65,21,33,17,54,54,51,50,22,22,21,20,6,6,35,34,38,39,53,22,22,51,50,54,53,52,38,35,34,6,7,17,35,17,3,85,254,1,35,78,40,172,235,121,116,199,125,77,115,50,47,118,70,134,142,177,184,35,79,35,167,4,72,141,254,179,6,9,122,254,200,196,249,118,30,28,148,25,35,207,211,221,208,9,9,254,39,4,72,0,1,0,4,254,130,6,248,5,182,0,21,0,40,64,22,11,17,8,20,14,1,6,7,21,19,15,2,114,9,4,7,2,7,7,13,8,114,0,43,50,17,51,16,204,51,43,50,50,18,23,57,48,49,65,1,1,51,17,35,17,35,1,17,35,17,1,35,1,1,51,1,17,51,17,1,6,160,253,196,1,219,185,162,101,253,190,164,253,189,196,2,82,253,196,189,2,52,164,2,52,5,182,253,59,253,167,253,234,1,126,2,229,253,27,2,229,253,27,2,240,2,198,253,60,2,196,253,60,2,196,0,0,1,0,4,254,135,6,29,4,72,0,21,0,40,64,22,1,14,17,11,20,8,6,7,21,19,15,6,114,4,9,9,2,7,7,13,10,114,0,43,50,17,51,51,47,204,43,50,50,18,23,57,48,49,65,1,1,51,17,35,17,35,1,17,35,17,1,35,1,1,51,1,17,51,17,1,5,179,254,56,1,115,191,161,96,254,32,155,254,33,190,1,239,254,55,183,1,192,155,1,194,4,72,253,235,254,88,253,252,1,121,2,44,253,212,2,44,253,212,2,51,2,21,253,236,2,20,253,236,2,20,0,255,255,0,79,254,62,4,59,5,203,6,38,1,176,0,0,0,7,3,107,1,92,0,0,255,255,0,67,254,62,3,128,4,92,6,38,1,208,0,0,0,7,3,107,1,7,0,0,0,1,0,200,254,130,5,42,5,182,0,14,0,33,64,17,8,13,1,3,10,14,11,2,114,4,7,2,7,7,10,8,114,0,43,50,17,51,16,204,43,50,18,23,57,48,49,65,1,1,51,17,35,17,35,1,17,35,17,51,17,1,4,196,253,121,2,27,210,163,117,253,96,170,170,2,143,5,182,253,58,253,168,253,234,1,126,2,230,253,26,5,182,253,60,2,196,0,0,1,0,175,254,134,4,63,4,72,0,14,0,31,64,16,3,8,11,3,5,10,6,6,114,12,2,2,0,5,10,114,0,43,206,51,17,51,43,50,18,23,57,48,49,65,17,35,1,17,35,17,51,17,1,51,1,1,51,17,3,160,88,254,14,167,167,1,216,183,254,39,1,131,176,254,134,1,122,2,44,253,212,4,72,253,236,2,20,253,239,254,86,253,249,0,0,2,0,200,0,0,4,224,5,182,0,3,0,14,0,35,64,18,6,11,14,3,9,2,1,2,1,8,13,9,2,114,5,8,8,114,0,43,50,43,50,18,57,57,47,47,17,23,57,48,49,65,35,17,51,1,35,1,17,35,17,51,17,1,51,1,2,111,117,117,2,113,206,253,96,170,170,2,143,195,253,121,1,35,3,168,251,53,2,230,253,26,5,182,253,60,2,196,253,58,0,2,0,175,0,0,4,11,4,72,0,3,0,14,0,35,64,18,9,14,6,3,12,3,2,3,2,11,5,12,6,114,8,11,10,114,0,43,50,43,50,18,57,57,47,47,17,23,57,48,49,65,17,35,17,37,51,1,1,35,1,17,35,17,51,17,2,73,123,1,96,183,254,39,1,255,195,254,14,167,167,3,246,252,105,3,151,82,253,239,253,201,2,44,253,212,4,72,253,236,0,2,0,31,0,0,4,224,5,182,0,3,0,14,0,29,64,15,6,11,14,3,8,0,1,13,9,2,114,5,8,8,114,0,43,50,43,50,206,50,18,23,57,48,49,83,53,33,21,1,35,1,17,35,17,51,17,1,51,1,31,2,29,2,164,206,253,96,170,170,2,143,195,253,121,4,112,150,150,251,144,2,230,253,26,5,182,253,60,2,196,253,58,0,0,1,0,17,0,0,4,11,6,20,0,18,0,41,64,22,18,0,114,11,5,8,3,7,10,10,13,10,114,1,17,17,14,14,4,7,6,114,0,43,206,50,17,51,17,51,43,50,17,18,23,57,43,48,49,65,21,33,21,33,17,1,51,1,1,35,1,17,35,17,35,53,51,53,1,86,1,109,254,147,1,216,183,254,39,1,255,195,254,14,167,158,158,6,20,187,124,253,87,2,20,253,239,253,201,2,44,253,212,4,221,124,187,0,0,1,0,13,0,0,5,116,5,182,0,12,0,27,64,14,4,11,1,3,6,12,8,9,2,114,3,6,8,114,0,43,50,43,50,50,18,23,57,48,49,65,1,1,35,1,17,35,17,33,53,33,17,1,5,89,253,121,2,162,205,253,96,171,254,177,1,250,2,143,5,182,253,58,253,16,2,230,253,26,5,30,152,253,60,2,196,0,0,1,0,38,0,0,4,215,4,72,0,12,0,27,64,14,11,1,4,3,6,12,8,9,6,114,3,6,10,114,0,43,50,43,50,50,18,23,57,48,49,65,1,1,35,1,17,35,17,33,53,33,17,1,4,177,254,39,1,255,193,254,12,163,254,167,1,252,1,218,4,72,253,237,253,203,2,44,253,212,3,191,137,253,236,2,20,0,0,1,0,200,254,130,5,200,5,182,0,15,0,31,64,15,9,4,4,6,12,7,2,114,13,2,2,0,6,8,114,0,43,206,51,17,51,43,50,17,57,47,51,48,49,65,17,35,17,33,17,35,17,51,17,33,17,51,17,51,17,5,37,177,252,254,170,170,3,2,168,172,254,130,1,126,2,177,253,79,5,182,253,145,2,111,250,226,253,234,0,1,0,175,254,135,4,255,4,72,0,15,0,31,64,15,9,4,4,6,12,7,6,114,13,2,2,0,6,10,114,0,43,206,51,17,51,43,50,17,57,47,51,48,49,65,17,35,17,33,17,35,17,51,17,33,17,51,17,51,17,4,90,161,253,157,167,167,2,99,166,160,254,135,1,121,1,239,254,17,4,72,254,52,1,204,252,69,253,250,0,1,0,200,0,0,6,106,5,182,0,13,0,29,64,14,3,12,12,0,8,5,5,1,2,114,10,0,8,114,0,43,50,43,50,17,51,17,57,47,51,48,49,115,17,51,17,33,17,33,21,33,17,35,17,33,17,200,170,3,0,1,248,254,178,170,253,0,5,182,253,145,2,111,152,250,226,2,177,253,79,0,0,1,0,175,0,0,5,185,4,72,0,13,0,29,64,14,3,12,12,0,8,5,5,1,6,114,10,0,10,114,0,43,50,43,50,17,51,17,57,47,51,48,49,115,17,51,17,33,17,33,21,33,17,35,17,33,17,175,167,2,99,2,0,254,166,166,253,157,4,72,254,52,1,204,137,252,65,1,239,254,17,0,0,1,0,200,254,0,8,38,5,182,0,41,0,35,64,17,34,31,31,1,4,4,40,38,41,2,114,36,40,8,114,21,14,0,47,51,43,50,43,50,17,57,47,51,51,17,51,48,49,65,17,54,54,51,50,30,2,21,20,14,2,35,34,38,39,53,22,22,51,50,62,2,53,52,46,2,35,34,6,7,17,35,17,33,17,35,17,4,215,39,117,55,156,237,161,82,78,143,198,120,94,125,60,62,126,70,93,143,97,49,61,119,175,115,48,119,32,168,253,67,170,5,182,253,95,7,7,92,172,242,151,163,246,166,83,26,23,152,23,26,67,130,189,122,124,188,128,65,8,8,253,131,5,29,250,227,5,182,0,1,0,175,254,10,6,171,4,72,0,35,0,37,64,19,28,25,25,1,4,4,34,32,35,6,114,30,34,10,114,19,12,15,114,0,43,50,43,50,43,50,17,57,47,51,51,17,51,48,49,65,17,54,54,51,50,22,22,21,20,6,6,35,34,38,39,53,22,22,51,50,54,53,52,38,35,34,6,7,17,35,17,33,17,35,17,4,30,35,76,36,146,228,132,108,185,118,73,110,46,44,107,66,123,130,168,175,32,77,31,166,253,222,167,4,72,254,38,6,9,117,253,206,196,249,118,30,28,148,25,35,207,211,221,208,10,11,254,42,3,187,252,69,4,72,0,2,0,125,255,172,5,223,5,205,0,61,0,78,0,44,64,21,66,58,58,21,37,30,3,114,49,46,46,21,9,114,75,4,4,18,7,7,15,0,47,51,17,51,51,17,51,43,50,17,51,43,50,18,57,125,47,51,48,49,65,20,6,6,7,22,22,51,50,54,55,21,14,2,35,34,38,39,6,6,35,34,38,38,2,53,52,18,36,51,50,22,23,7,38,38,35,34,14,2,21,20,18,22,51,50,54,55,46,2,53,52,62,2,51,50,22,22,7,52,38,38,35,34,14,2,21,20,22,22,23,62,2,5,181,71,118,70,32,82,50,38,71,28,18,48,54,28,95,158,71,50,129,68,159,245,168,87,140,1,29,217,68,116,37,45,26,102,50,121,175,113,54,121,221,150,29,54,22,58,82,42,55,101,136,81,105,168,98,172,45,88,64,50,75,51,26,45,80,52,70,99,53,2,169,133,225,168,51,17,19,12,10,149,8,12,5,53,47,18,18,105,194,1,15,166,239,1,89,185,21,14,144,10,19,83,159,227,143,198,254,247,133,7,6,68,174,199,104,129,189,125,61,100,223,190,115,167,90,54,99,136,83,100,179,147,55,45,148,186,0,2,0,114,255,198,4,204,4,92,0,55,0,69,0,43,64,21,56,24,24,0,63,17,17,14,14,44,47,11,114,31,34,34,41,7,0,7,114,0,43,50,47,51,17,51,43,50,50,17,51,17,51,17,57,47,51,48,49,65,50,22,23,7,38,38,35,34,6,21,20,22,22,51,50,54,55,38,38,53,52,54,54,51,50,22,22,21,20,6,7,22,22,51,50,54,55,21,6,6,35,34,38,39,6,6,35,34,38,38,53,52,62,2,1,34,6,6,21,20,22,23,54,54,53,52,38,38,2,75,57,81,30,36,22,71,40,164,138,68,148,119,36,54,10,62,79,81,142,91,88,135,76,116,81,21,66,32,29,58,28,24,68,35,73,137,58,43,104,75,161,222,114,59,119,177,1,166,47,66,33,77,55,67,84,30,61,4,92,14,9,136,6,13,230,211,120,189,108,11,4,66,184,123,123,161,78,76,160,126,141,202,57,12,17,7,7,134,8,7,42,37,17,24,149,254,155,130,213,153,82,254,133,56,105,76,107,158,46,44,160,112,73,104,55,0,255,255,0,125,254,62,4,203,5,203,6,38,0,38,0,0,0,7,3,107,2,38,0,0,255,255,0,114,254,62,3,146,4,92,6,38,0,70,0,0,0,7,3,107,1,130,0,0,0,1,0,16,254,130,4,83,5,182,0,11,0,23,64,11,8,4,4,5,2,114,9,0,2,8,114,0,43,206,51,43,50,17,51,48,49,65,17,35,17,33,53,33,21,33,17,51,17,2,144,179,254,51,4,67,254,51,173,254,130,1,126,5,29,153,153,251,123,253,234,0,0,1,0,41,254,135,3,152,4,72,0,11,0,23,64,11,2,10,10,11,6,114,5,3,8,10,114,0,43,50,204,43,50,17,51,48,49,65,21,33,17,51,17,35,17,35,17,33,53,3,152,254,153,159,162,161,254,156,4,72,139,252,206,253,252,1,121,3,189,139,255,255,0,0,0,0,4,121,5,182,6,6,0,60,0,0,0,1,0,0,254,20,3,255,4,72,0,15,0,24,64,13,15,2,8,9,4,1,14,3,6,114,1,15,114,0,43,43,50,18,23,57,48,49,65,35,17,1,51,19,22,22,23,51,54,54,55,19,51,1,2,82,166,254,84,173,240,29,55,10,10,13,51,31,237,174,254,83,254,20,1,233,4,75,253,142,80,172,50,50,170,82,2,114,251,181,0,1,0,0,0,0,4,121,5,182,0,16,0,37,64,18,11,8,5,5,12,3,3,15,2,2,6,16,8,114,10,6,2,114,0,43,50,43,18,57,47,51,51,17,51,51,17,51,51,48,49,97,17,33,53,33,53,1,51,1,1,51,1,21,33,21,33,17,1,232,254,206,1,50,254,24,186,1,131,1,133,183,254,25,1,48,254,208,1,102,150,51,3,135,253,35,2,221,252,129,59,150,254,154,0,1,0,0,254,20,3,255,4,72,0,21,0,33,64,16,1,9,9,4,17,16,8,8,6,21,11,6,114,6,15,114,0,43,43,50,17,57,47,57,57,51,51,17,51,48,49,65,1,33,21,33,17,35,17,33,53,33,1,51,19,22,22,23,51,54,54,55,19,3,255,254,85,1,25,254,229,166,254,227,1,27,254,86,173,236,34,51,13,8,16,54,34,230,4,72,251,184,128,254,148,1,108,128,4,72,253,147,90,152,65,65,157,92,2,102,0,1,0,6,254,130,4,224,5,182,0,15,0,32,64,17,3,6,12,9,4,2,11,7,2,114,13,0,2,2,5,8,114,0,43,50,16,206,51,43,50,18,23,57,48,49,65,17,35,1,1,35,1,1,51,1,1,51,1,1,51,17,4,60,101,254,117,254,111,181,1,231,254,59,189,1,109,1,111,180,254,60,1,132,171,254,130,1,126,2,132,253,124,2,250,2,188,253,185,2,71,253,71,253,155,253,234,0,0,1,0,39,254,134,4,65,4,72,0,15,0,32,64,17,3,12,6,9,4,5,11,7,6,114,13,0,2,2,5,10,114,0,43,50,16,206,51,43,50,18,23,57,48,49,65,17,35,1,1,35,1,1,51,1,1,51,1,1,51,17,3,159,84,254,205,254,203,188,1,141,254,133,190,1,33,1,32,188,254,133,1,45,155,254,134,1,122,1,191,254,65,2,49,2,23,254,90,1,166,253,233,254,92,253,249,0,0,1,0,17,254,130,6,172,5,182,0,15,0,29,64,14,8,4,4,12,5,2,114,13,9,9,0,2,8,114,0,43,206,51,17,51,43,50,50,17,51,48,49,65,17,33,17,33,53,33,21,33,17,33,17,51,17,51,17,6,11,251,174,254,88,4,48,254,35,2,237,169,178,254,130,1,126,5,29,153,153,251,123,5,30,250,226,253,234,0,0,1,0,41,254,135,5,152,4,72,0,15,0,33,64,16,12,5,13,9,9,8,4,4,5,2,10,114,5,6,114,0,0,47,43,43,17,51,17,51,50,17,51,17,51,48,49,65,17,33,17,33,53,33,21,33,17,33,17,51,17,51,17,4,245,252,114,254,194,3,75,254,152,2,66,167,163,254,135,1,121,3,189,139,139,252,208,3,187,252,67,253,252,0,0,1,0,167,254,130,5,111,5,182,0,23,0,33,64,16,22,19,19,7,10,10,6,23,14,2,114,3,1,6,8,114,0,43,50,204,43,50,17,57,47,51,51,17,51,48,49,65,17,51,17,35,17,35,17,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,17,4,195,172,162,179,117,210,128,207,221,170,129,146,123,195,120,5,182,250,226,253,234,1,126,2,94,42,52,191,179,2,68,253,212,121,123,45,42,2,201,0,0,1,0,154,254,133,4,203,4,72,0,23,0,27,64,13,19,10,10,6,23,14,6,114,3,1,6,10,114,0,43,50,204,43,50,17,57,47,51,48,49,65,17,51,17,35,17,35,17,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,17,4,44,159,165,160,92,178,124,169,185,166,113,108,104,170,87,4,72,252,69,253,248,1,123,1,235,59,68,176,150,1,150,254,118,103,98,64,55,1,220,0,0,1,0,167,0,0,4,195,5,182,0,27,0,51,64,25,26,23,23,20,21,21,20,20,9,3,6,6,9,8,8,9,9,1,27,15,2,114,1,8,114,0,43,43,50,18,57,47,51,47,17,51,17,51,17,51,17,51,47,17,51,17,51,48,49,65,17,35,17,6,6,7,17,35,17,34,46,2,53,17,51,17,20,22,51,17,51,17,54,54,55,17,4,195,172,72,146,83,117,113,173,117,59,170,137,155,117,83,151,67,5,182,250,74,2,90,28,44,10,254,202,1,46,46,92,139,93,2,68,253,212,122,122,1,95,254,168,8,42,26,2,205,0,1,0,154,0,0,4,30,4,72,0,28,0,47,64,23,24,21,22,22,21,21,12,6,9,9,12,8,8,12,12,1,28,16,6,114,1,10,114,0,43,43,50,17,57,47,51,47,17,51,17,51,17,51,17,51,47,17,51,48,49,65,17,35,17,6,6,7,21,35,53,6,6,35,34,38,53,17,51,17,20,22,23,17,51,17,54,54,55,17,4,30,167,60,117,69,113,6,12,8,169,179,166,105,103,113,65,120,61,4,72,251,184,1,235,41,58,14,249,235,1,1,178,148,1,152,254,116,101,97,3,1,45,254,223,12,56,41,1,220,0,1,0,201,0,0,4,229,5,182,0,19,0,29,64,14,17,14,14,2,5,5,0,10,19,8,114,0,2,114,0,43,43,50,18,57,47,51,51,17,51,48,49,83,51,17,54,54,51,50,22,21,17,35,17,52,38,35,34,6,7,17,35,201,169,116,221,118,205,223,171,128,147,123,195,119,169,5,182,253,162,43,51,190,179,253,187,2,44,122,123,46,41,253,54,0,255,255,0,175,0,0,4,65,6,20,6,6,0,75,0,0,0,2,0,56,255,236,6,63,5,205,0,41,0,50,0,37,64,18,30,30,36,36,47,47,23,6,6,0,10,18,9,114,42,0,3,114,0,43,50,43,50,18,57,47,51,51,17,51,17,51,47,48,49,65,50,4,18,21,21,33,30,2,51,50,54,54,55,21,6,6,35,34,36,2,39,35,34,38,53,52,54,55,51,6,6,21,20,22,51,51,62,3,23,34,14,2,7,33,52,2,3,235,213,1,6,121,251,214,10,119,226,168,91,157,138,62,85,221,160,217,254,217,159,13,46,112,140,17,11,143,7,14,59,59,32,18,101,163,224,139,104,166,120,70,8,3,117,196,5,205,180,254,189,215,98,172,241,127,23,36,21,155,31,43,167,1,53,213,127,106,41,67,23,16,60,35,52,54,162,249,171,87,152,68,132,192,125,246,1,15,0,2,0,45,255,236,4,220,4,90,0,39,0,47,0,37,64,18,29,29,35,35,43,43,21,6,6,0,9,16,11,114,40,0,7,114,0,43,50,43,50,18,57,47,51,51,17,51,17,51,47,48,49,65,50,22,22,21,21,33,22,22,51,50,54,55,21,6,6,35,34,46,2,39,46,2,53,52,54,55,51,6,6,21,20,22,51,51,62,2,23,34,6,7,33,52,38,38,3,29,142,199,106,253,10,4,181,168,116,155,86,83,164,110,118,191,137,76,4,87,120,61,16,11,136,7,13,56,55,21,18,132,203,120,132,159,13,2,70,59,123,4,90,124,222,148,103,203,192,37,37,145,37,34,69,136,201,131,1,49,97,74,37,64,22,16,58,33,50,55,159,206,100,136,168,161,99,148,82,0,0,2,0,56,254,128,6,63,5,205,0,44,0,53,0,41,64,20,33,33,40,40,50,50,25,6,6,0,21,19,10,18,9,114,45,0,3,114,0,43,50,43,50,205,51,18,57,47,51,51,17,51,17,51,47,48,49,65,50,4,18,21,21,33,30,2,51,50,54,54,55,21,6,6,7,17,35,17,38,38,2,39,35,34,38,53,52,54,55,51,6,6,21,20,22,51,51,62,3,23,34,14,2,7,33,52,2,3,235,213,1,6,121,251,214,10,119,226,168,91,157,138,62,81,198,134,164,181,247,133,12,46,112,140,17,11,143,7,14,59,59,32,15,100,165,226,139,104,166,120,70,8,3,117,188,5,205,179,254,191,213,103,172,241,127,23,36,21,155,30,38,2,254,144,1,117,19,176,1,36,193,127,106,41,67,23,16,60,35,52,54,162,249,171,87,152,68,132,192,125,246,1,15,0,0,2,0,45,254,135,4,220,4,90,0,41,0,49,0,40,64,19,12,12,19,19,45,45,4,29,29,23,41,32,0,39,11,42,23,7,114,0,43,50,63,51,51,205,18,57,47,51,51,17,51,17,51,47,48,49,69,46,2,39,46,2,53,52,54,55,51,6,6,21,20,22,51,51,62,2,51,50,22,22,21,21,33,22,22,51,50,54,55,21,6,6,7,17,35,19,34,6,7,33,52,38,38,2,212,125,181,101,4,87,120,61,16,11,136,7,13,56,55,21,20,131,202,124,142,199,106,253,10,4,181,168,116,155,86,73,145,92,162,69,132,159,13,2,70,59,123,9,19,132,222,153,1,49,97,74,37,64,22,16,58,33,50,55,155,206,104,124,222,148,103,203,192,37,37,145,34,31,2,254,151,5,75,168,161,99,148,82,255,255,0,200,0,0,1,114,5,182,6,6,0,44,0,0,255,255,0,4,0,0,6,181,7,122,6,38,1,175,0,0,1,7,2,51,1,23,1,111,0,10,179,22,1,2,114,0,43,206,48,49,255,255,0,4,0,0,5,218,6,11,6,38,1,207,0,0,1,7,2,51,0,165,0,0,0,10,179,22,11,6,114,0,43,206,48,49,0,1,0,200,254,0,5,19,5,182,0,43,0,41,64,20,42,39,39,4,34,31,31,1,4,4,14,43,37,2,114,36,8,114,21,14,0,47,51,43,43,50,17,57,47,51,51,17,51,17,51,17,51,48,49,65,1,54,50,51,50,30,2,21,20,14,2,35,34,38,39,53,22,22,51,50,62,2,53,52,46,2,35,34,6,7,17,35,17,51,17,54,54,55,1,4,198,253,132,14,25,15,166,248,164,81,83,149,203,120,91,127,61,63,128,81,89,143,101,54,75,138,191,117,73,118,42,170,170,47,105,51,1,189,5,182,253,87,1,88,165,234,147,167,248,164,81,24,25,152,25,24,66,128,190,124,124,185,122,61,18,13,253,159,5,182,253,46,56,124,56,1,230,0,0,1,0,175,254,10,4,40,4,72,0,33,0,35,64,18,22,19,19,27,30,30,24,29,25,6,114,24,10,114,11,4,15,114,0,43,50,43,43,50,18,57,47,51,51,17,51,48,49,101,20,6,6,35,34,38,39,53,22,22,51,50,54,54,53,52,38,38,35,34,6,7,17,35,17,51,17,1,51,1,30,2,4,40,122,204,122,73,111,47,46,110,67,86,131,74,91,173,124,37,93,41,165,165,1,225,185,254,53,153,233,131,61,195,249,119,30,28,145,24,36,92,186,142,146,184,86,13,11,254,59,4,72,253,253,2,3,254,31,2,112,242,0,1,0,1,254,130,5,154,5,182,0,33,0,25,64,13,7,32,2,114,23,16,9,114,2,0,5,8,114,0,43,50,204,43,50,43,50,48,49,101,51,3,35,19,35,17,33,14,3,7,14,2,35,34,38,39,53,22,22,51,50,54,54,55,54,54,18,18,55,33,4,216,194,150,194,158,178,254,38,14,32,34,34,17,26,77,127,104,35,69,26,23,57,32,63,73,43,16,13,34,38,41,20,3,18,152,253,234,1,126,5,32,112,244,242,216,84,139,195,103,14,10,143,10,14,101,156,82,68,208,1,9,1,46,160,0,0,1,0,13,254,135,4,155,4,72,0,26,0,27,64,14,7,25,6,114,19,12,11,114,2,128,0,5,10,114,0,43,50,26,204,43,50,43,50,48,49,101,51,3,35,19,35,17,33,2,2,6,6,35,34,38,39,53,22,22,51,50,62,2,18,55,33,3,227,184,135,169,129,176,254,177,19,61,91,129,88,27,48,17,13,29,16,45,75,60,48,37,13,2,134,141,253,250,1,121,3,189,254,253,254,144,233,109,6,6,127,3,3,75,152,232,1,59,201,0,0,1,0,200,254,0,5,28,5,182,0,24,0,27,64,13,22,17,17,19,24,20,2,114,19,8,114,12,5,0,47,51,43,43,50,17,57,47,51,48,49,65,17,20,2,6,35,34,38,39,53,22,22,51,50,54,53,17,33,17,35,17,51,17,33,17,5,28,135,242,159,97,125,60,61,127,74,190,198,252,254,170,170,3,2,5,182,250,214,224,254,223,139,25,23,151,24,25,244,254,2,41,253,79,5,182,253,145,2,111,0,1,0,175,254,12,4,95,4,72,0,24,0,29,64,15,22,17,17,19,24,20,6,114,19,10,114,12,5,15,114,0,43,50,43,43,50,17,57,47,51,48,49,65,17,20,6,6,35,34,38,39,53,22,22,51,50,54,53,17,33,17,35,17,51,17,33,17,4,95,104,180,114,73,109,44,43,106,64,119,124,253,159,167,167,2,97,4,72,251,222,192,237,109,30,26,148,22,36,182,210,1,201,254,17,4,72,254,52,1,204,0,0,1,0,200,254,130,5,224,5,182,0,15,0,33,64,16,12,7,7,9,15,10,2,114,0,5,5,2,128,9,8,114,0,43,26,204,51,17,51,43,50,17,57,47,51,48,49,101,51,3,35,19,35,17,33,17,35,17,51,17,33,17,51,5,28,196,153,194,159,176,252,254,170,170,3,2,168,152,253,234,1,126,2,177,253,79,5,182,253,145,2,111,0,1,0,175,254,135,5,24,4,72,0,15,0,33,64,16,3,14,14,0,6,1,6,114,7,12,12,9,128,0,10,114,0,43,26,204,51,17,51,43,50,17,57,47,51,48,49,115,17,51,17,33,17,51,17,51,3,35,19,35,17,33,17,175,167,2,99,166,185,135,170,129,175,253,157,4,72,254,52,1,204,252,69,253,250,1,121,1,239,254,17,0,0,1,0,167,254,130,4,195,5,182,0,23,0,34,64,16,21,18,18,6,9,9,1,22,13,2,114,4,2,128,1,8,0,63,26,205,51,43,50,18,57,47,51,51,17,51,48,49,97,35,17,35,17,51,17,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,17,51,4,195,174,162,167,117,210,128,207,221,170,129,146,123,195,120,169,254,130,2,22,1,198,42,52,191,179,2,68,253,212,121,123,45,42,2,201,0,0,1,0,154,254,133,4,44,4,72,0,23,0,34,64,16,22,19,19,7,10,10,2,23,14,6,114,5,3,128,2,10,0,63,26,205,51,43,50,18,57,47,51,51,17,51,48,49,65,17,35,17,35,17,51,17,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,17,4,44,159,163,156,92,178,124,169,185,166,113,108,104,170,87,4,72,251,184,254,133,2,8,1,94,59,68,176,150,1,150,254,118,103,98,64,55,1,220,0,1,0,200,254,130,7,44,5,182,0,29,0,37,64,19,12,27,1,3,9,15,11,2,114,18,21,128,16,21,21,0,9,8,114,0,43,50,50,17,51,26,16,204,43,50,18,23,57,48,49,97,1,35,30,3,21,17,35,17,51,1,51,1,51,17,51,3,35,19,35,17,52,62,2,55,35,1,3,75,254,21,8,4,5,3,2,158,252,1,208,8,1,212,250,194,151,196,161,176,2,3,5,3,8,254,15,5,14,39,95,98,89,33,252,84,5,182,251,64,4,192,250,226,253,234,1,126,3,184,34,91,96,88,31,250,244,0,0,1,0,174,254,135,5,236,4,72,0,24,0,35,64,18,21,12,8,3,18,23,20,6,114,24,4,4,11,1,128,18,10,114,0,43,26,204,51,51,17,51,43,50,18,23,57,48,49,101,3,35,19,35,17,52,54,55,35,1,35,1,35,22,22,21,17,35,17,51,1,1,51,17,5,236,135,170,130,159,5,4,6,254,148,141,254,157,6,3,3,151,223,1,98,1,103,222,141,253,250,1,121,2,202,44,91,46,252,129,3,127,46,91,50,253,60,4,72,252,128,3,128,252,69,0,255,255,0,200,0,0,1,114,5,182,6,6,0,44,0,0,255,255,0,0,0,0,5,13,7,122,6,38,0,36,0,0,1,7,2,51,0,62,1,111,0,10,179,23,5,2,114,0,43,206,48,49,255,255,0,94,255,236,3,203,6,11,6,38,0,68,0,0,1,6,2,51,241,0,0,10,179,45,0,7,114,0,43,206,48,49,255,255,0,0,0,0,5,13,7,65,6,38,0,36,0,0,1,7,0,106,0,52,1,111,0,12,180,40,28,5,2,114,0,43,206,206,48,49,255,255,0,94,255,236,3,203,5,210,6,38,0,68,0,0,1,6,0,106,232,0,0,12,180,62,50,0,7,114,0,43,206,206,48,49,255,255,255,254,0,0,6,129,5,182,6,6,0,136,0,0,255,255,0,94,255,236,6,125,4,92,6,6,0,168,0,0,255,255,0,200,0,0,3,246,7,122,6,38,0,40,0,0,1,7,2,51,0,41,1,111,0,10,179,16,2,2,114,0,43,206,48,49,255,255,0,114,255,236,4,19,6,11,6,38,0,72,0,0,1,6,2,51,254,0,0,10,179,36,0,7,114,0,43,206,48,49,0,2,0,120,255,236,5,94,5,205,0,28,0,37,0,25,64,12,24,34,34,9,29,19,9,114,0,9,3,114,0,43,50,43,50,18,57,47,51,48,49,65,34,6,6,7,53,62,2,51,50,4,22,18,21,20,2,6,6,35,34,36,2,53,53,33,46,2,3,50,54,54,55,33,20,22,22,2,161,90,161,142,64,59,133,164,104,171,1,5,176,90,84,166,243,159,214,254,247,123,4,51,10,119,224,120,139,205,119,10,252,130,83,185,5,55,23,37,22,156,21,34,21,106,199,254,234,172,171,254,236,197,106,181,1,79,232,68,170,241,128,251,74,121,230,166,164,232,121,0,255,255,0,106,255,236,4,12,4,92,6,6,3,115,0,0,255,255,0,120,255,236,5,94,7,65,6,38,2,206,0,0,1,7,0,106,0,116,1,111,0,12,180,59,47,9,3,114,0,43,206,206,48,49,255,255,0,106,255,236,4,12,5,210,6,38,3,115,0,0,1,6,0,106,223,0,0,12,180,53,41,0,7,114,0,43,206,206,48,49,255,255,0,4,0,0,6,181,7,65,6,38,1,175,0,0,1,7,0,106,1,15,1,111,0,12,180,39,27,1,2,114,0,43,206,206,48,49,255,255,0,4,0,0,5,218,5,210,6,38,1,207,0,0,1,7,0,106,0,156,0,0,0,12,180,39,27,11,6,114,0,43,206,206,48,49,255,255,0,79,255,236,4,59,7,65,6,38,1,176,0,0,1,7,0,106,255,246,1,111,0,12,180,68,56,43,3,114,0,43,206,206,48,49,255,255,0,67,255,236,3,128,5,210,6,38,1,208,0,0,1,6,0,106,136,0,0,12,180,69,57,0,7,114,0,43,206,206,48,49,0,1,0,73,255,236,4,49,5,182,0,29,0,37,64,18,1,28,28,29,26,2,2,25,24,24,9,29,2,114,16,9,9,114,0,43,50,43,18,57,47,51,51,17,51,17,51,17,51,48,49,65,21,1,4,4,21,20,6,4,35,34,38,39,53,22,22,51,50,54,54,53,52,38,38,35,35,53,1,33,53,3,248,254,7,1,7,1,43,127,254,255,195,119,211,91,94,224,105,133,178,89,104,199,145,134,1,229,253,82,5,182,134,254,16,9,203,203,128,198,111,37,43,157,46,51,70,134,95,94,121,59,139,1,222,152,0,1,0,29,254,20,3,169,4,72,0,30,0,35,64,17,1,29,29,30,27,2,2,25,25,10,30,6,114,17,10,15,114,0,43,50,43,18,57,47,51,17,51,17,51,17,51,48,49,65,21,1,30,2,21,20,6,6,35,34,38,39,53,22,22,51,50,54,54,53,52,38,38,35,35,53,1,33,53,3,117,254,51,148,231,134,131,239,163,120,188,67,68,196,118,108,162,90,105,191,131,115,1,203,253,138,4,72,121,253,253,8,107,199,147,145,221,125,38,33,153,32,53,84,157,107,116,147,69,116,2,0,141,0,255,255,0,202,0,0,5,77,6,208,6,38,1,177,0,0,1,7,1,76,1,160,1,111,0,10,179,24,0,2,114,0,43,206,48,49,255,255,0,175,0,0,4,100,5,97,6,38,1,209,0,0,1,7,1,76,1,26,0,0,0,10,179,21,18,6,114,0,43,206,48,49,255,255,0,202,0,0,5,77,7,65,6,38,1,177,0,0,1,7,0,106,0,205,1,111,0,12,180,43,31,0,2,114,0,43,206,206,48,49,255,255,0,175,0,0,4,100,5,210,6,38,1,209,0,0,1,6,0,106,72,0,0,12,180,40,28,18,6,114,0,43,206,206,48,49,255,255,0,125,255,236,5,188,7,65,6,38,0,50,0,0,1,7,0,106,0,204,1,111,0,12,180,54,42,14,3,114,0,43,206,206,48,49,255,255,0,114,255,236,4,96,5,210,6,38,0,82,0,0,1,6,0,106,24,0,0,12,180,42,54,14,7,114,0,43,206,206,48,49,255,255,0,125,255,236,5,188,5,205,6,6,2,111,0,0,255,255,0,114,255,236,4,96,4,92,6,6,2,112,0,0,255,255,0,125,255,236,5,188,7,36,6,38,2,111,0,0,1,7,0,106,0,204,1,82,0,12,180,56,44,14,3,114,0,43,206,206,48,49,255,255,0,114,255,236,4,96,5,210,6,38,2,112,0,0,1,6,0,106,22,0,0,12,180,53,41,11,7,114,0,43,206,206,48,49,255,255,0,63,255,236,4,140,7,36,6,38,1,198,0,0,1,7,0,106,255,210,1,82,0,12,180,57,45,7,3,114,0,43,206,206,48,49,255,255,0,65,255,236,3,132,5,210,6,38,1,230,0,0,1,7,0,106,255,91,0,0,0,12,180,53,41,24,7,114,0,43,206,206,48,49,255,255,0,22,255,236,4,241,6,208,6,38,1,188,0,0,1,7,1,76,1,23,1,111,0,10,179,32,17,2,114,0,43,206,48,49,255,255,0,2,254,19,4,2,5,97,6,38,0,92,0,0,1,7,1,76,0,130,0,0,0,10,179,32,0,6,114,0,43,206,48,49,255,255,0,22,255,236,4,241,7,65,6,38,1,188,0,0,1,7,0,106,0,68,1,111,0,12,180,51,39,17,2,114,0,43,206,206,48,49,255,255,0,2,254,19,4,2,5,210,6,38,0,92,0,0,1,6,0,106,175,0,0,12,180,51,39,0,6,114,0,43,206,206,48,49,255,255,0,22,255,236,4,241,7,144,6,38,1,188,0,0,1,7,1,82,1,73,1,111,0,12,180,37,50,17,2,114,0,43,206,206,48,49,255,255,0,2,254,19,4,2,6,33,6,38,0,92,0,0,1,7,1,82,0,181,0,0,0,12,180,37,50,0,6,114,0,43,206,206,48,49,255,255,0,167,0,0,4,195,7,65,6,38,1,192,0,0,1,7,0,106,0,98,1,111,0,12,180,41,29,9,2,114,0,43,206,206,48,49,255,255,0,154,0,0,4,44,5,210,6,38,1,224,0,0,1,6,0,106,14,0,0,12,180,41,29,19,6,114,0,43,206,206,48,49,0,1,0,200,254,130,4,10,5,182,0,9,0,21,64,10,2,9,2,114,5,128,3,8,8,114,0,43,50,26,204,43,50,48,49,65,21,33,17,51,17,35,17,35,17,4,10,253,104,170,161,179,5,182,152,251,122,253,234,1,126,5,182,0,0,1,0,175,254,135,3,70,4,72,0,9,0,21,64,10,2,9,6,114,5,128,3,8,10,114,0,43,50,26,204,43,50,48,49,65,21,33,17,51,17,35,17,35,17,3,70,254,16,159,165,161,4,72,139,252,206,253,252,1,121,4,72,0,255,255,0,200,0,0,5,250,7,65,6,38,1,196,0,0,1,7,0,106,1,24,1,111,0,12,180,47,35,1,2,114,0,43,206,206,48,49,255,255,0,175,0,0,5,118,5,210,6,38,1,228,0,0,1,7,0,106,0,189,0,0,0,12,180,47,35,1,6,114,0,43,206,206,48,49,255,255,0,46,254,113,4,10,5,182,6,38,2,136,0,0,0,7,3,108,0,146,0,0,0,1,0,16,254,113,3,74,4,72,0,31,0,34,64,16,17,14,14,22,25,25,13,21,18,6,114,7,0,26,13,10,0,63,51,204,50,43,50,18,57,47,51,51,17,51,48,49,65,34,38,39,53,22,22,51,50,54,54,53,53,35,17,35,53,51,17,33,21,33,17,33,21,33,17,51,17,20,6,6,1,5,37,62,20,17,53,31,31,44,23,167,158,158,2,156,254,10,1,91,254,165,151,50,102,254,113,17,7,139,7,12,23,49,37,146,1,226,129,1,229,141,254,168,129,254,159,254,246,84,117,61,0,1,0,6,254,113,4,208,5,182,0,29,0,36,64,19,20,23,17,14,4,15,21,18,2,114,7,0,13,24,13,13,15,8,114,0,43,50,17,51,16,204,50,43,50,17,23,57,48,49,65,34,38,39,53,22,22,51,50,54,54,53,53,35,1,1,35,1,1,51,1,1,51,1,1,51,17,20,6,6,3,236,38,62,19,17,52,31,31,43,23,99,254,117,254,111,181,1,231,254,59,189,1,109,1,111,180,254,60,1,134,153,49,101,254,113,17,7,139,7,12,23,49,37,146,2,132,253,124,2,250,2,188,253,185,2,71,253,71,253,155,254,223,84,117,61,0,1,0,39,254,113,4,59,4,72,0,29,0,35,64,18,14,17,23,20,4,15,21,18,6,114,7,0,13,24,13,13,15,10,0,63,51,17,51,16,204,50,43,50,18,23,57,48,49,65,34,38,39,53,22,22,51,50,54,54,53,53,35,1,1,35,1,1,51,1,1,51,1,1,51,17,20,6,6,3,85,37,62,20,17,53,31,31,44,23,90,254,205,254,203,188,1,141,254,133,190,1,33,1,32,188,254,133,1,50,144,50,101,254,113,17,7,139,7,12,23,49,37,146,1,191,254,65,2,49,2,23,254,90,1,166,253,233,254,80,254,246,84,117,61,0,0,1,0,5,0,0,4,152,5,182,0,17,0,33,64,16,4,0,0,13,9,17,17,2,12,14,8,114,5,2,2,114,0,43,50,43,50,17,57,47,51,51,51,17,51,48,49,83,33,1,51,1,1,51,1,33,21,33,1,35,1,1,35,1,33,129,1,51,254,116,189,1,109,1,110,181,254,113,1,57,254,190,1,187,193,254,117,254,111,182,1,188,254,192,3,78,2,104,253,183,2,73,253,152,150,253,72,2,132,253,124,2,184,0,0,1,0,39,0,0,4,9,4,72,0,17,0,37,64,18,7,1,1,10,4,2,13,17,17,2,12,14,10,114,5,2,6,114,0,43,50,43,50,17,57,47,57,18,57,51,51,17,51,48,49,83,33,1,51,1,1,51,1,33,21,33,1,35,1,1,35,1,33,118,1,14,254,181,190,1,33,1,32,188,254,179,1,19,254,233,1,102,190,254,205,254,203,188,1,98,254,237,2,117,1,211,254,90,1,166,254,45,129,254,12,1,191,254,65,1,244,0,0,2,0,126,0,0,4,46,5,182,0,11,0,21,0,23,64,11,14,8,8,0,9,2,114,12,0,8,114,0,43,50,43,18,57,47,51,48,49,97,32,38,53,52,54,54,51,51,17,51,17,37,51,17,35,34,6,6,21,20,22,2,146,254,226,246,107,241,199,227,170,254,129,213,214,131,171,83,180,209,194,121,199,120,2,107,250,74,146,2,37,64,124,91,142,128,255,255,0,114,255,236,4,53,6,20,6,6,0,71,0,0,0,2,0,125,255,236,6,109,5,182,0,30,0,43,0,35,64,18,31,29,8,29,8,29,19,30,2,114,40,19,11,114,4,13,11,114,0,43,50,43,50,43,18,57,57,47,47,17,51,48,49,65,17,20,22,51,50,54,53,17,51,17,20,6,35,34,38,39,6,6,35,34,38,38,53,52,62,2,51,51,17,17,35,34,6,6,21,20,22,22,51,50,54,53,4,0,120,110,103,120,168,197,194,125,159,44,49,166,132,148,202,104,65,139,218,153,154,155,132,178,89,64,128,95,143,124,5,182,251,183,124,114,124,119,1,222,254,25,168,213,91,81,76,95,95,187,138,99,161,117,62,2,110,252,252,59,128,104,90,121,61,139,95,0,0,2,0,112,255,236,6,132,6,20,0,38,0,51,0,43,64,23,38,0,114,33,39,39,29,8,8,23,29,7,114,19,45,45,23,11,114,4,15,11,114,0,43,50,43,50,17,51,43,18,57,47,17,51,17,51,43,48,49,65,17,20,22,51,50,54,53,17,51,17,20,14,2,35,34,38,38,39,14,2,35,34,2,17,16,18,51,50,22,22,23,51,38,38,53,17,1,34,6,21,20,22,51,50,54,55,53,52,38,4,25,94,134,115,108,168,51,98,145,94,102,128,75,25,39,102,145,103,205,244,243,197,85,125,89,30,13,4,7,254,206,148,145,143,151,169,137,2,133,6,20,251,131,136,153,134,138,1,54,254,186,99,148,97,48,50,91,61,57,92,55,1,27,1,23,1,27,1,35,46,77,49,31,107,35,1,183,253,188,224,212,211,211,198,197,32,209,222,0,1,0,76,255,236,6,123,5,203,0,53,0,35,64,17,7,8,38,38,37,21,37,21,0,17,26,9,114,46,0,3,114,0,43,50,43,50,18,57,57,47,47,51,18,57,57,48,49,65,50,22,22,21,20,6,7,21,30,2,23,30,3,51,50,54,53,17,51,17,20,6,35,34,46,2,39,52,46,2,35,35,53,51,50,54,54,53,52,38,35,34,6,7,39,62,2,2,31,148,204,107,183,142,113,156,82,1,1,27,55,89,62,119,111,166,208,188,92,150,108,58,1,56,108,158,102,201,196,133,178,90,159,127,121,180,78,85,55,144,171,5,203,93,163,106,151,175,25,8,17,91,146,101,74,106,67,31,125,136,1,202,254,38,198,196,47,99,156,109,79,112,71,33,138,69,126,84,115,124,72,53,114,42,69,41,0,1,0,79,255,236,5,195,4,92,0,51,0,37,64,18,7,8,38,38,37,20,37,20,37,0,16,27,11,114,45,0,7,114,0,43,50,43,50,17,57,57,47,47,17,51,18,57,57,48,49,65,50,22,22,21,20,6,7,21,30,2,23,30,2,51,50,54,53,17,51,17,20,14,2,35,34,46,2,39,46,2,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,1,181,118,177,98,105,89,67,99,59,5,4,47,96,79,110,109,164,47,95,143,96,94,143,97,52,5,5,65,128,100,144,119,133,156,123,115,79,140,78,55,81,168,4,92,67,128,92,99,118,26,8,13,63,100,72,65,94,51,133,136,1,55,254,185,99,148,98,48,42,83,123,81,68,86,41,136,80,95,82,81,37,34,133,38,38,0,1,0,76,254,130,4,212,5,203,0,40,0,32,64,15,8,7,26,26,23,23,0,15,12,17,8,33,0,3,114,0,43,50,63,51,206,18,57,47,51,18,57,57,48,49,65,50,22,22,21,20,6,7,21,22,22,21,17,51,17,35,17,35,17,52,46,2,35,35,53,51,50,54,54,53,52,38,35,34,6,7,39,62,2,2,46,151,209,110,190,149,177,191,179,162,181,61,119,171,110,205,211,140,188,94,166,135,127,189,82,85,56,147,177,5,203,93,163,106,151,173,26,7,26,179,147,254,252,253,234,1,126,1,156,71,104,67,32,138,69,126,84,113,126,73,52,114,42,69,41,0,0,1,0,79,254,135,4,26,4,90,0,38,0,32,64,15,7,8,25,25,23,23,0,16,13,18,10,32,0,7,114,0,43,50,63,51,206,18,57,47,51,18,57,57,48,49,65,50,22,22,21,20,6,7,21,30,2,21,21,51,17,35,17,35,17,52,38,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,1,194,121,179,99,108,92,66,107,63,165,163,161,68,138,106,151,124,142,168,131,116,84,152,74,61,85,189,4,90,67,129,93,98,115,26,10,18,66,108,82,163,253,252,1,121,1,48,66,88,44,138,79,94,81,84,39,34,133,38,38,0,0,1,255,255,255,233,7,30,5,182,0,46,0,29,64,15,8,8,13,19,46,2,114,37,30,9,114,4,13,9,114,0,43,50,43,50,43,50,18,57,47,48,49,65,17,20,22,51,50,54,53,17,51,17,20,6,35,34,38,38,53,17,33,14,5,7,14,2,35,34,38,39,53,22,22,51,50,54,54,55,54,54,18,18,55,4,179,111,115,112,114,167,211,182,116,179,101,254,73,9,20,21,22,23,23,11,27,77,127,103,35,68,29,25,55,32,63,73,42,17,14,34,39,41,20,5,182,251,202,135,120,127,134,1,202,254,38,198,196,79,174,143,3,166,74,159,163,160,151,135,57,138,194,102,14,10,143,12,14,99,158,86,71,208,1,6,1,43,161,0,0,1,0,13,255,236,6,44,4,72,0,40,0,29,64,15,7,7,14,21,39,6,114,33,26,11,114,3,14,11,114,0,43,50,43,50,43,50,18,57,47,48,49,65,20,22,51,50,54,53,17,51,17,20,14,2,35,34,46,2,53,17,33,2,2,6,6,35,34,38,39,53,22,22,51,50,62,2,18,55,33,3,210,105,117,107,106,167,48,96,141,93,94,145,100,52,254,194,19,61,91,129,88,27,48,17,13,29,16,45,75,60,48,37,13,2,117,1,126,133,129,133,135,1,56,254,186,99,148,98,49,48,98,149,101,2,69,254,253,254,144,233,109,6,6,127,3,3,75,152,232,1,59,201,0,1,0,200,255,236,7,91,5,182,0,26,0,37,64,20,26,2,114,24,19,8,19,8,19,21,22,2,114,21,8,114,4,13,9,114,0,43,50,43,43,18,57,57,47,47,17,51,43,48,49,65,17,20,22,51,50,54,53,17,51,17,20,6,35,34,38,38,53,17,33,17,35,17,51,17,33,17,4,243,112,114,113,111,166,208,182,116,178,100,253,39,170,170,2,217,5,182,251,204,135,122,125,136,1,202,254,38,198,196,79,175,144,1,55,253,79,5,182,253,145,2,111,0,0,1,0,175,255,236,6,161,4,72,0,29,0,37,64,20,1,26,12,26,12,26,28,29,6,114,28,10,114,8,19,11,114,3,6,114,0,43,43,50,43,43,18,57,57,47,47,17,51,48,49,65,17,33,17,51,17,20,22,51,50,54,53,17,51,17,20,14,2,35,34,46,2,53,53,33,17,35,17,1,86,2,75,166,107,118,104,109,164,47,95,141,94,93,146,100,52,253,181,167,4,72,254,52,1,204,253,56,135,129,134,136,1,54,254,186,99,148,98,49,49,98,149,100,119,254,17,4,72,0,0,1,0,125,255,236,5,153,5,203,0,35,0,25,64,12,35,0,0,7,22,15,3,114,30,7,9,114,0,43,50,43,50,18,57,47,51,48,49,65,33,21,20,14,2,35,34,36,2,53,52,18,36,51,50,22,23,7,38,38,35,34,6,2,21,20,18,22,51,50,54,54,53,33,3,95,2,58,71,150,234,163,219,254,204,163,172,1,79,242,120,231,92,65,80,209,105,180,248,128,116,229,171,160,191,86,254,120,2,242,89,163,255,176,91,182,1,81,233,224,1,82,189,48,42,146,36,51,148,254,242,185,183,254,241,150,121,215,141,0,0,1,0,114,255,236,4,173,4,92,0,34,0,25,64,12,34,0,0,7,22,15,7,114,29,7,11,114,0,43,50,43,50,18,57,47,51,48,49,65,33,21,20,14,2,35,34,38,38,53,52,18,36,51,50,22,23,7,38,38,35,34,6,6,21,20,22,51,50,54,54,53,33,2,174,1,255,62,127,194,132,185,254,129,139,1,15,197,121,191,80,57,65,172,101,142,192,98,191,205,122,153,72,254,169,2,66,70,127,197,135,69,136,254,175,174,1,1,140,44,39,131,30,48,105,194,136,194,235,79,145,99,0,1,0,16,255,236,4,239,5,182,0,22,0,29,64,14,2,21,21,22,10,10,15,22,2,114,6,15,9,114,0,43,50,43,18,57,47,17,51,17,51,48,49,65,21,33,17,20,22,51,50,54,53,17,51,17,20,6,35,34,38,38,53,17,33,53,4,72,254,50,117,115,113,117,167,214,183,117,182,103,254,64,5,182,153,252,99,135,122,126,135,1,204,254,38,198,196,79,174,143,3,165,153,0,0,1,0,41,255,236,4,140,4,72,0,25,0,29,64,14,2,24,24,25,10,10,17,25,6,114,6,17,11,114,0,43,50,43,18,57,47,17,51,17,51,48,49,65,21,33,17,20,22,51,50,54,53,17,51,17,20,14,2,35,34,46,2,53,17,33,53,3,139,254,161,109,117,107,110,165,49,97,142,94,92,146,101,53,254,163,4,72,137,253,193,135,129,126,138,1,60,254,186,99,148,98,49,48,98,149,101,2,71,137,0,1,0,110,255,236,4,89,5,203,0,47,0,31,64,15,40,39,15,15,18,18,0,24,32,9,114,8,0,3,114,0,43,50,43,50,17,57,47,51,18,57,57,48,49,65,50,22,22,23,7,38,38,35,34,6,21,20,22,22,51,51,21,35,34,6,21,20,22,51,50,54,54,55,21,6,6,35,34,38,38,53,52,54,55,53,46,2,53,52,54,54,2,135,102,166,138,60,91,83,178,125,141,166,91,184,138,208,206,215,242,202,184,83,153,139,60,89,218,134,182,249,126,202,180,102,151,83,115,219,5,203,36,63,41,122,53,64,123,117,84,120,65,141,138,143,143,140,23,42,28,158,40,39,102,187,128,152,190,23,7,16,87,143,99,108,166,95,255,255,0,89,255,236,3,140,4,92,6,6,1,129,0,0,0,1,0,1,254,113,5,112,5,182,0,47,0,28,64,14,15,40,2,114,31,24,9,114,7,0,128,42,13,8,0,63,51,26,204,50,43,50,43,50,48,49,65,34,38,39,53,22,22,51,50,54,54,53,53,35,17,33,14,3,7,14,2,35,34,38,39,53,22,22,51,50,54,54,55,54,54,18,18,55,33,17,51,17,20,6,6,4,139,37,62,19,17,52,31,31,43,23,172,254,38,14,32,34,34,17,26,77,127,104,35,69,26,23,57,32,63,73,43,16,13,34,38,41,20,3,18,152,49,102,254,113,17,7,139,7,12,23,49,37,146,5,32,112,244,242,216,84,139,195,103,14,10,143,10,14,101,156,82,68,208,1,9,1,46,160,250,226,254,223,84,117,61,0,0,1,0,13,254,113,4,124,4,72,0,40,0,28,64,14,15,33,6,114,27,20,11,114,7,0,128,35,13,10,0,63,51,26,204,50,43,50,43,50,48,49,65,34,38,39,53,22,22,51,50,54,54,53,53,35,17,33,2,2,6,6,35,34,38,39,53,22,22,51,50,62,2,18,55,33,17,51,17,20,6,6,3,152,37,62,20,17,52,31,31,44,23,171,254,179,20,61,91,129,89,27,48,17,13,29,16,45,75,61,48,37,14,2,134,151,49,101,254,113,17,7,139,7,12,23,49,37,146,3,189,254,253,254,143,233,109,6,7,126,4,4,75,152,233,1,61,201,252,57,254,246,84,117,61,0,255,255,0,0,254,161,5,13,5,188,6,38,0,36,0,0,0,7,4,14,4,239,0,0,255,255,0,94,254,161,3,203,4,90,6,38,0,68,0,0,0,7,4,14,4,154,0,0,255,255,0,0,0,0,5,13,7,227,6,38,0,36,0,0,1,7,2,88,4,249,1,82,0,10,179,24,5,2,114,0,43,206,48,49,255,255,0,94,255,236,3,203,6,145,6,38,0,68,0,0,1,7,2,88,4,159,0,0,0,10,179,46,0,7,114,0,43,206,48,49,255,255,0,0,0,0,5,13,7,209,6,38,0,36,0,0,1,7,3,99,4,227,1,82,0,13,183,3,2,27,5,1,1,111,86,0,43,52,52,0,255,255,0,94,255,236,4,62,6,127,6,38,0,68,0,0,1,7,3,99,4,145,0,0,0,13,183,3,2,49,0,1,1,127,86,0,43,52,52,0,255,255,0,0,0,0,5,13,7,209,6,38,0,36,0,0,1,7,3,100,4,222,1,82,0,13,183,3,2,31,5,1,1,111,86,0,43,52,52,0,255,255,0,45,255,236,3,203,6,127,6,38,0,68,0,0,1,7,3,100,4,145,0,0,0,13,183,3,2,53,0,1,1,127,86,0,43,52,52,0,255,255,0,0,0,0,5,13,8,73,6,38,0,36,0,0,1,7,3,101,4,219,1,82,0,13,183,3,2,32,5,1,1,111,86,0,43,52,52,0,255,255,0,94,255,236,4,25,6,247,6,38,0,68,0,0,1,7,3,101,4,152,0,0,0,13,183,3,2,54,0,1,1,127,86,0,43,52,52,0,255,255,0,0,0,0,5,13,8,98,6,38,0,36,0,0,1,7,3,102,4,227,1,82,0,13,183,3,2,25,5,1,1,111,86,0,43,52,52,0,255,255,0,94,255,236,3,203,7,16,6,38,0,68,0,0,1,7,3,102,4,144,0,0,0,13,183,3,2,47,0,1,1,127,86,0,43,52,52,0,255,255,0,0,254,161,5,13,7,143,6,38,0,36,0,0,0,39,4,14,4,239,0,0,1,7,1,74,0,231,1,111,0,10,179,43,5,2,114,0,43,206,48,49,255,255,0,94,254,161,3,203,6,32,6,38,0,68,0,0,0,39,1,74,0,154,0,0,1,7,4,14,4,143,0,0,0,10,179,54,0,7,114,0,43,206,48,49,255,255,0,0,0,0,5,13,8,20,6,38,0,36,0,0,1,7,3,103,4,235,1,82,0,13,183,3,2,22,5,1,1,111,86,0,43,52,52,0,255,255,0,94,255,236,3,203,6,194,6,38,0,68,0,0,1,7,3,103,4,155,0,0,0,13,183,3,2,44,0,1,1,127,86,0,43,52,52,0,255,255,0,0,0,0,5,13,8,20,6,38,0,36,0,0,1,7,3,104,4,234,1,82,0,13,183,3,2,22,5,1,1,111,86,0,43,52,52,0,255,255,0,94,255,236,3,203,6,194,6,38,0,68,0,0,1,7,3,104,4,153,0,0,0,13,183,3,2,44,0,1,1,127,86,0,43,52,52,0,255,255,0,0,0,0,5,13,8,88,6,38,0,36,0,0,1,7,3,105,4,234,1,82,0,13,183,3,2,22,5,1,1,111,86,0,43,52,52,0,255,255,0,94,255,236,3,203,7,6,6,38,0,68,0,0,1,7,3,105,4,160,0,0,0,13,183,3,2,44,0,1,1,127,86,0,43,52,52,0,255,255,0,0,0,0,5,13,8,92,6,38,0,36,0,0,1,7,3,106,4,228,1,82,0,13,183,3,2,22,5,1,1,111,86,0,43,52,52,0,255,255,0,94,255,236,3,203,7,10,6,38,0,68,0,0,1,7,3,106,4,153,0,0,0,13,183,3,2,44,0,1,1,127,86,0,43,52,52,0,255,255,0,0,254,161,5,13,7,86,6,38,0,36,0,0,0,39,1,77,1,4,1,111,1,7,4,14,4,239,0,0,0,10,179,23,5,2,114,0,43,206,48,49,255,255,0,94,254,161,3,203,5,231,6,38,0,68,0,0,0,39,1,77,0,183,0,0,1,7,4,14,4,123,0,0,0,10,179,45,0,7,114,0,43,206,48,49,255,255,0,200,254,161,3,246,5,182,6,38,0,40,0,0,0,7,4,14,4,197,0,0,255,255,0,114,254,161,4,19,4,92,6,38,0,72,0,0,0,7,4,14,4,198,0,0,255,255,0,200,0,0,3,246,7,227,6,38,0,40,0,0,1,7,2,88,4,203,1,82,0,10,179,17,2,2,114,0,43,206,48,49,255,255,0,114,255,236,4,19,6,145,6,38,0,72,0,0,1,7,2,88,4,196,0,0,0,10,179,37,0,7,114,0,43,206,48,49,255,255,0,200,0,0,3,246,7,76,6,38,0,40,0,0,1,7,1,81,0,166,1,111,0,10,179,12,2,2,114,0,43,206,48,49,255,255,0,114,255,236,4,19,5,221,6,38,0,72,0,0,1,6,1,81,123,0,0,10,179,32,0,7,114,0,43,206,48,49,255,255,0,200,0,0,4,106,7,209,6,38,0,40,0,0,1,7,3,99,4,189,1,82,0,12,180,40,20,2,2,114,0,43,206,206,48,49,255,255,0,114,255,236,4,88,6,127,6,38,0,72,0,0,1,7,3,99,4,171,0,0,0,12,180,60,40,0,7,114,0,43,206,206,48,49,255,255,0,92,0,0,3,246,7,209,6,38,0,40,0,0,1,7,3,100,4,192,1,82,0,13,183,2,1,24,2,1,1,117,86,0,43,52,52,0,255,255,0,73,255,236,4,19,6,127,6,38,0,72,0,0,1,7,3,100,4,173,0,0,0,13,183,3,2,44,0,1,1,125,86,0,43,52,52,0,255,255,0,200,0,0,4,61,8,73,6,38,0,40,0,0,1,7,3,101,4,188,1,82,0,13,183,2,1,25,2,1,1,117,86,0,43,52,52,0,255,255,0,114,255,236,4,36,6,247,6,38,0,72,0,0,1,7,3,101,4,163,0,0,0,13,183,3,2,45,0,1,1,125,86,0,43,52,52,0,255,255,0,200,0,0,3,246,8,98,6,38,0,40,0,0,1,7,3,102,4,185,1,82,0,13,183,2,1,18,2,1,1,117,86,0,43,52,52,0,255,255,0,114,255,236,4,19,7,16,6,38,0,72,0,0,1,7,3,102,4,165,0,0,0,13,183,3,2,38,0,1,1,125,86,0,43,52,52,0,255,255,0,200,254,161,3,246,7,143,6,38,0,40,0,0,0,39,4,14,4,197,0,0,1,7,1,74,0,211,1,111,0,10,179,37,2,2,114,0,43,206,48,49,255,255,0,114,254,161,4,19,6,32,6,38,0,72,0,0,0,39,1,74,0,168,0,0,1,7,4,14,4,198,0,0,0,10,179,45,0,7,114,0,43,206,48,49,255,255,0,142,0,0,1,252,7,227,6,38,0,44,0,0,1,7,2,88,3,137,1,82,0,10,179,9,1,2,114,0,43,206,48,49,255,255,0,119,0,0,1,229,6,145,6,38,3,175,0,0,1,7,2,88,3,114,0,0,0,10,179,9,2,6,114,0,43,206,48,49,255,255,0,184,254,161,1,129,5,182,6,38,0,44,0,0,0,7,4,14,3,126,0,0,255,255,0,160,254,161,1,105,5,226,6,38,0,76,0,0,0,7,4,14,3,102,0,0,255,255,0,125,254,161,5,188,5,205,6,38,0,50,0,0,0,7,4,14,5,128,0,0,255,255,0,114,254,161,4,96,4,92,6,38,0,82,0,0,0,7,4,14,4,197,0,0,255,255,0,125,255,236,5,188,7,227,6,38,0,50,0,0,1,7,2,88,5,137,1,82,0,10,179,38,14,3,114,0,43,206,48,49,255,255,0,114,255,236,4,96,6,145,6,38,0,82,0,0,1,7,2,88,4,211,0,0,0,10,179,38,14,7,114,0,43,206,48,49,255,255,0,125,255,236,5,188,7,209,6,38,0,50,0,0,1,7,3,99,5,122,1,82,0,12,180,61,41,14,3,114,0,43,206,206,48,49,255,255,0,114,255,236,4,113,6,127,6,38,0,82,0,0,1,7,3,99,4,196,0,0,0,12,180,61,41,14,7,114,0,43,206,206,48,49,255,255,0,125,255,236,5,188,7,209,6,38,0,50,0,0,1,7,3,100,5,122,1,82,0,13,183,3,2,45,14,1,1,94,86,0,43,52,52,0,255,255,0,96,255,236,4,96,6,127,6,38,0,82,0,0,1,7,3,100,4,196,0,0,0,13,183,3,2,45,14,1,1,125,86,0,43,52,52,0,255,255,0,125,255,236,5,188,8,73,6,38,0,50,0,0,1,7,3,101,5,120,1,82,0,13,183,3,2,46,14,1,1,94,86,0,43,52,52,0,255,255,0,114,255,236,4,96,6,247,6,38,0,82,0,0,1,7,3,101,4,196,0,0,0,13,183,3,2,46,14,1,1,125,86,0,43,52,52,0,255,255,0,125,255,236,5,188,8,98,6,38,0,50,0,0,1,7,3,102,5,119,1,82,0,13,183,3,2,39,14,1,1,94,86,0,43,52,52,0,255,255,0,114,255,236,4,96,7,16,6,38,0,82,0,0,1,7,3,102,4,194,0,0,0,13,183,3,2,39,14,1,1,125,86,0,43,52,52,0,255,255,0,125,254,161,5,188,7,143,6,38,0,50,0,0,0,39,4,14,5,128,0,0,1,7,1,74,1,127,1,111,0,10,179,58,14,3,114,0,43,206,48,49,255,255,0,114,254,161,4,96,6,32,6,38,0,82,0,0,0,39,4,14,4,197,0,0,1,7,1,74,0,202,0,0,0,10,179,58,14,7,114,0,43,206,48,49,255,255,0,125,255,236,6,98,7,144,6,38,2,84,0,0,1,7,0,118,2,88,1,111,0,10,179,51,14,3,114,0,43,206,48,49,255,255,0,114,255,236,5,24,6,33,6,38,2,85,0,0,1,7,0,118,1,164,0,0,0,10,179,49,11,7,114,0,43,206,48,49,255,255,0,125,255,236,6,98,7,144,6,38,2,84,0,0,1,7,0,67,1,194,1,111,0,10,179,50,14,3,114,0,43,206,48,49,255,255,0,114,255,236,5,24,6,33,6,38,2,85,0,0,1,7,0,67,1,12,0,0,0,10,179,48,11,7,114,0,43,206,48,49,255,255,0,125,255,236,6,98,7,227,6,38,2,84,0,0,1,7,2,88,5,138,1,82,0,10,179,49,14,3,114,0,43,206,48,49,255,255,0,114,255,236,5,24,6,145,6,38,2,85,0,0,1,7,2,88,4,211,0,0,0,10,179,47,11,7,114,0,43,206,48,49,255,255,0,125,255,236,6,98,7,76,6,38,2,84,0,0,1,7,1,81,1,82,1,111,0,10,179,61,14,3,114,0,43,206,48,49,255,255,0,114,255,236,5,24,5,221,6,38,2,85,0,0,1,7,1,81,0,158,0,0,0,10,179,59,11,7,114,0,43,206,48,49,255,255,0,125,254,161,6,98,6,20,6,38,2,84,0,0,0,7,4,14,5,122,0,0,255,255,0,114,254,161,5,24,4,240,6,38,2,85,0,0,0,7,4,14,4,199,0,0,255,255,0,185,254,161,5,26,5,182,6,38,0,56,0,0,0,7,4,14,5,72,0,0,255,255,0,163,254,161,4,56,4,72,6,38,0,88,0,0,0,7,4,14,4,184,0,0,255,255,0,185,255,236,5,26,7,227,6,38,0,56,0,0,1,7,2,88,5,79,1,82,0,10,179,25,9,2,114,0,43,206,48,49,255,255,0,163,255,236,4,56,6,145,6,38,0,88,0,0,1,7,2,88,4,211,0,0,0,10,179,29,13,6,114,0,43,206,48,49,255,255,0,185,255,236,6,120,7,144,6,38,2,86,0,0,1,7,0,118,2,38,1,111,0,10,179,39,21,2,114,0,43,206,48,49,255,255,0,163,255,236,5,143,6,33,6,38,2,87,0,0,1,7,0,118,1,175,0,0,0,10,179,42,19,6,114,0,43,206,48,49,255,255,0,185,255,236,6,120,7,144,6,38,2,86,0,0,1,7,0,67,1,143,1,111,0,10,179,38,21,2,114,0,43,206,48,49,255,255,0,163,255,236,5,143,6,33,6,38,2,87,0,0,1,7,0,67,1,24,0,0,0,10,179,41,19,6,114,0,43,206,48,49,255,255,0,185,255,236,6,120,7,227,6,38,2,86,0,0,1,7,2,88,5,89,1,82,0,10,179,37,21,2,114,0,43,206,48,49,255,255,0,163,255,236,5,143,6,145,6,38,2,87,0,0,1,7,2,88,4,216,0,0,0,10,179,40,19,6,114,0,43,206,48,49,255,255,0,185,255,236,6,120,7,76,6,38,2,86,0,0,1,7,1,81,1,32,1,111,0,10,179,49,21,2,114,0,43,206,48,49,255,255,0,163,255,236,5,143,5,221,6,38,2,87,0,0,1,7,1,81,0,168,0,0,0,10,179,52,19,6,114,0,43,206,48,49,255,255,0,185,254,161,6,120,6,20,6,38,2,86,0,0,0,7,4,14,5,81,0,0,255,255,0,163,254,161,5,143,4,242,6,38,2,87,0,0,0,7,4,14,4,183,0,0,255,255,0,0,254,161,4,121,5,182,6,38,0,60,0,0,0,7,4,14,4,155,0,0,255,255,0,2,254,19,4,2,4,72,6,38,0,92,0,0,0,7,4,14,5,100,255,226,255,255,0,0,0,0,4,121,7,227,6,38,0,60,0,0,1,7,2,88,4,167,1,82,0,10,179,14,7,2,114,0,43,206,48,49,255,255,0,2,254,19,4,2,6,145,6,38,0,92,0,0,1,7,2,88,4,100,0,0,0,10,179,35,0,6,114,0,43,206,48,49,255,255,0,0,0,0,4,121,7,76,6,38,0,60,0,0,1,7,1,81,0,113,1,111,0,10,179,26,7,2,114,0,43,206,48,49,255,255,0,2,254,19,4,2,5,221,6,38,0,92,0,0,1,6,1,81,53,0,0,10,179,47,0,6,114,0,43,206,48,49,255,255,0,114,254,205,4,208,6,20,6,38,0,211,0,0,1,7,0,66,0,240,0,0,0,10,179,47,0,11,114,0,43,206,48,49,0,2,252,112,4,217,255,173,6,127,0,18,0,28,0,35,64,17,24,19,22,128,28,64,4,9,18,3,13,128,1,15,7,1,7,0,47,93,51,26,205,23,57,26,220,26,204,57,57,48,49,65,35,38,38,39,6,6,7,35,53,62,2,55,51,30,2,23,39,54,54,55,51,21,6,6,7,35,254,211,94,51,109,51,53,107,51,95,35,78,76,31,172,31,75,78,35,79,41,57,32,167,43,105,53,96,4,217,35,86,49,49,86,35,24,38,86,92,45,45,92,86,38,194,50,90,64,21,58,105,43,0,0,2,251,156,4,217,254,217,6,127,0,18,0,28,0,35,64,16,22,24,128,27,19,64,15,1,10,3,5,0,128,12,12,0,0,47,50,47,26,16,204,23,57,26,222,50,26,205,50,48,49,65,53,62,2,55,51,30,2,23,21,35,38,38,39,6,6,7,39,38,38,39,53,51,22,22,23,21,252,116,34,78,77,31,174,32,75,77,35,96,52,106,53,52,108,52,106,57,103,44,165,32,58,40,4,217,22,38,86,92,45,45,92,86,38,22,35,86,49,49,86,35,195,43,105,58,21,64,91,51,21,0,0,2,252,112,4,217,255,129,6,247,0,18,0,40,0,45,64,20,37,34,34,28,25,38,19,192,27,64,9,18,6,128,4,14,14,12,12,6,0,47,51,47,51,17,51,26,16,205,57,26,220,26,204,50,57,57,50,17,51,48,49,65,30,2,23,21,35,38,38,39,6,6,7,35,53,62,2,55,1,50,22,21,20,6,7,7,35,39,54,54,53,52,38,35,34,6,7,53,54,54,253,248,31,75,78,35,94,51,109,51,53,107,51,95,35,78,76,31,1,118,91,100,75,54,6,79,9,60,63,55,46,22,39,13,14,42,5,246,45,92,86,38,24,35,86,49,49,86,35,24,38,86,92,45,1,1,69,71,58,60,12,81,129,9,32,37,36,28,4,3,79,4,4,0,0,2,252,105,4,217,254,231,7,16,0,18,0,43,0,37,64,16,43,43,28,35,23,40,31,31,23,9,18,12,128,6,6,12,0,47,51,47,26,16,221,57,198,50,47,50,16,205,50,50,47,48,49,65,30,2,23,21,35,38,38,39,6,6,7,35,53,62,2,55,1,14,2,35,34,46,2,35,34,6,7,35,54,54,51,50,30,2,51,50,54,55,253,250,32,76,78,35,92,53,107,53,52,111,51,92,34,79,77,31,1,150,6,47,79,54,37,70,66,63,29,41,45,13,88,11,96,80,38,72,67,62,28,41,44,12,5,243,45,92,85,38,22,35,84,49,49,84,35,22,38,85,92,45,1,29,64,99,55,30,39,30,49,53,95,124,30,40,30,50,52,0,0,2,252,117,4,217,254,200,6,194,0,13,0,24,0,29,64,11,15,24,21,20,20,13,13,7,128,10,3,0,47,51,26,204,50,47,50,124,47,51,24,204,50,48,49,65,6,6,35,34,38,39,51,22,22,51,50,54,55,55,21,14,2,7,35,53,54,54,55,254,200,11,149,140,143,144,8,102,8,99,88,79,107,10,33,29,66,71,36,93,39,60,30,5,225,122,142,139,125,85,53,57,81,225,21,38,75,66,28,22,50,92,64,0,0,2,252,117,4,217,254,200,6,194,0,13,0,24,0,27,64,10,23,14,17,19,19,13,7,128,10,3,0,47,51,26,204,50,50,124,47,51,24,205,50,48,49,65,6,6,35,34,38,39,51,22,22,51,50,54,55,37,22,22,23,21,35,46,2,39,53,254,200,11,148,141,143,143,9,102,8,99,88,80,106,10,254,242,31,57,40,91,35,72,66,29,5,225,122,142,139,125,85,53,56,82,225,64,92,50,22,28,66,75,38,21,0,2,252,117,4,217,254,200,7,6,0,13,0,35,0,31,64,12,23,20,29,14,22,22,10,10,13,7,128,3,0,47,26,204,50,51,17,51,124,47,24,204,50,57,57,48,49,65,6,6,35,34,38,39,51,22,22,51,50,54,55,3,50,22,21,20,6,7,7,35,39,54,54,53,52,38,35,34,6,7,53,54,54,254,200,11,148,141,143,143,9,102,8,99,88,80,106,10,237,91,97,74,53,6,79,9,59,62,55,44,23,40,13,15,43,5,225,122,142,139,125,85,53,56,82,1,37,68,71,58,59,11,45,94,9,32,36,35,28,5,2,76,5,4,0,2,252,103,4,217,254,230,7,10,0,13,0,38,0,31,64,13,38,23,30,128,35,26,18,64,13,7,128,10,3,0,47,51,26,220,50,26,222,50,50,26,205,50,50,48,49,65,6,6,35,34,38,39,51,22,22,51,50,54,55,19,14,2,35,34,46,2,35,34,6,7,35,54,54,51,50,30,2,51,50,54,55,254,200,11,148,141,143,143,9,102,8,99,88,80,106,10,132,6,47,79,54,37,71,66,63,29,41,44,14,88,11,96,81,38,72,67,62,28,41,44,11,5,222,121,140,137,124,84,51,53,82,1,44,63,97,55,30,40,30,49,53,95,120,30,39,30,50,51,0,1,0,48,254,62,1,110,0,3,0,19,0,12,179,17,10,10,4,0,47,51,47,51,48,49,87,52,38,39,55,22,22,21,20,6,35,34,38,39,53,22,22,51,50,54,228,76,68,117,60,105,104,97,31,60,26,16,48,25,39,52,241,58,119,64,3,44,129,86,91,103,10,7,107,5,6,50,0,1,0,29,254,113,1,121,0,152,0,19,0,14,180,7,0,192,13,14,0,47,51,26,204,50,48,49,83,34,38,39,53,22,22,51,50,54,54,53,53,35,53,51,17,20,6,6,147,37,62,19,17,53,31,31,43,23,24,174,50,101,254,113,17,7,139,7,12,23,49,37,146,152,254,223,84,117,61,0,255,255,0,18,254,20,4,83,5,182,6,38,0,55,0,0,0,7,0,122,1,81,0,0,255,255,0,32,254,20,2,171,5,70,6,38,0,87,0,0,0,7,0,122,0,207,0,0,255,255,0,125,254,62,5,188,5,205,6,38,0,50,0,0,0,7,1,80,2,50,0,0,255,255,0,114,254,62,4,96,4,92,6,38,0,82,0,0,0,7,1,80,1,134,0,0,255,255,0,125,254,62,5,188,6,208,6,38,0,50,0,0,0,39,1,76,1,159,1,111,1,7,1,80,2,78,0,0,0,10,179,35,14,3,114,0,43,206,48,49,255,255,0,114,254,62,4,96,5,97,6,38,0,82,0,0,0,39,1,76,0,234,0,0,1,7,1,80,1,134,0,0,0,10,179,35,14,7,114,0,43,206,48,49,0,2,0,106,255,236,4,12,4,92,0,23,0,31,0,25,64,12,13,25,25,0,29,8,11,114,17,0,7,114,0,43,50,43,50,18,57,47,51,48,49,65,50,22,22,21,20,2,6,35,34,38,38,53,53,33,38,38,35,34,6,7,53,54,54,1,33,30,2,51,50,54,2,0,158,236,130,119,217,147,140,201,106,2,246,4,185,170,103,160,87,83,164,1,202,253,189,1,58,121,94,134,158,4,92,129,250,181,177,254,254,141,124,224,148,103,192,203,37,38,147,36,34,253,97,97,149,83,174,0,255,255,253,5,4,184,254,115,6,145,6,6,2,88,0,0,255,255,0,1,255,236,6,248,5,205,4,39,0,50,1,60,0,0,1,7,3,118,254,145,255,154,0,16,181,3,2,50,14,2,0,184,255,252,176,86,0,43,52,52,0,2,1,112,4,206,3,140,6,47,0,10,0,28,0,29,64,12,28,11,11,0,25,17,17,6,4,128,1,0,0,47,50,26,204,50,50,47,51,17,51,47,51,48,49,65,53,54,54,55,51,21,14,2,7,7,38,38,53,52,54,51,50,22,21,20,14,2,35,20,22,23,2,121,23,54,15,183,20,63,74,38,128,112,105,55,47,43,58,16,28,38,22,53,65,4,223,25,60,164,69,21,42,102,105,48,17,12,118,104,53,66,45,49,24,34,23,11,34,56,6,0,0,2,0,41,3,68,2,158,6,210,0,11,0,23,0,14,181,12,0,120,18,6,119,0,63,51,228,50,48,49,65,34,38,53,52,54,51,50,22,21,20,6,39,50,54,53,52,38,35,34,6,21,20,22,1,98,157,156,150,163,157,159,150,166,92,86,86,92,90,85,84,3,68,233,223,219,235,232,222,218,238,120,165,171,170,165,165,172,169,165,0,2,0,41,3,68,2,161,6,209,0,30,0,44,0,25,64,11,31,12,11,15,15,39,22,120,7,0,119,0,63,50,228,50,57,47,51,51,51,48,49,65,50,22,23,21,38,38,35,34,6,6,7,51,54,54,51,50,22,21,20,6,6,35,34,38,38,53,52,62,2,19,34,6,6,21,20,22,22,51,50,54,53,52,38,1,222,31,70,24,23,71,38,111,129,58,6,8,29,113,85,121,150,75,138,93,93,147,86,39,97,170,23,59,89,49,43,86,62,80,99,88,6,209,8,6,114,8,11,86,147,92,44,60,143,131,94,137,74,85,174,131,103,187,145,84,254,77,44,69,39,53,98,62,97,96,80,92,0,2,0,35,3,68,2,156,6,213,0,29,0,43,0,27,64,12,20,21,36,36,24,24,16,9,120,30,0,119,0,63,50,228,50,57,47,51,17,51,51,48,49,65,50,22,22,21,20,14,2,35,34,38,39,53,22,22,51,50,54,54,55,35,6,6,35,34,38,53,52,54,23,34,6,21,20,22,51,50,54,54,53,52,38,38,1,85,92,148,87,39,95,168,130,35,72,23,22,66,49,112,126,57,5,10,28,106,83,130,151,167,139,76,100,84,88,58,89,50,42,85,6,213,83,171,134,103,189,148,85,8,6,116,9,12,91,150,88,40,65,146,133,133,168,110,94,92,81,97,43,69,39,61,96,56,255,255,255,218,255,236,2,147,7,141,6,38,1,133,0,0,1,7,3,136,255,111,0,0,0,18,64,10,4,3,2,1,33,16,1,1,141,86,0,43,52,52,52,52,255,255,255,218,255,236,2,147,7,141,6,38,1,133,0,0,1,7,3,135,255,111,0,0,0,18,64,10,4,3,2,1,27,16,1,1,141,86,0,43,52,52,52,52,255,255,255,204,255,236,2,147,7,141,6,38,1,133,0,0,1,7,3,134,255,109,0,0,0,18,64,10,4,3,2,1,37,16,1,1,141,86,0,43,52,52,52,52,255,255,255,206,255,236,2,147,7,141,6,38,1,133,0,0,1,7,3,133,255,111,0,0,0,18,64,10,4,3,2,1,31,16,1,1,141,86,0,43,52,52,52,52,255,255,0,163,255,236,4,111,7,141,6,38,1,145,0,0,1,7,3,136,0,220,0,0,0,18,64,10,4,3,2,1,40,5,1,1,141,86,0,43,52,52,52,52,255,255,0,163,255,236,4,111,7,141,6,38,1,145,0,0,1,7,3,135,0,220,0,0,0,18,64,10,4,3,2,1,34,5,1,1,141,86,0,43,52,52,52,52,255,255,0,163,255,236,4,111,7,141,6,38,1,145,0,0,1,7,3,134,0,219,0,0,0,18,64,10,4,3,2,1,44,5,1,1,141,86,0,43,52,52,52,52,255,255,0,163,255,236,4,111,7,141,6,38,1,145,0,0,1,7,3,133,0,220,0,0,0,18,64,10,4,3,2,1,38,5,1,1,100,86,0,43,52,52,52,52,0,1,0,199,254,123,5,1,5,203,0,38,0,28,64,14,25,24,15,15,29,3,114,22,2,114,20,8,7,0,0,47,50,63,43,43,50,17,51,51,48,49,65,34,38,39,53,22,22,51,50,54,54,53,17,52,38,35,34,6,6,21,17,35,17,51,23,51,62,2,51,50,22,22,21,17,20,14,2,3,131,52,77,28,32,79,46,54,97,61,164,185,147,172,74,170,134,29,9,37,127,159,84,154,225,124,55,102,140,254,123,14,13,144,9,12,41,100,88,3,209,197,171,110,202,137,252,138,5,182,201,65,100,57,107,219,170,252,37,99,147,96,47,0,255,255,0,200,254,127,5,63,5,182,6,6,1,11,0,0,0,1,0,186,255,236,4,244,5,203,0,40,0,35,64,18,6,23,23,0,28,27,18,18,32,3,114,25,2,114,11,0,9,114,0,43,50,43,43,50,17,51,51,17,57,47,206,48,49,69,34,38,38,53,53,51,21,20,22,22,51,50,54,53,17,52,38,35,34,6,6,21,21,35,17,51,23,51,62,2,51,50,22,22,21,17,20,6,6,2,208,173,238,123,170,84,167,122,195,174,164,185,147,172,74,170,135,27,11,37,126,159,85,153,225,124,119,242,20,132,241,163,25,31,123,170,89,215,176,1,192,197,171,110,202,137,149,2,213,201,65,100,57,107,219,170,254,44,156,243,140,0,0,4,0,95,4,213,2,204,7,141,0,13,0,25,0,37,0,49,0,37,64,16,32,26,26,14,43,38,38,7,10,4,128,0,0,20,20,14,0,47,51,17,51,47,26,204,50,51,50,47,196,17,51,17,51,48,49,65,34,38,39,51,22,22,51,50,54,55,51,6,6,5,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,1,53,62,2,55,51,21,14,2,7,1,144,140,150,15,106,14,101,88,77,109,16,110,16,162,254,189,38,52,52,38,38,54,54,1,87,37,52,52,37,38,53,53,254,186,26,45,41,20,167,28,68,72,37,5,199,139,112,68,48,54,62,112,139,242,49,49,51,46,46,51,49,49,49,49,51,46,46,51,49,49,1,213,23,33,62,68,41,20,37,74,68,28,0,4,0,95,4,213,2,204,7,141,0,13,0,25,0,37,0,49,0,43,64,19,26,32,32,20,48,38,64,42,44,44,13,7,128,10,3,3,14,14,20,0,47,51,17,51,47,51,26,204,50,50,47,51,26,205,50,17,51,17,51,48,49,65,6,6,35,34,38,39,51,22,22,51,50,54,55,1,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,38,53,52,54,3,30,2,23,21,35,46,2,39,53,2,204,16,162,138,140,150,15,106,14,101,88,77,109,16,254,121,38,54,54,38,38,52,52,1,163,38,53,53,38,37,52,52,201,20,41,45,26,94,36,73,67,29,6,194,112,139,139,112,68,48,54,62,254,214,46,51,49,49,49,49,51,46,46,51,49,49,49,49,51,46,1,245,41,68,62,33,23,28,68,74,37,20,0,4,0,107,4,213,2,193,7,141,0,3,0,15,0,27,0,39,0,31,64,13,16,22,22,10,39,33,3,3,2,2,4,4,10,0,47,51,17,51,47,51,16,222,205,17,51,17,51,48,49,65,21,33,53,23,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,38,53,52,54,19,21,14,2,7,35,53,62,2,55,2,193,253,170,108,38,54,54,38,38,52,52,1,163,38,53,53,38,37,52,52,48,28,68,72,37,94,26,45,41,20,6,103,136,136,207,46,51,49,49,49,49,51,46,46,51,49,49,49,49,51,46,1,245,20,37,74,68,28,23,33,62,68,41,0,0,4,0,107,4,213,2,193,7,141,0,11,0,15,0,27,0,39,0,31,64,13,34,28,28,16,6,0,13,13,12,12,22,22,16,0,47,51,17,51,47,51,16,222,205,17,51,17,51,48,49,65,46,2,39,53,51,30,2,23,21,5,53,33,21,1,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,1,141,36,73,67,29,167,20,41,45,26,254,128,2,86,254,22,38,52,52,38,38,54,54,1,87,37,52,52,37,38,53,53,6,170,28,68,74,37,20,41,68,62,33,23,203,136,136,254,246,49,49,51,46,46,51,49,49,49,49,51,46,46,51,49,49,0,0,1,0,181,4,222,3,231,5,164,0,13,0,29,64,12,1,12,12,5,9,9,13,128,3,7,7,11,0,47,51,17,51,26,205,50,17,51,50,17,51,48,49,65,21,7,35,39,35,7,35,39,35,7,35,39,53,3,231,76,32,46,195,46,33,46,192,46,32,74,5,164,32,166,102,102,102,102,166,32,255,255,0,30,0,0,5,191,6,31,4,38,0,73,0,0,0,7,0,73,2,177,0,0,255,255,0,30,0,0,4,25,6,31,4,38,0,73,0,0,0,7,0,76,2,177,0,0,255,255,0,30,0,0,4,7,6,31,4,38,0,73,0,0,0,7,0,79,2,177,0,0,255,255,0,30,0,0,6,202,6,31,4,38,0,73,0,0,0,39,0,73,2,177,0,0,0,7,0,76,5,98,0,0,255,255,0,30,0,0,6,184,6,31,4,38,0,73,0,0,0,39,0,73,2,177,0,0,0,7,0,79,5,98,0,0,0,1,0,186,255,237,5,87,5,203,0,43,0,38,64,19,39,8,28,5,5,29,4,0,26,26,0,20,13,9,114,33,0,3,114,0,43,50,43,50,17,57,47,18,57,57,51,17,51,63,48,49,65,50,22,22,23,1,30,2,21,20,6,6,35,34,38,39,53,22,22,51,50,54,53,52,38,35,35,53,1,46,2,35,34,6,6,21,17,35,17,52,54,54,2,219,134,192,124,32,254,218,129,203,116,106,223,176,107,186,78,79,194,91,176,159,182,179,118,1,62,24,81,120,83,125,163,79,168,120,242,5,203,81,146,100,254,197,3,100,184,131,129,200,113,35,41,156,43,49,160,143,137,140,125,1,83,53,75,41,97,173,115,252,75,3,182,153,241,139,0,1,255,230,254,20,5,15,5,205,0,38,0,30,64,16,13,20,20,25,8,28,5,4,26,6,2,114,32,0,3,114,0,43,50,43,47,23,57,51,47,51,48,49,83,50,22,22,23,19,1,51,1,1,30,2,51,50,54,55,21,6,6,35,34,38,38,39,3,1,35,1,3,38,38,35,34,6,7,53,54,54,196,69,85,60,30,220,1,124,182,254,25,1,34,36,51,54,37,17,49,26,30,74,38,81,96,73,48,218,254,32,183,2,73,253,35,55,54,19,49,31,29,63,5,205,46,98,78,253,233,2,222,252,107,253,74,83,89,33,6,6,126,11,13,68,146,117,2,21,252,163,4,19,2,101,88,92,8,11,127,11,19,0,0,3,0,195,254,20,4,170,5,182,0,20,0,29,0,39,0,32,64,15,8,9,21,21,30,30,0,31,19,18,8,29,0,2,114,0,43,50,63,205,51,18,57,47,51,18,57,57,48,49,83,33,32,22,21,20,6,6,7,21,30,2,21,20,6,6,35,33,17,35,19,33,50,54,53,52,38,35,35,17,17,33,50,54,53,52,38,38,35,195,1,171,1,25,255,68,126,88,103,142,73,132,236,158,254,209,170,170,1,20,180,162,182,183,253,1,40,179,176,82,165,127,5,182,184,182,87,133,86,16,8,16,84,141,104,142,187,92,254,20,5,44,126,124,126,118,253,138,253,211,148,143,88,118,60,0,255,255,0,200,254,20,3,251,5,182,6,38,0,47,0,0,1,7,0,122,1,153,0,0,0,11,182,1,23,0,1,0,0,86,0,43,52,0,255,255,0,200,254,20,5,63,5,182,6,38,0,49,0,0,1,7,0,122,2,48,0,0,0,11,182,1,37,1,1,0,0,86,0,43,52,0,255,255,0,0,254,62,5,13,5,188,6,38,0,36,0,0,0,7,1,80,1,151,0,0,255,255,0,200,254,62,3,246,5,182,6,38,0,40,0,0,0,7,1,80,1,107,0,0,255,255,0,88,254,62,1,163,5,182,6,38,0,44,0,0,1,6,1,80,6,0,0,11,182,1,21,0,0,0,30,86,0,43,52,0,255,255,0,185,254,62,5,26,5,182,6,38,0,56,0,0,0,7,1,80,1,239,0,0,0,1,0,87,0,0,2,81,5,182,0,11,0,40,64,19,9,4,4,8,8,5,5,6,2,114,10,3,3,11,11,2,2,1,8,0,63,51,17,51,17,51,17,51,43,50,17,51,17,51,17,51,48,49,97,33,53,55,17,39,53,33,21,7,17,23,2,81,254,6,168,168,1,250,168,168,99,35,4,168,37,99,99,37,251,88,35,0,0,1,0,56,255,233,2,138,5,182,0,17,0,14,182,12,2,114,7,0,9,114,0,43,50,43,48,49,69,34,38,39,53,22,22,51,50,54,54,53,17,51,17,20,6,6,1,22,71,110,41,49,109,59,57,94,56,170,91,166,23,29,23,144,20,26,45,107,93,4,66,251,202,138,180,89,255,255,0,76,0,0,2,81,7,144,6,38,3,152,0,0,1,7,0,67,255,250,1,111,0,10,179,18,6,2,114,0,43,206,48,49,255,255,0,87,0,0,2,119,7,144,6,38,3,152,0,0,1,7,0,118,0,144,1,111,0,10,179,19,6,2,114,0,43,206,48,49,255,255,0,9,0,0,2,170,7,143,6,38,3,152,0,0,1,7,1,74,255,183,1,111,0,10,179,25,6,2,114,0,43,206,48,49,255,255,0,58,0,0,2,111,7,65,6,38,3,152,0,0,1,7,0,106,255,4,1,111,0,12,180,33,21,6,2,114,0,43,206,206,48,49,255,255,255,220,0,0,2,195,7,76,6,38,3,152,0,0,1,7,1,81,255,138,1,111,0,10,179,29,6,2,114,0,43,206,48,49,255,255,0,41,0,0,2,128,6,208,6,38,3,152,0,0,1,7,1,76,255,215,1,111,0,10,179,14,6,2,114,0,43,206,48,49,255,255,0,38,0,0,2,148,7,86,6,38,3,152,0,0,1,7,1,77,255,212,1,111,0,10,179,16,6,2,114,0,43,206,48,49,255,255,0,87,254,62,2,81,5,182,6,38,3,152,0,0,0,7,1,80,0,176,0,0,255,255,0,87,254,62,2,81,5,182,6,38,3,152,0,0,0,6,1,80,93,0,255,255,0,87,0,0,2,81,7,81,6,38,3,152,0,0,1,7,1,78,0,163,1,111,0,10,179,18,6,2,114,0,43,206,48,49,255,255,0,87,254,127,4,20,5,182,4,38,3,152,0,0,0,7,0,45,2,170,0,0,255,255,0,56,255,233,3,134,7,143,6,38,3,153,0,0,1,7,1,74,0,147,1,111,0,10,179,31,12,2,114,0,43,206,48,49,255,255,0,87,0,0,2,81,7,227,6,38,3,152,0,0,1,7,2,88,3,187,1,82,0,10,179,17,6,2,114,0,43,206,48,49,255,255,0,87,254,161,2,81,5,182,6,38,3,152,0,0,0,7,4,14,3,180,0,0,255,255,255,254,0,0,3,67,6,4,4,39,3,152,0,242,0,0,0,7,1,83,253,246,255,147,255,255,0,87,0,0,2,81,5,182,6,6,3,152,0,0,255,255,0,58,0,0,2,111,7,65,6,38,3,152,0,0,1,7,0,106,255,4,1,111,0,12,180,33,21,6,2,114,0,43,206,206,48,49,255,255,0,87,0,0,2,81,5,182,6,6,3,152,0,0,255,255,0,58,0,0,2,111,7,65,6,38,3,152,0,0,1,7,0,106,255,4,1,111,0,12,180,33,21,6,2,114,0,43,206,206,48,49,255,255,0,56,255,233,2,138,5,182,6,6,3,153,0,0,255,255,0,87,0,0,2,81,5,182,6,6,3,152,0,0,0,1,0,175,0,0,1,85,4,72,0,3,0,12,181,2,6,114,1,10,114,0,43,43,48,49,97,35,17,51,1,85,166,166,4,72,0,1,255,144,254,20,1,85,4,72,0,16,0,14,182,11,6,114,7,0,15,114,0,43,50,43,48,49,83,34,38,39,53,22,22,51,50,54,53,17,51,17,20,6,6,43,51,76,28,31,64,40,68,84,166,64,132,254,20,15,10,135,10,11,76,100,4,249,251,11,100,143,76,0,255,255,0,175,254,20,4,166,6,31,6,6,1,126,0,0,255,255,255,240,254,20,4,78,4,80,6,6,1,147,0,0,255,255,0,114,254,20,4,53,6,32,6,38,3,186,0,0,1,6,2,54,101,0,0,10,179,58,0,7,114,0,43,206,48,49,255,255,0,65,254,20,1,208,6,20,6,38,0,79,0,0,1,6,0,122,37,0,0,11,182,1,21,1,1,0,0,86,0,43,52,0,255,255,0,175,254,20,4,65,4,92,6,38,0,81,0,0,1,7,0,122,1,162,0,0,0,14,180,1,25,14,0,0,184,254,20,176,86,0,43,52,0,3,0,94,254,62,3,203,4,90,0,21,0,51,0,62,0,50,64,25,8,7,7,29,59,59,33,53,52,52,41,40,40,22,33,11,114,27,18,45,22,7,114,15,0,0,47,50,43,50,63,43,18,57,47,51,51,17,51,17,51,17,51,51,17,51,48,49,65,34,38,53,52,54,54,55,23,14,2,21,20,22,51,50,54,55,21,6,6,3,50,22,21,17,35,39,35,14,2,35,34,38,38,53,52,36,37,55,53,52,38,35,34,6,7,39,54,54,1,7,6,6,21,20,22,51,50,54,53,2,97,104,101,72,109,54,92,61,85,45,51,44,34,48,16,27,57,64,196,190,121,32,8,46,100,131,95,100,155,89,1,4,1,10,189,122,111,86,156,70,51,74,192,1,72,167,205,168,114,94,146,186,254,62,100,90,73,137,116,39,30,56,102,101,57,47,49,8,5,108,7,11,6,28,176,193,253,23,162,60,81,41,70,142,109,164,176,8,8,67,142,114,50,34,126,38,54,253,194,7,8,118,108,94,90,162,162,0,255,255,0,114,254,62,4,19,4,92,6,38,0,72,0,0,0,7,1,80,1,109,0,0,255,255,0,49,254,62,1,124,5,226,6,38,0,76,0,0,0,6,1,80,223,0,0,2,0,163,254,62,4,56,4,72,0,21,0,45,0,36,64,19,45,6,114,35,6,114,8,7,7,26,40,40,15,0,30,11,114,24,10,0,63,43,204,50,51,17,51,51,17,51,43,43,48,49,65,34,38,53,52,54,54,55,23,14,2,21,20,22,51,50,54,55,21,6,6,1,17,35,39,35,14,2,35,34,38,38,53,17,51,17,20,22,51,50,54,54,53,17,2,147,106,101,57,95,57,129,64,90,47,51,44,33,49,17,28,58,1,127,136,24,9,34,108,135,76,130,176,89,168,124,127,122,145,64,254,62,100,90,58,111,99,39,11,49,92,89,47,47,49,8,5,108,7,11,6,10,251,184,154,57,78,39,84,176,138,2,206,253,62,137,135,92,179,130,2,65,0,2,0,114,254,20,4,53,4,92,0,34,0,51,0,35,64,19,26,42,42,29,11,114,18,11,15,114,5,6,114,3,35,35,0,7,114,0,43,50,17,51,43,43,50,43,50,17,51,48,49,65,50,22,23,51,55,51,17,20,6,6,35,34,38,39,53,22,22,51,50,54,53,53,52,54,55,35,6,6,35,34,2,17,16,18,23,34,6,6,21,20,22,51,50,62,2,53,53,52,38,38,2,54,113,173,59,11,22,133,104,215,168,120,196,77,77,207,118,150,163,5,1,8,55,173,117,212,239,238,237,98,135,70,154,149,87,124,77,37,68,143,4,92,85,85,150,251,162,154,209,107,36,35,154,40,46,170,148,48,29,91,22,88,87,1,40,1,12,1,7,1,53,140,102,193,138,208,219,48,97,146,97,49,147,187,89,0,255,255,0,114,254,20,4,53,6,32,6,38,3,186,0,0,1,7,1,74,0,190,0,0,0,10,179,65,0,7,114,0,43,206,48,49,255,255,0,114,254,20,4,53,5,231,6,38,3,186,0,0,1,7,1,77,0,220,0,0,0,10,179,56,0,7,114,0,43,206,48,49,255,255,0,114,254,20,4,53,5,226,6,38,3,186,0,0,1,7,1,78,1,170,0,0,0,10,179,58,0,7,114,0,43,206,48,49,0,1,255,231,255,225,3,164,6,31,0,43,0,37,64,18,17,39,39,19,20,20,36,6,114,32,25,1,114,7,6,13,13,0,0,47,50,16,204,50,43,50,43,50,17,51,50,17,51,48,49,69,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,53,17,35,53,55,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,21,33,21,33,17,20,6,6,1,7,131,157,5,7,142,2,3,70,51,61,69,195,195,81,156,112,63,105,40,43,34,85,44,95,90,1,16,254,240,61,123,31,143,120,22,47,23,32,10,24,14,68,68,83,103,2,160,80,55,73,138,173,82,22,14,131,11,19,123,131,80,130,253,101,103,148,79,0,2,0,112,255,236,4,93,6,30,0,33,0,47,0,25,64,13,34,25,9,3,0,41,17,11,114,1,0,1,114,0,43,50,43,50,17,23,57,48,49,65,23,6,4,6,21,20,22,22,23,30,2,21,20,6,6,35,34,38,38,53,52,54,54,55,46,2,53,52,54,54,36,3,14,2,21,20,22,51,50,54,53,52,38,38,4,39,20,210,254,208,163,60,128,103,133,188,99,125,227,154,145,226,128,91,175,126,71,115,68,93,196,1,53,211,90,161,101,174,152,161,173,76,138,6,30,146,25,43,68,64,44,61,66,50,65,149,191,129,153,217,115,109,210,153,123,190,134,37,37,76,99,71,81,113,79,53,253,86,22,94,165,131,153,180,183,163,103,146,107,0,255,255,0,87,0,0,2,81,5,182,6,6,3,152,0,0,0,1,0,114,255,59,2,196,2,225,0,23,0,24,64,11,5,4,17,17,8,124,23,125,13,22,123,0,63,51,237,228,50,17,51,51,48,49,83,17,20,6,7,51,54,54,51,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,222,3,3,7,33,120,73,128,131,107,81,84,119,95,108,2,225,254,233,25,48,20,51,55,114,126,254,84,1,166,82,82,125,117,254,168,3,166,0,1,0,114,255,59,2,177,2,225,0,18,0,25,64,14,15,14,4,5,11,8,6,9,124,18,125,13,17,123,0,63,51,237,228,23,57,48,49,83,17,20,6,7,51,54,54,55,55,51,1,1,35,3,7,21,35,17,221,4,1,4,14,52,19,236,127,254,226,1,51,130,252,86,107,2,225,254,27,24,69,27,16,61,19,233,254,231,254,135,1,55,73,238,3,166,0,1,0,114,255,59,0,222,2,225,0,3,0,10,179,2,125,1,123,0,63,237,48,49,87,35,17,51,222,108,108,197,3,166,0,1,0,114,255,59,4,101,1,217,0,38,0,37,64,17,28,27,18,18,32,9,0,0,32,32,25,124,5,14,14,24,123,0,63,51,17,51,237,50,47,51,17,51,17,51,17,51,51,48,49,65,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,34,6,6,21,17,35,17,51,23,51,62,2,51,50,22,23,51,54,54,3,119,118,120,107,75,73,104,93,107,75,74,71,86,38,108,87,16,6,21,65,81,46,80,110,25,6,35,123,1,217,114,125,254,81,1,170,80,80,111,107,254,144,1,170,80,80,55,106,77,254,164,2,146,93,34,46,25,56,57,57,56,0,0,1,0,114,255,59,2,196,1,217,0,20,0,25,64,11,18,17,9,9,0,0,15,124,5,14,123,0,63,51,237,50,47,51,17,51,51,48,49,65,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,51,23,51,54,54,1,195,127,130,107,81,84,118,96,108,87,16,6,34,122,1,217,115,127,254,84,1,166,82,82,124,118,254,168,2,146,95,52,55,0,2,0,114,254,21,2,228,1,217,0,21,0,34,0,35,64,16,10,9,29,29,6,19,18,22,22,0,0,16,124,14,6,123,0,63,206,228,50,47,51,17,51,51,17,51,17,51,51,48,49,65,50,22,21,20,6,35,34,38,39,35,22,22,21,17,35,17,51,23,51,54,54,23,34,6,7,21,20,22,51,50,54,53,52,38,1,193,133,158,160,134,85,109,30,7,1,6,108,89,14,5,31,106,71,111,95,2,92,117,99,99,98,1,217,170,169,169,174,60,42,23,66,25,254,242,3,184,98,45,65,84,119,118,20,125,133,145,116,116,138,0,0,1,0,67,255,47,2,63,1,217,0,41,0,24,64,13,13,0,17,38,21,34,6,31,24,124,10,3,123,0,63,51,228,50,23,57,48,49,69,20,6,35,34,38,39,53,22,22,51,50,54,53,52,38,38,39,46,2,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,22,23,30,2,2,63,152,131,75,109,41,43,122,62,93,83,33,79,68,69,99,54,146,119,65,112,49,36,45,100,52,74,80,37,82,67,66,98,53,17,94,98,22,19,92,20,32,55,48,27,41,39,23,24,48,68,55,83,90,24,20,79,17,24,46,39,31,40,35,23,22,49,69,0,0,1,0,21,255,47,1,188,2,101,0,23,0,29,64,13,11,20,20,17,13,14,14,16,17,124,0,7,123,0,63,51,244,205,51,17,51,17,51,17,51,48,49,69,50,54,55,21,6,6,35,34,38,53,17,35,53,55,55,51,21,51,21,35,17,20,22,1,88,27,55,18,19,67,32,85,119,101,102,43,65,208,208,61,127,8,6,77,8,11,86,116,1,134,48,39,143,152,78,254,125,62,61,0,0,1,0,113,0,0,4,66,5,11,0,35,0,24,64,12,26,11,29,8,4,0,18,9,121,114,28,0,0,47,50,43,50,18,23,57,48,49,115,17,52,54,54,55,54,54,55,3,51,1,54,54,55,54,54,53,17,51,17,20,6,7,6,6,7,1,35,1,6,6,7,6,21,17,113,13,33,33,28,91,64,255,184,1,194,14,24,10,56,47,165,26,29,24,94,65,1,2,185,254,60,36,89,24,25,1,198,62,105,94,45,42,58,15,1,160,253,24,5,12,8,34,112,101,1,216,254,40,85,129,50,42,73,18,254,90,2,237,2,54,62,66,111,254,58,0,0,1,0,82,0,0,4,4,5,31,0,29,0,20,64,9,9,16,122,114,27,1,1,0,10,0,63,50,17,51,43,50,48,49,115,53,33,17,52,38,39,38,38,35,34,6,7,53,54,54,51,50,22,23,22,22,23,30,2,21,17,51,21,83,2,116,108,105,25,64,41,47,140,99,74,145,72,100,135,61,62,82,25,16,18,8,148,137,3,12,118,112,15,5,5,7,7,139,7,7,17,22,23,72,56,27,62,70,41,252,240,137,0,1,0,49,255,248,2,154,5,31,0,38,0,23,64,11,31,10,33,32,17,23,122,7,0,10,114,0,43,50,63,51,57,57,63,48,49,87,34,38,39,55,22,22,51,50,54,55,54,54,53,17,52,38,35,34,6,7,53,54,51,50,22,23,22,22,21,17,35,39,35,6,6,7,6,6,179,27,65,38,22,29,61,33,78,128,40,27,30,52,82,35,78,47,88,88,68,99,33,47,40,135,21,10,22,48,21,43,117,8,7,6,152,6,7,75,69,46,116,70,1,208,85,102,10,10,141,19,32,30,41,134,85,252,35,206,38,64,20,44,48,0,0,1,0,44,0,0,3,222,5,11,0,17,0,16,182,11,8,8,9,121,114,0,0,47,43,50,17,51,48,49,97,17,52,54,55,54,54,55,33,53,33,21,6,6,7,6,21,17,2,106,26,19,21,38,26,253,64,3,178,50,84,25,44,3,127,54,91,28,32,39,15,137,123,18,50,38,62,107,252,131,0,2,0,175,0,0,4,97,5,31,0,27,0,31,0,23,64,11,28,10,30,30,7,7,17,122,114,0,10,0,63,43,50,17,51,47,63,48,49,97,17,52,38,39,38,38,35,34,6,7,53,54,54,55,54,54,51,50,22,23,22,22,23,22,22,21,17,33,17,51,17,3,183,105,105,24,75,48,63,205,151,47,90,42,80,127,48,113,141,62,62,82,24,15,13,252,78,168,3,149,117,112,15,5,6,12,13,140,5,6,3,5,5,20,26,26,80,63,40,86,53,252,107,3,31,252,225,0,0,1,0,175,0,0,1,87,5,11,0,3,0,11,180,1,121,114,0,10,0,63,43,48,49,115,17,51,17,175,168,5,11,250,245,0,0,1,0,62,0,0,1,255,5,11,0,22,0,17,183,11,8,8,9,121,114,0,10,0,63,43,50,17,51,48,49,115,17,52,54,55,54,54,55,33,53,33,21,14,2,7,6,6,7,6,6,21,17,183,34,29,24,48,25,254,231,1,193,21,37,33,13,16,23,7,5,5,2,217,86,153,54,44,66,22,137,124,16,46,54,29,37,89,42,28,63,34,253,39,0,1,0,175,0,0,4,97,5,31,0,29,0,23,64,11,18,10,28,25,25,1,7,122,114,0,10,0,63,43,50,50,17,51,63,48,49,115,17,54,54,55,54,54,51,50,22,23,22,22,23,22,22,21,17,35,17,52,38,39,38,38,35,34,6,7,17,175,13,56,43,93,160,66,115,142,62,62,82,24,15,13,170,110,109,23,69,45,46,126,80,5,7,2,4,4,7,7,20,25,26,79,64,39,87,54,252,107,3,149,120,114,14,3,4,6,6,251,120,0,0,1,0,165,255,236,4,148,5,31,0,54,0,21,64,11,30,37,122,114,10,121,114,18,0,11,114,0,43,50,43,43,50,48,49,69,34,38,39,38,38,39,38,38,53,17,51,17,20,22,23,22,22,51,50,54,55,54,54,53,52,38,39,38,38,35,34,6,7,53,54,54,51,50,22,23,22,22,23,22,22,21,20,6,7,6,6,7,6,6,2,154,70,128,52,54,89,32,39,37,169,53,52,37,116,75,78,118,37,59,40,38,53,42,125,72,20,41,21,28,55,26,70,124,52,54,83,28,32,33,24,24,31,99,68,54,131,20,28,31,31,96,69,80,205,130,2,129,253,127,151,215,64,46,52,55,48,74,227,123,121,218,74,57,52,5,4,140,5,4,29,32,31,99,69,76,200,125,102,171,71,90,130,41,32,33,0,1,0,162,1,211,1,75,5,11,0,4,0,14,181,3,0,0,1,121,114,0,43,50,47,51,48,49,83,17,51,17,7,162,169,121,1,211,3,56,253,95,151,0,0,1,0,34,254,20,3,79,5,30,0,32,0,12,180,9,22,122,114,0,0,47,43,50,48,49,65,17,52,38,39,38,38,39,38,35,34,6,7,6,6,7,53,54,54,55,54,54,51,50,22,23,22,22,23,22,22,21,17,2,164,31,34,17,46,27,79,126,46,82,38,23,72,21,25,66,41,42,92,50,102,180,56,29,46,18,33,33,254,20,4,188,93,149,58,31,49,18,54,9,8,4,20,5,144,8,14,6,6,6,69,55,29,67,39,70,166,95,251,68,0,1,0,70,255,236,3,115,5,30,0,56,0,16,183,24,37,122,114,8,0,11,114,0,43,50,43,50,48,49,69,34,38,39,53,30,2,51,50,54,55,54,54,55,54,54,53,53,52,38,39,38,38,35,34,6,7,6,6,7,53,54,54,55,54,54,51,50,22,23,22,22,23,30,2,21,21,20,6,7,6,6,7,6,6,1,131,92,154,71,33,101,115,54,65,103,35,34,51,14,15,23,46,49,45,135,85,59,119,62,16,22,5,32,56,39,41,95,53,102,181,56,28,46,19,22,29,14,27,27,23,66,46,69,166,20,17,17,153,11,21,13,36,29,28,76,39,40,111,62,177,110,176,59,53,54,17,17,5,6,1,144,11,12,6,6,5,69,55,29,67,39,47,105,115,64,177,86,146,63,53,83,31,62,39,0,0,1,0,54,0,0,3,144,6,29,0,10,0,20,64,9,8,3,3,5,6,121,114,0,10,0,63,43,205,51,17,51,48,49,97,19,19,33,17,51,17,33,21,3,3,1,205,95,190,253,76,168,2,178,187,95,1,238,2,146,1,157,254,243,143,253,116,254,11,0,0,2,0,168,0,0,4,90,5,31,0,17,0,32,0,15,182,29,7,122,114,18,0,10,0,63,50,43,50,48,49,115,17,54,54,55,54,54,51,50,22,23,22,22,23,22,22,21,17,37,33,17,52,38,39,38,38,39,38,38,35,34,6,7,168,12,56,42,94,160,67,117,144,64,58,78,25,15,14,252,247,2,95,34,35,26,73,46,24,71,47,46,126,79,5,7,2,4,3,8,7,21,27,25,75,60,36,85,51,252,93,137,3,29,65,87,27,22,25,5,4,3,6,6,0,1,0,99,0,0,4,72,5,31,0,53,0,31,64,16,37,36,10,52,19,18,46,46,25,122,114,15,121,114,0,10,0,63,43,43,50,17,51,51,51,63,51,48,49,115,19,54,54,53,52,38,39,46,2,39,38,38,39,51,22,22,23,51,54,54,55,54,54,51,50,22,23,22,22,23,22,22,21,17,33,53,33,17,52,38,39,46,2,35,34,6,7,6,6,7,3,99,90,2,1,7,8,2,16,15,2,4,9,4,163,18,24,6,13,13,77,39,39,128,73,67,110,43,30,49,18,30,31,254,71,1,16,34,34,20,53,69,44,64,114,35,33,53,16,92,3,193,19,29,14,30,53,34,10,47,45,7,12,23,12,40,69,30,20,60,20,21,33,34,30,22,55,32,56,145,88,252,175,137,2,200,77,119,39,26,39,21,38,25,24,59,33,252,33,0,0,1,0,100,254,24,1,79,5,11,0,17,0,10,179,8,121,114,0,0,47,43,48,49,83,17,52,38,38,39,38,38,39,51,22,22,23,30,2,21,17,167,13,24,17,3,6,4,170,4,9,5,8,22,17,254,24,5,93,64,127,121,54,10,20,10,11,30,19,25,117,142,62,250,163,0,0,1,0,117,0,0,2,217,5,31,0,34,0,15,182,12,19,122,114,1,0,10,0,63,50,43,50,48,49,115,53,33,54,54,53,17,52,38,39,38,38,35,34,6,7,53,54,54,51,50,22,23,22,22,23,22,22,21,17,20,6,6,7,7,117,1,164,12,11,24,24,19,49,32,40,84,45,38,89,52,58,86,32,30,45,15,20,21,10,14,7,9,137,55,106,52,2,122,48,77,25,17,20,9,8,142,8,7,22,20,19,56,32,35,90,53,253,134,50,113,103,33,51,0,0,2,0,110,255,236,4,94,5,31,0,35,0,60,0,23,64,11,13,12,49,49,19,122,114,36,0,11,114,0,43,50,43,50,17,51,51,48,49,69,34,39,38,38,39,38,38,53,52,54,54,55,55,7,53,62,2,51,50,22,23,22,22,23,22,22,21,20,6,7,6,6,7,6,39,50,54,55,62,2,53,52,38,39,38,38,35,34,6,7,6,6,21,20,22,23,22,22,2,101,140,101,73,107,33,24,25,37,75,56,3,153,92,168,155,70,82,141,57,53,82,28,31,31,19,19,31,109,76,106,145,78,118,37,37,43,17,74,62,35,98,54,52,77,40,86,81,48,49,37,117,20,56,39,134,96,70,172,101,118,191,148,52,3,7,142,5,7,4,40,41,35,105,69,74,186,113,88,153,65,106,151,44,61,141,56,50,48,137,158,78,189,217,53,31,34,2,4,88,251,179,148,211,62,50,56,0,1,0,60,255,202,4,116,5,11,0,25,0,24,64,13,23,1,2,5,9,20,6,0,14,6,121,114,0,0,47,43,50,18,23,57,48,49,87,53,37,54,54,55,1,51,19,19,62,2,55,19,51,3,14,2,7,6,4,7,6,6,60,1,12,28,59,29,254,210,166,153,120,94,146,92,13,54,160,54,8,43,71,48,83,254,242,183,90,160,54,139,40,5,12,9,4,116,253,189,254,3,46,153,204,122,2,51,253,210,84,152,137,61,120,158,27,14,23,0,0,1,0,89,254,20,4,61,5,31,0,47,0,23,64,10,21,20,22,22,0,7,37,122,114,0,0,47,43,50,18,57,47,51,51,48,49,65,17,52,38,39,38,38,35,34,6,7,6,6,21,20,22,23,22,22,23,23,7,39,34,38,39,38,38,53,52,54,55,54,54,55,54,54,51,50,22,23,22,22,23,22,22,21,17,3,147,49,48,40,121,75,75,137,41,38,42,47,47,30,76,47,30,27,26,91,151,51,43,48,64,53,26,77,33,55,119,65,78,134,54,50,81,30,38,39,254,20,4,114,149,210,61,53,51,49,50,43,110,60,80,118,36,22,30,8,5,125,1,71,64,54,146,90,93,159,54,27,52,16,25,25,33,35,30,92,62,78,207,128,251,142,0,1,0,110,255,236,4,81,5,31,0,74,0,25,64,12,40,41,41,0,27,57,122,114,9,0,11,114,0,43,50,43,50,18,57,47,51,48,49,69,34,38,38,39,39,53,22,22,51,50,54,55,54,54,55,54,54,53,52,38,39,38,38,39,38,38,35,34,6,7,6,6,21,20,22,23,22,22,23,23,7,39,38,38,39,38,38,39,38,38,53,52,54,55,54,54,51,50,22,23,22,22,23,22,22,21,20,6,7,6,6,7,6,6,2,86,61,115,98,37,41,90,177,88,74,114,37,39,47,9,5,4,16,21,21,71,57,31,69,39,77,119,36,48,56,47,40,33,80,47,30,27,26,55,97,41,38,64,23,32,33,79,65,72,178,97,83,140,56,45,75,27,38,40,45,41,33,90,52,51,123,20,4,8,5,5,137,10,10,50,42,44,136,74,45,85,51,89,141,67,68,99,29,15,16,42,33,43,127,67,73,120,38,30,33,1,4,126,2,1,25,24,22,61,38,50,127,73,108,174,53,61,59,38,37,30,88,56,79,207,130,140,217,78,59,86,26,30,30,0,0,1,0,3,254,20,3,111,5,11,0,21,0,23,64,12,20,19,1,4,7,5,0,11,2,121,114,0,0,47,43,50,18,23,57,48,49,65,17,1,51,1,54,54,55,54,54,53,17,51,17,20,6,7,6,6,7,7,17,1,19,254,240,175,1,1,30,58,29,74,85,168,44,43,34,115,76,123,254,20,4,25,2,222,253,56,8,16,8,18,143,115,1,148,254,104,94,147,52,39,65,14,31,252,91,0,0,1,0,79,0,0,4,16,5,11,0,26,0,29,64,13,8,24,0,12,5,121,114,25,3,3,1,1,0,0,47,50,17,51,17,51,43,50,18,57,57,48,49,115,53,33,23,1,1,51,1,23,54,54,55,19,51,7,14,2,7,6,6,7,6,6,7,1,21,83,2,105,127,254,205,254,71,183,1,98,55,80,93,12,25,159,24,4,12,18,12,13,37,22,29,70,41,1,19,137,2,1,190,2,198,253,183,85,80,203,123,1,8,255,40,74,69,33,40,74,37,48,87,37,254,115,100,0,0,2,0,175,254,20,4,131,5,11,0,26,0,30,0,23,64,10,27,26,28,28,15,12,12,13,121,114,0,43,50,17,51,51,47,47,47,48,49,97,52,52,53,52,54,55,62,2,55,19,33,53,33,21,3,14,2,7,14,3,21,21,1,17,51,17,2,168,35,21,5,22,28,13,174,252,221,3,212,180,6,24,25,7,8,22,22,14,253,96,169,7,13,7,51,165,86,22,83,98,45,2,65,137,120,253,172,16,84,89,26,26,91,102,90,24,27,254,20,4,232,251,24,0,0,1,0,44,0,0,3,94,5,31,0,25,0,12,180,7,15,122,114,0,0,47,43,50,48,49,97,17,52,38,39,38,38,35,34,6,6,7,53,54,54,51,50,22,23,22,22,23,22,22,21,17,2,181,108,107,24,57,32,39,116,120,46,89,148,61,120,142,62,62,82,25,14,13,3,149,118,113,15,5,4,3,7,3,140,6,6,20,26,26,79,64,40,86,53,252,107,0,0,1,0,82,0,0,5,94,5,11,0,40,0,29,64,15,29,10,10,21,19,20,18,3,5,0,1,121,114,22,0,0,47,50,43,18,23,57,51,17,51,48,49,115,3,51,19,54,54,55,54,54,55,19,51,3,6,6,7,6,6,7,34,6,35,19,33,50,54,55,54,55,19,51,3,6,6,7,6,6,7,6,6,35,191,109,161,61,67,122,40,47,47,9,28,157,28,13,60,61,56,163,117,2,4,1,24,1,23,138,236,77,76,17,53,158,54,11,66,53,54,142,98,64,145,78,5,11,253,31,16,57,47,57,164,93,1,47,254,210,134,191,71,68,80,20,1,254,224,149,135,137,173,2,49,253,205,115,201,87,88,134,42,33,28,0,0,1,0,40,255,252,4,104,5,31,0,47,0,21,64,9,30,10,36,36,18,122,114,6,0,0,47,50,43,50,17,51,47,48,49,87,34,38,39,53,22,51,50,54,53,17,6,6,7,53,62,2,51,50,22,22,23,22,22,23,22,22,21,17,35,17,52,38,39,38,35,34,6,7,17,20,6,7,6,7,6,6,134,20,46,28,38,43,72,74,36,72,36,101,172,144,58,92,124,91,42,58,75,23,13,12,168,110,108,46,78,37,91,54,15,18,26,44,36,99,4,8,8,130,6,94,98,3,61,2,6,2,140,8,11,5,10,24,19,27,78,62,35,85,50,252,103,3,149,119,113,15,8,3,3,252,186,55,92,38,58,34,28,27,255,255,0,82,0,0,5,94,6,14,6,38,3,226,0,0,1,7,4,35,5,17,0,138,0,10,179,41,1,121,114,0,43,206,48,49,255,255,0,76,0,0,5,94,6,12,6,38,3,226,0,0,1,7,4,36,0,146,0,136,0,10,179,41,1,121,114,0,43,206,48,49,255,255,0,82,0,0,5,97,6,14,6,38,3,226,0,0,0,39,4,33,3,30,255,119,1,7,4,35,5,21,0,138,0,10,179,52,1,121,114,0,43,206,48,49,255,255,0,80,0,0,5,94,6,12,6,38,3,226,0,0,0,39,4,33,3,30,255,119,1,7,4,36,0,150,0,136,0,10,179,52,1,121,114,0,43,206,48,49,255,255,0,113,255,34,4,66,5,11,6,38,3,201,0,0,0,7,4,28,2,90,255,229,255,255,0,113,254,88,4,66,5,11,6,38,3,201,0,0,0,7,4,29,2,88,255,233,255,255,0,113,0,0,4,66,5,11,6,38,3,201,0,0,0,7,4,33,1,220,254,250,255,255,0,82,0,0,4,4,5,31,6,38,3,202,0,0,0,7,4,33,1,121,0,81,255,255,0,49,255,248,2,154,5,31,6,38,3,203,0,0,0,7,4,33,0,250,0,81,255,255,0,44,0,0,3,222,5,11,6,38,3,204,0,0,0,7,4,33,1,89,0,81,255,255,0,175,0,0,4,97,5,31,6,38,3,205,0,0,0,7,4,33,2,124,0,81,255,255,255,190,0,0,1,87,5,11,6,38,3,206,0,0,0,6,4,33,254,81,255,255,255,199,0,0,1,255,5,11,6,38,3,207,0,0,0,6,4,33,7,82,255,255,0,165,255,236,4,148,5,31,6,38,3,209,0,0,0,7,4,33,2,141,0,81,255,255,255,195,1,211,1,75,5,11,6,38,3,210,0,0,0,7,4,33,0,3,1,64,255,255,0,34,254,20,3,79,5,30,6,38,3,211,0,0,0,7,4,33,1,87,0,82,255,255,0,70,255,236,3,115,5,30,6,38,3,212,0,0,0,7,4,33,1,94,0,82,255,255,0,54,0,0,3,144,6,29,6,38,3,213,0,0,0,7,4,33,1,60,0,81,255,255,0,99,0,0,4,72,5,31,6,38,3,215,0,0,0,7,4,33,2,113,0,81,255,255,0,117,0,0,2,217,5,31,6,38,3,217,0,0,0,7,4,33,1,86,0,82,255,255,0,110,255,236,4,94,5,31,6,38,3,218,0,0,0,7,4,33,2,96,0,81,255,255,0,89,254,20,4,61,5,31,6,38,3,220,0,0,0,7,4,33,2,61,1,16,255,255,0,110,255,236,4,81,5,31,6,38,3,221,0,0,0,7,4,33,2,89,1,3,255,255,0,79,0,0,4,16,5,11,6,38,3,223,0,0,0,7,4,33,1,2,255,173,255,255,0,175,254,20,4,131,5,11,6,38,3,224,0,0,0,7,4,33,2,71,0,80,255,255,0,44,0,0,3,94,5,31,6,38,3,225,0,0,0,7,4,33,1,79,0,81,255,255,0,82,0,0,5,94,5,11,6,38,3,226,0,0,0,7,4,33,3,30,255,119,255,255,0,40,255,252,4,104,5,31,6,38,3,227,0,0,0,7,4,33,2,163,0,79,255,255,0,175,0,0,1,87,5,206,6,38,3,206,0,0,1,7,4,30,1,4,255,182,0,10,179,4,1,121,114,0,43,206,48,49,255,255,252,25,4,217,253,174,6,33,4,7,0,67,251,199,0,0,255,255,253,128,4,217,255,21,6,33,4,7,0,118,253,46,0,0,255,255,254,176,4,217,1,81,6,32,4,7,1,74,254,94,0,0,255,255,252,24,4,220,254,255,5,221,4,7,1,81,251,198,0,0,255,255,254,213,4,219,1,44,5,97,4,7,1,76,254,131,0,0,255,255,254,202,4,217,1,56,5,231,4,7,1,77,254,120,0,0,255,255,255,158,5,8,0,102,5,226,4,7,1,78,255,76,0,0,255,255,254,229,5,16,1,26,5,210,4,7,0,106,253,175,0,0,255,255,255,37,4,218,0,227,6,136,4,7,1,79,254,211,0,0,255,255,255,6,4,217,1,216,6,33,4,7,1,82,254,180,0,0,255,255,254,175,4,217,1,80,6,32,4,7,1,75,254,93,0,0,0,2,251,229,4,217,254,183,6,33,0,12,0,25,0,37,64,17,4,17,17,19,11,24,24,0,13,19,128,6,6,15,19,1,19,0,47,93,51,47,26,16,205,50,50,17,51,17,51,17,51,48,49,65,30,2,23,21,35,46,3,39,53,35,30,2,23,21,35,46,3,39,53,254,1,22,63,68,29,96,34,79,77,62,17,173,22,62,68,29,95,35,80,76,62,17,6,33,46,112,107,39,24,29,81,89,81,28,20,46,112,107,39,24,29,81,89,81,28,20,255,255,255,97,3,193,0,136,5,182,4,7,2,5,255,70,0,0,0,1,253,58,254,161,254,3,255,123,0,11,0,8,177,0,6,0,47,51,48,49,65,34,38,53,52,54,51,50,22,21,20,6,253,158,42,58,58,42,43,58,58,254,161,54,55,56,53,53,56,55,54,0,255,255,255,55,254,20,0,198,0,0,4,7,0,122,255,27,0,0,255,255,255,91,254,62,0,166,0,30,4,7,1,80,255,9,0,0,0,1,253,64,4,215,254,47,6,56,0,18,0,12,179,14,3,128,15,0,47,26,204,51,48,49,65,52,54,51,50,22,21,20,14,2,21,20,22,23,21,46,2,253,64,68,55,44,50,30,38,30,59,61,78,107,54,5,184,57,71,40,38,26,26,15,19,21,28,50,18,72,20,63,87,0,0,1,253,68,4,215,254,49,6,56,0,18,0,12,179,16,128,5,4,0,47,51,26,204,48,49,65,20,6,6,7,53,54,54,53,52,46,2,53,52,54,51,50,22,254,49,54,105,78,59,61,30,38,30,51,43,55,66,5,184,55,87,63,20,72,18,50,28,21,19,15,26,26,38,40,71,0,1,252,87,4,146,255,52,5,178,0,20,0,15,180,13,9,9,3,0,0,47,205,51,124,16,204,48,49,65,6,6,35,34,38,53,52,54,51,33,54,54,51,50,22,21,20,6,6,35,253,12,5,40,47,49,40,41,50,1,202,5,43,45,49,42,18,41,34,4,240,44,50,52,49,52,41,47,47,49,50,35,42,18,0,1,252,90,4,227,255,63,5,217,0,22,0,18,182,17,16,16,10,0,128,7,0,47,26,204,50,51,47,51,48,49,65,50,30,2,21,21,35,52,38,35,34,14,2,35,35,53,51,50,62,2,254,88,55,86,59,31,120,67,47,46,101,117,140,85,18,15,78,129,115,113,5,217,27,54,80,54,31,75,49,35,47,35,121,36,46,36,0,2,255,193,254,13,0,76,255,171,0,11,0,23,0,15,180,12,18,18,0,6,0,124,47,51,50,47,51,48,49,87,34,38,53,52,54,51,50,22,21,20,6,3,34,38,53,52,54,51,50,22,21,20,6,5,33,35,35,33,35,36,36,35,33,35,35,33,35,36,36,240,39,38,38,40,40,38,38,39,254,253,40,38,38,40,40,37,39,40,0,5,254,160,254,10,1,77,255,168,0,11,0,22,0,34,0,46,0,58,0,32,64,13,47,53,53,6,35,41,41,23,29,29,0,17,6,0,124,47,51,51,50,17,51,51,17,51,17,51,17,51,48,49,69,34,38,53,52,54,51,50,22,21,20,6,51,34,53,52,54,51,50,22,21,20,6,3,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,3,34,38,53,52,54,51,50,22,21,20,6,254,229,34,35,35,34,34,36,36,255,69,35,34,34,36,36,179,34,35,36,33,35,36,36,1,111,33,35,35,33,35,35,35,35,33,35,35,33,35,35,35,244,40,38,38,40,40,38,38,40,78,38,40,40,38,38,40,254,254,39,39,39,39,40,38,38,40,39,39,38,40,40,38,38,40,1,2,40,38,38,40,40,38,38,40,0,3,254,210,254,10,1,31,255,168,0,3,0,15,0,27,0,24,64,9,4,10,10,16,16,22,22,0,1,0,124,47,51,51,17,51,17,51,17,51,48,49,69,53,33,21,19,34,38,53,52,54,51,50,22,21,20,6,3,34,38,53,52,54,51,50,22,21,20,6,254,210,1,103,159,34,35,36,33,34,37,36,35,34,35,36,33,34,37,36,206,82,82,254,216,39,39,39,39,40,38,38,40,1,2,40,38,39,39,40,38,38,40,0,0,3,254,210,254,10,1,31,255,168,0,7,0,19,0,31,0,27,64,10,8,14,14,20,20,26,26,0,128,3,0,124,47,26,24,204,51,17,51,17,51,17,51,48,49,67,53,35,53,33,21,35,21,5,34,38,53,52,54,51,50,22,21,20,6,3,34,38,53,52,54,51,50,22,21,20,6,164,138,1,102,138,1,42,34,35,35,34,35,36,36,35,34,35,35,34,35,36,36,254,104,202,82,82,202,94,39,39,38,40,40,38,38,40,1,2,40,38,38,40,40,38,38,40,0,1,255,186,255,13,0,70,255,169,0,10,0,9,177,0,5,0,124,47,51,48,49,71,34,53,52,54,51,50,22,21,20,6,2,68,35,33,36,36,36,243,78,38,40,40,38,38,40,0,0,2,255,34,255,18,0,207,255,173,0,11,0,23,0,15,180,0,6,6,12,18,0,124,47,51,51,17,51,48,49,87,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,136,34,35,35,34,34,37,37,254,188,33,35,36,32,35,35,35,238,39,38,39,39,40,38,37,40,39,39,39,38,40,37,38,40,0,0,3,255,34,254,10,0,207,255,168,0,11,0,23,0,35,0,25,64,9,0,6,24,24,30,12,18,18,30,0,124,47,51,17,51,17,51,24,16,206,50,48,49,67,34,38,53,52,54,51,50,22,21,20,6,19,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,9,34,35,35,34,35,36,36,110,34,35,35,34,34,37,37,254,188,33,35,36,32,35,35,35,254,10,39,39,38,40,40,38,38,40,1,2,39,39,38,40,40,38,38,40,40,38,39,39,40,38,38,40,0,1,255,70,255,61,0,179,255,143,0,3,0,9,177,0,1,0,124,47,51,48,49,71,53,33,21,186,1,109,195,82,82,0,0,1,255,72,254,111,0,179,255,139,0,7,0,10,178,0,128,3,0,47,26,204,48,49,67,53,35,53,33,21,35,21,43,141,1,107,141,254,111,201,83,83,201,0,0,1,255,187,5,125,0,71,6,24,0,10,0,8,177,5,0,0,47,50,48,49,67,34,53,52,54,51,50,22,21,20,6,1,68,35,34,35,36,36,5,125,77,39,39,40,38,38,39,0,0,1,255,192,4,233,0,76,5,132,0,11,0,8,177,6,0,0,47,50,48,49,83,34,38,53,52,54,51,50,22,21,20,6,4,33,35,35,33,35,37,37,4,233,39,38,39,39,40,38,38,39,0,3,255,40,253,237,0,229,255,165,0,11,0,23,0,35,0,22,183,24,30,30,12,18,18,0,6,0,124,47,24,205,50,47,205,50,47,205,48,49,71,34,38,53,52,54,51,50,22,21,20,6,23,34,38,53,52,54,51,50,22,21,20,6,23,34,38,53,52,54,51,50,22,21,20,6,148,33,35,36,32,35,35,35,117,34,35,35,34,35,36,36,119,34,35,35,34,35,36,36,246,39,38,39,39,40,38,38,39,143,40,39,38,40,40,38,38,41,142,40,39,38,40,40,38,39,40,0,0,1,255,192,1,252,0,76,2,151,0,10,0,8,177,5,0,0,47,50,48,49,83,34,53,52,54,51,50,22,21,20,6,4,68,35,33,35,37,37,1,252,77,39,39,40,38,37,40,0,0,1,255,208,254,54,0,45,255,114,0,3,0,10,178,0,128,1,0,47,26,205,48,49,67,17,51,17,48,93,254,54,1,60,254,196,0,1,255,192,4,233,0,76,5,132,0,10,0,8,177,5,0,0,47,50,48,49,83,34,53,52,54,51,50,22,21,20,6,4,68,35,33,35,37,37,4,233,77,39,39,40,38,38,39,0,0,1,255,186,4,233,0,70,5,132,0,11,0,8,177,6,0,0,47,50,48,49,67,34,38,53,52,54,51,50,22,21,20,6,2,34,34,35,33,36,36,36,4,233,39,38,39,39,40,38,38,39,0,1,255,83,254,220,0,143,255,187,0,7,0,18,181,6,2,2,0,128,3,0,124,47,26,24,204,51,17,51,48,49,67,53,35,53,33,21,35,21,54,119,1,60,120,254,220,144,79,79,144,0,255,255,0,41,255,240,2,158,3,126,6,7,3,119,0,0,252,172,255,255,0,76,0,0,1,225,3,109,6,7,0,123,0,0,252,172,255,255,0,50,0,0,2,115,3,127,6,7,0,116,0,0,252,172,255,255,0,37,255,241,2,141,3,127,6,7,0,117,0,0,252,172,255,255,0,21,0,0,2,181,3,115,6,7,2,55,0,0,252,172,255,255,0,62,255,238,2,139,3,109,6,7,2,56,0,0,252,172,255,255,0,41,255,240,2,161,3,125,6,7,3,120,0,0,252,172,255,255,0,58,0,0,2,146,3,109,6,7,2,57,0,0,252,172,255,255,0,52,255,241,2,148,3,124,6,7,2,58,0,0,252,172,255,255,0,35,255,240,2,156,3,129,6,7,3,121,0,0,252,172,0,2,0,115,255,236,4,55,5,205,0,17,0,31,0,16,183,28,14,5,114,21,5,13,114,0,43,50,43,50,48,49,65,20,2,6,6,35,34,38,38,2,53,52,18,54,51,50,22,18,5,16,18,51,50,18,17,52,2,38,35,34,6,2,4,55,54,116,184,129,123,181,119,58,95,211,175,166,213,104,252,227,145,169,169,146,62,138,115,115,138,61,2,221,178,254,232,194,101,101,193,1,24,179,235,1,80,181,179,254,175,236,254,205,254,208,1,47,1,52,201,1,15,137,137,254,241,0,0,1,0,51,0,0,2,73,5,182,0,13,0,21,64,10,10,9,9,5,11,4,114,13,12,114,0,43,43,50,50,47,51,48,49,97,17,52,54,54,55,6,6,7,7,39,1,51,17,1,166,2,3,3,31,55,40,166,87,1,139,139,4,12,59,85,71,37,32,45,33,134,113,1,49,250,74,0,0,1,0,79,0,0,4,12,5,203,0,29,0,23,64,11,9,17,5,114,26,1,27,27,0,12,114,0,43,50,17,51,51,43,50,48,49,115,53,1,62,2,53,52,38,35,34,6,7,39,62,2,51,50,22,22,21,20,6,6,7,1,21,33,21,79,1,135,109,149,78,147,119,106,163,84,89,58,136,158,90,134,196,106,92,165,112,254,194,2,235,139,1,141,110,172,167,100,124,131,72,66,112,49,76,44,94,174,120,116,199,195,109,254,195,7,152,0,0,1,0,87,255,236,4,21,5,203,0,45,0,29,64,13,4,3,29,29,26,26,11,36,43,5,18,11,13,0,63,51,63,51,18,57,47,51,18,57,57,48,49,65,20,6,7,21,22,22,21,20,6,6,35,34,38,39,53,22,22,51,50,54,54,53,52,38,38,35,35,53,51,50,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,3,232,167,137,174,175,119,245,191,116,197,90,91,214,100,133,167,78,99,186,130,145,147,119,166,87,148,127,118,173,83,84,80,230,146,224,224,4,97,147,177,27,8,22,180,146,127,196,111,37,43,156,45,51,72,133,92,95,117,55,142,70,127,87,111,121,69,56,114,62,90,203,0,0,2,0,48,0,0,4,112,5,190,0,10,0,21,0,29,64,13,6,3,11,11,9,16,4,1,1,4,4,0,12,0,63,63,57,47,18,57,51,51,17,51,51,48,49,97,17,33,53,1,51,17,51,21,35,17,3,17,52,54,54,55,35,6,6,7,1,2,244,253,60,2,185,172,219,219,161,1,4,3,8,22,64,25,254,80,1,83,140,3,223,252,43,150,254,173,1,233,1,222,73,116,92,37,40,100,35,253,147,0,0,1,0,126,255,236,4,23,5,182,0,33,0,33,64,15,26,25,25,22,22,31,0,0,8,30,27,4,15,8,13,0,63,51,63,51,18,57,47,51,51,17,51,17,51,48,49,65,50,22,22,21,20,6,6,35,34,38,39,53,22,22,51,50,54,54,53,52,38,35,34,6,7,39,19,33,21,33,3,54,54,2,45,150,220,120,130,243,170,115,196,67,73,208,98,111,167,93,179,192,63,148,47,85,56,2,216,253,182,36,37,121,3,126,101,192,137,150,217,117,40,40,158,44,52,71,145,110,146,159,20,12,55,2,174,152,254,72,7,17,0,2,0,115,255,236,4,47,5,203,0,34,0,49,0,27,64,12,18,41,41,22,22,6,35,30,13,13,6,5,0,63,51,63,51,18,57,47,51,17,51,48,49,83,52,62,3,51,50,22,23,21,38,38,35,34,6,2,7,51,62,2,51,50,22,22,21,20,6,6,35,34,46,2,1,50,54,53,52,38,39,38,6,6,21,20,30,2,115,37,88,151,227,159,46,103,34,37,94,48,185,214,95,7,12,31,96,137,91,128,191,105,113,207,142,107,181,133,73,1,236,135,164,146,146,100,148,82,39,79,122,2,113,132,252,217,164,93,9,10,143,13,12,161,254,235,174,50,81,48,104,198,141,151,220,119,82,162,241,254,167,174,176,144,167,1,1,83,127,65,66,136,116,70,0,1,0,17,0,0,3,224,5,182,0,6,0,16,182,6,12,5,2,2,3,4,0,63,51,17,51,63,48,49,115,1,33,53,33,21,1,214,2,88,252,227,3,207,253,172,5,30,152,128,250,202,0,3,0,122,255,236,4,58,5,203,0,31,0,48,0,62,0,23,64,12,40,41,8,24,49,5,56,16,5,32,0,13,0,63,50,63,51,23,57,48,49,69,34,38,38,53,52,54,54,55,46,2,53,52,54,54,51,50,22,22,21,20,6,6,7,30,2,21,20,6,6,39,50,54,54,53,52,38,38,39,39,14,2,21,20,22,22,19,62,2,53,52,38,35,34,6,21,20,22,22,2,94,155,216,113,85,142,85,74,120,71,113,195,124,128,196,110,77,128,79,93,150,88,118,214,148,102,142,74,76,139,96,36,92,129,67,70,141,113,74,119,69,148,124,117,150,74,125,20,93,175,123,101,149,108,37,40,102,137,91,111,155,81,80,155,113,89,133,99,39,43,108,146,100,123,179,96,133,66,118,79,73,111,88,36,13,38,93,118,78,74,117,66,2,215,31,76,107,75,106,112,113,106,76,105,75,0,2,0,102,255,236,4,35,5,203,0,34,0,49,0,27,64,12,18,41,41,22,22,6,35,30,5,13,6,13,0,63,51,63,51,18,57,47,51,17,51,48,49,65,20,14,3,35,34,38,39,53,22,22,51,50,54,18,55,35,14,2,35,34,38,38,53,52,54,54,51,50,30,2,1,34,6,21,20,22,23,50,54,54,53,52,46,2,4,35,37,89,152,229,159,43,110,35,37,100,48,187,213,95,6,12,30,97,138,92,127,189,104,115,208,141,107,180,133,73,254,19,134,165,143,147,102,150,81,39,80,122,3,71,133,252,217,165,92,10,11,143,13,15,161,1,20,174,48,81,49,104,198,140,152,220,120,82,163,240,1,88,173,176,144,166,1,81,125,66,66,136,115,71,255,255,0,41,2,58,2,158,5,200,6,7,3,119,0,0,254,246,255,255,0,76,2,74,1,225,5,183,6,7,0,123,0,0,254,246,255,255,0,50,2,74,2,115,5,201,6,7,0,116,0,0,254,246,255,255,0,37,2,59,2,141,5,201,6,7,0,117,0,0,254,246,255,255,0,21,2,74,2,181,5,189,6,7,2,55,0,0,254,246,255,255,0,62,2,56,2,139,5,183,6,7,2,56,0,0,254,246,255,255,0,41,2,58,2,161,5,199,6,7,3,120,0,0,254,246,255,255,0,58,2,74,2,146,5,183,6,7,2,57,0,0,254,246,255,255,0,52,2,59,2,148,5,198,6,7,2,58,0,0,254,246,255,255,0,35,2,58,2,156,5,203,6,7,3,121,0,0,254,246,0,2,0,112,255,236,4,61,4,94,0,15,0,27,0,16,183,22,8,7,114,16,0,11,114,0,43,50,43,50,48,49,69,34,38,2,53,52,54,54,51,50,30,2,21,16,2,39,50,54,53,52,38,35,34,6,21,20,22,2,83,162,215,106,112,218,159,122,181,121,60,245,243,161,154,157,159,157,157,156,20,145,1,2,169,171,254,141,81,151,208,126,254,253,254,199,140,218,214,211,215,215,211,208,224,0,0,1,0,42,0,0,2,102,4,94,0,13,0,18,183,11,10,10,6,12,6,114,0,0,47,43,50,50,17,51,48,49,97,35,17,52,54,54,55,6,6,7,7,39,1,51,2,102,168,2,5,2,19,63,41,208,82,1,176,140,2,154,54,103,91,35,20,56,29,153,113,1,58,0,0,1,0,85,0,0,3,248,4,94,0,29,0,21,64,9,11,18,7,114,27,2,28,28,1,0,47,51,17,51,51,43,50,48,49,97,33,53,1,62,2,53,52,38,38,35,34,6,7,39,54,54,51,50,22,22,21,20,6,6,7,5,23,33,3,248,252,93,1,151,107,128,58,57,113,84,87,172,83,88,103,223,131,123,177,96,72,138,100,254,215,2,2,155,135,1,33,76,103,99,68,64,91,49,66,69,115,87,77,78,144,100,93,140,123,70,216,6,0,1,0,59,254,154,3,203,4,95,0,45,0,29,64,13,5,4,29,29,26,26,12,36,43,7,114,19,12,0,47,51,43,50,18,57,47,51,18,57,57,48,49,65,20,6,6,7,21,22,22,21,20,6,6,35,34,38,39,53,22,22,51,50,54,53,52,38,38,35,35,53,51,50,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,3,158,66,128,93,170,162,127,233,160,128,184,80,74,195,107,173,186,96,180,126,128,130,99,165,99,151,113,106,154,88,76,86,217,130,187,237,2,254,92,140,92,21,6,20,169,154,135,192,103,45,39,149,38,57,157,142,89,113,54,140,54,121,100,111,119,58,60,114,71,72,186,0,0,2,0,46,254,166,4,104,4,94,0,10,0,21,0,30,64,14,17,16,7,6,114,6,11,11,9,9,4,2,1,10,0,63,205,51,51,17,51,17,51,43,50,50,48,49,101,35,17,35,17,33,53,1,51,17,51,33,17,52,54,54,55,35,6,6,7,1,4,104,228,163,253,77,2,171,171,228,254,121,2,4,3,7,16,60,45,254,110,35,254,131,1,125,110,3,205,252,76,1,184,63,108,105,56,31,96,66,253,189,0,1,0,121,254,153,4,21,4,72,0,33,0,33,64,15,26,25,25,22,22,31,0,0,8,30,27,6,114,15,8,0,47,51,43,50,18,57,47,51,51,17,51,17,51,48,49,65,50,22,22,21,20,6,6,35,34,38,39,53,22,22,51,50,54,54,53,52,38,35,34,6,7,39,19,33,21,33,3,54,54,2,43,146,221,123,132,245,170,115,192,70,94,189,98,114,166,91,191,172,64,140,68,77,55,2,223,253,183,39,63,115,2,18,95,188,141,154,207,104,44,40,153,47,52,69,140,106,149,152,19,20,46,2,182,148,254,68,12,14,0,2,0,118,255,236,4,54,5,206,0,33,0,48,0,31,64,15,16,17,40,40,21,21,5,34,29,13,114,12,5,5,114,0,43,50,43,50,18,57,47,51,17,51,51,48,49,83,52,18,54,54,23,50,22,23,21,38,38,35,34,6,2,7,51,62,2,51,50,22,22,21,20,6,6,35,34,46,2,1,50,54,53,52,38,39,38,6,6,23,20,30,2,118,91,173,248,157,47,92,45,41,94,55,155,220,122,9,11,42,111,134,75,137,192,101,110,207,147,126,186,123,61,1,236,143,158,149,141,87,151,93,1,42,81,119,2,109,220,1,70,214,105,1,11,10,139,12,11,137,254,236,210,62,88,46,107,201,141,149,221,122,96,173,234,254,149,181,171,147,166,1,2,80,128,72,67,137,114,70,0,1,0,33,254,173,3,237,4,72,0,6,0,16,182,6,5,2,2,3,6,114,0,43,50,17,51,47,48,49,83,1,33,53,33,21,1,239,2,66,252,240,3,204,253,184,254,173,5,9,146,106,250,207,0,3,0,103,255,236,4,41,5,203,0,31,0,47,0,61,0,26,64,14,44,24,8,55,4,0,36,16,13,114,48,0,5,114,0,43,50,43,50,17,23,57,48,49,65,50,22,22,21,20,6,6,7,30,2,21,20,6,6,35,34,38,38,53,52,54,54,55,46,2,53,52,54,54,3,20,22,22,51,50,54,54,53,52,38,38,39,14,2,1,34,6,21,20,22,22,23,62,2,53,52,38,2,72,128,195,111,77,130,79,94,151,88,119,214,144,155,217,113,86,142,84,73,121,71,113,197,194,70,142,106,101,142,75,73,153,121,92,129,68,1,60,118,150,73,126,78,74,118,70,149,5,203,80,155,113,89,133,99,39,43,108,146,100,123,179,96,93,175,123,101,149,108,37,40,102,137,91,111,155,81,251,167,74,117,66,66,118,79,73,110,93,45,38,93,118,3,131,113,106,76,105,75,32,31,76,107,75,106,112,0,2,0,98,254,154,4,37,4,94,0,32,0,47,0,27,64,12,17,39,39,21,21,5,33,28,7,114,12,5,0,47,51,43,50,17,57,47,51,17,51,48,49,65,20,2,6,6,35,34,38,39,53,22,22,51,50,54,18,55,35,14,2,35,34,38,53,52,54,54,51,50,30,2,1,34,6,21,20,22,23,50,54,54,53,52,46,2,4,37,88,171,252,164,56,100,43,43,105,46,158,228,129,10,8,39,107,140,92,199,223,112,208,144,117,185,129,68,254,16,144,157,151,142,87,150,92,39,79,121,1,217,217,254,198,202,98,12,10,140,13,14,131,1,16,209,67,90,45,233,210,147,219,122,83,163,241,1,91,183,160,151,162,1,71,126,80,68,135,111,66,0,0,3,0,103,255,236,4,43,5,205,0,3,0,20,0,36,0,26,64,14,0,1,3,2,4,9,33,17,5,114,25,9,13,114,0,43,50,43,50,18,23,57,48,49,65,39,1,23,19,20,2,6,6,35,34,38,2,53,52,18,54,51,50,22,18,5,20,18,22,51,50,54,18,53,52,2,38,35,34,6,2,1,30,106,2,175,106,94,54,116,184,129,163,213,105,95,212,174,165,214,104,252,227,62,139,113,113,139,63,62,138,115,115,138,61,1,90,107,2,174,106,254,212,178,254,232,194,101,178,1,81,238,234,1,81,181,179,254,175,236,204,254,240,135,134,1,16,205,201,1,15,137,137,254,241,0,255,255,0,72,255,236,4,21,4,94,4,6,4,68,216,0,255,255,0,151,0,0,2,211,4,94,4,6,4,69,109,0,255,255,0,95,0,0,4,2,4,94,4,6,4,70,10,0,255,255,0,75,254,154,3,219,4,95,4,6,4,71,16,0,255,255,0,7,254,166,4,65,4,94,4,6,4,72,217,0,255,255,0,96,254,153,3,252,4,72,4,6,4,73,231,0,255,255,0,84,255,236,4,20,5,206,4,6,4,74,222,0,255,255,0,66,254,173,4,14,4,72,4,6,4,75,33,0,255,255,0,76,255,236,4,14,5,203,4,6,4,76,229,0,255,255,0,70,254,154,4,9,4,94,4,6,4,77,228,0,255,255,0,41,254,230,2,158,2,116,6,7,3,119,0,0,251,162,255,255,0,76,254,246,1,225,2,99,6,7,0,123,0,0,251,162,255,255,0,50,254,246,2,115,2,117,6,7,0,116,0,0,251,162,255,255,0,37,254,231,2,141,2,117,6,7,0,117,0,0,251,162,255,255,0,21,254,246,2,181,2,105,6,7,2,55,0,0,251,162,255,255,0,62,254,228,2,139,2,99,6,7,2,56,0,0,251,162,255,255,0,41,254,230,2,161,2,115,6,7,3,120,0,0,251,162,255,255,0,58,254,246,2,146,2,99,6,7,2,57,0,0,251,162,255,255,0,52,254,231,2,148,2,114,6,7,2,58,0,0,251,162,255,255,0,35,254,230,2,156,2,119,6,7,3,121,0,0,251,162,0,1,0,82,4,131,2,66,5,11,0,3,0,8,177,1,0,0,47,50,48,49,83,53,33,21,82,1,240,4,131,136,136,0,0,1,0,80,1,219,1,141,6,32,0,13,0,8,177,11,3,0,47,196,48,49,83,52,18,55,51,6,2,21,20,18,23,35,38,2,80,98,91,128,97,100,99,98,128,88,101,3,254,172,1,14,104,109,254,231,156,152,254,229,112,98,1,21,255,255,0,80,254,100,1,141,2,169,6,7,4,100,0,0,252,137,0,1,0,61,1,219,1,123,6,32,0,13,0,8,177,4,10,0,47,198,48,49,65,20,2,7,35,54,18,53,52,2,39,51,22,18,1,123,100,89,129,100,99,101,98,129,91,98,4,1,173,254,240,105,111,1,30,151,157,1,22,110,104,254,234,0,255,255,0,61,254,100,1,123,2,169,6,7,4,102,0,0,252,137,0,1,0,72,2,144,2,102,4,185,0,11,0,18,182,7,5,4,4,10,0,1,0,47,51,51,51,17,51,51,48,49,65,53,35,53,51,53,51,21,51,21,35,21,1,37,221,221,100,221,221,2,144,227,100,226,226,100,227,0,0,2,0,72,3,2,2,102,4,70,0,3,0,7,0,12,179,4,5,1,0,0,47,50,206,50,48,49,83,53,33,21,5,53,33,21,72,2,30,253,226,2,30,3,227,99,99,225,100,100,255,255,0,72,255,25,2,102,1,66,6,7,4,104,0,0,252,137,255,255,0,72,255,139,2,102,0,207,6,7,4,105,0,0,252,137,255,255,0,21,0,0,2,217,5,182,6,6,0,18,0,0,0,2,0,174,0,0,5,162,5,182,0,15,0,31,0,37,64,17,16,16,14,14,25,1,4,114,8,8,18,18,31,31,0,12,114,0,43,50,17,51,17,51,124,47,43,50,50,17,51,125,47,48,49,115,17,33,50,22,22,21,17,35,17,52,38,38,35,33,17,19,51,17,33,50,54,54,53,17,51,17,20,6,6,35,33,174,1,204,144,190,93,152,69,131,93,254,224,213,154,1,22,104,141,71,153,93,200,163,254,67,5,182,113,204,135,253,131,2,124,105,143,74,250,205,4,66,252,65,75,146,104,3,238,252,18,129,207,120,0,2,0,113,2,215,5,214,5,201,0,20,0,61,0,51,64,28,3,31,58,34,54,51,38,15,11,9,41,7,7,14,14,0,0,28,21,41,192,4,1,1,48,41,3,114,0,43,50,50,47,51,26,16,204,50,50,47,51,47,51,47,17,23,57,48,49,65,17,51,19,19,51,17,35,17,52,54,55,35,3,35,3,35,22,22,21,17,5,34,38,39,53,22,22,51,50,54,53,52,38,39,46,2,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,23,30,2,21,20,6,6,2,227,180,198,204,173,122,5,1,8,211,101,202,7,2,3,253,237,58,110,37,41,112,61,81,85,84,83,50,101,67,144,119,60,104,45,30,38,94,52,70,74,83,84,71,97,51,70,130,2,229,2,209,253,204,2,52,253,47,1,158,23,98,29,253,204,2,52,35,85,20,254,88,14,20,18,102,16,29,58,50,52,54,31,19,48,83,69,98,97,23,19,95,20,25,53,51,54,49,31,24,53,76,61,68,94,48,255,255,0,175,0,0,1,85,4,72,6,6,3,175,0,0,255,255,255,144,254,20,1,85,4,72,6,6,3,176,0,0,0,1,1,116,254,59,2,110,255,131,0,11,0,14,180,1,7,5,128,11,0,47,26,205,57,57,48,49,69,21,14,2,7,35,53,62,2,55,2,110,10,48,65,36,91,15,35,30,5,125,17,39,112,115,45,24,34,109,117,44,255,255,0,51,254,62,1,126,4,72,6,38,3,175,0,0,0,6,1,80,225,0,255,255,0,164,254,161,1,109,4,72,6,38,3,175,0,0,0,7,4,14,3,106,0,0,0,1,0,0,4,116,0,145,0,22,0,95,0,5,0,2,0,16,0,47,0,154,0,0,2,190,15,131,0,3,0,1,0,0,0,0,0,0,0,0,0,0,0,41,0,71,0,159,1,5,1,101,1,216,1,236,2,19,2,61,2,110,2,141,2,170,2,187,2,214,2,235,3,43,3,81,3,141,3,224,4,25,4,96,4,184,4,212,5,60,5,149,5,194,5,242,6,16,6,42,6,72,6,149,7,33,7,86,7,161,7,221,8,14,8,51,8,83,8,152,8,188,8,206,8,243,9,31,9,53,9,109,9,155,9,221,10,16,10,95,10,154,10,239,11,10,11,53,11,95,11,179,11,222,12,1,12,36,12,63,12,84,12,110,12,138,12,156,12,190,13,15,13,91,13,146,13,221,14,29,14,83,14,213,15,13,15,51,15,106,15,160,15,178,16,1,16,50,16,109,16,190,17,11,17,60,17,137,17,191,17,243,18,27,18,110,18,155,18,218,18,253,19,69,19,86,19,157,19,214,19,214,19,253,20,62,20,135,20,252,21,59,21,84,21,198,21,244,22,101,22,178,22,234,23,1,23,9,23,123,23,141,23,193,23,236,24,33,24,107,24,141,24,204,24,246,24,255,25,45,25,83,25,131,25,183,26,21,26,114,26,244,27,64,27,82,27,100,27,118,27,136,27,155,27,167,27,227,27,239,28,1,28,19,28,37,28,56,28,74,28,92,28,110,28,129,28,196,28,214,28,232,28,250,29,12,29,30,29,49,29,100,29,212,29,230,29,248,30,10,30,29,30,47,30,104,30,199,30,217,30,235,30,253,31,14,31,32,31,52,31,183,31,195,31,213,31,231,31,249,32,11,32,28,32,45,32,63,32,82,32,181,32,199,32,217,32,235,32,253,33,15,33,33,33,88,33,192,33,210,33,228,33,246,34,8,34,26,34,107,34,125,34,143,34,161,34,179,34,197,34,209,34,221,34,239,35,1,35,19,35,37,35,55,35,73,35,91,35,109,35,127,35,146,35,154,35,240,36,2,36,20,36,38,36,56,36,74,36,92,36,104,36,206,36,224,36,242,37,4,37,22,37,40,37,59,37,77,37,96,37,108,37,125,37,143,37,162,37,218,38,31,38,50,38,68,38,87,38,104,38,123,38,140,38,151,38,162,38,181,38,193,38,205,38,223,38,241,38,253,39,8,39,60,39,78,39,96,39,107,39,119,39,138,39,156,39,168,39,180,39,222,40,3,40,21,40,39,40,51,40,63,40,81,40,99,40,111,40,178,40,250,41,12,41,30,41,48,41,66,41,85,41,104,41,193,42,49,42,67,42,85,42,97,42,109,42,127,42,144,42,162,42,180,42,198,42,215,42,227,42,239,43,1,43,18,43,29,43,40,43,58,43,70,43,116,43,181,43,199,43,217,43,235,43,253,44,15,44,33,44,53,44,73,44,92,44,111,44,192,44,204,44,222,44,240,45,2,45,19,45,38,45,56,45,74,45,92,45,110,45,128,45,145,45,183,46,1,46,107,46,247,47,9,47,27,47,45,47,63,47,74,47,85,47,130,47,177,47,196,47,235,48,7,48,52,48,94,48,149,48,206,48,238,49,48,49,60,49,69,49,82,49,95,49,108,49,120,49,133,49,145,49,166,49,174,49,182,49,205,49,255,50,7,50,15,50,23,50,100,50,108,50,116,50,158,50,166,50,174,50,212,50,220,50,246,50,254,51,53,51,61,51,69,51,152,51,160,51,223,52,45,52,64,52,83,52,100,52,117,52,134,52,152,52,171,53,10,53,102,53,156,53,247,54,71,54,148,54,200,55,12,55,49,55,57,55,143,55,151,55,195,56,42,56,50,56,104,56,173,56,242,57,50,57,98,57,145,57,227,58,54,58,122,58,211,58,230,58,248,59,9,59,26,59,44,59,63,59,129,59,147,59,217,59,225,59,233,59,252,60,4,60,94,60,159,60,208,60,226,60,244,61,22,61,30,61,81,61,89,61,97,61,156,61,164,61,220,62,47,62,98,62,116,62,153,62,212,62,220,62,228,62,236,62,244,62,252,63,4,63,12,63,76,63,84,63,92,63,128,63,175,63,210,63,253,64,49,64,106,64,155,64,225,65,54,65,112,65,120,65,219,66,38,66,61,66,117,66,125,66,182,67,10,67,57,67,74,67,112,67,162,67,215,67,252,68,4,68,31,68,39,68,47,68,76,68,84,68,165,68,173,68,210,69,3,69,40,69,85,69,140,69,198,69,249,70,56,70,134,70,190,70,208,71,40,71,58,71,122,71,130,71,138,71,157,71,165,71,246,72,57,72,65,72,83,72,100,72,134,72,162,72,190,72,208,72,226,72,244,73,6,73,25,73,44,73,62,73,80,73,97,73,114,73,122,73,148,73,178,73,209,73,218,73,248,74,42,74,93,74,102,74,142,74,207,74,239,74,255,75,131,75,150,75,181,75,211,75,241,75,253,76,18,76,65,76,112,76,194,77,30,77,130,77,233,78,63,78,157,78,227,78,235,79,48,79,177,80,87,80,244,81,106,81,201,81,209,81,235,82,21,82,38,82,73,82,169,82,222,82,235,83,36,83,48,83,60,83,102,83,140,83,172,83,181,83,212,84,7,84,71,84,98,84,187,84,187,84,187,84,187,84,187,84,187,84,187,84,187,84,187,84,187,84,187,84,187,84,187,84,187,85,167,85,251,86,13,86,21,86,146,86,208,87,50,87,68,87,86,87,98,87,119,87,165,87,250,88,73,88,138,88,211,89,2,89,20,89,38,89,56,89,74,89,165,89,252,90,60,90,124,90,209,91,33,91,97,91,159,91,241,92,63,92,142,92,220,93,63,93,160,94,60,94,216,94,224,94,232,95,51,95,119,95,182,95,243,96,6,96,25,96,146,96,158,97,9,97,108,98,37,98,210,98,228,98,246,99,52,99,110,99,161,100,86,100,230,101,59,101,142,101,206,102,15,102,96,102,202,102,243,103,28,103,102,103,171,103,237,104,47,104,59,104,71,104,120,104,168,104,218,105,12,105,59,105,116,105,160,105,204,105,249,106,38,106,79,106,120,106,199,107,16,107,151,108,18,108,30,108,42,108,78,108,113,108,121,108,166,108,218,109,20,109,74,109,128,109,173,109,220,110,20,110,73,110,144,110,214,111,6,111,14,111,109,111,199,112,45,112,139,112,147,112,165,112,183,113,14,113,85,113,153,113,213,114,12,114,68,114,114,114,160,114,215,115,15,115,84,115,147,115,155,115,173,115,190,115,209,115,227,115,235,115,243,116,5,116,22,116,97,116,105,116,124,116,142,116,161,116,180,116,199,116,217,117,29,117,96,117,114,117,132,117,151,117,169,117,188,117,206,117,214,117,222,117,241,118,3,118,22,118,41,118,59,118,77,118,96,118,114,118,133,118,152,118,171,118,189,118,221,118,253,119,16,119,35,119,47,119,113,119,186,120,3,120,60,120,119,120,167,120,175,121,1,121,100,121,193,122,29,122,105,122,178,123,7,123,84,123,146,123,211,124,25,124,91,124,143,124,198,125,26,125,34,125,121,125,199,125,211,125,223,125,241,126,3,126,23,126,43,126,63,126,83,126,103,126,123,126,143,126,163,126,185,126,207,126,227,126,247,127,11,127,31,127,51,127,71,127,91,127,111,127,133,127,155,127,167,127,179,127,197,127,215,127,233,127,250,128,13,128,32,128,52,128,72,128,92,128,112,128,132,128,152,128,174,128,196,128,214,128,232,128,244,129,0,129,12,129,24,129,42,129,60,129,79,129,98,129,118,129,138,129,158,129,178,129,198,129,218,129,240,130,6,130,24,130,42,130,60,130,78,130,96,130,114,130,132,130,150,130,162,130,174,130,186,130,198,130,216,130,234,130,252,131,14,131,32,131,50,131,68,131,86,131,104,131,122,131,134,131,146,131,158,131,170,131,188,131,206,131,224,131,241,132,3,132,69,132,135,132,222,133,52,133,109,133,165,133,237,134,56,134,95,134,135,134,147,134,159,134,171,134,183,134,205,134,227,135,36,135,44,135,66,135,127,135,172,135,251,136,73,136,95,136,117,136,139,136,161,136,183,136,205,136,227,136,249,137,65,137,73,137,149,137,243,138,84,138,161,138,239,139,23,139,35,139,47,139,59,139,75,139,91,139,176,140,2,140,80,140,99,140,118,140,130,140,142,140,160,140,172,140,216,140,254,141,16,141,34,141,52,141,71,141,89,141,107,141,125,141,137,141,148,141,166,141,178,141,196,141,214,141,226,141,239,141,247,142,10,142,18,142,37,142,45,142,53,142,71,142,108,142,116,142,124,142,141,142,159,142,179,143,42,143,54,143,65,143,152,143,246,144,8,144,26,144,44,144,126,144,212,144,220,145,14,145,62,145,79,145,155,145,202,146,17,146,91,146,143,146,216,147,16,147,87,147,127,147,191,147,209,148,0,148,60,148,153,148,175,148,235,149,72,149,107,149,169,150,11,150,49,150,111,150,214,151,18,151,104,151,229,152,26,152,90,152,152,152,201,153,28,153,110,153,128,153,146,153,168,153,190,153,202,153,214,153,226,153,238,153,250,154,6,154,18,154,29,154,40,154,52,154,64,154,76,154,88,154,100,154,112,154,124,154,136,154,148,154,160,154,172,154,184,154,196,154,208,154,220,154,238,154,247,155,0,155,9,155,18,155,27,155,36,155,45,155,54,155,63,155,72,155,81,155,141,155,150,155,177,155,186,155,195,155,233,156,15,156,57,156,101,156,146,156,245,157,46,157,108,157,133,157,178,157,244,158,5,158,27,158,52,158,78,158,142,158,167,158,185,158,210,158,236,159,6,159,15,159,24,159,33,159,42,159,51,159,60,159,69,159,78,159,87,159,96,159,160,159,199,160,2,160,83,160,138,160,208,161,39,161,65,161,168,161,255,162,8,162,17,162,26,162,35,162,44,162,53,162,62,162,71,162,80,162,89,162,142,162,179,162,238,163,63,163,118,163,188,164,22,164,49,164,154,164,240,165,62,165,70,165,78,165,86,165,94,165,102,165,110,165,118,165,126,165,134,165,142,165,151,165,160,165,169,165,178,165,187,165,196,165,205,165,214,165,223,165,232,165,249,166,25,166,34,166,67,166,76,166,106,166,131,166,140,166,149,166,157,166,226,167,87,167,95,167,103,167,133,167,144,167,156,0,0,0,1,0,0,0,3,0,66,183,189,33,224,95,15,60,245,0,11,8,0,0,0,0,0,217,204,194,247,0,0,0,0,221,119,38,81,251,156,253,211,9,156,8,98,0,0,0,6,0,2,0,0,0,0,0,0,4,205,0,193,0,0,0,0,2,20,0,0,2,20,0,0,2,29,0,150,3,48,0,135,5,43,0,52,4,147,0,127,6,157,0,102,5,212,0,111,1,193,0,135,2,92,0,82,2,92,0,62,4,104,0,89,4,147,0,103,2,18,0,83,2,147,0,82,2,26,0,150,2,239,0,21,4,147,0,103,4,147,0,185,4,147,0,101,4,147,0,92,4,147,0,44,4,147,0,132,4,147,0,116,4,147,0,93,4,147,0,103,4,147,0,103,2,26,0,150,2,26,0,65,4,147,0,103,4,147,0,115,4,147,0,103,3,116,0,31,7,44,0,118,5,15,0,0,5,43,0,200,5,10,0,125,5,206,0,200,4,114,0,200,4,33,0,200,5,209,0,125,5,230,0,200,2,60,0,200,2,38,255,92,4,230,0,200,4,45,0,200,7,50,0,200,6,6,0,200,6,57,0,125,4,208,0,200,6,57,0,125,4,240,0,200,4,99,0,105,4,104,0,18,5,213,0,185,4,197,0,0,7,99,0,30,4,159,0,6,4,121,0,0,4,148,0,78,2,158,0,166,2,239,0,21,2,158,0,51,4,147,0,80,3,129,255,252,2,56,0,82,4,114,0,94,4,229,0,175,3,213,0,114,4,229,0,114,4,126,0,114,2,177,0,30,4,88,0,31,4,232,0,175,2,5,0,160,2,5,255,144,4,52,0,175,2,5,0,175,7,104,0,175,4,232,0,175,4,208,0,114,4,229,0,175,4,229,0,113,3,69,0,175,3,208,0,103,2,218,0,32,4,232,0,163,3,255,0,0,6,51,0,24,4,48,0,39,4,2,0,2,3,192,0,80,3,0,0,57,4,101,1,236,3,0,0,67,4,147,0,103,2,20,0,0,2,29,0,150,4,147,0,185,4,147,0,68,4,147,0,121,4,147,0,31,4,101,1,236,4,28,0,122,4,163,1,54,6,168,0,100,2,211,0,68,3,247,0,79,4,147,0,103,2,147,0,82,6,168,0,100,4,0,255,250,3,109,0,117,4,147,0,103,2,200,0,50,2,200,0,37,2,56,0,82,4,242,0,175,5,61,0,122,2,26,0,150,1,198,0,28,2,200,0,76,2,253,0,67,3,247,0,77,5,236,0,66,6,37,0,44,6,58,0,33,3,116,0,53,5,15,0,0,5,15,0,0,5,15,0,0,5,15,0,0,5,15,0,0,5,15,0,0,6,242,255,254,5,10,0,125,4,114,0,200,4,114,0,200,4,114,0,200,4,114,0,200,2,60,255,244,2,60,0,180,2,60,255,206,2,60,0,6,5,206,0,58,6,6,0,200,6,57,0,125,6,57,0,125,6,57,0,125,6,57,0,125,6,57,0,125,4,147,0,133,6,57,0,125,5,213,0,185,5,213,0,185,5,213,0,185,5,213,0,185,4,121,0,0,4,208,0,200,4,251,0,175,4,114,0,94,4,114,0,94,4,114,0,94,4,114,0,94,4,114,0,94,4,114,0,94,6,230,0,94,3,213,0,114,4,126,0,114,4,126,0,114,4,126,0,114,4,126,0,114,2,5,255,248,2,5,0,143,2,5,255,181,2,5,255,231,4,204,0,113,4,232,0,175,4,208,0,114,4,208,0,114,4,208,0,114,4,208,0,114,4,208,0,114,4,147,0,103,4,208,0,114,4,232,0,163,4,232,0,163,4,232,0,163,4,232,0,163,4,2,0,2,4,229,0,175,4,2,0,2,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,10,0,125,3,213,0,114,5,10,0,125,3,213,0,114,5,10,0,125,3,213,0,114,5,10,0,125,3,213,0,114,5,206,0,200,4,229,0,114,5,206,0,58,4,232,0,114,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,5,209,0,125,4,88,0,31,5,209,0,125,4,88,0,31,5,209,0,125,4,88,0,31,5,209,0,125,4,88,0,31,5,230,0,200,4,232,255,183,5,230,0,0,4,232,0,20,2,60,255,173,2,5,255,137,2,60,255,243,2,5,255,214,2,60,255,231,2,5,255,211,2,60,0,88,2,5,0,49,2,60,0,189,4,98,0,200,4,10,0,160,2,38,255,92,2,5,255,144,4,230,0,200,4,52,0,175,4,52,0,175,4,45,0,167,2,5,0,143,4,45,0,200,2,5,0,131,4,45,0,200,2,5,0,175,4,45,0,200,2,23,0,175,4,45,0,26,2,5,255,242,6,6,0,200,4,232,0,175,6,6,0,200,4,232,0,175,6,6,0,200,4,232,0,175,5,105,0,2,6,6,0,200,4,232,0,175,6,57,0,125,4,208,0,114,6,57,0,125,4,208,0,114,6,57,0,125,4,208,0,114,7,102,0,125,7,150,0,112,4,240,0,200,3,69,0,175,4,240,0,200,3,69,0,125,4,240,0,200,3,69,0,149,4,99,0,105,3,208,0,103,4,99,0,105,3,208,0,103,4,99,0,105,3,208,0,103,4,99,0,105,3,208,0,103,4,104,0,18,2,218,0,32,4,104,0,18,2,218,0,32,4,104,0,18,2,218,0,32,5,213,0,185,4,232,0,163,5,213,0,185,4,232,0,163,5,213,0,185,4,232,0,163,5,213,0,185,4,232,0,163,5,213,0,185,4,232,0,163,5,213,0,185,4,232,0,163,7,99,0,30,6,51,0,24,4,121,0,0,4,2,0,2,4,121,0,0,4,148,0,78,3,192,0,80,4,148,0,78,3,192,0,80,4,148,0,78,3,192,0,80,2,149,0,175,4,147,0,190,5,17,255,254,4,114,0,94,6,242,255,254,6,230,0,94,6,57,0,125,4,208,0,114,4,99,0,105,3,208,0,103,3,69,0,82,3,69,0,82,2,251,0,82,3,18,0,82,1,108,0,82,2,98,0,82,1,239,0,82,3,138,0,82,3,118,0,82,4,158,2,8,4,158,1,32,5,15,0,0,2,26,0,150,5,21,255,254,6,137,255,254,2,228,255,254,6,143,255,254,5,175,255,254,6,132,255,242,2,183,255,213,5,15,0,0,5,43,0,200,4,41,0,200,4,162,0,37,4,114,0,200,4,148,0,78,5,230,0,200,6,57,0,125,2,60,0,200,4,230,0,200,4,211,0,0,7,50,0,200,6,6,0,200,4,104,0,67,6,57,0,125,5,211,0,200,4,208,0,200,4,136,0,72,4,104,0,18,4,121,0,0,6,96,0,105,4,159,0,6,6,97,0,111,6,63,0,79,2,60,0,6,4,121,0,0,4,227,0,114,3,210,0,89,4,232,0,175,2,183,0,168,4,225,0,163,4,227,0,114,5,4,0,175,4,23,0,9,4,205,0,112,3,210,0,89,3,217,0,114,4,232,0,175,4,186,0,113,2,183,0,168,4,52,0,175,4,72,255,244,4,242,0,175,4,84,0,0,3,203,0,112,4,208,0,114,5,53,0,25,4,207,0,164,3,220,0,114,4,229,0,114,3,201,0,20,4,225,0,163,5,188,0,114,4,91,255,240,6,9,0,163,6,49,0,115,2,183,255,233,4,225,0,163,4,208,0,114,4,225,0,163,6,49,0,115,4,114,0,200,5,222,0,18,4,41,0,200,5,29,0,125,4,99,0,105,2,60,0,200,2,60,0,6,2,38,255,92,7,123,0,1,7,170,0,200,5,222,0,18,4,225,0,200,4,241,0,22,5,211,0,200,5,15,0,0,4,229,0,200,5,43,0,200,4,41,0,200,5,121,0,12,4,114,0,200,6,187,0,4,4,170,0,79,6,20,0,202,6,20,0,202,4,225,0,200,5,160,0,1,7,50,0,200,5,230,0,200,6,57,0,125,5,211,0,200,4,208,0,200,5,10,0,125,4,104,0,18,4,241,0,22,6,96,0,105,4,159,0,6,5,230,0,200,5,140,0,167,8,65,0,200,8,75,0,200,5,125,0,15,6,201,0,200,5,18,0,200,5,11,0,63,8,98,0,200,5,15,0,46,4,114,0,94,4,194,0,118,4,152,0,175,3,115,0,175,4,153,0,39,4,126,0,114,5,225,0,4,3,222,0,67,5,22,0,175,5,22,0,175,4,34,0,175,4,148,0,13,5,222,0,174,5,16,0,175,4,208,0,114,4,246,0,175,4,229,0,175,3,213,0,114,3,196,0,41,4,2,0,2,5,185,0,112,4,48,0,39,5,2,0,175,4,219,0,154,7,30,0,175,7,46,0,175,5,127,0,38,6,37,0,175,4,184,0,175,3,243,0,65,6,162,0,175,4,110,0,34,4,126,0,114,4,232,0,20,3,115,0,175,3,242,0,114,3,208,0,103,2,5,0,160,2,5,255,231,2,5,255,144,6,183,0,13,7,29,0,175,4,232,0,20,4,34,0,175,4,2,0,2,4,249,0,175,4,55,0,200,3,120,0,175,7,99,0,30,6,51,0,24,7,99,0,30,6,51,0,24,7,99,0,30,6,51,0,24,4,121,0,0,4,2,0,2,4,0,0,82,8,0,0,82,8,0,0,82,3,70,255,252,1,91,0,27,1,91,0,26,1,245,0,65,1,91,0,27,2,202,0,27,2,202,0,26,3,69,0,65,4,17,0,130,4,17,0,121,3,2,0,171,6,57,0,150,9,94,0,102,1,215,0,80,3,57,0,80,2,103,0,79,2,103,0,77,3,236,0,150,1,6,254,132,3,48,0,114,4,147,0,94,4,147,0,70,6,38,0,158,4,147,0,52,6,139,0,135,4,34,0,112,8,38,0,197,6,28,0,31,6,63,0,79,4,244,0,102,6,150,0,62,6,150,0,37,6,150,0,72,6,150,0,94,4,162,0,101,4,162,0,37,5,231,0,199,5,9,0,74,4,147,0,103,4,100,0,37,5,162,0,117,3,17,0,9,4,147,0,103,4,147,0,103,4,147,0,103,4,147,0,103,4,169,0,108,4,158,0,217,4,0,1,137,0,0,255,131,4,0,1,129,2,200,0,21,2,200,0,62,2,200,0,58,2,200,0,52,4,0,0,0,8,0,0,0,4,0,0,0,8,0,0,0,2,170,0,0,2,0,0,0,1,86,0,0,4,147,0,0,2,26,0,0,1,84,0,0,0,205,0,0,0,0,0,0,0,0,0,0,8,0,0,84,8,0,0,84,2,5,255,144,1,91,0,26,4,237,0,12,4,135,0,0,6,188,0,22,7,50,0,200,7,104,0,175,5,15,0,0,4,114,0,94,2,170,0,117,6,63,0,125,4,227,0,114,6,46,0,185,5,77,0,163,0,0,253,5,4,114,0,200,6,20,0,202,4,126,0,114,5,22,0,175,7,82,0,52,6,64,0,39,5,102,0,20,5,14,0,20,7,95,0,200,5,248,0,175,5,99,0,0,4,121,0,7,7,87,0,200,6,26,0,175,5,200,0,23,5,19,0,12,7,208,0,200,6,185,0,175,4,168,0,64,3,222,0,27,6,97,0,111,6,9,0,163,6,60,0,125,4,208,0,114,5,4,0,0,4,18,0,0,5,4,0,0,4,18,0,0,9,166,0,125,8,170,0,114,6,135,0,125,5,51,0,114,8,39,0,126,7,46,0,119,7,82,0,52,6,64,0,39,5,29,0,124,3,234,0,114,4,222,0,109,7,233,0,43,7,166,0,43,6,49,0,200,5,49,0,175,4,225,0,44,4,193,0,29,4,221,0,200,4,229,0,175,4,51,0,46,3,116,0,16,5,46,0,200,4,60,0,175,7,21,0,4,6,56,0,4,4,170,0,79,3,222,0,67,5,75,0,200,4,91,0,175,4,229,0,200,4,34,0,175,4,225,0,31,4,52,0,17,5,122,0,13,4,224,0,38,5,255,0,200,5,53,0,175,6,121,0,200,5,217,0,175,8,118,0,200,6,231,0,175,6,54,0,125,5,22,0,114,5,10,0,125,3,213,0,114,4,104,0,16,3,195,0,41,4,121,0,0,3,255,0,0,4,121,0,0,3,255,0,0,4,241,0,6,4,89,0,39,6,222,0,17,5,190,0,41,5,149,0,167,4,235,0,154,5,140,0,167,4,208,0,154,5,140,0,201,4,232,0,175,6,185,0,56,5,72,0,45,6,185,0,56,5,72,0,45,2,60,0,200,6,187,0,4,5,225,0,4,5,130,0,200,4,113,0,175,5,179,0,1,4,164,0,13,5,213,0,200,4,244,0,175,6,1,0,200,5,61,0,175,5,140,0,167,4,219,0,154,7,68,0,200,5,238,0,174,2,60,0,200,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,6,242,255,254,6,230,0,94,4,114,0,200,4,126,0,114,5,221,0,120,4,126,0,106,5,221,0,120,4,126,0,106,6,187,0,4,5,225,0,4,4,170,0,79,3,222,0,67,4,171,0,73,3,238,0,29,6,20,0,202,5,22,0,175,6,20,0,202,5,22,0,175,6,57,0,125,4,208,0,114,6,60,0,125,4,208,0,114,6,60,0,125,4,208,0,114,5,11,0,63,3,243,0,65,4,241,0,22,4,2,0,2,4,241,0,22,4,2,0,2,4,241,0,22,4,2,0,2,5,140,0,167,4,219,0,154,4,52,0,200,3,115,0,175,6,201,0,200,6,37,0,175,4,51,0,46,3,116,0,16,4,242,0,6,4,86,0,39,4,159,0,5,4,48,0,39,4,227,0,126,4,229,0,114,7,40,0,125,7,36,0,112,7,47,0,76,6,102,0,79,4,252,0,76,4,52,0,79,7,207,255,255,6,207,0,13,8,21,0,200,7,73,0,175,6,11,0,125,5,25,0,114,5,170,0,16,5,49,0,41,4,172,0,110,3,210,0,89,5,168,0,1,4,162,0,13,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,45,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,4,114,0,92,4,126,0,73,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,2,60,0,142,2,5,0,119,2,60,0,184,2,5,0,160,6,57,0,125,4,208,0,114,6,57,0,125,4,208,0,114,6,57,0,125,4,208,0,114,6,57,0,125,4,208,0,96,6,57,0,125,4,208,0,114,6,57,0,125,4,208,0,114,6,57,0,125,4,208,0,114,6,63,0,125,4,227,0,114,6,63,0,125,4,227,0,114,6,63,0,125,4,227,0,114,6,63,0,125,4,227,0,114,6,63,0,125,4,227,0,114,5,213,0,185,4,232,0,163,5,213,0,185,4,232,0,163,6,46,0,185,5,77,0,163,6,46,0,185,5,77,0,163,6,46,0,185,5,77,0,163,6,46,0,185,5,77,0,163,6,46,0,185,5,77,0,163,4,121,0,0,4,2,0,2,4,121,0,0,4,2,0,2,4,121,0,0,4,2,0,2,4,232,0,114,0,0,252,112,0,0,251,156,0,0,252,112,0,0,252,105,0,0,252,117,0,0,252,117,0,0,252,117,0,0,252,103,1,164,0,48,1,179,0,29,4,104,0,18,2,218,0,32,6,57,0,125,4,208,0,114,6,57,0,125,4,208,0,114,4,126,0,106,0,0,253,5,7,117,0,1,4,166,1,112,2,200,0,41,2,200,0,41,2,200,0,35,2,183,255,218,2,183,255,218,2,183,255,204,2,183,255,206,4,225,0,163,4,225,0,163,4,225,0,163,4,225,0,163,5,188,0,199,6,6,0,200,5,169,0,186,0,0,0,95,0,0,0,95,0,0,0,107,0,0,0,107,4,166,0,181,5,98,0,30,4,182,0,30,4,182,0,30,7,102,0,30,7,102,0,30,5,160,0,186,5,34,255,230,5,26,0,195,4,45,0,200,6,6,0,200,5,15,0,0,4,114,0,200,2,60,0,88,5,213,0,185,2,170,0,87,3,71,0,56,2,170,0,76,2,170,0,87,2,170,0,9,2,170,0,58,2,170,255,220,2,170,0,41,2,170,0,38,2,170,0,87,2,170,0,87,2,170,0,87,4,207,0,87,3,71,0,56,2,170,0,87,2,170,0,87,3,156,255,254,2,170,0,87,2,170,0,58,2,170,0,87,2,170,0,58,3,71,0,56,2,170,0,87,2,5,0,175,2,5,255,144,5,4,0,175,4,91,255,240,4,229,0,114,2,5,0,65,4,232,0,175,4,114,0,94,4,126,0,114,2,5,0,49,4,232,0,163,4,229,0,114,4,229,0,114,4,229,0,114,4,229,0,114,3,71,255,231,4,205,0,112,2,170,0,87,3,48,0,114,2,187,0,114,1,81,0,114,4,209,0,114,3,48,0,114,3,46,0,114,2,122,0,67,1,219,0,21,4,180,0,113,4,47,0,82,3,62,0,49,4,9,0,44,5,6,0,175,2,7,0,175,2,32,0,62,5,6,0,175,5,2,0,165,1,236,0,162,3,242,0,34,3,224,0,70,3,224,0,54,4,255,0,168,4,247,0,99,1,253,0,100,3,114,0,117,4,203,0,110,4,182,0,60,4,227,0,89,4,192,0,110,3,222,0,3,4,117,0,79,4,195,0,175,3,255,0,44,5,168,0,82,5,20,0,40,5,168,0,82,5,168,0,76,5,168,0,82,5,168,0,80,4,180,0,113,4,180,0,113,4,180,0,113,4,47,0,82,3,62,0,49,4,9,0,44,5,6,0,175,2,7,255,190,2,32,255,199,5,2,0,165,1,236,255,195,3,242,0,34,3,224,0,70,3,224,0,54,4,247,0,99,3,114,0,117,4,203,0,110,4,227,0,89,4,192,0,110,4,117,0,79,4,195,0,175,3,255,0,44,5,168,0,82,5,20,0,40,2,7,0,175,0,0,252,25,0,0,253,128,0,0,254,176,0,0,252,24,0,0,254,213,0,0,254,202,0,0,255,158,0,0,254,229,0,0,255,37,0,0,255,6,0,0,254,175,0,0,251,229,0,0,255,97,0,0,253,58,0,0,255,55,0,0,255,91,0,0,253,64,0,0,253,68,0,0,252,87,0,0,252,90,0,0,255,193,0,0,254,160,0,0,254,210,0,0,254,210,0,0,255,186,0,0,255,34,0,0,255,34,0,0,255,70,0,0,255,72,0,0,255,187,0,0,255,192,0,0,255,40,0,0,255,192,0,0,255,208,0,0,255,192,0,0,255,186,0,0,255,83,2,200,0,41,2,200,0,76,2,200,0,50,2,200,0,37,2,200,0,21,2,200,0,62,2,200,0,41,2,200,0,58,2,200,0,52,2,200,0,35,4,170,0,115,3,118,0,51,4,106,0,79,4,136,0,87,4,154,0,48,4,136,0,126,4,144,0,115,4,18,0,17,4,180,0,122,4,144,0,102,2,200,0,41,2,200,0,76,2,200,0,50,2,200,0,37,2,200,0,21,2,200,0,62,2,200,0,41,2,200,0,58,2,200,0,52,2,200,0,35,4,172,0,112,3,36,0,42,4,80,0,85,4,67,0,59,4,139,0,46,4,123,0,121,4,153,0,118,4,56,0,33,4,147,0,103,4,153,0,98,4,147,0,103,4,92,0,72,4,92,0,151,4,92,0,95,4,92,0,75,4,92,0,7,4,92,0,96,4,92,0,84,4,92,0,66,4,92,0,76,4,92,0,70,2,200,0,41,2,200,0,76,2,200,0,50,2,200,0,37,2,200,0,21,2,200,0,62,2,200,0,41,2,200,0,58,2,200,0,52,2,200,0,35,2,147,0,82,1,203,0,80,1,203,0,80,1,203,0,61,1,203,0,61,2,173,0,72,2,173,0,72,2,173,0,72,2,173,0,72,2,239,0,21,6,72,0,174,6,110,0,113,2,5,0,175,2,5,255,144,4,0,1,116,2,5,0,51,0,164,0,0,0,1,0,0,8,141,253,168,0,0,9,166,251,156,253,52,9,156,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,115,0,4,4,145,1,144,0,5,0,0,5,51,4,205,0,0,0,154,5,51,4,205,0,0,2,205,0,50,2,146,0,0,0,0,0,0,0,0,0,0,0,0,224,0,2,255,64,0,32,27,0,0,0,40,0,0,0,0,71,79,79,71,1,192,0,0,255,253,8,141,253,168,0,0,8,254,2,139,0,0,1,159,0,0,0,0,4,72,5,182,0,0,0,32,0,4,0,0,0,2,0,0,0,3,0,0,0,20,0,3,0,1,0,0,0,20,0,4,3,226,0,0,0,224,0,128,0,6,0,96,0,0,0,13,0,126,1,48,1,49,1,97,1,99,1,127,1,146,1,161,1,176,1,237,1,240,1,255,2,27,2,55,2,89,2,188,2,199,2,201,2,221,2,243,3,4,3,12,3,15,3,18,3,35,3,40,3,138,3,140,3,161,3,206,3,210,3,214,4,0,4,12,4,13,4,79,4,80,4,92,4,95,4,130,4,134,4,143,4,145,5,19,5,189,5,190,5,194,5,199,5,234,30,1,30,63,30,133,30,158,30,241,30,243,30,249,31,77,31,222,32,11,32,21,32,30,32,34,32,38,32,48,32,51,32,58,32,60,32,68,32,112,32,122,32,127,32,137,32,138,32,142,32,156,32,164,32,167,32,172,33,5,33,19,33,22,33,32,33,34,33,38,33,46,33,94,34,2,34,6,34,15,34,18,34,21,34,26,34,30,34,43,34,72,34,96,34,101,37,202,167,181,171,83,251,4,251,54,251,60,251,62,251,65,251,68,251,75,254,255,255,253,255,255,0,0,0,0,0,13,0,32,0,160,1,49,1,50,1,98,1,100,1,146,1,160,1,175,1,234,1,240,1,250,2,24,2,55,2,89,2,188,2,198,2,201,2,216,2,243,3,0,3,6,3,15,3,18,3,35,3,38,3,132,3,140,3,142,3,163,3,209,3,214,4,0,4,1,4,13,4,14,4,80,4,81,4,93,4,96,4,131,4,136,4,144,4,146,5,176,5,190,5,193,5,199,5,208,30,0,30,62,30,128,30,158,30,160,30,242,30,244,31,77,31,222,32,0,32,19,32,23,32,32,32,38,32,48,32,50,32,57,32,60,32,68,32,112,32,116,32,124,32,128,32,138,32,140,32,149,32,163,32,167,32,170,33,5,33,19,33,22,33,32,33,34,33,38,33,46,33,91,34,2,34,6,34,15,34,17,34,21,34,26,34,30,34,43,34,72,34,96,34,100,37,202,167,179,171,83,251,0,251,42,251,56,251,62,251,64,251,67,251,70,254,255,255,252,255,255,0,1,255,245,255,227,255,194,2,126,255,193,2,11,255,193,255,175,0,180,0,167,1,133,0,90,255,72,0,0,1,121,1,26,255,143,254,132,254,131,254,117,255,96,1,1,0,0,0,253,0,251,0,235,0,0,253,207,253,206,253,205,253,204,254,123,254,120,254,89,253,154,254,77,253,153,254,11,253,152,0,0,253,253,0,0,253,248,253,103,253,246,254,101,254,165,254,98,254,94,253,249,228,81,228,17,227,121,228,241,228,106,227,13,228,104,228,40,227,152,226,59,225,238,225,237,225,236,225,233,225,224,225,223,225,218,225,217,225,210,227,7,0,0,0,0,227,217,227,224,0,0,227,44,225,117,225,115,0,0,225,23,225,10,225,8,227,78,224,253,224,250,224,243,224,199,224,36,224,33,224,25,224,24,226,87,224,17,224,14,224,2,223,230,223,207,223,204,220,104,0,0,88,95,8,138,8,186,8,185,8,184,8,183,8,182,8,181,3,72,2,76,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,186,0,0,0,0,0,0,0,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,172,0,0,0,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,0,136,0,0,0,0,0,138,0,0,0,0,0,0,0,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,72,1,73,1,35,1,36,4,6,4,7,4,8,3,116,4,9,4,10,4,11,2,53,4,15,4,16,2,92,1,245,1,246,4,19,4,20,4,17,4,18,2,55,2,56,3,120,2,57,2,58,3,121,4,104,4,105,4,100,4,102,2,23,4,107,4,101,4,103,4,109,3,98,2,27,3,144,3,145,3,177,0,0,64,74,153,152,151,150,135,134,133,132,131,130,129,128,127,126,125,124,123,122,121,120,119,118,117,116,115,114,113,112,111,110,109,108,107,106,105,104,103,102,101,100,99,98,97,96,95,94,93,92,91,90,89,88,87,86,85,84,83,81,80,79,78,77,76,75,74,73,72,71,70,40,31,16,10,9,44,1,177,11,10,67,35,67,101,10,45,44,0,177,10,11,67,35,67,11,45,44,1,176,6,67,176,7,67,101,10,45,44,176,79,43,32,176,64,81,88,33,75,82,88,69,68,27,33,33,89,27,35,33,176,64,176,4,37,69,176,4,37,69,97,100,138,99,82,88,69,68,27,33,33,89,89,45,44,0,176,7,67,176,6,67,11,45,44,75,83,35,75,81,90,88,32,69,138,96,68,27,33,33,89,45,44,75,84,88,32,69,138,96,68,27,33,33,89,45,44,75,83,35,75,81,90,88,56,27,33,33,89,45,44,75,84,88,56,27,33,33,89,45,44,176,2,67,84,88,176,70,43,27,33,33,33,33,89,45,44,176,2,67,84,88,176,71,43,27,33,33,33,89,45,44,176,2,67,84,88,176,72,43,27,33,33,33,33,89,45,44,176,2,67,84,88,176,73,43,27,33,33,33,89,45,44,35,32,176,0,80,138,138,100,177,0,3,37,84,88,176,64,27,177,1,3,37,84,88,176,5,67,139,89,176,79,43,89,35,176,98,43,35,33,35,88,101,89,45,44,177,8,0,12,33,84,96,67,45,44,177,12,0,12,33,84,96,67,45,44,1,32,71,176,2,67,32,184,16,0,98,184,16,0,99,87,35,184,1,0,98,184,16,0,99,87,90,88,176,32,96,102,89,72,45,44,177,0,2,37,176,2,37,176,2,37,83,184,0,53,35,120,176,2,37,176,2,37,96,176,32,99,32,32,176,6,37,35,98,80,88,138,33,176,1,96,35,27,32,32,176,6,37,35,98,82,88,35,33,176,1,97,27,138,33,35,33,32,89,89,184,255,193,28,96,176,32,99,35,33,45,44,177,2,0,66,177,35,1,136,81,177,64,1,136,83,90,88,184,16,0,176,32,136,84,88,178,2,1,2,67,96,66,89,177,36,1,136,81,88,184,32,0,176,64,136,84,88,178,2,2,2,67,96,66,177,36,1,136,84,88,178,2,32,2,67,96,66,0,75,1,75,82,88,178,2,8,2,67,96,66,89,27,184,64,0,176,128,136,84,88,178,2,4,2,67,96,66,89,184,64,0,176,128,99,184,1,0,136,84,88,178,2,8,2,67,96,66,89,185,64,0,1,0,99,184,2,0,136,84,88,178,2,16,2,67,96,66,89,177,38,1,136,81,88,185,64,0,2,0,99,184,4,0,136,84,88,178,2,64,2,67,96,66,89,185,64,0,4,0,99,184,8,0,136,84,88,178,2,128,2,67,96,66,89,177,40,1,136,81,88,185,64,0,8,0,99,184,16,0,136,84,88,185,0,2,1,0,176,2,67,96,66,89,89,89,89,89,89,89,177,0,2,67,84,88,64,10,5,64,8,64,9,64,12,2,13,2,27,177,1,2,67,84,88,178,5,64,8,186,1,0,0,9,1,0,179,12,1,13,1,27,177,128,2,67,82,88,178,5,64,8,184,1,128,177,9,64,27,184,1,0,176,2,67,82,88,178,5,64,8,186,1,128,0,9,1,64,27,184,1,128,176,2,67,82,88,178,5,64,8,184,2,0,177,9,64,27,178,5,64,8,186,1,0,0,9,1,0,89,89,89,184,64,0,176,128,136,85,185,64,0,2,0,99,184,4,0,136,85,90,88,179,12,0,13,1,27,179,12,0,13,1,89,89,89,66,66,66,66,66,45,44,69,177,2,78,43,35,176,79,43,32,176,64,81,88,33,75,81,88,176,2,37,69,177,1,78,43,96,89,27,35,75,81,88,176,3,37,69,32,100,138,99,176,64,83,88,177,2,78,43,96,27,33,89,27,33,89,89,68,45,44,32,176,0,80,32,88,35,101,27,35,89,177,20,20,138,112,69,177,16,16,67,75,138,67,81,90,88,176,64,27,176,79,43,89,35,177,97,6,38,96,43,138,88,176,5,67,139,89,35,88,101,89,35,16,58,45,44,176,3,37,73,99,35,70,96,176,79,43,35,176,4,37,176,4,37,73,176,3,37,99,86,32,96,176,98,96,43,176,3,37,32,16,70,138,70,96,176,32,99,97,58,45,44,176,0,22,177,2,3,37,177,1,4,37,1,62,0,62,177,1,2,6,12,176,10,35,101,66,176,11,35,66,177,2,3,37,177,1,4,37,1,63,0,63,177,1,2,6,12,176,6,35,101,66,176,7,35,66,176,1,22,177,0,2,67,84,88,69,35,69,32,24,105,138,99,35,98,32,32,176,64,80,88,103,27,102,89,97,176,32,99,176,64,35,97,176,4,35,66,27,177,4,0,66,33,33,89,24,1,45,44,32,69,177,0,78,43,68,45,44,75,81,177,64,79,43,80,91,88,32,69,177,1,78,43,32,138,138,68,32,177,64,4,38,97,99,97,177,1,78,43,68,33,27,35,33,138,69,177,1,78,43,32,138,35,68,68,89,45,44,75,81,177,64,79,43,80,91,88,69,32,138,176,64,97,99,96,27,35,33,69,89,177,1,78,43,68,45,44,35,69,32,138,69,35,97,32,100,176,64,81,176,4,37,32,176,0,83,35,176,64,81,90,90,177,64,79,43,84,90,88,138,12,100,35,100,35,83,88,177,64,64,138,97,32,99,97,27,32,99,89,27,138,89,99,177,2,78,43,96,68,45,44,1,45,44,0,45,44,5,177,11,10,67,35,67,101,10,45,44,177,10,11,67,35,67,11,2,45,44,176,2,37,99,102,176,2,37,184,32,0,98,96,35,98,45,44,176,2,37,99,176,32,96,102,176,2,37,184,32,0,98,96,35,98,45,44,176,2,37,99,103,176,2,37,184,32,0,98,96,35,98,45,44,176,2,37,99,102,176,32,96,176,2,37,184,32,0,98,96,35,98,45,44,35,74,177,2,78,43,45,44,35,74,177,1,78,43,45,44,35,138,74,35,69,100,176,2,37,100,176,2,37,97,100,176,3,67,82,88,33,32,100,89,177,2,78,43,35,176,0,80,88,101,89,45,44,35,138,74,35,69,100,176,2,37,100,176,2,37,97,100,176,3,67,82,88,33,32,100,89,177,1,78,43,35,176,0,80,88,101,89,45,44,32,176,3,37,74,177,2,78,43,138,16,59,45,44,32,176,3,37,74,177,1,78,43,138,16,59,45,44,176,3,37,176,3,37,138,176,103,43,138,16,59,45,44,176,3,37,176,3,37,138,176,104,43,138,16,59,45,44,176,3,37,70,176,3,37,70,96,176,4,37,46,176,4,37,176,4,37,176,4,38,32,176,0,80,88,33,176,106,27,176,108,89,43,176,3,37,70,176,3,37,70,96,97,176,128,98,32,138,32,16,35,58,35,32,16,35,58,45,44,176,3,37,71,176,3,37,71,96,176,5,37,71,176,128,99,97,176,2,37,176,6,37,73,99,35,176,5,37,74,176,128,99,32,88,98,27,33,89,176,4,38,70,96,138,70,138,70,96,176,32,99,97,45,44,176,4,38,176,4,37,176,4,37,176,4,38,176,110,43,32,138,32,16,35,58,35,32,16,35,58,45,44,35,32,176,1,84,88,33,176,2,37,177,2,78,43,176,128,80,32,96,89,32,96,96,32,176,1,81,88,33,33,27,32,176,5,81,88,33,32,102,97,176,64,35,97,177,0,3,37,80,176,3,37,176,3,37,80,90,88,32,176,3,37,97,138,83,88,33,176,0,89,27,33,89,27,176,7,84,88,32,102,97,101,35,33,27,33,33,176,0,89,89,89,177,2,78,43,45,44,176,2,37,176,4,37,74,176,0,83,88,176,0,27,138,138,35,138,176,1,89,176,4,37,70,32,102,97,32,176,5,38,176,6,38,73,176,5,38,176,5,38,176,112,43,35,97,101,176,32,96,32,102,97,176,32,97,101,45,44,176,2,37,70,32,138,32,176,0,80,88,33,177,2,78,43,27,69,35,33,89,97,101,176,2,37,16,59,45,44,176,4,38,32,184,2,0,98,32,184,2,0,99,138,35,97,32,176,93,96,43,176,5,37,17,138,18,138,32,57,138,88,185,0,93,16,0,176,4,38,99,86,96,43,35,33,32,16,32,70,32,177,2,78,43,35,97,27,35,33,32,138,32,16,73,177,2,78,43,89,59,45,44,185,0,93,16,0,176,9,37,99,86,96,43,176,5,37,176,5,37,176,5,38,176,109,43,177,93,7,37,96,43,176,5,37,176,5,37,176,5,37,176,5,37,176,111,43,185,0,93,16,0,176,8,38,99,86,96,43,32,176,0,82,88,176,80,43,176,5,37,176,5,37,176,7,37,176,7,37,176,5,37,176,113,43,176,2,23,56,176,0,82,176,2,37,176,1,82,90,88,176,4,37,176,6,37,73,176,3,37,176,5,37,73,96,32,176,64,82,88,33,27,176,0,82,88,32,176,2,84,88,176,4,37,176,4,37,176,7,37,176,7,37,73,176,2,23,56,27,176,4,37,176,4,37,176,4,37,176,6,37,73,176,2,23,56,89,89,89,89,89,33,33,33,33,33,45,44,185,0,93,16,0,176,11,37,99,86,96,43,176,7,37,176,7,37,176,6,37,176,6,37,176,12,37,176,12,37,176,9,37,176,8,37,176,110,43,176,4,23,56,176,7,37,176,7,37,176,7,38,176,109,43,176,4,37,176,4,37,176,4,38,176,109,43,176,80,43,176,6,37,176,6,37,176,3,37,176,113,43,176,5,37,176,5,37,176,3,37,176,2,23,56,32,176,6,37,176,6,37,176,5,37,176,113,43,96,176,6,37,176,6,37,176,4,37,101,176,2,23,56,176,2,37,176,2,37,96,32,176,64,83,88,33,176,64,97,35,176,64,97,35,27,184,255,192,80,88,176,64,96,35,176,64,96,35,89,89,176,8,37,176,8,37,176,4,38,176,2,23,56,176,5,37,176,5,37,138,176,2,23,56,32,176,0,82,88,176,6,37,176,8,37,73,176,3,37,176,5,37,73,96,32,176,64,82,88,33,27,176,0,82,88,176,6,37,176,6,37,176,6,37,176,6,37,176,11,37,176,11,37,73,176,4,23,56,176,6,37,176,6,37,176,6,37,176,6,37,176,10,37,176,10,37,176,7,37,176,113,43,176,4,23,56,176,4,37,176,4,37,176,5,37,176,7,37,176,5,37,176,113,43,176,2,23,56,27,176,4,37,176,4,37,184,255,192,176,2,23,56,89,89,89,33,33,33,33,33,33,33,33,45,44,176,4,37,176,3,37,135,176,3,37,176,3,37,138,32,176,0,80,88,33,176,101,27,176,104,89,43,100,176,4,37,176,4,37,6,176,4,37,176,4,37,73,32,32,99,176,3,37,32,99,81,177,0,3,37,84,91,88,33,33,35,33,7,27,32,99,176,2,37,32,99,97,32,176,83,43,138,99,176,5,37,176,5,37,135,176,4,37,176,4,38,74,176,0,80,88,101,89,176,4,38,32,1,70,35,0,70,176,5,38,32,1,70,35,0,70,176,0,22,0,176,0,35,72,1,176,0,35,72,0,32,176,1,35,72,176,2,35,72,1,32,176,1,35,72,176,2,35,72,35,178,2,0,1,8,35,56,178,2,0,1,9,35,56,177,2,1,7,176,1,22,89,45,44,35,16,13,12,138,99,35,138,99,96,100,185,64,0,4,0,99,80,88,176,0,56,27,60,89,45,44,176,6,37,176,9,37,176,9,37,176,7,38,176,118,43,35,176,0,84,88,5,27,4,89,176,4,37,176,6,38,176,119,43,176,5,37,176,5,38,176,5,37,176,5,38,176,118,43,176,0,84,88,5,27,4,89,176,119,43,45,44,176,7,37,176,10,37,176,10,37,176,8,38,176,118,43,138,176,0,84,88,5,27,4,89,176,5,37,176,7,38,176,119,43,176,6,37,176,6,38,176,6,37,176,6,38,176,118,43,8,176,119,43,45,44,176,7,37,176,10,37,176,10,37,176,8,38,176,118,43,138,138,8,176,4,37,176,6,38,176,119,43,176,5,37,176,5,38,176,5,37,176,5,38,176,118,43,176,0,84,88,5,27,4,89,176,119,43,45,44,176,8,37,176,11,37,176,11,37,176,9,38,176,118,43,176,4,38,176,4,38,8,176,5,37,176,7,38,176,119,43,176,6,37,176,6,38,176,6,37,176,6,38,176,118,43,8,176,119,43,45,44,3,176,3,37,176,3,37,74,176,4,37,176,3,37,74,2,176,5,37,176,5,38,74,176,5,38,176,5,38,74,176,4,38,99,138,138,99,97,45,44,177,93,14,37,96,43,176,12,38,17,176,5,38,18,176,10,37,57,176,7,37,57,176,10,37,176,10,37,176,9,37,176,124,43,176,0,80,176,11,37,176,8,37,176,10,37,176,124,43,176,0,80,84,88,176,7,37,176,11,37,135,176,4,37,176,4,37,11,176,10,37,16,176,9,37,193,176,2,37,176,2,37,11,176,7,37,16,176,6,37,193,27,176,7,37,176,11,37,176,11,37,184,255,255,176,118,43,176,4,37,176,4,37,11,176,7,37,176,10,37,176,119,43,176,10,37,176,8,37,176,8,37,184,255,255,176,118,43,176,2,37,176,2,37,11,176,10,37,176,7,37,176,119,43,89,176,10,37,70,176,10,37,70,96,176,8,37,70,176,8,37,70,96,176,6,37,176,6,37,11,176,12,37,176,12,37,176,12,38,32,176,0,80,88,33,176,106,27,176,108,89,43,176,4,37,176,4,37,11,176,9,37,176,9,37,176,9,38,32,176,0,80,88,33,176,106,27,176,108,89,43,35,176,10,37,70,176,10,37,70,96,97,176,32,99,35,176,8,37,70,176,8,37,70,96,97,176,32,99,177,1,12,37,84,88,4,27,5,89,176,10,38,32,16,176,3,37,58,176,6,38,176,6,38,11,176,7,38,32,16,138,58,177,1,7,38,84,88,4,27,5,89,176,5,38,32,16,176,2,37,58,138,138,11,35,32,16,35,58,45,44,35,176,1,84,88,185,0,0,64,0,27,184,64,0,176,0,89,138,176,1,84,88,185,0,0,64,0,27,184,64,0,176,0,89,176,125,43,45,44,138,138,8,13,138,176,1,84,88,185,0,0,64,0,27,184,64,0,176,0,89,176,125,43,45,44,8,176,1,84,88,185,0,0,64,0,27,184,64,0,176,0,89,13,176,125,43,45,44,176,4,38,176,4,38,8,13,176,4,38,176,4,38,8,13,176,125,43,45,44,32,1,70,35,0,70,176,10,67,176,11,67,138,99,35,98,97,45,44,176,9,43,176,6,37,46,176,5,37,125,197,176,6,37,176,5,37,176,4,37,32,176,0,80,88,33,176,106,27,176,108,89,43,176,5,37,176,4,37,176,3,37,32,176,0,80,88,33,176,106,27,176,108,89,43,24,176,8,37,176,7,37,176,6,37,176,10,37,176,111,43,176,6,37,176,5,37,176,4,38,32,176,0,80,88,33,176,102,27,176,104,89,43,176,5,37,176,4,37,176,4,38,32,176,0,80,88,33,176,102,27,176,104,89,43,84,88,125,176,4,37,16,176,3,37,197,176,2,37,16,176,1,37,197,176,5,38,33,176,5,38,33,27,176,6,38,176,4,37,176,3,37,176,8,38,176,111,43,89,177,0,2,67,84,88,125,176,2,37,176,130,43,176,5,37,176,130,43,32,32,105,97,176,4,67,1,35,97,176,96,96,32,105,97,176,32,97,32,176,8,38,176,8,38,138,176,2,23,56,138,138,97,32,105,97,97,176,2,23,56,27,33,33,33,33,89,24,45,44,75,82,177,1,2,67,83,90,88,35,16,32,1,60,0,60,27,33,33,89,45,44,35,176,2,37,176,2,37,83,88,32,176,4,37,88,60,27,57,89,176,1,96,184,255,233,28,89,33,33,33,45,44,176,2,37,71,176,2,37,71,84,138,32,32,16,17,176,1,96,138,32,18,176,1,97,176,133,43,45,44,176,4,37,71,176,2,37,71,84,35,32,18,176,1,97,35,32,176,6,38,32,32,16,17,176,1,96,176,6,38,176,133,43,138,138,176,133,43,45,44,176,2,67,84,88,12,2,138,75,83,176,4,38,75,81,90,88,10,56,27,10,33,33,89,27,33,33,33,33,89,45,44,176,152,43,88,12,2,138,75,83,176,4,38,75,81,90,88,10,56,27,10,33,33,89,27,33,33,33,33,89,45,44,32,176,2,67,84,176,1,35,184,0,104,35,120,33,177,0,2,67,184,0,94,35,121,33,176,2,67,35,176,32,32,92,88,33,33,33,176,0,184,0,77,28,89,138,138,32,138,32,138,35,184,16,0,99,86,88,184,16,0,99,86,88,33,33,33,176,1,184,0,48,28,89,27,33,89,176,128,98,32,92,88,33,33,33,176,0,184,0,29,28,89,35,176,128,98,32,92,88,33,33,33,176,0,184,0,12,28,89,138,176,1,97,184,255,171,28,35,33,45,44,32,176,2,67,84,176,1,35,184,0,129,35,120,33,177,0,2,67,184,0,119,35,121,33,177,0,2,67,138,176,32,32,92,88,33,33,33,184,0,103,28,89,138,138,32,138,32,138,35,184,16,0,99,86,88,184,16,0,99,86,88,176,4,38,176,1,91,176,4,38,176,4,38,176,4,38,27,33,33,33,33,184,0,56,176,0,35,28,89,27,33,89,176,4,38,35,176,128,98,32,92,88,138,92,138,90,35,33,35,33,184,0,30,28,89,138,176,128,98,32,92,88,33,33,35,33,184,0,14,28,89,176,4,38,176,1,97,184,255,147,28,35,33,45,64,255,122,60,121,85,121,89,118,56,79,31,117,56,255,31,116,56,171,31,115,54,205,31,114,54,255,31,113,54,171,31,112,55,255,31,111,53,255,31,110,51,94,31,109,51,255,31,108,52,171,31,107,52,255,31,106,50,255,31,105,48,103,31,104,48,255,31,103,48,114,31,102,48,69,31,101,49,255,31,100,49,205,31,99,49,79,31,98,47,94,31,97,47,255,31,96,46,79,31,95,46,171,31,94,46,255,31,93,46,54,31,92,45,255,31,91,44,94,31,90,44,255,31,89,44,103,31,88,43,94,31,87,43,147,31,86,43,255,31,85,42,255,31,84,41,94,31,83,41,171,31,82,41,255,31,81,40,128,31,80,40,255,31,79,40,128,31,78,39,255,31,77,38,255,31,76,37,255,31,75,37,128,31,74,37,64,31,73,36,255,31,72,35,255,31,71,34,171,31,70,34,255,31,69,34,94,31,68,33,147,31,67,33,255,31,66,31,205,31,65,31,255,31,64,31,171,31,63,32,255,31,62,32,103,31,61,30,255,31,60,29,255,31,59,28,114,31,58,28,255,31,57,28,79,31,55,64,194,54,94,31,52,51,79,31,49,48,43,31,41,40,79,31,40,21,27,25,92,39,27,45,31,38,37,64,31,37,14,26,25,92,36,26,49,31,35,25,31,31,34,25,255,31,33,31,103,31,32,31,64,31,31,28,24,22,92,30,24,28,31,29,23,255,31,28,22,255,31,27,50,25,31,91,24,56,22,55,91,26,50,25,31,91,23,56,22,55,91,21,25,62,22,255,90,19,49,18,85,17,49,16,85,18,89,16,89,13,50,12,85,5,50,4,85,12,89,4,89,15,4,127,4,239,4,3,15,255,14,85,11,50,10,85,7,50,6,85,1,95,0,85,14,89,10,89,6,89,207,6,239,6,2,0,89,111,0,127,0,175,0,239,0,4,16,0,1,9,50,8,85,3,50,2,85,8,89,2,89,15,2,127,2,239,2,3,16,0,3,64,64,5,1,184,1,144,176,84,43,75,184,7,255,82,75,176,9,80,91,176,1,136,176,37,83,176,1,136,176,64,81,90,176,6,136,176,0,85,90,91,88,177,1,1,142,89,133,141,141,0,29,66,75,176,144,83,88,178,3,0,0,29,66,89,177,2,2,67,81,88,177,4,3,142,89,66,115,0,43,0,43,43,43,115,115,0,43,115,0,43,0,43,0,43,43,43,43,43,115,0,43,0,43,43,43,0,43,0,43,43,43,1,43,1,43,1,43,1,43,1,43,1,43,0,43,43,1,43,43,43,1,43,43,0,43,0,43,43,43,1,43,43,1,43,0,43,43,1,43,43,43,0,43,43,43,43,43,43,43,43,43,1,43,43,43,43,0,43,43,43,43,43,43,43,43,43,43,43,43,1,43,43,43,43,0,43,43,43,43,43,43,43,43,43,43,1,43,43,43,43,43,43,43,43,0,43,43,43,43,43,43,43,43,43,43,43,43,0,43,43,24,0,6,20,0,11,5,182,0,22,5,182,0,22,4,72,0,20,0,0,255,234,0,0,255,236,0,0,255,234,254,22,255,254,5,182,0,21,0,0,255,235,0,0,0,168,0,170,0,150,0,150,0,166,0,130,0,130,0,171,0,150,0,113,0,159,0,143,0,169,0,166,0,200,0,109,0,138,0,154,0,107,0,142,0,155,0,122,0,164,0,141,1,58,0,132,0,154,0,162,0,138,0,238,0,133,0,120,1,72,0,133,0,122,0,154,0,158,0,170,0,179,0,150,0,113,0,133,0,144,0,153,0,159,0,164,0,169,0,176,0,155,0,166,0,172,0,200,0,109,0,122,0,130,0,138,0,154,0,107,0,130,0,138,0,146,0,155,0,160,0,166,0,122,0,163,0,171,0,175,0,131,0,140,0,152,1,58,0,113,0,128,0,135,0,143,0,155,0,165,0,125,0,134,0,139,0,149,0,155,0,165,0,174,0,238,0,120,0,126,0,136,0,147,1,72,0,121,0,128,0,134,0,139,0,148,0,154,0,167,6,194,3,122,5,10,0,20,255,56,2,158,3,167,0,0,0,22,1,14,0,3,0,1,4,9,0,0,0,172,0,0,0,3,0,1,4,9,0,1,0,18,0,172,0,3,0,1,4,9,0,2,0,14,0,190,0,3,0,1,4,9,0,3,0,54,0,204,0,3,0,1,4,9,0,4,0,34,1,2,0,3,0,1,4,9,0,5,0,26,1,36,0,3,0,1,4,9,0,6,0,32,1,62,0,3,0,1,4,9,0,7,0,164,1,94,0,3,0,1,4,9,0,8,0,42,2,2,0,3,0,1,4,9,0,9,0,40,2,44,0,3,0,1,4,9,0,10,0,66,2,84,0,3,0,1,4,9,0,11,0,62,2,150,0,3,0,1,4,9,0,12,0,60,2,212,0,3,0,1,4,9,0,13,1,34,3,16,0,3,0,1,4,9,0,14,0,52,4,50,0,3,0,1,4,9,0,25,0,26,4,102,0,3,0,1,4,9,1,0,0,12,4,128,0,3,0,1,4,9,1,1,0,10,4,140,0,3,0,1,4,9,1,4,0,14,0,190,0,3,0,1,4,9,1,26,0,12,4,150,0,3,0,1,4,9,1,28,0,12,4,162,0,3,0,1,4,9,1,29,0,10,4,174,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,50,0,48,0,32,0,84,0,104,0,101,0,32,0,79,0,112,0,101,0,110,0,32,0,83,0,97,0,110,0,115,0,32,0,80,0,114,0,111,0,106,0,101,0,99,0,116,0,32,0,65,0,117,0,116,0,104,0,111,0,114,0,115,0,32,0,40,0,104,0,116,0,116,0,112,0,115,0,58,0,47,0,47,0,103,0,105,0,116,0,104,0,117,0,98,0,46,0,99,0,111,0,109,0,47,0,103,0,111,0,111,0,103,0,108,0,101,0,102,0,111,0,110,0,116,0,115,0,47,0,111,0,112,0,101,0,110,0,115,0,97,0,110,0,115,0,41,0,79,0,112,0,101,0,110,0,32,0,83,0,97,0,110,0,115,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,51,0,46,0,48,0,48,0,48,0,59,0,71,0,79,0,79,0,71,0,59,0,79,0,112,0,101,0,110,0,83,0,97,0,110,0,115,0,45,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,79,0,112,0,101,0,110,0,32,0,83,0,97,0,110,0,115,0,32,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,51,0,46,0,48,0,48,0,48,0,79,0,112,0,101,0,110,0,83,0,97,0,110,0,115,0,45,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,79,0,112,0,101,0,110,0,32,0,83,0,97,0,110,0,115,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,97,0,110,0,100,0,32,0,109,0,97,0,121,0,32,0,98,0,101,0,32,0,114,0,101,0,103,0,105,0,115,0,116,0,101,0,114,0,101,0,100,0,32,0,105,0,110,0,32,0,99,0,101,0,114,0,116,0,97,0,105,0,110,0,32,0,106,0,117,0,114,0,105,0,115,0,100,0,105,0,99,0,116,0,105,0,111,0,110,0,115,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,105,0,115,0,32,0,97,0,118,0,97,0,105,0,108,0,97,0,98,0,108,0,101,0,32,0,119,0,105,0,116,0,104,0,32,0,97,0,32,0,70,0,65,0,81,0,32,0,97,0,116,0,58,0,32,0,104,0,116,0,116,0,112,0,115,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,79,0,112,0,101,0,110,0,83,0,97,0,110,0,115,0,82,0,111,0,109,0,97,0,110,0,87,0,101,0,105,0,103,0,104,0,116,0,87,0,105,0,100,0,116,0,104,0,78,0,111,0,114,0,109,0,97,0,108,0,73,0,116,0,97,0,108,0,105,0,99,0,82,0,111,0,109,0,97,0,110,0,0,0,2,0,0,0,0,0,0,255,156,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,116,0,0,1,2,1,3,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,65,0,66,0,67,0,68,0,69,0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,79,0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,0,92,0,93,0,94,0,95,0,96,0,97,1,4,0,163,0,132,0,133,0,189,0,150,0,232,0,134,0,142,0,139,0,157,0,169,0,164,1,5,0,138,1,6,0,131,0,147,1,7,1,8,0,141,1,9,0,136,0,195,0,222,1,10,0,158,0,170,0,245,0,244,0,246,0,162,0,173,0,201,0,199,0,174,0,98,0,99,0,144,0,100,0,203,0,101,0,200,0,202,0,207,0,204,0,205,0,206,0,233,0,102,0,211,0,208,0,209,0,175,0,103,0,240,0,145,0,214,0,212,0,213,0,104,0,235,0,237,0,137,0,106,0,105,0,107,0,109,0,108,0,110,0,160,0,111,0,113,0,112,0,114,0,115,0,117,0,116,0,118,0,119,0,234,0,120,0,122,0,121,0,123,0,125,0,124,0,184,0,161,0,127,0,126,0,128,0,129,0,236,0,238,0,186,1,11,1,12,1,13,1,14,1,15,1,16,0,253,0,254,1,17,1,18,1,19,1,20,0,255,1,0,1,21,1,22,1,23,1,1,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,0,248,0,249,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,0,250,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,0,226,0,227,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,0,176,0,177,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,0,251,0,252,0,228,0,229,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,113,0,187,1,114,1,115,1,116,1,117,0,230,0,231,1,118,0,166,1,119,1,120,1,121,1,122,1,123,1,124,1,125,1,126,0,216,0,225,0,218,0,219,0,220,0,221,0,224,0,217,0,223,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,148,1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,167,1,168,1,169,1,170,1,171,1,172,1,173,1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,0,155,1,184,1,185,1,186,1,187,1,188,1,189,1,190,1,191,1,192,1,193,1,194,1,195,1,196,1,197,1,198,1,199,1,200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,1,209,1,210,1,211,1,212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,221,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,232,1,233,1,234,1,235,1,236,1,237,1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,245,1,246,1,247,1,248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,2,2,3,2,4,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,34,2,35,2,36,2,37,2,38,2,39,2,40,2,41,2,42,2,43,0,178,0,179,2,44,2,45,0,182,0,183,0,196,2,46,0,180,0,181,0,197,0,130,0,194,0,135,0,171,0,198,2,47,2,48,0,190,0,191,2,49,0,188,2,50,0,247,2,51,2,52,2,53,2,54,2,55,2,56,0,140,2,57,2,58,2,59,2,60,2,61,2,62,0,152,2,63,0,154,0,153,0,239,0,165,0,146,0,156,0,167,0,143,0,148,0,149,0,185,2,64,2,65,2,66,2,67,2,68,2,69,2,70,2,71,2,72,2,73,2,74,2,75,2,76,2,77,2,78,2,79,2,80,2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,2,92,2,93,2,94,2,95,2,96,2,97,2,98,2,99,2,100,2,101,2,102,2,103,2,104,2,105,2,106,2,107,2,108,2,109,2,110,2,111,2,112,2,113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,121,2,122,2,123,2,124,2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,132,2,133,2,134,2,135,2,136,2,137,2,138,2,139,2,140,2,141,2,142,2,143,2,144,2,145,2,146,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,2,159,2,160,2,161,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,172,2,173,2,174,2,175,2,176,2,177,2,178,2,179,2,180,2,181,2,182,2,183,2,184,2,185,2,186,2,187,2,188,2,189,2,190,2,191,2,192,2,193,2,194,2,195,2,196,2,197,2,198,2,199,2,200,2,201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,211,2,212,2,213,2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,223,2,224,2,225,2,226,2,227,2,228,2,229,2,230,2,231,2,232,2,233,2,234,2,235,2,236,2,237,2,238,2,239,2,240,2,241,2,242,2,243,2,244,2,245,2,246,2,247,2,248,2,249,2,250,2,251,2,252,2,253,2,254,2,255,3,0,3,1,3,2,3,3,3,4,3,5,3,6,3,7,3,8,3,9,3,10,3,11,3,12,3,13,3,14,3,15,3,16,3,17,3,18,3,19,3,20,3,21,3,22,3,23,3,24,3,25,3,26,3,27,3,28,3,29,3,30,3,31,3,32,3,33,3,34,3,35,3,36,3,37,3,38,3,39,3,40,3,41,3,42,3,43,3,44,3,45,3,46,3,47,3,48,3,49,3,50,3,51,3,52,3,53,3,54,3,55,3,56,3,57,3,58,3,59,3,60,3,61,3,62,3,63,3,64,3,65,3,66,3,67,3,68,3,69,3,70,3,71,3,72,3,73,3,74,3,75,3,76,3,77,3,78,3,79,3,80,3,81,3,82,3,83,3,84,3,85,3,86,3,87,3,88,3,89,3,90,3,91,3,92,3,93,3,94,3,95,3,96,3,97,3,98,3,99,3,100,3,101,3,102,3,103,3,104,3,105,3,106,3,107,3,108,3,109,3,110,3,111,3,112,3,113,3,114,3,115,3,116,3,117,3,118,3,119,3,120,3,121,3,122,3,123,3,124,3,125,3,126,3,127,3,128,3,129,3,130,3,131,3,132,3,133,3,134,3,135,3,136,3,137,3,138,3,139,3,140,3,141,3,142,3,143,3,144,3,145,3,146,3,147,3,148,3,149,3,150,3,151,0,192,0,193,3,152,3,153,3,154,3,155,3,156,3,157,3,158,3,159,3,160,3,161,3,162,3,163,3,164,3,165,3,166,3,167,3,168,3,169,3,170,3,171,3,172,3,173,3,174,3,175,3,176,3,177,3,178,3,179,3,180,3,181,3,182,3,183,3,184,3,185,0,215,3,186,3,187,3,188,3,189,3,190,3,191,3,192,3,193,3,194,3,195,3,196,3,197,3,198,3,199,3,200,3,201,3,202,3,203,3,204,3,205,3,206,3,207,3,208,3,209,3,210,3,211,3,212,3,213,3,214,3,215,3,216,3,217,3,218,3,219,3,220,3,221,3,222,3,223,3,224,3,225,3,226,3,227,3,228,3,229,3,230,3,231,3,232,3,233,3,234,3,235,3,236,3,237,3,238,3,239,3,240,3,241,3,242,3,243,3,244,3,245,3,246,3,247,3,248,3,249,3,250,3,251,3,252,3,253,3,254,3,255,4,0,4,1,4,2,4,3,4,4,4,5,4,6,4,7,4,8,4,9,4,10,4,11,4,12,4,13,4,14,4,15,4,16,4,17,4,18,4,19,4,20,4,21,4,22,4,23,4,24,4,25,4,26,4,27,4,28,4,29,4,30,4,31,4,32,4,33,4,34,4,35,4,36,4,37,4,38,4,39,4,40,4,41,4,42,4,43,4,44,4,45,4,46,4,47,4,48,4,49,4,50,4,51,4,52,4,53,4,54,4,55,4,56,4,57,4,58,4,59,4,60,4,61,4,62,4,63,4,64,4,65,4,66,4,67,4,68,4,69,4,70,4,71,4,72,4,73,4,74,4,75,4,76,4,77,4,78,4,79,4,80,4,81,4,82,4,83,4,84,4,85,4,86,4,87,4,88,4,89,4,90,4,91,4,92,4,93,4,94,4,95,4,96,4,97,4,98,4,99,4,100,4,101,4,102,4,103,4,104,4,105,4,106,4,107,4,108,4,109,4,110,4,111,4,112,4,113,4,114,4,115,4,116,4,117,4,118,4,119,4,120,4,121,4,122,4,123,4,124,4,125,4,78,85,76,76,2,67,82,7,117,110,105,48,48,65,48,7,117,110,105,48,48,65,68,9,111,118,101,114,115,99,111,114,101,7,117,110,105,48,48,66,50,7,117,110,105,48,48,66,51,7,117,110,105,48,48,66,53,7,117,110,105,48,48,66,57,7,65,109,97,99,114,111,110,7,97,109,97,99,114,111,110,6,65,98,114,101,118,101,6,97,98,114,101,118,101,7,65,111,103,111,110,101,107,7,97,111,103,111,110,101,107,11,67,99,105,114,99,117,109,102,108,101,120,11,99,99,105,114,99,117,109,102,108,101,120,4,67,100,111,116,4,99,100,111,116,6,68,99,97,114,111,110,6,100,99,97,114,111,110,6,68,99,114,111,97,116,7,69,109,97,99,114,111,110,7,101,109,97,99,114,111,110,6,69,98,114,101,118,101,6,101,98,114,101,118,101,10,69,100,111,116,97,99,99,101,110,116,10,101,100,111,116,97,99,99,101,110,116,7,69,111,103,111,110,101,107,7,101,111,103,111,110,101,107,6,69,99,97,114,111,110,6,101,99,97,114,111,110,11,71,99,105,114,99,117,109,102,108,101,120,11,103,99,105,114,99,117,109,102,108,101,120,4,71,100,111,116,4,103,100,111,116,7,117,110,105,48,49,50,50,7,117,110,105,48,49,50,51,11,72,99,105,114,99,117,109,102,108,101,120,11,104,99,105,114,99,117,109,102,108,101,120,4,72,98,97,114,4,104,98,97,114,6,73,116,105,108,100,101,6,105,116,105,108,100,101,7,73,109,97,99,114,111,110,7,105,109,97,99,114,111,110,6,73,98,114,101,118,101,6,105,98,114,101,118,101,7,73,111,103,111,110,101,107,7,105,111,103,111,110,101,107,2,73,74,2,105,106,11,74,99,105,114,99,117,109,102,108,101,120,11,106,99,105,114,99,117,109,102,108,101,120,7,117,110,105,48,49,51,54,7,117,110,105,48,49,51,55,12,107,103,114,101,101,110,108,97,110,100,105,99,6,76,97,99,117,116,101,6,108,97,99,117,116,101,7,117,110,105,48,49,51,66,7,117,110,105,48,49,51,67,6,76,99,97,114,111,110,6,108,99,97,114,111,110,4,76,100,111,116,4,108,100,111,116,6,78,97,99,117,116,101,6,110,97,99,117,116,101,7,117,110,105,48,49,52,53,7,117,110,105,48,49,52,54,6,78,99,97,114,111,110,6,110,99,97,114,111,110,11,110,97,112,111,115,116,114,111,112,104,101,3,69,110,103,3,101,110,103,7,79,109,97,99,114,111,110,7,111,109,97,99,114,111,110,6,79,98,114,101,118,101,6,111,98,114,101,118,101,13,79,104,117,110,103,97,114,117,109,108,97,117,116,13,111,104,117,110,103,97,114,117,109,108,97,117,116,6,82,97,99,117,116,101,6,114,97,99,117,116,101,7,117,110,105,48,49,53,54,7,117,110,105,48,49,53,55,6,82,99,97,114,111,110,6,114,99,97,114,111,110,6,83,97,99,117,116,101,6,115,97,99,117,116,101,11,83,99,105,114,99,117,109,102,108,101,120,11,115,99,105,114,99,117,109,102,108,101,120,7,117,110,105,48,50,49,65,7,117,110,105,48,50,49,66,6,84,99,97,114,111,110,6,116,99,97,114,111,110,4,84,98,97,114,4,116,98,97,114,6,85,116,105,108,100,101,6,117,116,105,108,100,101,7,85,109,97,99,114,111,110,7,117,109,97,99,114,111,110,6,85,98,114,101,118,101,6,117,98,114,101,118,101,5,85,114,105,110,103,5,117,114,105,110,103,13,85,104,117,110,103,97,114,117,109,108,97,117,116,13,117,104,117,110,103,97,114,117,109,108,97,117,116,7,85,111,103,111,110,101,107,7,117,111,103,111,110,101,107,11,87,99,105,114,99,117,109,102,108,101,120,11,119,99,105,114,99,117,109,102,108,101,120,11,89,99,105,114,99,117,109,102,108,101,120,11,121,99,105,114,99,117,109,102,108,101,120,6,90,97,99,117,116,101,6,122,97,99,117,116,101,10,90,100,111,116,97,99,99,101,110,116,10,122,100,111,116,97,99,99,101,110,116,5,108,111,110,103,115,10,65,114,105,110,103,97,99,117,116,101,10,97,114,105,110,103,97,99,117,116,101,7,65,69,97,99,117,116,101,7,97,101,97,99,117,116,101,11,79,115,108,97,115,104,97,99,117,116,101,11,111,115,108,97,115,104,97,99,117,116,101,7,117,110,105,48,50,49,56,7,117,110,105,48,50,49,57,5,116,111,110,111,115,13,100,105,101,114,101,115,105,115,116,111,110,111,115,10,65,108,112,104,97,116,111,110,111,115,9,97,110,111,116,101,108,101,105,97,12,69,112,115,105,108,111,110,116,111,110,111,115,8,69,116,97,116,111,110,111,115,9,73,111,116,97,116,111,110,111,115,12,79,109,105,99,114,111,110,116,111,110,111,115,12,85,112,115,105,108,111,110,116,111,110,111,115,10,79,109,101,103,97,116,111,110,111,115,17,105,111,116,97,100,105,101,114,101,115,105,115,116,111,110,111,115,5,65,108,112,104,97,4,66,101,116,97,5,71,97,109,109,97,7,117,110,105,48,51,57,52,7,69,112,115,105,108,111,110,4,90,101,116,97,3,69,116,97,5,84,104,101,116,97,4,73,111,116,97,5,75,97,112,112,97,6,76,97,109,98,100,97,2,77,117,2,78,117,2,88,105,7,79,109,105,99,114,111,110,2,80,105,3,82,104,111,5,83,105,103,109,97,3,84,97,117,7,85,112,115,105,108,111,110,3,80,104,105,3,67,104,105,3,80,115,105,7,117,110,105,48,51,65,57,12,73,111,116,97,100,105,101,114,101,115,105,115,15,85,112,115,105,108,111,110,100,105,101,114,101,115,105,115,10,97,108,112,104,97,116,111,110,111,115,12,101,112,115,105,108,111,110,116,111,110,111,115,8,101,116,97,116,111,110,111,115,9,105,111,116,97,116,111,110,111,115,20,117,112,115,105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,111,115,5,97,108,112,104,97,4,98,101,116,97,5,103,97,109,109,97,5,100,101,108,116,97,7,101,112,115,105,108,111,110,4,122,101,116,97,3,101,116,97,5,116,104,101,116,97,4,105,111,116,97,5,107,97,112,112,97,6,108,97,109,98,100,97,7,117,110,105,48,51,66,67,2,110,117,2,120,105,7,111,109,105,99,114,111,110,3,114,104,111,7,117,110,105,48,51,67,50,5,115,105,103,109,97,3,116,97,117,7,117,112,115,105,108,111,110,3,112,104,105,3,99,104,105,3,112,115,105,5,111,109,101,103,97,12,105,111,116,97,100,105,101,114,101,115,105,115,15,117,112,115,105,108,111,110,100,105,101,114,101,115,105,115,12,111,109,105,99,114,111,110,116,111,110,111,115,12,117,112,115,105,108,111,110,116,111,110,111,115,10,111,109,101,103,97,116,111,110,111,115,7,117,110,105,48,52,48,49,7,117,110,105,48,52,48,50,7,117,110,105,48,52,48,51,7,117,110,105,48,52,48,52,7,117,110,105,48,52,48,53,7,117,110,105,48,52,48,54,7,117,110,105,48,52,48,55,7,117,110,105,48,52,48,56,7,117,110,105,48,52,48,57,7,117,110,105,48,52,48,65,7,117,110,105,48,52,48,66,7,117,110,105,48,52,48,67,7,117,110,105,48,52,48,69,7,117,110,105,48,52,48,70,7,117,110,105,48,52,49,48,7,117,110,105,48,52,49,49,7,117,110,105,48,52,49,50,7,117,110,105,48,52,49,51,7,117,110,105,48,52,49,52,7,117,110,105,48,52,49,53,7,117,110,105,48,52,49,54,7,117,110,105,48,52,49,55,7,117,110,105,48,52,49,56,7,117,110,105,48,52,49,57,7,117,110,105,48,52,49,65,7,117,110,105,48,52,49,66,7,117,110,105,48,52,49,67,7,117,110,105,48,52,49,68,7,117,110,105,48,52,49,69,7,117,110,105,48,52,49,70,7,117,110,105,48,52,50,48,7,117,110,105,48,52,50,49,7,117,110,105,48,52,50,50,7,117,110,105,48,52,50,51,7,117,110,105,48,52,50,52,7,117,110,105,48,52,50,53,7,117,110,105,48,52,50,54,7,117,110,105,48,52,50,55,7,117,110,105,48,52,50,56,7,117,110,105,48,52,50,57,7,117,110,105,48,52,50,65,7,117,110,105,48,52,50,66,7,117,110,105,48,52,50,67,7,117,110,105,48,52,50,68,7,117,110,105,48,52,50,69,7,117,110,105,48,52,50,70,7,117,110,105,48,52,51,48,7,117,110,105,48,52,51,49,7,117,110,105,48,52,51,50,7,117,110,105,48,52,51,51,7,117,110,105,48,52,51,52,7,117,110,105,48,52,51,53,7,117,110,105,48,52,51,54,7,117,110,105,48,52,51,55,7,117,110,105,48,52,51,56,7,117,110,105,48,52,51,57,7,117,110,105,48,52,51,65,7,117,110,105,48,52,51,66,7,117,110,105,48,52,51,67,7,117,110,105,48,52,51,68,7,117,110,105,48,52,51,69,7,117,110,105,48,52,51,70,7,117,110,105,48,52,52,48,7,117,110,105,48,52,52,49,7,117,110,105,48,52,52,50,7,117,110,105,48,52,52,51,7,117,110,105,48,52,52,52,7,117,110,105,48,52,52,53,7,117,110,105,48,52,52,54,7,117,110,105,48,52,52,55,7,117,110,105,48,52,52,56,7,117,110,105,48,52,52,57,7,117,110,105,48,52,52,65,7,117,110,105,48,52,52,66,7,117,110,105,48,52,52,67,7,117,110,105,48,52,52,68,7,117,110,105,48,52,52,69,7,117,110,105,48,52,52,70,7,117,110,105,48,52,53,49,7,117,110,105,48,52,53,50,7,117,110,105,48,52,53,51,7,117,110,105,48,52,53,52,7,117,110,105,48,52,53,53,7,117,110,105,48,52,53,54,7,117,110,105,48,52,53,55,7,117,110,105,48,52,53,56,7,117,110,105,48,52,53,57,7,117,110,105,48,52,53,65,7,117,110,105,48,52,53,66,7,117,110,105,48,52,53,67,7,117,110,105,48,52,53,69,7,117,110,105,48,52,53,70,7,117,110,105,48,52,57,48,7,117,110,105,48,52,57,49,6,87,103,114,97,118,101,6,119,103,114,97,118,101,6,87,97,99,117,116,101,6,119,97,99,117,116,101,9,87,100,105,101,114,101,115,105,115,9,119,100,105,101,114,101,115,105,115,6,89,103,114,97,118,101,6,121,103,114,97,118,101,7,117,110,105,50,48,49,53,13,117,110,100,101,114,115,99,111,114,101,100,98,108,13,113,117,111,116,101,114,101,118,101,114,115,101,100,6,109,105,110,117,116,101,6,115,101,99,111,110,100,9,101,120,99,108,97,109,100,98,108,7,117,110,105,50,48,55,70,9,97,102,105,105,48,56,57,52,49,6,112,101,115,101,116,97,4,69,117,114,111,7,117,110,105,50,49,48,53,7,117,110,105,50,49,49,51,7,117,110,105,50,49,49,54,7,117,110,105,50,49,50,54,9,101,115,116,105,109,97,116,101,100,9,111,110,101,101,105,103,104,116,104,12,116,104,114,101,101,101,105,103,104,116,104,115,11,102,105,118,101,101,105,103,104,116,104,115,12,115,101,118,101,110,101,105,103,104,116,104,115,7,117,110,105,50,50,48,54,13,99,121,114,105,108,108,105,99,98,114,101,118,101,16,99,97,114,111,110,99,111,109,109,97,97,99,99,101,110,116,7,117,110,105,48,51,50,54,17,99,111,109,109,97,97,99,99,101,110,116,114,111,116,97,116,101,7,117,110,105,50,48,55,52,7,117,110,105,50,48,55,53,7,117,110,105,50,48,55,55,7,117,110,105,50,48,55,56,7,117,110,105,50,48,48,48,7,117,110,105,50,48,48,49,7,117,110,105,50,48,48,50,7,117,110,105,50,48,48,51,7,117,110,105,50,48,48,52,7,117,110,105,50,48,48,53,7,117,110,105,50,48,48,54,7,117,110,105,50,48,48,55,7,117,110,105,50,48,48,56,7,117,110,105,50,48,48,57,7,117,110,105,50,48,48,65,7,117,110,105,50,48,48,66,7,117,110,105,70,69,70,70,7,117,110,105,70,70,70,67,7,117,110,105,70,70,70,68,7,117,110,105,48,49,70,48,7,117,110,105,48,50,66,67,7,117,110,105,48,51,68,49,7,117,110,105,48,51,68,50,7,117,110,105,48,51,68,54,7,117,110,105,49,69,51,69,7,117,110,105,49,69,51,70,7,117,110,105,49,69,48,48,7,117,110,105,49,69,48,49,7,117,110,105,48,50,70,51,5,79,104,111,114,110,5,111,104,111,114,110,5,85,104,111,114,110,5,117,104,111,114,110,4,104,111,111,107,7,117,110,105,48,52,48,48,7,117,110,105,48,52,48,68,7,117,110,105,48,52,53,48,7,117,110,105,48,52,53,68,7,117,110,105,48,52,54,48,7,117,110,105,48,52,54,49,7,117,110,105,48,52,54,50,7,117,110,105,48,52,54,51,7,117,110,105,48,52,54,52,7,117,110,105,48,52,54,53,7,117,110,105,48,52,54,54,7,117,110,105,48,52,54,55,7,117,110,105,48,52,54,56,7,117,110,105,48,52,54,57,7,117,110,105,48,52,54,65,7,117,110,105,48,52,54,66,7,117,110,105,48,52,54,67,7,117,110,105,48,52,54,68,7,117,110,105,48,52,54,69,7,117,110,105,48,52,54,70,7,117,110,105,48,52,55,48,7,117,110,105,48,52,55,49,7,117,110,105,48,52,55,50,7,117,110,105,48,52,55,51,7,117,110,105,48,52,55,52,7,117,110,105,48,52,55,53,7,117,110,105,48,52,55,54,7,117,110,105,48,52,55,55,7,117,110,105,48,52,55,56,7,117,110,105,48,52,55,57,7,117,110,105,48,52,55,65,7,117,110,105,48,52,55,66,7,117,110,105,48,52,55,67,7,117,110,105,48,52,55,68,7,117,110,105,48,52,55,69,7,117,110,105,48,52,55,70,7,117,110,105,48,52,56,48,7,117,110,105,48,52,56,49,7,117,110,105,48,52,56,50,7,117,110,105,48,52,56,56,7,117,110,105,48,52,56,57,7,117,110,105,48,52,56,65,7,117,110,105,48,52,56,66,7,117,110,105,48,52,56,67,7,117,110,105,48,52,56,68,7,117,110,105,48,52,56,69,7,117,110,105,48,52,56,70,7,117,110,105,48,52,57,50,7,117,110,105,48,52,57,51,7,117,110,105,48,52,57,52,7,117,110,105,48,52,57,53,7,117,110,105,48,52,57,54,7,117,110,105,48,52,57,55,7,117,110,105,48,52,57,56,7,117,110,105,48,52,57,57,7,117,110,105,48,52,57,65,7,117,110,105,48,52,57,66,7,117,110,105,48,52,57,67,7,117,110,105,48,52,57,68,7,117,110,105,48,52,57,69,7,117,110,105,48,52,57,70,7,117,110,105,48,52,65,48,7,117,110,105,48,52,65,49,7,117,110,105,48,52,65,50,7,117,110,105,48,52,65,51,7,117,110,105,48,52,65,52,7,117,110,105,48,52,65,53,7,117,110,105,48,52,65,54,7,117,110,105,48,52,65,55,7,117,110,105,48,52,65,56,7,117,110,105,48,52,65,57,7,117,110,105,48,52,65,65,7,117,110,105,48,52,65,66,7,117,110,105,48,52,65,67,7,117,110,105,48,52,65,68,7,117,110,105,48,52,65,69,7,117,110,105,48,52,65,70,7,117,110,105,48,52,66,48,7,117,110,105,48,52,66,49,7,117,110,105,48,52,66,50,7,117,110,105,48,52,66,51,7,117,110,105,48,52,66,52,7,117,110,105,48,52,66,53,7,117,110,105,48,52,66,54,7,117,110,105,48,52,66,55,7,117,110,105,48,52,66,56,7,117,110,105,48,52,66,57,7,117,110,105,48,52,66,65,7,117,110,105,48,52,66,66,7,117,110,105,48,52,66,67,7,117,110,105,48,52,66,68,7,117,110,105,48,52,66,69,7,117,110,105,48,52,66,70,7,117,110,105,48,52,67,48,7,117,110,105,48,52,67,49,7,117,110,105,48,52,67,50,7,117,110,105,48,52,67,51,7,117,110,105,48,52,67,52,7,117,110,105,48,52,67,53,7,117,110,105,48,52,67,54,7,117,110,105,48,52,67,55,7,117,110,105,48,52,67,56,7,117,110,105,48,52,67,57,7,117,110,105,48,52,67,65,7,117,110,105,48,52,67,66,7,117,110,105,48,52,67,67,7,117,110,105,48,52,67,68,7,117,110,105,48,52,67,69,7,117,110,105,48,52,67,70,7,117,110,105,48,52,68,48,7,117,110,105,48,52,68,49,7,117,110,105,48,52,68,50,7,117,110,105,48,52,68,51,7,117,110,105,48,52,68,52,7,117,110,105,48,52,68,53,7,117,110,105,48,52,68,54,7,117,110,105,48,52,68,55,7,117,110,105,48,52,68,56,7,117,110,105,48,52,68,57,7,117,110,105,48,52,68,65,7,117,110,105,48,52,68,66,7,117,110,105,48,52,68,67,7,117,110,105,48,52,68,68,7,117,110,105,48,52,68,69,7,117,110,105,48,52,68,70,7,117,110,105,48,52,69,48,7,117,110,105,48,52,69,49,7,117,110,105,48,52,69,50,7,117,110,105,48,52,69,51,7,117,110,105,48,52,69,52,7,117,110,105,48,52,69,53,7,117,110,105,48,52,69,54,7,117,110,105,48,52,69,55,7,117,110,105,48,52,69,56,7,117,110,105,48,52,69,57,7,117,110,105,48,52,69,65,7,117,110,105,48,52,69,66,7,117,110,105,48,52,69,67,7,117,110,105,48,52,69,68,7,117,110,105,48,52,69,69,7,117,110,105,48,52,69,70,7,117,110,105,48,52,70,48,7,117,110,105,48,52,70,49,7,117,110,105,48,52,70,50,7,117,110,105,48,52,70,51,7,117,110,105,48,52,70,52,7,117,110,105,48,52,70,53,7,117,110,105,48,52,70,54,7,117,110,105,48,52,70,55,7,117,110,105,48,52,70,56,7,117,110,105,48,52,70,57,7,117,110,105,48,52,70,65,7,117,110,105,48,52,70,66,7,117,110,105,48,52,70,67,7,117,110,105,48,52,70,68,7,117,110,105,48,52,70,69,7,117,110,105,48,52,70,70,7,117,110,105,48,53,48,48,7,117,110,105,48,53,48,49,7,117,110,105,48,53,48,50,7,117,110,105,48,53,48,51,7,117,110,105,48,53,48,52,7,117,110,105,48,53,48,53,7,117,110,105,48,53,48,54,7,117,110,105,48,53,48,55,7,117,110,105,48,53,48,56,7,117,110,105,48,53,48,57,7,117,110,105,48,53,48,65,7,117,110,105,48,53,48,66,7,117,110,105,48,53,48,67,7,117,110,105,48,53,48,68,7,117,110,105,48,53,48,69,7,117,110,105,48,53,48,70,7,117,110,105,48,53,49,48,7,117,110,105,48,53,49,49,7,117,110,105,48,53,49,50,7,117,110,105,48,53,49,51,7,117,110,105,49,69,65,48,7,117,110,105,49,69,65,49,7,117,110,105,49,69,65,50,7,117,110,105,49,69,65,51,7,117,110,105,49,69,65,52,7,117,110,105,49,69,65,53,7,117,110,105,49,69,65,54,7,117,110,105,49,69,65,55,7,117,110,105,49,69,65,56,7,117,110,105,49,69,65,57,7,117,110,105,49,69,65,65,7,117,110,105,49,69,65,66,7,117,110,105,49,69,65,67,7,117,110,105,49,69,65,68,7,117,110,105,49,69,65,69,7,117,110,105,49,69,65,70,7,117,110,105,49,69,66,48,7,117,110,105,49,69,66,49,7,117,110,105,49,69,66,50,7,117,110,105,49,69,66,51,7,117,110,105,49,69,66,52,7,117,110,105,49,69,66,53,7,117,110,105,49,69,66,54,7,117,110,105,49,69,66,55,7,117,110,105,49,69,66,56,7,117,110,105,49,69,66,57,7,117,110,105,49,69,66,65,7,117,110,105,49,69,66,66,7,117,110,105,49,69,66,67,7,117,110,105,49,69,66,68,7,117,110,105,49,69,66,69,7,117,110,105,49,69,66,70,7,117,110,105,49,69,67,48,7,117,110,105,49,69,67,49,7,117,110,105,49,69,67,50,7,117,110,105,49,69,67,51,7,117,110,105,49,69,67,52,7,117,110,105,49,69,67,53,7,117,110,105,49,69,67,54,7,117,110,105,49,69,67,55,7,117,110,105,49,69,67,56,7,117,110,105,49,69,67,57,7,117,110,105,49,69,67,65,7,117,110,105,49,69,67,66,7,117,110,105,49,69,67,67,7,117,110,105,49,69,67,68,7,117,110,105,49,69,67,69,7,117,110,105,49,69,67,70,7,117,110,105,49,69,68,48,7,117,110,105,49,69,68,49,7,117,110,105,49,69,68,50,7,117,110,105,49,69,68,51,7,117,110,105,49,69,68,52,7,117,110,105,49,69,68,53,7,117,110,105,49,69,68,54,7,117,110,105,49,69,68,55,7,117,110,105,49,69,68,56,7,117,110,105,49,69,68,57,7,117,110,105,49,69,68,65,7,117,110,105,49,69,68,66,7,117,110,105,49,69,68,67,7,117,110,105,49,69,68,68,7,117,110,105,49,69,68,69,7,117,110,105,49,69,68,70,7,117,110,105,49,69,69,48,7,117,110,105,49,69,69,49,7,117,110,105,49,69,69,50,7,117,110,105,49,69,69,51,7,117,110,105,49,69,69,52,7,117,110,105,49,69,69,53,7,117,110,105,49,69,69,54,7,117,110,105,49,69,69,55,7,117,110,105,49,69,69,56,7,117,110,105,49,69,69,57,7,117,110,105,49,69,69,65,7,117,110,105,49,69,69,66,7,117,110,105,49,69,69,67,7,117,110,105,49,69,69,68,7,117,110,105,49,69,69,69,7,117,110,105,49,69,69,70,7,117,110,105,49,69,70,48,7,117,110,105,49,69,70,49,7,117,110,105,49,69,70,52,7,117,110,105,49,69,70,53,7,117,110,105,49,69,70,54,7,117,110,105,49,69,70,55,7,117,110,105,49,69,70,56,7,117,110,105,49,69,70,57,7,117,110,105,50,48,65,66,19,99,105,114,99,117,109,102,108,101,120,97,99,117,116,101,99,111,109,98,19,99,105,114,99,117,109,102,108,101,120,103,114,97,118,101,99,111,109,98,18,99,105,114,99,117,109,102,108,101,120,104,111,111,107,99,111,109,98,19,99,105,114,99,117,109,102,108,101,120,116,105,108,100,101,99,111,109,98,14,98,114,101,118,101,97,99,117,116,101,99,111,109,98,14,98,114,101,118,101,103,114,97,118,101,99,111,109,98,13,98,114,101,118,101,104,111,111,107,99,111,109,98,14,98,114,101,118,101,116,105,108,100,101,99,111,109,98,16,99,121,114,105,108,108,105,99,104,111,111,107,108,101,102,116,17,99,121,114,105,108,108,105,99,98,105,103,104,111,111,107,85,67,7,117,110,105,48,49,54,50,7,117,110,105,48,49,54,51,7,117,110,105,48,49,69,65,7,117,110,105,48,49,69,66,7,117,110,105,48,49,69,67,7,117,110,105,48,49,69,68,7,117,110,105,48,50,53,57,13,104,111,111,107,97,98,111,118,101,99,111,109,98,7,117,110,105,49,70,52,68,7,117,110,105,49,70,68,69,7,117,110,105,50,48,55,48,7,117,110,105,50,48,55,54,7,117,110,105,50,48,55,57,19,117,110,105,48,51,66,57,48,51,48,56,48,51,48,52,48,51,48,48,19,117,110,105,48,51,66,57,48,51,48,56,48,51,48,52,48,51,48,49,19,117,110,105,48,51,66,57,48,51,48,56,48,51,48,54,48,51,48,48,19,117,110,105,48,51,66,57,48,51,48,56,48,51,48,54,48,51,48,49,19,117,110,105,48,51,67,53,48,51,48,56,48,51,48,52,48,51,48,48,19,117,110,105,48,51,67,53,48,51,48,56,48,51,48,52,48,51,48,49,19,117,110,105,48,51,67,53,48,51,48,56,48,51,48,54,48,51,48,48,19,117,110,105,48,51,67,53,48,51,48,56,48,51,48,54,48,51,48,49,8,69,110,103,46,97,108,116,49,8,69,110,103,46,97,108,116,50,8,69,110,103,46,97,108,116,51,15,117,110,105,48,51,48,49,48,51,48,54,48,51,48,56,15,117,110,105,48,51,48,48,48,51,48,54,48,51,48,56,15,117,110,105,48,51,48,49,48,51,48,52,48,51,48,56,15,117,110,105,48,51,48,48,48,51,48,52,48,51,48,56,15,99,121,114,105,108,108,105,99,95,111,116,109,97,114,107,3,102,95,102,5,102,95,102,95,105,5,102,95,102,95,108,7,117,110,105,49,69,57,69,7,117,110,105,65,55,66,51,7,117,110,105,65,55,66,52,15,117,110,105,48,49,51,66,46,108,111,99,108,77,65,72,15,117,110,105,48,49,52,53,46,108,111,99,108,77,65,72,15,65,111,103,111,110,101,107,46,108,111,99,108,78,65,86,15,69,111,103,111,110,101,107,46,108,111,99,108,78,65,86,15,73,111,103,111,110,101,107,46,108,111,99,108,78,65,86,15,85,111,103,111,110,101,107,46,108,111,99,108,78,65,86,6,73,46,115,97,108,116,6,74,46,115,97,108,116,11,73,103,114,97,118,101,46,115,97,108,116,11,73,97,99,117,116,101,46,115,97,108,116,16,73,99,105,114,99,117,109,102,108,101,120,46,115,97,108,116,14,73,100,105,101,114,101,115,105,115,46,115,97,108,116,11,73,116,105,108,100,101,46,115,97,108,116,12,73,109,97,99,114,111,110,46,115,97,108,116,11,73,98,114,101,118,101,46,115,97,108,116,12,73,111,103,111,110,101,107,46,115,97,108,116,20,73,111,103,111,110,101,107,95,108,111,99,108,78,65,86,46,115,97,108,116,15,73,100,111,116,97,99,99,101,110,116,46,115,97,108,116,7,73,74,46,115,97,108,116,16,74,99,105,114,99,117,109,102,108,101,120,46,115,97,108,116,12,117,110,105,49,69,67,56,46,115,97,108,116,12,117,110,105,49,69,67,65,46,115,97,108,116,14,73,111,116,97,116,111,110,111,115,46,115,97,108,116,9,73,111,116,97,46,115,97,108,116,17,73,111,116,97,100,105,101,114,101,115,105,115,46,115,97,108,116,12,117,110,105,48,52,48,54,46,115,97,108,116,12,117,110,105,48,52,48,55,46,115,97,108,116,12,117,110,105,48,52,48,56,46,115,97,108,116,12,117,110,105,48,52,67,48,46,115,97,108,116,7,117,110,105,48,50,51,55,7,117,110,105,65,55,66,53,7,117,110,105,65,66,53,51,11,117,110,105,48,49,50,51,46,97,108,116,15,117,110,105,48,49,51,67,46,108,111,99,108,77,65,72,15,117,110,105,48,49,52,54,46,108,111,99,108,77,65,72,15,97,111,103,111,110,101,107,46,108,111,99,108,78,65,86,15,101,111,103,111,110,101,107,46,108,111,99,108,78,65,86,15,105,111,103,111,110,101,107,46,108,111,99,108,78,65,86,15,117,111,103,111,110,101,107,46,108,111,99,108,78,65,86,6,103,46,115,97,108,116,16,103,99,105,114,99,117,109,102,108,101,120,46,115,97,108,116,11,103,98,114,101,118,101,46,115,97,108,116,9,103,100,111,116,46,115,97,108,116,11,102,108,111,114,105,110,46,115,115,48,51,15,117,110,105,48,52,51,49,46,108,111,99,108,83,82,66,12,117,110,105,48,52,67,70,46,115,97,108,116,7,117,110,105,50,48,57,53,7,117,110,105,50,48,57,54,7,117,110,105,50,48,57,55,7,117,110,105,50,48,57,56,7,117,110,105,50,48,57,57,7,117,110,105,50,48,57,65,7,117,110,105,50,48,57,66,7,117,110,105,50,48,57,67,7,117,110,105,48,53,68,48,7,117,110,105,48,53,68,49,7,117,110,105,48,53,68,50,7,117,110,105,48,53,68,51,7,117,110,105,48,53,68,52,7,117,110,105,48,53,68,53,7,117,110,105,48,53,68,54,7,117,110,105,48,53,68,55,7,117,110,105,48,53,68,56,7,117,110,105,48,53,68,57,7,117,110,105,48,53,68,65,7,117,110,105,48,53,68,66,7,117,110,105,48,53,68,67,7,117,110,105,48,53,68,68,7,117,110,105,48,53,68,69,7,117,110,105,48,53,68,70,7,117,110,105,48,53,69,48,7,117,110,105,48,53,69,49,7,117,110,105,48,53,69,50,7,117,110,105,48,53,69,51,7,117,110,105,48,53,69,52,7,117,110,105,48,53,69,53,7,117,110,105,48,53,69,54,7,117,110,105,48,53,69,55,7,117,110,105,48,53,69,56,7,117,110,105,48,53,69,57,7,117,110,105,48,53,69,65,7,117,110,105,70,66,50,65,7,117,110,105,70,66,50,66,7,117,110,105,70,66,50,67,7,117,110,105,70,66,50,68,7,117,110,105,70,66,50,69,7,117,110,105,70,66,50,70,7,117,110,105,70,66,51,48,7,117,110,105,70,66,51,49,7,117,110,105,70,66,51,50,7,117,110,105,70,66,51,51,7,117,110,105,70,66,51,52,7,117,110,105,70,66,51,53,7,117,110,105,70,66,51,54,7,117,110,105,70,66,51,56,7,117,110,105,70,66,51,57,7,117,110,105,70,66,51,65,7,117,110,105,70,66,51,66,7,117,110,105,70,66,51,67,7,117,110,105,70,66,51,69,7,117,110,105,70,66,52,48,7,117,110,105,70,66,52,49,7,117,110,105,70,66,52,51,7,117,110,105,70,66,52,52,7,117,110,105,70,66,52,54,7,117,110,105,70,66,52,55,7,117,110,105,70,66,52,56,7,117,110,105,70,66,52,57,7,117,110,105,70,66,52,65,7,117,110,105,70,66,52,66,9,103,114,97,118,101,99,111,109,98,9,97,99,117,116,101,99,111,109,98,7,117,110,105,48,51,48,50,9,116,105,108,100,101,99,111,109,98,7,117,110,105,48,51,48,52,7,117,110,105,48,51,48,54,7,117,110,105,48,51,48,55,7,117,110,105,48,51,48,56,7,117,110,105,48,51,48,65,7,117,110,105,48,51,48,66,7,117,110,105,48,51,48,67,7,117,110,105,48,51,48,70,7,117,110,105,48,51,49,50,12,100,111,116,98,101,108,111,119,99,111,109,98,7,117,110,105,48,51,50,55,7,117,110,105,48,51,50,56,7,117,110,105,48,52,56,53,7,117,110,105,48,52,56,54,7,117,110,105,48,52,56,51,7,117,110,105,48,52,56,52,7,117,110,105,48,53,66,48,7,117,110,105,48,53,66,49,7,117,110,105,48,53,66,50,7,117,110,105,48,53,66,51,7,117,110,105,48,53,66,52,7,117,110,105,48,53,66,53,7,117,110,105,48,53,66,54,7,117,110,105,48,53,66,55,7,117,110,105,48,53,66,56,7,117,110,105,48,53,66,57,7,117,110,105,48,53,66,65,7,117,110,105,48,53,66,66,7,117,110,105,48,53,66,67,7,117,110,105,48,53,66,68,7,117,110,105,48,53,67,49,7,117,110,105,48,53,67,50,7,117,110,105,48,53,67,55,9,122,101,114,111,46,100,110,111,109,8,111,110,101,46,100,110,111,109,8,116,119,111,46,100,110,111,109,10,116,104,114,101,101,46,100,110,111,109,9,102,111,117,114,46,100,110,111,109,9,102,105,118,101,46,100,110,111,109,8,115,105,120,46,100,110,111,109,10,115,101,118,101,110,46,100,110,111,109,10,101,105,103,104,116,46,100,110,111,109,9,110,105,110,101,46,100,110,111,109,7,122,101,114,111,46,108,102,6,111,110,101,46,108,102,6,116,119,111,46,108,102,8,116,104,114,101,101,46,108,102,7,102,111,117,114,46,108,102,7,102,105,118,101,46,108,102,6,115,105,120,46,108,102,8,115,101,118,101,110,46,108,102,8,101,105,103,104,116,46,108,102,7,110,105,110,101,46,108,102,9,122,101,114,111,46,110,117,109,114,8,111,110,101,46,110,117,109,114,8,116,119,111,46,110,117,109,114,10,116,104,114,101,101,46,110,117,109,114,9,102,111,117,114,46,110,117,109,114,9,102,105,118,101,46,110,117,109,114,8,115,105,120,46,110,117,109,114,10,115,101,118,101,110,46,110,117,109,114,10,101,105,103,104,116,46,110,117,109,114,9,110,105,110,101,46,110,117,109,114,8,122,101,114,111,46,111,115,102,7,111,110,101,46,111,115,102,7,116,119,111,46,111,115,102,9,116,104,114,101,101,46,111,115,102,8,102,111,117,114,46,111,115,102,8,102,105,118,101,46,111,115,102,7,115,105,120,46,111,115,102,9,115,101,118,101,110,46,111,115,102,9,101,105,103,104,116,46,111,115,102,8,110,105,110,101,46,111,115,102,10,122,101,114,111,46,115,108,97,115,104,9,122,101,114,111,46,116,111,115,102,8,111,110,101,46,116,111,115,102,8,116,119,111,46,116,111,115,102,10,116,104,114,101,101,46,116,111,115,102,9,102,111,117,114,46,116,111,115,102,9,102,105,118,101,46,116,111,115,102,8,115,105,120,46,116,111,115,102,10,115,101,118,101,110,46,116,111,115,102,10,101,105,103,104,116,46,116,111,115,102,9,110,105,110,101,46,116,111,115,102,7,117,110,105,50,48,56,48,7,117,110,105,50,48,56,49,7,117,110,105,50,48,56,50,7,117,110,105,50,48,56,51,7,117,110,105,50,48,56,52,7,117,110,105,50,48,56,53,7,117,110,105,50,48,56,54,7,117,110,105,50,48,56,55,7,117,110,105,50,48,56,56,7,117,110,105,50,48,56,57,7,117,110,105,48,53,66,69,7,117,110,105,50,48,55,68,7,117,110,105,50,48,56,68,7,117,110,105,50,48,55,69,7,117,110,105,50,48,56,69,7,117,110,105,50,48,55,65,7,117,110,105,50,48,55,67,7,117,110,105,50,48,56,65,7,117,110,105,50,48,56,67,7,117,110,105,50,50,49,53,7,117,110,105,50,48,65,65,7,117,110,105,50,49,50,48,16,97,102,105,105,49,48,49,48,51,100,111,116,108,101,115,115,16,97,102,105,105,49,48,49,48,53,100,111,116,108,101,115,115,12,99,111,109,109,97,97,99,99,101,110,116,50,14,105,111,103,111,110,101,107,100,111,116,108,101,115,115,14,117,110,105,49,69,67,66,100,111,116,108,101,115,115,0,0,0,1,0,3,0,8,0,10,0,13,0,7,255,255,0,15,0,1,0,2,0,14,0,0,0,0,0,0,1,92,0,2,0,55,0,36,0,61,0,1,0,68,0,93,0,1,0,108,0,108,0,1,0,124,0,124,0,1,0,130,0,141,0,1,0,146,0,152,0,1,0,154,0,184,0,1,0,186,0,222,0,1,0,224,0,224,0,1,0,226,0,226,0,1,0,228,0,228,0,1,0,230,0,233,0,1,0,235,0,235,0,1,0,237,0,237,0,1,0,239,0,239,0,1,0,241,0,241,0,1,0,244,1,73,0,1,1,83,1,84,0,3,1,85,1,85,0,1,1,87,1,88,0,1,1,90,1,101,0,1,1,103,1,117,0,1,1,119,1,159,0,1,1,162,2,0,0,1,2,53,2,53,0,3,2,74,2,74,0,1,2,77,2,77,0,1,2,79,2,82,0,1,2,84,2,87,0,1,2,89,2,118,0,1,2,125,2,126,0,1,2,130,2,176,0,1,2,178,2,181,0,1,2,183,2,196,0,1,2,198,3,49,0,1,3,51,3,51,0,1,3,53,3,97,0,1,3,109,3,115,0,1,3,116,3,116,0,3,3,117,3,117,0,1,3,118,3,118,0,3,3,122,3,132,0,1,3,138,3,142,0,2,3,143,3,143,0,1,3,148,3,149,0,1,3,151,3,164,0,1,3,166,3,172,0,1,3,174,3,176,0,1,3,179,3,179,0,1,3,182,3,190,0,1,3,192,3,192,0,1,3,201,3,227,0,1,4,1,4,37,0,3,4,111,4,112,0,1,4,114,4,115,0,1,0,1,0,3,0,0,0,16,0,0,0,52,0,0,0,92,0,1,0,16,2,53,4,14,4,15,4,16,4,21,4,22,4,23,4,24,4,25,4,26,4,27,4,28,4,29,4,32,4,34,4,37,0,2,0,6,1,83,1,84,0,0,3,116,3,116,0,2,3,118,3,118,0,3,4,1,4,13,0,4,4,17,4,20,0,17,4,30,4,30,0,21,0,1,0,1,4,35,0,0,0,1,0,0,0,34,0,20,0,10,0,4,0,56,0,64,0,72,0,82,0,2,109,97,114,107,0,82,109,107,109,107,0,90,0,5,68,70,76,84,0,84,99,121,114,108,0,84,103,114,101,107,0,84,104,101,98,114,0,84,108,97,116,110,0,84,0,4,0,0,0,1,0,56,0,5,0,0,0,1,0,60,0,6,0,16,0,1,0,64,0,0,0,6,0,16,0,1,0,66,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,2,0,3,0,52,0,0,0,1,0,130,3,44,0,5,2,130,4,86,0,1,1,12,0,46,0,2,1,220,0,56,0,1,0,140,0,66,0,1,1,52,0,56,0,1,0,164,0,66,0,1,1,106,0,204,0,0,255,255,0,2,0,0,0,1,0,2,0,1,3,138,3,142,0,0,0,5,33,150,33,160,33,170,33,180,33,194,0,4,33,114,33,120,33,126,33,132,0,1,0,4,2,53,4,14,4,15,4,16,0,2,0,4,3,116,3,116,0,0,3,118,3,118,0,1,4,1,4,13,0,2,4,17,4,20,0,15,0,2,0,5,1,83,1,84,0,0,2,53,2,53,0,2,3,116,3,116,0,3,3,118,3,118,0,4,4,1,4,37,0,5,0,1,0,16,2,53,4,14,4,15,4,16,4,21,4,22,4,23,4,24,4,25,4,26,4,27,4,28,4,29,4,32,4,34,4,37,0,2,0,6,1,83,1,84,0,0,3,116,3,116,0,2,3,118,3,118,0,3,4,1,4,13,0,4,4,17,4,20,0,17,4,30,4,30,0,21,0,19,33,36,33,42,33,48,33,54,33,60,33,66,33,72,33,78,33,84,33,90,33,96,33,102,33,108,33,114,33,120,33,126,33,132,33,138,33,144,0,2,0,8,1,83,1,84,0,0,2,53,2,53,0,2,3,116,3,116,0,3,3,118,3,118,0,4,4,1,4,30,0,5,4,32,4,32,0,35,4,34,4,34,0,36,4,37,4,37,0,37,0,16,0,0,33,58,0,0,33,64,0,0,33,70,0,0,33,76,0,0,33,82,0,0,33,88,0,0,33,106,0,0,33,106,0,0,33,94,0,0,33,100,0,0,33,106,0,0,33,112,0,0,33,118,0,0,33,124,0,0,33,130,0,0,33,136,0,22,0,0,33,76,0,0,33,82,0,0,33,88,0,0,33,190,0,0,33,94,0,0,33,100,0,0,33,142,0,0,33,106,0,0,33,112,0,0,33,118,0,0,33,142,0,0,33,124,0,0,33,130,0,0,33,136,0,0,33,142,0,0,33,148,0,0,33,154,0,0,33,160,0,0,33,166,0,0,33,172,0,0,33,178,0,0,33,184,0,38,0,0,32,242,0,0,32,248,0,1,32,158,0,0,32,254,0,0,33,100,0,0,33,4,0,0,33,10,0,0,33,52,0,0,33,16,0,0,33,22,0,0,33,28,0,0,33,52,0,0,33,34,0,0,33,40,0,0,33,46,0,0,33,52,0,0,33,58,0,0,33,64,0,1,32,164,0,1,32,170,0,1,32,176,0,0,33,70,0,0,33,76,0,0,33,82,0,0,33,88,0,1,32,182,0,1,32,188,0,1,32,206,0,1,32,206,0,1,32,194,0,1,32,200,0,1,32,206,0,1,32,212,0,1,32,218,0,0,33,94,0,1,32,224,0,1,32,230,0,1,32,236,0,42,0,0,32,88,0,0,32,94,0,1,32,4,0,0,32,100,0,0,32,202,0,0,32,106,0,0,32,112,0,0,32,154,0,0,32,118,0,0,32,124,0,0,32,130,0,0,32,154,0,0,32,136,0,0,32,142,0,0,32,148,0,0,32,154,0,0,32,160,0,0,32,166,0,1,32,10,0,1,32,16,0,1,32,22,0,0,32,172,0,0,32,178,0,0,32,184,0,0,32,190,0,1,32,28,0,1,32,34,0,1,32,52,0,1,32,52,0,1,32,40,0,1,32,46,0,1,32,52,0,1,32,58,0,1,32,64,0,0,32,196,0,4,32,208,0,1,32,70,0,3,32,214,0,1,32,76,0,2,32,220,0,4,32,226,0,1,32,82,0,2,0,49,0,36,0,61,0,0,0,68,0,93,0,26,0,108,0,108,0,52,0,124,0,124,0,53,0,130,0,141,0,54,0,146,0,152,0,66,0,154,0,184,0,73,0,186,0,222,0,104,0,224,0,224,0,141,0,226,0,226,0,142,0,228,0,228,0,143,0,230,0,233,0,144,0,235,0,235,0,148,0,237,0,237,0,149,0,239,0,239,0,150,0,241,0,241,0,151,0,244,1,73,0,152,1,85,1,85,0,238,1,87,1,88,0,239,1,90,1,101,0,241,1,103,1,117,0,253,1,119,1,159,1,12,1,162,2,0,1,53,2,74,2,74,1,148,2,77,2,77,1,149,2,79,2,82,1,150,2,84,2,87,1,154,2,89,2,118,1,158,2,125,2,126,1,188,2,130,2,176,1,190,2,178,2,181,1,237,2,183,2,196,1,241,2,198,3,49,1,255,3,51,3,51,2,107,3,53,3,97,2,108,3,109,3,115,2,153,3,117,3,117,2,160,3,122,3,132,2,161,3,143,3,143,2,172,3,148,3,149,2,173,3,151,3,164,2,175,3,166,3,172,2,189,3,174,3,176,2,196,3,179,3,179,2,199,3,182,3,190,2,200,3,192,3,192,2,209,3,201,3,227,2,210,4,111,4,112,2,237,4,114,4,115,2,239,2,241,49,2,49,8,31,20,0,0,0,0,38,4,50,136,31,26,0,0,0,0,42,174,38,82,31,32,0,0,0,0,31,38,33,174,31,44,31,50,0,0,49,14,49,20,31,56,0,0,0,0,31,62,37,188,31,68,0,0,0,0,34,8,34,2,31,74,0,0,0,0,38,106,39,18,31,80,31,86,0,0,31,92,31,98,31,104,0,0,0,0,37,194,34,86,31,110,0,0,0,0,36,120,46,50,31,116,0,0,0,0,34,122,38,202,31,122,31,128,0,0,38,52,40,68,31,134,0,0,0,0,48,222,36,132,31,140,0,0,0,0,49,56,47,106,31,164,31,146,0,0,38,70,38,76,31,152,0,0,0,0,49,56,31,158,31,164,0,0,0,0,34,230,46,50,31,170,0,0,0,0,37,182,37,188,31,176,0,0,0,0,48,108,38,88,31,182,31,188,0,0,49,26,49,32,31,194,0,0,0,0,49,104,41,190,31,200,0,0,0,0,31,206,46,2,31,212,0,0,0,0,38,100,45,120,31,218,0,0,0,0,48,54,48,90,31,224,0,0,0,0,36,114,37,14,31,230,0,0,0,0,49,146,46,194,31,236,0,0,0,0,31,242,46,26,31,248,0,0,0,0,42,186,39,36,31,254,0,0,0,0,45,138,45,144,32,4,32,10,0,0,49,158,47,28,32,16,0,0,0,0,32,22,32,28,32,34,0,0,0,0,32,40,32,46,32,52,0,0,0,0,32,58,34,32,32,64,32,70,0,0,49,170,39,180,32,76,0,0,0,0,49,170,52,50,32,76,0,0,0,0,34,128,42,78,32,82,0,0,0,0,34,128,34,134,32,88,32,94,0,0,32,100,40,80,32,106,0,0,0,0,49,182,39,222,34,182,0,0,0,0,48,132,49,20,32,112,32,118,0,0,43,170,39,30,32,124,0,0,0,0,41,208,32,130,49,200,0,0,0,0,34,242,35,10,42,6,0,0,0,0,39,174,51,168,32,136,0,0,0,0,48,120,35,76,32,142,32,148,0,0,49,182,47,232,34,182,0,0,0,0,32,154,32,160,32,166,0,0,0,0,32,172,40,44,32,178,0,0,0,0,39,60,50,28,32,184,0,0,0,0,48,66,48,102,32,190,0,0,0,0,32,196,35,208,32,202,0,0,0,0,32,208,32,214,0,0,0,0,0,0,32,220,32,226,0,0,0,0,0,0,32,232,49,8,0,0,0,0,0,0,32,232,49,8,0,0,0,0,0,0,46,146,49,8,0,0,0,0,0,0,32,238,49,8,0,0,0,0,0,0,43,242,49,8,0,0,0,0,0,0,32,244,49,8,0,0,0,0,0,0,32,250,44,4,0,0,0,0,0,0,42,174,33,0,0,0,0,0,0,0,40,116,49,20,0,0,0,0,0,0,40,116,49,20,0,0,0,0,0,0,47,34,49,20,0,0,0,0,0,0,37,164,49,20,0,0,0,0,0,0,33,180,33,186,0,0,0,0,0,0,33,6,36,132,0,0,0,0,0,0,36,6,47,106,0,0,0,0,0,0,36,6,47,106,0,0,0,0,0,0,47,118,47,106,0,0,0,0,0,0,33,12,47,106,0,0,0,0,0,0,44,166,47,106,0,0,0,0,0,0,36,150,44,178,0,0,0,0,0,0,35,130,49,32,0,0,0,0,0,0,35,130,49,32,0,0,0,0,0,0,33,18,49,32,0,0,0,0,0,0,33,24,49,32,0,0,0,0,0,0,40,50,48,90,0,0,0,0,0,0,33,30,38,76,0,0,0,0,0,0,33,36,33,42,0,0,0,0,0,0,33,48,46,194,0,0,0,0,0,0,33,48,46,194,0,0,0,0,0,0,46,152,46,194,0,0,0,0,0,0,33,54,46,194,0,0,0,0,0,0,43,248,46,194,0,0,0,0,0,0,33,60,46,194,0,0,0,0,0,0,33,66,44,16,0,0,0,0,0,0,42,186,33,72,0,0,0,0,0,0,40,128,47,28,0,0,0,0,0,0,40,128,47,28,0,0,0,0,0,0,47,40,47,28,0,0,0,0,0,0,39,150,47,28,0,0,0,0,0,0,33,78,52,80,0,0,0,0,0,0,33,78,52,80,0,0,0,0,0,0,40,56,52,80,0,0,0,0,0,0,39,186,52,80,0,0,0,0,0,0,33,84,36,204,0,0,0,0,0,0,35,88,39,222,0,0,0,0,0,0,36,12,49,20,0,0,0,0,0,0,36,12,49,20,0,0,0,0,0,0,47,130,49,20,0,0,0,0,0,0,33,90,49,20,0,0,0,0,0,0,44,184,49,20,0,0,0,0,0,0,48,132,44,190,0,0,0,0,0,0,35,136,47,232,0,0,0,0,0,0,35,136,47,232,0,0,0,0,0,0,34,164,47,232,0,0,0,0,0,0,33,96,47,232,0,0,0,0,0,0,44,250,48,102,0,0,0,0,0,0,33,102,41,214,0,0,0,0,0,0,44,232,48,102,0,0,0,0,0,0,33,108,49,8,0,0,0,0,0,0,33,114,46,194,0,0,0,0,0,0,46,200,49,8,0,0,0,0,0,0,46,212,46,194,0,0,0,0,0,0,33,120,33,126,0,0,0,0,0,0,49,146,49,152,0,0,0,0,0,0,33,132,38,82,0,0,0,0,0,0,33,138,39,36,0,0,0,0,0,0,33,156,38,82,0,0,0,0,0,0,33,162,39,36,0,0,0,0,0,0,33,144,38,82,0,0,0,0,0,0,33,150,39,36,0,0,0,0,0,0,33,156,38,82,0,0,0,0,0,0,33,162,39,36,0,0,0,0,0,0,33,168,33,174,0,0,0,0,0,0,45,138,45,144,0,0,0,0,0,0,33,180,33,186,0,0,0,0,0,0,33,192,33,198,0,0,0,0,0,0,33,204,49,20,0,0,0,0,0,0,33,210,47,28,0,0,0,0,0,0,33,216,49,20,0,0,0,0,0,0,33,222,47,28,0,0,0,0,0,0,33,228,49,20,0,0,0,0,0,0,33,234,47,28,0,0,0,0,0,0,49,14,48,156,0,0,0,0,0,0,49,158,49,164,0,0,0,0,0,0,47,34,49,20,0,0,0,0,0,0,47,40,47,28,0,0,0,0,0,0,33,240,34,2,0,0,0,0,0,0,33,246,34,2,0,0,0,0,0,0,33,252,34,2,0,0,0,0,0,0,34,8,34,14,0,0,0,0,0,0,34,20,39,18,0,0,0,0,0,0,34,26,34,32,0,0,0,0,0,0,38,106,34,38,0,0,0,0,0,0,34,44,39,222,0,0,0,0,0,0,34,50,52,80,0,0,0,0,0,0,34,56,52,80,0,0,0,0,0,0,34,62,52,80,0,0,0,0,0,0,49,170,49,176,0,0,0,0,0,0,34,68,34,74,0,0,0,0,0,0,34,80,34,86,0,0,0,0,0,0,40,56,52,50,0,0,0,0,0,0,36,120,34,236,0,0,0,0,0,0,34,128,34,92,0,0,0,0,0,0,46,62,42,78,0,0,0,0,0,0,34,98,38,202,0,0,0,0,0,0,34,104,34,134,0,0,0,0,0,0,34,122,34,110,0,0,0,0,0,0,34,128,34,116,0,0,0,0,0,0,34,122,38,202,0,0,0,0,0,0,34,128,34,134,0,0,0,0,0,0,34,122,38,202,0,0,0,0,0,0,34,128,34,134,0,0,0,0,0,0,34,122,38,202,0,0,0,0,0,0,34,128,34,134,0,0,0,0,0,0,34,140,36,132,0,0,0,0,0,0,35,136,39,222,0,0,0,0,0,0,48,222,34,146,0,0,0,0,0,0,49,182,34,152,0,0,0,0,0,0,34,158,36,132,0,0,0,0,0,0,34,164,39,222,0,0,0,0,0,0,34,170,34,176,0,0,0,0,0,0,48,222,48,228,0,0,0,0,0,0,49,182,39,156,34,182,0,0,0,0,48,138,47,106,0,0,0,0,0,0,48,150,49,20,0,0,0,0,0,0,34,188,47,106,0,0,0,0,0,0,34,194,49,20,0,0,0,0,0,0,36,6,47,106,0,0,0,0,0,0,36,12,49,20,0,0,0,0,0,0,34,200,52,74,0,0,0,0,0,0,34,206,34,212,0,0,0,0,0,0,34,218,46,50,0,0,0,0,0,0,34,224,35,10,0,0,0,0,0,0,34,230,34,236,0,0,0,0,0,0,34,242,34,248,0,0,0,0,0,0,34,254,46,50,0,0,0,0,0,0,35,4,35,10,0,0,0,0,0,0,35,16,37,188,0,0,0,0,0,0,35,22,51,168,0,0,0,0,0,0,35,40,37,188,0,0,0,0,0,0,35,46,51,168,0,0,0,0,0,0,37,182,35,28,0,0,0,0,0,0,39,174,35,34,0,0,0,0,0,0,35,40,37,188,0,0,0,0,0,0,35,46,51,168,0,0,0,0,0,0,48,108,35,52,0,0,0,0,0,0,48,120,35,58,0,0,0,0,0,0,35,64,38,88,0,0,0,0,0,0,35,70,35,76,0,0,0,0,0,0,48,108,38,88,0,0,0,0,0,0,48,120,35,76,0,0,0,0,0,0,35,82,49,32,0,0,0,0,0,0,35,88,47,232,0,0,0,0,0,0,35,94,49,32,0,0,0,0,0,0,35,100,47,232,0,0,0,0,0,0,35,106,49,32,0,0,0,0,0,0,35,112,47,232,0,0,0,0,0,0,35,118,49,32,0,0,0,0,0,0,35,124,47,232,0,0,0,0,0,0,35,130,49,32,0,0,0,0,0,0,35,136,47,232,0,0,0,0,0,0,49,26,35,142,0,0,0,0,0,0,49,182,49,188,0,0,0,0,0,0,35,148,46,2,0,0,0,0,0,0,35,154,40,44,0,0,0,0,0,0,35,160,48,90,0,0,0,0,0,0,35,166,48,102,0,0,0,0,0,0,36,162,48,90,0,0,0,0,0,0,35,172,37,14,0,0,0,0,0,0,35,178,35,208,0,0,0,0,0,0,35,184,37,14,0,0,0,0,0,0,35,190,35,208,0,0,0,0,0,0,35,196,37,14,0,0,0,0,0,0,35,202,35,208,0,0,0,0,0,0,35,214,35,220,0,0,0,0,0,0,35,226,35,232,0,0,0,0,0,0,35,238,42,126,0,0,0,0,0,0,35,244,46,194,0,0,0,0,0,0,35,250,44,4,0,0,0,0,0,0,36,0,44,16,0,0,0,0,0,0,36,6,44,178,0,0,0,0,0,0,36,12,44,190,0,0,0,0,0,0,37,182,36,18,0,0,0,0,0,0,39,174,36,24,0,0,0,0,0,0,49,2,49,8,0,0,0,0,0,0,36,30,36,36,0,0,0,0,0,0,36,42,36,48,0,0,0,0,0,0,36,54,36,60,0,0,0,0,0,0,36,66,36,72,0,0,0,0,0,0,36,78,36,84,0,0,0,0,0,0,36,90,48,192,0,0,0,0,0,0,49,2,49,8,0,0,0,0,36,156,36,96,36,102,0,0,0,0,0,0,38,10,38,16,0,0,0,0,0,0,36,114,36,108,0,0,0,0,0,0,49,14,49,20,0,0,0,0,36,156,36,114,37,14,0,0,0,0,0,0,38,106,39,18,0,0,0,0,36,156,49,56,47,106,0,0,0,0,0,0,36,120,46,50,0,0,0,0,0,0,36,126,44,190,0,0,0,0,0,0,38,52,40,68,0,0,0,0,0,0,48,222,36,132,0,0,0,0,0,0,49,44,36,138,0,0,0,0,0,0,49,56,47,106,0,0,0,0,36,156,38,58,38,64,0,0,0,0,0,0,38,70,38,76,0,0,0,0,0,0,37,182,36,144,0,0,0,0,0,0,48,108,38,88,0,0,0,0,0,0,48,54,48,90,0,0,0,0,36,156,41,64,41,70,0,0,0,0,0,0,38,100,45,120,0,0,0,0,0,0,41,64,41,70,0,0,0,0,0,0,36,150,47,106,0,0,0,0,36,156,36,162,48,90,0,0,0,0,0,0,36,168,36,204,0,0,0,0,0,0,36,174,46,68,0,0,0,0,0,0,36,180,39,156,0,0,0,0,0,0,36,186,48,192,0,0,0,0,0,0,36,192,48,204,0,0,0,0,0,0,36,198,36,204,0,0,0,0,0,0,36,210,40,110,36,216,0,0,0,0,36,222,36,228,36,234,0,0,0,0,36,240,51,84,0,0,0,0,0,0,46,62,46,68,0,0,0,0,0,0,36,246,36,252,0,0,0,0,0,0,37,2,39,156,0,0,0,0,0,0,37,8,37,14,37,20,0,0,0,0,52,62,48,192,0,0,0,0,0,0,46,62,42,78,0,0,0,0,0,0,37,26,37,32,0,0,0,0,0,0,37,38,37,44,0,0,0,0,0,0,45,102,37,50,0,0,0,0,0,0,37,56,37,62,0,0,0,0,0,0,48,132,49,20,0,0,0,0,0,0,37,68,37,74,0,0,0,0,0,0,40,98,37,80,0,0,0,0,0,0,37,86,37,92,0,0,0,0,0,0,49,182,39,222,0,0,0,0,0,0,37,98,37,104,0,0,0,0,0,0,41,208,48,204,0,0,0,0,0,0,43,2,37,110,0,0,0,0,0,0,42,48,37,116,37,122,0,0,0,0,41,76,41,82,0,0,0,0,0,0,37,128,37,158,0,0,0,0,0,0,39,186,48,192,0,0,0,0,0,0,37,134,48,204,0,0,0,0,0,0,37,140,49,20,0,0,0,0,0,0,37,146,48,204,0,0,0,0,0,0,37,152,37,158,0,0,0,0,0,0,37,164,49,20,0,0,0,0,0,0,37,230,44,52,0,0,0,0,0,0,37,170,38,16,0,0,0,0,0,0,41,136,37,176,0,0,0,0,0,0,37,182,37,188,0,0,0,0,0,0,37,194,37,200,0,0,0,0,0,0,37,206,37,212,0,0,0,0,0,0,37,218,37,224,0,0,0,0,0,0,37,230,44,52,0,0,0,0,0,0,40,116,51,126,0,0,0,0,0,0,37,236,44,244,0,0,0,0,0,0,38,58,37,242,0,0,0,0,0,0,49,2,49,8,0,0,0,0,0,0,37,248,37,254,0,0,0,0,0,0,38,4,50,136,0,0,0,0,0,0,38,10,38,16,0,0,0,0,0,0,42,84,38,22,0,0,0,0,0,0,49,14,49,20,0,0,0,0,0,0,38,28,44,70,0,0,0,0,0,0,49,128,44,112,0,0,0,0,0,0,49,56,44,148,0,0,0,0,0,0,38,34,44,148,0,0,0,0,0,0,38,40,51,126,0,0,0,0,0,0,38,46,52,2,0,0,0,0,0,0,38,52,40,68,0,0,0,0,0,0,38,106,39,18,0,0,0,0,0,0,49,56,47,106,0,0,0,0,0,0,38,58,38,64,0,0,0,0,0,0,38,70,38,76,0,0,0,0,0,0,42,174,38,82,0,0,0,0,0,0,48,108,38,88,0,0,0,0,0,0,38,94,44,244,0,0,0,0,0,0,41,64,41,70,0,0,0,0,0,0,38,100,45,120,0,0,0,0,0,0,38,106,38,112,0,0,0,0,0,0,38,118,45,6,0,0,0,0,0,0,38,124,38,130,0,0,0,0,0,0,38,136,38,142,0,0,0,0,0,0,38,148,38,154,0,0,0,0,0,0,38,160,45,48,0,0,0,0,0,0,38,166,52,32,0,0,0,0,0,0,38,172,44,202,0,0,0,0,0,0,38,178,38,184,0,0,0,0,0,0,38,190,42,126,0,0,0,0,0,0,49,146,46,194,0,0,0,0,0,0,38,196,38,202,0,0,0,0,0,0,38,208,38,214,0,0,0,0,0,0,41,148,41,220,0,0,0,0,0,0,38,220,38,226,0,0,0,0,0,0,49,158,47,28,0,0,0,0,0,0,38,232,44,82,0,0,0,0,0,0,38,238,44,100,0,0,0,0,0,0,38,244,44,160,0,0,0,0,0,0,38,250,44,160,0,0,0,0,0,0,45,102,42,66,0,0,0,0,0,0,39,0,39,6,0,0,0,0,0,0,39,12,39,18,0,0,0,0,0,0,42,120,42,126,0,0,0,0,0,0,48,132,49,20,0,0,0,0,0,0,43,146,39,24,0,0,0,0,0,0,43,170,39,30,0,0,0,0,0,0,42,186,39,36,0,0,0,0,0,0,42,204,39,42,0,0,0,0,0,0,48,66,48,102,0,0,0,0,0,0,39,48,39,54,0,0,0,0,0,0,39,60,50,28,0,0,0,0,0,0,39,66,39,72,0,0,0,0,0,0,39,78,45,18,0,0,0,0,0,0,39,84,39,90,0,0,0,0,0,0,39,84,39,90,0,0,0,0,0,0,39,96,39,102,0,0,0,0,0,0,39,108,45,60,0,0,0,0,0,0,39,114,39,120,0,0,0,0,0,0,39,126,50,196,0,0,0,0,0,0,39,132,39,138,0,0,0,0,0,0,43,110,39,144,0,0,0,0,0,0,39,150,47,28,0,0,0,0,0,0,39,216,39,156,0,0,0,0,0,0,39,162,41,220,0,0,0,0,0,0,39,168,50,196,0,0,0,0,0,0,39,174,51,168,0,0,0,0,0,0,49,170,39,180,0,0,0,0,0,0,39,186,52,80,0,0,0,0,0,0,49,170,52,50,0,0,0,0,0,0,39,192,39,198,0,0,0,0,0,0,39,204,39,210,0,0,0,0,0,0,39,216,39,222,0,0,0,0,0,0,39,228,42,66,0,0,0,0,0,0,39,234,48,102,0,0,0,0,0,0,39,240,39,246,0,0,0,0,0,0,39,252,40,2,0,0,0,0,0,0,40,8,40,14,0,0,0,0,0,0,40,20,46,2,0,0,0,0,0,0,40,26,40,44,0,0,0,0,0,0,40,20,46,2,0,0,0,0,0,0,40,26,40,44,0,0,0,0,0,0,40,32,46,2,0,0,0,0,0,0,40,38,40,44,0,0,0,0,0,0,40,50,48,90,0,0,0,0,0,0,44,250,48,102,0,0,0,0,0,0,40,56,52,50,0,0,0,0,0,0,48,54,0,0,0,0,0,0,0,0,40,62,40,68,0,0,0,0,0,0,40,74,40,80,0,0,0,0,0,0,49,2,40,86,0,0,0,0,0,0,49,146,40,92,0,0,0,0,0,0,49,56,44,178,0,0,0,0,0,0,40,98,40,104,0,0,0,0,0,0,49,26,40,110,0,0,0,0,0,0,49,182,50,4,0,0,0,0,0,0,40,116,49,20,0,0,0,0,0,0,40,122,44,148,0,0,0,0,0,0,40,128,47,28,0,0,0,0,0,0,40,134,44,160,0,0,0,0,0,0,40,140,40,146,0,0,0,0,0,0,40,152,40,158,0,0,0,0,0,0,40,164,40,170,0,0,0,0,0,0,40,176,40,182,0,0,0,0,0,0,40,188,40,194,0,0,0,0,0,0,40,200,40,206,0,0,0,0,0,0,40,212,40,218,0,0,0,0,0,0,40,224,48,90,0,0,0,0,0,0,40,230,40,236,0,0,0,0,0,0,40,242,40,248,0,0,0,0,0,0,40,254,41,4,0,0,0,0,0,0,41,10,52,32,0,0,0,0,0,0,41,16,41,22,0,0,0,0,0,0,41,28,41,34,0,0,0,0,0,0,41,40,41,46,0,0,0,0,0,0,41,52,41,58,0,0,0,0,0,0,41,64,41,70,0,0,0,0,0,0,41,76,41,82,0,0,0,0,0,0,49,56,44,178,0,0,0,0,0,0,48,132,44,190,0,0,0,0,0,0,45,90,50,136,0,0,0,0,0,0,41,88,41,106,0,0,0,0,0,0,41,94,50,136,0,0,0,0,0,0,41,100,41,106,0,0,0,0,0,0,41,112,41,118,0,0,0,0,0,0,41,124,41,130,0,0,0,0,0,0,41,136,41,142,0,0,0,0,0,0,41,148,41,154,0,0,0,0,0,0,41,160,41,166,0,0,0,0,0,0,41,172,41,178,0,0,0,0,0,0,41,196,41,202,0,0,0,0,0,0,41,184,41,190,0,0,0,0,0,0,41,196,41,202,0,0,0,0,0,0,41,208,41,214,0,0,0,0,0,0,45,66,42,78,0,0,0,0,0,0,45,78,41,220,0,0,0,0,0,0,41,226,41,232,0,0,0,0,0,0,41,238,41,244,0,0,0,0,0,0,41,250,42,0,0,0,0,0,0,0,42,6,42,12,0,0,0,0,0,0,44,106,42,18,0,0,0,0,0,0,42,24,42,30,0,0,0,0,0,0,42,36,42,42,0,0,0,0,0,0,42,48,42,54,0,0,0,0,0,0,45,132,48,204,0,0,0,0,0,0,42,60,42,66,0,0,0,0,0,0,49,14,51,126,0,0,0,0,0,0,42,72,42,78,0,0,0,0,0,0,42,84,42,90,0,0,0,0,0,0,42,96,51,126,0,0,0,0,0,0,43,158,43,164,0,0,0,0,0,0,42,120,42,102,0,0,0,0,0,0,42,108,42,114,0,0,0,0,0,0,42,120,42,126,0,0,0,0,0,0,42,132,42,138,0,0,0,0,0,0,42,144,42,150,0,0,0,0,0,0,42,156,42,162,0,0,0,0,0,0,42,168,44,160,0,0,0,0,0,0,42,174,42,180,0,0,0,0,0,0,42,186,42,192,0,0,0,0,0,0,48,108,42,198,0,0,0,0,0,0,42,204,42,210,0,0,0,0,0,0,48,54,48,90,0,0,0,0,0,0,42,216,42,222,0,0,0,0,0,0,48,54,48,90,0,0,0,0,0,0,42,216,42,222,0,0,0,0,0,0,45,90,42,228,0,0,0,0,0,0,42,234,42,240,0,0,0,0,0,0,42,246,42,252,0,0,0,0,0,0,43,2,43,8,0,0,0,0,0,0,43,14,43,20,0,0,0,0,0,0,43,26,43,32,0,0,0,0,0,0,43,182,45,6,0,0,0,0,0,0,43,38,51,210,0,0,0,0,0,0,43,182,45,6,0,0,0,0,0,0,43,62,43,44,0,0,0,0,0,0,43,50,43,56,0,0,0,0,0,0,43,62,43,68,0,0,0,0,0,0,43,74,43,80,0,0,0,0,0,0,43,86,44,70,0,0,0,0,0,0,43,92,44,82,0,0,0,0,0,0,43,98,43,104,0,0,0,0,0,0,43,110,43,116,0,0,0,0,0,0,43,122,43,128,0,0,0,0,0,0,30,246,43,134,0,0,0,0,0,0,49,26,43,140,0,0,0,0,0,0,43,146,43,152,0,0,0,0,0,0,43,158,43,164,0,0,0,0,0,0,43,170,43,176,0,0,0,0,0,0,43,182,43,188,0,0,0,0,0,0,43,194,43,200,0,0,0,0,0,0,43,206,43,212,0,0,0,0,0,0,43,218,43,224,0,0,0,0,0,0,43,230,49,8,0,0,0,0,0,0,43,236,46,194,0,0,0,0,0,0,43,242,49,8,0,0,0,0,0,0,43,248,46,194,0,0,0,0,0,0,43,254,44,4,0,0,0,0,0,0,44,10,44,16,0,0,0,0,0,0,44,22,49,20,0,0,0,0,0,0,44,28,47,28,0,0,0,0,0,0,44,34,44,52,0,0,0,0,0,0,44,40,48,168,0,0,0,0,0,0,44,46,44,52,0,0,0,0,0,0,44,58,48,168,0,0,0,0,0,0,44,64,44,70,0,0,0,0,0,0,44,76,44,82,0,0,0,0,0,0,44,88,44,112,0,0,0,0,0,0,44,94,44,100,0,0,0,0,0,0,44,106,44,112,0,0,0,0,0,0,44,118,44,124,0,0,0,0,0,0,44,130,44,148,0,0,0,0,0,0,44,136,44,160,0,0,0,0,0,0,44,142,44,148,0,0,0,0,0,0,44,154,44,160,0,0,0,0,0,0,44,166,47,106,0,0,0,0,0,0,44,184,49,20,0,0,0,0,0,0,49,56,44,178,0,0,0,0,0,0,48,132,44,190,0,0,0,0,0,0,44,172,44,178,0,0,0,0,0,0,44,184,44,190,0,0,0,0,0,0,44,196,44,202,0,0,0,0,0,0,44,208,50,196,0,0,0,0,0,0,44,214,44,244,0,0,0,0,0,0,44,220,48,102,0,0,0,0,0,0,44,226,44,244,0,0,0,0,0,0,44,232,48,102,0,0,0,0,0,0,44,238,44,244,0,0,0,0,0,0,44,250,48,102,0,0,0,0,0,0,45,0,45,6,0,0,0,0,0,0,45,12,45,18,0,0,0,0,0,0,45,24,45,30,0,0,0,0,0,0,45,78,45,36,0,0,0,0,0,0,45,42,45,48,0,0,0,0,0,0,45,54,45,60,0,0,0,0,0,0,45,66,45,72,0,0,0,0,0,0,45,78,45,84,0,0,0,0,0,0,45,90,45,96,0,0,0,0,0,0,45,102,45,108,0,0,0,0,0,0,45,114,45,120,0,0,0,0,0,0,45,126,50,28,0,0,0,0,0,0,45,132,48,204,0,0,0,0,0,0,45,138,45,144,0,0,0,0,0,0,45,150,45,162,0,0,0,0,0,0,45,156,45,162,0,0,0,0,0,0,45,168,45,174,0,0,0,0,0,0,45,180,45,186,0,0,0,0,0,0,45,192,45,198,0,0,0,0,0,0,45,204,45,210,0,0,0,0,0,0,45,216,45,222,0,0,0,0,0,0,45,228,45,234,0,0,0,0,0,0,45,240,45,246,0,0,0,0,0,0,45,252,46,2,0,0,0,0,0,0,46,8,46,14,0,0,0,0,0,0,46,20,46,26,0,0,0,0,0,0,46,32,46,38,0,0,0,0,0,0,46,44,46,50,0,0,0,0,0,0,46,56,50,4,0,0,0,0,0,0,46,62,46,68,0,0,0,0,0,0,46,74,46,80,0,0,0,0,0,0,46,86,46,92,0,0,0,0,0,0,49,2,46,206,0,0,0,0,0,0,49,146,46,218,0,0,0,0,0,0,46,98,49,8,0,0,0,0,0,0,46,104,46,194,0,0,0,0,0,0,46,110,49,8,0,0,0,0,0,0,46,116,46,194,0,0,0,0,0,0,46,110,49,8,0,0,0,0,0,0,46,116,46,194,0,0,0,0,0,0,46,122,49,8,0,0,0,0,0,0,46,128,46,194,0,0,0,0,0,0,46,134,49,8,0,0,0,0,0,0,46,140,46,194,0,0,0,0,0,0,46,146,46,206,0,0,0,0,0,0,46,152,46,218,0,0,0,0,0,0,46,158,49,8,0,0,0,0,0,0,46,164,46,194,0,0,0,0,0,0,46,158,49,8,0,0,0,0,0,0,46,164,46,194,0,0,0,0,0,0,46,170,49,8,0,0,0,0,0,0,46,176,46,194,0,0,0,0,0,0,46,182,49,8,0,0,0,0,0,0,46,188,46,194,0,0,0,0,0,0,46,200,46,206,0,0,0,0,0,0,46,212,46,218,0,0,0,0,0,0,49,14,47,136,0,0,0,0,0,0,49,158,47,46,0,0,0,0,0,0,46,224,49,20,0,0,0,0,0,0,46,230,47,28,0,0,0,0,0,0,46,236,49,20,0,0,0,0,0,0,46,242,47,28,0,0,0,0,0,0,46,248,49,20,0,0,0,0,0,0,46,254,47,28,0,0,0,0,0,0,46,248,49,20,0,0,0,0,0,0,46,254,47,28,0,0,0,0,0,0,47,4,49,20,0,0,0,0,0,0,47,10,47,28,0,0,0,0,0,0,47,16,49,20,0,0,0,0,0,0,47,22,47,28,0,0,0,0,0,0,47,34,47,136,0,0,0,0,0,0,47,40,47,46,0,0,0,0,0,0,47,52,52,80,0,0,0,0,0,0,49,170,47,58,0,0,0,0,0,0,49,56,47,124,0,0,0,0,0,0,48,132,47,136,0,0,0,0,0,0,47,64,47,106,0,0,0,0,0,0,47,70,49,20,0,0,0,0,0,0,47,76,47,106,0,0,0,0,0,0,47,82,49,20,0,0,0,0,0,0,47,76,47,106,0,0,0,0,0,0,47,82,49,20,0,0,0,0,0,0,47,88,47,106,0,0,0,0,0,0,47,94,49,20,0,0,0,0,0,0,47,100,47,106,0,0,0,0,0,0,47,112,49,20,0,0,0,0,0,0,47,118,47,124,0,0,0,0,0,0,47,130,47,136,0,0,0,0,0,0,47,142,47,172,0,0,0,0,0,0,47,148,48,204,0,0,0,0,0,0,47,142,47,172,0,0,0,0,0,0,47,148,48,204,0,0,0,0,0,0,47,154,47,172,0,0,0,0,0,0,47,160,48,204,0,0,0,0,0,0,47,166,47,172,0,0,0,0,0,0,47,178,48,204,0,0,0,0,0,0,47,184,47,190,0,0,0,0,0,0,47,196,47,202,0,0,0,0,0,0,49,26,47,208,0,0,0,0,0,0,49,182,47,214,0,0,0,0,0,0,47,220,49,32,0,0,0,0,0,0,47,226,47,232,0,0,0,0,0,0,47,238,48,12,0,0,0,0,0,0,47,244,48,24,0,0,0,0,0,0,47,238,48,12,0,0,0,0,0,0,47,244,48,24,0,0,0,0,0,0,47,250,48,12,0,0,0,0,0,0,48,0,48,24,0,0,0,0,0,0,48,6,48,12,0,0,0,0,0,0,48,18,48,24,0,0,0,0,0,0,48,30,48,36,0,0,0,0,0,0,48,42,48,48,0,0,0,0,0,0,48,54,48,60,0,0,0,0,0,0,48,66,48,102,0,0,0,0,0,0,48,72,48,90,0,0,0,0,0,0,48,78,48,102,0,0,0,0,0,0,48,84,48,90,0,0,0,0,0,0,48,96,48,102,0,0,0,0,0,0,48,108,48,114,0,0,0,0,0,0,48,120,48,126,0,0,0,0,0,0,49,56,48,144,0,0,0,0,0,0,48,132,48,156,0,0,0,0,0,0,48,138,48,144,0,0,0,0,0,0,48,150,48,156,0,0,0,0,0,0,48,162,48,168,0,0,0,0,0,0,48,174,48,180,0,0,0,0,0,0,48,186,48,192,0,0,0,0,0,0,48,186,48,192,0,0,0,0,0,0,48,186,48,192,0,0,0,0,0,0,48,186,48,192,0,0,0,0,0,0,48,198,48,204,0,0,0,0,0,0,48,198,48,204,0,0,0,0,0,0,48,198,48,204,0,0,0,0,0,0,48,198,48,204,0,0,0,0,0,0,48,210,48,216,0,0,0,0,0,0,48,222,48,228,0,0,0,0,0,0,48,234,48,240,0,0,0,0,0,0,48,246,48,252,0,0,0,0,0,0,49,2,49,8,0,0,0,0,0,0,49,14,49,20,0,0,0,0,0,0,49,26,49,32,0,0,0,0,0,0,49,242,49,248,49,38,0,0,0,0,49,44,49,50,49,56,0,0,0,0,49,62,49,248,0,0,0,0,0,0,49,62,49,248,0,0,0,0,0,0,49,68,49,248,0,0,0,0,0,0,49,140,49,248,0,0,0,0,0,0,49,74,49,248,0,0,0,0,0,0,49,80,49,248,0,0,0,0,0,0,49,86,49,248,0,0,0,0,0,0,49,242,49,92,0,0,0,0,0,0,49,242,49,92,0,0,0,0,0,0,49,98,49,248,0,0,0,0,0,0,49,104,49,110,0,0,0,0,0,0,49,116,49,248,0,0,0,0,0,0,49,242,49,122,0,0,0,0,0,0,49,128,49,134,0,0,0,0,0,0,49,242,49,248,0,0,0,0,0,0,49,140,49,248,0,0,0,0,0,0,49,242,49,248,0,0,0,0,0,0,49,140,49,248,0,0,0,0,0,0,49,242,49,248,0,0,0,0,0,0,52,62,52,80,0,0,0,0,0,0,52,62,52,50,0,0,0,0,0,0,49,206,49,224,0,0,0,0,0,0,49,146,49,152,0,0,0,0,0,0,49,158,49,164,0,0,0,0,0,0,49,170,49,176,0,0,0,0,0,0,49,182,49,188,0,0,0,0,0,0,49,194,49,224,49,200,0,0,0,0,49,206,49,224,0,0,0,0,0,0,49,212,49,224,0,0,0,0,0,0,49,218,49,224,0,0,0,0,0,0,49,230,50,172,49,236,0,0,0,0,49,242,49,248,0,0,0,0,0,0,49,254,50,4,0,0,50,10,50,16,50,22,50,28,0,0,50,34,50,58,50,40,50,46,0,0,50,52,50,58,50,64,50,70,0,0,50,76,51,222,50,130,50,136,0,0,50,82,51,222,50,88,50,94,0,0,50,100,51,222,50,106,50,112,0,0,50,118,50,124,50,130,50,136,0,0,50,142,51,222,50,148,50,154,0,0,50,160,51,222,50,166,50,172,0,0,50,178,50,184,50,190,50,196,0,0,50,202,51,114,50,208,50,214,0,0,50,220,51,156,50,226,50,232,0,0,50,238,50,244,50,250,51,0,0,0,51,6,51,12,51,18,51,24,0,0,51,30,51,222,51,36,51,42,0,0,51,48,51,114,51,54,51,60,0,0,51,66,51,72,51,78,51,84,0,0,51,90,51,156,51,96,51,102,0,0,51,108,51,114,51,120,51,126,0,0,51,132,51,198,51,138,51,144,0,0,51,150,51,156,51,162,51,168,0,0,51,174,51,198,51,180,51,186,0,0,51,192,51,198,51,204,51,210,0,0,51,216,51,222,51,228,51,234,0,0,51,240,51,246,51,252,52,2,52,8,52,14,52,20,52,26,52,32,0,0,52,38,52,44,52,62,52,80,0,0,0,0,0,0,52,62,52,50,0,0,0,0,0,0,52,62,52,56,0,0,0,0,0,0,52,62,52,68,0,0,0,0,0,0,0,1,0,3,254,59,0,1,253,162,254,161,0,1,0,2,254,20,0,1,0,0,254,62,0,2,22,228,22,234,22,210,22,246,0,2,22,218,22,206,22,212,22,188,0,2,22,208,22,214,22,220,22,226,0,3,22,228,22,174,22,234,22,240,22,246,22,222,0,3,22,214,22,160,22,220,22,226,22,232,22,238,0,1,253,173,6,145,0,1,2,130,6,47,0,1,253,25,6,31,0,1,253,235,6,31,0,1,0,0,6,31,0,1,253,138,5,214,0,1,0,1,5,102,0,1,0,2,5,225,0,1,0,0,5,226,0,1,255,254,5,201,0,1,0,8,6,136,0,1,0,112,6,33,0,1,0,3,6,32,0,1,253,159,6,33,0,1,255,247,5,182,0,1,253,187,6,56,0,1,253,191,6,56,0,1,253,202,5,178,0,1,253,209,5,217,0,1,0,0,0,0,0,1,253,160,0,0,0,1,255,254,0,0,0,1,0,2,0,0,0,1,0,7,255,191,0,1,255,247,255,188,0,1,0,1,255,189,0,1,255,249,255,193,0,1,255,249,255,188,0,1,255,253,0,27,0,1,255,255,0,23,0,1,0,7,255,185,0,1,255,255,255,134,0,1,255,242,255,207,0,1,2,89,4,72,0,1,2,80,4,72,0,1,253,169,4,72,0,1,253,25,4,72,0,1,253,235,4,72,0,1,253,138,4,72,0,1,0,1,4,72,0,1,0,2,4,72,0,1,255,254,4,72,0,1,0,4,4,72,0,1,0,112,4,72,0,1,0,0,4,72,0,1,253,159,4,72,0,1,255,243,3,51,0,1,253,184,4,72,0,1,253,187,4,72,0,1,253,199,4,72,0,1,253,206,4,72,0,1,255,255,5,105,0,1,2,83,4,72,0,1,0,96,4,213,0,1,0,6,2,74,0,1,0,6,4,74,0,1,0,90,4,213,0,1,4,48,5,182,0,1,5,2,5,182,0,1,4,225,5,182,0,1,2,224,5,182,0,1,5,165,5,182,0,1,2,232,2,219,0,1,4,73,5,182,0,1,2,98,5,182,0,1,3,248,5,182,0,1,5,168,5,182,0,1,5,189,5,182,0,1,2,244,2,219,0,1,1,31,5,182,0,1,1,31,0,0,0,1,1,185,5,182,0,1,1,253,5,182,0,1,4,189,5,182,0,1,2,251,5,182,0,1,2,23,2,219,0,1,7,9,5,182,0,1,5,222,5,182,0,1,3,30,2,219,0,1,4,167,5,182,0,1,3,30,254,164,0,1,6,17,5,182,0,1,4,199,5,182,0,1,4,58,5,182,0,1,4,63,5,182,0,1,2,51,2,219,0,1,5,172,5,182,0,1,4,156,5,182,0,1,3,177,5,182,0,1,7,58,5,182,0,1,4,118,5,182,0,1,4,80,5,182,0,1,4,107,5,182,0,1,4,19,4,72,0,1,2,170,6,20,0,1,4,35,6,20,0,1,3,172,4,72,0,1,4,111,6,20,0,1,2,115,2,36,0,1,4,85,4,72,0,1,1,252,6,31,0,1,1,51,0,0,0,1,2,254,6,31,0,1,2,16,4,72,0,1,2,32,254,20,0,1,4,75,4,73,0,1,1,4,6,20,0,1,4,76,6,20,0,1,2,116,2,36,0,1,1,220,5,226,0,1,4,38,6,20,0,1,1,155,6,20,0,1,1,2,2,36,0,1,3,201,4,72,0,1,7,8,4,72,0,1,4,150,4,72,0,1,2,106,2,36,0,1,4,169,4,72,0,1,3,225,254,22,0,1,3,131,4,72,0,1,2,166,5,70,0,1,1,110,2,36,0,1,1,252,4,72,0,1,1,252,0,0,0,1,3,214,4,72,0,1,3,26,4,72,0,1,6,10,4,72,0,1,4,7,4,72,0,1,3,218,4,72,0,1,1,223,4,72,0,1,3,114,4,72,0,1,1,94,5,205,0,1,1,92,3,21,0,1,1,131,5,205,0,1,1,119,3,13,0,1,2,133,7,143,0,1,2,133,7,75,0,1,2,133,7,10,0,1,3,217,5,182,0,1,2,249,254,20,0,1,3,3,7,75,0,1,3,30,7,75,0,1,2,236,7,142,0,1,2,236,7,65,0,1,2,105,5,182,0,1,2,126,6,31,0,1,2,126,0,0,0,1,2,57,6,33,0,1,2,57,5,221,0,1,2,57,6,136,0,1,3,128,4,72,0,1,2,66,254,20,0,1,1,2,6,33,0,1,2,103,6,29,0,1,2,106,5,221,0,1,2,116,5,210,0,1,2,115,6,20,0,1,2,133,6,208,0,1,2,57,5,97,0,1,2,133,5,188,0,1,2,144,254,62,0,1,3,12,7,143,0,1,2,75,6,33,0,1,3,12,7,80,0,1,2,75,5,226,0,1,3,12,7,142,0,1,2,75,6,32,0,1,2,224,7,142,0,1,2,189,0,0,0,1,2,232,5,182,0,1,2,232,0,0,0,1,2,117,6,20,0,1,2,117,0,0,0,1,2,113,6,208,0,1,2,69,5,97,0,1,2,113,7,85,0,1,2,69,5,231,0,1,2,113,7,80,0,1,2,69,5,226,0,1,3,62,7,142,0,1,3,62,7,85,0,1,3,62,7,80,0,1,3,55,0,0,0,1,3,62,5,182,0,1,3,55,254,59,0,1,2,244,7,142,0,1,1,4,7,237,0,1,2,118,0,0,0,1,2,244,0,0,0,1,1,45,6,20,0,1,1,2,5,221,0,1,1,2,5,97,0,1,1,2,5,231,0,1,3,8,5,226,0,1,2,47,254,20,0,1,1,21,7,142,0,1,255,245,254,165,0,1,2,26,254,59,0,1,1,26,7,143,0,1,1,2,7,238,0,1,2,98,254,59,0,1,1,2,254,59,0,1,1,26,5,182,0,1,1,2,6,20,0,1,1,2,0,0,0,1,3,3,7,143,0,1,3,3,254,59,0,1,2,116,254,59,0,1,3,3,7,142,0,1,2,116,6,32,0,1,2,245,4,72,0,1,2,245,0,0,0,1,4,125,4,72,0,1,3,30,7,85,0,1,2,106,5,231,0,1,3,179,5,182,0,1,3,203,4,72,0,1,3,203,0,0,0,1,2,120,7,143,0,1,1,224,6,33,0,1,2,120,5,182,0,1,2,153,254,59,0,1,1,224,4,72,0,1,0,253,254,59,0,1,2,120,7,142,0,1,1,224,6,32,0,1,0,253,0,0,0,1,2,69,7,143,0,1,1,233,6,33,0,1,2,17,254,20,0,1,1,233,254,20,0,1,2,69,7,142,0,1,1,233,6,32,0,1,2,51,254,59,0,1,1,177,254,59,0,1,2,51,7,142,0,1,1,49,6,20,0,1,1,177,0,0,0,1,2,236,7,75,0,1,2,116,5,221,0,1,2,236,6,208,0,1,2,116,5,97,0,1,2,236,7,85,0,1,2,116,5,231,0,1,2,236,7,246,0,1,2,116,6,136,0,1,2,236,7,143,0,1,2,116,6,33,0,1,2,231,254,62,0,1,3,177,7,142,0,1,3,26,6,32,0,1,2,61,7,142,0,1,2,1,6,32,0,1,2,82,7,143,0,1,1,223,6,33,0,1,2,82,7,80,0,1,1,223,5,226,0,1,2,82,7,142,0,1,1,223,6,32,0,1,1,237,0,0,0,1,1,179,6,31,0,1,1,74,0,0,0,1,2,240,5,203,0,1,2,74,254,20,0,1,2,136,7,172,0,1,2,57,7,168,0,1,3,122,7,143,0,1,3,115,6,33,0,1,3,30,7,143,0,1,2,106,6,33,0,1,2,17,254,59,0,1,1,233,254,59,0,1,3,20,5,182,0,1,3,8,0,0,0,1,3,151,5,182,0,1,3,146,0,0,0,1,3,115,5,182,0,1,3,117,0,0,0,1,3,114,5,182,0,1,3,114,0,0,0,1,3,102,5,182,0,1,3,102,0,0,0,1,1,2,6,180,0,1,2,150,5,182,0,1,2,150,0,0,0,1,2,82,0,0,0,1,2,82,5,182,0,1,2,170,5,182,0,1,2,106,5,182,0,1,3,3,0,0,0,1,2,53,0,0,0,1,2,69,0,0,0,1,3,32,5,182,0,1,0,41,5,182,0,1,2,61,7,65,0,1,2,120,6,113,0,1,2,26,6,113,0,1,2,147,6,113,0,1,1,2,6,113,0,1,2,115,6,180,0,1,2,120,4,72,0,1,2,103,0,0,0,1,2,148,6,31,0,1,4,110,6,31,0,1,2,11,4,72,0,1,2,11,254,20,0,1,4,0,4,72,0,1,2,102,6,22,0,1,1,237,6,20,0,1,1,237,254,113,0,1,2,147,4,72,0,1,2,94,6,33,0,1,2,94,0,0,0,1,4,27,6,33,0,1,2,36,6,33,0,1,2,36,0,0,0,1,2,122,4,72,0,1,2,122,254,20,0,1,2,43,0,0,0,1,1,230,6,20,0,1,1,230,254,113,0,1,2,155,4,72,0,1,2,155,0,0,0,1,2,105,254,20,0,1,1,238,4,72,0,1,1,238,254,113,0,1,1,230,4,72,0,1,1,230,0,0,0,1,2,223,254,20,0,1,2,46,254,20,0,1,4,50,4,72,0,1,3,21,4,72,0,1,2,115,5,210,0,1,2,106,6,113,0,1,2,115,6,113,0,1,3,21,6,113,0,1,3,24,0,0,0,1,2,113,7,65,0,1,2,109,7,143,0,1,2,143,0,0,0,1,2,69,5,182,0,1,2,17,0,0,0,1,1,21,5,182,0,1,255,245,254,127,0,1,3,189,5,182,0,1,3,189,0,0,0,1,3,213,5,182,0,1,3,213,0,0,0,1,2,240,5,182,0,1,2,121,7,121,0,1,2,235,254,130,0,1,2,115,5,182,0,1,2,115,0,0,0,1,2,144,5,182,0,1,2,109,5,182,0,1,2,21,0,0,0,1,2,190,254,130,0,1,3,96,5,182,0,1,3,25,7,121,0,1,2,162,5,182,0,1,2,208,5,182,0,1,3,154,5,182,0,1,2,235,5,182,0,1,2,235,0,0,0,1,2,130,5,182,0,1,2,105,0,0,0,1,2,249,0,0,0,1,2,51,0,0,0,1,2,146,5,182,0,1,2,78,5,182,0,1,2,244,5,182,0,1,2,244,254,130,0,1,2,178,5,182,0,1,4,33,5,182,0,1,4,33,0,0,0,1,4,38,5,182,0,1,4,38,0,0,0,1,2,191,5,182,0,1,2,191,0,0,0,1,3,108,5,182,0,1,2,137,5,182,0,1,1,243,5,182,0,1,4,49,5,182,0,1,4,49,0,0,0,1,2,136,5,182,0,1,2,98,6,30,0,1,2,98,0,0,0,1,2,76,4,72,0,1,2,76,0,0,0,1,2,78,4,72,0,1,2,78,254,133,0,1,2,237,4,72,0,1,1,219,4,72,0,1,2,154,4,72,0,1,2,149,6,11,0,1,2,74,4,72,0,1,2,74,0,0,0,1,2,239,4,72,0,1,2,239,0,0,0,1,2,123,0,0,0,1,1,2,254,22,0,1,2,66,0,0,0,1,1,226,0,0,0,1,2,221,6,20,0,1,2,221,254,20,0,1,2,22,4,72,0,1,2,121,4,72,0,1,2,121,254,133,0,1,2,96,4,72,0,1,3,144,4,72,0,1,3,144,0,0,0,1,2,192,4,72,0,1,2,192,0,0,0,1,3,11,4,72,0,1,2,92,4,72,0,1,2,92,0,0,0,1,1,177,4,72,0,1,3,81,4,72,0,1,3,81,0,0,0,1,2,56,0,0,0,1,2,69,5,210,0,1,2,116,254,20,0,1,1,186,6,33,0,1,1,250,4,72,0,1,1,233,4,72,0,1,1,6,0,0,0,1,1,2,5,210,0,1,3,90,4,72,0,1,3,90,0,0,0,1,3,142,4,72,0,1,3,142,0,0,0,1,2,116,6,20,0,1,2,116,0,0,0,1,2,18,6,33,0,1,2,1,6,11,0,1,2,125,4,72,0,1,2,125,254,135,0,1,2,28,6,227,0,1,2,28,0,0,0,1,1,187,5,137,0,1,1,187,0,0,0,1,3,177,7,143,0,1,3,26,6,33,0,1,3,177,7,65,0,1,3,26,5,210,0,1,3,22,0,0,0,1,2,61,7,143,0,1,1,2,6,32,0,1,3,154,7,143,0,1,3,143,0,0,0,1,3,201,6,33,0,1,3,188,0,0,0,1,2,144,253,211,0,1,2,57,253,211,0,1,2,105,4,72,0,1,2,100,0,0,0,1,2,243,0,0,0,1,2,113,7,143,0,1,3,10,7,143,0,1,2,69,6,33,0,1,2,139,6,33,0,1,3,170,5,182,0,1,3,170,0,0,0,1,3,33,4,72,0,1,3,33,0,0,0,1,2,180,5,182,0,1,2,180,0,0,0,1,2,138,5,39,0,1,2,138,0,0,0,1,5,29,5,182,0,1,5,29,0,0,0,1,4,13,4,72,0,1,4,13,0,0,0,1,2,175,5,182,0,1,2,178,0,0,0,1,2,58,4,72,0,1,4,135,5,182,0,1,4,135,0,0,0,1,3,199,4,72,0,1,3,199,0,0,0,1,2,229,5,182,0,1,2,229,0,0,0,1,2,137,4,72,0,1,4,221,5,182,0,1,4,221,0,0,0,1,4,35,4,72,0,1,4,35,0,0,0,1,2,85,6,210,0,1,2,85,254,79,0,1,1,239,5,79,0,1,1,239,254,123,0,1,3,48,5,182,0,1,3,48,0,0,0,1,3,5,6,18,0,1,3,5,254,20,0,1,2,10,4,72,0,1,2,131,7,143,0,1,2,9,6,33,0,1,2,9,0,0,0,1,4,211,5,182,0,1,4,211,254,19,0,1,4,86,4,72,0,1,4,86,254,19,0,1,2,143,5,182,0,1,2,143,254,20,0,1,1,245,4,72,0,1,1,245,254,20,0,1,3,14,7,95,0,1,3,14,254,130,0,1,2,155,6,11,0,1,2,155,254,135,0,1,2,96,6,20,0,1,2,96,0,0,0,1,2,112,5,182,0,1,2,112,0,0,0,1,2,115,4,72,0,1,2,115,254,22,0,1,1,186,0,0,0,1,2,152,5,182,0,1,2,152,254,0,0,1,2,31,4,72,0,1,2,31,254,10,0,1,3,139,5,182,0,1,3,139,254,130,0,1,3,28,4,72,0,1,3,28,254,135,0,1,2,85,254,62,0,1,1,239,4,72,0,1,1,239,254,62,0,1,2,166,5,182,0,1,2,166,254,130,0,1,2,46,4,72,0,1,2,46,254,134,0,1,2,18,4,72,0,1,2,18,0,0,0,1,1,30,6,20,0,1,2,26,0,0,0,1,2,190,5,182,0,1,2,190,0,0,0,1,2,113,4,72,0,1,2,136,254,135,0,1,2,242,5,182,0,1,2,242,0,0,0,1,2,136,4,72,0,1,2,136,0,0,0,1,4,72,5,182,0,1,4,72,254,0,0,1,3,118,4,72,0,1,3,118,254,10,0,1,3,28,5,182,0,1,3,28,0,0,0,1,2,139,4,72,0,1,3,12,5,182,0,1,2,249,254,62,0,1,2,75,4,72,0,1,2,66,254,62,0,1,2,51,254,130,0,1,1,226,4,72,0,1,1,226,254,135,0,1,1,255,4,72,0,1,1,255,254,20,0,1,2,121,254,130,0,1,2,45,4,72,0,1,2,45,254,134,0,1,3,111,5,182,0,1,3,111,254,130,0,1,2,223,4,72,0,1,2,223,254,135,0,1,2,203,5,182,0,1,2,203,254,130,0,1,2,119,4,72,0,1,2,119,254,133,0,1,2,104,4,72,0,1,3,221,0,0,0,1,2,255,4,72,0,1,2,255,0,0,0,1,3,221,5,182,0,1,3,221,254,128,0,1,3,0,4,72,0,1,3,0,254,135,0,1,3,93,7,121,0,1,2,241,6,11,0,1,2,194,5,182,0,1,2,194,254,0,0,1,2,56,4,72,0,1,2,56,254,10,0,1,2,218,5,182,0,1,2,218,254,130,0,1,2,83,254,135,0,1,2,236,254,0,0,1,2,123,4,72,0,1,2,123,254,12,0,1,3,0,5,182,0,1,3,0,254,130,0,1,2,159,4,72,0,1,2,159,254,135,0,1,2,198,5,182,0,1,2,198,254,130,0,1,2,111,4,72,0,1,2,111,254,133,0,1,3,163,5,182,0,1,3,163,254,130,0,1,2,248,4,72,0,1,2,248,254,135,0,1,2,133,7,121,0,1,2,57,6,11,0,1,2,133,7,65,0,1,2,57,5,210,0,1,3,122,5,182,0,1,3,122,0,0,0,1,3,115,4,72,0,1,3,115,0,0,0,1,2,113,7,121,0,1,2,69,6,11,0,1,2,200,5,182,0,1,2,63,4,72,0,1,2,240,7,65,0,1,2,240,0,0,0,1,2,63,5,210,0,1,3,93,7,65,0,1,3,93,0,0,0,1,2,241,5,210,0,1,2,241,0,0,0,1,2,85,7,65,0,1,1,239,5,210,0,1,1,239,0,0,0,1,2,85,5,182,0,1,2,85,0,0,0,1,1,247,4,72,0,1,1,247,254,20,0,1,3,10,6,208,0,1,2,139,5,97,0,1,3,10,7,65,0,1,3,10,0,0,0,1,2,139,5,210,0,1,2,139,0,0,0,1,3,30,7,65,0,1,3,30,7,36,0,1,3,30,0,0,0,1,2,106,5,210,0,1,2,106,0,0,0,1,2,134,7,36,0,1,2,134,0,0,0,1,1,250,5,210,0,1,2,121,6,208,0,1,2,1,5,97,0,1,2,121,7,65,0,1,2,1,5,210,0,1,2,121,7,143,0,1,2,121,0,0,0,1,2,1,6,33,0,1,2,198,7,65,0,1,2,198,0,0,0,1,2,111,5,210,0,1,2,111,0,0,0,1,2,27,5,182,0,1,2,27,254,130,0,1,1,186,254,135,0,1,3,101,7,65,0,1,3,101,0,0,0,1,3,19,5,210,0,1,3,19,0,0,0,1,2,26,5,182,0,1,2,26,254,113,0,1,1,186,4,72,0,1,1,186,254,113,0,1,2,121,5,182,0,1,2,121,254,113,0,1,2,43,4,72,0,1,2,43,254,113,0,1,2,79,5,182,0,1,2,79,0,0,0,1,2,25,4,72,0,1,2,114,5,182,0,1,2,55,6,20,0,1,2,86,0,0,0,1,3,148,5,182,0,1,3,148,6,20,0,1,3,148,0,0,0,1,3,153,5,182,0,1,3,153,0,0,0,1,3,51,4,72,0,1,3,51,0,0,0,1,2,127,5,182,0,1,2,127,254,130,0,1,2,27,4,72,0,1,2,27,254,135,0,1,3,232,5,182,0,1,3,232,0,0,0,1,3,105,4,72,0,1,3,105,0,0,0,1,4,11,5,182,0,1,4,11,0,0,0,1,3,165,4,72,0,1,3,165,0,0,0,1,3,5,5,182,0,1,3,5,0,0,0,1,2,140,4,72,0,1,2,140,0,0,0,1,2,214,5,182,0,1,2,214,0,0,0,1,2,153,4,72,0,1,2,153,0,0,0,1,2,87,5,182,0,1,2,26,4,72,0,1,1,235,0,0,0,1,2,212,5,182,0,1,2,212,254,113,0,1,2,81,4,72,0,1,2,81,254,113,0,1,2,133,7,227,0,1,2,57,6,145,0,1,2,133,7,209,0,1,2,57,6,127,0,1,2,133,8,73,0,1,2,57,6,247,0,1,2,133,8,98,0,1,2,57,7,16,0,1,2,133,7,142,0,1,2,57,6,32,0,1,2,133,8,19,0,1,2,57,6,194,0,1,2,133,8,88,0,1,2,57,7,6,0,1,2,133,8,92,0,1,2,57,7,10,0,1,2,57,0,0,0,1,2,133,7,85,0,1,2,144,254,161,0,1,2,57,5,231,0,1,2,57,254,161,0,1,2,113,7,227,0,1,2,69,6,145,0,1,2,113,7,75,0,1,2,69,5,221,0,1,2,113,7,209,0,1,2,69,6,127,0,1,2,113,8,73,0,1,2,69,6,247,0,1,2,113,8,98,0,1,2,69,7,16,0,1,2,97,0,0,0,1,2,113,7,142,0,1,2,69,6,32,0,1,2,97,254,161,0,1,1,2,6,145,0,1,1,6,254,161,0,1,3,30,7,227,0,1,2,106,6,145,0,1,3,30,7,209,0,1,2,106,6,127,0,1,3,30,8,73,0,1,2,106,6,247,0,1,3,30,8,98,0,1,3,32,0,0,0,1,2,106,7,16,0,1,3,30,7,142,0,1,3,32,254,161,0,1,2,106,6,32,0,1,2,101,254,161,0,1,3,31,7,143,0,1,2,114,6,33,0,1,3,31,7,227,0,1,2,114,6,145,0,1,3,31,7,75,0,1,3,31,0,0,0,1,2,114,5,221,0,1,3,31,5,182,0,1,3,31,254,161,0,1,2,114,4,72,0,1,2,114,254,161,0,1,2,231,254,161,0,1,2,88,254,161,0,1,2,236,7,227,0,1,2,116,6,145,0,1,2,88,0,0,0,1,3,23,7,143,0,1,2,167,6,33,0,1,3,23,7,227,0,1,2,167,6,145,0,1,3,23,7,75,0,1,3,23,0,0,0,1,2,167,5,221,0,1,2,167,0,0,0,1,3,23,5,182,0,1,3,23,254,161,0,1,2,167,4,72,0,1,2,167,254,161,0,1,2,61,5,182,0,1,2,61,254,161,0,1,2,1,4,72,0,1,2,61,7,227,0,1,2,1,6,145,0,1,2,61,7,75,0,1,2,61,0,0,0,1,2,1,5,221,0,1,0,183,254,19,0,1,2,51,5,182,0,1,2,51,254,20,0,1,1,49,5,70,0,1,1,177,254,20,0,1,2,106,4,72,0,1,3,30,6,208,0,1,3,32,254,62,0,1,2,106,5,97,0,1,2,101,254,62,0,1,2,48,4,72,0,1,2,63,0,0,0,1,4,89,5,182,0,1,4,92,0,0,0,1,1,2,7,141,0,1,1,164,0,0,0,1,2,115,7,141,0,1,2,114,0,0,0,1,2,223,5,182,0,1,2,223,254,123,0,1,3,3,5,182,0,1,3,3,254,127,0,1,2,213,5,182,0,1,2,213,0,0,0,1,2,209,5,182,0,1,2,209,0,0,0,1,2,133,5,182,0,1,2,144,0,0,0,1,2,113,5,182,0,1,2,101,0,0,0,1,2,236,5,182,0,1,2,231,0,0,0,1,2,129,5,182,0,1,2,53,5,182,0,1,1,98,0,0,0,1,3,30,5,182,0,1,1,86,7,143,0,1,1,86,7,142,0,1,1,86,7,75,0,1,1,86,6,208,0,1,1,86,7,85,0,1,1,86,254,62,0,1,1,86,7,80,0,1,2,104,5,182,0,1,2,104,254,127,0,1,1,86,7,227,0,1,1,86,254,161,0,1,2,72,5,182,0,1,2,72,0,0,0,1,1,86,7,65,0,1,2,57,4,72,0,1,2,57,254,62,0,1,2,69,4,72,0,1,2,97,254,62,0,1,1,2,5,226,0,1,1,6,254,62,0,1,2,116,4,72,0,1,2,88,254,62,0,1,2,95,4,72,0,1,4,115,4,72,0,1,2,95,6,32,0,1,2,95,5,231,0,1,2,95,5,226,0,1,2,97,254,20,0,1,2,146,6,31,0,1,3,148,6,31,0,1,1,86,5,182,0,1,1,86,0,0,0,1,2,87,4,74,0,1,2,87,0,0,0,1,1,226,1,68,0,1,0,20,4,74,0,1,2,25,4,74,0,1,2,25,0,0,0,1,1,127,2,154,0,1,1,162,4,74,0,1,1,162,0,0,0,1,1,0,2,155,0,1,0,28,4,74,0,1,2,4,4,74,0,1,2,4,0,0,0,1,1,95,2,155,0,1,2,131,2,155,0,1,1,3,5,18,0,1,1,3,0,0,0,1,0,4,2,155,0,1,1,20,4,74,0,1,1,20,0,0,0,1,0,13,2,156,0,1,0,32,4,74,0,1,2,131,4,74,0,1,2,131,0,0,0,1,2,131,2,37,0,1,2,132,4,74,0,1,2,132,0,0,0,1,2,148,2,155,0,1,0,246,4,74,0,1,0,246,0,0,0,1,0,10,3,137,0,1,0,22,4,74,0,1,1,250,4,74,0,1,1,250,0,0,0,1,1,93,2,156,0,1,1,241,4,74,0,1,1,241,0,0,0,1,1,100,2,156,0,1,1,240,4,74,0,1,1,240,0,0,0,1,1,67,2,155,0,1,0,27,4,74,0,1,2,128,4,74,0,1,2,128,0,0,0,1,2,128,2,37,0,1,0,25,4,74,0,1,2,119,4,74,0,1,2,119,0,0,0,1,2,119,2,155,0,1,1,0,4,74,0,1,1,0,0,0,0,1,1,0,2,37,0,1,1,190,4,74,0,1,1,190,0,0,0,1,1,92,2,156,0,1,0,21,4,74,0,1,2,102,4,74,0,1,2,102,0,0,0,1,2,103,2,155,0,1,2,93,4,74,0,1,2,93,0,0,0,1,2,93,2,37,0,1,0,26,4,74,0,1,2,113,4,74,0,1,2,113,0,0,0,1,2,67,3,90,0,1,2,95,4,74,0,1,2,95,0,0,0,1,2,96,3,77,0,1,0,19,4,74,0,1,1,233,4,74,0,1,1,233,0,0,0,1,1,233,2,37,0,1,2,55,4,74,0,1,2,55,0,0,0,1,1,9,1,247,0,1,0,23,4,74,0,1,2,104,4,74,0,1,2,104,0,0,0,1,2,78,2,154,0,1,0,24,4,74,0,1,1,254,4,74,0,1,1,254,0,0,0,1,1,85,2,155,0,1,0,18,4,74,0,1,2,208,4,74,0,1,2,208,0,0,0,1,5,64,4,212,0,1,3,37,1,193,0,1,0,213,5,93,0,1,2,137,4,74,0,1,2,137,0,0,0,1,2,169,2,152,0,1,0,29,4,74,0,1,0,43,254,20,0,1,1,10,254,62,0,1,1,2,4,72,0,1,1,10,254,161,0,1,3,179,0,0,0,1,1,10,0,0,0,1,4,238,6,31,0,1,1,47,0,0,0,1,3,182,6,31,0,1,2,62,6,31,0,1,1,44,0,0,0,1,3,178,6,31,0,1,3,178,0,0,0,1,6,103,0,0,0,1,2,4,6,31,0,1,4,181,6,31,0,1,3,187,0,0,0,1,6,100,6,31,0,1,6,100,0,0,0,1,0,0,0,10,0,122,0,42,0,5,68,70,76,84,1,50,99,121,114,108,1,62,103,114,101,107,1,54,104,101,98,114,1,58,108,97,116,110,1,78,0,39,1,92,1,100,2,76,1,108,1,108,1,116,1,124,1,132,1,140,1,148,1,148,1,156,1,164,1,172,1,180,1,188,1,188,1,196,1,196,1,204,1,212,1,236,1,220,1,228,1,236,2,86,1,244,1,244,2,96,1,252,2,4,2,12,2,20,2,28,2,36,2,44,2,52,2,60,2,68,0,32,97,97,108,116,2,164,99,99,109,112,2,172,99,99,109,112,2,230,99,99,109,112,2,188,99,99,109,112,2,198,99,99,109,112,2,218,100,110,111,109,2,26,102,114,97,99,2,208,108,105,103,97,2,32,108,110,117,109,2,38,108,111,99,108,2,44,108,111,99,108,2,50,108,111,99,108,2,56,108,111,99,108,2,62,108,111,99,108,2,68,108,111,99,108,2,74,108,111,99,108,2,80,108,111,99,108,2,86,108,111,99,108,2,92,110,117,109,114,2,98,111,110,117,109,2,104,111,114,100,110,2,110,112,110,117,109,2,116,115,97,108,116,2,180,115,115,48,49,2,180,115,115,48,50,2,122,115,115,48,51,2,128,115,115,48,52,2,134,115,117,98,115,2,140,115,117,112,115,2,146,116,110,117,109,2,152,122,101,114,111,2,158,2,140,0,0,2,48,0,0,2,88,0,0,2,128,0,2,77,75,68,32,2,172,83,82,66,32,2,218,4,100,0,7,65,80,80,72,4,144,67,65,84,32,4,190,73,80,80,72,4,236,77,65,72,32,5,26,77,79,76,32,5,72,78,65,86,32,5,118,82,79,77,32,5,164,0,1,0,0,0,1,7,32,0,3,0,0,0,1,6,178,0,1,0,0,0,1,3,94,0,4,0,0,0,1,4,4,0,4,0,0,0,1,2,242,0,4,0,0,0,1,3,220,0,1,0,0,0,1,3,170,0,1,0,0,0,1,2,238,0,1,0,0,0,1,2,244,0,6,0,0,0,1,2,212,0,4,0,0,0,1,2,170,0,4,0,0,0,1,2,170,0,1,0,0,0,1,2,226,0,1,0,0,0,1,2,98,0,1,0,0,0,1,5,226,0,1,0,0,0,1,5,44,0,1,0,0,0,1,2,80,0,1,0,0,0,1,2,78,0,1,0,0,0,1,2,76,0,1,0,0,0,1,2,74,0,1,0,0,0,1,2,176,0,1,0,0,0,1,2,64,0,1,0,0,0,1,5,24,0,1,0,0,0,1,5,62,0,1,0,0,0,1,5,100,0,4,0,0,0,1,2,66,0,1,0,0,0,1,2,30,0,1,0,0,0,1,2,134,0,1,0,0,0,1,5,164,0,1,0,0,0,1,2,12,0,6,0,0,0,2,2,144,3,0,0,6,0,0,0,2,2,152,2,170,0,6,0,0,0,2,2,178,2,196,0,0,0,1,0,22,0,0,0,1,0,34,0,0,0,1,0,30,0,0,0,1,0,16,0,0,0,1,0,12,0,0,0,1,0,15,0,0,0,1,0,11,0,0,0,1,0,18,0,0,0,1,0,9,0,0,0,1,0,8,0,0,0,1,0,10,0,0,0,1,0,17,0,0,0,1,0,21,0,0,0,1,0,33,0,0,0,1,0,28,0,0,0,1,0,31,0,0,0,1,0,36,0,0,0,1,0,37,0,0,0,1,0,38,0,0,0,1,0,19,0,0,0,1,0,20,0,0,0,1,0,32,0,0,0,1,0,35,0,0,0,2,0,0,0,1,0,0,0,2,0,2,0,5,0,0,0,2,0,36,0,37,0,0,0,3,0,2,0,5,0,6,0,0,0,3,0,2,0,5,0,7,0,0,0,3,0,23,0,24,0,25,0,0,0,4,0,2,0,5,0,2,0,5,0,0,0,6,0,2,0,5,0,2,0,5,0,2,0,5,0,0,255,255,0,19,0,0,0,3,0,6,0,7,0,8,0,9,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,19,0,0,0,4,0,6,0,7,0,8,0,9,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,19,0,0,0,1,0,6,0,7,0,8,0,9,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,1,0,6,0,7,0,8,0,9,0,14,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,1,0,6,0,7,0,8,0,9,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,1,4,240,1,245,0,1,5,38,4,19,0,1,4,234,2,4,0,1,5,26,4,39,0,1,5,10,255,236,0,1,4,250,255,236,0,1,4,216,4,59,0,1,4,216,2,125,0,1,9,36,0,1,4,216,0,1,9,40,0,1,4,212,0,1,9,72,0,1,4,254,0,1,9,182,0,2,5,2,5,12,0,1,4,228,0,2,4,190,4,194,0,2,5,2,0,4,1,72,1,73,1,35,1,36,0,2,5,0,0,4,3,146,3,180,3,147,3,181,0,2,4,254,0,4,3,145,3,144,3,177,3,178,0,2,4,252,0,4,0,108,0,124,0,108,0,124,0,2,5,52,0,5,3,186,3,187,3,188,3,189,3,179,0,2,5,104,0,6,3,175,3,176,4,114,4,111,4,112,4,115,0,3,0,0,0,1,5,86,0,1,5,114,0,1,0,0,0,3,0,3,0,1,4,198,0,1,4,90,0,0,0,1,0,0,0,26,0,3,0,1,4,252,0,1,4,72,0,0,0,1,0,0,0,27,0,3,0,1,4,64,0,1,4,168,0,0,0,1,0,0,0,29,0,3,0,1,4,46,0,1,4,158,0,0,0,1,0,0,0,29,0,2,5,40,0,8,3,148,3,182,3,149,3,183,3,150,3,184,3,151,3,185,0,3,0,0,0,1,4,230,0,2,4,246,5,2,0,1,0,0,0,4,0,1,9,2,0,9,4,106,4,110,4,114,4,118,4,122,4,126,4,130,4,134,4,138,0,1,9,76,0,10,4,142,4,146,4,150,4,174,4,154,4,158,4,162,4,166,4,180,4,170,0,0,255,255,0,19,0,0,0,5,0,6,0,7,0,8,0,9,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,1,0,6,0,7,0,8,0,9,0,10,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,2,0,6,0,7,0,8,0,9,0,11,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,1,0,6,0,7,0,8,0,9,0,12,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,2,0,6,0,7,0,8,0,9,0,13,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,2,0,6,0,7,0,8,0,9,0,15,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,2,0,6,0,7,0,8,0,9,0,16,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,2,0,6,0,7,0,8,0,9,0,17,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,2,3,162,0,15,4,100,4,102,4,104,3,119,0,123,0,116,0,117,2,55,2,56,3,120,2,57,2,58,3,121,4,105,2,23,0,2,3,78,0,20,4,48,4,49,4,50,4,51,4,52,4,53,4,54,4,55,4,56,4,57,4,68,4,69,4,70,4,71,4,72,4,73,4,74,4,75,4,76,4,77,0,2,3,48,0,20,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,4,79,4,80,4,81,4,82,4,83,4,84,4,85,4,86,4,87,4,88,0,2,3,18,0,20,4,79,4,80,4,81,4,82,4,83,4,84,4,85,4,86,4,87,4,88,4,68,4,69,4,70,4,71,4,72,4,73,4,74,4,75,4,76,4,77,0,2,3,22,0,22,4,101,4,103,4,106,4,89,4,90,4,91,4,92,4,93,4,94,4,95,4,96,4,97,4,98,4,107,3,193,3,194,3,195,3,196,3,197,3,198,3,199,3,200,0,2,3,20,0,24,3,152,3,153,3,154,3,155,3,156,3,157,3,158,3,159,3,160,3,161,3,163,3,164,3,165,3,168,3,169,3,170,3,171,3,172,3,173,3,174,3,192,3,166,3,167,3,162,0,1,4,134,0,48,3,18,3,24,3,30,4,118,3,248,4,6,4,20,4,34,4,48,4,62,4,76,4,90,4,104,3,36,3,42,3,48,3,54,3,240,3,60,3,66,3,72,3,78,3,84,3,90,3,96,3,102,3,108,3,114,3,120,3,126,3,132,3,138,3,144,3,150,3,156,3,162,3,168,3,174,3,180,3,186,3,192,3,198,3,204,3,210,3,216,3,222,3,228,3,234,0,2,4,96,0,74,2,22,0,108,3,152,3,153,0,124,0,108,3,186,3,193,3,175,3,176,3,194,3,195,3,196,0,124,3,198,3,199,3,200,3,154,3,155,3,156,3,157,3,148,3,182,3,149,3,183,3,187,3,188,3,189,3,179,3,158,3,159,3,160,3,163,3,164,3,165,3,146,3,180,3,147,3,181,1,72,1,73,3,151,3,185,3,168,3,145,3,169,3,144,3,170,3,177,3,178,3,171,3,172,3,173,3,191,4,111,4,112,3,174,3,192,3,166,3,167,4,115,1,35,1,36,3,162,4,38,4,39,4,40,4,41,4,42,4,43,4,44,4,45,4,46,4,47,0,1,0,1,1,202,0,1,0,1,0,18,0,1,0,1,0,19,0,1,0,1,1,65,0,1,4,70,0,1,4,78,0,1,4,126,0,1,4,138,0,2,0,1,4,68,4,77,0,0,0,2,0,1,4,58,4,67,0,0,0,2,0,1,0,19,0,28,0,0,0,1,0,2,0,47,0,79,0,5,4,58,4,66,4,40,4,46,4,52,0,4,4,100,4,110,4,120,4,130,0,4,4,130,4,140,4,150,4,160,0,1,0,4,1,31,1,32,3,109,3,110,0,1,0,4,0,252,0,253,1,6,1,7,0,1,0,4,1,95,1,115,1,126,1,147,0,1,0,4,0,36,0,50,0,68,0,82,0,1,0,1,2,22,0,1,0,2,0,36,0,68,0,1,0,2,0,50,0,82,0,1,4,98,0,1,4,100,0,1,4,102,0,1,4,104,0,1,4,106,0,1,4,108,0,1,4,110,0,1,4,112,0,1,4,114,0,1,0,5,0,74,0,223,0,225,0,227,0,229,0,2,0,1,4,38,4,47,0,0,0,1,4,114,0,1,4,116,0,1,4,118,0,1,4,120,0,1,4,122,0,1,4,124,0,1,4,126,0,1,4,128,0,2,4,142,4,130,0,2,4,144,4,130,0,1,0,6,0,76,0,77,0,241,1,238,1,240,3,53,0,1,0,4,2,53,4,14,4,15,4,16,0,2,0,2,3,116,3,116,0,0,4,1,4,13,0,1,0,1,0,8,0,198,0,199,0,218,0,219,0,240,0,241,1,51,1,52,0,2,0,2,0,19,0,28,0,0,4,79,4,88,0,10,0,2,0,2,4,48,4,57,0,0,4,68,4,77,0,10,0,2,0,2,0,19,0,28,0,0,4,48,4,57,0,10,0,1,0,15,0,11,0,12,0,14,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,32,0,81,0,1,0,22,0,11,0,12,0,14,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,32,0,75,0,78,0,79,0,80,0,81,0,83,0,86,0,87,0,1,0,24,0,44,0,45,0,142,0,143,0,144,0,145,0,234,0,236,0,238,0,240,0,242,0,243,0,245,1,89,1,102,1,118,1,160,1,161,1,162,2,182,2,197,3,50,3,52,3,150,0,2,4,100,4,101,0,2,4,102,4,103,0,2,4,104,4,106,0,2,4,105,4,107,0,2,2,23,3,197,0,2,3,150,3,161,0,2,3,184,4,114,0,2,0,19,4,68,0,2,0,20,4,69,0,2,0,21,4,70,0,2,0,22,4,71,0,2,0,23,4,72,0,2,0,24,4,73,0,2,0,25,4,74,0,2,0,26,4,75,0,2,0,27,4,76,0,2,0,28,4,77,0,2,4,48,4,79,0,2,4,49,4,80,0,2,4,50,4,81,0,2,4,51,4,82,0,2,4,52,4,83,0,2,4,53,4,84,0,2,4,54,4,85,0,2,4,55,4,86,0,2,4,56,4,87,0,2,4,57,4,88,0,2,4,48,4,68,0,2,4,49,4,69,0,2,4,50,4,70,0,2,4,51,4,71,0,2,4,52,4,72,0,2,4,53,4,73,0,2,4,54,4,74,0,2,4,55,4,75,0,2,4,56,4,76,0,2,4,57,4,77,0,3,3,130,3,131,3,132,0,6,0,123,4,39,4,49,4,59,4,80,4,90,0,6,0,116,4,40,4,50,4,60,4,81,4,91,0,6,0,117,4,41,4,51,4,61,4,82,4,92,0,6,2,55,4,42,4,52,4,62,4,83,4,93,0,6,2,56,4,43,4,53,4,63,4,84,4,94,0,6,3,120,4,44,4,54,4,64,4,85,4,95,0,6,2,57,4,45,4,55,4,65,4,86,4,96,0,6,2,58,4,46,4,56,4,66,4,87,4,97,0,6,3,121,4,47,4,57,4,67,4,88,4,98,0,7,3,119,4,38,4,48,4,58,4,78,4,79,4,89,0,2,0,10,0,11,0,12,0,0,0,14,0,14,0,2,0,19,0,28,0,3,0,32,0,32,0,13,0,81,0,81,0,14,0,240,0,241,0,15,1,11,1,11,0,17,4,48,4,57,0,18,4,68,4,77,0,28,4,79,4,88,0,38,0,1,0,74,0,18,0,36,0,44,0,45,0,50,0,68,0,74,0,75,0,76,0,77,0,78,0,79,0,80,0,82,0,83,0,86,0,87,0,142,0,143,0,144,0,145,0,198,0,199,0,218,0,219,0,223,0,225,0,227,0,229,0,234,0,236,0,238,0,242,0,243,0,245,0,252,0,253,1,6,1,7,1,31,1,32,1,51,1,52,1,89,1,95,1,102,1,115,1,118,1,126,1,147,1,160,1,161,1,162,1,202,1,238,1,240,2,182,2,197,3,50,3,52,3,53,3,109,3,110,3,150,4,58,4,59,4,60,4,61,4,62,4,63,4,64,4,65,4,66,4,67,1,1,0,2,0,121,0,1,0,1,0,79,1,0,0,2,0,121,0,1,0,1,0,47,3,138,0,2,0,73,3,139,0,2,0,76,3,140,0,2,0,79,3,141,0,3,0,73,0,76,3,142,0,3,0,73,0,79,0,1,0,1,0,73,0,0,0,2,0,121,0,1,0,47,0,1,0,0,0,14,0,0,0,2,0,121,0,1,0,79,0,1,0,0,0,13,3,125,0,4,4,8,4,6,4,2,3,124,0,4,4,8,4,6,4,1,3,123,0,4,4,8,4,5,4,2,3,122,0,4,4,8,4,5,4,1,3,129,0,4,4,8,4,6,4,2,3,128,0,4,4,8,4,6,4,1,3,127,0,4,4,8,4,5,4,2,3,126,0,4,4,8,4,5,4,1,0,1,0,2,1,133,1,145,3,234,0,2,4,33,3,238,0,2,4,33,3,248,0,2,4,33,3,249,0,2,4,33,3,250,0,2,4,33,3,252,0,2,4,33,3,253,0,2,4,33,3,254,0,2,4,33,3,255,0,2,4,33,0,1,0,9,3,201,3,205,3,218,3,220,3,221,3,224,3,225,3,226,3,227,0,198,0,2,4,16,0,218,0,2,4,16,0,240,0,2,4,16,1,51,0,2,4,16,0,199,0,2,4,16,0,219,0,2,4,16,0,241,0,2,4,16,1,52,0,2,4,16,3,111,0,2,4,16,3,112,0,2,4,16,3,113,0,3,4,16,1,76,3,114,0,3,4,16,1,76,0,1,0,10,0,36,0,40,0,44,0,50,0,56,0,68,0,72,0,76,0,82,0,88,0,0,0,1,0,1,0,8,0,3,0,0,0,20,0,3,0,0,0,44,0,2,119,100,116,104,1,1,0,0,119,103,104,116,1,0,0,1,105,116,97,108,1,28,0,2,0,6,0,18,0,34,0,1,0,0,0,2,1,26,0,100,0,0,0,3,0,1,0,2,1,4,1,144,0,0,2,188,0,0,0,3,0,2,0,2,1,29,0,0,0,0,0,1,0,0,0,0};
+    inline const uint8_t DEFAULT_FONT_DATA[] = {0,1,0,0,0,18,1,0,0,4,0,32,71,68,69,70,180,200,177,96,0,1,176,104,0,0,1,190,71,80,79,83,91,170,114,112,0,1,178,40,0,0,57,116,71,83,85,66,131,237,153,151,0,1,235,156,0,0,15,6,79,83,47,50,150,64,131,44,0,1,107,156,0,0,0,96,83,84,65,84,94,251,67,53,0,1,250,164,0,0,0,94,99,109,97,112,195,56,31,128,0,1,107,252,0,0,3,246,99,118,116,32,61,63,44,200,0,1,130,40,0,0,0,252,102,112,103,109,226,25,158,90,0,1,111,244,0,0,15,148,103,97,115,112,0,21,0,35,0,1,176,88,0,0,0,16,103,108,121,102,183,58,171,163,0,0,1,44,0,1,79,56,104,101,97,100,27,157,52,186,0,1,89,112,0,0,0,54,104,104,101,97,13,200,8,246,0,1,107,120,0,0,0,36,104,109,116,120,83,236,67,87,0,1,89,168,0,0,17,206,108,111,99,97,146,78,64,130,0,1,80,132,0,0,8,234,109,97,120,112,7,251,16,165,0,1,80,100,0,0,0,32,110,97,109,101,169,157,204,70,0,1,131,36,0,0,5,198,112,111,115,116,38,172,156,156,0,1,136,236,0,0,39,106,112,114,101,112,133,253,123,233,0,1,127,136,0,0,2,159,0,2,0,150,255,228,1,132,5,182,0,3,0,15,0,22,64,10,1,1,7,7,13,11,114,2,2,114,0,43,43,50,17,51,124,47,48,49,65,35,3,51,3,52,54,51,50,22,21,20,6,35,34,38,1,69,109,46,201,221,68,51,50,69,69,50,51,68,1,150,4,32,250,178,70,59,59,70,69,63,63,0,0,2,0,135,3,166,2,169,5,182,0,3,0,7,0,16,182,5,1,128,4,3,2,114,0,43,50,26,205,50,48,49,65,3,35,3,33,3,35,3,1,59,38,105,37,2,34,37,105,37,5,182,253,240,2,16,253,240,2,16,0,2,0,52,0,0,4,246,5,182,0,27,0,31,0,57,64,27,1,28,28,14,0,31,31,25,21,21,18,18,15,4,8,8,11,11,14,14,10,23,19,2,6,10,8,0,63,51,63,51,18,57,47,51,17,51,17,51,206,50,17,51,17,51,50,17,51,17,51,17,51,48,49,65,3,33,21,33,3,35,19,33,3,35,19,33,53,33,19,33,53,33,19,51,3,33,19,51,3,33,21,1,33,19,33,3,212,65,1,27,254,204,85,135,85,254,207,82,133,79,254,250,1,31,67,254,234,1,45,83,137,83,1,51,83,132,83,1,9,252,228,1,49,66,254,207,3,131,254,172,127,254,80,1,176,254,80,1,176,127,1,84,125,1,182,254,74,1,182,254,74,125,254,172,1,84,0,3,0,127,255,137,4,23,6,18,0,36,0,44,0,53,0,40,64,20,27,46,46,40,44,9,28,45,13,6,1,20,18,17,37,8,8,35,0,1,0,47,205,51,51,17,51,47,205,51,18,23,57,51,17,51,48,49,69,53,38,38,39,53,22,22,23,17,46,2,53,52,54,54,55,53,51,21,22,22,23,7,38,38,39,17,30,2,21,20,6,7,21,17,54,54,53,52,38,38,39,39,17,14,2,21,20,22,22,2,6,115,209,66,69,216,105,132,173,86,97,176,118,122,107,176,75,52,68,158,80,134,181,92,214,193,123,121,47,106,91,122,75,102,51,45,101,119,210,2,36,29,162,32,48,2,1,184,37,95,138,98,102,145,82,6,173,171,3,41,32,139,27,38,7,254,75,39,88,130,103,146,179,19,218,1,110,12,95,78,56,72,53,24,208,1,135,5,46,74,51,59,79,55,0,5,0,102,255,236,6,55,5,203,0,11,0,23,0,27,0,39,0,51,0,34,64,17,40,28,46,34,13,114,26,12,18,6,0,27,27,12,0,5,114,0,43,50,50,47,16,204,50,63,43,50,204,50,48,49,65,50,22,21,20,6,35,34,38,53,52,54,23,34,6,21,20,22,51,50,54,53,52,38,37,1,35,1,19,50,22,21,20,6,35,34,38,53,52,54,23,34,6,21,20,22,51,50,54,53,52,38,1,143,150,155,150,155,144,153,146,151,81,76,76,81,84,82,81,3,73,252,213,146,3,43,107,149,156,150,155,145,152,145,152,81,76,76,81,84,82,81,5,203,239,218,218,243,243,218,218,239,119,169,169,169,172,172,169,168,170,98,250,74,5,182,253,203,239,218,217,243,243,217,218,239,120,168,169,169,171,169,171,168,169,0,0,3,0,111,255,236,5,201,5,205,0,37,0,48,0,60,0,43,64,25,7,30,55,3,0,18,48,15,8,38,5,11,11,0,45,22,11,114,16,10,114,49,0,3,114,0,43,50,43,43,50,17,57,47,23,57,18,23,57,48,49,65,50,22,22,21,20,6,7,1,54,54,55,51,6,6,7,1,35,39,14,2,35,34,38,38,53,52,54,54,55,46,2,53,52,54,54,19,14,2,21,20,22,51,50,54,55,1,34,6,21,20,22,23,54,54,53,52,38,2,111,108,157,85,169,130,1,150,55,70,24,168,32,101,76,1,37,225,181,64,147,179,115,140,206,113,78,144,100,47,84,52,91,167,25,78,111,59,158,132,136,191,67,254,160,91,113,82,76,125,113,105,5,205,75,140,99,130,180,74,254,118,64,169,99,132,222,84,254,225,177,59,89,49,92,178,129,106,152,118,56,52,107,123,74,100,142,76,252,245,45,88,110,78,117,141,90,64,4,43,95,85,76,128,78,69,129,87,79,98,0,1,0,135,3,166,1,59,5,182,0,3,0,10,179,1,3,2,114,0,43,205,48,49,65,3,35,3,1,59,38,105,37,5,182,253,240,2,16,0,0,1,0,82,254,188,2,30,5,182,0,16,0,10,179,13,4,2,114,0,43,47,48,49,83,52,18,18,55,51,6,2,21,20,18,18,23,35,38,2,2,82,65,134,102,159,145,146,65,129,95,157,102,134,65,2,49,169,1,64,1,34,122,190,254,48,245,160,254,201,254,224,128,120,1,27,1,60,0,1,0,62,254,188,2,10,5,182,0,17,0,10,179,13,2,114,5,0,47,43,48,49,65,20,2,2,7,35,54,18,18,53,52,2,2,39,51,22,18,18,2,10,65,133,103,157,96,129,65,66,129,97,159,103,133,65,2,51,167,254,195,254,228,119,127,1,34,1,55,160,163,1,60,1,36,127,123,254,223,254,193,0,0,1,0,89,2,134,4,10,6,20,0,14,0,27,64,16,5,9,7,4,10,11,3,13,1,2,12,11,6,8,128,0,0,47,26,205,50,23,57,48,49,65,3,37,23,5,19,7,3,3,39,19,37,55,5,3,2,139,38,1,139,26,254,134,244,162,181,166,168,242,254,136,28,1,133,39,6,20,254,115,115,175,39,254,187,89,1,100,254,156,89,1,69,39,175,115,1,141,0,1,0,103,0,230,4,40,4,192,0,11,0,14,180,10,9,9,5,6,0,47,51,51,17,51,48,49,65,33,21,33,17,35,17,33,53,33,17,51,2,140,1,156,254,100,137,254,100,1,156,137,3,22,136,254,88,1,168,136,1,170,0,1,0,83,254,248,1,122,0,238,0,10,0,12,179,5,128,1,0,0,47,50,26,205,48,49,101,23,14,2,7,35,62,2,55,1,109,13,18,55,65,33,124,21,40,33,10,238,23,73,166,167,73,80,177,173,72,0,0,1,0,82,1,220,2,66,2,112,0,3,0,8,177,1,0,0,47,50,48,49,83,53,33,21,82,1,240,1,220,148,148,0,0,1,0,150,255,228,1,132,0,233,0,11,0,10,179,3,9,11,114,0,43,50,48,49,119,52,54,51,50,22,21,20,6,35,34,38,150,68,49,51,70,70,51,49,68,104,70,59,59,70,69,63,63,0,0,1,0,21,0,0,2,217,5,182,0,3,0,11,180,3,2,114,1,8,0,63,43,48,49,65,1,35,1,2,217,253,224,164,2,33,5,182,250,74,5,182,0,2,0,103,255,236,4,43,5,205,0,16,0,32,0,16,183,29,13,5,114,21,5,13,114,0,43,50,43,50,48,49,65,20,2,6,6,35,34,38,2,53,52,18,54,51,50,22,18,5,20,18,22,51,50,54,18,53,52,2,38,35,34,6,2,4,43,54,116,184,129,163,213,105,95,212,174,165,214,104,252,227,62,139,113,113,139,63,62,138,115,115,138,61,2,221,178,254,232,194,101,178,1,81,238,234,1,81,181,179,254,175,236,204,254,240,135,134,1,16,205,201,1,15,137,137,254,241,0,1,0,185,0,0,2,207,5,182,0,13,0,21,64,10,11,10,10,6,12,4,114,0,12,114,0,43,43,50,50,47,51,48,49,97,35,17,52,54,54,55,6,6,7,7,39,1,51,2,207,162,1,3,3,31,54,40,167,87,1,140,138,4,12,59,85,71,37,32,45,33,134,113,1,49,0,1,0,101,0,0,4,35,5,203,0,29,0,23,64,11,10,18,5,114,27,2,28,28,1,12,114,0,43,50,17,51,51,43,50,48,49,97,33,53,1,62,2,53,52,38,35,34,6,7,39,62,2,51,50,22,22,21,20,6,6,7,1,21,33,4,35,252,66,1,135,109,149,78,147,120,105,162,85,89,58,137,157,89,135,196,107,92,166,111,254,194,2,235,139,1,141,110,172,167,100,124,131,72,66,112,49,76,44,94,174,120,116,199,195,109,254,195,7,0,0,1,0,92,255,236,4,26,5,203,0,46,0,31,64,15,5,4,28,28,27,27,12,36,44,5,114,19,12,13,114,0,43,50,43,50,17,57,47,51,18,57,57,48,49,65,20,6,6,7,21,22,22,21,20,6,6,35,34,38,39,53,22,22,51,50,54,53,52,38,38,35,35,53,51,50,54,54,53,52,38,35,34,6,6,7,39,54,54,51,50,22,3,237,76,136,92,174,175,119,245,191,116,197,90,91,214,100,200,178,99,185,130,146,147,119,166,87,148,127,78,128,112,56,84,80,230,146,224,224,4,97,98,144,91,18,8,22,180,146,127,196,111,37,43,156,45,51,159,138,95,117,55,142,70,127,87,111,121,32,56,37,114,62,90,204,0,2,0,44,0,0,4,108,5,190,0,10,0,22,0,31,64,15,6,22,9,9,5,1,1,2,18,7,4,114,2,12,114,0,43,43,50,17,57,47,51,51,17,51,51,48,49,65,35,17,35,17,33,53,1,51,17,51,33,17,52,62,2,55,35,6,6,7,1,4,108,219,162,253,61,2,184,173,219,254,131,2,4,3,1,8,19,49,25,254,61,1,83,254,173,1,83,140,3,223,252,43,1,222,55,89,77,70,34,40,89,35,253,129,0,1,0,132,255,236,4,29,5,182,0,33,0,35,64,17,26,25,25,22,22,31,0,0,8,30,27,4,114,15,8,13,114,0,43,50,43,50,17,57,47,51,51,17,51,17,51,48,49,65,50,22,22,21,20,6,6,35,34,38,39,53,22,22,51,50,54,54,53,52,38,35,34,6,7,39,19,33,21,33,3,54,54,2,51,149,220,121,130,244,170,114,196,67,73,208,98,111,167,93,179,193,62,148,48,84,56,2,215,253,183,37,38,120,3,126,101,192,137,150,217,117,40,40,158,44,52,71,145,110,146,159,20,12,55,2,174,152,254,71,8,17,0,2,0,116,255,236,4,48,5,203,0,34,0,49,0,31,64,15,18,17,41,41,22,22,6,35,30,13,114,13,6,5,114,0,43,50,43,50,18,57,47,51,17,51,51,48,49,83,52,62,3,51,50,22,23,21,38,38,35,34,6,2,7,51,62,2,51,50,22,22,21,20,6,6,35,34,46,2,1,50,54,53,52,38,35,34,6,6,21,20,30,2,116,37,88,152,227,159,45,104,34,37,95,48,186,213,94,7,11,31,96,137,91,128,191,105,112,207,143,107,180,133,74,1,236,136,164,146,147,100,148,82,39,80,122,2,113,132,252,217,164,93,9,10,143,13,12,162,254,235,173,50,81,48,104,198,141,151,220,119,82,162,241,254,167,174,176,144,168,83,126,65,66,136,116,70,0,1,0,93,0,0,4,44,5,182,0,6,0,19,64,9,5,2,2,3,4,114,0,12,114,0,43,43,50,17,51,48,49,97,1,33,53,33,21,1,1,34,2,88,252,227,3,207,253,172,5,30,152,128,250,202,0,3,0,103,255,236,4,41,5,203,0,31,0,46,0,60,0,26,64,14,43,24,8,54,4,0,35,16,13,114,47,0,5,114,0,43,50,43,50,17,23,57,48,49,65,50,22,22,21,20,6,6,7,30,2,21,20,6,6,35,34,38,38,53,52,54,54,55,46,2,53,52,54,54,3,20,22,51,50,54,53,52,38,38,39,39,14,2,1,34,6,21,20,22,22,23,62,2,53,52,38,2,72,127,196,111,77,130,79,94,151,88,119,214,144,155,217,113,86,142,84,73,121,71,113,197,194,158,160,152,166,76,140,95,36,92,129,68,1,60,118,150,73,126,78,76,118,68,149,5,203,80,155,113,89,133,99,39,43,108,146,100,123,179,96,93,175,123,101,149,108,37,40,102,137,91,111,155,81,251,167,112,145,145,118,73,111,88,36,13,38,93,118,3,131,113,106,76,105,75,32,32,77,106,74,106,112,0,0,2,0,103,255,235,4,37,5,203,0,34,0,49,0,31,64,15,17,18,41,41,22,22,6,35,30,5,114,13,6,13,114,0,43,50,43,50,17,57,47,51,17,51,51,48,49,65,20,14,3,35,34,38,39,53,22,22,51,50,54,18,55,35,14,2,35,34,38,38,53,52,54,54,51,50,30,2,1,34,6,21,20,22,51,50,54,54,53,52,46,2,4,37,37,89,152,229,159,43,110,35,37,100,48,187,214,94,6,12,30,97,138,92,127,189,105,115,208,141,108,180,133,73,254,18,133,165,142,148,102,149,81,39,80,122,3,71,133,252,218,164,93,11,10,144,13,15,161,1,21,173,48,81,49,104,198,140,151,221,120,82,163,240,1,88,174,175,145,168,82,126,66,66,136,115,71,0,0,2,0,150,255,228,1,132,4,98,0,11,0,23,0,16,183,21,15,7,114,3,9,11,114,0,43,50,43,50,48,49,119,52,54,51,50,22,21,20,6,35,34,38,17,52,54,51,50,22,21,20,6,35,34,38,150,68,49,51,70,70,51,49,68,68,49,51,70,70,51,49,68,104,70,59,59,70,69,63,63,3,188,72,59,59,72,68,62,62,0,2,0,65,254,248,1,128,4,98,0,10,0,22,0,18,183,20,14,7,114,1,5,128,10,0,47,26,205,57,43,50,48,49,101,23,14,2,7,35,62,2,55,3,52,54,51,50,22,21,20,6,35,34,38,1,92,14,18,56,65,32,126,21,40,35,10,25,68,49,53,68,68,53,49,68,238,23,72,167,167,73,79,177,174,72,2,241,72,59,59,72,68,62,62,0,0,1,0,103,0,243,4,41,4,216,0,6,0,18,183,2,5,1,3,4,3,6,0,0,47,50,206,50,23,57,48,49,101,1,53,1,21,1,1,4,41,252,62,3,194,252,242,3,14,243,1,170,95,1,220,148,254,143,254,179,0,2,0,115,1,193,4,29,3,225,0,3,0,7,0,12,179,1,0,4,5,0,47,51,206,50,48,49,83,53,33,21,1,53,33,21,115,3,170,252,86,3,170,3,90,135,135,254,103,135,135,0,0,1,0,103,0,243,4,41,4,216,0,6,0,18,183,5,1,4,3,2,3,0,6,0,47,51,206,50,23,57,48,49,83,1,1,53,1,21,1,103,3,15,252,241,3,194,252,62,1,134,1,75,1,115,148,254,36,95,254,86,0,2,0,31,255,228,3,60,5,203,0,31,0,43,0,23,64,11,31,31,35,35,41,11,114,12,19,3,114,0,43,50,43,50,17,51,47,48,49,65,53,52,54,54,55,62,2,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,6,7,14,2,21,21,3,52,54,51,50,22,21,20,6,35,34,38,1,32,30,75,67,78,91,40,134,122,99,154,71,58,82,192,118,193,212,60,110,75,66,70,26,177,66,52,49,69,69,49,52,66,1,150,52,80,115,100,56,65,91,92,65,104,111,50,35,134,43,54,191,167,93,131,109,61,56,85,89,62,33,254,210,70,59,59,70,69,63,63,0,0,2,0,118,255,71,6,183,5,180,0,65,0,79,0,41,64,19,73,76,76,22,19,37,62,3,114,9,69,69,29,5,5,12,128,46,53,0,47,51,26,204,50,47,51,50,17,51,43,50,204,50,50,17,51,48,49,65,20,14,2,35,34,38,39,35,6,6,35,34,38,53,52,54,54,51,50,22,23,3,6,6,21,20,22,51,50,54,54,53,52,2,36,35,34,4,6,2,21,20,18,4,51,50,54,55,21,6,6,35,34,36,2,53,52,18,54,36,51,50,4,18,1,20,22,51,50,54,55,19,38,38,35,34,6,6,6,183,43,88,131,89,93,110,11,9,38,147,107,156,169,107,195,133,89,168,50,20,1,2,77,55,67,91,48,154,254,241,176,175,254,241,187,96,145,1,25,202,122,226,89,88,218,131,241,254,170,182,119,225,1,65,201,215,1,75,189,251,238,106,94,116,109,8,12,29,83,45,103,127,58,2,218,95,181,145,86,108,74,79,103,207,172,134,207,119,30,18,254,109,37,39,11,108,75,105,177,108,191,1,14,142,110,201,254,236,167,204,254,226,149,54,34,130,37,47,181,1,84,238,193,1,68,238,131,177,254,185,254,154,133,124,174,143,1,5,9,13,98,156,0,2,0,0,0,0,5,13,5,188,0,7,0,18,0,27,64,13,13,3,18,2,2,3,5,2,114,7,3,8,114,0,43,50,43,17,57,47,51,17,57,48,49,97,3,33,3,35,1,51,1,1,3,46,2,39,14,2,7,3,4,93,180,253,182,179,172,2,60,153,2,56,254,105,171,6,27,28,9,10,23,22,8,174,1,208,254,48,5,188,250,68,2,103,1,205,18,82,88,27,41,81,69,24,254,51,0,3,0,200,0,0,4,188,5,182,0,18,0,27,0,37,0,31,64,15,9,8,19,19,28,28,0,29,18,8,114,27,0,2,114,0,43,50,43,50,18,57,47,51,18,57,57,48,49,83,33,32,4,21,20,6,6,7,21,30,2,21,20,6,6,35,33,19,33,50,54,53,52,38,35,35,17,17,33,50,54,53,52,38,38,35,200,1,158,1,18,1,20,65,124,91,96,148,84,125,228,156,254,9,170,1,24,191,147,175,191,252,1,48,195,162,73,163,136,5,182,164,197,85,135,88,17,10,15,80,144,111,135,186,95,3,67,126,121,125,110,253,143,253,221,153,130,83,118,63,0,1,0,125,255,236,4,203,5,203,0,31,0,16,183,0,25,3,114,9,16,9,114,0,43,50,43,50,48,49,65,34,14,2,21,20,18,22,51,50,54,55,21,6,6,35,34,36,2,53,52,18,54,36,51,50,22,23,7,38,38,3,57,121,193,135,72,115,229,172,98,173,82,80,176,121,223,254,213,149,93,179,1,5,169,111,206,83,68,70,167,5,53,83,157,222,139,184,254,241,148,33,25,148,30,29,185,1,82,230,166,1,19,200,109,44,41,144,32,47,0,2,0,200,0,0,5,81,5,182,0,10,0,20,0,16,183,16,6,2,114,17,5,8,114,0,43,50,43,50,48,49,65,20,2,4,35,33,17,33,50,4,18,7,52,2,38,35,35,17,51,32,0,5,81,180,254,171,243,254,115,1,185,223,1,66,175,179,131,253,183,245,207,1,46,1,47,2,233,247,254,181,167,5,182,163,254,193,241,197,1,0,125,251,109,1,42,0,0,1,0,200,0,0,3,246,5,182,0,11,0,25,64,12,6,9,9,1,5,2,2,114,10,1,8,114,0,43,50,43,50,17,57,47,51,48,49,97,33,17,33,21,33,17,33,21,33,17,33,3,246,252,210,3,46,253,124,2,95,253,161,2,132,5,182,150,254,39,148,253,227,0,0,1,0,200,0,0,3,246,5,182,0,9,0,23,64,11,6,9,9,1,5,2,2,114,1,8,114,0,43,43,50,17,57,47,51,48,49,97,35,17,33,21,33,17,33,21,33,1,114,170,3,46,253,124,2,93,253,163,5,182,150,253,232,149,0,1,0,125,255,236,5,56,5,203,0,33,0,25,64,12,33,0,0,5,20,13,3,114,28,5,9,114,0,43,50,43,50,17,57,47,51,48,49,65,33,17,6,6,35,34,36,2,53,52,18,36,51,50,22,23,7,38,38,35,34,6,2,21,20,18,22,51,50,54,55,17,33,3,57,1,255,115,243,150,228,254,199,162,179,1,83,238,122,219,94,65,81,195,104,179,255,135,118,250,197,99,142,58,254,171,2,254,253,59,39,38,182,1,81,232,227,1,82,187,45,41,148,35,50,148,254,242,185,183,254,241,150,23,16,1,192,0,0,1,0,200,0,0,5,28,5,182,0,11,0,25,64,12,8,3,3,5,11,6,2,114,1,5,8,114,0,43,50,43,50,17,57,47,51,48,49,97,35,17,33,17,35,17,51,17,33,17,51,5,28,170,253,0,170,170,3,0,170,2,177,253,79,5,182,253,145,2,111,0,0,1,0,200,0,0,1,114,5,182,0,3,0,12,181,1,2,114,0,8,114,0,43,43,48,49,115,17,51,17,200,170,5,182,250,74,0,1,255,92,254,127,1,106,5,182,0,17,0,12,180,13,2,114,7,0,0,47,50,43,48,49,67,34,38,39,53,22,22,51,50,54,54,53,17,51,17,20,6,6,11,50,76,27,32,74,43,56,94,56,171,91,167,254,127,14,12,145,10,11,44,106,93,5,174,250,95,137,180,89,0,1,0,200,0,0,4,230,5,182,0,14,0,26,64,14,3,2,8,14,4,5,13,6,2,114,1,5,8,114,0,43,50,43,50,18,23,57,48,49,97,35,1,7,17,35,17,51,17,54,54,55,1,51,1,4,230,201,253,241,156,170,170,57,120,59,1,171,199,253,186,2,199,140,253,197,5,182,253,39,65,129,66,1,213,253,134,0,0,1,0,200,0,0,3,251,5,182,0,5,0,14,182,1,2,114,3,0,8,114,0,43,50,43,48,49,115,17,51,17,33,21,200,170,2,137,5,182,250,226,152,0,0,1,0,200,0,0,6,106,5,182,0,23,0,28,64,15,11,12,21,1,4,8,14,10,2,114,23,16,8,8,114,0,43,50,50,43,50,18,23,57,48,49,97,1,35,30,2,21,17,35,17,51,1,51,1,51,17,35,17,52,54,54,55,35,1,3,75,254,21,8,4,6,4,158,252,1,207,7,1,214,250,168,4,6,3,8,254,15,5,14,41,118,139,72,252,100,5,182,251,64,4,192,250,74,3,168,65,131,117,43,250,244,0,1,0,200,0,0,5,63,5,182,0,19,0,23,64,11,2,12,9,19,11,2,114,1,9,8,114,0,43,50,43,50,18,57,57,48,49,97,35,1,35,30,2,21,17,35,17,51,1,51,46,2,53,17,51,5,63,196,252,227,8,3,8,5,158,195,3,26,7,2,6,5,160,4,204,49,125,141,73,252,184,5,182,251,56,35,129,149,64,3,79,0,0,2,0,125,255,236,5,188,5,205,0,17,0,32,0,16,183,29,14,3,114,22,5,9,114,0,43,50,43,50,48,49,65,20,2,6,6,35,34,38,38,2,53,52,18,36,51,50,4,18,5,20,18,22,51,50,54,18,53,16,2,35,34,6,2,5,188,86,169,250,165,170,253,167,83,148,1,45,227,217,1,41,153,251,116,106,219,169,170,217,104,237,251,170,220,107,2,221,169,254,235,199,108,108,200,1,22,169,224,1,82,188,186,254,175,229,186,254,240,148,148,1,16,186,1,27,1,63,146,254,243,0,0,2,0,200,0,0,4,102,5,182,0,12,0,22,0,23,64,11,15,9,9,11,14,12,2,114,11,8,114,0,43,43,50,17,57,47,51,48,49,65,32,4,21,20,14,2,35,35,17,35,17,5,35,17,51,50,54,54,53,52,38,2,70,1,27,1,5,61,136,221,160,178,170,1,110,196,159,140,187,94,186,5,182,221,206,93,167,127,73,253,193,5,182,145,253,172,60,135,112,146,143,0,0,2,0,125,254,164,5,188,5,205,0,22,0,37,0,25,64,12,34,19,3,114,4,7,27,27,5,10,9,114,0,43,204,51,18,57,57,43,50,48,49,65,20,2,6,7,1,35,1,34,6,35,34,38,38,2,53,52,18,36,51,50,4,18,5,20,18,22,51,50,54,18,53,16,2,35,34,6,2,5,188,98,193,144,1,88,243,254,229,13,27,13,170,253,167,83,148,1,45,227,217,1,41,153,251,116,106,219,169,170,217,104,237,251,170,220,107,2,221,180,254,220,202,46,254,151,1,74,2,108,200,1,22,169,224,1,82,188,186,254,175,229,186,254,240,148,148,1,16,186,1,27,1,63,146,254,243,0,0,2,0,200,0,0,4,206,5,182,0,15,0,24,0,29,64,14,8,18,18,12,12,14,17,15,2,114,10,14,8,114,0,43,50,43,50,17,57,47,51,18,57,48,49,65,50,22,22,21,20,6,6,7,1,35,1,33,17,35,17,5,35,17,51,50,54,53,52,38,2,83,180,235,116,84,136,77,1,145,198,254,154,254,208,170,1,129,215,232,179,169,179,5,182,89,182,141,116,155,96,26,253,111,2,98,253,158,5,182,147,253,207,146,142,149,124,0,0,1,0,105,255,236,4,1,5,203,0,47,0,28,64,16,16,0,20,44,40,25,6,4,36,29,3,114,12,4,9,114,0,43,50,43,50,18,23,57,48,49,65,20,6,6,35,34,38,38,39,53,22,22,51,50,54,54,53,52,38,38,39,46,3,53,52,54,54,51,50,22,23,7,38,38,35,34,6,6,21,20,22,22,23,30,2,4,1,129,232,157,83,148,124,47,75,216,118,110,152,79,66,153,132,93,142,96,49,119,211,137,117,199,83,53,79,177,94,94,129,68,65,143,118,129,180,94,1,133,130,183,96,16,30,22,163,31,53,59,111,78,75,101,83,47,33,79,100,132,85,117,167,89,44,37,146,33,44,55,100,69,77,102,79,43,47,105,151,0,0,1,0,18,0,0,4,83,5,182,0,7,0,19,64,9,7,3,3,4,2,114,1,8,114,0,43,43,50,17,51,48,49,97,35,17,33,53,33,21,33,2,137,171,254,52,4,65,254,54,5,32,150,150,0,1,0,185,255,236,5,26,5,182,0,19,0,16,183,19,9,2,114,14,5,9,114,0,43,50,43,50,48,49,65,17,20,6,6,35,32,0,53,17,51,17,20,22,51,50,54,54,53,17,5,26,125,252,190,254,241,254,229,171,197,196,134,171,83,5,182,252,78,155,242,139,1,38,246,3,174,252,77,186,202,97,175,115,3,180,0,1,0,0,0,0,4,197,5,182,0,14,0,19,64,9,9,2,14,3,2,114,2,8,114,0,43,43,50,18,57,48,49,65,1,35,1,51,1,30,2,23,62,2,55,1,4,197,253,243,171,253,243,178,1,86,21,33,26,10,10,26,34,21,1,84,5,182,250,74,5,182,252,61,58,106,98,46,46,99,107,59,3,192,0,1,0,30,0,0,7,69,5,182,0,41,0,27,64,14,8,23,36,3,15,41,30,16,2,114,2,15,8,114,0,43,50,43,50,50,17,23,57,48,49,65,1,35,1,46,3,39,14,3,7,1,35,1,51,19,30,3,23,62,3,55,1,51,1,30,3,23,62,2,55,19,7,69,254,121,171,254,222,13,23,20,13,3,2,11,17,23,13,254,230,171,254,124,177,235,12,21,17,14,6,5,16,19,23,13,1,7,175,1,18,14,24,19,15,6,7,20,27,16,235,5,182,250,74,3,216,42,85,77,59,15,15,58,76,86,44,252,41,5,182,252,107,46,89,84,80,38,39,85,88,90,45,3,139,252,110,47,92,87,79,35,49,108,118,63,3,148,0,1,0,6,0,0,4,152,5,182,0,11,0,26,64,14,2,5,11,8,4,1,10,6,2,114,1,4,8,114,0,43,50,43,50,18,23,57,48,49,97,35,1,1,35,1,1,51,1,1,51,1,4,152,193,254,117,254,111,181,1,231,254,59,189,1,109,1,111,180,254,60,2,132,253,124,2,250,2,188,253,185,2,71,253,71,0,1,0,0,0,0,4,121,5,182,0,8,0,23,64,12,6,3,0,3,4,2,7,2,114,4,8,114,0,43,43,50,18,23,57,48,49,65,1,51,1,17,35,17,1,51,2,61,1,133,183,254,25,170,254,24,186,2,217,2,221,252,129,253,201,2,47,3,135,0,0,1,0,78,0,0,4,69,5,182,0,9,0,25,64,12,7,4,4,5,2,114,2,8,8,1,8,114,0,43,50,17,51,43,50,17,51,48,49,97,33,53,1,33,53,33,21,1,33,4,69,252,9,3,19,253,8,3,199,252,236,3,41,128,4,158,152,128,251,98,0,1,0,166,254,188,2,107,5,182,0,7,0,14,181,5,2,2,114,6,1,0,47,51,43,50,48,49,65,33,17,33,21,33,17,33,2,107,254,59,1,197,254,221,1,35,254,188,6,250,136,250,24,0,0,1,0,21,0,0,2,219,5,182,0,3,0,12,181,3,2,114,1,8,114,0,43,43,48,49,83,1,35,1,185,2,34,165,253,223,5,182,250,74,5,182,0,1,0,51,254,188,1,249,5,182,0,7,0,14,181,0,7,3,4,2,114,0,43,50,47,51,48,49,87,33,17,33,53,33,17,33,51,1,35,254,221,1,198,254,58,186,5,232,136,249,6,0,0,1,0,80,2,37,4,68,5,193,0,6,0,14,181,5,4,0,1,17,114,0,43,205,50,57,48,49,83,1,51,1,35,1,1,80,1,183,96,1,221,149,254,138,254,172,2,37,3,156,252,100,2,234,253,22,0,1,255,252,254,205,3,133,255,72,0,3,0,8,177,1,2,0,47,51,48,49,65,33,53,33,3,133,252,119,3,137,254,205,123,0,0,1,0,82,4,217,1,231,6,33,0,12,0,18,183,11,4,0,128,15,6,1,6,0,47,93,26,205,57,57,48,49,65,30,2,23,21,35,46,3,39,53,1,24,24,71,79,33,113,36,85,84,68,19,6,33,46,113,107,38,24,29,80,89,81,29,20,0,0,2,0,94,255,236,3,203,4,90,0,29,0,40,0,35,64,18,7,37,37,11,30,19,19,0,11,11,114,4,10,114,23,0,7,114,0,43,50,43,43,18,57,47,51,17,51,17,51,48,49,65,50,22,21,17,35,39,35,14,2,35,34,38,38,53,52,36,37,55,53,52,38,35,34,6,7,39,54,54,1,7,6,6,21,20,22,51,50,54,53,2,73,196,190,121,32,8,46,100,131,95,100,155,89,1,4,1,10,189,122,111,86,156,70,51,74,192,1,72,167,205,168,114,94,146,186,4,90,176,193,253,23,162,60,81,41,70,142,109,164,176,8,8,67,142,114,50,34,126,38,54,253,194,7,8,118,108,94,90,162,162,0,2,0,175,255,236,4,115,6,20,0,22,0,36,0,37,64,20,22,0,114,21,10,114,18,19,31,31,15,11,114,5,4,23,23,8,7,114,0,43,50,17,51,51,43,50,17,51,51,43,43,48,49,65,17,20,6,7,51,54,54,51,50,18,17,20,6,6,35,34,38,39,35,7,35,17,1,34,6,6,21,21,20,22,51,50,54,53,52,38,1,85,7,2,9,45,170,132,206,245,112,204,139,130,167,45,13,34,120,1,230,119,140,61,138,182,153,153,151,6,20,254,123,67,126,35,74,102,254,227,254,231,185,254,130,97,70,147,6,20,253,188,93,187,143,9,207,219,224,208,212,214,0,1,0,114,255,236,3,146,4,92,0,29,0,16,183,15,8,7,114,23,0,11,114,0,43,50,43,50,48,49,69,34,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,6,21,20,22,22,51,50,54,55,21,6,6,2,102,148,226,126,133,234,149,82,153,49,50,50,131,57,114,151,75,73,145,109,87,140,57,55,135,20,122,250,190,199,253,122,33,25,139,20,32,98,190,139,133,188,99,37,25,148,28,30,0,0,2,0,114,255,236,4,53,6,20,0,23,0,36,0,37,64,20,17,10,114,16,0,114,11,10,31,31,6,7,114,19,20,24,24,0,11,114,0,43,50,17,51,51,43,50,17,51,51,43,43,48,49,69,34,2,17,16,18,51,50,22,22,23,51,38,38,53,17,51,17,35,39,35,14,2,39,50,54,53,53,52,38,35,34,6,21,20,22,2,53,208,243,248,206,87,130,94,32,12,4,8,166,134,25,7,31,95,131,63,176,146,139,183,153,152,151,20,1,28,1,24,1,27,1,33,46,77,49,31,108,34,1,183,249,236,156,49,80,47,138,200,197,30,209,224,235,203,202,220,0,2,0,114,255,236,4,19,4,92,0,23,0,31,0,25,64,12,27,6,6,0,9,16,11,114,24,0,7,114,0,43,50,43,50,18,57,47,51,48,49,65,50,22,22,21,21,33,22,22,51,50,54,55,21,6,6,35,34,38,38,53,52,18,54,23,34,6,7,33,46,2,2,85,140,200,106,253,11,3,186,169,104,160,86,83,163,111,158,235,130,119,217,145,133,158,15,2,68,1,59,120,4,92,124,223,149,103,193,202,38,37,146,37,34,129,250,181,177,1,3,140,136,174,156,98,149,83,0,1,0,30,0,0,3,14,6,31,0,24,0,27,64,14,6,5,1,1,23,6,114,19,12,1,114,3,10,114,0,43,43,50,43,50,17,51,57,48,49,65,33,17,35,17,35,53,55,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,21,33,2,151,254,239,166,194,194,82,156,112,63,105,40,43,34,85,44,95,91,1,17,3,198,252,58,3,198,80,55,73,138,173,82,22,14,131,11,19,123,131,80,0,0,3,0,31,254,20,4,47,4,94,0,47,0,63,0,75,0,45,64,22,34,12,64,64,32,6,57,57,41,41,0,26,23,23,70,19,7,114,48,0,15,114,0,43,50,43,50,50,17,51,17,57,47,51,18,57,198,50,17,57,57,48,49,65,34,38,53,52,54,55,38,38,53,52,54,55,38,38,53,52,54,54,51,50,22,22,23,33,21,7,22,22,21,20,6,35,34,39,6,6,21,20,22,22,51,51,50,22,21,20,4,37,50,54,54,53,52,38,38,35,35,34,6,6,21,20,22,19,50,54,53,52,38,35,34,6,21,20,22,1,225,216,234,131,116,43,61,67,69,86,107,98,186,132,29,59,54,20,1,120,202,30,40,222,194,46,48,49,51,39,74,52,193,179,191,254,216,254,237,136,179,89,60,116,84,190,74,110,59,150,182,119,120,122,119,114,123,124,254,20,161,145,103,146,24,20,80,52,60,91,42,35,167,111,118,167,88,5,9,6,107,25,39,110,67,164,193,8,27,66,43,32,38,17,150,144,182,194,130,55,103,71,66,67,23,46,90,67,89,93,3,108,120,115,123,123,127,122,112,120,0,1,0,175,0,0,4,65,6,20,0,26,0,27,64,14,26,0,114,15,25,10,114,4,5,19,19,9,7,114,0,43,50,17,51,51,43,50,43,48,49,65,17,20,6,7,51,62,2,51,50,22,22,21,17,35,17,52,38,35,34,6,6,21,17,35,17,1,85,4,5,11,34,105,134,75,132,177,89,164,125,129,122,145,63,166,6,20,254,47,40,81,34,58,79,41,84,176,140,253,54,2,191,137,136,93,180,130,253,195,6,20,0,2,0,160,0,0,1,104,5,226,0,3,0,15,0,16,183,4,10,3,6,114,2,10,114,0,43,43,206,50,48,49,65,17,35,17,19,50,22,21,20,6,35,34,38,53,52,54,1,85,166,85,41,59,59,41,43,57,57,4,72,251,184,4,72,1,154,53,56,55,54,54,55,56,53,0,0,2,255,144,254,20,1,104,5,226,0,16,0,28,0,19,64,9,20,26,11,6,114,7,0,15,114,0,43,50,43,206,50,48,49,83,34,38,39,53,22,22,51,50,54,53,17,51,17,20,6,6,19,52,54,51,50,22,21,20,6,35,34,38,43,51,76,28,31,64,40,68,84,166,64,132,15,57,43,41,59,59,41,43,57,254,20,15,10,135,10,11,76,100,4,249,251,11,100,143,76,7,97,56,53,53,56,55,54,54,0,1,0,175,0,0,4,36,6,20,0,18,0,32,64,19,18,0,114,15,14,4,5,11,8,6,10,13,13,17,10,114,10,6,114,0,43,43,50,17,18,23,57,43,48,49,65,17,20,6,7,51,54,54,55,1,51,1,1,35,1,7,17,35,17,1,84,6,2,7,21,81,28,1,108,195,254,71,1,217,200,254,125,133,165,6,20,252,216,40,115,44,26,102,31,1,132,254,44,253,140,2,7,122,254,115,6,20,0,1,0,175,0,0,1,86,6,20,0,3,0,12,181,2,0,114,1,10,114,0,43,43,48,49,97,35,17,51,1,86,167,167,6,20,0,1,0,175,0,0,6,194,4,92,0,39,0,40,64,23,28,29,36,37,4,19,19,33,9,0,7,114,33,7,114,26,6,114,14,5,25,10,114,0,43,50,50,43,43,43,50,17,51,17,23,51,48,49,65,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,52,38,38,35,34,6,6,21,17,35,17,51,23,51,62,2,51,50,22,23,51,54,54,5,85,181,184,164,115,113,159,144,165,51,101,77,109,132,59,166,134,25,9,33,100,124,70,125,169,38,9,54,188,4,92,189,209,253,50,2,198,133,133,184,179,253,155,2,198,89,118,59,90,177,129,253,188,4,72,155,57,78,40,93,95,95,93,0,0,1,0,175,0,0,4,65,4,92,0,21,0,27,64,14,15,6,114,5,14,10,114,18,17,9,9,0,7,114,0,43,50,17,51,51,43,50,43,48,49,65,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,51,23,51,62,2,2,182,195,200,164,125,129,182,148,166,134,25,9,35,108,134,4,92,191,211,253,54,2,191,137,136,206,196,253,194,4,72,158,58,79,41,0,2,0,114,255,236,4,96,4,92,0,17,0,32,0,16,183,30,14,7,114,22,5,11,114,0,43,50,43,50,48,49,65,20,14,2,35,34,46,2,53,52,54,54,51,50,22,22,5,20,22,22,51,50,54,54,53,52,38,38,35,34,6,4,96,70,132,187,118,110,183,133,73,122,227,157,150,225,125,252,190,70,146,115,114,147,70,70,146,116,171,159,2,38,135,212,146,77,77,146,212,135,180,253,133,134,253,179,132,194,106,106,194,132,131,191,104,226,0,2,0,175,254,22,4,115,4,92,0,24,0,40,0,37,64,20,18,6,114,17,14,114,11,12,34,34,7,11,114,21,20,25,25,0,7,114,0,43,50,17,51,51,43,50,17,51,51,43,43,48,49,65,50,18,17,20,6,6,35,34,38,38,39,35,22,22,21,17,35,17,51,23,51,62,2,23,34,6,6,7,21,20,22,22,51,50,54,54,53,52,38,2,178,205,244,112,203,138,87,132,94,31,12,3,9,167,137,22,8,32,92,133,62,114,139,64,2,61,141,119,102,136,67,151,4,92,254,230,254,229,187,254,130,46,78,46,39,110,41,254,62,6,50,162,50,83,49,140,88,175,132,32,139,192,100,110,197,128,194,229,0,2,0,113,254,22,4,52,4,92,0,22,0,36,0,37,64,20,22,14,114,21,6,114,19,18,31,31,15,7,114,4,5,23,23,8,11,114,0,43,50,17,51,51,43,50,17,51,51,43,43,48,49,65,17,52,54,55,35,6,6,35,34,2,17,52,54,54,51,50,22,23,51,55,51,17,1,50,54,54,55,53,52,38,35,34,6,21,20,22,3,142,4,5,11,46,170,134,201,244,112,205,137,131,166,47,8,25,132,254,25,116,140,65,2,144,179,154,150,150,254,22,1,214,39,102,37,76,102,1,28,1,26,185,254,131,103,74,157,249,206,2,96,87,176,131,35,212,219,235,201,201,223,0,0,1,0,175,0,0,3,38,4,92,0,21,0,25,64,13,15,6,114,14,10,114,18,17,7,7,0,7,114,0,43,50,17,51,51,43,43,48,49,65,50,22,23,7,38,38,35,34,14,2,21,17,35,17,51,23,51,62,2,2,161,33,72,28,21,27,66,29,66,117,88,50,167,138,18,7,34,96,127,4,92,7,6,154,7,8,53,99,139,85,253,180,4,72,202,61,101,60,0,1,0,103,255,236,3,116,4,92,0,42,0,26,64,14,14,18,39,22,4,4,32,25,7,114,11,4,11,114,0,43,50,43,50,18,23,57,48,49,65,20,6,6,35,34,38,39,53,22,22,51,50,54,53,52,38,38,39,46,2,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,22,23,30,2,3,116,105,195,135,115,168,63,67,186,97,142,128,51,120,106,105,153,83,225,183,99,173,75,56,68,154,80,115,123,57,126,103,103,150,81,1,44,105,143,72,36,33,153,33,54,92,79,45,69,65,39,40,79,114,91,139,149,39,33,133,29,40,76,66,51,66,58,39,38,81,115,0,0,1,0,32,255,236,2,171,5,70,0,24,0,29,64,14,14,18,13,21,21,16,15,18,6,114,0,7,11,114,0,43,50,43,50,205,51,17,51,18,57,48,49,101,50,54,55,21,6,6,35,34,38,38,53,17,35,53,55,55,51,21,33,21,33,17,20,22,2,17,41,86,27,29,103,49,87,142,85,156,157,66,100,1,65,254,191,95,116,14,10,129,13,18,61,146,129,2,138,81,65,238,254,130,253,123,103,102,0,1,0,163,255,236,4,56,4,72,0,23,0,27,64,14,23,13,6,114,3,4,18,18,8,11,114,1,10,114,0,43,43,50,17,51,51,43,50,48,49,65,17,35,39,35,14,2,35,34,38,38,53,17,51,17,20,22,51,50,54,54,53,17,4,56,136,24,9,34,108,135,76,130,176,89,168,124,127,122,145,64,4,72,251,184,154,57,78,39,84,176,138,2,206,253,62,137,135,92,179,130,2,65,0,1,0,0,0,0,3,255,4,72,0,13,0,21,64,10,7,6,0,12,1,6,114,0,10,114,0,43,43,50,18,57,57,48,49,97,1,51,19,22,22,23,51,54,54,55,19,51,1,1,160,254,96,178,241,25,52,10,7,12,56,23,241,178,254,95,4,72,253,105,68,164,50,50,165,67,2,151,251,184,0,1,0,24,0,2,6,27,4,74,0,42,0,27,64,14,21,34,6,3,14,41,29,15,6,114,42,14,10,114,0,43,50,43,50,50,18,23,57,48,49,101,3,46,3,39,35,14,3,7,3,35,1,51,19,30,2,23,51,62,3,55,19,51,19,30,2,23,51,62,2,55,19,51,1,4,43,195,13,23,19,15,5,7,4,14,19,22,14,204,187,254,210,172,158,16,29,21,5,8,6,15,19,22,11,202,179,195,15,29,24,5,8,4,22,29,16,160,169,254,209,2,2,126,41,79,73,63,23,23,63,74,81,41,253,133,4,72,253,163,60,117,103,38,25,70,79,79,35,2,123,253,134,48,104,97,38,34,100,120,62,2,93,251,184,0,0,1,0,39,0,0,4,9,4,72,0,11,0,28,64,15,9,6,0,3,4,1,8,8,11,10,114,5,1,6,114,0,43,50,43,50,17,18,23,57,48,49,65,1,51,1,1,51,1,1,35,1,1,35,1,180,254,133,190,1,33,1,32,188,254,133,1,144,190,254,205,254,203,188,2,49,2,23,254,90,1,166,253,233,253,207,1,191,254,65,0,1,0,2,254,19,4,2,4,72,0,29,0,26,64,14,6,29,28,13,4,0,24,17,15,114,12,0,6,114,0,43,50,43,50,18,23,57,48,49,83,51,19,30,2,23,51,54,54,55,19,51,1,14,2,35,34,38,39,53,22,22,51,50,54,54,55,55,2,178,242,21,36,28,8,7,14,52,30,229,179,254,35,38,101,144,102,47,72,26,22,63,34,62,91,66,24,60,4,72,253,132,56,103,94,44,50,163,85,2,123,251,23,101,150,81,11,7,133,5,8,47,90,62,154,0,0,1,0,80,0,0,3,111,4,72,0,9,0,25,64,12,7,4,4,5,6,114,2,8,8,1,10,114,0,43,50,17,51,43,50,17,51,48,49,97,33,53,1,33,53,33,21,1,33,3,111,252,225,2,89,253,205,2,236,253,175,2,94,110,3,88,130,123,252,180,0,1,0,57,254,188,2,190,5,182,0,37,0,29,64,13,28,29,10,10,9,9,0,20,19,2,114,37,0,0,47,50,43,50,18,57,47,51,18,57,57,48,49,65,46,2,53,17,52,38,38,35,53,62,2,53,17,52,54,54,51,21,14,2,21,17,20,6,7,21,22,22,21,17,20,22,22,23,2,190,124,179,95,56,110,81,81,110,56,100,179,119,74,105,55,106,110,112,104,54,105,75,254,188,1,71,142,107,1,50,71,87,40,138,1,39,86,71,1,52,107,141,70,136,2,42,86,68,254,211,104,126,20,12,19,126,105,254,205,68,85,40,1,0,0,1,1,236,254,16,2,119,6,21,0,3,0,8,177,0,2,0,47,47,48,49,65,51,17,35,1,236,139,139,6,21,247,251,0,1,0,67,254,188,2,200,5,182,0,37,0,29,64,13,10,9,28,28,29,29,0,18,19,2,114,1,0,0,47,50,43,50,18,57,47,51,18,57,57,48,49,83,53,62,2,53,17,52,54,55,53,38,38,53,17,52,38,38,39,53,30,2,21,17,20,22,22,51,21,34,6,6,21,17,20,6,6,67,74,104,55,107,109,111,105,54,104,75,124,178,95,56,111,81,81,111,56,100,178,254,188,138,2,41,85,68,1,47,105,126,19,12,20,126,104,1,48,69,86,41,1,136,1,70,141,108,254,208,72,87,40,138,40,86,70,254,202,106,142,71,0,1,0,103,2,81,4,41,3,83,0,25,0,29,64,12,20,19,19,3,10,23,128,7,6,6,16,23,0,47,51,51,47,51,26,16,205,50,50,47,51,48,49,65,38,38,35,34,6,7,53,54,54,51,50,22,23,22,22,51,50,54,55,21,6,6,35,34,38,2,42,71,98,47,57,127,51,50,123,73,62,117,88,73,96,45,59,126,50,48,122,74,60,118,2,146,32,25,68,52,149,53,54,27,38,31,26,68,52,147,52,57,26,0,0,2,0,150,254,138,1,132,4,92,0,3,0,15,0,19,183,0,0,7,7,13,7,114,2,0,47,43,50,17,51,125,47,48,49,83,51,19,35,19,20,6,35,34,38,53,52,54,51,50,22,212,111,46,203,222,69,50,50,69,69,50,50,69,2,169,251,225,5,79,70,59,59,70,68,63,63,0,0,1,0,185,255,236,3,221,5,203,0,35,0,20,183,26,24,16,23,34,8,0,1,0,47,205,51,51,47,51,205,51,48,49,65,21,22,22,23,7,38,38,35,34,6,6,21,20,22,22,51,50,54,55,21,6,6,7,21,35,53,46,2,53,52,54,54,55,53,2,208,77,141,51,48,55,133,56,115,152,75,74,147,110,88,136,62,55,119,80,128,125,182,98,100,182,123,5,203,165,3,32,23,139,21,31,96,191,143,142,185,91,34,26,145,27,32,2,199,204,18,125,234,180,183,239,129,18,173,0,0,1,0,68,0,0,4,68,5,201,0,35,0,37,64,18,23,19,19,22,30,11,11,29,14,14,0,22,12,114,7,0,5,114,0,43,50,43,18,57,47,51,51,17,51,17,51,17,51,48,49,65,50,22,23,7,38,38,35,34,6,21,17,33,21,33,21,20,6,6,7,33,21,33,53,62,2,53,53,35,53,51,17,52,54,54,2,174,111,176,70,60,61,149,83,121,126,1,160,254,96,40,65,38,3,24,252,0,61,94,53,199,199,101,184,5,201,47,34,134,29,47,128,142,254,225,127,222,84,111,67,22,152,141,14,68,120,91,224,127,1,49,124,174,93,0,0,2,0,121,1,6,4,23,4,161,0,35,0,51,0,74,64,35,33,30,30,40,21,24,24,40,40,27,22,23,23,32,31,27,15,12,12,48,3,6,6,48,48,9,14,13,13,4,5,9,9,27,12,0,63,51,47,206,50,50,17,51,17,51,17,51,17,51,17,51,17,51,16,206,50,50,17,51,17,51,17,51,17,51,17,51,17,51,48,49,83,52,54,55,39,55,23,54,54,51,50,22,23,55,23,7,22,22,21,20,6,7,23,7,39,6,6,35,34,38,39,7,39,55,38,38,55,20,22,22,51,50,54,54,53,52,38,38,35,34,6,6,183,41,34,137,92,138,49,120,66,64,116,50,139,92,135,33,43,39,37,133,90,139,48,118,64,66,122,47,138,91,136,34,41,128,73,125,76,78,126,74,74,126,77,77,125,73,2,211,63,119,49,141,90,134,35,39,39,35,134,90,140,48,119,65,64,121,49,138,89,134,34,39,39,36,135,89,139,49,119,64,77,125,73,74,125,76,78,126,75,75,126,0,0,1,0,31,0,0,4,112,5,182,0,22,0,44,64,21,0,20,20,17,10,7,7,13,16,3,6,6,17,17,12,1,21,4,114,12,12,0,63,43,50,18,57,47,51,17,51,206,50,50,17,51,17,51,17,51,48,49,65,1,51,1,33,21,33,21,33,21,33,17,35,17,33,53,33,53,33,53,33,1,51,2,72,1,121,175,254,92,1,8,254,197,1,59,254,197,162,254,196,1,60,254,196,1,4,254,96,177,2,229,2,209,252,253,123,174,123,254,241,1,15,123,174,123,3,3,0,2,1,236,254,16,2,119,6,21,0,3,0,7,0,12,179,4,6,3,0,0,47,50,47,51,48,49,65,51,17,35,17,51,17,35,1,236,139,139,139,139,6,21,252,247,254,14,252,246,0,2,0,122,255,247,3,143,6,30,0,54,0,69,0,26,64,15,47,33,51,30,60,67,3,23,8,44,36,16,9,1,114,0,43,50,47,51,23,57,48,49,83,52,54,55,38,38,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,22,23,30,2,21,20,6,7,22,22,21,20,6,35,34,38,39,53,30,2,51,50,54,53,52,38,38,39,46,2,55,20,22,22,23,23,54,54,53,52,38,38,39,6,6,140,102,67,76,86,207,192,113,158,75,51,69,141,96,125,108,52,121,101,104,150,81,95,62,73,81,231,209,113,169,64,45,116,128,64,155,119,44,117,109,105,152,82,143,58,129,106,54,52,85,59,142,125,62,96,3,41,101,126,31,39,111,85,122,142,39,30,128,28,39,68,62,41,62,58,37,37,87,116,84,104,134,35,37,109,80,139,155,36,31,144,21,39,24,92,62,42,62,61,40,39,84,119,108,53,80,69,40,19,29,95,70,54,84,74,38,16,96,0,0,2,1,54,5,16,3,107,5,210,0,11,0,23,0,14,180,15,21,21,3,9,0,47,51,51,17,51,48,49,65,52,54,51,50,22,21,20,6,35,34,38,37,52,54,51,50,22,21,20,6,35,34,38,1,54,52,38,39,53,53,39,38,52,1,128,52,37,38,54,54,38,37,52,5,114,50,46,46,50,49,49,49,49,50,46,46,50,49,49,49,0,0,3,0,100,255,236,6,68,5,203,0,19,0,46,0,66,0,27,64,13,34,27,57,10,3,114,40,20,128,47,0,9,114,0,43,50,26,204,50,43,50,204,50,48,49,69,34,36,38,2,53,52,18,54,36,51,50,4,22,18,21,20,2,6,4,3,34,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,50,54,55,21,6,6,7,50,62,2,53,52,46,2,35,34,14,2,21,20,30,2,3,84,163,254,237,203,111,112,203,1,19,162,157,1,17,206,116,112,203,254,237,130,202,204,97,185,132,66,130,57,56,50,98,47,127,140,127,137,50,115,52,49,104,103,133,233,176,100,95,172,235,140,140,235,173,95,94,173,235,20,112,202,1,19,162,163,1,19,202,112,113,203,254,238,162,162,254,237,202,112,1,38,249,208,133,205,117,32,29,116,26,27,177,154,160,172,26,21,122,22,28,192,96,175,237,141,134,234,180,101,96,175,237,141,134,235,179,101,0,2,0,68,3,19,2,110,5,199,0,28,0,39,0,31,64,14,6,36,36,18,29,0,5,5,9,192,22,0,3,114,0,43,50,26,204,50,47,17,57,57,50,17,51,48,49,65,50,22,21,17,35,39,6,6,35,34,38,38,53,52,54,54,55,55,53,52,38,35,34,6,7,39,54,54,19,7,6,6,21,20,22,51,50,54,53,1,104,130,132,91,23,39,114,77,64,95,51,70,144,109,112,85,62,55,103,46,43,52,130,212,98,124,90,62,53,104,93,5,199,110,119,254,62,87,43,57,44,90,67,68,92,50,4,4,47,69,56,29,24,95,26,33,254,151,4,4,64,58,53,49,99,83,0,2,0,79,0,122,3,171,3,197,0,6,0,13,0,36,64,18,11,12,12,5,9,8,8,6,13,3,10,0,7,6,2,1,4,5,0,47,51,204,50,23,57,50,17,51,17,51,17,51,48,49,83,1,23,1,1,7,1,37,1,23,1,1,7,1,79,1,84,119,254,225,1,31,119,254,172,1,142,1,89,117,254,226,1,30,117,254,167,2,44,1,153,68,254,159,254,159,69,1,151,27,1,153,68,254,159,254,159,69,1,151,0,1,0,103,1,7,4,36,3,22,0,5,0,14,180,1,1,4,4,5,0,47,51,17,51,47,48,49,65,17,35,17,33,53,4,36,134,252,201,3,22,253,241,1,135,136,255,255,0,82,1,220,2,66,2,112,6,6,0,16,0,0,0,4,0,100,255,236,6,68,5,203,0,13,0,22,0,42,0,62,0,35,64,18,12,8,14,3,0,22,1,53,33,3,114,10,0,128,43,23,9,114,0,43,50,26,204,50,43,50,204,50,17,23,57,48,49,65,17,33,50,22,21,20,6,7,19,35,3,35,17,17,51,50,54,53,52,38,35,35,19,34,36,38,2,53,52,18,54,36,51,50,4,22,18,21,20,2,6,4,39,50,62,2,53,52,46,2,35,34,14,2,21,20,30,2,2,63,1,5,163,156,99,64,237,164,207,138,111,83,95,88,92,109,132,163,254,237,203,111,112,203,1,19,162,157,1,17,206,116,112,203,254,237,162,133,233,176,100,95,172,235,140,140,235,173,95,94,173,235,1,28,3,125,131,132,97,113,25,254,117,1,100,254,156,1,218,82,70,77,68,251,205,112,202,1,19,162,163,1,19,202,112,113,203,254,238,162,162,254,237,202,112,102,96,175,237,141,134,234,180,101,96,175,237,141,134,235,179,101,0,1,255,250,6,20,4,6,6,147,0,3,0,8,177,2,1,0,47,51,48,49,65,33,53,33,4,6,251,244,4,12,6,20,127,0,0,2,0,117,3,91,2,248,5,203,0,15,0,27,0,16,182,16,0,192,22,8,3,114,0,43,50,26,204,50,48,49,65,34,38,38,53,52,54,54,51,50,22,22,21,20,6,6,39,50,54,53,52,38,35,34,6,21,20,22,1,182,96,144,81,79,144,98,95,145,82,82,145,93,98,98,101,95,101,98,97,3,91,78,141,92,93,141,79,79,141,93,92,141,78,114,109,88,92,109,109,92,88,109,0,2,0,103,0,0,4,42,4,197,0,3,0,15,0,27,64,11,14,4,13,13,9,7,10,10,1,1,0,0,47,50,17,51,47,51,51,51,17,51,51,48,49,115,53,33,21,1,33,21,33,17,35,17,33,53,33,17,51,103,3,195,254,98,1,156,254,100,137,254,100,1,156,137,135,135,3,27,136,254,88,1,168,136,1,170,0,1,0,50,3,84,2,115,6,211,0,26,0,18,183,2,25,25,0,120,10,17,119,0,63,51,228,50,17,51,48,49,65,33,53,55,62,2,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,6,7,7,33,2,115,253,191,237,82,88,33,78,66,61,103,53,67,60,140,86,130,148,55,107,77,170,1,154,3,84,104,232,80,102,82,47,66,71,47,41,89,50,60,129,112,68,114,116,73,164,0,0,1,0,37,3,69,2,141,6,211,0,41,0,27,64,12,6,7,29,29,26,26,20,13,120,35,0,119,0,63,50,228,50,57,47,51,18,57,57,48,49,65,50,22,21,20,6,7,21,22,22,21,20,6,35,34,38,39,53,22,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,1,83,143,146,89,62,81,95,171,178,75,131,61,68,138,62,108,103,119,108,119,119,104,97,85,64,64,111,55,68,62,140,6,211,126,98,84,106,19,6,16,105,83,119,148,26,30,121,32,36,87,75,76,69,106,82,67,65,64,43,35,89,45,54,0,0,1,0,82,4,217,1,231,6,33,0,12,0,18,183,1,8,12,128,15,6,1,6,0,47,93,26,205,57,57,48,49,65,21,14,3,7,35,53,62,2,55,1,231,20,69,84,85,36,111,32,76,72,24,6,33,20,29,81,89,80,29,24,38,107,113,46,0,0,1,0,175,254,20,4,67,4,72,0,29,0,33,64,17,17,12,11,4,3,24,24,8,11,114,1,10,114,20,0,6,114,0,43,50,43,43,50,17,51,51,51,51,47,48,49,65,17,35,39,35,14,2,35,34,38,39,35,30,2,21,17,35,17,51,17,20,22,51,50,54,54,53,17,4,67,135,26,9,34,94,125,81,86,121,40,8,3,4,2,166,166,128,129,124,142,61,4,72,251,184,152,54,77,41,54,46,24,71,89,53,254,177,6,52,253,60,133,137,93,179,129,2,65,0,0,1,0,122,254,252,4,93,6,20,0,18,0,18,182,6,9,9,3,17,5,0,0,47,50,47,51,57,47,51,48,49,65,35,17,35,17,35,17,6,6,35,34,38,38,53,52,54,54,51,33,4,93,111,216,112,31,78,37,125,184,101,110,198,133,2,42,254,252,6,173,249,83,3,69,9,9,97,217,180,189,220,94,0,255,255,0,150,2,70,1,132,3,75,6,7,0,17,0,0,2,98,0,1,0,28,254,20,1,171,0,0,0,22,0,16,181,19,16,10,3,192,18,0,47,26,204,50,57,57,48,49,65,20,6,35,34,38,39,53,22,22,51,50,54,53,52,38,39,55,51,7,30,2,1,171,150,145,31,56,17,19,60,30,75,80,107,83,89,111,54,50,81,48,254,226,97,109,7,4,105,4,6,44,52,55,50,9,176,112,10,42,70,0,0,1,0,76,3,84,1,225,6,193,0,13,0,18,64,9,11,10,12,7,4,2,120,13,119,0,63,228,23,57,48,49,65,17,35,17,52,54,54,55,6,6,7,7,39,37,1,225,135,2,3,2,21,52,29,109,66,1,11,6,193,252,147,2,54,36,63,61,29,19,42,19,77,94,185,0,0,2,0,67,3,19,2,189,5,200,0,12,0,24,0,16,182,16,3,3,22,9,3,114,0,43,50,50,47,51,48,49,65,20,6,35,34,38,53,52,54,51,50,22,22,5,20,22,51,50,54,53,52,38,35,34,6,2,189,173,147,139,175,170,148,97,141,78,253,255,92,102,102,93,92,102,101,94,4,111,164,184,179,169,166,179,81,154,110,121,125,125,121,120,122,120,0,2,0,77,0,122,3,169,3,197,0,6,0,13,0,26,64,15,2,9,10,13,7,0,6,4,3,11,10,5,12,1,8,0,47,51,204,50,23,57,48,49,65,1,39,1,1,55,1,5,1,39,1,1,55,1,3,169,254,167,116,1,30,254,226,116,1,89,254,111,254,170,117,1,30,254,226,117,1,86,2,18,254,104,69,1,98,1,96,68,254,104,27,254,104,69,1,98,1,96,68,254,104,0,0,4,0,66,0,0,5,217,5,182,0,3,0,17,0,28,0,37,0,54,64,28,21,30,30,24,24,19,34,27,27,22,18,3,3,18,12,114,13,12,14,9,4,4,15,1,1,15,4,114,0,43,50,47,16,204,23,57,43,50,47,16,204,57,47,57,51,51,17,51,17,51,48,49,97,1,51,1,3,17,52,54,54,55,6,6,7,7,39,37,51,17,1,53,33,53,1,51,17,51,21,35,21,1,33,53,52,54,55,6,6,7,1,7,3,110,144,252,145,70,2,3,2,21,52,29,109,66,1,11,137,2,245,254,110,1,149,139,128,128,254,103,1,11,2,3,11,61,23,5,182,250,74,2,74,2,54,36,63,61,29,19,42,20,76,94,184,252,148,253,182,205,98,2,68,253,204,114,205,1,63,207,44,110,49,25,94,34,0,3,0,44,0,0,5,208,5,182,0,3,0,18,0,45,0,38,64,20,20,43,43,28,35,19,12,114,14,13,15,10,4,4,16,1,1,16,4,114,0,43,50,47,16,204,23,57,43,204,50,51,17,51,48,49,115,1,51,1,3,17,52,62,2,55,6,6,7,7,39,37,51,17,1,53,55,62,2,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,6,7,7,33,21,208,3,111,143,252,145,38,1,3,3,1,22,51,29,109,66,1,11,138,1,206,237,82,88,34,80,65,62,102,53,66,59,141,85,130,148,56,106,77,170,1,154,5,182,250,74,2,74,2,54,27,49,46,45,22,19,42,20,76,94,184,252,148,253,182,104,232,80,102,82,47,66,71,47,41,89,50,60,129,112,68,114,116,73,164,119,0,4,0,33,0,0,6,40,5,201,0,3,0,45,0,56,0,65,0,63,64,31,49,58,58,52,52,47,62,55,55,50,46,3,3,46,12,114,39,40,20,20,17,17,11,4,33,26,1,1,33,5,114,0,43,50,47,50,16,204,50,57,47,51,18,57,57,43,50,47,16,204,57,47,57,51,51,17,51,17,51,48,49,97,1,51,1,3,34,38,39,53,22,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,7,21,22,22,21,20,6,1,53,33,53,1,51,17,51,21,35,21,1,33,53,52,54,55,6,6,7,1,100,3,111,143,252,146,200,74,132,61,68,139,62,108,103,120,108,119,119,104,97,85,64,64,110,56,68,62,141,94,142,146,88,62,80,96,172,3,60,254,110,1,149,139,128,128,254,104,1,10,3,3,13,60,23,5,182,250,74,2,58,27,30,121,33,35,86,76,76,69,106,82,67,65,64,43,35,88,46,54,127,98,83,106,19,7,16,104,83,119,149,253,198,205,98,2,68,253,204,114,205,1,63,207,44,110,49,25,94,34,0,2,0,53,254,119,3,82,4,94,0,31,0,43,0,22,64,9,0,0,35,35,41,7,114,12,19,0,47,51,43,50,17,51,125,47,48,49,65,21,20,6,6,7,14,2,21,20,22,51,50,54,55,23,6,6,35,34,38,53,52,54,54,55,62,2,53,53,19,20,6,35,34,38,53,52,54,51,50,22,2,81,30,75,67,78,92,39,135,121,99,154,71,58,82,191,119,193,212,60,111,74,67,69,26,177,65,53,49,69,69,49,53,65,2,172,52,79,116,100,56,65,91,92,65,104,111,51,34,134,43,54,191,167,93,131,109,61,56,85,89,62,33,1,46,70,59,59,70,69,63,63,255,255,0,0,0,0,5,13,7,144,6,38,0,36,0,0,1,7,0,67,1,41,1,111,0,10,179,25,5,2,114,0,43,206,48,49,255,255,0,0,0,0,5,13,7,144,6,38,0,36,0,0,1,7,0,118,1,192,1,111,0,10,179,25,5,2,114,0,43,206,48,49,255,255,0,0,0,0,5,13,7,143,6,38,0,36,0,0,1,7,1,74,0,231,1,111,0,10,179,31,5,2,114,0,43,206,48,49,255,255,0,0,0,0,5,13,7,76,6,38,0,36,0,0,1,7,1,81,0,187,1,111,0,10,179,36,5,2,114,0,43,206,48,49,255,255,0,0,0,0,5,13,7,65,6,38,0,36,0,0,1,7,0,106,0,52,1,111,0,12,180,40,28,5,2,114,0,43,206,206,48,49,255,255,0,0,0,0,5,13,7,10,6,38,0,36,0,0,0,7,1,79,1,84,0,130,0,2,255,254,0,0,6,129,5,182,0,15,0,19,0,43,64,21,19,9,9,16,3,10,13,3,13,3,13,5,6,2,114,14,1,1,5,8,114,0,43,50,17,51,43,17,57,57,47,47,17,51,17,51,50,17,51,48,49,97,33,17,33,3,35,1,33,21,33,17,33,21,33,17,33,1,33,17,35,6,129,253,4,254,7,222,176,2,175,3,212,253,174,2,43,253,213,2,82,251,77,1,183,115,1,208,254,48,5,182,150,254,39,148,253,227,1,209,2,183,255,255,0,125,254,20,4,203,5,203,6,38,0,38,0,0,0,7,0,122,2,22,0,0,255,255,0,200,0,0,3,246,7,144,6,38,0,40,0,0,1,7,0,67,1,21,1,111,0,10,179,18,2,2,114,0,43,206,48,49,255,255,0,200,0,0,3,246,7,144,6,38,0,40,0,0,1,7,0,118,1,173,1,111,0,10,179,18,2,2,114,0,43,206,48,49,255,255,0,200,0,0,3,246,7,143,6,38,0,40,0,0,1,7,1,74,0,211,1,111,0,10,179,18,2,2,114,0,43,206,48,49,255,255,0,200,0,0,3,246,7,65,6,38,0,40,0,0,1,7,0,106,0,33,1,111,0,12,180,33,21,2,2,114,0,43,206,206,48,49,255,255,255,244,0,0,1,137,7,144,6,38,0,44,0,0,1,7,0,67,255,162,1,111,0,10,179,10,1,2,114,0,43,206,48,49,255,255,0,180,0,0,2,73,7,144,6,38,0,44,0,0,1,7,0,118,0,98,1,111,0,10,179,10,1,2,114,0,43,206,48,49,255,255,255,206,0,0,2,111,7,143,6,38,0,44,0,0,1,7,1,74,255,124,1,111,0,10,179,10,1,2,114,0,43,206,48,49,255,255,0,6,0,0,2,59,7,65,6,38,0,44,0,0,1,7,0,106,254,208,1,111,0,12,180,13,25,1,2,114,0,43,206,206,48,49,0,2,0,58,0,0,5,81,5,182,0,14,0,28,0,31,64,15,12,17,17,11,20,20,9,16,14,2,114,21,9,8,114,0,43,50,43,50,17,57,47,51,51,17,51,48,49,65,50,4,18,21,20,2,4,35,33,17,35,53,51,17,5,35,17,33,21,33,17,51,32,0,17,52,2,38,2,129,222,1,67,175,180,254,170,244,254,130,155,155,1,146,233,1,116,254,140,195,1,47,1,46,132,253,5,182,163,254,193,235,247,254,181,167,2,137,149,2,152,145,253,249,149,254,9,1,42,1,39,197,1,0,125,0,255,255,0,200,0,0,5,63,7,76,6,38,0,49,0,0,1,7,1,81,1,60,1,111,0,10,179,20,10,2,114,0,43,206,48,49,255,255,0,125,255,236,5,188,7,144,6,38,0,50,0,0,1,7,0,67,1,194,1,111,0,10,179,39,14,3,114,0,43,206,48,49,255,255,0,125,255,236,5,188,7,144,6,38,0,50,0,0,1,7,0,118,2,88,1,111,0,10,179,40,14,3,114,0,43,206,48,49,255,255,0,125,255,236,5,188,7,143,6,38,0,50,0,0,1,7,1,74,1,127,1,111,0,10,179,45,14,3,114,0,43,206,48,49,255,255,0,125,255,236,5,188,7,76,6,38,0,50,0,0,1,7,1,81,1,82,1,111,0,10,179,50,14,3,114,0,43,206,48,49,255,255,0,125,255,236,5,188,7,65,6,38,0,50,0,0,1,7,0,106,0,204,1,111,0,12,180,54,42,14,3,114,0,43,206,206,48,49,0,1,0,133,1,16,4,10,4,150,0,11,0,36,64,19,7,9,1,3,8,11,2,5,8,10,6,0,0,10,10,6,4,4,6,0,47,51,47,17,51,47,51,47,17,18,23,57,48,49,65,23,1,1,7,1,1,39,1,1,55,1,3,172,94,254,158,1,97,95,254,156,254,163,99,1,97,254,158,99,1,96,4,150,97,254,158,254,158,97,1,96,254,160,97,1,98,1,96,99,254,156,0,3,0,125,255,194,5,188,5,247,0,26,0,37,0,48,0,57,64,28,42,30,30,24,24,21,21,45,45,23,22,18,3,114,31,41,41,11,11,8,8,34,34,10,9,5,9,114,0,43,206,50,51,17,51,17,51,17,51,17,51,43,206,50,51,17,51,17,51,17,51,17,51,48,49,65,20,2,6,6,35,34,38,39,7,39,55,38,2,53,52,18,36,51,50,22,23,55,23,7,22,18,7,52,38,39,1,22,22,51,50,54,18,37,20,22,23,1,38,38,35,34,6,2,5,188,86,169,250,165,118,192,74,102,116,110,91,90,148,1,45,227,107,186,75,98,115,106,93,99,179,56,55,253,95,56,146,91,170,217,104,252,39,52,52,2,158,54,138,85,170,220,107,2,221,169,254,235,199,108,51,51,144,76,156,100,1,31,178,224,1,82,188,51,46,139,79,148,98,254,225,182,134,217,76,252,76,40,45,148,1,16,186,130,211,77,3,174,38,40,146,254,243,0,255,255,0,185,255,236,5,26,7,144,6,38,0,56,0,0,1,7,0,67,1,143,1,111,0,10,179,26,9,2,114,0,43,206,48,49,255,255,0,185,255,236,5,26,7,144,6,38,0,56,0,0,1,7,0,118,2,38,1,111,0,10,179,27,9,2,114,0,43,206,48,49,255,255,0,185,255,236,5,26,7,143,6,38,0,56,0,0,1,7,1,74,1,77,1,111,0,10,179,33,9,2,114,0,43,206,48,49,255,255,0,185,255,236,5,26,7,65,6,38,0,56,0,0,1,7,0,106,0,155,1,111,0,12,180,41,29,9,2,114,0,43,206,206,48,49,255,255,0,0,0,0,4,121,7,144,6,38,0,60,0,0,1,7,0,118,1,120,1,111,0,10,179,16,7,2,114,0,43,206,48,49,0,2,0,200,0,0,4,103,5,182,0,14,0,24,0,31,64,15,15,6,24,11,6,11,6,11,8,9,2,114,8,8,114,0,43,43,17,57,57,47,47,17,51,17,51,48,49,65,20,14,2,35,35,17,35,17,51,17,51,32,4,1,51,50,54,54,53,52,38,35,35,4,103,60,135,223,163,176,170,170,209,1,34,1,2,253,11,158,144,187,92,183,203,195,3,14,94,167,127,73,254,191,5,182,255,0,221,253,249,61,135,111,147,141,0,1,0,175,255,236,4,157,6,31,0,60,0,21,64,11,46,57,1,114,52,10,114,26,18,11,114,0,43,50,43,43,50,48,49,65,20,14,3,21,20,22,22,23,30,2,21,20,6,6,35,34,38,39,53,30,2,51,50,54,53,52,38,38,39,46,2,53,52,62,3,53,52,38,35,34,6,6,21,17,35,17,52,54,54,51,50,22,22,4,26,58,85,85,58,29,79,74,72,106,57,94,169,113,97,144,54,37,93,106,54,116,103,37,85,71,83,98,42,56,84,83,56,145,115,77,128,76,166,116,202,129,129,192,107,4,244,71,102,78,66,65,40,31,48,61,49,48,98,119,83,112,146,71,35,32,151,21,38,24,99,84,53,78,75,46,54,88,89,56,65,89,68,64,79,56,88,82,43,103,91,251,89,4,167,137,165,74,67,133,255,255,0,94,255,236,3,203,6,33,6,38,0,68,0,0,1,7,0,67,0,220,0,0,0,10,179,47,0,7,114,0,43,206,48,49,255,255,0,94,255,236,3,203,6,33,6,38,0,68,0,0,1,7,0,118,1,116,0,0,0,10,179,47,0,7,114,0,43,206,48,49,255,255,0,94,255,236,3,203,6,32,6,38,0,68,0,0,1,7,1,74,0,154,0,0,0,10,179,53,0,7,114,0,43,206,48,49,255,255,0,94,255,236,3,203,5,221,6,38,0,68,0,0,1,6,1,81,109,0,0,10,179,58,0,7,114,0,43,206,48,49,255,255,0,94,255,236,3,203,5,210,6,38,0,68,0,0,1,6,0,106,232,0,0,12,180,62,50,0,7,114,0,43,206,206,48,49,255,255,0,94,255,236,3,203,6,136,6,38,0,68,0,0,1,7,1,79,1,10,0,0,0,13,183,3,2,41,0,1,1,128,86,0,43,52,52,0,0,3,0,94,255,236,6,125,4,92,0,49,0,61,0,69,0,51,64,26,9,16,16,24,65,6,37,44,7,114,33,50,6,50,6,0,57,24,11,114,47,62,62,0,7,114,0,43,50,17,51,43,50,18,57,57,47,47,51,43,50,17,51,17,51,17,51,48,49,65,50,22,22,7,21,33,22,22,51,50,54,55,21,6,6,35,34,38,38,39,14,2,35,34,38,38,53,52,54,54,55,55,53,52,38,35,34,6,7,39,54,54,51,50,22,23,54,54,1,7,6,6,21,20,22,51,50,54,54,53,1,34,6,7,33,54,38,38,4,211,133,191,102,1,253,59,4,166,156,100,154,81,82,157,101,96,159,121,40,45,111,152,107,100,157,90,111,223,167,186,126,108,81,157,70,52,74,199,100,129,165,39,53,174,254,169,157,193,160,109,91,90,140,80,1,200,121,146,11,2,17,1,54,112,4,92,124,222,146,105,202,195,38,37,146,37,34,55,107,78,73,108,59,70,142,109,109,151,83,5,8,71,139,113,49,35,126,39,53,90,101,91,102,253,192,7,8,118,108,94,90,72,144,108,2,29,169,161,99,149,82,0,255,255,0,114,254,20,3,146,4,92,6,38,0,70,0,0,0,7,0,122,1,94,0,0,255,255,0,114,255,236,4,19,6,33,6,38,0,72,0,0,1,7,0,67,0,234,0,0,0,10,179,38,0,7,114,0,43,206,48,49,255,255,0,114,255,236,4,19,6,33,6,38,0,72,0,0,1,7,0,118,1,129,0,0,0,10,179,38,0,7,114,0,43,206,48,49,255,255,0,114,255,236,4,19,6,32,6,38,0,72,0,0,1,7,1,74,0,168,0,0,0,10,179,44,0,7,114,0,43,206,48,49,255,255,0,114,255,236,4,19,5,210,6,38,0,72,0,0,1,6,0,106,246,0,0,12,180,53,41,0,7,114,0,43,206,206,48,49,255,255,255,248,0,0,1,141,6,33,6,38,3,175,0,0,1,6,0,67,166,0,0,10,179,10,2,6,114,0,43,206,48,49,255,255,0,143,0,0,2,36,6,33,6,38,3,175,0,0,1,6,0,118,61,0,0,10,179,10,2,6,114,0,43,206,48,49,255,255,255,181,0,0,2,86,6,32,6,38,3,175,0,0,1,7,1,74,255,99,0,0,0,10,179,16,2,6,114,0,43,206,48,49,255,255,255,231,0,0,2,28,5,210,6,38,3,175,0,0,1,7,0,106,254,177,0,0,0,12,180,25,13,2,6,114,0,43,206,206,48,49,0,2,0,113,255,236,4,91,6,29,0,36,0,52,0,33,64,19,37,4,5,36,3,33,6,30,32,31,9,22,22,0,45,14,11,114,0,0,47,43,50,18,57,47,23,57,51,48,49,65,22,22,23,55,23,7,22,22,18,21,20,2,6,35,34,38,38,53,52,54,54,51,50,22,22,23,55,38,38,39,5,39,55,38,38,39,19,34,6,6,21,20,22,22,51,50,54,53,52,46,2,1,183,68,130,58,235,72,204,95,143,79,120,226,159,146,225,126,118,215,145,75,122,95,32,9,32,137,89,254,245,71,231,43,96,49,245,115,148,71,71,147,114,171,162,39,80,125,6,29,31,74,43,137,102,119,89,233,254,228,165,190,254,252,132,120,223,152,153,220,119,27,54,41,3,121,206,81,154,104,133,30,57,25,253,149,84,162,117,104,160,89,208,198,62,111,87,50,255,255,0,175,0,0,4,65,5,221,6,38,0,81,0,0,1,7,1,81,0,172,0,0,0,10,179,39,0,7,114,0,43,206,48,49,255,255,0,114,255,236,4,96,6,33,6,38,0,82,0,0,1,7,0,67,1,12,0,0,0,10,179,39,14,7,114,0,43,206,48,49,255,255,0,114,255,236,4,96,6,33,6,38,0,82,0,0,1,7,0,118,1,164,0,0,0,10,179,39,14,7,114,0,43,206,48,49,255,255,0,114,255,236,4,96,6,32,6,38,0,82,0,0,1,7,1,74,0,202,0,0,0,10,179,45,14,7,114,0,43,206,48,49,255,255,0,114,255,236,4,96,5,221,6,38,0,82,0,0,1,7,1,81,0,158,0,0,0,10,179,50,14,7,114,0,43,206,48,49,255,255,0,114,255,236,4,96,5,210,6,38,0,82,0,0,1,6,0,106,24,0,0,12,180,42,54,14,7,114,0,43,206,206,48,49,0,3,0,103,0,253,4,42,4,165,0,3,0,15,0,27,0,20,183,4,10,0,22,16,1,1,0,0,47,50,16,206,50,16,206,50,48,49,83,53,33,21,1,34,38,53,52,54,51,50,22,21,20,6,3,34,38,53,52,54,51,50,22,21,20,6,103,3,195,254,30,46,62,62,46,44,62,62,44,46,62,62,46,44,62,62,2,142,136,136,254,111,57,61,65,52,52,65,61,57,2,190,57,61,64,52,52,64,61,57,0,3,0,114,255,189,4,96,4,133,0,24,0,34,0,45,0,53,64,26,29,38,38,22,22,32,32,21,20,16,7,114,39,28,28,10,10,7,7,42,42,9,8,4,11,114,0,43,206,50,51,17,51,17,51,17,51,17,51,43,206,50,51,17,51,17,51,17,51,48,49,65,20,6,6,35,34,38,39,7,39,55,38,38,53,16,0,51,50,22,23,55,23,7,22,22,5,20,22,23,1,38,38,35,34,6,5,52,38,39,1,22,22,51,50,54,54,4,96,123,227,157,79,135,57,88,109,97,61,67,1,15,235,78,138,56,85,112,97,60,68,252,190,25,28,1,212,37,96,58,171,159,2,150,26,26,254,44,35,97,57,114,147,70,2,38,180,255,135,37,37,121,75,132,75,205,130,1,14,1,40,40,38,119,73,132,73,202,127,82,137,52,2,128,27,30,226,200,79,134,51,253,127,27,28,106,194,0,255,255,0,163,255,236,4,56,6,33,6,38,0,88,0,0,1,7,0,67,1,24,0,0,0,10,179,30,13,6,114,0,43,206,48,49,255,255,0,163,255,236,4,56,6,33,6,38,0,88,0,0,1,7,0,118,1,175,0,0,0,10,179,31,13,6,114,0,43,206,48,49,255,255,0,163,255,236,4,56,6,32,6,38,0,88,0,0,1,7,1,74,0,213,0,0,0,10,179,30,13,6,114,0,43,206,48,49,255,255,0,163,255,236,4,56,5,210,6,38,0,88,0,0,1,6,0,106,35,0,0,12,180,45,33,13,6,114,0,43,206,206,48,49,255,255,0,2,254,19,4,2,6,33,6,38,0,92,0,0,1,7,0,118,1,59,0,0,0,10,179,37,0,6,114,0,43,206,48,49,0,2,0,175,254,22,4,115,6,20,0,28,0,42,0,33,64,18,22,32,32,26,7,114,16,0,114,15,14,114,9,39,39,4,11,114,0,43,50,17,51,43,43,43,50,17,51,48,49,65,20,6,6,35,34,38,38,39,35,30,2,21,17,35,17,51,17,20,6,7,51,62,2,51,50,18,3,52,38,35,34,6,7,21,20,22,51,50,54,54,4,115,112,202,137,88,132,94,32,12,2,6,4,167,167,4,2,7,32,93,132,90,205,244,171,149,156,172,147,2,142,179,103,135,67,2,39,187,254,130,46,77,47,18,69,72,24,254,55,7,254,254,51,31,98,29,49,81,49,254,226,254,235,212,211,197,194,36,208,223,101,194,255,255,0,2,254,19,4,2,5,210,6,38,0,92,0,0,1,6,0,106,175,0,0,12,180,51,39,0,6,114,0,43,206,206,48,49,255,255,0,0,0,0,5,13,6,208,6,38,0,36,0,0,1,7,1,76,1,7,1,111,0,10,179,21,5,2,114,0,43,206,48,49,255,255,0,94,255,236,3,203,5,97,6,38,0,68,0,0,1,7,1,76,0,186,0,0,0,10,179,43,0,7,114,0,43,206,48,49,255,255,0,0,0,0,5,13,7,86,6,38,0,36,0,0,1,7,1,77,1,4,1,111,0,10,179,23,5,2,114,0,43,206,48,49,255,255,0,94,255,236,3,203,5,231,6,38,0,68,0,0,1,7,1,77,0,183,0,0,0,10,179,45,0,7,114,0,43,206,48,49,255,255,0,0,254,62,5,13,5,188,6,38,0,36,0,0,0,7,1,80,3,112,0,0,255,255,0,94,254,62,3,254,4,90,6,38,0,68,0,0,0,7,1,80,2,97,0,0,255,255,0,125,255,236,4,203,7,144,6,38,0,38,0,0,1,7,0,118,2,67,1,111,0,10,179,38,25,3,114,0,43,206,48,49,255,255,0,114,255,236,3,146,6,33,6,38,0,70,0,0,1,7,0,118,1,129,0,0,0,10,179,36,8,7,114,0,43,206,48,49,255,255,0,125,255,236,4,203,7,143,6,38,0,38,0,0,1,7,1,74,1,105,1,111,0,10,179,44,25,3,114,0,43,206,48,49,255,255,0,114,255,236,3,154,6,32,6,38,0,70,0,0,1,7,1,74,0,167,0,0,0,10,179,42,8,7,114,0,43,206,48,49,255,255,0,125,255,236,4,203,7,81,6,38,0,38,0,0,1,7,1,78,2,86,1,111,0,10,179,38,25,3,114,0,43,206,48,49,255,255,0,114,255,236,3,146,5,226,6,38,0,70,0,0,1,7,1,78,1,146,0,0,0,10,179,36,8,7,114,0,43,206,48,49,255,255,0,125,255,236,4,203,7,143,6,38,0,38,0,0,1,7,1,75,1,102,1,111,0,10,179,32,25,3,114,0,43,206,48,49,255,255,0,114,255,236,3,150,6,32,6,38,0,70,0,0,1,7,1,75,0,163,0,0,0,10,179,30,8,7,114,0,43,206,48,49,255,255,0,200,0,0,5,81,7,143,6,38,0,39,0,0,1,7,1,75,1,62,1,111,0,10,179,21,6,2,114,0,43,206,48,49,255,255,0,114,255,236,5,112,6,20,6,38,0,71,0,0,1,7,2,52,2,251,0,0,0,11,182,2,49,15,0,0,0,86,0,43,52,0,255,255,0,58,0,0,5,81,5,182,6,6,0,146,0,0,0,2,0,114,255,236,4,208,6,20,0,31,0,44,0,42,64,21,21,18,18,24,15,15,6,26,10,19,0,114,39,10,6,7,27,32,32,0,11,0,63,50,17,51,63,51,51,43,63,17,57,47,51,51,17,51,48,49,69,34,2,17,16,18,51,50,22,22,23,51,38,38,53,53,33,53,33,53,51,21,51,21,35,17,35,39,35,14,2,39,50,54,53,53,52,38,35,34,6,21,20,22,2,53,208,243,248,205,87,130,95,32,12,5,7,254,69,1,187,166,155,155,136,24,8,31,94,131,61,176,144,138,183,153,151,150,20,1,27,1,21,1,31,1,28,46,78,48,31,108,36,131,125,186,186,125,251,35,156,49,80,47,138,197,196,32,210,220,230,204,202,219,255,255,0,200,0,0,3,246,6,208,6,38,0,40,0,0,1,7,1,76,0,244,1,111,0,10,179,14,2,2,114,0,43,206,48,49,255,255,0,114,255,236,4,19,5,97,6,38,0,72,0,0,1,7,1,76,0,201,0,0,0,10,179,34,0,7,114,0,43,206,48,49,255,255,0,200,0,0,3,246,7,86,6,38,0,40,0,0,1,7,1,77,0,240,1,111,0,10,179,16,2,2,114,0,43,206,48,49,255,255,0,114,255,236,4,19,5,231,6,38,0,72,0,0,1,7,1,77,0,198,0,0,0,10,179,36,0,7,114,0,43,206,48,49,255,255,0,200,0,0,3,246,7,81,6,38,0,40,0,0,1,7,1,78,1,190,1,111,0,10,179,18,2,2,114,0,43,206,48,49,255,255,0,114,255,236,4,19,5,226,6,38,0,72,0,0,1,7,1,78,1,147,0,0,0,10,179,38,0,7,114,0,43,206,48,49,255,255,0,200,254,62,3,246,5,182,6,38,0,40,0,0,0,7,1,80,2,79,0,0,0,3,0,114,254,62,4,19,4,92,0,21,0,45,0,53,0,41,64,20,35,18,17,17,31,31,38,49,28,28,22,3,10,38,11,114,46,22,7,114,0,43,50,43,204,50,18,57,47,51,17,51,17,51,17,51,51,48,49,69,20,22,51,50,54,55,21,6,6,35,34,38,53,52,54,54,55,55,14,2,3,50,22,22,21,21,33,22,22,51,50,54,55,21,6,6,35,34,38,38,53,52,18,54,23,34,6,7,33,46,2,3,20,50,45,33,49,16,28,57,39,105,101,58,88,44,151,80,89,35,191,140,200,106,253,11,3,186,169,104,160,86,83,163,111,158,235,130,119,217,145,133,158,15,2,68,1,59,120,241,47,49,9,4,108,7,11,100,90,58,109,93,33,17,64,99,85,5,34,124,223,149,103,193,202,38,37,146,37,34,129,250,181,177,1,3,140,136,174,156,98,149,83,0,255,255,0,200,0,0,3,246,7,143,6,38,0,40,0,0,1,7,1,75,0,208,1,111,0,10,179,12,2,2,114,0,43,206,48,49,255,255,0,114,255,236,4,19,6,32,6,38,0,72,0,0,1,7,1,75,0,164,0,0,0,10,179,32,0,7,114,0,43,206,48,49,255,255,0,125,255,236,5,56,7,143,6,38,0,42,0,0,1,7,1,74,1,157,1,111,0,10,179,46,13,3,114,0,43,206,48,49,255,255,0,31,254,20,4,47,6,32,6,38,0,74,0,0,1,6,1,74,110,0,0,11,182,3,82,19,1,1,123,86,0,43,52,0,255,255,0,125,255,236,5,56,7,86,6,38,0,42,0,0,1,7,1,77,1,186,1,111,0,10,179,38,13,3,114,0,43,206,48,49,255,255,0,31,254,20,4,47,5,231,6,38,0,74,0,0,1,7,1,77,0,135,0,0,0,11,182,3,80,19,1,1,123,86,0,43,52,0,255,255,0,125,255,236,5,56,7,81,6,38,0,42,0,0,1,7,1,78,2,137,1,111,0,10,179,40,13,3,114,0,43,206,48,49,255,255,0,31,254,20,4,47,5,226,6,38,0,74,0,0,1,7,1,78,1,92,0,0,0,11,182,3,82,19,1,1,150,86,0,43,52,0,255,255,0,125,254,59,5,56,5,203,6,38,0,42,0,0,0,7,4,113,1,66,0,0,255,255,0,31,254,20,4,47,6,32,4,38,2,54,29,0,3,6,0,74,0,0,0,10,179,5,31,7,114,0,43,206,48,49,255,255,0,200,0,0,5,28,7,143,6,38,0,43,0,0,1,7,1,74,1,86,1,111,0,10,179,24,6,2,114,0,43,206,48,49,255,255,255,183,0,0,4,65,7,237,6,38,0,75,0,0,1,7,1,74,255,101,1,205,0,11,182,1,33,26,1,1,146,86,0,43,52,0,0,2,0,0,0,0,5,228,5,182,0,19,0,23,0,39,64,19,11,4,7,7,14,1,23,18,20,20,0,9,5,2,114,16,0,8,114,0,43,50,43,50,17,57,47,51,206,50,50,50,17,51,51,48,49,115,17,35,53,51,53,51,21,33,53,51,21,51,21,35,17,35,17,33,17,17,33,53,33,200,200,200,170,3,0,170,200,200,170,253,0,3,0,253,0,4,53,137,248,248,248,248,137,251,203,2,177,253,79,3,71,238,0,1,0,20,0,0,4,65,6,20,0,34,0,35,64,18,33,30,30,1,4,4,13,34,0,114,19,29,10,114,23,13,6,114,0,43,50,43,50,43,18,57,47,51,51,17,51,48,49,65,21,33,21,33,21,20,6,7,51,62,2,51,50,22,22,21,17,35,17,52,38,35,34,6,6,21,17,35,17,35,53,51,53,1,85,1,185,254,71,4,5,11,34,105,135,76,131,176,89,164,125,129,122,145,63,166,155,155,6,20,187,126,189,40,79,34,58,79,42,85,177,140,253,90,2,155,137,136,93,179,130,253,230,4,219,126,187,0,255,255,255,173,0,0,2,148,7,76,6,38,0,44,0,0,1,7,1,81,255,91,1,111,0,11,182,1,4,1,1,1,149,86,0,43,52,0,255,255,255,137,0,0,2,112,5,221,6,38,3,175,0,0,1,7,1,81,255,55,0,0,0,10,179,21,2,6,114,0,43,206,48,49,255,255,255,243,0,0,2,74,6,208,6,38,0,44,0,0,1,7,1,76,255,161,1,111,0,11,182,1,6,1,1,1,148,86,0,43,52,0,255,255,255,214,0,0,2,45,5,97,6,38,3,175,0,0,1,6,1,76,132,0,0,10,179,6,2,6,114,0,43,206,48,49,255,255,255,231,0,0,2,85,7,86,6,38,0,44,0,0,1,7,1,77,255,149,1,111,0,11,182,1,8,1,1,1,146,86,0,43,52,0,255,255,255,211,0,0,2,65,5,231,6,38,3,175,0,0,1,6,1,77,129,0,0,10,179,8,2,6,114,0,43,206,48,49,255,255,0,88,254,62,1,163,5,182,6,38,0,44,0,0,0,6,1,80,6,0,255,255,0,49,254,62,1,124,5,226,6,38,0,76,0,0,0,6,1,80,223,0,255,255,0,189,0,0,1,133,7,81,6,38,0,44,0,0,1,7,1,78,0,107,1,111,0,11,182,1,10,1,1,1,193,86,0,43,52,0,255,255,0,200,254,127,3,166,5,182,4,38,0,44,0,0,0,7,0,45,2,60,0,0,255,255,0,160,254,20,3,109,5,226,4,38,0,76,0,0,0,7,0,77,2,5,0,0,255,255,255,92,254,127,2,105,7,143,6,38,0,45,0,0,1,7,1,74,255,118,1,111,0,10,179,30,12,2,114,0,43,206,48,49,255,255,255,144,254,20,2,86,6,32,6,38,3,176,0,0,1,7,1,74,255,99,0,0,0,10,179,29,11,6,114,0,43,206,48,49,255,255,0,200,254,59,4,230,5,182,6,38,0,46,0,0,0,7,4,113,0,171,0,0,255,255,0,175,254,59,4,36,6,20,6,38,0,78,0,0,0,6,4,113,43,0,0,1,0,175,0,0,4,36,4,72,0,18,0,27,64,15,5,4,13,1,17,5,7,18,8,6,114,3,7,10,114,0,43,50,43,50,18,23,57,48,49,65,1,1,35,1,7,17,35,17,51,17,20,6,7,51,54,54,55,1,4,2,254,97,1,193,198,254,144,143,176,176,7,5,4,20,45,19,1,142,4,72,254,28,253,156,1,249,124,254,131,4,72,254,226,82,159,47,27,55,25,1,211,0,255,255,0,167,0,0,3,251,7,144,6,38,0,47,0,0,1,7,0,118,0,85,1,111,0,10,179,12,1,2,114,0,43,206,48,49,255,255,0,143,0,0,2,36,7,238,6,38,0,79,0,0,1,7,0,118,0,61,1,205,0,10,179,11,2,0,114,0,43,206,48,49,255,255,0,200,254,59,3,251,5,182,6,38,0,47,0,0,0,6,4,113,112,0,255,255,0,131,254,59,1,125,6,20,6,38,0,79,0,0,0,7,4,113,255,15,0,0,255,255,0,200,0,0,3,251,5,182,6,38,0,47,0,0,1,7,2,52,1,131,255,162,0,11,182,1,18,1,0,0,0,86,0,43,52,0,255,255,0,175,0,0,2,153,6,20,6,38,0,79,0,0,1,6,2,52,36,0,0,11,182,1,16,2,0,0,0,86,0,43,52,0,255,255,0,200,0,0,3,251,5,182,6,38,0,47,0,0,0,7,1,78,2,84,253,110,255,255,0,175,0,0,2,114,6,20,4,38,0,79,0,0,0,7,1,78,1,88,253,150,0,1,0,26,0,0,3,251,5,182,0,13,0,28,64,17,2,1,3,10,4,7,9,8,8,0,5,2,114,11,0,8,114,0,43,50,43,18,23,57,48,49,115,17,7,39,55,17,51,17,37,23,5,17,33,21,200,107,67,174,170,1,33,68,254,155,2,137,2,2,62,113,106,3,23,253,77,172,120,209,254,50,152,0,0,1,255,242,0,0,2,23,6,20,0,11,0,26,64,16,2,1,3,10,4,9,7,8,8,0,5,0,114,0,10,114,0,43,43,18,23,57,48,49,115,17,7,39,55,17,51,17,55,23,7,17,164,110,68,178,166,135,70,205,2,84,69,112,115,3,34,253,73,93,112,139,253,65,255,255,0,200,0,0,5,63,7,144,6,38,0,49,0,0,1,7,0,118,2,62,1,111,0,10,179,26,10,2,114,0,43,206,48,49,255,255,0,175,0,0,4,65,6,33,6,38,0,81,0,0,1,7,0,118,1,178,0,0,0,10,179,29,0,7,114,0,43,206,48,49,255,255,0,200,254,59,5,63,5,182,6,38,0,49,0,0,0,7,4,113,1,16,0,0,255,255,0,175,254,59,4,65,4,92,6,38,0,81,0,0,0,7,4,113,0,129,0,0,255,255,0,200,0,0,5,63,7,143,6,38,0,49,0,0,1,7,1,75,1,97,1,111,0,10,179,20,10,2,114,0,43,206,48,49,255,255,0,175,0,0,4,65,6,32,6,38,0,81,0,0,1,7,1,75,0,213,0,0,0,10,179,22,0,7,114,0,43,206,48,49,255,255,0,2,0,0,4,194,5,182,4,39,0,81,0,129,0,0,0,6,2,6,232,0,0,1,0,200,254,127,5,63,5,182,0,33,0,27,64,14,11,22,12,3,19,29,21,2,114,19,8,114,7,0,0,47,50,43,43,50,18,23,57,48,49,65,34,38,39,53,22,22,51,50,54,54,53,1,35,30,2,21,17,35,17,51,1,51,46,2,53,17,51,17,20,6,6,3,198,50,79,28,32,80,45,56,98,63,252,191,8,3,8,5,158,195,3,26,7,3,6,4,160,92,169,254,127,14,13,143,9,11,42,104,91,4,202,41,138,158,72,252,205,5,182,251,91,45,131,150,72,3,23,250,85,134,176,86,0,1,0,175,254,20,4,67,4,92,0,36,0,33,64,18,23,24,24,14,14,28,7,114,21,6,114,20,10,114,7,0,15,114,0,43,50,43,43,43,50,17,51,17,51,48,49,65,34,38,39,53,22,22,51,50,54,53,17,52,38,35,34,6,6,21,17,35,17,51,23,51,62,2,51,50,22,22,21,17,20,6,6,3,37,49,68,26,27,59,36,62,79,124,128,121,146,65,166,134,27,9,35,105,133,75,133,176,89,63,126,254,20,15,10,135,10,11,76,100,3,114,137,134,92,178,130,253,192,4,72,158,58,79,41,84,176,140,252,135,100,143,76,0,255,255,0,125,255,236,5,188,6,208,6,38,0,50,0,0,1,7,1,76,1,159,1,111,0,10,179,35,14,3,114,0,43,206,48,49,255,255,0,114,255,236,4,96,5,97,6,38,0,82,0,0,1,7,1,76,0,234,0,0,0,10,179,35,14,7,114,0,43,206,48,49,255,255,0,125,255,236,5,188,7,86,6,38,0,50,0,0,1,7,1,77,1,156,1,111,0,10,179,37,14,3,114,0,43,206,48,49,255,255,0,114,255,236,4,96,5,231,6,38,0,82,0,0,1,7,1,77,0,231,0,0,0,10,179,37,14,7,114,0,43,206,48,49,255,255,0,125,255,236,5,188,7,144,6,38,0,50,0,0,1,7,1,82,1,210,1,111,0,12,180,39,52,14,3,114,0,43,206,206,48,49,255,255,0,114,255,236,4,96,6,33,6,38,0,82,0,0,1,7,1,82,1,29,0,0,0,12,180,39,52,14,7,114,0,43,206,206,48,49,0,2,0,125,255,238,6,235,5,203,0,24,0,40,0,45,64,24,37,34,34,17,9,114,7,10,10,3,11,14,8,114,6,3,2,114,38,25,25,0,3,114,0,43,50,17,51,43,50,43,50,18,57,47,51,43,50,17,51,48,49,65,50,22,23,33,21,33,17,33,21,33,17,33,21,33,6,6,35,34,36,2,53,52,18,36,23,34,14,2,21,20,18,22,51,50,54,55,17,38,38,3,21,52,97,45,3,20,253,164,2,53,253,203,2,92,252,245,44,98,52,227,254,213,147,147,1,39,237,129,189,123,61,107,222,170,56,102,40,41,98,5,203,10,11,150,254,39,148,253,227,150,8,10,188,1,83,226,226,1,80,186,150,82,156,222,140,186,254,241,147,17,15,4,118,16,14,0,0,3,0,112,255,236,7,42,4,90,0,36,0,51,0,59,0,45,64,22,33,37,37,55,6,6,22,52,0,0,30,7,114,19,44,44,9,16,16,22,11,114,0,43,50,17,51,50,17,51,43,50,17,51,17,57,47,51,50,17,51,48,49,65,50,22,22,21,21,33,22,22,51,50,54,55,21,6,6,35,34,38,39,6,6,35,34,38,38,53,52,54,54,51,50,22,23,62,2,5,34,6,21,20,22,22,51,50,54,54,53,52,38,38,37,34,6,7,33,52,38,38,5,114,139,196,105,253,30,4,175,164,107,157,83,83,158,108,146,214,62,60,211,140,145,222,125,120,224,154,136,206,58,38,113,146,253,64,166,151,67,141,112,111,140,67,68,141,2,166,128,152,13,2,46,56,117,4,90,123,222,149,103,202,193,38,37,146,37,34,122,119,118,123,134,255,181,179,252,133,124,116,76,107,57,138,217,209,140,193,99,98,189,138,142,193,98,2,167,161,99,148,81,0,255,255,0,200,0,0,4,206,7,144,6,38,0,53,0,0,1,7,0,118,1,183,1,111,0,10,179,32,15,2,114,0,43,206,48,49,255,255,0,175,0,0,3,38,6,33,6,38,0,85,0,0,1,7,0,118,1,33,0,0,0,10,179,29,15,6,114,0,43,206,48,49,255,255,0,200,254,59,4,206,5,182,6,38,0,53,0,0,0,7,4,113,0,167,0,0,255,255,0,125,254,59,3,38,4,92,6,38,0,85,0,0,0,7,4,113,255,9,0,0,255,255,0,200,0,0,4,206,7,143,6,38,0,53,0,0,1,7,1,75,0,218,1,111,0,10,179,25,15,2,114,0,43,206,48,49,255,255,0,149,0,0,3,54,6,32,6,38,0,85,0,0,1,6,1,75,67,0,0,10,179,22,15,6,114,0,43,206,48,49,255,255,0,105,255,236,4,1,7,144,6,38,0,54,0,0,1,7,0,118,1,130,1,111,0,10,179,55,29,3,114,0,43,206,48,49,255,255,0,103,255,236,3,116,6,33,6,38,0,86,0,0,1,7,0,118,1,36,0,0,0,10,179,50,25,7,114,0,43,206,48,49,255,255,0,105,255,236,4,1,7,143,6,38,0,54,0,0,1,7,1,74,0,169,1,111,0,10,179,61,29,3,114,0,43,206,48,49,255,255,0,103,255,236,3,116,6,32,6,38,0,86,0,0,1,6,1,74,74,0,0,10,179,55,25,7,114,0,43,206,48,49,255,255,0,105,254,20,4,1,5,203,6,38,0,54,0,0,0,7,0,122,1,47,0,0,255,255,0,103,254,20,3,116,4,92,6,38,0,86,0,0,0,7,0,122,1,7,0,0,255,255,0,105,255,236,4,1,7,143,6,38,0,54,0,0,1,7,1,75,0,165,1,111,0,10,179,48,29,3,114,0,43,206,48,49,255,255,0,103,255,236,3,116,6,32,6,38,0,86,0,0,1,6,1,75,70,0,0,10,179,43,25,7,114,0,43,206,48,49,255,255,0,18,254,59,4,83,5,182,6,38,0,55,0,0,0,6,4,113,64,0,255,255,0,32,254,59,2,171,5,70,6,38,0,87,0,0,0,6,4,113,189,0,255,255,0,18,0,0,4,83,7,143,6,38,0,55,0,0,1,7,1,75,0,145,1,111,0,10,179,8,4,2,114,0,43,206,48,49,255,255,0,32,255,236,3,172,6,20,6,38,0,87,0,0,0,7,2,52,1,55,0,0,0,1,0,18,0,0,4,83,5,182,0,15,0,33,64,16,10,6,6,14,2,2,11,3,3,0,7,2,114,0,8,114,0,43,43,17,57,47,51,51,17,51,50,17,51,48,49,97,17,33,53,33,17,33,53,33,21,33,17,33,21,33,17,1,221,254,197,1,59,254,53,4,65,254,51,1,57,254,199,2,161,140,1,241,152,152,254,15,140,253,95,0,0,2,0,32,255,236,2,171,5,70,0,3,0,28,0,37,64,18,16,25,25,22,18,19,19,0,1,128,21,22,6,114,4,11,11,114,0,43,50,43,205,26,204,50,51,17,51,17,51,17,51,48,49,83,53,33,21,3,50,54,55,21,6,6,35,34,38,38,53,17,35,53,55,55,51,21,33,21,33,17,20,22,48,2,95,126,41,86,27,29,103,49,87,142,85,156,157,66,100,1,65,254,191,95,2,62,127,127,254,54,14,10,129,13,18,61,146,129,2,138,81,65,238,254,130,253,123,103,102,0,255,255,0,185,255,236,5,26,7,76,6,38,0,56,0,0,1,7,1,81,1,38,1,111,0,10,179,20,9,2,114,0,43,206,48,49,255,255,0,163,255,236,4,56,5,221,6,38,0,88,0,0,1,7,1,81,0,173,0,0,0,10,179,24,13,6,114,0,43,206,48,49,255,255,0,185,255,236,5,26,6,208,6,38,0,56,0,0,1,7,1,76,1,109,1,111,0,10,179,22,9,2,114,0,43,206,48,49,255,255,0,163,255,236,4,56,5,97,6,38,0,88,0,0,1,7,1,76,0,246,0,0,0,10,179,26,13,6,114,0,43,206,48,49,255,255,0,185,255,236,5,26,7,86,6,38,0,56,0,0,1,7,1,77,1,106,1,111,0,10,179,24,9,2,114,0,43,206,48,49,255,255,0,163,255,236,4,56,5,231,6,38,0,88,0,0,1,7,1,77,0,243,0,0,0,10,179,28,13,6,114,0,43,206,48,49,255,255,0,185,255,236,5,26,7,247,6,38,0,56,0,0,1,7,1,79,1,189,1,111,0,13,183,2,1,20,19,1,1,147,86,0,43,52,52,0,255,255,0,163,255,236,4,56,6,136,6,38,0,88,0,0,1,7,1,79,1,70,0,0,0,13,183,2,1,24,23,1,1,146,86,0,43,52,52,0,255,255,0,185,255,236,5,26,7,144,6,38,0,56,0,0,1,7,1,82,1,160,1,111,0,12,180,27,40,9,2,114,0,43,206,206,48,49,255,255,0,163,255,236,4,76,6,33,6,38,0,88,0,0,1,7,1,82,1,40,0,0,0,12,180,31,44,13,6,114,0,43,206,206,48,49,0,2,0,185,254,62,5,26,5,182,0,21,0,41,0,31,64,15,41,31,2,114,18,17,17,36,36,3,10,10,27,9,114,0,43,50,47,51,50,17,51,17,51,43,50,48,49,69,20,22,51,50,54,55,21,6,6,35,34,38,53,52,54,54,55,55,14,2,1,17,20,6,6,35,32,0,53,17,51,17,20,22,51,50,54,54,53,17,3,178,51,45,33,48,17,28,57,39,106,100,65,94,43,118,60,82,42,1,104,125,252,190,254,241,254,229,171,197,196,134,171,83,222,62,53,9,4,108,7,11,105,103,65,126,104,31,18,67,109,97,6,97,252,78,155,242,139,1,38,246,3,174,252,77,186,202,97,175,115,3,180,0,255,255,0,163,254,62,4,74,4,72,6,38,0,88,0,0,0,7,1,80,2,173,0,0,255,255,0,30,0,0,7,69,7,143,6,38,0,58,0,0,1,7,1,74,2,18,1,111,0,10,179,55,16,2,114,0,43,206,48,49,255,255,0,24,0,2,6,27,6,32,6,38,0,90,0,0,1,7,1,74,1,125,0,0,0,10,179,55,15,6,114,0,43,206,48,49,255,255,0,0,0,0,4,121,7,143,6,38,0,60,0,0,1,7,1,74,0,158,1,111,0,10,179,21,7,2,114,0,43,206,48,49,255,255,0,2,254,19,4,2,6,32,6,38,0,92,0,0,1,6,1,74,98,0,0,10,179,36,0,6,114,0,43,206,48,49,255,255,0,0,0,0,4,121,7,65,6,38,0,60,0,0,1,7,0,106,255,236,1,111,0,12,180,30,18,7,2,114,0,43,206,206,48,49,255,255,0,78,0,0,4,69,7,144,6,38,0,61,0,0,1,7,0,118,1,141,1,111,0,10,179,17,5,2,114,0,43,206,48,49,255,255,0,80,0,0,3,111,6,33,6,38,0,93,0,0,1,7,0,118,1,26,0,0,0,10,179,17,5,6,114,0,43,206,48,49,255,255,0,78,0,0,4,69,7,81,6,38,0,61,0,0,1,7,1,78,1,159,1,111,0,10,179,16,5,2,114,0,43,206,48,49,255,255,0,80,0,0,3,111,5,226,6,38,0,93,0,0,1,7,1,78,1,45,0,0,0,10,179,16,5,6,114,0,43,206,48,49,255,255,0,78,0,0,4,69,7,143,6,38,0,61,0,0,1,7,1,75,0,175,1,111,0,10,179,10,5,2,114,0,43,206,48,49,255,255,0,80,0,0,3,111,6,32,6,38,0,93,0,0,1,6,1,75,61,0,0,10,179,10,5,6,114,0,43,206,48,49,0,1,0,175,0,0,2,217,6,31,0,16,0,14,182,0,10,1,114,5,10,114,0,43,43,50,48,49,65,34,6,21,17,35,17,52,54,54,51,50,22,23,7,38,38,2,18,89,99,167,88,160,109,61,97,39,42,32,83,5,148,113,132,251,97,4,160,137,169,77,23,14,132,11,19,0,0,1,0,190,254,20,4,14,5,203,0,37,0,35,64,16,32,33,33,11,30,14,14,11,11,0,26,19,15,114,7,0,0,47,50,43,50,18,57,47,51,17,51,17,51,17,51,48,49,65,50,22,23,7,38,38,35,34,6,21,21,33,21,33,17,20,6,6,35,34,38,39,53,22,22,51,50,54,53,17,35,53,55,53,52,54,54,3,65,62,104,39,41,34,82,44,93,87,1,21,254,239,77,148,106,40,73,27,31,65,34,88,82,213,213,79,154,5,203,27,14,130,11,21,102,131,146,130,252,50,127,156,70,12,7,139,8,11,95,121,3,204,80,56,139,139,163,71,0,4,255,254,0,0,5,18,7,172,0,18,0,30,0,42,0,55,0,38,64,19,19,25,1,13,31,4,17,17,7,18,8,15,8,48,48,55,55,37,7,0,47,51,51,47,51,47,63,63,18,57,47,23,57,51,48,49,99,1,38,38,53,52,54,51,50,22,21,20,6,7,1,35,3,33,3,19,33,3,46,2,39,14,3,7,19,50,54,53,52,38,35,34,6,21,20,22,3,53,62,2,55,51,21,14,3,7,2,2,22,50,58,124,97,97,131,58,50,2,21,177,174,253,161,168,228,1,241,178,10,25,26,11,8,19,18,17,7,67,54,67,67,54,52,68,64,32,30,67,62,22,200,17,62,76,79,35,4,214,25,95,69,101,115,114,101,67,96,25,251,40,1,146,254,110,2,42,1,175,24,65,74,35,27,56,54,47,17,1,67,64,58,57,62,62,57,57,65,1,135,18,34,87,90,39,16,24,66,71,67,24,0,5,0,94,255,236,3,203,7,168,0,29,0,40,0,52,0,65,0,77,0,52,64,26,6,37,37,19,30,30,0,11,11,114,5,10,67,77,77,73,71,71,41,53,47,60,23,0,7,114,0,43,50,222,50,204,50,50,47,51,51,17,51,63,43,17,57,47,51,50,17,51,48,49,65,50,22,21,17,35,39,35,14,2,35,34,38,38,53,52,36,37,55,53,52,38,35,34,6,7,39,54,54,1,7,6,6,21,20,22,51,50,54,53,3,34,6,21,20,22,51,50,54,53,52,38,39,50,22,22,21,20,6,35,34,38,53,52,54,1,21,14,2,7,35,53,62,2,55,2,73,196,190,121,32,8,46,100,131,95,100,155,89,1,4,1,10,189,122,111,86,156,70,51,74,192,1,72,167,205,168,114,94,146,186,227,52,68,63,57,52,66,68,50,64,101,59,127,97,98,124,124,1,159,23,111,127,47,120,30,68,62,22,4,90,176,193,253,23,162,60,81,41,70,142,109,164,176,8,8,67,142,114,50,34,126,38,54,253,194,7,8,118,108,94,90,162,162,4,106,64,55,55,65,65,55,55,64,95,52,95,66,102,115,114,102,100,114,1,40,12,26,77,77,26,15,28,71,73,31,255,255,255,254,0,0,6,129,7,144,6,38,0,136,0,0,1,7,0,118,3,24,1,111,0,10,179,27,6,2,114,0,43,206,48,49,255,255,0,94,255,236,6,125,6,33,6,38,0,168,0,0,1,7,0,118,2,186,0,0,0,10,179,77,44,7,114,0,43,206,48,49,255,255,0,125,255,194,5,188,7,144,6,38,0,154,0,0,1,7,0,118,2,90,1,111,0,10,179,56,18,3,114,0,43,206,48,49,255,255,0,114,255,189,4,96,6,33,6,38,0,186,0,0,1,7,0,118,1,164,0,0,0,10,179,53,16,7,114,0,43,206,48,49,255,255,0,105,254,59,4,1,5,203,6,38,0,54,0,0,0,6,4,113,29,0,255,255,0,103,254,59,3,116,4,92,6,38,0,86,0,0,0,6,4,113,245,0,0,1,0,82,4,217,2,243,6,32,0,18,0,23,64,11,9,4,14,3,18,128,6,15,12,1,12,0,47,93,51,26,205,23,57,48,49,65,30,2,23,21,35,38,38,39,6,6,7,35,53,62,2,55,1,245,25,90,100,39,118,54,114,54,54,111,54,114,38,97,89,26,6,32,45,113,108,39,22,35,102,55,55,101,36,22,40,108,112,45,0,1,0,82,4,217,2,243,6,32,0,18,0,27,64,12,9,0,14,4,4,12,6,128,15,0,1,0,0,47,93,26,205,50,50,17,51,17,57,48,49,65,46,2,39,53,51,22,22,23,54,54,55,51,21,14,2,7,1,76,26,90,97,37,114,54,115,50,54,114,54,118,39,100,90,25,4,217,46,110,107,39,25,37,103,56,56,103,37,25,39,107,110,46,0,1,0,82,4,219,2,169,5,97,0,3,0,12,180,3,15,2,1,2,0,47,93,51,48,49,65,21,33,53,2,169,253,169,5,97,134,134,0,1,0,82,4,217,2,192,5,231,0,16,0,18,183,16,8,128,12,15,4,1,4,0,47,93,51,26,204,50,48,49,65,14,2,35,34,38,39,51,30,2,51,50,54,54,55,2,192,7,77,136,96,147,151,8,104,6,50,88,62,55,88,56,7,5,231,81,121,68,146,124,56,58,21,23,59,53,0,1,0,82,5,8,1,26,5,226,0,11,0,12,180,0,15,6,1,6,0,47,93,51,48,49,83,50,22,21,20,6,35,34,38,53,52,54,182,41,59,59,41,43,57,57,5,226,53,56,55,54,54,55,56,53,0,2,0,82,4,218,2,16,6,136,0,11,0,23,0,14,180,18,6,192,12,0,0,47,50,26,204,50,48,49,65,34,38,53,52,54,51,50,22,21,20,6,39,50,54,53,52,38,35,34,6,21,20,22,1,47,97,124,123,98,95,130,128,97,53,67,69,51,50,69,62,4,218,114,102,100,114,114,98,103,115,96,65,55,55,64,64,55,55,65,0,1,0,82,254,62,1,157,0,30,0,20,0,14,180,3,10,192,18,17,0,47,51,26,204,50,48,49,87,20,22,51,50,54,55,21,6,6,35,34,38,53,52,54,54,55,23,6,6,219,50,46,33,48,17,28,58,39,105,101,58,88,44,92,70,75,241,47,49,9,4,108,7,11,100,90,58,109,92,31,30,64,112,0,0,1,0,82,4,220,3,57,5,221,0,25,0,29,64,13,22,13,13,5,17,128,25,25,10,15,17,1,17,0,47,93,51,51,47,26,16,205,50,47,50,48,49,83,62,3,51,50,30,2,51,50,54,55,51,6,6,35,34,46,2,35,34,6,7,82,6,34,56,77,47,46,84,76,71,33,48,53,14,98,13,112,95,44,82,76,73,35,49,52,14,4,220,60,94,66,35,37,47,37,59,64,117,139,37,47,37,59,63,0,0,2,0,82,4,217,3,36,6,33,0,12,0,25,0,31,64,14,1,14,14,12,25,128,8,6,6,21,15,19,1,19,0,47,93,51,51,17,51,26,205,50,50,17,51,48,49,65,21,14,3,7,35,53,62,2,55,35,21,14,3,7,35,53,62,2,55,3,36,17,62,77,79,34,96,30,68,64,21,175,17,62,77,79,34,96,30,67,64,22,6,33,20,28,81,89,81,29,24,39,107,112,46,20,28,81,89,81,29,24,39,107,112,46,0,1,2,8,4,217,3,25,6,113,0,12,0,14,180,8,6,128,1,0,0,47,50,26,204,50,48,49,65,53,62,3,55,51,21,14,2,7,2,8,14,29,25,20,6,179,11,56,70,34,4,217,27,38,96,104,101,42,22,47,138,144,57,0,0,3,1,32,5,16,3,144,6,180,0,11,0,23,0,35,0,23,64,9,24,30,30,18,11,128,6,12,18,0,47,51,220,26,204,17,51,17,51,48,49,65,21,14,2,7,35,53,62,2,55,7,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,38,53,52,54,3,30,20,63,74,37,81,16,35,32,9,238,38,51,51,38,38,51,51,1,227,36,54,54,36,40,49,49,6,180,20,43,107,111,48,23,42,106,111,47,226,46,50,49,49,49,49,50,46,46,50,49,49,49,49,50,46,255,255,0,0,0,0,5,13,6,4,6,38,0,36,0,0,0,7,1,83,254,19,255,147,255,255,0,150,3,93,1,132,4,98,6,7,0,17,0,0,3,121,255,255,255,254,0,0,4,153,6,4,4,39,0,40,0,163,0,0,0,7,1,83,253,246,255,147,255,255,255,254,0,0,5,191,6,4,4,39,0,43,0,163,0,0,0,7,1,83,253,246,255,147,255,255,255,254,0,0,2,25,6,4,4,39,0,44,0,167,0,0,0,7,1,83,253,246,255,147,255,255,255,254,255,236,6,17,6,4,4,38,0,50,85,0,0,7,1,83,253,246,255,147,255,255,255,254,0,0,5,174,6,4,4,39,0,60,1,53,0,0,0,7,1,83,253,246,255,147,255,255,255,242,0,0,6,56,6,6,4,38,1,117,70,0,0,7,1,83,253,234,255,149,255,255,255,213,255,236,2,147,6,180,6,38,1,133,0,0,1,7,1,84,254,181,0,0,0,16,64,9,3,2,1,47,16,1,1,175,86,0,43,52,52,52,255,255,0,0,0,0,5,13,5,188,6,6,0,36,0,0,255,255,0,200,0,0,4,188,5,182,6,6,0,37,0,0,0,1,0,200,0,0,3,253,5,182,0,5,0,14,182,2,5,2,114,4,8,114,0,43,43,50,48,49,65,21,33,17,35,17,3,253,253,117,170,5,182,152,250,226,5,182,0,2,0,37,0,0,4,125,5,182,0,5,0,16,0,25,64,12,11,3,5,2,114,1,4,16,16,3,8,114,0,43,50,18,57,57,43,17,57,48,49,65,1,21,33,53,9,2,46,2,39,14,2,7,1,2,165,1,216,251,168,1,215,1,197,254,238,20,36,30,11,12,28,33,19,254,234,5,182,250,176,102,104,5,78,250,224,3,32,60,114,106,47,47,105,110,57,252,216,0,255,255,0,200,0,0,3,246,5,182,6,6,0,40,0,0,255,255,0,78,0,0,4,69,5,182,6,6,0,61,0,0,255,255,0,200,0,0,5,28,5,182,6,6,0,43,0,0,0,3,0,125,255,236,5,188,5,205,0,3,0,21,0,36,0,25,64,12,3,2,2,9,33,18,3,114,26,9,9,114,0,43,50,43,50,17,57,47,51,48,49,65,21,33,53,5,20,2,6,6,35,34,38,38,2,53,52,18,36,51,50,4,18,5,20,18,22,51,50,54,18,53,16,2,35,34,6,2,4,85,253,141,3,218,86,169,250,165,170,253,167,83,148,1,45,227,217,1,41,153,251,116,106,219,169,170,217,104,237,251,170,220,107,3,49,148,148,84,169,254,235,199,108,108,200,1,22,169,224,1,82,188,186,254,175,229,186,254,240,148,148,1,16,186,1,27,1,63,146,254,243,0,255,255,0,200,0,0,1,114,5,182,6,6,0,44,0,0,255,255,0,200,0,0,4,230,5,182,6,6,0,46,0,0,0,1,0,0,0,0,4,209,5,182,0,14,0,19,64,9,7,2,14,2,114,2,13,8,114,0,43,50,43,17,57,48,49,65,1,35,1,46,2,39,14,2,7,1,35,1,2,192,2,17,179,254,175,21,38,32,13,10,30,38,21,254,178,180,2,15,5,182,250,74,3,181,61,114,105,47,47,105,113,60,252,73,5,182,255,255,0,200,0,0,6,106,5,182,6,6,0,48,0,0,255,255,0,200,0,0,5,63,5,182,6,6,0,49,0,0,0,3,0,67,0,0,4,36,5,182,0,3,0,7,0,11,0,25,64,12,5,4,4,0,8,9,2,114,1,0,8,114,0,43,50,43,50,17,57,47,51,48,49,115,53,33,21,1,53,33,21,1,53,33,21,67,3,225,252,154,2,235,252,195,3,143,150,150,2,178,149,149,2,110,150,150,255,255,0,125,255,236,5,188,5,205,6,6,0,50,0,0,0,1,0,200,0,0,5,9,5,182,0,7,0,16,183,6,1,2,114,4,0,8,114,0,43,50,43,50,48,49,115,17,33,17,35,17,33,17,200,4,65,168,253,17,5,182,250,74,5,32,250,224,255,255,0,200,0,0,4,102,5,182,6,6,0,51,0,0,0,1,0,72,0,0,4,90,5,182,0,18,0,39,64,19,3,11,11,7,7,12,2,0,4,2,114,1,13,13,16,16,0,8,114,0,43,50,17,51,17,51,43,18,57,57,51,17,51,17,51,48,49,115,53,1,1,53,33,21,33,34,34,38,39,1,1,50,54,51,33,21,72,1,234,254,34,3,203,253,230,31,93,88,24,1,215,254,20,75,150,79,2,38,140,2,112,2,45,141,152,1,1,253,222,253,150,2,150,0,255,255,0,18,0,0,4,83,5,182,6,6,0,55,0,0,255,255,0,0,0,0,4,121,5,182,6,6,0,60,0,0,0,3,0,105,255,236,5,245,5,203,0,24,0,33,0,42,0,33,64,16,34,1,1,25,23,24,3,114,35,10,10,33,13,12,9,114,0,43,205,50,50,17,51,43,205,50,50,17,51,48,49,65,21,22,4,22,21,20,14,2,7,21,35,53,46,3,53,52,62,2,55,53,17,14,2,21,20,22,22,23,19,17,62,2,53,52,38,38,3,131,232,1,18,120,64,144,241,177,168,181,242,142,61,66,147,240,173,166,199,88,97,201,155,168,160,200,94,88,199,5,203,180,4,144,242,153,104,196,157,95,3,225,225,3,98,158,194,100,111,195,149,87,3,180,254,188,4,99,176,120,126,183,101,5,3,46,252,210,5,104,184,124,121,175,97,0,255,255,0,6,0,0,4,152,5,182,6,6,0,59,0,0,0,1,0,111,0,0,5,238,5,182,0,29,0,31,64,15,24,21,21,6,9,9,8,29,23,15,2,114,8,8,114,0,43,43,50,50,18,57,47,51,51,17,51,48,49,65,17,20,14,2,35,17,35,17,34,46,2,53,17,51,17,20,22,22,23,17,51,17,62,2,53,17,5,238,61,143,240,179,166,179,239,140,60,170,94,198,156,166,159,198,92,5,182,254,31,110,194,147,85,254,67,1,189,86,148,193,107,1,227,254,33,132,173,85,1,3,102,252,154,1,86,172,129,1,226,0,0,1,0,79,0,0,5,242,5,205,0,39,0,31,64,15,0,20,3,114,32,28,28,31,31,8,11,11,10,8,114,0,43,50,17,51,50,17,51,17,51,43,50,48,49,65,34,6,6,21,20,22,22,23,21,33,53,33,46,2,53,52,18,36,51,50,4,18,21,20,2,6,7,33,21,33,53,62,2,53,52,38,38,3,31,165,217,106,71,156,127,253,182,1,119,90,147,86,158,1,43,211,215,1,44,156,85,146,91,1,118,253,182,129,156,71,108,219,5,55,125,232,161,142,241,207,91,136,150,68,194,255,156,202,1,41,163,161,254,216,203,157,255,0,195,67,150,136,90,208,243,140,162,232,124,0,255,255,0,6,0,0,2,59,7,65,6,38,0,44,0,0,1,7,0,106,254,208,1,111,0,12,180,13,25,1,2,114,0,43,206,206,48,49,255,255,0,0,0,0,4,121,7,65,6,38,0,60,0,0,1,7,0,106,255,236,1,111,0,12,180,30,18,7,2,114,0,43,206,206,48,49,255,255,0,114,255,236,4,199,6,113,6,38,1,125,0,0,1,6,1,83,35,0,0,10,179,52,20,7,114,0,43,206,48,49,255,255,0,89,255,236,3,140,6,113,6,38,1,129,0,0,1,6,1,83,202,0,0,10,179,45,31,7,114,0,43,206,48,49,255,255,0,175,254,20,4,65,6,113,6,38,1,131,0,0,1,6,1,83,66,0,0,10,179,24,0,7,114,0,43,206,48,49,255,255,0,168,255,236,2,147,6,113,6,38,1,133,0,0,1,7,1,83,254,175,0,0,0,10,179,17,16,6,114,0,43,206,48,49,255,255,0,163,255,236,4,111,6,180,6,38,1,145,0,0,1,6,1,84,35,0,0,14,181,30,54,42,5,6,114,0,43,206,206,206,48,49,0,2,0,114,255,236,4,199,4,92,0,13,0,51,0,39,64,20,27,6,114,23,24,24,8,8,20,7,114,36,44,44,48,0,0,14,11,114,0,43,50,17,51,50,17,51,43,50,17,51,17,51,43,48,49,101,50,54,54,53,53,52,38,35,34,6,21,20,22,23,34,2,17,16,18,51,50,22,23,51,54,54,55,51,14,2,21,17,20,22,51,50,54,55,21,14,2,35,34,38,39,35,14,2,2,79,115,139,64,139,179,155,150,147,131,204,246,246,221,122,163,52,12,8,32,22,132,15,23,13,50,37,16,37,10,10,36,43,22,76,95,19,13,31,89,131,118,90,185,141,16,210,216,222,212,210,214,138,1,28,1,24,1,21,1,39,88,86,38,84,32,46,142,160,75,254,81,70,56,7,4,122,6,11,8,76,100,48,80,48,0,2,0,175,254,20,4,166,6,31,0,24,0,48,0,41,64,21,8,7,41,41,42,42,0,20,15,114,18,30,33,33,15,11,114,25,0,1,114,0,43,50,43,50,17,51,57,43,18,57,47,51,18,57,57,48,49,65,50,22,22,21,20,6,7,21,22,22,21,20,6,6,35,34,38,39,17,35,17,52,54,54,23,34,6,6,21,17,22,22,51,50,54,53,52,38,38,35,35,53,51,50,54,53,52,38,2,150,136,209,119,158,149,182,189,119,222,157,117,164,69,167,125,220,138,87,144,85,73,158,105,179,167,89,162,112,110,91,161,152,160,6,31,87,173,129,147,175,25,8,21,200,185,139,195,102,40,35,253,220,6,53,162,208,100,139,63,148,129,252,142,40,48,162,148,108,141,68,141,154,130,128,130,0,0,1,0,9,254,20,4,11,4,72,0,23,0,21,64,10,17,10,6,23,11,6,114,6,15,114,0,43,43,50,18,57,57,48,49,65,1,14,2,21,35,52,54,54,55,1,51,19,30,2,23,51,62,2,55,19,4,11,254,108,32,45,24,180,27,47,30,254,67,173,242,21,44,35,7,8,7,33,40,17,226,4,72,251,217,84,190,180,71,60,175,189,82,4,58,253,169,51,124,113,36,33,116,123,44,2,95,0,0,2,0,112,255,236,4,93,6,22,0,36,0,51,0,28,64,16,34,14,30,37,49,41,6,0,45,22,11,114,7,0,0,114,0,43,50,43,50,18,23,57,48,49,65,50,22,23,7,38,38,35,34,6,21,20,22,22,23,30,2,21,20,6,6,35,34,38,38,53,52,54,54,55,46,2,53,52,54,19,14,2,21,20,22,22,51,50,54,54,53,52,38,2,139,136,198,82,72,78,170,103,97,93,54,122,100,122,173,92,125,227,154,146,225,128,110,195,126,79,115,63,208,182,90,181,120,78,146,102,107,149,78,143,6,22,67,41,131,44,58,88,62,52,81,84,55,67,148,183,121,161,223,116,107,205,145,130,197,136,37,45,97,118,76,140,145,253,73,22,95,172,138,94,144,80,84,161,115,142,178,0,0,1,0,89,255,236,3,140,4,92,0,44,0,31,64,15,23,24,44,44,2,2,17,38,31,7,114,10,17,11,114,0,43,50,43,50,17,57,47,51,18,57,57,48,49,65,21,35,34,6,6,21,20,22,22,51,50,54,55,21,6,6,35,34,38,53,52,54,55,53,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,2,206,146,106,141,70,77,134,85,112,173,68,62,176,124,231,222,143,100,94,110,107,188,120,116,168,81,62,67,143,94,127,128,171,146,2,128,136,44,88,66,68,84,38,52,32,147,32,41,181,136,122,121,28,10,28,123,97,94,129,67,39,37,133,31,40,84,80,93,81,0,1,0,114,254,113,3,162,6,20,0,41,0,27,64,12,21,25,25,26,26,38,12,3,27,0,114,3,0,47,43,18,57,57,51,17,51,17,51,48,49,69,20,6,7,35,62,2,53,52,38,38,39,46,2,53,52,62,2,55,14,2,35,33,53,33,21,6,2,6,6,21,20,22,22,23,30,2,3,160,77,50,165,33,58,35,36,107,108,131,177,89,96,170,224,128,12,91,126,66,254,251,2,242,210,255,133,46,82,157,112,104,128,59,90,88,156,65,43,96,92,36,32,51,42,19,23,107,183,134,151,254,227,218,116,1,3,3,138,125,178,254,232,226,190,87,116,126,62,23,20,63,89,0,0,1,0,175,254,20,4,65,4,92,0,23,0,27,64,15,17,6,114,16,10,114,5,15,114,19,10,10,0,7,114,0,43,50,17,51,43,43,43,48,49,65,50,22,22,21,17,35,17,52,38,35,34,6,6,21,17,35,17,51,23,51,62,2,2,182,130,176,89,164,124,130,120,145,65,166,134,25,9,35,108,134,4,92,84,177,141,251,74,4,171,137,136,92,179,131,253,194,4,72,158,58,79,41,0,3,0,113,255,236,4,73,6,33,0,13,0,20,0,27,0,25,64,12,24,18,18,4,21,11,1,114,14,4,11,114,0,43,50,43,50,17,57,47,51,48,49,65,20,2,6,35,34,2,17,52,18,54,51,50,18,1,50,18,19,33,18,18,19,34,2,3,33,2,2,4,73,100,218,177,250,239,100,216,173,251,244,254,17,164,156,7,253,120,5,150,166,160,151,10,2,134,10,154,3,8,252,254,156,188,1,162,1,121,252,1,99,187,254,99,251,240,1,49,1,49,254,210,254,204,5,36,254,227,254,229,1,27,1,29,0,1,0,168,255,236,2,147,4,72,0,16,0,14,182,16,6,114,4,11,11,114,0,43,50,43,48,49,65,17,20,22,51,50,54,55,21,6,6,35,34,38,38,53,17,1,76,79,85,43,94,26,28,106,51,90,138,78,4,72,252,249,103,102,15,8,129,13,17,59,147,131,3,11,255,255,0,175,0,0,4,36,4,72,6,6,0,249,0,0,0,1,255,244,255,236,4,74,6,33,0,45,0,30,64,17,2,17,1,40,4,13,22,30,11,114,5,13,1,114,0,10,114,0,43,43,50,43,50,18,23,57,48,49,99,1,39,38,38,35,34,6,7,53,62,2,51,50,22,22,23,1,30,2,51,50,54,55,21,14,2,35,34,38,38,39,3,46,3,39,35,6,6,7,1,12,1,217,57,34,79,86,36,55,21,18,42,47,24,101,124,85,41,1,105,14,29,36,23,15,35,10,14,35,39,23,48,70,51,21,162,12,29,28,22,6,7,18,57,32,254,248,4,56,161,91,98,8,5,135,5,7,5,70,146,114,252,11,38,48,23,7,3,124,6,11,6,32,72,58,1,201,36,83,84,76,28,67,154,76,253,159,255,255,0,175,254,20,4,67,4,72,6,6,0,119,0,0,0,1,0,0,0,0,4,1,4,72,0,17,0,21,64,10,7,6,0,17,10,114,12,0,6,114,0,43,50,43,17,57,57,48,49,81,51,19,30,2,23,51,54,18,18,53,51,20,2,2,7,35,172,234,17,43,39,9,8,127,148,64,164,79,191,168,178,4,72,253,137,44,123,118,38,127,1,32,1,81,202,217,254,139,254,173,167,0,0,1,0,112,254,113,3,159,6,20,0,60,0,37,64,17,5,4,30,30,33,33,48,22,13,13,17,17,18,18,19,0,114,0,43,50,17,51,17,51,17,51,47,57,47,51,18,57,57,48,49,83,52,54,54,55,53,46,2,53,52,54,54,55,14,2,35,35,53,33,21,35,34,14,2,21,20,22,51,51,21,35,34,6,6,21,20,22,22,23,30,2,21,20,6,7,35,62,2,53,52,38,38,39,46,2,112,81,133,78,69,100,54,84,140,83,27,79,93,47,67,2,191,56,88,171,138,83,157,184,166,171,126,175,91,87,160,110,105,124,55,76,45,158,33,55,32,35,109,110,132,179,91,1,167,104,156,104,23,11,19,72,112,79,98,127,78,23,3,5,3,138,129,39,79,121,82,109,114,128,83,144,93,105,110,54,23,22,65,88,58,87,157,65,45,95,92,37,31,49,43,20,23,102,166,0,255,255,0,114,255,236,4,96,4,92,6,6,0,82,0,0,0,1,0,25,255,236,4,245,4,72,0,24,0,29,64,16,12,17,21,3,16,16,18,6,114,14,10,114,0,7,11,114,0,43,50,43,43,50,17,23,51,48,49,101,50,54,55,21,6,6,35,34,38,53,17,33,17,35,17,35,53,55,33,21,35,17,20,22,4,127,28,46,15,16,68,47,108,113,254,36,164,223,150,4,70,217,54,116,13,7,132,8,16,129,127,2,209,252,67,3,189,75,64,139,253,60,73,60,0,2,0,164,254,20,4,94,4,92,0,21,0,34,0,29,64,15,22,18,7,114,13,15,114,7,26,26,29,29,4,11,114,0,43,50,17,51,17,51,43,43,50,48,49,65,20,6,6,35,34,38,39,35,22,22,21,17,35,17,52,54,54,51,50,22,22,37,34,6,21,17,22,22,51,50,54,53,52,38,4,94,116,216,150,87,158,59,9,5,4,168,117,217,149,141,212,118,254,34,157,151,60,157,86,164,149,145,2,37,185,254,130,49,45,37,141,89,254,213,4,33,185,244,122,130,253,243,209,206,254,172,51,52,218,213,214,213,0,1,0,114,254,113,3,164,4,92,0,38,0,20,64,10,26,18,30,14,4,21,7,0,7,114,0,43,50,47,23,57,48,49,65,50,22,23,7,38,38,35,34,6,21,20,22,22,23,30,2,21,20,6,7,35,62,2,53,52,38,38,39,46,3,53,52,18,54,2,127,81,155,57,52,55,125,68,183,163,59,155,142,105,125,55,77,44,158,33,55,34,36,108,108,87,148,109,60,132,236,4,92,33,24,139,20,31,230,218,122,144,82,31,22,65,88,59,88,160,61,44,95,92,38,32,50,43,20,17,69,118,177,125,204,1,7,128,0,2,0,114,255,236,4,179,4,72,0,17,0,32,0,23,64,11,29,15,30,30,12,6,114,22,4,11,114,0,43,50,43,50,17,51,51,48,49,65,20,6,6,35,34,38,38,53,52,54,36,51,33,21,33,22,22,5,20,22,22,51,50,54,53,52,38,38,39,35,34,6,4,93,115,225,166,151,224,122,143,1,11,184,1,239,254,248,80,98,252,193,68,146,116,173,158,40,77,55,67,214,208,1,249,150,238,137,126,242,174,203,253,118,139,79,224,132,118,182,104,215,169,90,162,142,61,201,0,1,0,20,255,234,3,144,4,72,0,21,0,23,64,11,20,2,19,19,21,6,114,6,13,11,114,0,43,50,43,50,17,51,51,48,49,65,21,33,17,20,22,51,50,54,55,21,6,6,35,34,38,38,53,17,33,53,55,3,144,254,84,108,91,45,95,32,29,108,59,95,156,93,254,217,150,4,72,141,253,147,121,100,13,9,125,12,20,58,147,133,2,127,77,64,0,1,0,163,255,236,4,111,4,72,0,23,0,16,183,17,5,6,114,10,0,11,114,0,43,50,43,50,48,49,69,34,38,38,53,17,51,17,20,22,51,50,54,53,52,38,39,51,30,2,21,16,0,2,112,177,201,83,166,148,160,167,163,33,31,167,21,29,15,254,254,20,134,233,148,2,89,253,173,181,204,239,250,141,228,122,81,152,165,100,254,196,254,210,0,2,0,114,254,20,5,74,4,92,0,29,0,41,0,33,64,17,22,15,114,8,23,23,34,20,11,114,1,0,0,30,12,7,114,0,43,50,50,17,51,43,50,50,17,51,43,48,49,65,23,6,6,21,20,22,22,23,17,52,54,51,50,22,22,21,20,2,6,7,17,35,17,46,2,53,52,18,5,34,6,21,17,62,2,53,52,38,38,1,67,128,77,94,96,165,101,168,148,124,177,95,150,250,150,162,155,238,135,118,2,216,66,90,110,172,100,58,102,4,83,89,100,223,145,150,184,89,9,2,111,184,191,135,243,162,195,254,254,133,9,254,39,1,217,9,121,248,196,167,1,19,19,106,129,253,143,9,105,197,145,130,180,94,0,1,255,240,254,20,4,78,4,80,0,38,0,34,64,18,13,20,20,25,8,28,5,4,0,27,15,114,32,0,0,7,6,114,0,43,50,47,51,43,17,23,57,50,17,51,48,49,83,50,22,22,23,19,1,51,1,19,30,2,51,50,54,55,21,6,6,35,34,38,38,39,3,1,35,1,3,38,38,35,34,6,7,53,54,54,176,64,82,60,29,150,1,63,177,254,87,195,25,48,64,48,26,46,18,22,58,41,87,112,74,32,154,254,152,178,1,206,177,29,67,51,19,35,14,21,60,4,80,55,105,77,254,133,2,96,253,0,254,18,64,83,41,5,3,129,6,11,64,121,85,1,146,253,96,3,70,1,199,80,87,6,6,131,7,10,0,1,0,163,254,20,5,138,6,18,0,31,0,33,64,18,8,8,24,6,114,17,15,114,30,19,19,1,16,11,114,0,0,114,0,43,43,50,50,17,51,43,43,50,47,48,49,65,17,62,2,53,52,38,39,51,22,22,21,20,2,6,7,17,35,17,46,2,53,17,51,17,20,22,22,23,17,3,89,123,178,97,34,32,165,32,32,147,253,161,162,158,240,134,164,99,167,102,6,18,250,105,10,103,195,147,141,238,139,135,241,136,207,254,253,126,9,254,37,1,219,6,117,247,199,2,32,253,220,154,182,84,7,5,153,0,0,1,0,115,255,236,5,189,4,72,0,48,0,35,64,17,35,35,15,48,23,6,114,12,11,41,41,8,8,30,15,11,114,0,43,50,50,17,51,17,51,51,43,50,18,57,47,48,49,65,30,2,21,20,6,6,35,34,38,39,35,6,6,35,34,38,38,53,52,54,54,55,51,6,2,21,20,22,51,50,54,54,53,17,51,17,20,22,22,51,50,54,54,53,52,2,39,5,67,42,54,26,86,171,128,114,141,33,9,31,143,112,124,173,89,27,54,42,169,64,61,124,106,69,89,43,159,46,89,63,73,104,56,61,65,4,72,94,179,186,107,161,249,140,96,91,91,96,137,247,166,107,186,178,95,144,254,251,163,203,207,70,123,79,1,58,254,198,87,121,64,93,183,134,163,1,5,144,255,255,255,233,255,236,2,147,5,210,6,38,1,133,0,0,1,7,0,106,254,179,0,0,0,12,180,38,26,16,6,114,0,43,206,206,48,49,255,255,0,163,255,236,4,111,5,210,6,38,1,145,0,0,1,6,0,106,33,0,0,12,180,45,33,5,6,114,0,43,206,206,48,49,255,255,0,114,255,236,4,96,6,113,6,38,0,82,0,0,1,6,1,83,20,0,0,10,179,33,14,7,114,0,43,206,48,49,255,255,0,163,255,236,4,111,6,113,6,38,1,145,0,0,1,6,1,83,29,0,0,10,179,24,5,6,114,0,43,206,48,49,255,255,0,115,255,236,5,189,6,113,6,38,1,149,0,0,1,7,1,83,0,192,0,0,0,10,179,49,23,6,114,0,43,206,48,49,255,255,0,200,0,0,3,246,7,65,6,38,0,40,0,0,1,7,0,106,0,33,1,111,0,12,180,33,21,2,2,114,0,43,206,206,48,49,0,1,0,18,255,236,5,65,5,182,0,32,0,33,64,17,16,25,25,0,24,20,20,21,2,114,18,8,114,7,0,9,114,0,43,50,43,43,50,17,51,17,57,47,51,48,49,69,34,38,39,53,22,22,51,50,54,54,53,53,52,38,35,33,17,35,17,33,53,33,21,33,17,33,50,22,21,21,20,6,3,210,47,82,24,31,69,46,50,94,62,122,145,254,128,168,254,172,3,197,254,55,1,142,203,218,206,20,13,10,148,10,10,40,103,94,135,122,119,253,24,5,32,150,150,254,94,189,181,145,201,198,255,255,0,200,0,0,3,253,7,144,6,38,1,96,0,0,1,7,0,118,1,168,1,111,0,10,179,13,5,2,114,0,43,206,48,49,0,1,0,125,255,236,4,226,5,205,0,35,0,25,64,12,5,8,8,20,0,29,3,114,13,20,9,114,0,43,50,43,50,17,57,47,51,48,49,65,34,14,2,7,33,21,33,30,3,51,50,54,55,21,6,6,35,34,36,2,53,52,18,54,36,51,50,22,23,7,38,38,3,65,112,183,135,82,12,2,212,253,39,5,70,131,192,127,102,180,85,80,193,116,235,254,210,145,93,181,1,10,172,128,201,84,69,74,171,5,53,64,127,185,122,148,133,207,143,75,33,25,148,30,29,188,1,83,226,168,1,21,199,108,48,41,146,37,46,0,255,255,0,105,255,236,4,1,5,203,6,6,0,54,0,0,255,255,0,200,0,0,1,114,5,182,6,6,0,44,0,0,255,255,0,6,0,0,2,59,7,65,6,38,0,44,0,0,1,7,0,106,254,208,1,111,0,12,180,13,25,1,2,114,0,43,206,206,48,49,255,255,255,92,254,127,1,106,5,182,6,6,0,45,0,0,0,2,0,1,255,233,7,41,5,182,0,38,0,48,0,31,64,16,39,27,8,114,48,18,18,0,29,16,2,114,7,0,9,114,0,43,50,43,50,17,57,47,51,43,50,48,49,87,34,38,39,53,22,22,51,50,54,54,55,54,54,18,18,55,33,17,51,50,22,22,21,20,4,33,33,17,33,14,4,7,14,2,37,51,50,54,53,52,38,38,35,35,131,35,68,27,23,57,32,62,73,43,17,14,34,38,41,21,2,167,139,208,245,106,255,0,254,239,254,174,254,145,12,25,28,28,27,14,27,76,127,3,132,147,193,183,89,180,136,118,23,14,10,143,10,14,98,157,86,71,209,1,5,1,44,160,253,146,106,186,121,196,231,5,32,89,194,195,187,166,67,139,195,103,169,139,142,99,116,50,0,2,0,200,0,0,7,88,5,182,0,19,0,29,0,35,64,17,7,3,3,29,18,18,0,6,1,2,114,20,16,16,0,8,114,0,43,50,17,51,43,50,17,57,47,51,51,17,51,48,49,115,17,51,17,33,17,51,17,51,50,22,22,21,20,4,33,33,17,33,17,37,51,50,54,53,52,38,38,35,35,200,170,2,130,172,137,208,244,107,255,0,254,241,254,171,253,126,3,46,147,191,183,89,179,136,117,5,182,253,146,2,110,253,146,106,186,121,196,231,2,178,253,78,146,139,142,99,116,50,0,1,0,18,0,0,5,65,5,182,0,19,0,29,64,14,2,18,18,14,3,3,16,19,2,114,9,16,8,114,0,43,50,43,17,57,47,51,50,17,51,48,49,65,21,33,17,33,50,22,21,17,35,17,52,38,35,33,17,35,17,33,53,4,11,254,3,1,151,200,212,169,116,140,254,118,170,254,174,5,182,152,254,94,186,183,253,245,1,247,123,116,253,26,5,30,152,0,255,255,0,200,0,0,4,224,7,144,6,38,1,179,0,0,1,7,0,118,1,224,1,111,0,10,179,18,5,2,114,0,43,206,48,49,255,255,0,22,255,236,4,241,7,122,6,38,1,188,0,0,1,7,2,51,0,56,1,111,0,10,179,34,17,2,114,0,43,206,48,49,0,1,0,200,254,130,5,9,5,182,0,11,0,21,64,10,11,6,2,114,8,2,1,5,8,114,0,43,50,204,51,43,50,48,49,97,33,17,35,17,33,17,51,17,33,17,51,5,9,254,50,175,254,60,170,2,239,168,254,130,1,126,5,182,250,226,5,30,255,255,0,0,0,0,5,13,5,188,6,6,0,36,0,0,0,2,0,200,0,0,4,119,5,182,0,13,0,23,0,25,64,12,5,23,23,0,4,1,2,114,14,0,8,114,0,43,50,43,50,17,57,47,51,48,49,115,17,33,21,33,17,51,50,22,22,21,20,6,33,39,51,50,54,53,52,38,38,35,35,200,3,91,253,79,227,211,238,97,241,254,233,253,235,198,165,80,172,140,206,5,182,150,254,40,104,186,123,202,225,146,139,142,99,116,50,0,255,255,0,200,0,0,4,188,5,182,6,6,0,37,0,0,255,255,0,200,0,0,3,253,5,182,6,6,1,96,0,0,0,2,0,12,254,130,5,74,5,182,0,15,0,23,0,26,64,12,17,15,2,114,10,1,22,22,4,7,6,8,0,63,205,50,51,17,51,51,43,50,48,49,65,17,51,17,35,17,33,17,35,17,51,54,26,2,55,5,33,6,10,2,7,33,4,150,180,163,252,8,163,112,75,131,103,65,9,1,242,254,164,9,62,97,119,66,2,189,5,182,250,226,253,234,1,126,254,130,2,22,128,1,63,1,93,1,96,162,153,124,254,207,254,192,254,218,114,0,255,255,0,200,0,0,3,246,5,182,6,6,0,40,0,0,0,1,0,4,0,0,6,181,5,182,0,17,0,34,64,19,0,9,3,15,12,6,6,1,14,14,11,17,8,114,8,5,1,2,114,0,43,50,50,43,50,50,17,18,23,57,48,49,65,1,51,1,17,51,17,1,51,1,1,35,1,17,35,17,1,35,2,86,253,196,189,2,52,164,2,52,189,253,196,2,81,196,253,190,164,253,189,196,2,240,2,198,253,60,2,196,253,60,2,196,253,59,253,15,2,229,253,27,2,229,253,27,0,1,0,79,255,236,4,59,5,203,0,46,0,31,64,15,4,3,27,27,26,26,11,35,43,3,114,19,11,9,114,0,43,50,43,50,17,57,47,51,18,57,57,48,49,65,20,6,7,21,22,22,21,20,6,4,35,34,38,39,53,30,2,51,50,54,53,52,38,35,35,53,51,50,54,54,53,52,38,35,34,6,7,39,62,2,51,50,22,22,4,29,184,154,180,188,129,254,254,192,119,216,90,62,144,149,68,198,205,237,214,210,203,144,190,95,167,134,139,182,86,82,58,148,180,104,155,212,110,4,95,149,173,26,7,26,180,146,129,195,108,37,43,157,30,44,23,153,139,143,131,143,67,123,84,115,124,71,56,116,42,69,41,93,164,0,0,1,0,202,0,0,5,77,5,182,0,21,0,26,64,14,7,8,18,19,4,0,12,20,8,114,10,0,2,114,0,43,50,43,50,17,23,57,48,49,83,51,17,20,14,2,7,51,1,51,17,35,17,52,62,2,55,35,1,35,202,159,2,4,5,2,8,3,46,187,159,4,5,6,1,9,252,209,188,5,182,252,179,48,113,108,88,24,4,202,250,74,3,67,53,119,112,89,24,251,48,0,255,255,0,202,0,0,5,77,7,122,6,38,1,177,0,0,1,7,2,51,0,214,1,111,0,10,179,26,0,2,114,0,43,206,48,49,0,1,0,200,0,0,4,224,5,182,0,10,0,25,64,13,2,7,10,3,4,9,5,2,114,1,4,8,114,0,43,50,43,50,18,23,57,48,49,97,35,1,17,35,17,51,17,1,51,1,4,224,206,253,96,170,170,2,143,195,253,121,2,230,253,26,5,182,253,60,2,196,253,58,0,1,0,1,255,233,4,216,5,182,0,29,0,21,64,11,3,28,2,114,19,12,9,114,0,8,114,0,43,43,50,43,50,48,49,97,35,17,33,14,3,7,14,2,35,34,38,39,53,22,22,51,50,54,54,55,54,54,18,18,55,33,4,216,170,254,38,14,32,34,34,17,26,77,127,104,35,69,26,23,57,32,63,73,43,16,13,34,38,41,20,3,18,5,32,112,244,242,216,84,139,195,103,14,10,143,10,14,101,156,82,68,208,1,9,1,46,160,255,255,0,200,0,0,6,106,5,182,6,6,0,48,0,0,255,255,0,200,0,0,5,28,5,182,6,6,0,43,0,0,255,255,0,125,255,236,5,188,5,205,6,6,0,50,0,0,255,255,0,200,0,0,5,9,5,182,6,6,1,109,0,0,255,255,0,200,0,0,4,102,5,182,6,6,0,51,0,0,255,255,0,125,255,236,4,203,5,203,6,6,0,38,0,0,255,255,0,18,0,0,4,83,5,182,6,6,0,55,0,0,0,1,0,22,255,236,4,241,5,182,0,29,0,23,64,11,23,16,5,29,17,2,114,12,5,9,114,0,43,50,43,50,18,57,57,48,49,65,1,14,2,35,34,38,39,53,22,22,51,50,54,54,55,1,51,1,30,2,23,51,62,2,55,1,4,241,254,36,62,128,176,135,58,99,39,40,93,52,77,110,84,38,253,204,186,1,160,8,18,18,7,7,6,15,16,6,1,103,5,182,251,220,140,188,94,17,13,169,19,21,47,103,85,4,64,252,207,15,39,41,20,15,40,40,14,3,55,0,255,255,0,105,255,236,5,245,5,203,6,6,1,114,0,0,255,255,0,6,0,0,4,152,5,182,6,6,0,59,0,0,0,1,0,200,254,130,5,184,5,182,0,11,0,23,64,11,10,5,2,114,11,7,7,1,4,8,114,0,43,204,51,17,51,43,50,48,49,101,17,35,17,33,17,51,17,33,17,51,17,5,184,163,251,179,170,2,239,168,150,253,236,1,126,5,182,250,226,5,30,250,224,0,0,1,0,167,0,0,4,195,5,182,0,19,0,29,64,14,17,14,14,2,5,5,0,19,9,2,114,0,8,114,0,43,43,50,17,57,47,51,51,17,51,48,49,97,35,17,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,17,51,4,195,169,117,210,128,207,221,170,129,146,123,195,120,169,2,94,42,52,191,179,2,68,253,212,121,123,45,42,2,201,0,1,0,200,0,0,7,119,5,182,0,11,0,23,64,11,11,7,2,2,114,8,4,4,1,8,114,0,43,50,17,51,43,50,50,48,49,97,33,17,51,17,33,17,51,17,33,17,51,7,119,249,81,170,2,87,170,2,88,172,5,182,250,226,5,30,250,226,5,30,0,1,0,200,254,130,8,12,5,182,0,15,0,27,64,13,14,10,5,2,114,15,11,7,7,1,4,8,114,0,43,204,51,17,51,51,43,50,50,48,49,101,17,35,17,33,17,51,17,33,17,51,17,33,17,51,17,8,12,163,249,95,170,2,74,172,2,75,170,150,253,236,1,126,5,182,250,226,5,30,250,226,5,30,250,224,0,2,0,15,0,0,5,20,5,182,0,13,0,23,0,25,64,12,23,5,5,0,2,3,2,114,14,0,8,114,0,43,50,43,50,17,57,47,51,48,49,97,17,33,53,33,17,51,50,22,22,21,20,6,33,37,51,50,54,53,52,38,38,35,35,1,100,254,171,1,254,239,199,234,103,248,254,249,254,248,245,182,172,84,169,128,218,5,32,150,253,146,107,187,119,196,231,146,139,142,99,116,50,0,0,3,0,200,0,0,5,250,5,182,0,11,0,21,0,25,0,27,64,13,21,3,3,0,23,1,2,114,22,12,0,8,114,0,43,50,50,43,50,17,57,47,51,48,49,115,17,51,17,51,50,22,22,21,20,6,33,37,51,50,54,53,52,38,38,35,35,1,17,51,17,200,170,234,198,234,102,247,254,248,254,255,240,181,171,83,167,127,215,3,222,170,5,182,253,146,107,187,119,196,231,145,140,142,99,115,49,253,78,5,182,250,74,0,0,2,0,200,0,0,4,168,5,182,0,11,0,21,0,23,64,11,21,3,3,0,1,2,114,12,0,8,114,0,43,50,43,17,57,47,51,48,49,115,17,51,17,33,50,22,22,21,20,4,33,37,33,50,54,53,52,38,38,35,33,200,170,1,22,198,239,107,254,254,254,249,254,211,1,27,182,182,90,173,127,254,255,5,182,253,146,107,187,119,196,231,146,139,142,99,116,50,0,1,0,63,255,236,4,140,5,203,0,35,0,25,64,12,30,29,29,7,23,16,9,114,0,7,3,114,0,43,50,43,50,18,57,47,51,48,49,65,34,6,7,39,54,54,51,50,4,22,18,21,20,2,4,35,34,38,39,53,22,22,51,50,62,2,55,33,53,33,46,3,1,218,101,171,69,70,85,214,114,175,1,3,170,84,156,254,199,235,127,177,84,85,177,100,134,203,138,73,3,253,45,2,209,9,78,132,179,5,53,46,32,143,41,44,107,196,254,246,159,237,254,164,190,29,30,148,23,35,74,144,208,134,150,116,183,128,67,0,0,2,0,200,255,236,7,227,5,205,0,23,0,39,0,33,64,18,15,10,10,5,36,20,3,114,13,2,114,12,8,114,28,5,9,114,0,43,50,43,43,43,50,17,57,47,51,48,49,65,20,2,6,6,35,34,36,2,39,33,17,35,17,51,17,33,54,18,36,51,50,4,18,5,20,18,22,51,50,54,18,53,52,2,38,35,34,6,2,7,227,81,162,241,159,208,254,229,149,8,254,154,170,170,1,105,14,151,1,20,201,211,1,31,148,251,167,99,206,160,164,208,98,97,206,163,162,207,100,2,221,169,254,235,200,107,175,1,63,214,253,80,5,182,253,144,196,1,35,160,187,254,174,224,187,254,239,149,148,1,16,186,186,1,14,146,145,254,243,0,0,2,0,46,0,0,4,71,5,182,0,14,0,24,0,29,64,14,3,23,23,0,0,2,16,10,2,114,13,2,8,114,0,43,50,43,50,17,57,47,51,18,57,48,49,65,1,35,1,46,2,53,52,36,33,33,17,35,17,17,35,34,6,6,21,20,22,51,51,2,113,254,132,199,1,153,80,139,85,1,17,1,14,1,145,170,225,121,167,86,184,189,226,2,99,253,157,2,130,25,93,164,128,200,210,250,74,2,99,2,194,56,120,97,139,149,255,255,0,94,255,236,3,203,4,90,6,6,0,68,0,0,0,2,0,118,255,236,4,82,6,30,0,34,0,50,0,44,64,21,46,42,42,22,17,18,18,22,22,7,35,30,11,114,13,8,8,4,7,1,114,0,43,50,50,17,51,43,50,18,57,125,47,51,17,51,17,51,17,51,48,49,83,52,18,54,55,54,36,55,23,14,3,7,14,2,7,51,62,2,51,50,22,22,21,20,6,6,35,34,46,2,1,50,54,54,53,52,38,35,34,6,6,7,20,30,2,118,90,189,149,128,1,8,125,29,63,138,138,122,47,85,123,71,7,12,30,104,144,90,142,190,96,123,222,150,116,183,127,67,1,250,95,137,75,133,146,91,148,102,23,30,74,131,2,146,234,1,75,201,37,35,51,19,146,9,23,25,27,14,23,114,200,152,44,86,57,123,222,149,179,244,123,90,174,252,254,134,80,173,139,174,197,77,106,42,102,192,154,90,0,3,0,175,0,0,4,59,4,72,0,17,0,26,0,35,0,31,64,15,4,3,32,32,22,22,12,31,13,6,114,23,12,10,114,0,43,50,43,50,17,57,47,51,18,57,57,48,49,65,20,6,7,21,22,22,21,20,6,6,35,33,17,33,50,22,22,3,52,38,35,33,17,33,50,54,3,52,38,35,33,17,33,50,54,4,22,120,95,103,149,90,192,154,254,40,1,212,118,181,104,136,147,140,254,231,1,29,138,145,33,114,130,254,221,1,6,135,138,3,53,103,115,20,8,14,119,122,94,144,82,4,72,53,120,253,165,97,86,254,144,85,2,70,78,77,254,197,78,0,0,1,0,175,0,0,3,72,4,72,0,5,0,14,182,2,5,6,114,4,10,114,0,43,43,50,48,49,65,21,33,17,35,17,3,72,254,14,167,4,72,141,252,69,4,72,0,2,0,39,254,133,4,111,4,72,0,14,0,21,0,27,64,12,16,14,6,10,1,21,21,7,4,128,5,10,0,63,26,205,50,51,17,51,51,63,51,48,49,65,17,51,17,35,17,33,17,35,17,51,54,18,18,55,5,33,6,2,2,7,33,3,210,157,161,252,248,159,86,94,124,64,2,1,152,254,252,9,67,110,73,2,7,4,72,252,69,253,248,1,123,254,133,2,8,130,1,54,1,85,174,132,146,254,210,254,239,102,255,255,0,114,255,236,4,19,4,92,6,6,0,72,0,0,0,1,0,4,0,0,5,218,4,72,0,17,0,32,64,18,1,10,16,13,7,4,6,6,17,15,11,6,114,6,3,9,10,114,0,43,50,50,43,50,50,18,23,57,48,49,65,1,1,35,1,17,35,17,1,35,1,1,51,1,17,51,17,1,5,179,254,56,1,239,190,254,32,155,254,33,190,1,239,254,55,183,1,192,155,1,194,4,72,253,235,253,205,2,44,253,212,2,44,253,212,2,51,2,21,253,236,2,20,253,236,2,20,0,0,1,0,67,255,236,3,128,4,92,0,47,0,31,64,15,7,8,34,34,33,33,0,24,16,11,114,41,0,7,114,0,43,50,43,50,18,57,47,51,18,57,57,48,49,65,50,22,22,21,20,6,7,21,30,2,21,20,6,6,35,34,38,38,39,53,22,22,51,50,54,54,53,52,38,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,1,201,123,180,98,108,95,67,109,65,100,204,156,77,138,112,42,70,188,109,84,134,79,70,139,106,147,121,141,168,130,121,90,138,80,59,86,188,4,92,67,128,92,99,118,26,8,18,67,109,81,92,147,84,17,32,22,151,34,52,39,87,71,65,85,41,136,80,95,82,81,37,34,133,38,38,0,1,0,175,0,0,4,100,4,72,0,18,0,23,64,11,15,6,16,8,18,6,114,10,16,10,114,0,43,50,43,50,18,57,57,48,49,65,17,20,14,2,7,1,51,17,35,17,52,54,54,55,1,35,17,1,77,2,4,3,2,2,86,204,155,2,4,1,253,172,205,4,72,253,79,20,63,71,65,21,3,161,251,184,2,160,32,100,97,27,252,96,4,72,255,255,0,175,0,0,4,100,6,11,6,38,1,209,0,0,1,6,2,51,80,0,0,10,179,23,18,6,114,0,43,206,48,49,0,1,0,175,0,0,4,11,4,72,0,10,0,25,64,13,5,10,2,3,7,1,8,6,114,4,7,10,114,0,43,50,43,50,18,23,57,48,49,65,51,1,1,35,1,17,35,17,51,17,3,46,183,254,39,1,255,195,254,14,167,167,4,72,253,239,253,201,2,44,253,212,4,72,253,236,0,1,0,13,255,243,3,229,4,72,0,22,0,21,64,11,3,21,6,114,15,8,11,114,0,10,114,0,43,43,50,43,50,48,49,97,35,17,33,2,2,6,6,35,34,38,39,53,22,22,51,50,62,2,18,55,33,3,229,169,254,179,20,61,91,129,89,27,48,17,13,29,16,45,75,61,48,37,14,2,134,3,189,254,253,254,143,233,109,6,7,126,4,4,75,152,233,1,61,201,0,1,0,174,0,0,5,52,4,72,0,20,0,27,64,14,19,6,10,3,16,20,18,6,114,9,2,16,10,114,0,43,50,50,43,50,18,23,57,48,49,65,17,35,17,52,54,55,35,1,35,1,35,22,22,21,17,35,17,51,1,1,5,52,150,5,4,6,254,148,141,254,157,6,3,3,151,223,1,98,1,103,4,72,251,184,2,202,44,91,46,252,129,3,127,46,91,50,253,60,4,72,252,128,3,128,0,1,0,175,0,0,4,95,4,72,0,11,0,25,64,12,1,8,8,10,4,11,6,114,6,10,10,114,0,43,50,43,50,17,57,47,51,48,49,65,17,33,17,51,17,35,17,33,17,35,17,1,86,2,99,166,166,253,157,167,4,72,254,52,1,204,251,184,1,239,254,17,4,72,255,255,0,114,255,236,4,96,4,92,6,6,0,82,0,0,0,1,0,175,0,0,4,69,4,72,0,7,0,16,183,4,7,6,114,2,6,10,114,0,43,50,43,50,48,49,65,17,35,17,33,17,35,17,4,69,167,253,184,167,4,72,251,184,3,185,252,71,4,72,255,255,0,175,254,22,4,115,4,92,6,6,0,83,0,0,255,255,0,114,255,236,3,146,4,92,6,6,0,70,0,0,0,1,0,41,0,0,3,154,4,72,0,7,0,19,64,9,1,5,5,6,6,114,3,10,114,0,43,43,50,17,51,48,49,65,33,17,35,17,33,53,33,3,154,254,151,164,254,156,3,113,3,187,252,69,3,187,141,0,255,255,0,2,254,19,4,2,4,72,6,6,0,92,0,0,0,3,0,112,254,20,5,71,6,20,0,21,0,30,0,38,0,37,64,20,31,22,22,1,20,7,114,32,9,9,30,12,11,114,10,15,114,0,0,114,0,43,43,43,50,50,17,51,43,50,50,17,51,48,49,65,17,30,2,21,20,6,6,7,17,35,17,46,2,53,52,54,54,55,17,17,14,2,21,20,22,22,23,19,17,62,2,53,52,38,3,44,163,242,134,129,241,169,162,163,241,134,129,242,172,127,164,79,80,164,126,157,126,163,79,182,6,20,254,68,14,141,242,167,164,244,142,14,254,36,1,220,12,141,244,167,167,243,141,13,1,188,253,186,11,106,182,127,127,183,106,12,3,84,252,172,13,108,182,125,190,215,255,255,0,39,0,0,4,9,4,72,6,6,0,91,0,0,0,1,0,175,254,133,4,218,4,72,0,11,0,25,64,12,9,4,6,114,10,6,6,0,128,3,10,114,0,43,26,204,51,17,51,43,50,48,49,65,35,17,33,17,51,17,33,17,51,17,51,4,218,162,252,119,167,2,69,166,153,254,133,1,123,4,72,252,69,3,187,252,67,0,0,1,0,154,0,0,4,44,4,72,0,19,0,29,64,14,7,4,4,12,15,15,10,9,19,6,114,10,10,114,0,43,43,50,17,57,47,51,51,17,51,48,49,65,17,20,22,51,50,54,55,17,51,17,35,17,6,6,35,34,38,53,17,1,64,113,108,104,170,87,166,166,92,178,124,169,185,4,72,254,118,103,98,64,55,1,220,251,184,1,235,59,68,176,150,1,150,0,0,1,0,175,0,0,6,109,4,72,0,11,0,23,64,11,11,8,3,6,114,9,5,5,2,10,114,0,43,50,17,51,43,50,50,48,49,65,17,33,17,51,17,33,17,51,17,33,17,6,109,250,66,166,1,229,167,1,230,4,72,251,184,4,72,252,69,3,187,252,69,3,187,0,0,1,0,175,254,135,7,9,4,72,0,15,0,29,64,14,15,12,7,6,114,13,1,9,9,3,128,6,10,114,0,43,26,204,51,17,51,51,43,50,50,48,49,65,17,51,17,35,17,33,17,51,17,33,17,51,17,33,17,6,108,157,167,250,77,166,1,229,167,1,230,4,72,252,67,253,252,1,121,4,72,252,69,3,187,252,69,3,187,0,0,2,0,38,0,0,5,20,4,72,0,14,0,23,0,25,64,12,16,1,1,11,13,14,6,114,17,11,10,114,0,43,50,43,50,17,57,47,51,48,49,65,17,33,50,22,22,21,20,6,6,35,33,17,33,53,1,33,17,33,50,54,53,52,38,2,38,1,61,147,192,94,90,193,155,254,34,254,166,3,54,254,202,1,56,128,146,137,4,72,254,60,70,138,102,102,150,82,3,187,141,253,176,254,143,89,102,100,78,0,0,3,0,175,0,0,5,118,4,72,0,12,0,21,0,25,0,27,64,13,21,3,3,0,23,1,6,114,22,13,0,10,114,0,43,50,50,43,50,17,57,47,51,48,49,115,17,51,17,33,50,22,22,21,20,6,6,35,37,33,50,54,53,52,38,35,33,1,17,51,17,175,167,1,44,140,181,88,87,185,148,254,223,1,17,124,148,138,129,254,234,3,122,166,4,72,254,60,70,138,102,102,150,82,135,88,103,101,79,254,6,4,72,251,184,0,0,2,0,175,0,0,4,73,4,72,0,12,0,21,0,23,64,11,17,0,0,10,11,6,114,18,10,10,114,0,43,50,43,17,57,47,51,48,49,65,33,50,22,22,21,20,6,6,35,33,17,51,1,52,38,35,33,17,33,50,54,1,86,1,80,140,186,93,91,189,149,254,19,167,2,76,143,128,254,195,1,62,120,150,2,132,70,138,102,102,150,82,4,72,252,254,101,79,254,141,89,0,0,1,0,65,255,236,3,132,4,92,0,31,0,25,64,12,13,12,12,0,17,24,7,114,7,0,11,114,0,43,50,43,50,17,57,47,51,48,49,69,34,38,39,53,22,22,51,50,54,54,55,33,53,33,38,38,35,34,6,7,39,54,54,51,50,22,22,21,20,6,6,1,98,93,137,59,62,142,88,112,161,91,7,253,212,2,42,13,168,164,59,141,56,46,58,161,82,155,234,131,138,245,20,30,28,145,25,36,82,167,125,137,173,167,33,21,136,26,35,116,249,201,191,254,125,0,0,2,0,175,255,236,6,48,4,92,0,22,0,38,0,33,64,18,14,9,9,4,35,19,7,114,12,6,114,11,10,114,27,4,11,114,0,43,50,43,43,43,50,17,57,47,51,48,49,65,20,2,6,35,34,38,38,39,33,17,35,17,51,17,33,62,2,51,50,22,22,5,20,22,22,51,50,54,54,53,52,38,38,35,34,6,6,6,48,115,214,149,139,207,119,9,254,221,166,166,1,37,14,120,204,138,144,213,117,252,242,63,135,108,107,135,63,64,134,107,107,135,64,2,38,179,255,0,135,120,230,165,254,17,4,72,254,52,152,214,114,135,253,178,138,193,101,100,193,139,137,190,99,99,190,0,0,2,0,34,0,0,3,191,4,72,0,14,0,23,0,29,64,14,2,18,18,14,14,1,21,9,6,114,12,1,10,114,0,43,50,43,50,17,57,47,51,18,57,48,49,115,35,1,46,2,53,52,54,51,33,17,35,17,33,1,20,22,51,33,17,33,34,6,228,194,1,60,69,118,73,211,173,1,229,166,254,234,254,248,140,130,1,16,254,211,128,113,1,206,15,73,128,95,158,165,251,184,1,184,1,76,98,95,1,122,103,0,255,255,0,114,255,236,4,19,5,210,6,38,0,72,0,0,1,6,0,106,246,0,0,12,180,53,41,0,7,114,0,43,206,206,48,49,0,1,0,20,254,20,4,67,6,20,0,47,0,41,64,21,24,28,28,21,29,29,39,35,14,14,39,25,0,114,20,10,114,7,0,15,114,0,43,50,43,43,47,51,17,51,17,57,47,51,51,17,51,48,49,65,34,38,39,53,22,22,51,50,54,53,17,52,38,35,34,6,6,21,17,35,17,35,53,51,53,51,21,33,21,33,21,20,6,7,51,62,2,51,50,22,22,21,17,20,6,6,3,46,45,66,25,27,55,32,58,75,124,128,121,145,64,168,155,155,166,1,149,254,107,4,3,9,34,106,135,75,132,177,89,62,123,254,20,15,10,137,10,11,76,98,3,78,137,134,93,179,130,253,230,4,221,124,187,187,124,191,39,79,35,58,79,42,84,177,139,252,173,101,144,76,255,255,0,175,0,0,3,72,6,33,6,38,1,204,0,0,1,7,0,118,1,56,0,0,0,10,179,13,5,6,114,0,43,206,48,49,0,1,0,114,255,236,3,172,4,92,0,32,0,25,64,12,19,22,22,0,15,8,7,114,26,0,11,114,0,43,50,43,50,17,57,47,51,48,49,69,34,38,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,6,7,33,21,33,30,2,51,50,54,55,21,6,6,2,121,154,234,131,137,239,152,83,157,58,49,57,136,59,109,150,83,11,2,42,253,212,6,78,150,112,90,144,61,58,139,20,120,249,193,200,254,120,32,26,137,23,29,76,151,113,137,123,167,84,36,25,145,28,30,0,255,255,0,103,255,236,3,116,4,92,6,6,0,86,0,0,255,255,0,160,0,0,1,104,5,226,6,6,0,76,0,0,255,255,255,231,0,0,2,28,5,210,6,38,3,175,0,0,1,7,0,106,254,177,0,0,0,12,180,25,13,2,6,114,0,43,206,206,48,49,255,255,255,144,254,20,1,104,5,226,6,6,0,77,0,0,0,2,0,13,255,243,6,73,4,72,0,31,0,40,0,31,64,16,33,1,1,18,13,31,6,114,25,18,11,114,34,11,10,114,0,43,50,43,50,43,50,17,57,47,51,48,49,65,17,33,50,22,22,21,20,6,6,35,33,17,33,2,2,6,6,35,34,38,39,53,22,22,51,50,62,2,18,55,1,35,17,51,50,54,53,52,38,3,162,1,10,141,183,89,89,191,154,254,99,254,243,19,61,91,128,87,30,47,17,11,29,16,45,75,62,48,38,14,3,46,235,238,125,150,142,4,72,254,60,70,138,102,102,150,82,3,187,254,253,254,144,232,109,6,7,124,3,5,75,153,234,1,61,201,253,176,254,143,89,102,100,78,0,2,0,175,0,0,6,172,4,72,0,20,0,29,0,35,64,17,1,18,18,22,13,13,15,20,16,6,114,23,11,11,15,10,114,0,43,50,17,51,43,50,17,57,47,51,51,17,51,48,49,65,17,33,50,22,22,21,20,6,6,35,33,17,33,17,35,17,51,17,33,17,1,35,17,51,50,54,53,52,38,4,5,1,6,144,184,89,87,190,154,254,92,254,0,170,170,2,4,1,151,243,243,126,149,139,4,72,254,58,69,137,102,102,150,82,1,242,254,14,4,72,254,54,1,202,253,176,254,143,89,102,100,78,255,255,0,20,0,0,4,65,6,20,6,6,0,233,0,0,255,255,0,175,0,0,4,11,6,33,6,38,1,211,0,0,1,7,0,118,1,108,0,0,0,10,179,18,8,6,114,0,43,206,48,49,255,255,0,2,254,19,4,2,6,11,6,38,0,92,0,0,1,6,2,51,185,0,0,10,179,34,0,6,114,0,43,206,48,49,0,1,0,175,254,135,4,72,4,72,0,11,0,21,64,10,7,2,6,114,10,9,4,1,10,114,0,43,50,50,204,43,50,48,49,97,33,17,51,17,33,17,51,17,33,17,35,2,47,254,128,167,2,76,166,254,137,162,4,72,252,69,3,187,251,184,254,135,0,1,0,200,0,0,4,12,6,227,0,7,0,16,183,2,0,5,2,114,4,8,114,0,43,43,204,51,48,49,65,17,33,17,35,17,33,17,4,12,253,102,170,2,165,6,227,254,59,250,226,5,182,1,45,0,0,1,0,175,0,0,3,75,5,137,0,7,0,16,183,2,0,5,6,114,4,10,114,0,43,43,204,51,48,49,65,17,33,17,35,17,33,17,3,75,254,11,167,1,250,5,137,254,61,252,58,4,72,1,65,0,255,255,0,30,0,0,7,69,7,144,6,38,0,58,0,0,1,7,0,67,2,85,1,111,0,10,179,48,16,2,114,0,43,206,48,49,255,255,0,24,0,2,6,27,6,33,6,38,0,90,0,0,1,7,0,67,1,192,0,0,0,10,179,49,28,6,114,0,43,206,48,49,255,255,0,30,0,0,7,69,7,144,6,38,0,58,0,0,1,7,0,118,2,237,1,111,0,10,179,48,16,2,114,0,43,206,48,49,255,255,0,24,0,2,6,27,6,33,6,38,0,90,0,0,1,7,0,118,2,87,0,0,0,10,179,49,15,6,114,0,43,206,48,49,255,255,0,30,0,0,7,69,7,65,6,38,0,58,0,0,1,7,0,106,1,96,1,111,0,12,180,63,51,16,2,114,0,43,206,206,48,49,255,255,0,24,0,2,6,27,5,210,6,38,0,90,0,0,1,7,0,106,0,203,0,0,0,12,180,64,52,15,6,114,0,43,206,206,48,49,255,255,0,0,0,0,4,121,7,144,6,38,0,60,0,0,1,7,0,67,0,224,1,111,0,10,179,15,7,2,114,0,43,206,48,49,255,255,0,2,254,19,4,2,6,33,6,38,0,92,0,0,1,7,0,67,0,165,0,0,0,10,179,36,0,6,114,0,43,206,48,49,0,1,0,82,1,220,3,174,2,112,0,3,0,8,177,1,0,0,47,50,48,49,83,53,33,21,82,3,92,1,220,148,148,0,0,1,0,82,1,220,7,174,2,112,0,3,0,8,177,1,0,0,47,50,48,49,83,53,33,21,82,7,92,1,220,148,148,0,255,255,0,82,1,220,7,174,2,112,6,6,2,2,0,0,0,2,255,252,254,61,3,74,255,188,0,3,0,7,0,12,179,1,2,6,5,0,47,51,206,50,48,49,65,33,53,33,53,33,53,33,3,74,252,178,3,78,252,178,3,78,254,61,123,138,122,0,0,1,0,27,3,193,1,66,5,182,0,10,0,14,181,1,0,128,5,2,114,0,43,26,205,57,48,49,83,39,62,2,55,51,14,2,7,39,12,18,56,66,33,122,20,41,34,11,3,193,22,73,167,167,72,77,178,175,71,0,0,1,0,26,3,193,1,65,5,182,0,11,0,14,181,1,5,128,11,2,114,0,43,26,205,57,48,49,65,23,14,2,7,35,62,3,55,1,50,15,18,56,66,33,122,15,31,28,23,8,5,182,22,73,167,166,73,57,130,134,126,54,255,255,0,65,254,248,1,104,0,237,4,7,2,6,0,39,251,55,0,1,0,27,3,193,1,68,5,182,0,10,0,14,181,9,4,128,10,2,114,0,43,26,205,51,48,49,83,30,2,23,35,46,2,39,55,218,10,34,41,21,123,33,67,56,18,14,5,182,71,176,178,76,73,166,167,73,22,0,0,2,0,27,3,193,2,177,5,182,0,10,0,21,0,23,64,10,17,16,16,6,4,128,10,21,2,114,0,43,50,26,204,50,50,17,51,48,49,65,14,2,7,35,39,62,2,55,35,14,2,7,35,39,62,2,55,2,177,21,41,34,10,177,15,18,57,67,34,246,21,41,34,10,176,12,18,55,66,34,5,182,77,179,174,71,22,73,166,167,73,77,179,174,71,22,73,166,167,73,0,2,0,26,3,193,2,176,5,182,0,10,0,22,0,23,64,10,1,12,12,17,5,128,10,22,2,114,0,43,50,26,204,50,51,17,51,48,49,65,23,14,2,7,35,62,2,55,35,23,14,2,7,35,62,3,55,2,161,15,18,56,66,33,125,21,42,34,10,192,14,17,57,66,33,120,15,31,27,23,7,5,182,22,74,167,165,73,76,178,176,71,22,74,167,165,73,57,130,134,126,54,255,255,0,65,254,248,2,215,0,237,4,7,2,10,0,39,251,55,0,1,0,130,0,0,3,143,6,20,0,11,0,23,64,9,4,1,1,7,10,10,3,8,3,0,47,47,18,57,47,51,51,17,51,48,49,65,37,19,35,19,5,53,5,3,51,3,37,3,143,254,160,47,188,45,254,179,1,77,45,188,47,1,96,3,234,29,251,249,4,7,29,165,28,1,161,254,95,28,0,1,0,121,0,0,3,150,6,20,0,21,0,39,64,17,9,0,0,6,3,11,20,20,14,17,3,17,3,17,5,15,5,0,47,47,18,57,57,47,47,17,51,51,17,51,17,51,51,17,51,48,49,65,37,21,37,19,35,19,5,53,5,3,19,5,53,5,3,51,3,37,21,37,19,2,55,1,95,254,161,45,190,44,254,167,1,89,39,39,254,167,1,89,44,190,45,1,95,254,161,38,1,234,27,160,26,254,129,1,127,26,160,27,1,40,1,25,28,161,28,1,128,254,128,28,161,28,254,231,0,1,0,171,1,251,2,87,3,220,0,15,0,8,177,4,12,0,47,51,48,49,83,52,54,54,51,50,22,22,21,20,6,6,35,34,38,38,171,56,97,61,61,97,56,56,97,61,61,97,56,2,236,87,105,48,48,106,86,84,107,50,50,106,255,255,0,150,255,228,5,163,0,233,4,38,0,17,0,0,0,39,0,17,2,17,0,0,0,7,0,17,4,31,0,0,0,7,0,102,255,236,8,248,5,203,0,11,0,23,0,27,0,39,0,51,0,63,0,75,0,44,64,23,64,52,70,58,13,114,40,28,46,34,13,114,26,12,18,6,0,27,27,12,0,5,114,0,43,50,50,47,16,204,50,63,43,50,204,50,43,50,204,50,48,49,65,50,22,21,20,6,35,34,38,53,52,54,23,34,6,21,20,22,51,50,54,53,52,38,37,1,35,1,19,50,22,21,20,6,35,34,38,53,52,54,23,34,6,21,20,22,51,50,54,53,52,38,37,50,22,21,20,6,35,34,38,53,52,54,23,34,6,21,20,22,51,50,54,53,52,38,1,143,150,155,150,155,144,153,146,151,81,76,76,81,84,82,81,3,73,252,213,146,3,43,107,149,156,150,155,145,152,145,152,81,76,76,81,84,82,81,2,109,149,155,149,155,145,152,145,152,82,76,76,82,83,82,81,5,203,239,218,218,243,243,218,218,239,119,169,169,169,172,172,169,168,170,98,250,74,5,182,253,203,239,218,217,243,243,217,218,239,120,168,169,169,171,169,171,168,169,120,239,218,217,243,243,217,218,239,120,168,169,169,171,169,171,168,169,0,1,0,80,3,169,2,4,5,182,0,3,0,10,179,2,1,2,114,0,43,205,48,49,65,51,1,35,1,90,170,254,187,111,5,182,253,243,0,2,0,80,3,169,3,102,5,182,0,3,0,7,0,14,181,7,0,2,6,2,114,0,43,50,206,50,48,49,65,1,51,1,33,1,51,1,1,177,1,11,170,254,186,254,48,1,10,170,254,187,3,169,2,13,253,243,2,13,253,243,0,1,0,79,0,122,2,26,3,197,0,6,0,16,183,4,6,3,0,2,5,1,5,0,47,204,23,57,48,49,83,1,23,1,1,7,1,79,1,84,119,254,225,1,31,119,254,172,2,44,1,153,68,254,159,254,159,69,1,151,0,1,0,77,0,122,2,24,3,197,0,6,0,16,183,4,2,5,1,6,5,0,3,0,47,204,23,57,48,49,83,1,21,1,39,1,1,194,1,86,254,170,117,1,30,254,226,3,197,254,104,27,254,104,69,1,98,1,96,0,255,255,0,150,255,228,3,83,5,182,4,38,0,4,0,0,0,7,0,4,1,207,0,0,0,1,254,132,0,0,2,129,5,182,0,3,0,11,180,2,18,114,0,2,0,63,43,48,49,65,1,35,1,2,129,252,145,142,3,110,5,182,250,74,5,182,0,1,0,114,2,76,2,196,4,234,0,20,0,25,64,10,18,17,9,9,14,4,0,16,16,0,0,47,50,47,16,204,50,51,17,51,51,48,49,65,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,51,23,51,54,54,1,195,127,130,107,81,84,118,96,108,87,16,6,34,122,4,234,115,127,254,84,1,166,82,82,124,118,254,168,2,146,95,52,55,0,1,0,94,0,0,4,35,5,182,0,17,0,32,64,15,1,16,16,4,13,9,12,12,0,8,5,4,114,0,12,0,63,43,50,18,57,47,51,206,50,50,17,51,48,49,97,17,35,53,51,17,33,21,33,17,33,21,33,21,33,21,33,17,1,14,176,176,3,21,253,144,2,73,253,183,1,64,254,192,1,16,124,4,42,150,253,242,149,241,124,254,240,0,0,1,0,70,0,0,4,70,5,201,0,41,0,44,64,21,11,37,37,14,34,18,30,30,15,33,33,25,26,22,22,25,12,7,0,5,114,0,43,50,63,51,17,51,17,57,47,51,51,17,51,206,50,50,17,51,48,49,65,50,22,23,7,38,38,35,34,6,21,21,33,21,33,21,33,21,33,20,6,6,7,33,21,33,53,62,2,53,35,53,51,53,35,53,51,53,52,54,54,2,178,112,176,68,59,64,148,83,115,131,1,156,254,100,1,156,254,98,36,63,43,3,24,252,0,67,93,49,200,200,200,200,85,182,5,201,45,33,131,29,39,126,142,178,124,177,126,92,124,77,22,152,141,13,77,136,100,126,177,124,139,141,200,107,0,3,0,158,255,236,5,223,5,182,0,12,0,21,0,46,0,45,64,22,30,37,11,114,44,45,45,23,42,26,26,46,23,15,9,9,11,14,12,2,114,11,0,47,43,50,18,57,47,51,47,205,51,17,51,17,51,17,51,43,50,48,49,65,32,22,21,20,14,2,35,35,17,35,17,23,35,17,51,50,54,53,52,38,1,21,51,21,35,17,20,22,51,50,54,55,21,6,6,35,34,38,38,53,17,35,53,55,55,1,163,1,13,243,55,126,209,154,64,165,250,85,54,196,190,173,2,147,227,227,56,66,31,79,22,24,86,61,75,107,58,159,161,58,5,182,221,206,95,167,128,72,253,195,5,182,146,253,172,143,164,147,142,254,255,213,128,254,73,81,83,12,7,124,11,19,61,122,93,1,206,77,67,197,0,1,0,52,255,236,4,117,5,202,0,54,0,43,64,21,51,48,48,15,39,24,24,42,21,12,15,15,0,28,35,13,114,7,0,5,114,0,43,50,43,50,17,57,47,51,206,50,50,17,51,17,51,17,51,48,49,65,50,22,23,7,38,38,35,34,14,2,7,33,21,33,6,6,21,20,22,23,33,21,33,30,2,51,50,54,55,21,6,6,35,34,38,38,39,35,53,51,38,38,53,52,54,53,35,53,51,62,2,3,14,102,175,82,70,57,152,80,78,130,100,70,19,1,248,253,251,1,1,1,1,1,206,254,65,23,105,168,115,79,158,64,62,153,97,163,233,143,29,167,152,1,1,2,152,165,25,144,235,5,202,45,47,136,31,50,50,102,153,102,124,20,41,22,21,46,22,124,121,170,90,38,28,149,27,37,126,236,166,124,25,36,27,23,47,14,124,169,249,136,0,4,0,135,255,246,6,4,5,193,0,3,0,15,0,27,0,54,0,37,64,18,48,28,35,42,3,3,35,4,114,25,13,7,19,1,1,7,12,114,0,43,50,47,50,16,204,50,43,50,47,50,16,204,50,48,49,65,1,35,1,1,20,6,35,34,38,53,52,54,51,50,22,5,20,22,51,50,54,53,52,38,35,34,6,1,34,38,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,20,22,51,50,54,55,21,6,6,5,24,252,213,147,3,43,1,127,173,143,133,175,171,143,134,176,254,19,84,97,93,86,83,96,97,84,253,202,149,197,93,162,101,53,102,38,33,37,87,39,112,110,108,109,53,98,40,39,104,5,182,250,74,5,182,251,152,165,179,178,166,165,179,177,167,107,133,132,108,109,130,130,1,86,164,175,123,154,72,21,15,101,14,17,123,118,118,119,19,16,101,18,20,0,2,0,112,255,236,3,152,5,203,0,35,0,45,0,34,64,19,16,13,32,17,20,43,6,8,39,25,5,114,3,3,0,0,8,13,114,0,43,50,17,51,47,43,50,18,23,57,48,49,101,50,54,55,51,14,2,35,34,38,38,53,53,6,6,7,53,54,54,55,17,52,54,54,51,50,22,21,20,6,6,7,17,20,22,19,52,38,35,34,6,21,17,54,54,2,118,76,105,9,100,5,71,132,99,84,140,84,47,98,48,52,96,45,59,127,101,118,138,100,175,113,82,178,64,64,77,55,128,132,110,97,118,109,155,81,69,154,129,240,17,29,12,113,14,31,16,1,237,86,136,80,157,143,132,219,163,49,254,232,108,122,4,44,96,97,104,89,254,78,67,217,0,4,0,197,0,0,7,193,5,182,0,19,0,23,0,37,0,49,0,38,64,18,44,31,38,24,20,21,13,3,0,9,9,1,2,114,12,12,0,8,0,63,50,47,43,50,47,17,57,57,47,51,222,50,204,50,48,49,115,17,51,1,51,46,2,53,17,51,17,35,1,35,30,2,21,17,33,53,33,21,1,34,38,38,53,52,54,51,50,22,22,21,20,6,39,50,54,53,52,38,35,34,6,21,20,22,197,188,2,174,7,2,7,4,151,184,253,75,8,3,7,5,4,48,2,6,254,252,88,136,77,164,144,88,136,78,166,139,91,84,83,92,91,86,85,5,182,251,61,52,138,137,50,3,74,250,74,4,199,54,140,139,55,252,189,131,131,1,18,80,155,112,167,178,80,153,112,168,179,112,120,115,116,114,114,116,115,120,0,2,0,31,2,229,5,133,5,182,0,20,0,28,0,43,64,21,27,23,23,3,15,12,3,24,7,14,14,0,0,21,24,5,2,2,24,2,114,0,43,50,47,51,16,204,50,17,51,17,51,17,23,57,51,17,51,48,49,65,17,51,19,19,51,17,35,17,52,54,55,35,3,35,3,35,22,22,21,17,33,17,35,53,33,21,35,17,2,146,179,198,204,174,122,4,1,7,211,102,201,8,2,3,253,236,209,2,29,211,2,229,2,209,253,204,2,52,253,47,1,158,23,98,29,253,204,2,52,35,85,20,254,88,2,105,104,104,253,151,255,255,0,79,0,0,5,242,5,205,6,6,1,117,0,0,0,2,0,102,255,221,4,139,4,72,0,25,0,34,0,25,64,12,34,14,14,0,30,9,6,114,18,0,11,114,0,43,50,43,50,18,57,47,51,48,49,69,34,38,2,53,52,62,2,51,50,22,22,21,33,17,22,22,51,50,54,55,23,14,2,19,17,38,38,35,34,6,7,17,2,121,173,237,121,93,156,188,94,151,239,140,252,197,44,161,92,149,177,69,72,48,120,172,172,38,157,106,101,147,47,35,160,1,2,147,148,214,138,66,138,253,175,254,156,47,76,123,111,41,76,127,76,2,139,1,21,40,79,71,46,254,233,0,0,5,0,62,255,241,5,244,5,182,0,3,0,17,0,31,0,56,0,68,0,46,64,25,57,51,39,25,4,63,45,32,18,3,3,32,13,114,13,14,9,3,4,15,1,1,15,4,114,0,43,50,47,16,204,23,57,43,50,47,50,16,204,50,23,57,48,49,115,1,51,1,3,17,52,54,54,55,6,6,7,7,39,37,51,17,1,50,54,53,52,38,39,39,14,2,21,20,22,23,34,38,53,52,54,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,21,20,6,3,54,54,53,52,38,35,34,6,21,20,22,233,3,111,143,252,146,45,2,4,1,22,50,29,110,66,1,12,137,2,240,88,86,91,83,27,48,65,32,86,89,147,158,42,73,46,66,69,165,114,113,160,85,65,83,96,168,132,65,77,78,68,68,77,84,5,182,250,74,2,74,2,54,36,63,61,29,19,42,20,76,94,184,252,148,254,18,76,61,60,82,26,10,21,51,65,41,60,77,107,131,113,57,86,64,23,40,90,78,108,117,109,110,76,100,32,34,112,84,113,137,2,19,24,71,58,56,62,62,56,56,72,0,0,5,0,37,255,241,6,24,5,201,0,3,0,45,0,59,0,84,0,96,0,57,64,30,52,53,67,79,85,5,91,73,60,46,3,3,60,13,114,40,39,20,20,17,17,11,4,33,26,1,1,33,5,114,0,43,50,47,50,16,204,50,57,47,51,18,57,57,43,50,47,50,16,204,50,23,57,48,49,97,1,51,1,3,34,38,39,53,22,22,51,50,54,53,52,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,7,21,22,22,21,20,6,1,50,54,53,52,38,39,39,14,2,21,20,22,23,34,38,53,52,54,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,21,20,6,3,54,54,53,52,38,35,34,6,21,20,22,1,49,3,111,142,252,146,144,75,131,61,68,138,62,108,103,119,108,119,119,104,97,85,64,64,111,55,68,62,140,94,143,146,89,62,81,95,171,3,4,89,85,91,83,27,47,65,33,86,89,146,159,42,74,46,66,69,165,113,113,161,86,65,83,97,168,133,65,77,78,68,68,77,85,5,182,250,74,2,58,27,30,121,33,35,86,76,76,69,106,82,67,65,64,43,35,88,46,54,127,98,83,106,19,7,16,104,83,119,149,254,34,76,61,60,82,26,10,21,51,65,41,60,77,107,131,113,57,86,64,23,40,90,78,108,117,109,110,76,100,32,34,112,84,113,137,2,19,24,71,58,56,62,62,56,56,72,0,5,0,72,255,241,6,22,5,182,0,3,0,34,0,48,0,73,0,85,0,61,64,32,41,42,56,68,74,5,80,62,49,35,3,3,49,13,114,20,21,21,17,17,26,29,29,11,4,22,25,1,1,22,4,114,0,43,50,47,50,16,204,50,57,47,51,51,17,51,17,51,43,50,47,50,16,204,50,23,57,48,49,97,1,51,1,3,34,38,39,53,22,22,51,50,54,53,52,38,35,34,6,7,39,19,33,21,33,7,54,54,51,50,22,21,20,6,1,50,54,53,52,38,39,39,14,2,21,20,22,23,34,38,53,52,54,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,21,20,6,3,54,54,53,52,38,35,34,6,21,20,22,1,42,3,111,142,252,146,116,67,142,44,56,137,56,95,111,110,101,52,77,30,61,33,1,235,254,132,20,26,61,36,137,181,173,2,252,89,85,91,83,26,48,65,33,86,90,147,159,42,74,46,66,69,165,113,113,161,86,65,83,97,168,133,65,78,79,68,68,77,85,5,182,250,74,2,55,29,26,128,33,38,85,91,81,89,17,8,39,1,167,105,234,5,9,143,128,142,157,254,37,76,61,60,82,26,10,21,51,65,41,60,77,107,131,113,57,86,64,23,40,90,78,108,117,109,110,76,100,32,34,112,84,113,137,2,19,24,71,58,56,62,62,56,56,72,0,0,5,0,94,255,241,6,4,5,182,0,3,0,10,0,24,0,48,0,60,0,45,64,24,17,18,31,43,49,5,55,37,25,11,3,3,25,13,114,9,6,4,7,1,1,7,4,114,0,43,50,47,16,204,51,51,43,50,47,50,16,204,50,23,57,48,49,115,1,51,1,3,1,33,53,33,21,1,1,50,54,53,52,38,39,39,14,2,21,20,22,23,34,38,53,52,54,55,38,38,53,52,54,51,50,22,21,20,6,7,22,22,21,20,6,3,54,54,53,52,38,35,34,6,21,20,22,209,3,111,142,252,146,152,1,96,254,54,2,87,254,159,3,126,89,85,90,83,28,48,65,32,86,90,146,159,92,69,66,69,165,113,113,162,86,65,83,96,168,133,65,77,77,68,69,76,83,5,182,250,74,2,74,2,249,115,94,252,242,254,18,76,61,60,82,26,10,21,51,65,41,60,77,107,131,113,86,109,35,40,90,78,108,117,109,110,76,100,32,34,112,84,113,137,2,19,24,71,58,56,62,62,56,56,72,0,0,2,0,101,255,236,4,50,5,200,0,38,0,54,0,31,64,15,52,24,39,39,21,21,0,47,11,19,114,31,0,3,114,0,43,50,43,50,18,57,47,51,17,51,51,48,49,65,50,30,2,21,20,2,14,2,35,34,38,38,53,52,62,3,51,50,22,23,54,54,53,46,2,35,34,6,7,53,62,2,19,34,14,2,21,20,22,51,50,62,2,55,38,38,2,139,121,163,97,42,44,93,145,201,130,135,158,67,36,76,122,172,113,93,145,45,2,2,1,62,123,93,61,141,53,34,91,103,36,94,137,89,43,93,103,83,135,102,68,15,22,122,5,200,85,151,198,114,123,254,247,248,199,117,110,179,105,78,175,168,136,81,90,74,22,49,18,133,179,90,44,35,159,17,27,17,253,169,99,157,176,77,109,143,98,162,197,99,86,119,255,255,0,37,0,0,4,125,5,182,6,6,1,97,0,0,0,1,0,199,254,17,5,33,5,182,0,7,0,14,181,6,1,2,114,4,0,0,47,50,43,50,48,49,83,17,33,17,35,17,33,17,199,4,90,170,252,249,254,17,7,165,248,91,7,13,248,243,0,1,0,74,254,17,4,218,5,182,0,11,0,29,64,13,3,7,7,8,2,0,4,2,114,1,9,9,0,0,47,50,17,51,43,18,57,57,51,17,51,48,49,83,53,1,1,53,33,21,33,1,1,33,21,74,2,121,253,152,4,62,252,175,2,68,253,165,3,169,254,17,105,3,158,3,52,106,150,252,253,252,138,150,0,1,0,103,2,142,4,42,3,22,0,3,0,8,177,1,0,0,47,50,48,49,83,53,33,21,103,3,195,2,142,136,136,0,0,1,0,37,255,242,4,190,6,153,0,8,0,23,64,10,2,3,5,2,3,3,6,0,19,114,0,43,47,57,47,17,57,17,51,48,49,69,1,35,53,33,19,1,51,1,1,241,254,233,181,1,29,238,2,5,137,253,177,14,3,14,133,253,80,5,196,249,89,0,0,3,0,117,1,147,5,45,4,13,0,26,0,38,0,50,0,39,64,19,30,18,18,7,45,27,21,4,4,42,24,24,4,36,10,10,48,4,18,0,63,51,51,17,51,17,51,47,51,18,23,57,51,17,51,48,49,65,20,6,6,35,34,38,39,6,6,35,34,38,38,53,52,54,54,51,50,22,23,54,54,51,50,22,5,38,38,35,34,6,21,20,22,51,50,54,37,52,38,35,34,6,7,22,22,51,50,54,5,45,74,133,89,91,154,65,62,153,88,88,135,76,75,135,89,86,154,64,59,156,95,132,163,253,98,52,110,71,83,96,92,88,68,112,2,84,98,82,67,110,55,51,112,70,82,97,2,208,86,145,86,106,116,106,112,80,142,94,88,142,84,105,115,104,113,174,137,101,91,111,82,79,112,93,96,83,109,92,100,98,94,110,0,1,0,9,254,20,2,247,6,20,0,29,0,14,181,22,15,0,114,7,0,0,47,50,43,50,48,49,83,34,38,39,53,22,22,51,50,54,53,17,52,54,54,51,50,22,23,21,38,38,35,34,6,6,21,17,20,6,146,37,74,26,23,65,34,96,83,78,146,100,33,69,23,22,60,32,63,77,34,177,254,20,12,9,136,8,15,130,111,5,28,129,161,75,9,8,139,9,14,60,109,75,250,229,192,172,255,255,0,103,1,142,4,41,4,27,6,39,0,97,0,0,0,200,2,7,0,97,0,0,255,61,0,1,0,103,0,165,4,40,5,2,0,19,0,39,64,17,1,0,0,2,19,19,5,16,15,11,10,10,9,12,12,6,15,0,47,51,51,17,51,51,47,51,16,206,50,50,17,51,51,47,51,48,49,65,23,7,33,21,33,3,33,21,33,3,39,55,33,53,33,19,33,53,33,3,3,123,111,1,25,254,170,131,1,217,253,232,132,122,109,254,232,1,86,127,254,43,2,20,5,2,57,232,135,254,238,135,254,228,55,229,135,1,18,135,255,255,0,103,255,255,4,42,4,221,6,38,0,31,0,5,0,7,2,42,0,0,253,113,255,255,0,103,255,255,4,42,4,221,6,38,0,33,0,5,0,7,2,42,0,0,253,113,0,2,0,108,0,0,4,58,5,193,0,5,0,9,0,25,64,13,4,9,1,7,4,0,8,2,2,114,6,0,8,0,63,50,43,50,18,23,57,48,49,97,1,1,51,1,1,39,9,2,2,47,254,61,1,195,73,1,194,254,62,36,1,66,254,190,254,192,2,223,2,226,253,30,253,33,199,2,24,2,25,253,231,0,0,1,0,217,4,217,3,194,6,11,0,15,0,18,183,15,9,128,12,15,4,1,4,0,47,93,51,26,204,50,48,49,65,14,2,35,34,38,38,39,51,22,22,51,50,54,55,3,194,9,83,160,125,129,157,75,7,156,11,96,108,96,110,11,6,11,101,136,69,67,136,103,110,80,84,106,0,1,1,137,4,205,2,117,6,20,0,12,0,14,180,1,7,12,128,5,0,47,26,205,57,57,48,49,65,21,14,2,7,35,53,62,3,55,2,117,9,46,59,31,91,11,21,20,15,4,6,20,17,39,111,114,46,23,29,76,85,81,33,0,255,255,255,131,254,59,0,125,255,131,4,7,4,113,254,15,0,0,0,1,1,129,4,216,2,125,6,32,0,11,0,14,180,1,11,128,7,6,0,47,51,26,205,50,48,49,65,21,14,2,7,35,53,62,2,55,2,125,16,36,29,6,165,11,47,65,37,6,32,23,34,110,117,44,19,38,111,115,45,0,0,2,0,21,3,84,2,181,6,199,0,10,0,19,0,29,64,13,6,11,11,9,9,4,1,1,3,120,15,7,119,0,63,51,228,57,47,51,51,17,51,17,51,48,49,65,35,21,35,53,33,53,1,51,17,51,33,53,52,54,55,6,6,7,3,2,181,128,142,254,110,1,149,139,128,254,242,3,3,11,61,23,177,4,33,205,205,98,2,68,253,204,207,44,110,49,25,94,34,254,255,0,0,1,0,62,3,66,2,139,6,193,0,30,0,31,64,14,29,28,28,25,25,3,6,6,19,12,120,2,30,119,0,63,51,228,50,57,47,51,51,17,51,17,51,48,49,65,21,33,7,54,54,51,50,22,21,20,6,35,34,38,39,53,22,22,51,50,54,53,52,38,35,34,6,7,39,19,2,98,254,132,19,26,61,36,137,180,172,164,67,140,46,56,138,55,95,112,109,101,54,76,31,60,33,6,193,106,233,5,8,142,128,142,157,28,26,128,33,38,86,90,81,89,16,8,38,1,168,0,0,1,0,58,3,84,2,146,6,193,0,6,0,16,182,5,1,1,6,120,3,119,0,63,228,51,17,51,48,49,83,1,33,53,33,21,1,163,1,97,254,54,2,88,254,158,3,84,2,250,115,94,252,241,0,3,0,52,3,69,2,148,6,208,0,25,0,39,0,51,0,23,64,12,39,26,20,6,46,5,33,12,120,40,0,119,0,63,50,228,50,23,57,48,49,65,50,22,21,20,6,7,22,22,21,20,6,35,34,38,38,53,52,54,54,55,38,38,53,52,54,19,14,2,21,20,22,51,50,54,53,52,38,39,19,34,6,21,20,22,23,54,54,53,52,38,1,101,113,161,86,65,83,97,168,135,97,137,71,42,74,46,66,69,165,84,48,65,33,86,86,89,85,91,83,1,68,77,85,64,65,78,79,6,208,109,110,76,100,32,34,112,84,113,137,59,110,75,57,86,64,23,40,90,78,108,117,254,27,21,51,65,41,60,77,76,61,60,81,27,1,134,62,56,56,72,25,24,71,58,56,62,0,22,0,84,254,129,7,193,5,238,0,5,0,11,0,17,0,23,0,27,0,31,0,35,0,39,0,43,0,47,0,51,0,55,0,59,0,63,0,67,0,71,0,83,0,95,0,111,0,120,0,129,0,144,0,39,64,18,18,24,24,44,44,28,28,12,19,7,57,57,53,53,33,33,1,17,0,63,51,17,51,17,51,17,51,63,51,17,51,17,51,17,51,48,49,83,17,33,21,35,21,37,53,33,17,35,53,1,17,51,21,51,21,33,53,51,53,51,17,33,53,33,21,33,53,33,21,1,53,33,21,1,35,17,51,17,35,17,51,1,53,33,21,1,35,17,51,1,53,33,21,51,53,33,21,1,35,17,51,53,35,17,51,1,35,17,51,5,20,6,35,34,38,53,52,54,51,50,22,5,20,22,51,50,54,53,52,38,35,34,6,37,51,50,22,21,20,6,7,21,22,22,21,20,6,35,35,19,51,50,54,53,52,38,35,35,21,21,51,50,54,53,52,38,35,1,34,39,53,22,22,51,50,54,53,17,51,17,20,6,84,1,47,192,5,206,1,48,109,249,0,111,192,5,14,195,109,253,73,1,17,251,225,1,14,254,242,1,14,4,183,109,109,109,109,251,194,1,16,252,48,111,111,2,192,1,16,119,1,17,250,168,111,111,111,111,6,254,109,109,251,159,127,135,135,127,127,135,135,127,254,115,66,69,71,64,64,71,69,66,1,225,172,110,111,46,44,45,62,109,94,207,123,66,46,36,42,47,59,74,49,37,38,52,1,94,48,32,16,32,20,37,49,125,111,4,190,1,48,111,193,193,111,254,208,193,249,2,1,47,194,109,109,194,254,209,109,109,109,109,6,254,111,111,250,168,1,14,2,2,1,15,250,59,109,109,1,166,1,14,4,74,111,111,111,111,252,47,1,16,121,1,15,253,104,1,16,73,135,166,166,135,137,164,164,137,92,105,105,92,92,104,104,201,67,83,49,66,8,8,9,57,69,80,90,1,98,34,32,34,29,227,154,43,37,32,42,254,250,10,102,3,5,36,50,1,146,254,114,101,93,0,0,3,0,84,254,193,7,170,6,20,0,3,0,33,0,45,0,23,64,9,33,37,2,23,15,43,43,2,0,0,47,47,57,47,57,57,18,57,51,48,49,65,9,2,5,53,52,54,55,62,2,53,52,38,35,34,6,6,7,23,54,54,51,50,22,21,20,6,7,6,6,21,21,3,20,22,51,50,54,53,52,38,35,34,6,3,254,3,172,252,84,252,86,3,235,42,67,59,78,39,189,163,57,121,112,46,82,68,127,55,63,62,53,68,76,67,27,81,60,56,83,83,56,60,81,6,20,252,86,252,87,3,169,251,47,50,62,52,47,84,98,67,137,152,27,44,27,178,34,46,58,47,58,71,53,61,113,80,59,254,237,72,63,63,72,76,61,61,255,255,255,144,254,20,2,83,6,32,6,38,3,176,0,0,1,7,1,75,255,96,0,0,0,10,179,17,11,6,114,0,43,206,48,49,255,255,0,26,3,193,1,65,5,182,6,6,2,6,0,0,0,2,0,12,255,236,4,206,6,33,0,59,0,71,0,46,64,21,31,28,28,32,35,5,67,67,8,52,35,52,35,52,0,45,16,9,114,60,0,0,47,50,43,50,17,57,57,47,125,47,17,51,51,17,51,17,51,51,17,51,48,49,65,50,30,2,23,51,21,35,22,22,21,20,2,6,6,35,34,46,2,53,52,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,21,20,6,6,21,20,22,51,50,54,18,53,52,38,39,38,36,38,53,52,54,54,23,34,6,21,20,22,22,23,46,3,2,68,110,172,126,81,18,143,132,2,2,66,135,208,141,105,142,86,37,15,14,38,33,25,51,16,36,35,95,52,97,81,14,15,102,113,124,167,85,2,2,252,254,204,140,74,155,116,93,90,104,232,191,13,61,89,114,6,33,80,153,220,140,139,22,56,30,161,254,238,202,112,58,101,129,70,57,111,99,35,48,38,17,9,118,17,24,104,80,47,107,117,62,93,134,137,1,20,206,24,57,22,3,113,193,121,85,137,80,137,93,82,80,126,73,2,109,170,117,60,0,1,0,0,0,0,4,128,5,195,0,29,0,27,64,15,24,27,0,3,26,28,2,114,26,8,114,16,9,3,114,0,43,50,43,43,18,23,57,48,49,65,62,3,55,62,2,51,50,22,23,21,38,38,35,34,6,7,14,3,7,17,35,17,1,51,2,57,35,75,74,66,26,28,61,77,52,29,44,16,12,32,14,29,57,37,24,78,90,90,37,173,254,33,186,2,206,81,175,168,139,45,49,66,34,8,8,133,3,3,36,65,42,149,189,207,100,253,224,2,47,3,135,0,0,2,0,22,255,236,6,124,4,72,0,27,0,52,0,45,64,23,40,40,17,2,28,28,24,24,26,27,6,114,13,14,36,36,17,11,114,46,10,11,114,0,43,50,43,50,17,51,51,43,50,50,17,51,17,51,17,57,47,48,49,65,21,35,30,2,21,20,6,6,35,34,38,39,35,6,6,35,34,38,53,52,54,54,55,33,53,55,5,33,14,2,21,20,22,51,50,54,53,53,51,21,20,22,22,51,50,54,53,52,38,38,6,124,249,35,51,28,87,171,128,113,143,33,7,34,143,111,186,199,33,58,37,254,236,146,4,56,252,237,33,57,35,123,108,100,100,161,49,90,63,107,120,27,48,4,72,139,79,166,169,85,156,213,109,96,91,91,96,237,241,85,171,166,77,74,65,139,71,163,171,85,195,154,153,119,200,200,87,121,64,157,192,85,169,162,255,255,0,200,0,0,6,106,7,144,6,38,0,48,0,0,1,7,0,118,2,214,1,111,0,10,179,31,9,2,114,0,43,206,48,49,255,255,0,175,0,0,6,194,6,33,6,38,0,80,0,0,1,7,0,118,3,6,0,0,0,10,179,47,33,7,114,0,43,206,48,49,255,255,0,0,253,211,5,13,5,188,6,38,0,36,0,0,0,7,2,83,1,52,0,0,255,255,0,94,253,211,3,203,4,90,6,38,0,68,0,0,1,7,2,83,0,199,0,0,0,16,181,3,2,47,11,1,1,184,255,150,176,86,0,43,52,52,0,2,0,117,253,211,2,53,255,130,0,11,0,23,0,16,180,12,0,192,18,6,0,124,47,51,26,24,204,50,48,49,65,34,38,53,52,54,51,50,22,21,20,6,39,50,54,53,52,38,35,34,6,21,20,22,1,82,97,124,123,98,95,132,130,97,53,67,70,50,52,67,61,253,211,114,101,100,116,116,98,103,114,96,64,55,57,63,63,57,55,64,0,2,0,125,255,236,6,98,6,20,0,28,0,43,0,27,64,13,23,21,17,26,5,40,14,3,114,33,5,9,114,0,43,50,43,50,18,57,57,206,50,48,49,65,20,2,6,6,35,34,38,38,2,53,52,18,36,51,50,22,23,62,2,53,51,23,6,6,7,22,22,5,20,18,22,51,50,54,18,53,16,2,35,34,6,2,5,186,85,169,249,165,171,253,167,82,148,1,44,228,167,253,85,56,58,22,178,14,21,116,125,47,47,251,118,105,219,170,171,216,102,234,252,171,220,106,2,221,169,254,235,199,108,108,200,1,22,169,224,1,82,188,114,102,16,79,118,74,21,125,198,47,88,217,127,186,254,240,148,148,1,16,186,1,26,1,64,146,254,242,0,2,0,114,255,236,5,24,4,240,0,26,0,41,0,27,64,13,20,18,14,24,4,39,11,7,114,31,4,11,114,0,43,50,43,50,18,57,57,206,50,48,49,65,20,6,6,35,34,38,38,53,16,0,51,50,22,23,62,2,53,51,23,14,2,7,22,22,5,20,22,22,51,50,54,54,53,52,38,38,35,34,6,4,96,123,227,157,146,226,127,1,15,235,109,181,65,59,60,20,176,14,16,62,101,76,34,37,252,190,69,147,115,116,146,69,69,146,117,172,158,2,38,180,255,135,135,255,180,1,14,1,40,74,68,19,81,118,72,21,94,146,102,29,65,162,95,140,193,99,100,193,139,138,190,98,217,0,0,1,0,185,255,236,6,120,6,20,0,31,0,29,64,14,7,5,31,31,1,12,17,21,2,114,26,17,9,114,0,43,50,43,18,57,57,51,47,206,50,48,49,65,21,62,2,53,51,23,14,3,7,17,20,6,6,35,32,0,53,17,51,17,20,22,51,50,54,54,53,17,5,26,65,69,27,175,14,12,45,79,124,90,117,244,192,254,235,254,221,171,201,200,134,168,78,5,182,200,11,76,124,83,21,73,129,103,70,16,253,140,155,242,139,1,38,246,3,174,252,75,184,202,97,174,114,3,182,0,0,1,0,163,255,236,5,143,4,242,0,34,0,41,64,21,1,0,28,28,30,6,14,19,6,114,9,10,10,24,24,14,11,114,7,10,114,0,43,43,50,17,51,17,51,43,18,57,57,51,47,204,50,48,49,65,23,14,3,7,17,35,39,35,14,2,35,34,38,38,53,17,51,17,20,22,51,50,54,53,17,51,21,62,2,53,5,129,14,11,45,78,121,88,136,24,9,34,106,134,75,132,178,89,168,124,127,182,149,167,64,66,24,4,242,22,72,132,106,70,10,252,170,154,57,78,39,84,176,138,2,204,253,64,137,135,206,195,2,63,122,12,78,124,80,0,0,1,253,5,4,184,254,115,6,145,0,21,0,21,64,9,6,3,12,19,192,15,4,1,4,0,47,93,26,204,50,57,57,48,49,65,20,6,7,7,35,39,54,54,53,52,38,35,34,6,7,53,54,54,51,50,22,254,115,94,73,9,104,13,77,87,77,59,28,55,18,20,56,39,121,130,5,218,77,85,17,111,173,13,49,49,49,36,5,4,100,6,7,91,255,255,0,200,0,0,3,246,7,144,6,38,0,40,0,0,1,7,0,67,1,21,1,111,0,10,179,18,2,2,114,0,43,206,48,49,255,255,0,202,0,0,5,77,7,144,6,38,1,177,0,0,1,7,0,67,1,194,1,111,0,10,179,28,0,2,114,0,43,206,48,49,255,255,0,114,255,236,4,19,6,33,6,38,0,72,0,0,1,7,0,67,0,234,0,0,0,10,179,38,0,7,114,0,43,206,48,49,255,255,0,175,0,0,4,100,6,33,6,38,1,209,0,0,1,7,0,67,1,61,0,0,0,10,179,25,18,6,114,0,43,206,48,49,0,1,0,52,255,245,7,30,5,182,0,43,0,30,64,16,31,20,20,26,11,42,16,4,0,5,2,114,37,0,9,114,0,43,50,43,18,23,57,51,17,51,48,49,69,38,10,2,39,51,22,26,2,23,51,54,54,55,19,46,2,39,51,22,26,2,23,51,54,18,18,19,51,10,2,7,35,46,3,39,1,1,232,84,150,118,75,9,176,10,67,96,108,50,10,14,49,31,207,12,21,13,2,177,6,67,102,120,58,7,84,126,72,3,178,5,93,172,125,150,51,99,90,74,26,254,224,11,147,1,90,1,125,1,143,200,189,254,147,254,179,254,229,107,58,153,84,2,44,71,148,144,63,176,254,153,254,172,254,215,115,165,1,143,1,208,1,3,254,234,253,244,254,40,199,84,200,213,210,93,252,224,0,1,0,39,0,0,6,14,4,74,0,40,0,31,64,17,40,30,30,35,21,26,9,27,5,11,16,6,114,5,11,10,114,0,43,50,43,18,23,57,51,17,51,48,49,65,6,2,2,7,35,46,2,39,3,35,38,38,2,2,39,51,22,18,18,23,51,62,2,55,19,38,38,39,51,22,18,18,23,51,54,18,18,55,6,14,9,89,160,117,156,42,85,73,26,246,151,64,123,100,64,6,164,12,85,116,57,6,13,35,37,17,155,25,27,3,166,5,70,109,62,8,76,122,77,10,4,74,200,254,138,254,158,170,72,172,179,82,254,7,102,248,1,26,1,50,160,197,254,158,254,220,105,35,71,73,37,1,56,101,219,100,168,254,176,254,198,135,117,1,43,1,91,190,0,2,0,20,0,0,4,252,5,182,0,19,0,29,0,36,64,10,7,10,10,4,1,29,11,11,0,5,184,255,255,180,114,20,0,8,114,0,43,50,43,18,57,47,51,205,50,50,17,51,48,49,97,17,33,53,33,53,51,21,33,21,33,17,51,50,22,22,21,20,6,33,39,51,50,54,53,52,38,38,35,35,1,87,254,189,1,67,172,1,164,254,92,205,209,243,104,249,254,235,235,215,194,176,85,177,137,186,4,83,143,212,212,143,254,245,107,187,119,196,231,145,140,142,98,115,50,0,0,2,0,20,0,0,4,159,5,39,0,19,0,28,0,33,64,16,21,5,5,1,22,14,10,114,16,4,4,19,17,1,6,114,0,43,50,205,51,17,51,43,50,17,57,47,51,48,49,65,21,33,21,33,17,33,50,22,21,20,6,6,35,33,17,35,53,51,53,1,33,17,33,50,54,53,52,38,1,172,1,93,254,163,1,65,220,214,91,194,155,254,33,244,244,1,214,254,206,1,51,128,156,147,5,39,223,139,254,197,156,152,102,150,82,3,189,139,223,252,209,254,143,89,102,100,78,0,0,1,0,200,255,236,7,37,5,203,0,42,0,39,64,21,11,28,28,4,31,31,0,23,16,3,114,8,2,114,7,8,114,36,0,9,114,0,43,50,43,43,43,50,18,57,47,51,51,17,51,48,49,69,34,36,2,39,33,17,35,17,51,17,33,62,3,55,50,22,23,7,38,38,35,34,14,2,7,33,21,33,30,3,51,50,54,55,21,6,6,5,120,222,254,218,149,7,254,154,170,170,1,107,14,103,177,249,159,112,201,81,68,71,163,98,113,180,131,80,14,2,191,253,61,5,69,129,189,124,99,171,84,80,176,20,176,1,61,214,253,81,5,182,253,143,144,237,171,93,1,51,41,145,35,52,66,127,184,119,149,132,207,145,75,33,25,148,30,29,0,1,0,175,255,236,5,175,4,92,0,39,0,38,64,20,22,15,7,114,26,10,10,29,5,5,7,8,6,114,7,10,33,0,11,114,0,43,50,63,43,18,57,47,51,51,17,51,43,50,48,49,69,34,38,38,39,33,17,35,17,51,17,33,62,2,51,50,22,23,7,38,38,35,34,6,6,7,33,21,33,30,2,51,50,54,55,21,6,6,4,135,147,225,133,9,254,209,167,167,1,49,17,140,222,139,83,152,55,48,55,128,59,108,148,81,11,2,30,253,224,6,79,149,110,88,135,60,56,132,20,111,228,174,254,19,4,72,254,51,166,213,102,33,25,137,23,29,75,150,113,142,122,165,84,36,25,145,28,30,0,2,0,0,0,0,5,92,5,182,0,11,0,24,0,35,64,17,4,7,7,12,11,18,18,9,11,2,114,2,6,6,9,8,114,0,43,50,17,51,43,18,57,47,18,57,51,17,51,48,49,65,1,35,1,35,17,35,17,35,1,35,1,23,14,3,7,7,33,39,46,3,3,0,2,92,180,254,236,153,155,154,254,233,175,2,92,81,6,21,25,27,12,80,1,88,88,11,23,22,20,5,182,250,74,2,166,253,90,2,166,253,90,5,182,169,23,65,72,72,30,206,222,29,60,61,63,0,0,2,0,7,0,0,4,106,4,72,0,11,0,23,0,35,64,17,4,7,7,12,11,18,18,9,11,6,114,2,6,6,9,10,114,0,43,50,17,51,43,18,57,47,18,57,51,17,51,48,49,65,1,35,3,35,17,35,17,35,3,35,1,23,35,14,2,7,7,33,39,46,2,2,157,1,205,170,201,114,150,120,197,171,1,204,105,8,10,22,25,15,63,1,22,63,15,28,21,4,72,251,184,1,227,254,29,1,227,254,29,4,72,116,33,63,66,36,161,159,40,73,63,0,0,2,0,200,0,0,7,97,5,182,0,19,0,32,0,48,64,23,26,17,17,12,4,8,8,20,15,12,12,14,19,15,2,114,2,6,6,10,10,14,8,0,63,51,17,51,17,51,43,50,18,57,47,18,57,51,17,51,17,51,17,51,48,49,65,1,35,1,35,17,35,17,35,1,35,1,33,17,35,17,51,17,33,1,23,14,3,7,7,33,39,46,3,5,6,2,91,186,254,237,148,154,151,254,234,181,1,26,254,84,170,170,1,235,1,3,81,7,19,21,25,15,81,1,79,84,12,23,21,19,5,182,250,74,2,172,253,84,2,172,253,84,2,172,253,84,5,182,253,140,2,116,169,30,59,61,65,36,210,220,32,61,59,59,0,2,0,175,0,0,6,14,4,72,0,19,0,31,0,46,64,22,26,17,17,12,4,8,8,21,12,12,14,19,15,6,114,2,6,6,9,9,14,10,0,63,51,17,51,17,51,43,50,17,57,47,57,51,17,51,17,51,17,51,48,49,65,1,35,3,35,17,35,17,35,3,35,19,33,17,35,17,51,17,33,19,23,35,14,2,7,7,33,39,46,2,4,66,1,204,169,203,114,150,114,204,170,206,254,218,163,163,1,99,195,105,7,9,24,27,16,61,1,20,62,15,27,20,4,72,251,184,1,234,254,22,1,234,254,22,1,234,254,22,4,72,254,46,1,210,116,26,69,77,38,142,156,40,71,62,0,2,0,23,0,0,5,175,5,182,0,30,0,33,0,38,64,18,33,2,2,28,28,13,16,16,21,32,30,2,114,8,15,15,21,8,0,63,51,17,51,43,50,17,57,47,51,51,17,51,17,51,48,49,65,21,1,30,2,23,19,35,3,46,2,35,17,35,17,34,6,6,7,3,35,19,62,3,55,1,53,5,33,1,5,42,254,89,135,157,92,35,137,173,137,30,67,117,106,171,105,115,65,30,136,180,137,26,61,90,136,100,254,97,3,190,253,14,1,121,5,182,126,254,11,8,91,163,115,254,54,1,197,98,109,43,253,65,2,191,44,108,98,254,59,1,202,85,134,96,56,6,1,245,126,153,254,57,0,2,0,12,0,0,5,3,4,72,0,29,0,32,0,38,64,18,32,2,2,27,27,13,16,16,21,31,29,6,114,8,15,15,21,10,0,63,51,17,51,43,50,18,57,47,51,51,17,51,17,51,48,49,65,21,1,30,2,23,19,35,3,46,2,35,17,35,17,34,6,6,7,3,35,19,62,2,55,1,53,5,33,1,4,125,254,176,112,124,72,32,130,167,128,27,59,94,83,154,86,94,55,29,130,165,129,33,72,125,110,254,176,3,27,253,183,1,36,4,72,100,254,152,10,77,127,85,254,175,1,74,72,82,35,253,249,2,7,34,83,72,254,182,1,81,83,127,78,11,1,104,100,137,254,191,0,2,0,200,0,0,7,195,5,182,0,35,0,38,0,63,64,31,1,34,34,37,35,35,30,38,2,2,32,32,27,13,16,16,27,27,29,30,2,114,29,8,8,15,15,22,22,28,8,0,63,51,17,51,17,51,63,43,18,57,47,51,17,51,17,51,17,51,17,51,17,51,17,51,51,17,51,48,49,65,21,1,30,2,23,19,35,3,46,2,35,17,35,17,34,6,6,7,3,35,19,54,54,55,33,17,35,17,51,17,33,1,53,5,33,1,7,60,254,90,135,157,91,35,139,168,139,32,71,117,104,172,104,118,67,29,136,178,145,27,57,39,254,62,170,170,2,214,254,103,3,191,253,16,1,121,5,182,126,254,9,7,91,162,115,254,54,1,197,103,106,39,253,67,2,189,45,108,95,254,59,1,209,87,109,31,253,76,5,182,253,148,1,238,126,153,254,55,0,2,0,175,0,0,6,173,4,72,0,35,0,38,0,58,64,28,1,34,34,37,35,35,30,38,2,2,13,13,16,16,32,27,27,28,30,6,114,8,15,15,22,22,28,10,0,63,51,17,51,17,51,43,18,57,47,51,51,17,51,17,51,17,51,17,51,17,51,51,17,51,48,49,65,21,1,30,2,23,19,35,3,46,2,35,17,35,17,34,6,6,7,3,35,19,54,54,55,33,17,35,17,51,17,33,1,53,5,33,1,6,40,254,176,112,124,71,32,130,166,128,27,59,94,83,153,84,96,57,28,130,166,130,20,45,26,254,191,163,163,2,56,254,178,3,27,253,182,1,37,4,72,100,254,150,10,76,126,85,254,175,1,74,71,81,35,253,251,2,5,34,82,71,254,182,1,81,52,85,25,254,13,4,72,254,54,1,102,100,137,254,197,0,0,1,0,64,254,79,4,55,6,209,0,90,0,61,64,29,36,32,32,47,17,16,64,64,55,25,47,61,61,10,43,47,7,0,0,82,84,128,87,78,78,71,10,3,114,0,43,50,50,17,51,26,204,50,50,47,51,47,51,18,57,47,18,57,57,51,18,57,57,17,51,17,51,48,49,65,50,22,23,21,38,38,35,34,6,7,22,22,21,20,6,7,21,22,22,21,20,14,2,7,14,2,21,20,22,51,50,54,54,51,50,22,23,21,38,38,35,34,6,6,35,34,38,38,53,52,54,54,55,54,54,53,52,38,35,35,53,51,50,54,54,53,52,38,35,34,6,7,39,54,54,55,46,2,39,53,51,22,22,23,62,2,3,87,32,50,17,13,38,18,49,111,47,180,191,194,155,180,199,66,137,214,149,114,118,42,75,103,84,127,117,67,86,103,30,22,109,97,64,110,123,86,134,156,66,88,196,162,202,189,243,208,210,205,143,190,95,168,135,124,193,87,83,76,178,111,34,82,79,31,122,50,122,52,40,88,101,6,209,9,5,109,5,6,89,68,23,194,140,149,175,26,7,26,175,147,96,155,111,62,4,4,33,53,35,49,59,7,7,21,17,162,17,33,5,6,67,116,73,80,115,66,5,5,141,142,145,125,143,67,123,84,115,124,71,56,116,52,77,14,41,87,82,30,25,33,109,55,49,93,61,0,0,1,0,27,254,123,3,128,5,77,0,91,0,59,64,28,36,32,32,47,16,17,66,66,55,25,47,63,63,10,43,47,7,0,0,83,85,128,88,79,72,10,6,114,0,43,50,50,50,26,204,50,50,47,51,47,51,18,57,47,18,57,57,51,18,57,57,17,51,17,51,48,49,65,50,22,23,21,38,38,35,34,6,7,22,22,21,20,6,7,21,30,2,21,20,6,6,7,14,2,21,20,22,51,50,54,54,51,50,22,23,21,38,38,35,34,6,6,35,34,38,38,53,52,54,54,55,62,2,53,52,38,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,55,46,2,39,53,51,22,22,23,62,2,2,251,31,50,15,12,38,16,48,103,46,122,141,112,95,67,110,67,98,207,162,105,108,38,73,93,72,130,117,49,68,79,21,25,91,49,47,125,142,73,115,132,54,71,165,140,99,148,81,70,141,106,145,121,143,167,131,120,81,148,80,59,64,121,69,29,70,69,29,121,50,110,56,39,88,102,5,77,8,5,110,5,5,80,62,25,140,107,99,119,26,8,17,65,106,80,92,142,83,4,2,29,49,34,48,47,6,5,21,19,140,20,22,6,6,67,106,59,69,109,67,4,3,38,84,70,65,83,39,137,80,94,82,81,36,35,133,27,36,8,37,79,74,26,25,36,100,56,49,90,58,0,255,255,0,111,0,0,5,238,5,182,6,6,1,116,0,0,255,255,0,163,254,20,5,138,6,18,6,6,1,148,0,0,0,3,0,125,255,236,5,188,5,205,0,17,0,26,0,34,0,25,64,12,31,23,23,5,27,14,3,114,18,5,9,114,0,43,50,43,50,17,57,47,51,48,49,65,20,2,6,6,35,34,38,38,2,53,52,18,36,51,50,4,18,1,50,54,54,55,33,30,2,19,34,6,6,7,33,38,2,5,188,86,169,250,165,170,253,167,83,148,1,45,227,217,1,41,153,253,98,160,212,110,7,252,44,8,109,213,164,158,211,114,11,3,210,17,235,2,221,169,254,235,199,108,108,200,1,22,169,224,1,82,188,186,254,175,252,189,131,245,169,169,244,132,4,184,125,231,160,243,1,17,0,3,0,114,255,236,4,96,4,92,0,14,0,23,0,31,0,25,64,12,27,20,20,4,24,11,7,114,15,4,11,114,0,43,50,43,50,17,57,47,51,48,49,65,20,6,6,35,34,38,38,53,16,0,51,50,22,22,1,50,54,54,55,33,30,2,19,34,6,7,33,46,2,4,96,123,227,157,146,226,127,1,15,235,150,225,125,254,9,108,141,74,6,253,108,6,75,143,106,157,158,14,2,147,9,77,140,2,38,180,255,135,135,255,180,1,14,1,40,134,253,253,157,87,168,120,120,168,87,3,90,176,168,111,153,80,0,1,0,0,0,0,5,70,5,195,0,29,0,23,64,12,0,23,3,114,13,6,7,2,114,6,8,114,0,43,43,18,57,43,50,48,49,65,34,6,6,7,1,35,1,51,1,30,2,23,62,3,55,19,62,2,51,50,22,23,21,38,38,4,227,48,64,53,31,254,180,194,253,239,178,1,88,24,36,29,12,8,21,24,27,16,172,46,81,114,96,35,63,24,24,48,5,54,59,124,100,251,229,5,182,252,67,68,112,99,50,38,80,86,94,51,2,31,148,178,81,14,6,140,8,11,0,1,0,0,0,0,4,62,4,84,0,27,0,23,64,12,19,13,14,6,114,13,10,114,7,0,7,114,0,43,50,43,43,18,57,48,49,65,50,22,23,21,38,38,35,34,6,6,7,1,35,1,51,1,22,22,23,51,54,54,55,19,62,2,3,239,23,39,17,13,37,17,31,46,37,19,254,253,218,254,103,173,1,10,29,41,6,7,9,33,23,151,35,66,93,4,84,6,5,131,5,6,37,76,59,252,219,4,72,253,34,83,126,32,43,141,69,1,208,105,118,47,255,255,0,0,0,0,5,70,7,144,6,38,2,113,0,0,1,7,4,12,4,207,1,111,0,12,180,36,49,7,2,114,0,43,206,206,48,49,255,255,0,0,0,0,4,62,6,33,6,38,2,114,0,0,1,7,4,12,4,98,0,0,0,12,180,34,47,14,6,114,0,43,206,206,48,49,0,3,0,125,254,19,9,156,5,205,0,17,0,33,0,63,0,38,64,22,63,40,41,3,34,58,51,15,45,6,114,34,6,114,30,14,3,114,22,5,9,114,0,43,50,43,50,43,43,63,51,18,23,57,48,49,65,20,2,6,6,35,34,38,38,2,53,52,18,36,51,50,4,18,5,20,18,22,51,50,54,18,53,52,2,38,35,34,6,2,37,51,19,30,2,23,51,54,54,55,19,51,1,14,2,35,34,38,39,53,22,22,51,50,54,54,55,55,5,77,79,155,230,152,156,232,153,75,135,1,20,209,200,1,16,140,251,225,94,195,151,153,192,91,91,192,150,152,196,95,4,114,175,248,21,36,27,9,8,11,54,30,226,175,254,39,38,102,144,101,49,72,27,24,61,35,62,91,67,24,60,2,221,169,254,235,199,108,108,200,1,22,169,224,1,82,188,186,254,175,229,186,254,240,148,148,1,16,186,189,1,13,144,146,254,243,176,253,128,54,102,94,44,50,161,84,2,127,251,23,101,150,81,11,7,133,5,8,47,90,62,154,255,255,0,114,254,19,8,169,4,92,4,38,0,82,0,0,0,7,0,92,4,167,0,0,0,2,0,125,255,140,6,4,6,40,0,29,0,56,0,39,64,19,33,36,30,36,36,3,0,27,9,114,49,46,43,43,15,12,18,3,114,0,43,50,205,51,16,205,51,43,205,51,51,17,51,16,205,48,49,69,34,38,39,46,2,2,53,52,18,36,55,54,54,51,50,22,23,22,22,18,21,20,14,2,7,6,6,3,54,54,51,50,22,23,62,2,53,52,2,39,6,6,35,34,38,39,14,2,21,20,22,22,3,69,54,71,11,141,215,146,74,133,1,1,187,11,71,53,51,71,13,179,254,135,76,145,211,135,13,72,187,17,67,52,47,69,17,130,174,88,199,193,16,70,47,52,67,16,131,178,91,90,178,116,49,56,20,124,195,1,0,151,202,1,57,197,27,56,46,46,56,28,197,254,199,203,151,253,194,125,21,56,49,1,1,45,38,39,44,27,157,247,161,244,1,50,39,46,39,39,45,25,156,246,161,162,248,156,0,2,0,114,255,151,4,193,4,174,0,26,0,51,0,39,64,19,37,34,31,31,20,17,23,7,114,46,49,43,49,49,10,7,4,11,114,0,43,205,51,51,17,51,16,205,43,50,205,51,16,205,51,48,49,65,20,6,6,7,6,6,35,34,38,39,46,2,53,52,18,55,54,54,51,50,22,23,30,2,7,52,38,38,39,6,6,35,34,38,39,6,6,21,20,22,23,54,54,51,50,22,23,54,54,4,193,101,192,135,9,61,52,54,59,9,130,194,107,228,205,8,59,53,51,62,9,131,192,105,172,55,114,89,13,58,49,51,58,11,135,126,126,136,11,58,50,48,60,12,134,124,2,38,157,236,145,23,49,45,44,52,22,143,235,159,235,1,32,34,51,40,40,53,22,146,232,155,113,171,110,20,40,34,35,41,30,212,174,175,216,30,41,33,34,38,31,216,0,3,0,126,255,236,7,169,8,64,0,22,0,41,0,107,0,67,64,35,76,102,9,114,85,92,3,114,12,13,13,19,6,128,22,22,35,24,23,58,51,3,114,105,73,70,70,67,71,71,67,67,42,9,114,0,43,50,17,51,47,17,51,17,51,51,43,50,222,50,204,50,47,26,204,50,51,17,51,43,50,43,50,48,49,65,53,52,62,2,51,50,30,2,51,51,21,35,34,46,2,35,34,6,21,19,53,54,54,53,52,46,2,53,52,54,51,50,22,21,20,6,6,1,34,38,2,53,52,18,54,54,51,50,22,23,7,38,38,35,34,14,2,21,20,18,22,51,50,54,55,17,51,17,22,22,51,50,54,18,53,52,46,2,35,34,6,7,39,54,54,51,50,22,22,18,21,20,2,6,6,35,34,38,39,6,6,2,173,32,60,86,55,60,112,114,128,77,16,20,86,139,115,98,45,57,58,95,59,62,29,39,29,51,42,55,65,53,106,254,222,188,251,125,72,137,193,121,79,151,61,65,47,107,60,86,135,93,48,95,188,139,67,116,52,171,53,119,69,139,187,95,49,93,134,86,61,107,47,65,61,151,79,122,193,136,72,70,141,210,141,108,176,71,72,175,7,74,28,54,81,55,28,36,48,36,119,34,46,34,61,60,254,187,71,18,52,28,20,19,16,27,27,37,37,68,59,53,88,65,249,212,194,1,90,226,168,1,16,193,104,49,42,128,35,41,82,155,221,139,187,254,237,150,49,41,1,190,254,66,43,47,150,1,19,187,139,221,155,82,41,35,128,42,49,104,193,254,240,168,170,254,231,204,111,63,61,61,63,0,0,3,0,119,255,236,6,184,7,0,0,18,0,41,0,103,0,61,64,32,76,98,11,114,83,90,7,114,25,26,26,32,19,128,35,35,0,8,7,58,51,7,114,101,66,70,70,66,66,42,11,114,0,43,50,17,51,47,17,51,43,50,222,50,204,50,47,26,204,50,51,17,51,43,50,43,50,48,49,65,50,22,21,20,6,6,7,53,54,54,53,52,46,2,53,52,54,39,50,30,2,51,51,21,35,34,46,2,35,34,6,21,35,53,52,62,2,3,34,46,2,53,52,18,54,51,50,22,23,7,38,38,35,34,6,21,20,30,2,51,50,54,55,17,51,17,30,2,51,50,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,18,21,20,6,6,35,34,38,39,6,6,3,129,54,66,54,106,78,59,61,29,38,29,49,56,60,112,114,127,76,18,21,87,139,114,98,45,56,58,122,31,60,87,155,109,174,120,64,105,195,135,68,113,49,55,47,86,42,128,135,41,79,113,72,74,109,57,167,38,73,81,50,96,135,71,136,129,40,84,47,56,48,112,69,136,195,105,113,210,144,116,165,53,55,162,6,39,68,58,54,89,64,19,69,20,54,28,20,19,15,25,27,38,37,217,36,46,36,121,35,46,35,59,63,29,54,81,54,27,248,236,75,145,210,134,184,1,0,134,33,27,128,22,26,220,212,98,158,111,59,52,57,1,72,254,186,39,49,23,104,191,131,212,220,26,23,129,27,33,134,255,0,184,179,252,133,83,64,66,81,0,255,255,0,52,255,245,7,30,7,19,6,38,2,93,0,0,1,7,3,137,1,101,1,111,0,10,179,55,5,2,114,0,43,206,48,49,255,255,0,39,0,0,6,14,5,166,6,38,2,94,0,0,1,7,3,137,0,194,0,2,0,10,179,52,16,6,114,0,43,206,48,49,0,1,0,124,254,20,4,226,5,203,0,32,0,19,64,9,16,22,9,114,21,7,0,3,114,0,43,50,47,43,50,48,49,65,50,22,23,7,38,38,35,34,14,2,21,20,18,22,51,50,54,55,17,35,17,34,46,3,53,52,18,54,36,3,74,113,211,84,69,71,170,101,124,198,140,73,112,236,186,47,85,37,170,152,233,169,108,51,96,185,1,10,5,203,45,40,146,34,45,83,157,222,139,183,254,244,146,10,13,253,120,1,216,72,133,186,230,131,165,1,19,201,110,0,0,1,0,114,254,20,3,166,4,92,0,29,0,21,64,11,15,21,11,114,20,15,114,7,0,7,114,0,43,50,43,43,50,48,49,65,50,22,23,7,38,38,35,34,6,6,21,20,22,22,51,50,54,55,17,35,17,34,46,2,53,52,54,54,2,130,81,159,52,48,53,136,60,117,156,78,81,157,114,61,82,38,166,130,200,138,71,137,238,4,92,33,25,139,20,32,93,190,144,147,186,89,23,16,253,115,1,216,67,137,213,145,200,254,120,0,0,1,0,109,255,254,4,110,5,5,0,19,0,12,179,5,12,10,0,0,47,47,57,57,48,49,65,23,3,5,7,37,3,5,7,37,3,39,19,37,55,5,19,37,55,5,3,151,113,186,1,32,65,254,227,210,1,30,63,254,225,185,114,185,254,225,63,1,33,209,254,224,64,1,31,5,5,64,254,190,166,109,166,254,150,168,109,166,254,193,63,1,67,166,109,168,1,108,166,111,168,0,0,8,0,43,254,195,7,191,5,143,0,13,0,27,0,41,0,55,0,69,0,83,0,97,0,111,0,24,64,12,73,17,87,45,3,59,6,31,108,101,38,31,0,47,51,47,51,18,23,57,48,49,65,54,54,51,50,22,23,35,38,38,35,34,6,7,1,54,54,51,50,22,23,35,38,38,35,34,6,7,1,54,54,51,50,22,23,35,38,38,35,34,6,7,1,54,54,51,50,22,23,35,38,38,35,34,6,7,19,54,54,51,50,22,23,35,38,38,35,34,6,7,1,54,54,51,50,22,23,35,38,38,35,34,6,7,19,54,54,51,50,22,23,35,38,38,35,34,6,7,1,54,54,51,50,22,23,35,38,38,35,34,6,7,5,94,5,101,101,97,107,7,76,7,76,52,61,67,7,251,55,5,101,101,97,107,7,76,7,76,52,61,67,7,1,246,5,101,100,98,107,6,75,7,77,52,61,66,8,252,201,5,101,101,97,107,7,76,7,77,51,61,67,7,106,5,101,101,97,107,7,76,7,76,52,61,67,7,4,57,5,101,101,97,107,7,76,7,76,52,61,67,7,119,5,100,102,96,108,7,76,7,77,51,61,67,8,252,183,5,100,101,98,106,7,75,7,77,52,61,66,8,3,180,89,102,106,85,56,35,31,60,252,37,89,102,105,86,56,35,31,60,254,234,88,102,106,84,56,35,32,59,3,10,89,101,105,85,57,34,31,60,1,231,89,102,106,85,56,35,31,60,252,37,89,102,105,86,56,35,31,60,1,244,89,101,106,84,56,35,31,60,3,4,89,101,104,86,56,35,31,60,0,8,0,43,254,127,7,127,5,211,0,9,0,19,0,28,0,37,0,47,0,56,0,66,0,76,0,24,64,12,47,10,25,65,53,4,6,34,70,76,37,34,0,47,51,47,51,18,23,57,48,49,65,23,6,6,7,39,55,62,2,1,23,7,14,2,7,39,54,54,1,22,22,23,21,7,38,38,39,1,23,6,6,7,35,54,54,55,37,23,30,2,23,7,38,38,39,1,22,22,23,7,39,38,38,39,1,30,2,23,21,38,38,39,53,1,6,6,7,35,39,62,2,55,6,119,66,75,163,60,92,2,45,109,115,251,217,92,3,44,109,115,54,65,74,164,254,76,85,192,73,14,76,181,79,4,8,11,19,67,35,92,22,40,10,2,5,17,27,54,51,20,63,46,108,44,252,46,46,107,45,92,17,40,81,31,4,230,51,115,117,53,85,191,74,254,33,21,40,10,130,11,13,38,46,23,4,162,65,45,107,45,92,16,27,55,52,252,1,91,17,26,55,51,21,64,45,108,2,50,22,39,11,130,11,20,66,35,253,164,14,76,181,79,85,192,73,217,2,45,109,114,53,66,74,164,59,4,159,74,164,60,91,2,68,173,80,253,217,12,39,45,24,92,21,40,10,130,3,78,85,191,74,14,51,115,117,53,0,2,0,200,254,130,6,14,7,95,0,23,0,39,0,39,64,19,35,29,128,32,24,7,17,9,19,11,2,114,21,0,2,2,9,8,114,0,43,50,16,206,51,43,50,18,57,57,222,50,26,204,50,48,49,65,19,35,17,52,54,54,55,35,1,35,17,51,17,20,6,6,7,51,1,51,17,51,3,1,34,38,38,39,51,22,22,51,50,54,55,51,14,2,4,181,157,165,5,8,4,9,252,206,187,159,5,6,2,8,3,46,186,196,151,253,147,128,156,73,7,152,10,98,108,95,111,10,157,7,84,161,254,130,1,126,3,67,58,145,142,50,251,50,5,182,252,177,64,145,129,43,4,204,250,224,253,236,7,171,66,136,104,110,79,83,106,101,136,69,0,2,0,175,254,135,5,29,6,11,0,21,0,37,0,39,64,19,33,26,128,30,22,7,16,8,17,10,6,114,19,2,2,0,8,10,114,0,43,206,51,17,51,43,50,18,57,57,222,50,26,205,50,48,49,65,19,35,17,52,54,54,55,1,35,17,51,17,20,6,6,7,1,51,17,51,3,1,34,38,38,39,51,22,22,51,50,54,55,51,14,2,3,237,128,164,2,4,1,253,171,204,158,3,5,3,2,86,204,185,134,254,2,128,156,75,7,154,9,99,107,95,112,10,157,8,83,161,254,135,1,121,2,161,40,96,90,31,252,94,4,72,253,106,42,94,91,40,3,161,252,69,253,250,6,82,67,136,103,110,80,84,106,101,136,69,0,2,0,44,0,0,4,119,5,182,0,19,0,29,0,32,64,15,21,5,18,1,1,15,4,4,14,19,2,114,22,14,8,0,63,51,43,18,57,47,51,51,17,51,206,50,48,49,65,21,33,21,33,17,51,50,22,22,21,20,4,33,33,17,35,53,51,53,1,35,17,51,50,54,53,52,38,38,1,114,1,70,254,186,197,214,252,110,254,248,254,234,254,111,156,156,1,125,211,221,190,185,90,172,5,182,192,148,254,230,105,186,122,202,225,4,98,148,192,252,252,253,223,140,142,98,115,50,0,2,0,29,0,0,4,82,6,20,0,20,0,29,0,32,64,14,19,16,16,1,4,4,15,20,22,5,5,23,15,8,0,63,51,51,47,51,47,18,57,47,51,51,17,51,48,49,65,21,33,21,33,17,33,50,22,22,21,20,6,6,35,33,17,35,53,51,53,1,33,17,33,50,54,53,52,38,1,95,1,39,254,217,1,64,148,193,94,92,195,155,254,32,155,155,1,215,254,208,1,49,129,154,144,6,20,247,127,253,230,70,138,102,102,150,82,4,158,127,247,251,228,254,143,89,102,100,78,0,0,2,0,200,0,0,4,115,5,182,0,16,0,31,0,55,64,27,3,24,24,17,22,23,23,17,6,21,21,17,17,10,5,4,4,10,10,12,31,13,2,114,12,8,114,0,43,43,50,17,57,47,51,17,51,17,51,17,51,17,51,17,51,17,51,17,51,17,51,48,49,65,20,6,7,23,7,39,6,6,35,35,17,35,17,33,32,4,1,51,50,54,55,39,55,23,54,54,53,52,38,35,35,4,115,104,115,117,99,143,52,116,70,187,170,1,139,1,24,1,8,252,255,172,45,78,37,104,106,132,60,67,191,198,204,4,11,119,204,61,155,82,189,14,14,253,193,5,182,221,253,248,5,5,139,80,171,35,121,93,146,143,0,2,0,175,254,22,4,115,4,92,0,29,0,50,0,57,64,30,13,30,30,18,7,114,11,6,114,10,14,114,44,43,43,45,42,42,4,39,39,24,27,27,25,26,26,0,11,114,0,43,50,17,51,50,17,51,50,17,51,51,17,51,51,17,51,43,43,43,50,17,51,48,49,69,34,38,38,39,35,22,22,21,17,35,17,51,23,51,62,2,51,50,18,17,20,6,7,23,7,39,6,6,3,34,6,6,7,21,20,22,22,51,50,54,55,39,55,23,54,54,53,52,38,2,174,87,132,94,31,12,5,7,167,137,24,7,32,93,132,90,205,244,93,84,113,99,128,35,82,70,114,139,64,2,61,141,119,26,48,22,120,104,126,50,49,151,20,46,78,46,44,114,32,254,62,6,50,162,50,83,49,254,230,254,229,171,240,70,156,78,172,13,15,3,228,88,175,131,33,139,192,100,9,8,158,78,165,54,173,120,212,211,0,1,0,46,0,0,4,10,5,182,0,13,0,29,64,14,11,3,3,10,6,6,8,2,13,2,114,8,8,114,0,43,43,50,17,57,47,51,51,17,51,48,49,65,21,33,17,33,21,33,17,35,17,35,53,51,17,4,10,253,104,1,169,254,87,170,154,154,5,182,152,254,0,149,253,119,2,137,149,2,152,0,0,1,0,16,0,0,3,74,4,72,0,13,0,29,64,14,11,3,3,10,6,6,8,2,13,6,114,8,10,114,0,43,43,50,17,57,47,51,51,17,51,48,49,65,21,33,17,33,21,33,17,35,17,35,53,51,17,3,74,254,10,1,91,254,165,166,158,158,4,72,141,254,168,129,254,30,1,226,129,1,229,0,0,1,0,200,254,0,4,222,5,182,0,38,0,31,64,15,3,0,0,10,13,13,30,23,9,6,2,114,5,8,114,0,43,43,50,47,51,57,47,51,51,17,51,48,49,65,34,6,7,17,35,17,33,21,33,17,54,54,51,50,30,2,21,20,14,2,35,34,38,39,53,22,22,51,50,62,2,53,52,38,38,2,51,46,115,32,170,3,77,253,93,39,124,58,164,246,163,82,79,144,199,120,91,129,59,63,125,71,94,144,97,49,117,225,2,143,11,5,253,129,5,182,152,253,242,8,13,92,171,241,150,166,249,166,82,24,25,152,25,24,66,130,191,124,164,224,116,0,0,1,0,175,254,10,3,255,4,72,0,33,0,35,64,18,30,27,27,3,6,6,14,2,33,6,114,32,10,114,21,14,15,114,0,43,50,43,43,50,17,57,47,51,51,17,51,48,49,65,21,33,17,54,54,51,50,22,22,21,20,6,6,35,34,38,39,53,22,22,51,50,54,53,52,38,35,34,6,7,17,35,17,3,85,254,1,35,78,40,172,235,121,116,199,125,77,115,50,47,118,70,134,142,177,184,35,79,35,167,4,72,141,254,179,6,9,122,254,200,196,249,118,30,28,148,25,35,207,211,221,208,9,9,254,39,4,72,0,1,0,4,254,130,6,248,5,182,0,21,0,40,64,22,11,17,8,20,14,1,6,7,21,19,15,2,114,9,4,7,2,7,7,13,8,114,0,43,50,17,51,16,204,51,43,50,50,18,23,57,48,49,65,1,1,51,17,35,17,35,1,17,35,17,1,35,1,1,51,1,17,51,17,1,6,160,253,196,1,219,185,162,101,253,190,164,253,189,196,2,82,253,196,189,2,52,164,2,52,5,182,253,59,253,167,253,234,1,126,2,229,253,27,2,229,253,27,2,240,2,198,253,60,2,196,253,60,2,196,0,0,1,0,4,254,135,6,29,4,72,0,21,0,40,64,22,1,14,17,11,20,8,6,7,21,19,15,6,114,4,9,9,2,7,7,13,10,114,0,43,50,17,51,51,47,204,43,50,50,18,23,57,48,49,65,1,1,51,17,35,17,35,1,17,35,17,1,35,1,1,51,1,17,51,17,1,5,179,254,56,1,115,191,161,96,254,32,155,254,33,190,1,239,254,55,183,1,192,155,1,194,4,72,253,235,254,88,253,252,1,121,2,44,253,212,2,44,253,212,2,51,2,21,253,236,2,20,253,236,2,20,0,255,255,0,79,254,62,4,59,5,203,6,38,1,176,0,0,0,7,3,107,1,92,0,0,255,255,0,67,254,62,3,128,4,92,6,38,1,208,0,0,0,7,3,107,1,7,0,0,0,1,0,200,254,130,5,42,5,182,0,14,0,33,64,17,8,13,1,3,10,14,11,2,114,4,7,2,7,7,10,8,114,0,43,50,17,51,16,204,43,50,18,23,57,48,49,65,1,1,51,17,35,17,35,1,17,35,17,51,17,1,4,196,253,121,2,27,210,163,117,253,96,170,170,2,143,5,182,253,58,253,168,253,234,1,126,2,230,253,26,5,182,253,60,2,196,0,0,1,0,175,254,134,4,63,4,72,0,14,0,31,64,16,3,8,11,3,5,10,6,6,114,12,2,2,0,5,10,114,0,43,206,51,17,51,43,50,18,23,57,48,49,65,17,35,1,17,35,17,51,17,1,51,1,1,51,17,3,160,88,254,14,167,167,1,216,183,254,39,1,131,176,254,134,1,122,2,44,253,212,4,72,253,236,2,20,253,239,254,86,253,249,0,0,2,0,200,0,0,4,224,5,182,0,3,0,14,0,35,64,18,6,11,14,3,9,2,1,2,1,8,13,9,2,114,5,8,8,114,0,43,50,43,50,18,57,57,47,47,17,23,57,48,49,65,35,17,51,1,35,1,17,35,17,51,17,1,51,1,2,111,117,117,2,113,206,253,96,170,170,2,143,195,253,121,1,35,3,168,251,53,2,230,253,26,5,182,253,60,2,196,253,58,0,2,0,175,0,0,4,11,4,72,0,3,0,14,0,35,64,18,9,14,6,3,12,3,2,3,2,11,5,12,6,114,8,11,10,114,0,43,50,43,50,18,57,57,47,47,17,23,57,48,49,65,17,35,17,37,51,1,1,35,1,17,35,17,51,17,2,73,123,1,96,183,254,39,1,255,195,254,14,167,167,3,246,252,105,3,151,82,253,239,253,201,2,44,253,212,4,72,253,236,0,2,0,31,0,0,4,224,5,182,0,3,0,14,0,29,64,15,6,11,14,3,8,0,1,13,9,2,114,5,8,8,114,0,43,50,43,50,206,50,18,23,57,48,49,83,53,33,21,1,35,1,17,35,17,51,17,1,51,1,31,2,29,2,164,206,253,96,170,170,2,143,195,253,121,4,112,150,150,251,144,2,230,253,26,5,182,253,60,2,196,253,58,0,0,1,0,17,0,0,4,11,6,20,0,18,0,41,64,22,18,0,114,11,5,8,3,7,10,10,13,10,114,1,17,17,14,14,4,7,6,114,0,43,206,50,17,51,17,51,43,50,17,18,23,57,43,48,49,65,21,33,21,33,17,1,51,1,1,35,1,17,35,17,35,53,51,53,1,86,1,109,254,147,1,216,183,254,39,1,255,195,254,14,167,158,158,6,20,187,124,253,87,2,20,253,239,253,201,2,44,253,212,4,221,124,187,0,0,1,0,13,0,0,5,116,5,182,0,12,0,27,64,14,4,11,1,3,6,12,8,9,2,114,3,6,8,114,0,43,50,43,50,50,18,23,57,48,49,65,1,1,35,1,17,35,17,33,53,33,17,1,5,89,253,121,2,162,205,253,96,171,254,177,1,250,2,143,5,182,253,58,253,16,2,230,253,26,5,30,152,253,60,2,196,0,0,1,0,38,0,0,4,215,4,72,0,12,0,27,64,14,11,1,4,3,6,12,8,9,6,114,3,6,10,114,0,43,50,43,50,50,18,23,57,48,49,65,1,1,35,1,17,35,17,33,53,33,17,1,4,177,254,39,1,255,193,254,12,163,254,167,1,252,1,218,4,72,253,237,253,203,2,44,253,212,3,191,137,253,236,2,20,0,0,1,0,200,254,130,5,200,5,182,0,15,0,31,64,15,9,4,4,6,12,7,2,114,13,2,2,0,6,8,114,0,43,206,51,17,51,43,50,17,57,47,51,48,49,65,17,35,17,33,17,35,17,51,17,33,17,51,17,51,17,5,37,177,252,254,170,170,3,2,168,172,254,130,1,126,2,177,253,79,5,182,253,145,2,111,250,226,253,234,0,1,0,175,254,135,4,255,4,72,0,15,0,31,64,15,9,4,4,6,12,7,6,114,13,2,2,0,6,10,114,0,43,206,51,17,51,43,50,17,57,47,51,48,49,65,17,35,17,33,17,35,17,51,17,33,17,51,17,51,17,4,90,161,253,157,167,167,2,99,166,160,254,135,1,121,1,239,254,17,4,72,254,52,1,204,252,69,253,250,0,1,0,200,0,0,6,106,5,182,0,13,0,29,64,14,3,12,12,0,8,5,5,1,2,114,10,0,8,114,0,43,50,43,50,17,51,17,57,47,51,48,49,115,17,51,17,33,17,33,21,33,17,35,17,33,17,200,170,3,0,1,248,254,178,170,253,0,5,182,253,145,2,111,152,250,226,2,177,253,79,0,0,1,0,175,0,0,5,185,4,72,0,13,0,29,64,14,3,12,12,0,8,5,5,1,6,114,10,0,10,114,0,43,50,43,50,17,51,17,57,47,51,48,49,115,17,51,17,33,17,33,21,33,17,35,17,33,17,175,167,2,99,2,0,254,166,166,253,157,4,72,254,52,1,204,137,252,65,1,239,254,17,0,0,1,0,200,254,0,8,38,5,182,0,41,0,35,64,17,34,31,31,1,4,4,40,38,41,2,114,36,40,8,114,21,14,0,47,51,43,50,43,50,17,57,47,51,51,17,51,48,49,65,17,54,54,51,50,30,2,21,20,14,2,35,34,38,39,53,22,22,51,50,62,2,53,52,46,2,35,34,6,7,17,35,17,33,17,35,17,4,215,39,117,55,156,237,161,82,78,143,198,120,94,125,60,62,126,70,93,143,97,49,61,119,175,115,48,119,32,168,253,67,170,5,182,253,95,7,7,92,172,242,151,163,246,166,83,26,23,152,23,26,67,130,189,122,124,188,128,65,8,8,253,131,5,29,250,227,5,182,0,1,0,175,254,10,6,171,4,72,0,35,0,37,64,19,28,25,25,1,4,4,34,32,35,6,114,30,34,10,114,19,12,15,114,0,43,50,43,50,43,50,17,57,47,51,51,17,51,48,49,65,17,54,54,51,50,22,22,21,20,6,6,35,34,38,39,53,22,22,51,50,54,53,52,38,35,34,6,7,17,35,17,33,17,35,17,4,30,35,76,36,146,228,132,108,185,118,73,110,46,44,107,66,123,130,168,175,32,77,31,166,253,222,167,4,72,254,38,6,9,117,253,206,196,249,118,30,28,148,25,35,207,211,221,208,10,11,254,42,3,187,252,69,4,72,0,2,0,125,255,172,5,223,5,205,0,61,0,78,0,44,64,21,66,58,58,21,37,30,3,114,49,46,46,21,9,114,75,4,4,18,7,7,15,0,47,51,17,51,51,17,51,43,50,17,51,43,50,18,57,125,47,51,48,49,65,20,6,6,7,22,22,51,50,54,55,21,14,2,35,34,38,39,6,6,35,34,38,38,2,53,52,18,36,51,50,22,23,7,38,38,35,34,14,2,21,20,18,22,51,50,54,55,46,2,53,52,62,2,51,50,22,22,7,52,38,38,35,34,14,2,21,20,22,22,23,62,2,5,181,71,118,70,32,82,50,38,71,28,18,48,54,28,95,158,71,50,129,68,159,245,168,87,140,1,29,217,68,116,37,45,26,102,50,121,175,113,54,121,221,150,29,54,22,58,82,42,55,101,136,81,105,168,98,172,45,88,64,50,75,51,26,45,80,52,70,99,53,2,169,133,225,168,51,17,19,12,10,149,8,12,5,53,47,18,18,105,194,1,15,166,239,1,89,185,21,14,144,10,19,83,159,227,143,198,254,247,133,7,6,68,174,199,104,129,189,125,61,100,223,190,115,167,90,54,99,136,83,100,179,147,55,45,148,186,0,2,0,114,255,198,4,204,4,92,0,55,0,69,0,43,64,21,56,24,24,0,63,17,17,14,14,44,47,11,114,31,34,34,41,7,0,7,114,0,43,50,47,51,17,51,43,50,50,17,51,17,51,17,57,47,51,48,49,65,50,22,23,7,38,38,35,34,6,21,20,22,22,51,50,54,55,38,38,53,52,54,54,51,50,22,22,21,20,6,7,22,22,51,50,54,55,21,6,6,35,34,38,39,6,6,35,34,38,38,53,52,62,2,1,34,6,6,21,20,22,23,54,54,53,52,38,38,2,75,57,81,30,36,22,71,40,164,138,68,148,119,36,54,10,62,79,81,142,91,88,135,76,116,81,21,66,32,29,58,28,24,68,35,73,137,58,43,104,75,161,222,114,59,119,177,1,166,47,66,33,77,55,67,84,30,61,4,92,14,9,136,6,13,230,211,120,189,108,11,4,66,184,123,123,161,78,76,160,126,141,202,57,12,17,7,7,134,8,7,42,37,17,24,149,254,155,130,213,153,82,254,133,56,105,76,107,158,46,44,160,112,73,104,55,0,255,255,0,125,254,62,4,203,5,203,6,38,0,38,0,0,0,7,3,107,2,38,0,0,255,255,0,114,254,62,3,146,4,92,6,38,0,70,0,0,0,7,3,107,1,130,0,0,0,1,0,16,254,130,4,83,5,182,0,11,0,23,64,11,8,4,4,5,2,114,9,0,2,8,114,0,43,206,51,43,50,17,51,48,49,65,17,35,17,33,53,33,21,33,17,51,17,2,144,179,254,51,4,67,254,51,173,254,130,1,126,5,29,153,153,251,123,253,234,0,0,1,0,41,254,135,3,152,4,72,0,11,0,23,64,11,2,10,10,11,6,114,5,3,8,10,114,0,43,50,204,43,50,17,51,48,49,65,21,33,17,51,17,35,17,35,17,33,53,3,152,254,153,159,162,161,254,156,4,72,139,252,206,253,252,1,121,3,189,139,255,255,0,0,0,0,4,121,5,182,6,6,0,60,0,0,0,1,0,0,254,20,3,255,4,72,0,15,0,24,64,13,15,2,8,9,4,1,14,3,6,114,1,15,114,0,43,43,50,18,23,57,48,49,65,35,17,1,51,19,22,22,23,51,54,54,55,19,51,1,2,82,166,254,84,173,240,29,55,10,10,13,51,31,237,174,254,83,254,20,1,233,4,75,253,142,80,172,50,50,170,82,2,114,251,181,0,1,0,0,0,0,4,121,5,182,0,16,0,37,64,18,11,8,5,5,12,3,3,15,2,2,6,16,8,114,10,6,2,114,0,43,50,43,18,57,47,51,51,17,51,51,17,51,51,48,49,97,17,33,53,33,53,1,51,1,1,51,1,21,33,21,33,17,1,232,254,206,1,50,254,24,186,1,131,1,133,183,254,25,1,48,254,208,1,102,150,51,3,135,253,35,2,221,252,129,59,150,254,154,0,1,0,0,254,20,3,255,4,72,0,21,0,33,64,16,1,9,9,4,17,16,8,8,6,21,11,6,114,6,15,114,0,43,43,50,17,57,47,57,57,51,51,17,51,48,49,65,1,33,21,33,17,35,17,33,53,33,1,51,19,22,22,23,51,54,54,55,19,3,255,254,85,1,25,254,229,166,254,227,1,27,254,86,173,236,34,51,13,8,16,54,34,230,4,72,251,184,128,254,148,1,108,128,4,72,253,147,90,152,65,65,157,92,2,102,0,1,0,6,254,130,4,224,5,182,0,15,0,32,64,17,3,6,12,9,4,2,11,7,2,114,13,0,2,2,5,8,114,0,43,50,16,206,51,43,50,18,23,57,48,49,65,17,35,1,1,35,1,1,51,1,1,51,1,1,51,17,4,60,101,254,117,254,111,181,1,231,254,59,189,1,109,1,111,180,254,60,1,132,171,254,130,1,126,2,132,253,124,2,250,2,188,253,185,2,71,253,71,253,155,253,234,0,0,1,0,39,254,134,4,65,4,72,0,15,0,32,64,17,3,12,6,9,4,5,11,7,6,114,13,0,2,2,5,10,114,0,43,50,16,206,51,43,50,18,23,57,48,49,65,17,35,1,1,35,1,1,51,1,1,51,1,1,51,17,3,159,84,254,205,254,203,188,1,141,254,133,190,1,33,1,32,188,254,133,1,45,155,254,134,1,122,1,191,254,65,2,49,2,23,254,90,1,166,253,233,254,92,253,249,0,0,1,0,17,254,130,6,172,5,182,0,15,0,29,64,14,8,4,4,12,5,2,114,13,9,9,0,2,8,114,0,43,206,51,17,51,43,50,50,17,51,48,49,65,17,33,17,33,53,33,21,33,17,33,17,51,17,51,17,6,11,251,174,254,88,4,48,254,35,2,237,169,178,254,130,1,126,5,29,153,153,251,123,5,30,250,226,253,234,0,0,1,0,41,254,135,5,152,4,72,0,15,0,33,64,16,12,5,13,9,9,8,4,4,5,2,10,114,5,6,114,0,0,47,43,43,17,51,17,51,50,17,51,17,51,48,49,65,17,33,17,33,53,33,21,33,17,33,17,51,17,51,17,4,245,252,114,254,194,3,75,254,152,2,66,167,163,254,135,1,121,3,189,139,139,252,208,3,187,252,67,253,252,0,0,1,0,167,254,130,5,111,5,182,0,23,0,33,64,16,22,19,19,7,10,10,6,23,14,2,114,3,1,6,8,114,0,43,50,204,43,50,17,57,47,51,51,17,51,48,49,65,17,51,17,35,17,35,17,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,17,4,195,172,162,179,117,210,128,207,221,170,129,146,123,195,120,5,182,250,226,253,234,1,126,2,94,42,52,191,179,2,68,253,212,121,123,45,42,2,201,0,0,1,0,154,254,133,4,203,4,72,0,23,0,27,64,13,19,10,10,6,23,14,6,114,3,1,6,10,114,0,43,50,204,43,50,17,57,47,51,48,49,65,17,51,17,35,17,35,17,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,17,4,44,159,165,160,92,178,124,169,185,166,113,108,104,170,87,4,72,252,69,253,248,1,123,1,235,59,68,176,150,1,150,254,118,103,98,64,55,1,220,0,0,1,0,167,0,0,4,195,5,182,0,27,0,51,64,25,26,23,23,20,21,21,20,20,9,3,6,6,9,8,8,9,9,1,27,15,2,114,1,8,114,0,43,43,50,18,57,47,51,47,17,51,17,51,17,51,17,51,47,17,51,17,51,48,49,65,17,35,17,6,6,7,17,35,17,34,46,2,53,17,51,17,20,22,51,17,51,17,54,54,55,17,4,195,172,72,146,83,117,113,173,117,59,170,137,155,117,83,151,67,5,182,250,74,2,90,28,44,10,254,202,1,46,46,92,139,93,2,68,253,212,122,122,1,95,254,168,8,42,26,2,205,0,1,0,154,0,0,4,30,4,72,0,28,0,47,64,23,24,21,22,22,21,21,12,6,9,9,12,8,8,12,12,1,28,16,6,114,1,10,114,0,43,43,50,17,57,47,51,47,17,51,17,51,17,51,17,51,47,17,51,48,49,65,17,35,17,6,6,7,21,35,53,6,6,35,34,38,53,17,51,17,20,22,23,17,51,17,54,54,55,17,4,30,167,60,117,69,113,6,12,8,169,179,166,105,103,113,65,120,61,4,72,251,184,1,235,41,58,14,249,235,1,1,178,148,1,152,254,116,101,97,3,1,45,254,223,12,56,41,1,220,0,1,0,201,0,0,4,229,5,182,0,19,0,29,64,14,17,14,14,2,5,5,0,10,19,8,114,0,2,114,0,43,43,50,18,57,47,51,51,17,51,48,49,83,51,17,54,54,51,50,22,21,17,35,17,52,38,35,34,6,7,17,35,201,169,116,221,118,205,223,171,128,147,123,195,119,169,5,182,253,162,43,51,190,179,253,187,2,44,122,123,46,41,253,54,0,255,255,0,175,0,0,4,65,6,20,6,6,0,75,0,0,0,2,0,56,255,236,6,63,5,205,0,41,0,50,0,37,64,18,30,30,36,36,47,47,23,6,6,0,10,18,9,114,42,0,3,114,0,43,50,43,50,18,57,47,51,51,17,51,17,51,47,48,49,65,50,4,18,21,21,33,30,2,51,50,54,54,55,21,6,6,35,34,36,2,39,35,34,38,53,52,54,55,51,6,6,21,20,22,51,51,62,3,23,34,14,2,7,33,52,2,3,235,213,1,6,121,251,214,10,119,226,168,91,157,138,62,85,221,160,217,254,217,159,13,46,112,140,17,11,143,7,14,59,59,32,18,101,163,224,139,104,166,120,70,8,3,117,196,5,205,180,254,189,215,98,172,241,127,23,36,21,155,31,43,167,1,53,213,127,106,41,67,23,16,60,35,52,54,162,249,171,87,152,68,132,192,125,246,1,15,0,2,0,45,255,236,4,220,4,90,0,39,0,47,0,37,64,18,29,29,35,35,43,43,21,6,6,0,9,16,11,114,40,0,7,114,0,43,50,43,50,18,57,47,51,51,17,51,17,51,47,48,49,65,50,22,22,21,21,33,22,22,51,50,54,55,21,6,6,35,34,46,2,39,46,2,53,52,54,55,51,6,6,21,20,22,51,51,62,2,23,34,6,7,33,52,38,38,3,29,142,199,106,253,10,4,181,168,116,155,86,83,164,110,118,191,137,76,4,87,120,61,16,11,136,7,13,56,55,21,18,132,203,120,132,159,13,2,70,59,123,4,90,124,222,148,103,203,192,37,37,145,37,34,69,136,201,131,1,49,97,74,37,64,22,16,58,33,50,55,159,206,100,136,168,161,99,148,82,0,0,2,0,56,254,128,6,63,5,205,0,44,0,53,0,41,64,20,33,33,40,40,50,50,25,6,6,0,21,19,10,18,9,114,45,0,3,114,0,43,50,43,50,205,51,18,57,47,51,51,17,51,17,51,47,48,49,65,50,4,18,21,21,33,30,2,51,50,54,54,55,21,6,6,7,17,35,17,38,38,2,39,35,34,38,53,52,54,55,51,6,6,21,20,22,51,51,62,3,23,34,14,2,7,33,52,2,3,235,213,1,6,121,251,214,10,119,226,168,91,157,138,62,81,198,134,164,181,247,133,12,46,112,140,17,11,143,7,14,59,59,32,15,100,165,226,139,104,166,120,70,8,3,117,188,5,205,179,254,191,213,103,172,241,127,23,36,21,155,30,38,2,254,144,1,117,19,176,1,36,193,127,106,41,67,23,16,60,35,52,54,162,249,171,87,152,68,132,192,125,246,1,15,0,0,2,0,45,254,135,4,220,4,90,0,41,0,49,0,40,64,19,12,12,19,19,45,45,4,29,29,23,41,32,0,39,11,42,23,7,114,0,43,50,63,51,51,205,18,57,47,51,51,17,51,17,51,47,48,49,69,46,2,39,46,2,53,52,54,55,51,6,6,21,20,22,51,51,62,2,51,50,22,22,21,21,33,22,22,51,50,54,55,21,6,6,7,17,35,19,34,6,7,33,52,38,38,2,212,125,181,101,4,87,120,61,16,11,136,7,13,56,55,21,20,131,202,124,142,199,106,253,10,4,181,168,116,155,86,73,145,92,162,69,132,159,13,2,70,59,123,9,19,132,222,153,1,49,97,74,37,64,22,16,58,33,50,55,155,206,104,124,222,148,103,203,192,37,37,145,34,31,2,254,151,5,75,168,161,99,148,82,255,255,0,200,0,0,1,114,5,182,6,6,0,44,0,0,255,255,0,4,0,0,6,181,7,122,6,38,1,175,0,0,1,7,2,51,1,23,1,111,0,10,179,22,1,2,114,0,43,206,48,49,255,255,0,4,0,0,5,218,6,11,6,38,1,207,0,0,1,7,2,51,0,165,0,0,0,10,179,22,11,6,114,0,43,206,48,49,0,1,0,200,254,0,5,19,5,182,0,43,0,41,64,20,42,39,39,4,34,31,31,1,4,4,14,43,37,2,114,36,8,114,21,14,0,47,51,43,43,50,17,57,47,51,51,17,51,17,51,17,51,48,49,65,1,54,50,51,50,30,2,21,20,14,2,35,34,38,39,53,22,22,51,50,62,2,53,52,46,2,35,34,6,7,17,35,17,51,17,54,54,55,1,4,198,253,132,14,25,15,166,248,164,81,83,149,203,120,91,127,61,63,128,81,89,143,101,54,75,138,191,117,73,118,42,170,170,47,105,51,1,189,5,182,253,87,1,88,165,234,147,167,248,164,81,24,25,152,25,24,66,128,190,124,124,185,122,61,18,13,253,159,5,182,253,46,56,124,56,1,230,0,0,1,0,175,254,10,4,40,4,72,0,33,0,35,64,18,22,19,19,27,30,30,24,29,25,6,114,24,10,114,11,4,15,114,0,43,50,43,43,50,18,57,47,51,51,17,51,48,49,101,20,6,6,35,34,38,39,53,22,22,51,50,54,54,53,52,38,38,35,34,6,7,17,35,17,51,17,1,51,1,30,2,4,40,122,204,122,73,111,47,46,110,67,86,131,74,91,173,124,37,93,41,165,165,1,225,185,254,53,153,233,131,61,195,249,119,30,28,145,24,36,92,186,142,146,184,86,13,11,254,59,4,72,253,253,2,3,254,31,2,112,242,0,1,0,1,254,130,5,154,5,182,0,33,0,25,64,13,7,32,2,114,23,16,9,114,2,0,5,8,114,0,43,50,204,43,50,43,50,48,49,101,51,3,35,19,35,17,33,14,3,7,14,2,35,34,38,39,53,22,22,51,50,54,54,55,54,54,18,18,55,33,4,216,194,150,194,158,178,254,38,14,32,34,34,17,26,77,127,104,35,69,26,23,57,32,63,73,43,16,13,34,38,41,20,3,18,152,253,234,1,126,5,32,112,244,242,216,84,139,195,103,14,10,143,10,14,101,156,82,68,208,1,9,1,46,160,0,0,1,0,13,254,135,4,155,4,72,0,26,0,27,64,14,7,25,6,114,19,12,11,114,2,128,0,5,10,114,0,43,50,26,204,43,50,43,50,48,49,101,51,3,35,19,35,17,33,2,2,6,6,35,34,38,39,53,22,22,51,50,62,2,18,55,33,3,227,184,135,169,129,176,254,177,19,61,91,129,88,27,48,17,13,29,16,45,75,60,48,37,13,2,134,141,253,250,1,121,3,189,254,253,254,144,233,109,6,6,127,3,3,75,152,232,1,59,201,0,0,1,0,200,254,0,5,28,5,182,0,24,0,27,64,13,22,17,17,19,24,20,2,114,19,8,114,12,5,0,47,51,43,43,50,17,57,47,51,48,49,65,17,20,2,6,35,34,38,39,53,22,22,51,50,54,53,17,33,17,35,17,51,17,33,17,5,28,135,242,159,97,125,60,61,127,74,190,198,252,254,170,170,3,2,5,182,250,214,224,254,223,139,25,23,151,24,25,244,254,2,41,253,79,5,182,253,145,2,111,0,1,0,175,254,12,4,95,4,72,0,24,0,29,64,15,22,17,17,19,24,20,6,114,19,10,114,12,5,15,114,0,43,50,43,43,50,17,57,47,51,48,49,65,17,20,6,6,35,34,38,39,53,22,22,51,50,54,53,17,33,17,35,17,51,17,33,17,4,95,104,180,114,73,109,44,43,106,64,119,124,253,159,167,167,2,97,4,72,251,222,192,237,109,30,26,148,22,36,182,210,1,201,254,17,4,72,254,52,1,204,0,0,1,0,200,254,130,5,224,5,182,0,15,0,33,64,16,12,7,7,9,15,10,2,114,0,5,5,2,128,9,8,114,0,43,26,204,51,17,51,43,50,17,57,47,51,48,49,101,51,3,35,19,35,17,33,17,35,17,51,17,33,17,51,5,28,196,153,194,159,176,252,254,170,170,3,2,168,152,253,234,1,126,2,177,253,79,5,182,253,145,2,111,0,1,0,175,254,135,5,24,4,72,0,15,0,33,64,16,3,14,14,0,6,1,6,114,7,12,12,9,128,0,10,114,0,43,26,204,51,17,51,43,50,17,57,47,51,48,49,115,17,51,17,33,17,51,17,51,3,35,19,35,17,33,17,175,167,2,99,166,185,135,170,129,175,253,157,4,72,254,52,1,204,252,69,253,250,1,121,1,239,254,17,0,0,1,0,167,254,130,4,195,5,182,0,23,0,34,64,16,21,18,18,6,9,9,1,22,13,2,114,4,2,128,1,8,0,63,26,205,51,43,50,18,57,47,51,51,17,51,48,49,97,35,17,35,17,51,17,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,17,51,4,195,174,162,167,117,210,128,207,221,170,129,146,123,195,120,169,254,130,2,22,1,198,42,52,191,179,2,68,253,212,121,123,45,42,2,201,0,0,1,0,154,254,133,4,44,4,72,0,23,0,34,64,16,22,19,19,7,10,10,2,23,14,6,114,5,3,128,2,10,0,63,26,205,51,43,50,18,57,47,51,51,17,51,48,49,65,17,35,17,35,17,51,17,6,6,35,34,38,53,17,51,17,20,22,51,50,54,55,17,4,44,159,163,156,92,178,124,169,185,166,113,108,104,170,87,4,72,251,184,254,133,2,8,1,94,59,68,176,150,1,150,254,118,103,98,64,55,1,220,0,1,0,200,254,130,7,44,5,182,0,29,0,37,64,19,12,27,1,3,9,15,11,2,114,18,21,128,16,21,21,0,9,8,114,0,43,50,50,17,51,26,16,204,43,50,18,23,57,48,49,97,1,35,30,3,21,17,35,17,51,1,51,1,51,17,51,3,35,19,35,17,52,62,2,55,35,1,3,75,254,21,8,4,5,3,2,158,252,1,208,8,1,212,250,194,151,196,161,176,2,3,5,3,8,254,15,5,14,39,95,98,89,33,252,84,5,182,251,64,4,192,250,226,253,234,1,126,3,184,34,91,96,88,31,250,244,0,0,1,0,174,254,135,5,236,4,72,0,24,0,35,64,18,21,12,8,3,18,23,20,6,114,24,4,4,11,1,128,18,10,114,0,43,26,204,51,51,17,51,43,50,18,23,57,48,49,101,3,35,19,35,17,52,54,55,35,1,35,1,35,22,22,21,17,35,17,51,1,1,51,17,5,236,135,170,130,159,5,4,6,254,148,141,254,157,6,3,3,151,223,1,98,1,103,222,141,253,250,1,121,2,202,44,91,46,252,129,3,127,46,91,50,253,60,4,72,252,128,3,128,252,69,0,255,255,0,200,0,0,1,114,5,182,6,6,0,44,0,0,255,255,0,0,0,0,5,13,7,122,6,38,0,36,0,0,1,7,2,51,0,62,1,111,0,10,179,23,5,2,114,0,43,206,48,49,255,255,0,94,255,236,3,203,6,11,6,38,0,68,0,0,1,6,2,51,241,0,0,10,179,45,0,7,114,0,43,206,48,49,255,255,0,0,0,0,5,13,7,65,6,38,0,36,0,0,1,7,0,106,0,52,1,111,0,12,180,40,28,5,2,114,0,43,206,206,48,49,255,255,0,94,255,236,3,203,5,210,6,38,0,68,0,0,1,6,0,106,232,0,0,12,180,62,50,0,7,114,0,43,206,206,48,49,255,255,255,254,0,0,6,129,5,182,6,6,0,136,0,0,255,255,0,94,255,236,6,125,4,92,6,6,0,168,0,0,255,255,0,200,0,0,3,246,7,122,6,38,0,40,0,0,1,7,2,51,0,41,1,111,0,10,179,16,2,2,114,0,43,206,48,49,255,255,0,114,255,236,4,19,6,11,6,38,0,72,0,0,1,6,2,51,254,0,0,10,179,36,0,7,114,0,43,206,48,49,0,2,0,120,255,236,5,94,5,205,0,28,0,37,0,25,64,12,24,34,34,9,29,19,9,114,0,9,3,114,0,43,50,43,50,18,57,47,51,48,49,65,34,6,6,7,53,62,2,51,50,4,22,18,21,20,2,6,6,35,34,36,2,53,53,33,46,2,3,50,54,54,55,33,20,22,22,2,161,90,161,142,64,59,133,164,104,171,1,5,176,90,84,166,243,159,214,254,247,123,4,51,10,119,224,120,139,205,119,10,252,130,83,185,5,55,23,37,22,156,21,34,21,106,199,254,234,172,171,254,236,197,106,181,1,79,232,68,170,241,128,251,74,121,230,166,164,232,121,0,255,255,0,106,255,236,4,12,4,92,6,6,3,115,0,0,255,255,0,120,255,236,5,94,7,65,6,38,2,206,0,0,1,7,0,106,0,116,1,111,0,12,180,59,47,9,3,114,0,43,206,206,48,49,255,255,0,106,255,236,4,12,5,210,6,38,3,115,0,0,1,6,0,106,223,0,0,12,180,53,41,0,7,114,0,43,206,206,48,49,255,255,0,4,0,0,6,181,7,65,6,38,1,175,0,0,1,7,0,106,1,15,1,111,0,12,180,39,27,1,2,114,0,43,206,206,48,49,255,255,0,4,0,0,5,218,5,210,6,38,1,207,0,0,1,7,0,106,0,156,0,0,0,12,180,39,27,11,6,114,0,43,206,206,48,49,255,255,0,79,255,236,4,59,7,65,6,38,1,176,0,0,1,7,0,106,255,246,1,111,0,12,180,68,56,43,3,114,0,43,206,206,48,49,255,255,0,67,255,236,3,128,5,210,6,38,1,208,0,0,1,6,0,106,136,0,0,12,180,69,57,0,7,114,0,43,206,206,48,49,0,1,0,73,255,236,4,49,5,182,0,29,0,37,64,18,1,28,28,29,26,2,2,25,24,24,9,29,2,114,16,9,9,114,0,43,50,43,18,57,47,51,51,17,51,17,51,17,51,48,49,65,21,1,4,4,21,20,6,4,35,34,38,39,53,22,22,51,50,54,54,53,52,38,38,35,35,53,1,33,53,3,248,254,7,1,7,1,43,127,254,255,195,119,211,91,94,224,105,133,178,89,104,199,145,134,1,229,253,82,5,182,134,254,16,9,203,203,128,198,111,37,43,157,46,51,70,134,95,94,121,59,139,1,222,152,0,1,0,29,254,20,3,169,4,72,0,30,0,35,64,17,1,29,29,30,27,2,2,25,25,10,30,6,114,17,10,15,114,0,43,50,43,18,57,47,51,17,51,17,51,17,51,48,49,65,21,1,30,2,21,20,6,6,35,34,38,39,53,22,22,51,50,54,54,53,52,38,38,35,35,53,1,33,53,3,117,254,51,148,231,134,131,239,163,120,188,67,68,196,118,108,162,90,105,191,131,115,1,203,253,138,4,72,121,253,253,8,107,199,147,145,221,125,38,33,153,32,53,84,157,107,116,147,69,116,2,0,141,0,255,255,0,202,0,0,5,77,6,208,6,38,1,177,0,0,1,7,1,76,1,160,1,111,0,10,179,24,0,2,114,0,43,206,48,49,255,255,0,175,0,0,4,100,5,97,6,38,1,209,0,0,1,7,1,76,1,26,0,0,0,10,179,21,18,6,114,0,43,206,48,49,255,255,0,202,0,0,5,77,7,65,6,38,1,177,0,0,1,7,0,106,0,205,1,111,0,12,180,43,31,0,2,114,0,43,206,206,48,49,255,255,0,175,0,0,4,100,5,210,6,38,1,209,0,0,1,6,0,106,72,0,0,12,180,40,28,18,6,114,0,43,206,206,48,49,255,255,0,125,255,236,5,188,7,65,6,38,0,50,0,0,1,7,0,106,0,204,1,111,0,12,180,54,42,14,3,114,0,43,206,206,48,49,255,255,0,114,255,236,4,96,5,210,6,38,0,82,0,0,1,6,0,106,24,0,0,12,180,42,54,14,7,114,0,43,206,206,48,49,255,255,0,125,255,236,5,188,5,205,6,6,2,111,0,0,255,255,0,114,255,236,4,96,4,92,6,6,2,112,0,0,255,255,0,125,255,236,5,188,7,36,6,38,2,111,0,0,1,7,0,106,0,204,1,82,0,12,180,56,44,14,3,114,0,43,206,206,48,49,255,255,0,114,255,236,4,96,5,210,6,38,2,112,0,0,1,6,0,106,22,0,0,12,180,53,41,11,7,114,0,43,206,206,48,49,255,255,0,63,255,236,4,140,7,36,6,38,1,198,0,0,1,7,0,106,255,210,1,82,0,12,180,57,45,7,3,114,0,43,206,206,48,49,255,255,0,65,255,236,3,132,5,210,6,38,1,230,0,0,1,7,0,106,255,91,0,0,0,12,180,53,41,24,7,114,0,43,206,206,48,49,255,255,0,22,255,236,4,241,6,208,6,38,1,188,0,0,1,7,1,76,1,23,1,111,0,10,179,32,17,2,114,0,43,206,48,49,255,255,0,2,254,19,4,2,5,97,6,38,0,92,0,0,1,7,1,76,0,130,0,0,0,10,179,32,0,6,114,0,43,206,48,49,255,255,0,22,255,236,4,241,7,65,6,38,1,188,0,0,1,7,0,106,0,68,1,111,0,12,180,51,39,17,2,114,0,43,206,206,48,49,255,255,0,2,254,19,4,2,5,210,6,38,0,92,0,0,1,6,0,106,175,0,0,12,180,51,39,0,6,114,0,43,206,206,48,49,255,255,0,22,255,236,4,241,7,144,6,38,1,188,0,0,1,7,1,82,1,73,1,111,0,12,180,37,50,17,2,114,0,43,206,206,48,49,255,255,0,2,254,19,4,2,6,33,6,38,0,92,0,0,1,7,1,82,0,181,0,0,0,12,180,37,50,0,6,114,0,43,206,206,48,49,255,255,0,167,0,0,4,195,7,65,6,38,1,192,0,0,1,7,0,106,0,98,1,111,0,12,180,41,29,9,2,114,0,43,206,206,48,49,255,255,0,154,0,0,4,44,5,210,6,38,1,224,0,0,1,6,0,106,14,0,0,12,180,41,29,19,6,114,0,43,206,206,48,49,0,1,0,200,254,130,4,10,5,182,0,9,0,21,64,10,2,9,2,114,5,128,3,8,8,114,0,43,50,26,204,43,50,48,49,65,21,33,17,51,17,35,17,35,17,4,10,253,104,170,161,179,5,182,152,251,122,253,234,1,126,5,182,0,0,1,0,175,254,135,3,70,4,72,0,9,0,21,64,10,2,9,6,114,5,128,3,8,10,114,0,43,50,26,204,43,50,48,49,65,21,33,17,51,17,35,17,35,17,3,70,254,16,159,165,161,4,72,139,252,206,253,252,1,121,4,72,0,255,255,0,200,0,0,5,250,7,65,6,38,1,196,0,0,1,7,0,106,1,24,1,111,0,12,180,47,35,1,2,114,0,43,206,206,48,49,255,255,0,175,0,0,5,118,5,210,6,38,1,228,0,0,1,7,0,106,0,189,0,0,0,12,180,47,35,1,6,114,0,43,206,206,48,49,255,255,0,46,254,113,4,10,5,182,6,38,2,136,0,0,0,7,3,108,0,146,0,0,0,1,0,16,254,113,3,74,4,72,0,31,0,34,64,16,17,14,14,22,25,25,13,21,18,6,114,7,0,26,13,10,0,63,51,204,50,43,50,18,57,47,51,51,17,51,48,49,65,34,38,39,53,22,22,51,50,54,54,53,53,35,17,35,53,51,17,33,21,33,17,33,21,33,17,51,17,20,6,6,1,5,37,62,20,17,53,31,31,44,23,167,158,158,2,156,254,10,1,91,254,165,151,50,102,254,113,17,7,139,7,12,23,49,37,146,1,226,129,1,229,141,254,168,129,254,159,254,246,84,117,61,0,1,0,6,254,113,4,208,5,182,0,29,0,36,64,19,20,23,17,14,4,15,21,18,2,114,7,0,13,24,13,13,15,8,114,0,43,50,17,51,16,204,50,43,50,17,23,57,48,49,65,34,38,39,53,22,22,51,50,54,54,53,53,35,1,1,35,1,1,51,1,1,51,1,1,51,17,20,6,6,3,236,38,62,19,17,52,31,31,43,23,99,254,117,254,111,181,1,231,254,59,189,1,109,1,111,180,254,60,1,134,153,49,101,254,113,17,7,139,7,12,23,49,37,146,2,132,253,124,2,250,2,188,253,185,2,71,253,71,253,155,254,223,84,117,61,0,1,0,39,254,113,4,59,4,72,0,29,0,35,64,18,14,17,23,20,4,15,21,18,6,114,7,0,13,24,13,13,15,10,0,63,51,17,51,16,204,50,43,50,18,23,57,48,49,65,34,38,39,53,22,22,51,50,54,54,53,53,35,1,1,35,1,1,51,1,1,51,1,1,51,17,20,6,6,3,85,37,62,20,17,53,31,31,44,23,90,254,205,254,203,188,1,141,254,133,190,1,33,1,32,188,254,133,1,50,144,50,101,254,113,17,7,139,7,12,23,49,37,146,1,191,254,65,2,49,2,23,254,90,1,166,253,233,254,80,254,246,84,117,61,0,0,1,0,5,0,0,4,152,5,182,0,17,0,33,64,16,4,0,0,13,9,17,17,2,12,14,8,114,5,2,2,114,0,43,50,43,50,17,57,47,51,51,51,17,51,48,49,83,33,1,51,1,1,51,1,33,21,33,1,35,1,1,35,1,33,129,1,51,254,116,189,1,109,1,110,181,254,113,1,57,254,190,1,187,193,254,117,254,111,182,1,188,254,192,3,78,2,104,253,183,2,73,253,152,150,253,72,2,132,253,124,2,184,0,0,1,0,39,0,0,4,9,4,72,0,17,0,37,64,18,7,1,1,10,4,2,13,17,17,2,12,14,10,114,5,2,6,114,0,43,50,43,50,17,57,47,57,18,57,51,51,17,51,48,49,83,33,1,51,1,1,51,1,33,21,33,1,35,1,1,35,1,33,118,1,14,254,181,190,1,33,1,32,188,254,179,1,19,254,233,1,102,190,254,205,254,203,188,1,98,254,237,2,117,1,211,254,90,1,166,254,45,129,254,12,1,191,254,65,1,244,0,0,2,0,126,0,0,4,46,5,182,0,11,0,21,0,23,64,11,14,8,8,0,9,2,114,12,0,8,114,0,43,50,43,18,57,47,51,48,49,97,32,38,53,52,54,54,51,51,17,51,17,37,51,17,35,34,6,6,21,20,22,2,146,254,226,246,107,241,199,227,170,254,129,213,214,131,171,83,180,209,194,121,199,120,2,107,250,74,146,2,37,64,124,91,142,128,255,255,0,114,255,236,4,53,6,20,6,6,0,71,0,0,0,2,0,125,255,236,6,109,5,182,0,30,0,43,0,35,64,18,31,29,8,29,8,29,19,30,2,114,40,19,11,114,4,13,11,114,0,43,50,43,50,43,18,57,57,47,47,17,51,48,49,65,17,20,22,51,50,54,53,17,51,17,20,6,35,34,38,39,6,6,35,34,38,38,53,52,62,2,51,51,17,17,35,34,6,6,21,20,22,22,51,50,54,53,4,0,120,110,103,120,168,197,194,125,159,44,49,166,132,148,202,104,65,139,218,153,154,155,132,178,89,64,128,95,143,124,5,182,251,183,124,114,124,119,1,222,254,25,168,213,91,81,76,95,95,187,138,99,161,117,62,2,110,252,252,59,128,104,90,121,61,139,95,0,0,2,0,112,255,236,6,132,6,20,0,38,0,51,0,43,64,23,38,0,114,33,39,39,29,8,8,23,29,7,114,19,45,45,23,11,114,4,15,11,114,0,43,50,43,50,17,51,43,18,57,47,17,51,17,51,43,48,49,65,17,20,22,51,50,54,53,17,51,17,20,14,2,35,34,38,38,39,14,2,35,34,2,17,16,18,51,50,22,22,23,51,38,38,53,17,1,34,6,21,20,22,51,50,54,55,53,52,38,4,25,94,134,115,108,168,51,98,145,94,102,128,75,25,39,102,145,103,205,244,243,197,85,125,89,30,13,4,7,254,206,148,145,143,151,169,137,2,133,6,20,251,131,136,153,134,138,1,54,254,186,99,148,97,48,50,91,61,57,92,55,1,27,1,23,1,27,1,35,46,77,49,31,107,35,1,183,253,188,224,212,211,211,198,197,32,209,222,0,1,0,76,255,236,6,123,5,203,0,53,0,35,64,17,7,8,38,38,37,21,37,21,0,17,26,9,114,46,0,3,114,0,43,50,43,50,18,57,57,47,47,51,18,57,57,48,49,65,50,22,22,21,20,6,7,21,30,2,23,30,3,51,50,54,53,17,51,17,20,6,35,34,46,2,39,52,46,2,35,35,53,51,50,54,54,53,52,38,35,34,6,7,39,62,2,2,31,148,204,107,183,142,113,156,82,1,1,27,55,89,62,119,111,166,208,188,92,150,108,58,1,56,108,158,102,201,196,133,178,90,159,127,121,180,78,85,55,144,171,5,203,93,163,106,151,175,25,8,17,91,146,101,74,106,67,31,125,136,1,202,254,38,198,196,47,99,156,109,79,112,71,33,138,69,126,84,115,124,72,53,114,42,69,41,0,1,0,79,255,236,5,195,4,92,0,51,0,37,64,18,7,8,38,38,37,20,37,20,37,0,16,27,11,114,45,0,7,114,0,43,50,43,50,17,57,57,47,47,17,51,18,57,57,48,49,65,50,22,22,21,20,6,7,21,30,2,23,30,2,51,50,54,53,17,51,17,20,14,2,35,34,46,2,39,46,2,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,1,181,118,177,98,105,89,67,99,59,5,4,47,96,79,110,109,164,47,95,143,96,94,143,97,52,5,5,65,128,100,144,119,133,156,123,115,79,140,78,55,81,168,4,92,67,128,92,99,118,26,8,13,63,100,72,65,94,51,133,136,1,55,254,185,99,148,98,48,42,83,123,81,68,86,41,136,80,95,82,81,37,34,133,38,38,0,1,0,76,254,130,4,212,5,203,0,40,0,32,64,15,8,7,26,26,23,23,0,15,12,17,8,33,0,3,114,0,43,50,63,51,206,18,57,47,51,18,57,57,48,49,65,50,22,22,21,20,6,7,21,22,22,21,17,51,17,35,17,35,17,52,46,2,35,35,53,51,50,54,54,53,52,38,35,34,6,7,39,62,2,2,46,151,209,110,190,149,177,191,179,162,181,61,119,171,110,205,211,140,188,94,166,135,127,189,82,85,56,147,177,5,203,93,163,106,151,173,26,7,26,179,147,254,252,253,234,1,126,1,156,71,104,67,32,138,69,126,84,113,126,73,52,114,42,69,41,0,0,1,0,79,254,135,4,26,4,90,0,38,0,32,64,15,7,8,25,25,23,23,0,16,13,18,10,32,0,7,114,0,43,50,63,51,206,18,57,47,51,18,57,57,48,49,65,50,22,22,21,20,6,7,21,30,2,21,21,51,17,35,17,35,17,52,38,38,35,35,53,51,50,54,53,52,38,35,34,6,7,39,54,54,1,194,121,179,99,108,92,66,107,63,165,163,161,68,138,106,151,124,142,168,131,116,84,152,74,61,85,189,4,90,67,129,93,98,115,26,10,18,66,108,82,163,253,252,1,121,1,48,66,88,44,138,79,94,81,84,39,34,133,38,38,0,0,1,255,255,255,233,7,30,5,182,0,46,0,29,64,15,8,8,13,19,46,2,114,37,30,9,114,4,13,9,114,0,43,50,43,50,43,50,18,57,47,48,49,65,17,20,22,51,50,54,53,17,51,17,20,6,35,34,38,38,53,17,33,14,5,7,14,2,35,34,38,39,53,22,22,51,50,54,54,55,54,54,18,18,55,4,179,111,115,112,114,167,211,182,116,179,101,254,73,9,20,21,22,23,23,11,27,77,127,103,35,68,29,25,55,32,63,73,42,17,14,34,39,41,20,5,182,251,202,135,120,127,134,1,202,254,38,198,196,79,174,143,3,166,74,159,163,160,151,135,57,138,194,102,14,10,143,12,14,99,158,86,71,208,1,6,1,43,161,0,0,1,0,13,255,236,6,44,4,72,0,40,0,29,64,15,7,7,14,21,39,6,114,33,26,11,114,3,14,11,114,0,43,50,43,50,43,50,18,57,47,48,49,65,20,22,51,50,54,53,17,51,17,20,14,2,35,34,46,2,53,17,33,2,2,6,6,35,34,38,39,53,22,22,51,50,62,2,18,55,33,3,210,105,117,107,106,167,48,96,141,93,94,145,100,52,254,194,19,61,91,129,88,27,48,17,13,29,16,45,75,60,48,37,13,2,117,1,126,133,129,133,135,1,56,254,186,99,148,98,49,48,98,149,101,2,69,254,253,254,144,233,109,6,6,127,3,3,75,152,232,1,59,201,0,1,0,200,255,236,7,91,5,182,0,26,0,37,64,20,26,2,114,24,19,8,19,8,19,21,22,2,114,21,8,114,4,13,9,114,0,43,50,43,43,18,57,57,47,47,17,51,43,48,49,65,17,20,22,51,50,54,53,17,51,17,20,6,35,34,38,38,53,17,33,17,35,17,51,17,33,17,4,243,112,114,113,111,166,208,182,116,178,100,253,39,170,170,2,217,5,182,251,204,135,122,125,136,1,202,254,38,198,196,79,175,144,1,55,253,79,5,182,253,145,2,111,0,0,1,0,175,255,236,6,161,4,72,0,29,0,37,64,20,1,26,12,26,12,26,28,29,6,114,28,10,114,8,19,11,114,3,6,114,0,43,43,50,43,43,18,57,57,47,47,17,51,48,49,65,17,33,17,51,17,20,22,51,50,54,53,17,51,17,20,14,2,35,34,46,2,53,53,33,17,35,17,1,86,2,75,166,107,118,104,109,164,47,95,141,94,93,146,100,52,253,181,167,4,72,254,52,1,204,253,56,135,129,134,136,1,54,254,186,99,148,98,49,49,98,149,100,119,254,17,4,72,0,0,1,0,125,255,236,5,153,5,203,0,35,0,25,64,12,35,0,0,7,22,15,3,114,30,7,9,114,0,43,50,43,50,18,57,47,51,48,49,65,33,21,20,14,2,35,34,36,2,53,52,18,36,51,50,22,23,7,38,38,35,34,6,2,21,20,18,22,51,50,54,54,53,33,3,95,2,58,71,150,234,163,219,254,204,163,172,1,79,242,120,231,92,65,80,209,105,180,248,128,116,229,171,160,191,86,254,120,2,242,89,163,255,176,91,182,1,81,233,224,1,82,189,48,42,146,36,51,148,254,242,185,183,254,241,150,121,215,141,0,0,1,0,114,255,236,4,173,4,92,0,34,0,25,64,12,34,0,0,7,22,15,7,114,29,7,11,114,0,43,50,43,50,18,57,47,51,48,49,65,33,21,20,14,2,35,34,38,38,53,52,18,36,51,50,22,23,7,38,38,35,34,6,6,21,20,22,51,50,54,54,53,33,2,174,1,255,62,127,194,132,185,254,129,139,1,15,197,121,191,80,57,65,172,101,142,192,98,191,205,122,153,72,254,169,2,66,70,127,197,135,69,136,254,175,174,1,1,140,44,39,131,30,48,105,194,136,194,235,79,145,99,0,1,0,16,255,236,4,239,5,182,0,22,0,29,64,14,2,21,21,22,10,10,15,22,2,114,6,15,9,114,0,43,50,43,18,57,47,17,51,17,51,48,49,65,21,33,17,20,22,51,50,54,53,17,51,17,20,6,35,34,38,38,53,17,33,53,4,72,254,50,117,115,113,117,167,214,183,117,182,103,254,64,5,182,153,252,99,135,122,126,135,1,204,254,38,198,196,79,174,143,3,165,153,0,0,1,0,41,255,236,4,140,4,72,0,25,0,29,64,14,2,24,24,25,10,10,17,25,6,114,6,17,11,114,0,43,50,43,18,57,47,17,51,17,51,48,49,65,21,33,17,20,22,51,50,54,53,17,51,17,20,14,2,35,34,46,2,53,17,33,53,3,139,254,161,109,117,107,110,165,49,97,142,94,92,146,101,53,254,163,4,72,137,253,193,135,129,126,138,1,60,254,186,99,148,98,49,48,98,149,101,2,71,137,0,1,0,110,255,236,4,89,5,203,0,47,0,31,64,15,40,39,15,15,18,18,0,24,32,9,114,8,0,3,114,0,43,50,43,50,17,57,47,51,18,57,57,48,49,65,50,22,22,23,7,38,38,35,34,6,21,20,22,22,51,51,21,35,34,6,21,20,22,51,50,54,54,55,21,6,6,35,34,38,38,53,52,54,55,53,46,2,53,52,54,54,2,135,102,166,138,60,91,83,178,125,141,166,91,184,138,208,206,215,242,202,184,83,153,139,60,89,218,134,182,249,126,202,180,102,151,83,115,219,5,203,36,63,41,122,53,64,123,117,84,120,65,141,138,143,143,140,23,42,28,158,40,39,102,187,128,152,190,23,7,16,87,143,99,108,166,95,255,255,0,89,255,236,3,140,4,92,6,6,1,129,0,0,0,1,0,1,254,113,5,112,5,182,0,47,0,28,64,14,15,40,2,114,31,24,9,114,7,0,128,42,13,8,0,63,51,26,204,50,43,50,43,50,48,49,65,34,38,39,53,22,22,51,50,54,54,53,53,35,17,33,14,3,7,14,2,35,34,38,39,53,22,22,51,50,54,54,55,54,54,18,18,55,33,17,51,17,20,6,6,4,139,37,62,19,17,52,31,31,43,23,172,254,38,14,32,34,34,17,26,77,127,104,35,69,26,23,57,32,63,73,43,16,13,34,38,41,20,3,18,152,49,102,254,113,17,7,139,7,12,23,49,37,146,5,32,112,244,242,216,84,139,195,103,14,10,143,10,14,101,156,82,68,208,1,9,1,46,160,250,226,254,223,84,117,61,0,0,1,0,13,254,113,4,124,4,72,0,40,0,28,64,14,15,33,6,114,27,20,11,114,7,0,128,35,13,10,0,63,51,26,204,50,43,50,43,50,48,49,65,34,38,39,53,22,22,51,50,54,54,53,53,35,17,33,2,2,6,6,35,34,38,39,53,22,22,51,50,62,2,18,55,33,17,51,17,20,6,6,3,152,37,62,20,17,52,31,31,44,23,171,254,179,20,61,91,129,89,27,48,17,13,29,16,45,75,61,48,37,14,2,134,151,49,101,254,113,17,7,139,7,12,23,49,37,146,3,189,254,253,254,143,233,109,6,7,126,4,4,75,152,233,1,61,201,252,57,254,246,84,117,61,0,255,255,0,0,254,161,5,13,5,188,6,38,0,36,0,0,0,7,4,14,4,239,0,0,255,255,0,94,254,161,3,203,4,90,6,38,0,68,0,0,0,7,4,14,4,154,0,0,255,255,0,0,0,0,5,13,7,227,6,38,0,36,0,0,1,7,2,88,4,249,1,82,0,10,179,24,5,2,114,0,43,206,48,49,255,255,0,94,255,236,3,203,6,145,6,38,0,68,0,0,1,7,2,88,4,159,0,0,0,10,179,46,0,7,114,0,43,206,48,49,255,255,0,0,0,0,5,13,7,209,6,38,0,36,0,0,1,7,3,99,4,227,1,82,0,13,183,3,2,27,5,1,1,111,86,0,43,52,52,0,255,255,0,94,255,236,4,62,6,127,6,38,0,68,0,0,1,7,3,99,4,145,0,0,0,13,183,3,2,49,0,1,1,127,86,0,43,52,52,0,255,255,0,0,0,0,5,13,7,209,6,38,0,36,0,0,1,7,3,100,4,222,1,82,0,13,183,3,2,31,5,1,1,111,86,0,43,52,52,0,255,255,0,45,255,236,3,203,6,127,6,38,0,68,0,0,1,7,3,100,4,145,0,0,0,13,183,3,2,53,0,1,1,127,86,0,43,52,52,0,255,255,0,0,0,0,5,13,8,73,6,38,0,36,0,0,1,7,3,101,4,219,1,82,0,13,183,3,2,32,5,1,1,111,86,0,43,52,52,0,255,255,0,94,255,236,4,25,6,247,6,38,0,68,0,0,1,7,3,101,4,152,0,0,0,13,183,3,2,54,0,1,1,127,86,0,43,52,52,0,255,255,0,0,0,0,5,13,8,98,6,38,0,36,0,0,1,7,3,102,4,227,1,82,0,13,183,3,2,25,5,1,1,111,86,0,43,52,52,0,255,255,0,94,255,236,3,203,7,16,6,38,0,68,0,0,1,7,3,102,4,144,0,0,0,13,183,3,2,47,0,1,1,127,86,0,43,52,52,0,255,255,0,0,254,161,5,13,7,143,6,38,0,36,0,0,0,39,4,14,4,239,0,0,1,7,1,74,0,231,1,111,0,10,179,43,5,2,114,0,43,206,48,49,255,255,0,94,254,161,3,203,6,32,6,38,0,68,0,0,0,39,1,74,0,154,0,0,1,7,4,14,4,143,0,0,0,10,179,54,0,7,114,0,43,206,48,49,255,255,0,0,0,0,5,13,8,20,6,38,0,36,0,0,1,7,3,103,4,235,1,82,0,13,183,3,2,22,5,1,1,111,86,0,43,52,52,0,255,255,0,94,255,236,3,203,6,194,6,38,0,68,0,0,1,7,3,103,4,155,0,0,0,13,183,3,2,44,0,1,1,127,86,0,43,52,52,0,255,255,0,0,0,0,5,13,8,20,6,38,0,36,0,0,1,7,3,104,4,234,1,82,0,13,183,3,2,22,5,1,1,111,86,0,43,52,52,0,255,255,0,94,255,236,3,203,6,194,6,38,0,68,0,0,1,7,3,104,4,153,0,0,0,13,183,3,2,44,0,1,1,127,86,0,43,52,52,0,255,255,0,0,0,0,5,13,8,88,6,38,0,36,0,0,1,7,3,105,4,234,1,82,0,13,183,3,2,22,5,1,1,111,86,0,43,52,52,0,255,255,0,94,255,236,3,203,7,6,6,38,0,68,0,0,1,7,3,105,4,160,0,0,0,13,183,3,2,44,0,1,1,127,86,0,43,52,52,0,255,255,0,0,0,0,5,13,8,92,6,38,0,36,0,0,1,7,3,106,4,228,1,82,0,13,183,3,2,22,5,1,1,111,86,0,43,52,52,0,255,255,0,94,255,236,3,203,7,10,6,38,0,68,0,0,1,7,3,106,4,153,0,0,0,13,183,3,2,44,0,1,1,127,86,0,43,52,52,0,255,255,0,0,254,161,5,13,7,86,6,38,0,36,0,0,0,39,1,77,1,4,1,111,1,7,4,14,4,239,0,0,0,10,179,23,5,2,114,0,43,206,48,49,255,255,0,94,254,161,3,203,5,231,6,38,0,68,0,0,0,39,1,77,0,183,0,0,1,7,4,14,4,123,0,0,0,10,179,45,0,7,114,0,43,206,48,49,255,255,0,200,254,161,3,246,5,182,6,38,0,40,0,0,0,7,4,14,4,197,0,0,255,255,0,114,254,161,4,19,4,92,6,38,0,72,0,0,0,7,4,14,4,198,0,0,255,255,0,200,0,0,3,246,7,227,6,38,0,40,0,0,1,7,2,88,4,203,1,82,0,10,179,17,2,2,114,0,43,206,48,49,255,255,0,114,255,236,4,19,6,145,6,38,0,72,0,0,1,7,2,88,4,196,0,0,0,10,179,37,0,7,114,0,43,206,48,49,255,255,0,200,0,0,3,246,7,76,6,38,0,40,0,0,1,7,1,81,0,166,1,111,0,10,179,12,2,2,114,0,43,206,48,49,255,255,0,114,255,236,4,19,5,221,6,38,0,72,0,0,1,6,1,81,123,0,0,10,179,32,0,7,114,0,43,206,48,49,255,255,0,200,0,0,4,106,7,209,6,38,0,40,0,0,1,7,3,99,4,189,1,82,0,12,180,40,20,2,2,114,0,43,206,206,48,49,255,255,0,114,255,236,4,88,6,127,6,38,0,72,0,0,1,7,3,99,4,171,0,0,0,12,180,60,40,0,7,114,0,43,206,206,48,49,255,255,0,92,0,0,3,246,7,209,6,38,0,40,0,0,1,7,3,100,4,192,1,82,0,13,183,2,1,24,2,1,1,117,86,0,43,52,52,0,255,255,0,73,255,236,4,19,6,127,6,38,0,72,0,0,1,7,3,100,4,173,0,0,0,13,183,3,2,44,0,1,1,125,86,0,43,52,52,0,255,255,0,200,0,0,4,61,8,73,6,38,0,40,0,0,1,7,3,101,4,188,1,82,0,13,183,2,1,25,2,1,1,117,86,0,43,52,52,0,255,255,0,114,255,236,4,36,6,247,6,38,0,72,0,0,1,7,3,101,4,163,0,0,0,13,183,3,2,45,0,1,1,125,86,0,43,52,52,0,255,255,0,200,0,0,3,246,8,98,6,38,0,40,0,0,1,7,3,102,4,185,1,82,0,13,183,2,1,18,2,1,1,117,86,0,43,52,52,0,255,255,0,114,255,236,4,19,7,16,6,38,0,72,0,0,1,7,3,102,4,165,0,0,0,13,183,3,2,38,0,1,1,125,86,0,43,52,52,0,255,255,0,200,254,161,3,246,7,143,6,38,0,40,0,0,0,39,4,14,4,197,0,0,1,7,1,74,0,211,1,111,0,10,179,37,2,2,114,0,43,206,48,49,255,255,0,114,254,161,4,19,6,32,6,38,0,72,0,0,0,39,1,74,0,168,0,0,1,7,4,14,4,198,0,0,0,10,179,45,0,7,114,0,43,206,48,49,255,255,0,142,0,0,1,252,7,227,6,38,0,44,0,0,1,7,2,88,3,137,1,82,0,10,179,9,1,2,114,0,43,206,48,49,255,255,0,119,0,0,1,229,6,145,6,38,3,175,0,0,1,7,2,88,3,114,0,0,0,10,179,9,2,6,114,0,43,206,48,49,255,255,0,184,254,161,1,129,5,182,6,38,0,44,0,0,0,7,4,14,3,126,0,0,255,255,0,160,254,161,1,105,5,226,6,38,0,76,0,0,0,7,4,14,3,102,0,0,255,255,0,125,254,161,5,188,5,205,6,38,0,50,0,0,0,7,4,14,5,128,0,0,255,255,0,114,254,161,4,96,4,92,6,38,0,82,0,0,0,7,4,14,4,197,0,0,255,255,0,125,255,236,5,188,7,227,6,38,0,50,0,0,1,7,2,88,5,137,1,82,0,10,179,38,14,3,114,0,43,206,48,49,255,255,0,114,255,236,4,96,6,145,6,38,0,82,0,0,1,7,2,88,4,211,0,0,0,10,179,38,14,7,114,0,43,206,48,49,255,255,0,125,255,236,5,188,7,209,6,38,0,50,0,0,1,7,3,99,5,122,1,82,0,12,180,61,41,14,3,114,0,43,206,206,48,49,255,255,0,114,255,236,4,113,6,127,6,38,0,82,0,0,1,7,3,99,4,196,0,0,0,12,180,61,41,14,7,114,0,43,206,206,48,49,255,255,0,125,255,236,5,188,7,209,6,38,0,50,0,0,1,7,3,100,5,122,1,82,0,13,183,3,2,45,14,1,1,94,86,0,43,52,52,0,255,255,0,96,255,236,4,96,6,127,6,38,0,82,0,0,1,7,3,100,4,196,0,0,0,13,183,3,2,45,14,1,1,125,86,0,43,52,52,0,255,255,0,125,255,236,5,188,8,73,6,38,0,50,0,0,1,7,3,101,5,120,1,82,0,13,183,3,2,46,14,1,1,94,86,0,43,52,52,0,255,255,0,114,255,236,4,96,6,247,6,38,0,82,0,0,1,7,3,101,4,196,0,0,0,13,183,3,2,46,14,1,1,125,86,0,43,52,52,0,255,255,0,125,255,236,5,188,8,98,6,38,0,50,0,0,1,7,3,102,5,119,1,82,0,13,183,3,2,39,14,1,1,94,86,0,43,52,52,0,255,255,0,114,255,236,4,96,7,16,6,38,0,82,0,0,1,7,3,102,4,194,0,0,0,13,183,3,2,39,14,1,1,125,86,0,43,52,52,0,255,255,0,125,254,161,5,188,7,143,6,38,0,50,0,0,0,39,4,14,5,128,0,0,1,7,1,74,1,127,1,111,0,10,179,58,14,3,114,0,43,206,48,49,255,255,0,114,254,161,4,96,6,32,6,38,0,82,0,0,0,39,4,14,4,197,0,0,1,7,1,74,0,202,0,0,0,10,179,58,14,7,114,0,43,206,48,49,255,255,0,125,255,236,6,98,7,144,6,38,2,84,0,0,1,7,0,118,2,88,1,111,0,10,179,51,14,3,114,0,43,206,48,49,255,255,0,114,255,236,5,24,6,33,6,38,2,85,0,0,1,7,0,118,1,164,0,0,0,10,179,49,11,7,114,0,43,206,48,49,255,255,0,125,255,236,6,98,7,144,6,38,2,84,0,0,1,7,0,67,1,194,1,111,0,10,179,50,14,3,114,0,43,206,48,49,255,255,0,114,255,236,5,24,6,33,6,38,2,85,0,0,1,7,0,67,1,12,0,0,0,10,179,48,11,7,114,0,43,206,48,49,255,255,0,125,255,236,6,98,7,227,6,38,2,84,0,0,1,7,2,88,5,138,1,82,0,10,179,49,14,3,114,0,43,206,48,49,255,255,0,114,255,236,5,24,6,145,6,38,2,85,0,0,1,7,2,88,4,211,0,0,0,10,179,47,11,7,114,0,43,206,48,49,255,255,0,125,255,236,6,98,7,76,6,38,2,84,0,0,1,7,1,81,1,82,1,111,0,10,179,61,14,3,114,0,43,206,48,49,255,255,0,114,255,236,5,24,5,221,6,38,2,85,0,0,1,7,1,81,0,158,0,0,0,10,179,59,11,7,114,0,43,206,48,49,255,255,0,125,254,161,6,98,6,20,6,38,2,84,0,0,0,7,4,14,5,122,0,0,255,255,0,114,254,161,5,24,4,240,6,38,2,85,0,0,0,7,4,14,4,199,0,0,255,255,0,185,254,161,5,26,5,182,6,38,0,56,0,0,0,7,4,14,5,72,0,0,255,255,0,163,254,161,4,56,4,72,6,38,0,88,0,0,0,7,4,14,4,184,0,0,255,255,0,185,255,236,5,26,7,227,6,38,0,56,0,0,1,7,2,88,5,79,1,82,0,10,179,25,9,2,114,0,43,206,48,49,255,255,0,163,255,236,4,56,6,145,6,38,0,88,0,0,1,7,2,88,4,211,0,0,0,10,179,29,13,6,114,0,43,206,48,49,255,255,0,185,255,236,6,120,7,144,6,38,2,86,0,0,1,7,0,118,2,38,1,111,0,10,179,39,21,2,114,0,43,206,48,49,255,255,0,163,255,236,5,143,6,33,6,38,2,87,0,0,1,7,0,118,1,175,0,0,0,10,179,42,19,6,114,0,43,206,48,49,255,255,0,185,255,236,6,120,7,144,6,38,2,86,0,0,1,7,0,67,1,143,1,111,0,10,179,38,21,2,114,0,43,206,48,49,255,255,0,163,255,236,5,143,6,33,6,38,2,87,0,0,1,7,0,67,1,24,0,0,0,10,179,41,19,6,114,0,43,206,48,49,255,255,0,185,255,236,6,120,7,227,6,38,2,86,0,0,1,7,2,88,5,89,1,82,0,10,179,37,21,2,114,0,43,206,48,49,255,255,0,163,255,236,5,143,6,145,6,38,2,87,0,0,1,7,2,88,4,216,0,0,0,10,179,40,19,6,114,0,43,206,48,49,255,255,0,185,255,236,6,120,7,76,6,38,2,86,0,0,1,7,1,81,1,32,1,111,0,10,179,49,21,2,114,0,43,206,48,49,255,255,0,163,255,236,5,143,5,221,6,38,2,87,0,0,1,7,1,81,0,168,0,0,0,10,179,52,19,6,114,0,43,206,48,49,255,255,0,185,254,161,6,120,6,20,6,38,2,86,0,0,0,7,4,14,5,81,0,0,255,255,0,163,254,161,5,143,4,242,6,38,2,87,0,0,0,7,4,14,4,183,0,0,255,255,0,0,254,161,4,121,5,182,6,38,0,60,0,0,0,7,4,14,4,155,0,0,255,255,0,2,254,19,4,2,4,72,6,38,0,92,0,0,0,7,4,14,5,100,255,226,255,255,0,0,0,0,4,121,7,227,6,38,0,60,0,0,1,7,2,88,4,167,1,82,0,10,179,14,7,2,114,0,43,206,48,49,255,255,0,2,254,19,4,2,6,145,6,38,0,92,0,0,1,7,2,88,4,100,0,0,0,10,179,35,0,6,114,0,43,206,48,49,255,255,0,0,0,0,4,121,7,76,6,38,0,60,0,0,1,7,1,81,0,113,1,111,0,10,179,26,7,2,114,0,43,206,48,49,255,255,0,2,254,19,4,2,5,221,6,38,0,92,0,0,1,6,1,81,53,0,0,10,179,47,0,6,114,0,43,206,48,49,255,255,0,114,254,205,4,208,6,20,6,38,0,211,0,0,1,7,0,66,0,240,0,0,0,10,179,47,0,11,114,0,43,206,48,49,0,2,252,112,4,217,255,173,6,127,0,18,0,28,0,35,64,17,24,19,22,128,28,64,4,9,18,3,13,128,1,15,7,1,7,0,47,93,51,26,205,23,57,26,220,26,204,57,57,48,49,65,35,38,38,39,6,6,7,35,53,62,2,55,51,30,2,23,39,54,54,55,51,21,6,6,7,35,254,211,94,51,109,51,53,107,51,95,35,78,76,31,172,31,75,78,35,79,41,57,32,167,43,105,53,96,4,217,35,86,49,49,86,35,24,38,86,92,45,45,92,86,38,194,50,90,64,21,58,105,43,0,0,2,251,156,4,217,254,217,6,127,0,18,0,28,0,35,64,16,22,24,128,27,19,64,15,1,10,3,5,0,128,12,12,0,0,47,50,47,26,16,204,23,57,26,222,50,26,205,50,48,49,65,53,62,2,55,51,30,2,23,21,35,38,38,39,6,6,7,39,38,38,39,53,51,22,22,23,21,252,116,34,78,77,31,174,32,75,77,35,96,52,106,53,52,108,52,106,57,103,44,165,32,58,40,4,217,22,38,86,92,45,45,92,86,38,22,35,86,49,49,86,35,195,43,105,58,21,64,91,51,21,0,0,2,252,112,4,217,255,129,6,247,0,18,0,40,0,45,64,20,37,34,34,28,25,38,19,192,27,64,9,18,6,128,4,14,14,12,12,6,0,47,51,47,51,17,51,26,16,205,57,26,220,26,204,50,57,57,50,17,51,48,49,65,30,2,23,21,35,38,38,39,6,6,7,35,53,62,2,55,1,50,22,21,20,6,7,7,35,39,54,54,53,52,38,35,34,6,7,53,54,54,253,248,31,75,78,35,94,51,109,51,53,107,51,95,35,78,76,31,1,118,91,100,75,54,6,79,9,60,63,55,46,22,39,13,14,42,5,246,45,92,86,38,24,35,86,49,49,86,35,24,38,86,92,45,1,1,69,71,58,60,12,81,129,9,32,37,36,28,4,3,79,4,4,0,0,2,252,105,4,217,254,231,7,16,0,18,0,43,0,37,64,16,43,43,28,35,23,40,31,31,23,9,18,12,128,6,6,12,0,47,51,47,26,16,221,57,198,50,47,50,16,205,50,50,47,48,49,65,30,2,23,21,35,38,38,39,6,6,7,35,53,62,2,55,1,14,2,35,34,46,2,35,34,6,7,35,54,54,51,50,30,2,51,50,54,55,253,250,32,76,78,35,92,53,107,53,52,111,51,92,34,79,77,31,1,150,6,47,79,54,37,70,66,63,29,41,45,13,88,11,96,80,38,72,67,62,28,41,44,12,5,243,45,92,85,38,22,35,84,49,49,84,35,22,38,85,92,45,1,29,64,99,55,30,39,30,49,53,95,124,30,40,30,50,52,0,0,2,252,117,4,217,254,200,6,194,0,13,0,24,0,29,64,11,15,24,21,20,20,13,13,7,128,10,3,0,47,51,26,204,50,47,50,124,47,51,24,204,50,48,49,65,6,6,35,34,38,39,51,22,22,51,50,54,55,55,21,14,2,7,35,53,54,54,55,254,200,11,149,140,143,144,8,102,8,99,88,79,107,10,33,29,66,71,36,93,39,60,30,5,225,122,142,139,125,85,53,57,81,225,21,38,75,66,28,22,50,92,64,0,0,2,252,117,4,217,254,200,6,194,0,13,0,24,0,27,64,10,23,14,17,19,19,13,7,128,10,3,0,47,51,26,204,50,50,124,47,51,24,205,50,48,49,65,6,6,35,34,38,39,51,22,22,51,50,54,55,37,22,22,23,21,35,46,2,39,53,254,200,11,148,141,143,143,9,102,8,99,88,80,106,10,254,242,31,57,40,91,35,72,66,29,5,225,122,142,139,125,85,53,56,82,225,64,92,50,22,28,66,75,38,21,0,2,252,117,4,217,254,200,7,6,0,13,0,35,0,31,64,12,23,20,29,14,22,22,10,10,13,7,128,3,0,47,26,204,50,51,17,51,124,47,24,204,50,57,57,48,49,65,6,6,35,34,38,39,51,22,22,51,50,54,55,3,50,22,21,20,6,7,7,35,39,54,54,53,52,38,35,34,6,7,53,54,54,254,200,11,148,141,143,143,9,102,8,99,88,80,106,10,237,91,97,74,53,6,79,9,59,62,55,44,23,40,13,15,43,5,225,122,142,139,125,85,53,56,82,1,37,68,71,58,59,11,45,94,9,32,36,35,28,5,2,76,5,4,0,2,252,103,4,217,254,230,7,10,0,13,0,38,0,31,64,13,38,23,30,128,35,26,18,64,13,7,128,10,3,0,47,51,26,220,50,26,222,50,50,26,205,50,50,48,49,65,6,6,35,34,38,39,51,22,22,51,50,54,55,19,14,2,35,34,46,2,35,34,6,7,35,54,54,51,50,30,2,51,50,54,55,254,200,11,148,141,143,143,9,102,8,99,88,80,106,10,132,6,47,79,54,37,71,66,63,29,41,44,14,88,11,96,81,38,72,67,62,28,41,44,11,5,222,121,140,137,124,84,51,53,82,1,44,63,97,55,30,40,30,49,53,95,120,30,39,30,50,51,0,1,0,48,254,62,1,110,0,3,0,19,0,12,179,17,10,10,4,0,47,51,47,51,48,49,87,52,38,39,55,22,22,21,20,6,35,34,38,39,53,22,22,51,50,54,228,76,68,117,60,105,104,97,31,60,26,16,48,25,39,52,241,58,119,64,3,44,129,86,91,103,10,7,107,5,6,50,0,1,0,29,254,113,1,121,0,152,0,19,0,14,180,7,0,192,13,14,0,47,51,26,204,50,48,49,83,34,38,39,53,22,22,51,50,54,54,53,53,35,53,51,17,20,6,6,147,37,62,19,17,53,31,31,43,23,24,174,50,101,254,113,17,7,139,7,12,23,49,37,146,152,254,223,84,117,61,0,255,255,0,18,254,20,4,83,5,182,6,38,0,55,0,0,0,7,0,122,1,81,0,0,255,255,0,32,254,20,2,171,5,70,6,38,0,87,0,0,0,7,0,122,0,207,0,0,255,255,0,125,254,62,5,188,5,205,6,38,0,50,0,0,0,7,1,80,2,50,0,0,255,255,0,114,254,62,4,96,4,92,6,38,0,82,0,0,0,7,1,80,1,134,0,0,255,255,0,125,254,62,5,188,6,208,6,38,0,50,0,0,0,39,1,76,1,159,1,111,1,7,1,80,2,78,0,0,0,10,179,35,14,3,114,0,43,206,48,49,255,255,0,114,254,62,4,96,5,97,6,38,0,82,0,0,0,39,1,76,0,234,0,0,1,7,1,80,1,134,0,0,0,10,179,35,14,7,114,0,43,206,48,49,0,2,0,106,255,236,4,12,4,92,0,23,0,31,0,25,64,12,13,25,25,0,29,8,11,114,17,0,7,114,0,43,50,43,50,18,57,47,51,48,49,65,50,22,22,21,20,2,6,35,34,38,38,53,53,33,38,38,35,34,6,7,53,54,54,1,33,30,2,51,50,54,2,0,158,236,130,119,217,147,140,201,106,2,246,4,185,170,103,160,87,83,164,1,202,253,189,1,58,121,94,134,158,4,92,129,250,181,177,254,254,141,124,224,148,103,192,203,37,38,147,36,34,253,97,97,149,83,174,0,255,255,253,5,4,184,254,115,6,145,6,6,2,88,0,0,255,255,0,1,255,236,6,248,5,205,4,39,0,50,1,60,0,0,1,7,3,118,254,145,255,154,0,16,181,3,2,50,14,2,0,184,255,252,176,86,0,43,52,52,0,2,1,112,4,206,3,140,6,47,0,10,0,28,0,29,64,12,28,11,11,0,25,17,17,6,4,128,1,0,0,47,50,26,204,50,50,47,51,17,51,47,51,48,49,65,53,54,54,55,51,21,14,2,7,7,38,38,53,52,54,51,50,22,21,20,14,2,35,20,22,23,2,121,23,54,15,183,20,63,74,38,128,112,105,55,47,43,58,16,28,38,22,53,65,4,223,25,60,164,69,21,42,102,105,48,17,12,118,104,53,66,45,49,24,34,23,11,34,56,6,0,0,2,0,41,3,68,2,158,6,210,0,11,0,23,0,14,181,12,0,120,18,6,119,0,63,51,228,50,48,49,65,34,38,53,52,54,51,50,22,21,20,6,39,50,54,53,52,38,35,34,6,21,20,22,1,98,157,156,150,163,157,159,150,166,92,86,86,92,90,85,84,3,68,233,223,219,235,232,222,218,238,120,165,171,170,165,165,172,169,165,0,2,0,41,3,68,2,161,6,209,0,30,0,44,0,25,64,11,31,12,11,15,15,39,22,120,7,0,119,0,63,50,228,50,57,47,51,51,51,48,49,65,50,22,23,21,38,38,35,34,6,6,7,51,54,54,51,50,22,21,20,6,6,35,34,38,38,53,52,62,2,19,34,6,6,21,20,22,22,51,50,54,53,52,38,1,222,31,70,24,23,71,38,111,129,58,6,8,29,113,85,121,150,75,138,93,93,147,86,39,97,170,23,59,89,49,43,86,62,80,99,88,6,209,8,6,114,8,11,86,147,92,44,60,143,131,94,137,74,85,174,131,103,187,145,84,254,77,44,69,39,53,98,62,97,96,80,92,0,2,0,35,3,68,2,156,6,213,0,29,0,43,0,27,64,12,20,21,36,36,24,24,16,9,120,30,0,119,0,63,50,228,50,57,47,51,17,51,51,48,49,65,50,22,22,21,20,14,2,35,34,38,39,53,22,22,51,50,54,54,55,35,6,6,35,34,38,53,52,54,23,34,6,21,20,22,51,50,54,54,53,52,38,38,1,85,92,148,87,39,95,168,130,35,72,23,22,66,49,112,126,57,5,10,28,106,83,130,151,167,139,76,100,84,88,58,89,50,42,85,6,213,83,171,134,103,189,148,85,8,6,116,9,12,91,150,88,40,65,146,133,133,168,110,94,92,81,97,43,69,39,61,96,56,255,255,255,218,255,236,2,147,7,141,6,38,1,133,0,0,1,7,3,136,255,111,0,0,0,18,64,10,4,3,2,1,33,16,1,1,141,86,0,43,52,52,52,52,255,255,255,218,255,236,2,147,7,141,6,38,1,133,0,0,1,7,3,135,255,111,0,0,0,18,64,10,4,3,2,1,27,16,1,1,141,86,0,43,52,52,52,52,255,255,255,204,255,236,2,147,7,141,6,38,1,133,0,0,1,7,3,134,255,109,0,0,0,18,64,10,4,3,2,1,37,16,1,1,141,86,0,43,52,52,52,52,255,255,255,206,255,236,2,147,7,141,6,38,1,133,0,0,1,7,3,133,255,111,0,0,0,18,64,10,4,3,2,1,31,16,1,1,141,86,0,43,52,52,52,52,255,255,0,163,255,236,4,111,7,141,6,38,1,145,0,0,1,7,3,136,0,220,0,0,0,18,64,10,4,3,2,1,40,5,1,1,141,86,0,43,52,52,52,52,255,255,0,163,255,236,4,111,7,141,6,38,1,145,0,0,1,7,3,135,0,220,0,0,0,18,64,10,4,3,2,1,34,5,1,1,141,86,0,43,52,52,52,52,255,255,0,163,255,236,4,111,7,141,6,38,1,145,0,0,1,7,3,134,0,219,0,0,0,18,64,10,4,3,2,1,44,5,1,1,141,86,0,43,52,52,52,52,255,255,0,163,255,236,4,111,7,141,6,38,1,145,0,0,1,7,3,133,0,220,0,0,0,18,64,10,4,3,2,1,38,5,1,1,100,86,0,43,52,52,52,52,0,1,0,199,254,123,5,1,5,203,0,38,0,28,64,14,25,24,15,15,29,3,114,22,2,114,20,8,7,0,0,47,50,63,43,43,50,17,51,51,48,49,65,34,38,39,53,22,22,51,50,54,54,53,17,52,38,35,34,6,6,21,17,35,17,51,23,51,62,2,51,50,22,22,21,17,20,14,2,3,131,52,77,28,32,79,46,54,97,61,164,185,147,172,74,170,134,29,9,37,127,159,84,154,225,124,55,102,140,254,123,14,13,144,9,12,41,100,88,3,209,197,171,110,202,137,252,138,5,182,201,65,100,57,107,219,170,252,37,99,147,96,47,0,255,255,0,200,254,127,5,63,5,182,6,6,1,11,0,0,0,1,0,186,255,236,4,244,5,203,0,40,0,35,64,18,6,23,23,0,28,27,18,18,32,3,114,25,2,114,11,0,9,114,0,43,50,43,43,50,17,51,51,17,57,47,206,48,49,69,34,38,38,53,53,51,21,20,22,22,51,50,54,53,17,52,38,35,34,6,6,21,21,35,17,51,23,51,62,2,51,50,22,22,21,17,20,6,6,2,208,173,238,123,170,84,167,122,195,174,164,185,147,172,74,170,135,27,11,37,126,159,85,153,225,124,119,242,20,132,241,163,25,31,123,170,89,215,176,1,192,197,171,110,202,137,149,2,213,201,65,100,57,107,219,170,254,44,156,243,140,0,0,4,0,95,4,213,2,204,7,141,0,13,0,25,0,37,0,49,0,37,64,16,32,26,26,14,43,38,38,7,10,4,128,0,0,20,20,14,0,47,51,17,51,47,26,204,50,51,50,47,196,17,51,17,51,48,49,65,34,38,39,51,22,22,51,50,54,55,51,6,6,5,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,1,53,62,2,55,51,21,14,2,7,1,144,140,150,15,106,14,101,88,77,109,16,110,16,162,254,189,38,52,52,38,38,54,54,1,87,37,52,52,37,38,53,53,254,186,26,45,41,20,167,28,68,72,37,5,199,139,112,68,48,54,62,112,139,242,49,49,51,46,46,51,49,49,49,49,51,46,46,51,49,49,1,213,23,33,62,68,41,20,37,74,68,28,0,4,0,95,4,213,2,204,7,141,0,13,0,25,0,37,0,49,0,43,64,19,26,32,32,20,48,38,64,42,44,44,13,7,128,10,3,3,14,14,20,0,47,51,17,51,47,51,26,204,50,50,47,51,26,205,50,17,51,17,51,48,49,65,6,6,35,34,38,39,51,22,22,51,50,54,55,1,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,38,53,52,54,3,30,2,23,21,35,46,2,39,53,2,204,16,162,138,140,150,15,106,14,101,88,77,109,16,254,121,38,54,54,38,38,52,52,1,163,38,53,53,38,37,52,52,201,20,41,45,26,94,36,73,67,29,6,194,112,139,139,112,68,48,54,62,254,214,46,51,49,49,49,49,51,46,46,51,49,49,49,49,51,46,1,245,41,68,62,33,23,28,68,74,37,20,0,4,0,107,4,213,2,193,7,141,0,3,0,15,0,27,0,39,0,31,64,13,16,22,22,10,39,33,3,3,2,2,4,4,10,0,47,51,17,51,47,51,16,222,205,17,51,17,51,48,49,65,21,33,53,23,50,22,21,20,6,35,34,38,53,52,54,33,50,22,21,20,6,35,34,38,53,52,54,19,21,14,2,7,35,53,62,2,55,2,193,253,170,108,38,54,54,38,38,52,52,1,163,38,53,53,38,37,52,52,48,28,68,72,37,94,26,45,41,20,6,103,136,136,207,46,51,49,49,49,49,51,46,46,51,49,49,49,49,51,46,1,245,20,37,74,68,28,23,33,62,68,41,0,0,4,0,107,4,213,2,193,7,141,0,11,0,15,0,27,0,39,0,31,64,13,34,28,28,16,6,0,13,13,12,12,22,22,16,0,47,51,17,51,47,51,16,222,205,17,51,17,51,48,49,65,46,2,39,53,51,30,2,23,21,5,53,33,21,1,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,1,141,36,73,67,29,167,20,41,45,26,254,128,2,86,254,22,38,52,52,38,38,54,54,1,87,37,52,52,37,38,53,53,6,170,28,68,74,37,20,41,68,62,33,23,203,136,136,254,246,49,49,51,46,46,51,49,49,49,49,51,46,46,51,49,49,0,0,1,0,181,4,222,3,231,5,164,0,13,0,29,64,12,1,12,12,5,9,9,13,128,3,7,7,11,0,47,51,17,51,26,205,50,17,51,50,17,51,48,49,65,21,7,35,39,35,7,35,39,35,7,35,39,53,3,231,76,32,46,195,46,33,46,192,46,32,74,5,164,32,166,102,102,102,102,166,32,255,255,0,30,0,0,5,191,6,31,4,38,0,73,0,0,0,7,0,73,2,177,0,0,255,255,0,30,0,0,4,25,6,31,4,38,0,73,0,0,0,7,0,76,2,177,0,0,255,255,0,30,0,0,4,7,6,31,4,38,0,73,0,0,0,7,0,79,2,177,0,0,255,255,0,30,0,0,6,202,6,31,4,38,0,73,0,0,0,39,0,73,2,177,0,0,0,7,0,76,5,98,0,0,255,255,0,30,0,0,6,184,6,31,4,38,0,73,0,0,0,39,0,73,2,177,0,0,0,7,0,79,5,98,0,0,0,1,0,186,255,237,5,87,5,203,0,43,0,38,64,19,39,8,28,5,5,29,4,0,26,26,0,20,13,9,114,33,0,3,114,0,43,50,43,50,17,57,47,18,57,57,51,17,51,63,48,49,65,50,22,22,23,1,30,2,21,20,6,6,35,34,38,39,53,22,22,51,50,54,53,52,38,35,35,53,1,46,2,35,34,6,6,21,17,35,17,52,54,54,2,219,134,192,124,32,254,218,129,203,116,106,223,176,107,186,78,79,194,91,176,159,182,179,118,1,62,24,81,120,83,125,163,79,168,120,242,5,203,81,146,100,254,197,3,100,184,131,129,200,113,35,41,156,43,49,160,143,137,140,125,1,83,53,75,41,97,173,115,252,75,3,182,153,241,139,0,1,255,230,254,20,5,15,5,205,0,38,0,30,64,16,13,20,20,25,8,28,5,4,26,6,2,114,32,0,3,114,0,43,50,43,47,23,57,51,47,51,48,49,83,50,22,22,23,19,1,51,1,1,30,2,51,50,54,55,21,6,6,35,34,38,38,39,3,1,35,1,3,38,38,35,34,6,7,53,54,54,196,69,85,60,30,220,1,124,182,254,25,1,34,36,51,54,37,17,49,26,30,74,38,81,96,73,48,218,254,32,183,2,73,253,35,55,54,19,49,31,29,63,5,205,46,98,78,253,233,2,222,252,107,253,74,83,89,33,6,6,126,11,13,68,146,117,2,21,252,163,4,19,2,101,88,92,8,11,127,11,19,0,0,3,0,195,254,20,4,170,5,182,0,20,0,29,0,39,0,32,64,15,8,9,21,21,30,30,0,31,19,18,8,29,0,2,114,0,43,50,63,205,51,18,57,47,51,18,57,57,48,49,83,33,32,22,21,20,6,6,7,21,30,2,21,20,6,6,35,33,17,35,19,33,50,54,53,52,38,35,35,17,17,33,50,54,53,52,38,38,35,195,1,171,1,25,255,68,126,88,103,142,73,132,236,158,254,209,170,170,1,20,180,162,182,183,253,1,40,179,176,82,165,127,5,182,184,182,87,133,86,16,8,16,84,141,104,142,187,92,254,20,5,44,126,124,126,118,253,138,253,211,148,143,88,118,60,0,255,255,0,200,254,20,3,251,5,182,6,38,0,47,0,0,1,7,0,122,1,153,0,0,0,11,182,1,23,0,1,0,0,86,0,43,52,0,255,255,0,200,254,20,5,63,5,182,6,38,0,49,0,0,1,7,0,122,2,48,0,0,0,11,182,1,37,1,1,0,0,86,0,43,52,0,255,255,0,0,254,62,5,13,5,188,6,38,0,36,0,0,0,7,1,80,1,151,0,0,255,255,0,200,254,62,3,246,5,182,6,38,0,40,0,0,0,7,1,80,1,107,0,0,255,255,0,88,254,62,1,163,5,182,6,38,0,44,0,0,1,6,1,80,6,0,0,11,182,1,21,0,0,0,30,86,0,43,52,0,255,255,0,185,254,62,5,26,5,182,6,38,0,56,0,0,0,7,1,80,1,239,0,0,0,1,0,87,0,0,2,81,5,182,0,11,0,40,64,19,9,4,4,8,8,5,5,6,2,114,10,3,3,11,11,2,2,1,8,0,63,51,17,51,17,51,17,51,43,50,17,51,17,51,17,51,48,49,97,33,53,55,17,39,53,33,21,7,17,23,2,81,254,6,168,168,1,250,168,168,99,35,4,168,37,99,99,37,251,88,35,0,0,1,0,56,255,233,2,138,5,182,0,17,0,14,182,12,2,114,7,0,9,114,0,43,50,43,48,49,69,34,38,39,53,22,22,51,50,54,54,53,17,51,17,20,6,6,1,22,71,110,41,49,109,59,57,94,56,170,91,166,23,29,23,144,20,26,45,107,93,4,66,251,202,138,180,89,255,255,0,76,0,0,2,81,7,144,6,38,3,152,0,0,1,7,0,67,255,250,1,111,0,10,179,18,6,2,114,0,43,206,48,49,255,255,0,87,0,0,2,119,7,144,6,38,3,152,0,0,1,7,0,118,0,144,1,111,0,10,179,19,6,2,114,0,43,206,48,49,255,255,0,9,0,0,2,170,7,143,6,38,3,152,0,0,1,7,1,74,255,183,1,111,0,10,179,25,6,2,114,0,43,206,48,49,255,255,0,58,0,0,2,111,7,65,6,38,3,152,0,0,1,7,0,106,255,4,1,111,0,12,180,33,21,6,2,114,0,43,206,206,48,49,255,255,255,220,0,0,2,195,7,76,6,38,3,152,0,0,1,7,1,81,255,138,1,111,0,10,179,29,6,2,114,0,43,206,48,49,255,255,0,41,0,0,2,128,6,208,6,38,3,152,0,0,1,7,1,76,255,215,1,111,0,10,179,14,6,2,114,0,43,206,48,49,255,255,0,38,0,0,2,148,7,86,6,38,3,152,0,0,1,7,1,77,255,212,1,111,0,10,179,16,6,2,114,0,43,206,48,49,255,255,0,87,254,62,2,81,5,182,6,38,3,152,0,0,0,7,1,80,0,176,0,0,255,255,0,87,254,62,2,81,5,182,6,38,3,152,0,0,0,6,1,80,93,0,255,255,0,87,0,0,2,81,7,81,6,38,3,152,0,0,1,7,1,78,0,163,1,111,0,10,179,18,6,2,114,0,43,206,48,49,255,255,0,87,254,127,4,20,5,182,4,38,3,152,0,0,0,7,0,45,2,170,0,0,255,255,0,56,255,233,3,134,7,143,6,38,3,153,0,0,1,7,1,74,0,147,1,111,0,10,179,31,12,2,114,0,43,206,48,49,255,255,0,87,0,0,2,81,7,227,6,38,3,152,0,0,1,7,2,88,3,187,1,82,0,10,179,17,6,2,114,0,43,206,48,49,255,255,0,87,254,161,2,81,5,182,6,38,3,152,0,0,0,7,4,14,3,180,0,0,255,255,255,254,0,0,3,67,6,4,4,39,3,152,0,242,0,0,0,7,1,83,253,246,255,147,255,255,0,87,0,0,2,81,5,182,6,6,3,152,0,0,255,255,0,58,0,0,2,111,7,65,6,38,3,152,0,0,1,7,0,106,255,4,1,111,0,12,180,33,21,6,2,114,0,43,206,206,48,49,255,255,0,87,0,0,2,81,5,182,6,6,3,152,0,0,255,255,0,58,0,0,2,111,7,65,6,38,3,152,0,0,1,7,0,106,255,4,1,111,0,12,180,33,21,6,2,114,0,43,206,206,48,49,255,255,0,56,255,233,2,138,5,182,6,6,3,153,0,0,255,255,0,87,0,0,2,81,5,182,6,6,3,152,0,0,0,1,0,175,0,0,1,85,4,72,0,3,0,12,181,2,6,114,1,10,114,0,43,43,48,49,97,35,17,51,1,85,166,166,4,72,0,1,255,144,254,20,1,85,4,72,0,16,0,14,182,11,6,114,7,0,15,114,0,43,50,43,48,49,83,34,38,39,53,22,22,51,50,54,53,17,51,17,20,6,6,43,51,76,28,31,64,40,68,84,166,64,132,254,20,15,10,135,10,11,76,100,4,249,251,11,100,143,76,0,255,255,0,175,254,20,4,166,6,31,6,6,1,126,0,0,255,255,255,240,254,20,4,78,4,80,6,6,1,147,0,0,255,255,0,114,254,20,4,53,6,32,6,38,3,186,0,0,1,6,2,54,101,0,0,10,179,58,0,7,114,0,43,206,48,49,255,255,0,65,254,20,1,208,6,20,6,38,0,79,0,0,1,6,0,122,37,0,0,11,182,1,21,1,1,0,0,86,0,43,52,0,255,255,0,175,254,20,4,65,4,92,6,38,0,81,0,0,1,7,0,122,1,162,0,0,0,14,180,1,25,14,0,0,184,254,20,176,86,0,43,52,0,3,0,94,254,62,3,203,4,90,0,21,0,51,0,62,0,50,64,25,8,7,7,29,59,59,33,53,52,52,41,40,40,22,33,11,114,27,18,45,22,7,114,15,0,0,47,50,43,50,63,43,18,57,47,51,51,17,51,17,51,17,51,51,17,51,48,49,65,34,38,53,52,54,54,55,23,14,2,21,20,22,51,50,54,55,21,6,6,3,50,22,21,17,35,39,35,14,2,35,34,38,38,53,52,36,37,55,53,52,38,35,34,6,7,39,54,54,1,7,6,6,21,20,22,51,50,54,53,2,97,104,101,72,109,54,92,61,85,45,51,44,34,48,16,27,57,64,196,190,121,32,8,46,100,131,95,100,155,89,1,4,1,10,189,122,111,86,156,70,51,74,192,1,72,167,205,168,114,94,146,186,254,62,100,90,73,137,116,39,30,56,102,101,57,47,49,8,5,108,7,11,6,28,176,193,253,23,162,60,81,41,70,142,109,164,176,8,8,67,142,114,50,34,126,38,54,253,194,7,8,118,108,94,90,162,162,0,255,255,0,114,254,62,4,19,4,92,6,38,0,72,0,0,0,7,1,80,1,109,0,0,255,255,0,49,254,62,1,124,5,226,6,38,0,76,0,0,0,6,1,80,223,0,0,2,0,163,254,62,4,56,4,72,0,21,0,45,0,36,64,19,45,6,114,35,6,114,8,7,7,26,40,40,15,0,30,11,114,24,10,0,63,43,204,50,51,17,51,51,17,51,43,43,48,49,65,34,38,53,52,54,54,55,23,14,2,21,20,22,51,50,54,55,21,6,6,1,17,35,39,35,14,2,35,34,38,38,53,17,51,17,20,22,51,50,54,54,53,17,2,147,106,101,57,95,57,129,64,90,47,51,44,33,49,17,28,58,1,127,136,24,9,34,108,135,76,130,176,89,168,124,127,122,145,64,254,62,100,90,58,111,99,39,11,49,92,89,47,47,49,8,5,108,7,11,6,10,251,184,154,57,78,39,84,176,138,2,206,253,62,137,135,92,179,130,2,65,0,2,0,114,254,20,4,53,4,92,0,34,0,51,0,35,64,19,26,42,42,29,11,114,18,11,15,114,5,6,114,3,35,35,0,7,114,0,43,50,17,51,43,43,50,43,50,17,51,48,49,65,50,22,23,51,55,51,17,20,6,6,35,34,38,39,53,22,22,51,50,54,53,53,52,54,55,35,6,6,35,34,2,17,16,18,23,34,6,6,21,20,22,51,50,62,2,53,53,52,38,38,2,54,113,173,59,11,22,133,104,215,168,120,196,77,77,207,118,150,163,5,1,8,55,173,117,212,239,238,237,98,135,70,154,149,87,124,77,37,68,143,4,92,85,85,150,251,162,154,209,107,36,35,154,40,46,170,148,48,29,91,22,88,87,1,40,1,12,1,7,1,53,140,102,193,138,208,219,48,97,146,97,49,147,187,89,0,255,255,0,114,254,20,4,53,6,32,6,38,3,186,0,0,1,7,1,74,0,190,0,0,0,10,179,65,0,7,114,0,43,206,48,49,255,255,0,114,254,20,4,53,5,231,6,38,3,186,0,0,1,7,1,77,0,220,0,0,0,10,179,56,0,7,114,0,43,206,48,49,255,255,0,114,254,20,4,53,5,226,6,38,3,186,0,0,1,7,1,78,1,170,0,0,0,10,179,58,0,7,114,0,43,206,48,49,0,1,255,231,255,225,3,164,6,31,0,43,0,37,64,18,17,39,39,19,20,20,36,6,114,32,25,1,114,7,6,13,13,0,0,47,50,16,204,50,43,50,43,50,17,51,50,17,51,48,49,69,34,38,53,52,54,55,23,6,6,21,20,22,51,50,54,53,17,35,53,55,53,52,54,54,51,50,22,23,7,38,38,35,34,6,21,21,33,21,33,17,20,6,6,1,7,131,157,5,7,142,2,3,70,51,61,69,195,195,81,156,112,63,105,40,43,34,85,44,95,90,1,16,254,240,61,123,31,143,120,22,47,23,32,10,24,14,68,68,83,103,2,160,80,55,73,138,173,82,22,14,131,11,19,123,131,80,130,253,101,103,148,79,0,2,0,112,255,236,4,93,6,30,0,33,0,47,0,25,64,13,34,25,9,3,0,41,17,11,114,1,0,1,114,0,43,50,43,50,17,23,57,48,49,65,23,6,4,6,21,20,22,22,23,30,2,21,20,6,6,35,34,38,38,53,52,54,54,55,46,2,53,52,54,54,36,3,14,2,21,20,22,51,50,54,53,52,38,38,4,39,20,210,254,208,163,60,128,103,133,188,99,125,227,154,145,226,128,91,175,126,71,115,68,93,196,1,53,211,90,161,101,174,152,161,173,76,138,6,30,146,25,43,68,64,44,61,66,50,65,149,191,129,153,217,115,109,210,153,123,190,134,37,37,76,99,71,81,113,79,53,253,86,22,94,165,131,153,180,183,163,103,146,107,0,255,255,0,87,0,0,2,81,5,182,6,6,3,152,0,0,0,1,0,114,255,59,2,196,2,225,0,23,0,24,64,11,5,4,17,17,8,124,23,125,13,22,123,0,63,51,237,228,50,17,51,51,48,49,83,17,20,6,7,51,54,54,51,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,222,3,3,7,33,120,73,128,131,107,81,84,119,95,108,2,225,254,233,25,48,20,51,55,114,126,254,84,1,166,82,82,125,117,254,168,3,166,0,1,0,114,255,59,2,177,2,225,0,18,0,25,64,14,15,14,4,5,11,8,6,9,124,18,125,13,17,123,0,63,51,237,228,23,57,48,49,83,17,20,6,7,51,54,54,55,55,51,1,1,35,3,7,21,35,17,221,4,1,4,14,52,19,236,127,254,226,1,51,130,252,86,107,2,225,254,27,24,69,27,16,61,19,233,254,231,254,135,1,55,73,238,3,166,0,1,0,114,255,59,0,222,2,225,0,3,0,10,179,2,125,1,123,0,63,237,48,49,87,35,17,51,222,108,108,197,3,166,0,1,0,114,255,59,4,101,1,217,0,38,0,37,64,17,28,27,18,18,32,9,0,0,32,32,25,124,5,14,14,24,123,0,63,51,17,51,237,50,47,51,17,51,17,51,17,51,51,48,49,65,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,52,38,35,34,6,6,21,17,35,17,51,23,51,62,2,51,50,22,23,51,54,54,3,119,118,120,107,75,73,104,93,107,75,74,71,86,38,108,87,16,6,21,65,81,46,80,110,25,6,35,123,1,217,114,125,254,81,1,170,80,80,111,107,254,144,1,170,80,80,55,106,77,254,164,2,146,93,34,46,25,56,57,57,56,0,0,1,0,114,255,59,2,196,1,217,0,20,0,25,64,11,18,17,9,9,0,0,15,124,5,14,123,0,63,51,237,50,47,51,17,51,51,48,49,65,50,22,21,17,35,17,52,38,35,34,6,21,17,35,17,51,23,51,54,54,1,195,127,130,107,81,84,118,96,108,87,16,6,34,122,1,217,115,127,254,84,1,166,82,82,124,118,254,168,2,146,95,52,55,0,2,0,114,254,21,2,228,1,217,0,21,0,34,0,35,64,16,10,9,29,29,6,19,18,22,22,0,0,16,124,14,6,123,0,63,206,228,50,47,51,17,51,51,17,51,17,51,51,48,49,65,50,22,21,20,6,35,34,38,39,35,22,22,21,17,35,17,51,23,51,54,54,23,34,6,7,21,20,22,51,50,54,53,52,38,1,193,133,158,160,134,85,109,30,7,1,6,108,89,14,5,31,106,71,111,95,2,92,117,99,99,98,1,217,170,169,169,174,60,42,23,66,25,254,242,3,184,98,45,65,84,119,118,20,125,133,145,116,116,138,0,0,1,0,67,255,47,2,63,1,217,0,41,0,24,64,13,13,0,17,38,21,34,6,31,24,124,10,3,123,0,63,51,228,50,23,57,48,49,69,20,6,35,34,38,39,53,22,22,51,50,54,53,52,38,38,39,46,2,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,22,23,30,2,2,63,152,131,75,109,41,43,122,62,93,83,33,79,68,69,99,54,146,119,65,112,49,36,45,100,52,74,80,37,82,67,66,98,53,17,94,98,22,19,92,20,32,55,48,27,41,39,23,24,48,68,55,83,90,24,20,79,17,24,46,39,31,40,35,23,22,49,69,0,0,1,0,21,255,47,1,188,2,101,0,23,0,29,64,13,11,20,20,17,13,14,14,16,17,124,0,7,123,0,63,51,244,205,51,17,51,17,51,17,51,48,49,69,50,54,55,21,6,6,35,34,38,53,17,35,53,55,55,51,21,51,21,35,17,20,22,1,88,27,55,18,19,67,32,85,119,101,102,43,65,208,208,61,127,8,6,77,8,11,86,116,1,134,48,39,143,152,78,254,125,62,61,0,0,1,0,113,0,0,4,66,5,11,0,35,0,24,64,12,26,11,29,8,4,0,18,9,121,114,28,0,0,47,50,43,50,18,23,57,48,49,115,17,52,54,54,55,54,54,55,3,51,1,54,54,55,54,54,53,17,51,17,20,6,7,6,6,7,1,35,1,6,6,7,6,21,17,113,13,33,33,28,91,64,255,184,1,194,14,24,10,56,47,165,26,29,24,94,65,1,2,185,254,60,36,89,24,25,1,198,62,105,94,45,42,58,15,1,160,253,24,5,12,8,34,112,101,1,216,254,40,85,129,50,42,73,18,254,90,2,237,2,54,62,66,111,254,58,0,0,1,0,82,0,0,4,4,5,31,0,29,0,20,64,9,9,16,122,114,27,1,1,0,10,0,63,50,17,51,43,50,48,49,115,53,33,17,52,38,39,38,38,35,34,6,7,53,54,54,51,50,22,23,22,22,23,30,2,21,17,51,21,83,2,116,108,105,25,64,41,47,140,99,74,145,72,100,135,61,62,82,25,16,18,8,148,137,3,12,118,112,15,5,5,7,7,139,7,7,17,22,23,72,56,27,62,70,41,252,240,137,0,1,0,49,255,248,2,154,5,31,0,38,0,23,64,11,31,10,33,32,17,23,122,7,0,10,114,0,43,50,63,51,57,57,63,48,49,87,34,38,39,55,22,22,51,50,54,55,54,54,53,17,52,38,35,34,6,7,53,54,51,50,22,23,22,22,21,17,35,39,35,6,6,7,6,6,179,27,65,38,22,29,61,33,78,128,40,27,30,52,82,35,78,47,88,88,68,99,33,47,40,135,21,10,22,48,21,43,117,8,7,6,152,6,7,75,69,46,116,70,1,208,85,102,10,10,141,19,32,30,41,134,85,252,35,206,38,64,20,44,48,0,0,1,0,44,0,0,3,222,5,11,0,17,0,16,182,11,8,8,9,121,114,0,0,47,43,50,17,51,48,49,97,17,52,54,55,54,54,55,33,53,33,21,6,6,7,6,21,17,2,106,26,19,21,38,26,253,64,3,178,50,84,25,44,3,127,54,91,28,32,39,15,137,123,18,50,38,62,107,252,131,0,2,0,175,0,0,4,97,5,31,0,27,0,31,0,23,64,11,28,10,30,30,7,7,17,122,114,0,10,0,63,43,50,17,51,47,63,48,49,97,17,52,38,39,38,38,35,34,6,7,53,54,54,55,54,54,51,50,22,23,22,22,23,22,22,21,17,33,17,51,17,3,183,105,105,24,75,48,63,205,151,47,90,42,80,127,48,113,141,62,62,82,24,15,13,252,78,168,3,149,117,112,15,5,6,12,13,140,5,6,3,5,5,20,26,26,80,63,40,86,53,252,107,3,31,252,225,0,0,1,0,175,0,0,1,87,5,11,0,3,0,11,180,1,121,114,0,10,0,63,43,48,49,115,17,51,17,175,168,5,11,250,245,0,0,1,0,62,0,0,1,255,5,11,0,22,0,17,183,11,8,8,9,121,114,0,10,0,63,43,50,17,51,48,49,115,17,52,54,55,54,54,55,33,53,33,21,14,2,7,6,6,7,6,6,21,17,183,34,29,24,48,25,254,231,1,193,21,37,33,13,16,23,7,5,5,2,217,86,153,54,44,66,22,137,124,16,46,54,29,37,89,42,28,63,34,253,39,0,1,0,175,0,0,4,97,5,31,0,29,0,23,64,11,18,10,28,25,25,1,7,122,114,0,10,0,63,43,50,50,17,51,63,48,49,115,17,54,54,55,54,54,51,50,22,23,22,22,23,22,22,21,17,35,17,52,38,39,38,38,35,34,6,7,17,175,13,56,43,93,160,66,115,142,62,62,82,24,15,13,170,110,109,23,69,45,46,126,80,5,7,2,4,4,7,7,20,25,26,79,64,39,87,54,252,107,3,149,120,114,14,3,4,6,6,251,120,0,0,1,0,165,255,236,4,148,5,31,0,54,0,21,64,11,30,37,122,114,10,121,114,18,0,11,114,0,43,50,43,43,50,48,49,69,34,38,39,38,38,39,38,38,53,17,51,17,20,22,23,22,22,51,50,54,55,54,54,53,52,38,39,38,38,35,34,6,7,53,54,54,51,50,22,23,22,22,23,22,22,21,20,6,7,6,6,7,6,6,2,154,70,128,52,54,89,32,39,37,169,53,52,37,116,75,78,118,37,59,40,38,53,42,125,72,20,41,21,28,55,26,70,124,52,54,83,28,32,33,24,24,31,99,68,54,131,20,28,31,31,96,69,80,205,130,2,129,253,127,151,215,64,46,52,55,48,74,227,123,121,218,74,57,52,5,4,140,5,4,29,32,31,99,69,76,200,125,102,171,71,90,130,41,32,33,0,1,0,162,1,211,1,75,5,11,0,4,0,14,181,3,0,0,1,121,114,0,43,50,47,51,48,49,83,17,51,17,7,162,169,121,1,211,3,56,253,95,151,0,0,1,0,34,254,20,3,79,5,30,0,32,0,12,180,9,22,122,114,0,0,47,43,50,48,49,65,17,52,38,39,38,38,39,38,35,34,6,7,6,6,7,53,54,54,55,54,54,51,50,22,23,22,22,23,22,22,21,17,2,164,31,34,17,46,27,79,126,46,82,38,23,72,21,25,66,41,42,92,50,102,180,56,29,46,18,33,33,254,20,4,188,93,149,58,31,49,18,54,9,8,4,20,5,144,8,14,6,6,6,69,55,29,67,39,70,166,95,251,68,0,1,0,70,255,236,3,115,5,30,0,56,0,16,183,24,37,122,114,8,0,11,114,0,43,50,43,50,48,49,69,34,38,39,53,30,2,51,50,54,55,54,54,55,54,54,53,53,52,38,39,38,38,35,34,6,7,6,6,7,53,54,54,55,54,54,51,50,22,23,22,22,23,30,2,21,21,20,6,7,6,6,7,6,6,1,131,92,154,71,33,101,115,54,65,103,35,34,51,14,15,23,46,49,45,135,85,59,119,62,16,22,5,32,56,39,41,95,53,102,181,56,28,46,19,22,29,14,27,27,23,66,46,69,166,20,17,17,153,11,21,13,36,29,28,76,39,40,111,62,177,110,176,59,53,54,17,17,5,6,1,144,11,12,6,6,5,69,55,29,67,39,47,105,115,64,177,86,146,63,53,83,31,62,39,0,0,1,0,54,0,0,3,144,6,29,0,10,0,20,64,9,8,3,3,5,6,121,114,0,10,0,63,43,205,51,17,51,48,49,97,19,19,33,17,51,17,33,21,3,3,1,205,95,190,253,76,168,2,178,187,95,1,238,2,146,1,157,254,243,143,253,116,254,11,0,0,2,0,168,0,0,4,90,5,31,0,17,0,32,0,15,182,29,7,122,114,18,0,10,0,63,50,43,50,48,49,115,17,54,54,55,54,54,51,50,22,23,22,22,23,22,22,21,17,37,33,17,52,38,39,38,38,39,38,38,35,34,6,7,168,12,56,42,94,160,67,117,144,64,58,78,25,15,14,252,247,2,95,34,35,26,73,46,24,71,47,46,126,79,5,7,2,4,3,8,7,21,27,25,75,60,36,85,51,252,93,137,3,29,65,87,27,22,25,5,4,3,6,6,0,1,0,99,0,0,4,72,5,31,0,53,0,31,64,16,37,36,10,52,19,18,46,46,25,122,114,15,121,114,0,10,0,63,43,43,50,17,51,51,51,63,51,48,49,115,19,54,54,53,52,38,39,46,2,39,38,38,39,51,22,22,23,51,54,54,55,54,54,51,50,22,23,22,22,23,22,22,21,17,33,53,33,17,52,38,39,46,2,35,34,6,7,6,6,7,3,99,90,2,1,7,8,2,16,15,2,4,9,4,163,18,24,6,13,13,77,39,39,128,73,67,110,43,30,49,18,30,31,254,71,1,16,34,34,20,53,69,44,64,114,35,33,53,16,92,3,193,19,29,14,30,53,34,10,47,45,7,12,23,12,40,69,30,20,60,20,21,33,34,30,22,55,32,56,145,88,252,175,137,2,200,77,119,39,26,39,21,38,25,24,59,33,252,33,0,0,1,0,100,254,24,1,79,5,11,0,17,0,10,179,8,121,114,0,0,47,43,48,49,83,17,52,38,38,39,38,38,39,51,22,22,23,30,2,21,17,167,13,24,17,3,6,4,170,4,9,5,8,22,17,254,24,5,93,64,127,121,54,10,20,10,11,30,19,25,117,142,62,250,163,0,0,1,0,117,0,0,2,217,5,31,0,34,0,15,182,12,19,122,114,1,0,10,0,63,50,43,50,48,49,115,53,33,54,54,53,17,52,38,39,38,38,35,34,6,7,53,54,54,51,50,22,23,22,22,23,22,22,21,17,20,6,6,7,7,117,1,164,12,11,24,24,19,49,32,40,84,45,38,89,52,58,86,32,30,45,15,20,21,10,14,7,9,137,55,106,52,2,122,48,77,25,17,20,9,8,142,8,7,22,20,19,56,32,35,90,53,253,134,50,113,103,33,51,0,0,2,0,110,255,236,4,94,5,31,0,35,0,60,0,23,64,11,13,12,49,49,19,122,114,36,0,11,114,0,43,50,43,50,17,51,51,48,49,69,34,39,38,38,39,38,38,53,52,54,54,55,55,7,53,62,2,51,50,22,23,22,22,23,22,22,21,20,6,7,6,6,7,6,39,50,54,55,62,2,53,52,38,39,38,38,35,34,6,7,6,6,21,20,22,23,22,22,2,101,140,101,73,107,33,24,25,37,75,56,3,153,92,168,155,70,82,141,57,53,82,28,31,31,19,19,31,109,76,106,145,78,118,37,37,43,17,74,62,35,98,54,52,77,40,86,81,48,49,37,117,20,56,39,134,96,70,172,101,118,191,148,52,3,7,142,5,7,4,40,41,35,105,69,74,186,113,88,153,65,106,151,44,61,141,56,50,48,137,158,78,189,217,53,31,34,2,4,88,251,179,148,211,62,50,56,0,1,0,60,255,202,4,116,5,11,0,25,0,24,64,13,23,1,2,5,9,20,6,0,14,6,121,114,0,0,47,43,50,18,23,57,48,49,87,53,37,54,54,55,1,51,19,19,62,2,55,19,51,3,14,2,7,6,4,7,6,6,60,1,12,28,59,29,254,210,166,153,120,94,146,92,13,54,160,54,8,43,71,48,83,254,242,183,90,160,54,139,40,5,12,9,4,116,253,189,254,3,46,153,204,122,2,51,253,210,84,152,137,61,120,158,27,14,23,0,0,1,0,89,254,20,4,61,5,31,0,47,0,23,64,10,21,20,22,22,0,7,37,122,114,0,0,47,43,50,18,57,47,51,51,48,49,65,17,52,38,39,38,38,35,34,6,7,6,6,21,20,22,23,22,22,23,23,7,39,34,38,39,38,38,53,52,54,55,54,54,55,54,54,51,50,22,23,22,22,23,22,22,21,17,3,147,49,48,40,121,75,75,137,41,38,42,47,47,30,76,47,30,27,26,91,151,51,43,48,64,53,26,77,33,55,119,65,78,134,54,50,81,30,38,39,254,20,4,114,149,210,61,53,51,49,50,43,110,60,80,118,36,22,30,8,5,125,1,71,64,54,146,90,93,159,54,27,52,16,25,25,33,35,30,92,62,78,207,128,251,142,0,1,0,110,255,236,4,81,5,31,0,74,0,25,64,12,40,41,41,0,27,57,122,114,9,0,11,114,0,43,50,43,50,18,57,47,51,48,49,69,34,38,38,39,39,53,22,22,51,50,54,55,54,54,55,54,54,53,52,38,39,38,38,39,38,38,35,34,6,7,6,6,21,20,22,23,22,22,23,23,7,39,38,38,39,38,38,39,38,38,53,52,54,55,54,54,51,50,22,23,22,22,23,22,22,21,20,6,7,6,6,7,6,6,2,86,61,115,98,37,41,90,177,88,74,114,37,39,47,9,5,4,16,21,21,71,57,31,69,39,77,119,36,48,56,47,40,33,80,47,30,27,26,55,97,41,38,64,23,32,33,79,65,72,178,97,83,140,56,45,75,27,38,40,45,41,33,90,52,51,123,20,4,8,5,5,137,10,10,50,42,44,136,74,45,85,51,89,141,67,68,99,29,15,16,42,33,43,127,67,73,120,38,30,33,1,4,126,2,1,25,24,22,61,38,50,127,73,108,174,53,61,59,38,37,30,88,56,79,207,130,140,217,78,59,86,26,30,30,0,0,1,0,3,254,20,3,111,5,11,0,21,0,23,64,12,20,19,1,4,7,5,0,11,2,121,114,0,0,47,43,50,18,23,57,48,49,65,17,1,51,1,54,54,55,54,54,53,17,51,17,20,6,7,6,6,7,7,17,1,19,254,240,175,1,1,30,58,29,74,85,168,44,43,34,115,76,123,254,20,4,25,2,222,253,56,8,16,8,18,143,115,1,148,254,104,94,147,52,39,65,14,31,252,91,0,0,1,0,79,0,0,4,16,5,11,0,26,0,29,64,13,8,24,0,12,5,121,114,25,3,3,1,1,0,0,47,50,17,51,17,51,43,50,18,57,57,48,49,115,53,33,23,1,1,51,1,23,54,54,55,19,51,7,14,2,7,6,6,7,6,6,7,1,21,83,2,105,127,254,205,254,71,183,1,98,55,80,93,12,25,159,24,4,12,18,12,13,37,22,29,70,41,1,19,137,2,1,190,2,198,253,183,85,80,203,123,1,8,255,40,74,69,33,40,74,37,48,87,37,254,115,100,0,0,2,0,175,254,20,4,131,5,11,0,26,0,30,0,23,64,10,27,26,28,28,15,12,12,13,121,114,0,43,50,17,51,51,47,47,47,48,49,97,52,52,53,52,54,55,62,2,55,19,33,53,33,21,3,14,2,7,14,3,21,21,1,17,51,17,2,168,35,21,5,22,28,13,174,252,221,3,212,180,6,24,25,7,8,22,22,14,253,96,169,7,13,7,51,165,86,22,83,98,45,2,65,137,120,253,172,16,84,89,26,26,91,102,90,24,27,254,20,4,232,251,24,0,0,1,0,44,0,0,3,94,5,31,0,25,0,12,180,7,15,122,114,0,0,47,43,50,48,49,97,17,52,38,39,38,38,35,34,6,6,7,53,54,54,51,50,22,23,22,22,23,22,22,21,17,2,181,108,107,24,57,32,39,116,120,46,89,148,61,120,142,62,62,82,25,14,13,3,149,118,113,15,5,4,3,7,3,140,6,6,20,26,26,79,64,40,86,53,252,107,0,0,1,0,82,0,0,5,94,5,11,0,40,0,29,64,15,29,10,10,21,19,20,18,3,5,0,1,121,114,22,0,0,47,50,43,18,23,57,51,17,51,48,49,115,3,51,19,54,54,55,54,54,55,19,51,3,6,6,7,6,6,7,34,6,35,19,33,50,54,55,54,55,19,51,3,6,6,7,6,6,7,6,6,35,191,109,161,61,67,122,40,47,47,9,28,157,28,13,60,61,56,163,117,2,4,1,24,1,23,138,236,77,76,17,53,158,54,11,66,53,54,142,98,64,145,78,5,11,253,31,16,57,47,57,164,93,1,47,254,210,134,191,71,68,80,20,1,254,224,149,135,137,173,2,49,253,205,115,201,87,88,134,42,33,28,0,0,1,0,40,255,252,4,104,5,31,0,47,0,21,64,9,30,10,36,36,18,122,114,6,0,0,47,50,43,50,17,51,47,48,49,87,34,38,39,53,22,51,50,54,53,17,6,6,7,53,62,2,51,50,22,22,23,22,22,23,22,22,21,17,35,17,52,38,39,38,35,34,6,7,17,20,6,7,6,7,6,6,134,20,46,28,38,43,72,74,36,72,36,101,172,144,58,92,124,91,42,58,75,23,13,12,168,110,108,46,78,37,91,54,15,18,26,44,36,99,4,8,8,130,6,94,98,3,61,2,6,2,140,8,11,5,10,24,19,27,78,62,35,85,50,252,103,3,149,119,113,15,8,3,3,252,186,55,92,38,58,34,28,27,255,255,0,82,0,0,5,94,6,14,6,38,3,226,0,0,1,7,4,35,5,17,0,138,0,10,179,41,1,121,114,0,43,206,48,49,255,255,0,76,0,0,5,94,6,12,6,38,3,226,0,0,1,7,4,36,0,146,0,136,0,10,179,41,1,121,114,0,43,206,48,49,255,255,0,82,0,0,5,97,6,14,6,38,3,226,0,0,0,39,4,33,3,30,255,119,1,7,4,35,5,21,0,138,0,10,179,52,1,121,114,0,43,206,48,49,255,255,0,80,0,0,5,94,6,12,6,38,3,226,0,0,0,39,4,33,3,30,255,119,1,7,4,36,0,150,0,136,0,10,179,52,1,121,114,0,43,206,48,49,255,255,0,113,255,34,4,66,5,11,6,38,3,201,0,0,0,7,4,28,2,90,255,229,255,255,0,113,254,88,4,66,5,11,6,38,3,201,0,0,0,7,4,29,2,88,255,233,255,255,0,113,0,0,4,66,5,11,6,38,3,201,0,0,0,7,4,33,1,220,254,250,255,255,0,82,0,0,4,4,5,31,6,38,3,202,0,0,0,7,4,33,1,121,0,81,255,255,0,49,255,248,2,154,5,31,6,38,3,203,0,0,0,7,4,33,0,250,0,81,255,255,0,44,0,0,3,222,5,11,6,38,3,204,0,0,0,7,4,33,1,89,0,81,255,255,0,175,0,0,4,97,5,31,6,38,3,205,0,0,0,7,4,33,2,124,0,81,255,255,255,190,0,0,1,87,5,11,6,38,3,206,0,0,0,6,4,33,254,81,255,255,255,199,0,0,1,255,5,11,6,38,3,207,0,0,0,6,4,33,7,82,255,255,0,165,255,236,4,148,5,31,6,38,3,209,0,0,0,7,4,33,2,141,0,81,255,255,255,195,1,211,1,75,5,11,6,38,3,210,0,0,0,7,4,33,0,3,1,64,255,255,0,34,254,20,3,79,5,30,6,38,3,211,0,0,0,7,4,33,1,87,0,82,255,255,0,70,255,236,3,115,5,30,6,38,3,212,0,0,0,7,4,33,1,94,0,82,255,255,0,54,0,0,3,144,6,29,6,38,3,213,0,0,0,7,4,33,1,60,0,81,255,255,0,99,0,0,4,72,5,31,6,38,3,215,0,0,0,7,4,33,2,113,0,81,255,255,0,117,0,0,2,217,5,31,6,38,3,217,0,0,0,7,4,33,1,86,0,82,255,255,0,110,255,236,4,94,5,31,6,38,3,218,0,0,0,7,4,33,2,96,0,81,255,255,0,89,254,20,4,61,5,31,6,38,3,220,0,0,0,7,4,33,2,61,1,16,255,255,0,110,255,236,4,81,5,31,6,38,3,221,0,0,0,7,4,33,2,89,1,3,255,255,0,79,0,0,4,16,5,11,6,38,3,223,0,0,0,7,4,33,1,2,255,173,255,255,0,175,254,20,4,131,5,11,6,38,3,224,0,0,0,7,4,33,2,71,0,80,255,255,0,44,0,0,3,94,5,31,6,38,3,225,0,0,0,7,4,33,1,79,0,81,255,255,0,82,0,0,5,94,5,11,6,38,3,226,0,0,0,7,4,33,3,30,255,119,255,255,0,40,255,252,4,104,5,31,6,38,3,227,0,0,0,7,4,33,2,163,0,79,255,255,0,175,0,0,1,87,5,206,6,38,3,206,0,0,1,7,4,30,1,4,255,182,0,10,179,4,1,121,114,0,43,206,48,49,255,255,252,25,4,217,253,174,6,33,4,7,0,67,251,199,0,0,255,255,253,128,4,217,255,21,6,33,4,7,0,118,253,46,0,0,255,255,254,176,4,217,1,81,6,32,4,7,1,74,254,94,0,0,255,255,252,24,4,220,254,255,5,221,4,7,1,81,251,198,0,0,255,255,254,213,4,219,1,44,5,97,4,7,1,76,254,131,0,0,255,255,254,202,4,217,1,56,5,231,4,7,1,77,254,120,0,0,255,255,255,158,5,8,0,102,5,226,4,7,1,78,255,76,0,0,255,255,254,229,5,16,1,26,5,210,4,7,0,106,253,175,0,0,255,255,255,37,4,218,0,227,6,136,4,7,1,79,254,211,0,0,255,255,255,6,4,217,1,216,6,33,4,7,1,82,254,180,0,0,255,255,254,175,4,217,1,80,6,32,4,7,1,75,254,93,0,0,0,2,251,229,4,217,254,183,6,33,0,12,0,25,0,37,64,17,4,17,17,19,11,24,24,0,13,19,128,6,6,15,19,1,19,0,47,93,51,47,26,16,205,50,50,17,51,17,51,17,51,48,49,65,30,2,23,21,35,46,3,39,53,35,30,2,23,21,35,46,3,39,53,254,1,22,63,68,29,96,34,79,77,62,17,173,22,62,68,29,95,35,80,76,62,17,6,33,46,112,107,39,24,29,81,89,81,28,20,46,112,107,39,24,29,81,89,81,28,20,255,255,255,97,3,193,0,136,5,182,4,7,2,5,255,70,0,0,0,1,253,58,254,161,254,3,255,123,0,11,0,8,177,0,6,0,47,51,48,49,65,34,38,53,52,54,51,50,22,21,20,6,253,158,42,58,58,42,43,58,58,254,161,54,55,56,53,53,56,55,54,0,255,255,255,55,254,20,0,198,0,0,4,7,0,122,255,27,0,0,255,255,255,91,254,62,0,166,0,30,4,7,1,80,255,9,0,0,0,1,253,64,4,215,254,47,6,56,0,18,0,12,179,14,3,128,15,0,47,26,204,51,48,49,65,52,54,51,50,22,21,20,14,2,21,20,22,23,21,46,2,253,64,68,55,44,50,30,38,30,59,61,78,107,54,5,184,57,71,40,38,26,26,15,19,21,28,50,18,72,20,63,87,0,0,1,253,68,4,215,254,49,6,56,0,18,0,12,179,16,128,5,4,0,47,51,26,204,48,49,65,20,6,6,7,53,54,54,53,52,46,2,53,52,54,51,50,22,254,49,54,105,78,59,61,30,38,30,51,43,55,66,5,184,55,87,63,20,72,18,50,28,21,19,15,26,26,38,40,71,0,1,252,87,4,146,255,52,5,178,0,20,0,15,180,13,9,9,3,0,0,47,205,51,124,16,204,48,49,65,6,6,35,34,38,53,52,54,51,33,54,54,51,50,22,21,20,6,6,35,253,12,5,40,47,49,40,41,50,1,202,5,43,45,49,42,18,41,34,4,240,44,50,52,49,52,41,47,47,49,50,35,42,18,0,1,252,90,4,227,255,63,5,217,0,22,0,18,182,17,16,16,10,0,128,7,0,47,26,204,50,51,47,51,48,49,65,50,30,2,21,21,35,52,38,35,34,14,2,35,35,53,51,50,62,2,254,88,55,86,59,31,120,67,47,46,101,117,140,85,18,15,78,129,115,113,5,217,27,54,80,54,31,75,49,35,47,35,121,36,46,36,0,2,255,193,254,13,0,76,255,171,0,11,0,23,0,15,180,12,18,18,0,6,0,124,47,51,50,47,51,48,49,87,34,38,53,52,54,51,50,22,21,20,6,3,34,38,53,52,54,51,50,22,21,20,6,5,33,35,35,33,35,36,36,35,33,35,35,33,35,36,36,240,39,38,38,40,40,38,38,39,254,253,40,38,38,40,40,37,39,40,0,5,254,160,254,10,1,77,255,168,0,11,0,22,0,34,0,46,0,58,0,32,64,13,47,53,53,6,35,41,41,23,29,29,0,17,6,0,124,47,51,51,50,17,51,51,17,51,17,51,17,51,48,49,69,34,38,53,52,54,51,50,22,21,20,6,51,34,53,52,54,51,50,22,21,20,6,3,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,3,34,38,53,52,54,51,50,22,21,20,6,254,229,34,35,35,34,34,36,36,255,69,35,34,34,36,36,179,34,35,36,33,35,36,36,1,111,33,35,35,33,35,35,35,35,33,35,35,33,35,35,35,244,40,38,38,40,40,38,38,40,78,38,40,40,38,38,40,254,254,39,39,39,39,40,38,38,40,39,39,38,40,40,38,38,40,1,2,40,38,38,40,40,38,38,40,0,3,254,210,254,10,1,31,255,168,0,3,0,15,0,27,0,24,64,9,4,10,10,16,16,22,22,0,1,0,124,47,51,51,17,51,17,51,17,51,48,49,69,53,33,21,19,34,38,53,52,54,51,50,22,21,20,6,3,34,38,53,52,54,51,50,22,21,20,6,254,210,1,103,159,34,35,36,33,34,37,36,35,34,35,36,33,34,37,36,206,82,82,254,216,39,39,39,39,40,38,38,40,1,2,40,38,39,39,40,38,38,40,0,0,3,254,210,254,10,1,31,255,168,0,7,0,19,0,31,0,27,64,10,8,14,14,20,20,26,26,0,128,3,0,124,47,26,24,204,51,17,51,17,51,17,51,48,49,67,53,35,53,33,21,35,21,5,34,38,53,52,54,51,50,22,21,20,6,3,34,38,53,52,54,51,50,22,21,20,6,164,138,1,102,138,1,42,34,35,35,34,35,36,36,35,34,35,35,34,35,36,36,254,104,202,82,82,202,94,39,39,38,40,40,38,38,40,1,2,40,38,38,40,40,38,38,40,0,1,255,186,255,13,0,70,255,169,0,10,0,9,177,0,5,0,124,47,51,48,49,71,34,53,52,54,51,50,22,21,20,6,2,68,35,33,36,36,36,243,78,38,40,40,38,38,40,0,0,2,255,34,255,18,0,207,255,173,0,11,0,23,0,15,180,0,6,6,12,18,0,124,47,51,51,17,51,48,49,87,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,136,34,35,35,34,34,37,37,254,188,33,35,36,32,35,35,35,238,39,38,39,39,40,38,37,40,39,39,39,38,40,37,38,40,0,0,3,255,34,254,10,0,207,255,168,0,11,0,23,0,35,0,25,64,9,0,6,24,24,30,12,18,18,30,0,124,47,51,17,51,17,51,24,16,206,50,48,49,67,34,38,53,52,54,51,50,22,21,20,6,19,34,38,53,52,54,51,50,22,21,20,6,33,34,38,53,52,54,51,50,22,21,20,6,9,34,35,35,34,35,36,36,110,34,35,35,34,34,37,37,254,188,33,35,36,32,35,35,35,254,10,39,39,38,40,40,38,38,40,1,2,39,39,38,40,40,38,38,40,40,38,39,39,40,38,38,40,0,1,255,70,255,61,0,179,255,143,0,3,0,9,177,0,1,0,124,47,51,48,49,71,53,33,21,186,1,109,195,82,82,0,0,1,255,72,254,111,0,179,255,139,0,7,0,10,178,0,128,3,0,47,26,204,48,49,67,53,35,53,33,21,35,21,43,141,1,107,141,254,111,201,83,83,201,0,0,1,255,187,5,125,0,71,6,24,0,10,0,8,177,5,0,0,47,50,48,49,67,34,53,52,54,51,50,22,21,20,6,1,68,35,34,35,36,36,5,125,77,39,39,40,38,38,39,0,0,1,255,192,4,233,0,76,5,132,0,11,0,8,177,6,0,0,47,50,48,49,83,34,38,53,52,54,51,50,22,21,20,6,4,33,35,35,33,35,37,37,4,233,39,38,39,39,40,38,38,39,0,3,255,40,253,237,0,229,255,165,0,11,0,23,0,35,0,22,183,24,30,30,12,18,18,0,6,0,124,47,24,205,50,47,205,50,47,205,48,49,71,34,38,53,52,54,51,50,22,21,20,6,23,34,38,53,52,54,51,50,22,21,20,6,23,34,38,53,52,54,51,50,22,21,20,6,148,33,35,36,32,35,35,35,117,34,35,35,34,35,36,36,119,34,35,35,34,35,36,36,246,39,38,39,39,40,38,38,39,143,40,39,38,40,40,38,38,41,142,40,39,38,40,40,38,39,40,0,0,1,255,192,1,252,0,76,2,151,0,10,0,8,177,5,0,0,47,50,48,49,83,34,53,52,54,51,50,22,21,20,6,4,68,35,33,35,37,37,1,252,77,39,39,40,38,37,40,0,0,1,255,208,254,54,0,45,255,114,0,3,0,10,178,0,128,1,0,47,26,205,48,49,67,17,51,17,48,93,254,54,1,60,254,196,0,1,255,192,4,233,0,76,5,132,0,10,0,8,177,5,0,0,47,50,48,49,83,34,53,52,54,51,50,22,21,20,6,4,68,35,33,35,37,37,4,233,77,39,39,40,38,38,39,0,0,1,255,186,4,233,0,70,5,132,0,11,0,8,177,6,0,0,47,50,48,49,67,34,38,53,52,54,51,50,22,21,20,6,2,34,34,35,33,36,36,36,4,233,39,38,39,39,40,38,38,39,0,1,255,83,254,220,0,143,255,187,0,7,0,18,181,6,2,2,0,128,3,0,124,47,26,24,204,51,17,51,48,49,67,53,35,53,33,21,35,21,54,119,1,60,120,254,220,144,79,79,144,0,255,255,0,41,255,240,2,158,3,126,6,7,3,119,0,0,252,172,255,255,0,76,0,0,1,225,3,109,6,7,0,123,0,0,252,172,255,255,0,50,0,0,2,115,3,127,6,7,0,116,0,0,252,172,255,255,0,37,255,241,2,141,3,127,6,7,0,117,0,0,252,172,255,255,0,21,0,0,2,181,3,115,6,7,2,55,0,0,252,172,255,255,0,62,255,238,2,139,3,109,6,7,2,56,0,0,252,172,255,255,0,41,255,240,2,161,3,125,6,7,3,120,0,0,252,172,255,255,0,58,0,0,2,146,3,109,6,7,2,57,0,0,252,172,255,255,0,52,255,241,2,148,3,124,6,7,2,58,0,0,252,172,255,255,0,35,255,240,2,156,3,129,6,7,3,121,0,0,252,172,0,2,0,115,255,236,4,55,5,205,0,17,0,31,0,16,183,28,14,5,114,21,5,13,114,0,43,50,43,50,48,49,65,20,2,6,6,35,34,38,38,2,53,52,18,54,51,50,22,18,5,16,18,51,50,18,17,52,2,38,35,34,6,2,4,55,54,116,184,129,123,181,119,58,95,211,175,166,213,104,252,227,145,169,169,146,62,138,115,115,138,61,2,221,178,254,232,194,101,101,193,1,24,179,235,1,80,181,179,254,175,236,254,205,254,208,1,47,1,52,201,1,15,137,137,254,241,0,0,1,0,51,0,0,2,73,5,182,0,13,0,21,64,10,10,9,9,5,11,4,114,13,12,114,0,43,43,50,50,47,51,48,49,97,17,52,54,54,55,6,6,7,7,39,1,51,17,1,166,2,3,3,31,55,40,166,87,1,139,139,4,12,59,85,71,37,32,45,33,134,113,1,49,250,74,0,0,1,0,79,0,0,4,12,5,203,0,29,0,23,64,11,9,17,5,114,26,1,27,27,0,12,114,0,43,50,17,51,51,43,50,48,49,115,53,1,62,2,53,52,38,35,34,6,7,39,62,2,51,50,22,22,21,20,6,6,7,1,21,33,21,79,1,135,109,149,78,147,119,106,163,84,89,58,136,158,90,134,196,106,92,165,112,254,194,2,235,139,1,141,110,172,167,100,124,131,72,66,112,49,76,44,94,174,120,116,199,195,109,254,195,7,152,0,0,1,0,87,255,236,4,21,5,203,0,45,0,29,64,13,4,3,29,29,26,26,11,36,43,5,18,11,13,0,63,51,63,51,18,57,47,51,18,57,57,48,49,65,20,6,7,21,22,22,21,20,6,6,35,34,38,39,53,22,22,51,50,54,54,53,52,38,38,35,35,53,51,50,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,3,232,167,137,174,175,119,245,191,116,197,90,91,214,100,133,167,78,99,186,130,145,147,119,166,87,148,127,118,173,83,84,80,230,146,224,224,4,97,147,177,27,8,22,180,146,127,196,111,37,43,156,45,51,72,133,92,95,117,55,142,70,127,87,111,121,69,56,114,62,90,203,0,0,2,0,48,0,0,4,112,5,190,0,10,0,21,0,29,64,13,6,3,11,11,9,16,4,1,1,4,4,0,12,0,63,63,57,47,18,57,51,51,17,51,51,48,49,97,17,33,53,1,51,17,51,21,35,17,3,17,52,54,54,55,35,6,6,7,1,2,244,253,60,2,185,172,219,219,161,1,4,3,8,22,64,25,254,80,1,83,140,3,223,252,43,150,254,173,1,233,1,222,73,116,92,37,40,100,35,253,147,0,0,1,0,126,255,236,4,23,5,182,0,33,0,33,64,15,26,25,25,22,22,31,0,0,8,30,27,4,15,8,13,0,63,51,63,51,18,57,47,51,51,17,51,17,51,48,49,65,50,22,22,21,20,6,6,35,34,38,39,53,22,22,51,50,54,54,53,52,38,35,34,6,7,39,19,33,21,33,3,54,54,2,45,150,220,120,130,243,170,115,196,67,73,208,98,111,167,93,179,192,63,148,47,85,56,2,216,253,182,36,37,121,3,126,101,192,137,150,217,117,40,40,158,44,52,71,145,110,146,159,20,12,55,2,174,152,254,72,7,17,0,2,0,115,255,236,4,47,5,203,0,34,0,49,0,27,64,12,18,41,41,22,22,6,35,30,13,13,6,5,0,63,51,63,51,18,57,47,51,17,51,48,49,83,52,62,3,51,50,22,23,21,38,38,35,34,6,2,7,51,62,2,51,50,22,22,21,20,6,6,35,34,46,2,1,50,54,53,52,38,39,38,6,6,21,20,30,2,115,37,88,151,227,159,46,103,34,37,94,48,185,214,95,7,12,31,96,137,91,128,191,105,113,207,142,107,181,133,73,1,236,135,164,146,146,100,148,82,39,79,122,2,113,132,252,217,164,93,9,10,143,13,12,161,254,235,174,50,81,48,104,198,141,151,220,119,82,162,241,254,167,174,176,144,167,1,1,83,127,65,66,136,116,70,0,1,0,17,0,0,3,224,5,182,0,6,0,16,182,6,12,5,2,2,3,4,0,63,51,17,51,63,48,49,115,1,33,53,33,21,1,214,2,88,252,227,3,207,253,172,5,30,152,128,250,202,0,3,0,122,255,236,4,58,5,203,0,31,0,48,0,62,0,23,64,12,40,41,8,24,49,5,56,16,5,32,0,13,0,63,50,63,51,23,57,48,49,69,34,38,38,53,52,54,54,55,46,2,53,52,54,54,51,50,22,22,21,20,6,6,7,30,2,21,20,6,6,39,50,54,54,53,52,38,38,39,39,14,2,21,20,22,22,19,62,2,53,52,38,35,34,6,21,20,22,22,2,94,155,216,113,85,142,85,74,120,71,113,195,124,128,196,110,77,128,79,93,150,88,118,214,148,102,142,74,76,139,96,36,92,129,67,70,141,113,74,119,69,148,124,117,150,74,125,20,93,175,123,101,149,108,37,40,102,137,91,111,155,81,80,155,113,89,133,99,39,43,108,146,100,123,179,96,133,66,118,79,73,111,88,36,13,38,93,118,78,74,117,66,2,215,31,76,107,75,106,112,113,106,76,105,75,0,2,0,102,255,236,4,35,5,203,0,34,0,49,0,27,64,12,18,41,41,22,22,6,35,30,5,13,6,13,0,63,51,63,51,18,57,47,51,17,51,48,49,65,20,14,3,35,34,38,39,53,22,22,51,50,54,18,55,35,14,2,35,34,38,38,53,52,54,54,51,50,30,2,1,34,6,21,20,22,23,50,54,54,53,52,46,2,4,35,37,89,152,229,159,43,110,35,37,100,48,187,213,95,6,12,30,97,138,92,127,189,104,115,208,141,107,180,133,73,254,19,134,165,143,147,102,150,81,39,80,122,3,71,133,252,217,165,92,10,11,143,13,15,161,1,20,174,48,81,49,104,198,140,152,220,120,82,163,240,1,88,173,176,144,166,1,81,125,66,66,136,115,71,255,255,0,41,2,58,2,158,5,200,6,7,3,119,0,0,254,246,255,255,0,76,2,74,1,225,5,183,6,7,0,123,0,0,254,246,255,255,0,50,2,74,2,115,5,201,6,7,0,116,0,0,254,246,255,255,0,37,2,59,2,141,5,201,6,7,0,117,0,0,254,246,255,255,0,21,2,74,2,181,5,189,6,7,2,55,0,0,254,246,255,255,0,62,2,56,2,139,5,183,6,7,2,56,0,0,254,246,255,255,0,41,2,58,2,161,5,199,6,7,3,120,0,0,254,246,255,255,0,58,2,74,2,146,5,183,6,7,2,57,0,0,254,246,255,255,0,52,2,59,2,148,5,198,6,7,2,58,0,0,254,246,255,255,0,35,2,58,2,156,5,203,6,7,3,121,0,0,254,246,0,2,0,112,255,236,4,61,4,94,0,15,0,27,0,16,183,22,8,7,114,16,0,11,114,0,43,50,43,50,48,49,69,34,38,2,53,52,54,54,51,50,30,2,21,16,2,39,50,54,53,52,38,35,34,6,21,20,22,2,83,162,215,106,112,218,159,122,181,121,60,245,243,161,154,157,159,157,157,156,20,145,1,2,169,171,254,141,81,151,208,126,254,253,254,199,140,218,214,211,215,215,211,208,224,0,0,1,0,42,0,0,2,102,4,94,0,13,0,18,183,11,10,10,6,12,6,114,0,0,47,43,50,50,17,51,48,49,97,35,17,52,54,54,55,6,6,7,7,39,1,51,2,102,168,2,5,2,19,63,41,208,82,1,176,140,2,154,54,103,91,35,20,56,29,153,113,1,58,0,0,1,0,85,0,0,3,248,4,94,0,29,0,21,64,9,11,18,7,114,27,2,28,28,1,0,47,51,17,51,51,43,50,48,49,97,33,53,1,62,2,53,52,38,38,35,34,6,7,39,54,54,51,50,22,22,21,20,6,6,7,5,23,33,3,248,252,93,1,151,107,128,58,57,113,84,87,172,83,88,103,223,131,123,177,96,72,138,100,254,215,2,2,155,135,1,33,76,103,99,68,64,91,49,66,69,115,87,77,78,144,100,93,140,123,70,216,6,0,1,0,59,254,154,3,203,4,95,0,45,0,29,64,13,5,4,29,29,26,26,12,36,43,7,114,19,12,0,47,51,43,50,18,57,47,51,18,57,57,48,49,65,20,6,6,7,21,22,22,21,20,6,6,35,34,38,39,53,22,22,51,50,54,53,52,38,38,35,35,53,51,50,54,54,53,52,38,35,34,6,7,39,54,54,51,50,22,3,158,66,128,93,170,162,127,233,160,128,184,80,74,195,107,173,186,96,180,126,128,130,99,165,99,151,113,106,154,88,76,86,217,130,187,237,2,254,92,140,92,21,6,20,169,154,135,192,103,45,39,149,38,57,157,142,89,113,54,140,54,121,100,111,119,58,60,114,71,72,186,0,0,2,0,46,254,166,4,104,4,94,0,10,0,21,0,30,64,14,17,16,7,6,114,6,11,11,9,9,4,2,1,10,0,63,205,51,51,17,51,17,51,43,50,50,48,49,101,35,17,35,17,33,53,1,51,17,51,33,17,52,54,54,55,35,6,6,7,1,4,104,228,163,253,77,2,171,171,228,254,121,2,4,3,7,16,60,45,254,110,35,254,131,1,125,110,3,205,252,76,1,184,63,108,105,56,31,96,66,253,189,0,1,0,121,254,153,4,21,4,72,0,33,0,33,64,15,26,25,25,22,22,31,0,0,8,30,27,6,114,15,8,0,47,51,43,50,18,57,47,51,51,17,51,17,51,48,49,65,50,22,22,21,20,6,6,35,34,38,39,53,22,22,51,50,54,54,53,52,38,35,34,6,7,39,19,33,21,33,3,54,54,2,43,146,221,123,132,245,170,115,192,70,94,189,98,114,166,91,191,172,64,140,68,77,55,2,223,253,183,39,63,115,2,18,95,188,141,154,207,104,44,40,153,47,52,69,140,106,149,152,19,20,46,2,182,148,254,68,12,14,0,2,0,118,255,236,4,54,5,206,0,33,0,48,0,31,64,15,16,17,40,40,21,21,5,34,29,13,114,12,5,5,114,0,43,50,43,50,18,57,47,51,17,51,51,48,49,83,52,18,54,54,23,50,22,23,21,38,38,35,34,6,2,7,51,62,2,51,50,22,22,21,20,6,6,35,34,46,2,1,50,54,53,52,38,39,38,6,6,23,20,30,2,118,91,173,248,157,47,92,45,41,94,55,155,220,122,9,11,42,111,134,75,137,192,101,110,207,147,126,186,123,61,1,236,143,158,149,141,87,151,93,1,42,81,119,2,109,220,1,70,214,105,1,11,10,139,12,11,137,254,236,210,62,88,46,107,201,141,149,221,122,96,173,234,254,149,181,171,147,166,1,2,80,128,72,67,137,114,70,0,1,0,33,254,173,3,237,4,72,0,6,0,16,182,6,5,2,2,3,6,114,0,43,50,17,51,47,48,49,83,1,33,53,33,21,1,239,2,66,252,240,3,204,253,184,254,173,5,9,146,106,250,207,0,3,0,103,255,236,4,41,5,203,0,31,0,47,0,61,0,26,64,14,44,24,8,55,4,0,36,16,13,114,48,0,5,114,0,43,50,43,50,17,23,57,48,49,65,50,22,22,21,20,6,6,7,30,2,21,20,6,6,35,34,38,38,53,52,54,54,55,46,2,53,52,54,54,3,20,22,22,51,50,54,54,53,52,38,38,39,14,2,1,34,6,21,20,22,22,23,62,2,53,52,38,2,72,128,195,111,77,130,79,94,151,88,119,214,144,155,217,113,86,142,84,73,121,71,113,197,194,70,142,106,101,142,75,73,153,121,92,129,68,1,60,118,150,73,126,78,74,118,70,149,5,203,80,155,113,89,133,99,39,43,108,146,100,123,179,96,93,175,123,101,149,108,37,40,102,137,91,111,155,81,251,167,74,117,66,66,118,79,73,110,93,45,38,93,118,3,131,113,106,76,105,75,32,31,76,107,75,106,112,0,2,0,98,254,154,4,37,4,94,0,32,0,47,0,27,64,12,17,39,39,21,21,5,33,28,7,114,12,5,0,47,51,43,50,17,57,47,51,17,51,48,49,65,20,2,6,6,35,34,38,39,53,22,22,51,50,54,18,55,35,14,2,35,34,38,53,52,54,54,51,50,30,2,1,34,6,21,20,22,23,50,54,54,53,52,46,2,4,37,88,171,252,164,56,100,43,43,105,46,158,228,129,10,8,39,107,140,92,199,223,112,208,144,117,185,129,68,254,16,144,157,151,142,87,150,92,39,79,121,1,217,217,254,198,202,98,12,10,140,13,14,131,1,16,209,67,90,45,233,210,147,219,122,83,163,241,1,91,183,160,151,162,1,71,126,80,68,135,111,66,0,0,3,0,103,255,236,4,43,5,205,0,3,0,20,0,36,0,26,64,14,0,1,3,2,4,9,33,17,5,114,25,9,13,114,0,43,50,43,50,18,23,57,48,49,65,39,1,23,19,20,2,6,6,35,34,38,2,53,52,18,54,51,50,22,18,5,20,18,22,51,50,54,18,53,52,2,38,35,34,6,2,1,30,106,2,175,106,94,54,116,184,129,163,213,105,95,212,174,165,214,104,252,227,62,139,113,113,139,63,62,138,115,115,138,61,1,90,107,2,174,106,254,212,178,254,232,194,101,178,1,81,238,234,1,81,181,179,254,175,236,204,254,240,135,134,1,16,205,201,1,15,137,137,254,241,0,255,255,0,72,255,236,4,21,4,94,4,6,4,68,216,0,255,255,0,151,0,0,2,211,4,94,4,6,4,69,109,0,255,255,0,95,0,0,4,2,4,94,4,6,4,70,10,0,255,255,0,75,254,154,3,219,4,95,4,6,4,71,16,0,255,255,0,7,254,166,4,65,4,94,4,6,4,72,217,0,255,255,0,96,254,153,3,252,4,72,4,6,4,73,231,0,255,255,0,84,255,236,4,20,5,206,4,6,4,74,222,0,255,255,0,66,254,173,4,14,4,72,4,6,4,75,33,0,255,255,0,76,255,236,4,14,5,203,4,6,4,76,229,0,255,255,0,70,254,154,4,9,4,94,4,6,4,77,228,0,255,255,0,41,254,230,2,158,2,116,6,7,3,119,0,0,251,162,255,255,0,76,254,246,1,225,2,99,6,7,0,123,0,0,251,162,255,255,0,50,254,246,2,115,2,117,6,7,0,116,0,0,251,162,255,255,0,37,254,231,2,141,2,117,6,7,0,117,0,0,251,162,255,255,0,21,254,246,2,181,2,105,6,7,2,55,0,0,251,162,255,255,0,62,254,228,2,139,2,99,6,7,2,56,0,0,251,162,255,255,0,41,254,230,2,161,2,115,6,7,3,120,0,0,251,162,255,255,0,58,254,246,2,146,2,99,6,7,2,57,0,0,251,162,255,255,0,52,254,231,2,148,2,114,6,7,2,58,0,0,251,162,255,255,0,35,254,230,2,156,2,119,6,7,3,121,0,0,251,162,0,1,0,82,4,131,2,66,5,11,0,3,0,8,177,1,0,0,47,50,48,49,83,53,33,21,82,1,240,4,131,136,136,0,0,1,0,80,1,219,1,141,6,32,0,13,0,8,177,11,3,0,47,196,48,49,83,52,18,55,51,6,2,21,20,18,23,35,38,2,80,98,91,128,97,100,99,98,128,88,101,3,254,172,1,14,104,109,254,231,156,152,254,229,112,98,1,21,255,255,0,80,254,100,1,141,2,169,6,7,4,100,0,0,252,137,0,1,0,61,1,219,1,123,6,32,0,13,0,8,177,4,10,0,47,198,48,49,65,20,2,7,35,54,18,53,52,2,39,51,22,18,1,123,100,89,129,100,99,101,98,129,91,98,4,1,173,254,240,105,111,1,30,151,157,1,22,110,104,254,234,0,255,255,0,61,254,100,1,123,2,169,6,7,4,102,0,0,252,137,0,1,0,72,2,144,2,102,4,185,0,11,0,18,182,7,5,4,4,10,0,1,0,47,51,51,51,17,51,51,48,49,65,53,35,53,51,53,51,21,51,21,35,21,1,37,221,221,100,221,221,2,144,227,100,226,226,100,227,0,0,2,0,72,3,2,2,102,4,70,0,3,0,7,0,12,179,4,5,1,0,0,47,50,206,50,48,49,83,53,33,21,5,53,33,21,72,2,30,253,226,2,30,3,227,99,99,225,100,100,255,255,0,72,255,25,2,102,1,66,6,7,4,104,0,0,252,137,255,255,0,72,255,139,2,102,0,207,6,7,4,105,0,0,252,137,255,255,0,21,0,0,2,217,5,182,6,6,0,18,0,0,0,2,0,174,0,0,5,162,5,182,0,15,0,31,0,37,64,17,16,16,14,14,25,1,4,114,8,8,18,18,31,31,0,12,114,0,43,50,17,51,17,51,124,47,43,50,50,17,51,125,47,48,49,115,17,33,50,22,22,21,17,35,17,52,38,38,35,33,17,19,51,17,33,50,54,54,53,17,51,17,20,6,6,35,33,174,1,204,144,190,93,152,69,131,93,254,224,213,154,1,22,104,141,71,153,93,200,163,254,67,5,182,113,204,135,253,131,2,124,105,143,74,250,205,4,66,252,65,75,146,104,3,238,252,18,129,207,120,0,2,0,113,2,215,5,214,5,201,0,20,0,61,0,51,64,28,3,31,58,34,54,51,38,15,11,9,41,7,7,14,14,0,0,28,21,41,192,4,1,1,48,41,3,114,0,43,50,50,47,51,26,16,204,50,50,47,51,47,51,47,17,23,57,48,49,65,17,51,19,19,51,17,35,17,52,54,55,35,3,35,3,35,22,22,21,17,5,34,38,39,53,22,22,51,50,54,53,52,38,39,46,2,53,52,54,51,50,22,23,7,38,38,35,34,6,21,20,22,23,30,2,21,20,6,6,2,227,180,198,204,173,122,5,1,8,211,101,202,7,2,3,253,237,58,110,37,41,112,61,81,85,84,83,50,101,67,144,119,60,104,45,30,38,94,52,70,74,83,84,71,97,51,70,130,2,229,2,209,253,204,2,52,253,47,1,158,23,98,29,253,204,2,52,35,85,20,254,88,14,20,18,102,16,29,58,50,52,54,31,19,48,83,69,98,97,23,19,95,20,25,53,51,54,49,31,24,53,76,61,68,94,48,255,255,0,175,0,0,1,85,4,72,6,6,3,175,0,0,255,255,255,144,254,20,1,85,4,72,6,6,3,176,0,0,0,1,1,116,254,59,2,110,255,131,0,11,0,14,180,1,7,5,128,11,0,47,26,205,57,57,48,49,69,21,14,2,7,35,53,62,2,55,2,110,10,48,65,36,91,15,35,30,5,125,17,39,112,115,45,24,34,109,117,44,255,255,0,51,254,62,1,126,4,72,6,38,3,175,0,0,0,6,1,80,225,0,255,255,0,164,254,161,1,109,4,72,6,38,3,175,0,0,0,7,4,14,3,106,0,0,0,1,0,0,4,116,0,145,0,22,0,95,0,5,0,2,0,16,0,47,0,154,0,0,2,190,15,131,0,3,0,1,0,0,0,0,0,0,0,0,0,0,0,41,0,71,0,159,1,5,1,101,1,216,1,236,2,19,2,61,2,110,2,141,2,170,2,187,2,214,2,235,3,43,3,81,3,141,3,224,4,25,4,96,4,184,4,212,5,60,5,149,5,194,5,242,6,16,6,42,6,72,6,149,7,33,7,86,7,161,7,221,8,14,8,51,8,83,8,152,8,188,8,206,8,243,9,31,9,53,9,109,9,155,9,221,10,16,10,95,10,154,10,239,11,10,11,53,11,95,11,179,11,222,12,1,12,36,12,63,12,84,12,110,12,138,12,156,12,190,13,15,13,91,13,146,13,221,14,29,14,83,14,213,15,13,15,51,15,106,15,160,15,178,16,1,16,50,16,109,16,190,17,11,17,60,17,137,17,191,17,243,18,27,18,110,18,155,18,218,18,253,19,69,19,86,19,157,19,214,19,214,19,253,20,62,20,135,20,252,21,59,21,84,21,198,21,244,22,101,22,178,22,234,23,1,23,9,23,123,23,141,23,193,23,236,24,33,24,107,24,141,24,204,24,246,24,255,25,45,25,83,25,131,25,183,26,21,26,114,26,244,27,64,27,82,27,100,27,118,27,136,27,155,27,167,27,227,27,239,28,1,28,19,28,37,28,56,28,74,28,92,28,110,28,129,28,196,28,214,28,232,28,250,29,12,29,30,29,49,29,100,29,212,29,230,29,248,30,10,30,29,30,47,30,104,30,199,30,217,30,235,30,253,31,14,31,32,31,52,31,183,31,195,31,213,31,231,31,249,32,11,32,28,32,45,32,63,32,82,32,181,32,199,32,217,32,235,32,253,33,15,33,33,33,88,33,192,33,210,33,228,33,246,34,8,34,26,34,107,34,125,34,143,34,161,34,179,34,197,34,209,34,221,34,239,35,1,35,19,35,37,35,55,35,73,35,91,35,109,35,127,35,146,35,154,35,240,36,2,36,20,36,38,36,56,36,74,36,92,36,104,36,206,36,224,36,242,37,4,37,22,37,40,37,59,37,77,37,96,37,108,37,125,37,143,37,162,37,218,38,31,38,50,38,68,38,87,38,104,38,123,38,140,38,151,38,162,38,181,38,193,38,205,38,223,38,241,38,253,39,8,39,60,39,78,39,96,39,107,39,119,39,138,39,156,39,168,39,180,39,222,40,3,40,21,40,39,40,51,40,63,40,81,40,99,40,111,40,178,40,250,41,12,41,30,41,48,41,66,41,85,41,104,41,193,42,49,42,67,42,85,42,97,42,109,42,127,42,144,42,162,42,180,42,198,42,215,42,227,42,239,43,1,43,18,43,29,43,40,43,58,43,70,43,116,43,181,43,199,43,217,43,235,43,253,44,15,44,33,44,53,44,73,44,92,44,111,44,192,44,204,44,222,44,240,45,2,45,19,45,38,45,56,45,74,45,92,45,110,45,128,45,145,45,183,46,1,46,107,46,247,47,9,47,27,47,45,47,63,47,74,47,85,47,130,47,177,47,196,47,235,48,7,48,52,48,94,48,149,48,206,48,238,49,48,49,60,49,69,49,82,49,95,49,108,49,120,49,133,49,145,49,166,49,174,49,182,49,205,49,255,50,7,50,15,50,23,50,100,50,108,50,116,50,158,50,166,50,174,50,212,50,220,50,246,50,254,51,53,51,61,51,69,51,152,51,160,51,223,52,45,52,64,52,83,52,100,52,117,52,134,52,152,52,171,53,10,53,102,53,156,53,247,54,71,54,148,54,200,55,12,55,49,55,57,55,143,55,151,55,195,56,42,56,50,56,104,56,173,56,242,57,50,57,98,57,145,57,227,58,54,58,122,58,211,58,230,58,248,59,9,59,26,59,44,59,63,59,129,59,147,59,217,59,225,59,233,59,252,60,4,60,94,60,159,60,208,60,226,60,244,61,22,61,30,61,81,61,89,61,97,61,156,61,164,61,220,62,47,62,98,62,116,62,153,62,212,62,220,62,228,62,236,62,244,62,252,63,4,63,12,63,76,63,84,63,92,63,128,63,175,63,210,63,253,64,49,64,106,64,155,64,225,65,54,65,112,65,120,65,219,66,38,66,61,66,117,66,125,66,182,67,10,67,57,67,74,67,112,67,162,67,215,67,252,68,4,68,31,68,39,68,47,68,76,68,84,68,165,68,173,68,210,69,3,69,40,69,85,69,140,69,198,69,249,70,56,70,134,70,190,70,208,71,40,71,58,71,122,71,130,71,138,71,157,71,165,71,246,72,57,72,65,72,83,72,100,72,134,72,162,72,190,72,208,72,226,72,244,73,6,73,25,73,44,73,62,73,80,73,97,73,114,73,122,73,148,73,178,73,209,73,218,73,248,74,42,74,93,74,102,74,142,74,207,74,239,74,255,75,131,75,150,75,181,75,211,75,241,75,253,76,18,76,65,76,112,76,194,77,30,77,130,77,233,78,63,78,157,78,227,78,235,79,48,79,177,80,87,80,244,81,106,81,201,81,209,81,235,82,21,82,38,82,73,82,169,82,222,82,235,83,36,83,48,83,60,83,102,83,140,83,172,83,181,83,212,84,7,84,71,84,98,84,187,84,187,84,187,84,187,84,187,84,187,84,187,84,187,84,187,84,187,84,187,84,187,84,187,84,187,85,167,85,251,86,13,86,21,86,146,86,208,87,50,87,68,87,86,87,98,87,119,87,165,87,250,88,73,88,138,88,211,89,2,89,20,89,38,89,56,89,74,89,165,89,252,90,60,90,124,90,209,91,33,91,97,91,159,91,241,92,63,92,142,92,220,93,63,93,160,94,60,94,216,94,224,94,232,95,51,95,119,95,182,95,243,96,6,96,25,96,146,96,158,97,9,97,108,98,37,98,210,98,228,98,246,99,52,99,110,99,161,100,86,100,230,101,59,101,142,101,206,102,15,102,96,102,202,102,243,103,28,103,102,103,171,103,237,104,47,104,59,104,71,104,120,104,168,104,218,105,12,105,59,105,116,105,160,105,204,105,249,106,38,106,79,106,120,106,199,107,16,107,151,108,18,108,30,108,42,108,78,108,113,108,121,108,166,108,218,109,20,109,74,109,128,109,173,109,220,110,20,110,73,110,144,110,214,111,6,111,14,111,109,111,199,112,45,112,139,112,147,112,165,112,183,113,14,113,85,113,153,113,213,114,12,114,68,114,114,114,160,114,215,115,15,115,84,115,147,115,155,115,173,115,190,115,209,115,227,115,235,115,243,116,5,116,22,116,97,116,105,116,124,116,142,116,161,116,180,116,199,116,217,117,29,117,96,117,114,117,132,117,151,117,169,117,188,117,206,117,214,117,222,117,241,118,3,118,22,118,41,118,59,118,77,118,96,118,114,118,133,118,152,118,171,118,189,118,221,118,253,119,16,119,35,119,47,119,113,119,186,120,3,120,60,120,119,120,167,120,175,121,1,121,100,121,193,122,29,122,105,122,178,123,7,123,84,123,146,123,211,124,25,124,91,124,143,124,198,125,26,125,34,125,121,125,199,125,211,125,223,125,241,126,3,126,23,126,43,126,63,126,83,126,103,126,123,126,143,126,163,126,185,126,207,126,227,126,247,127,11,127,31,127,51,127,71,127,91,127,111,127,133,127,155,127,167,127,179,127,197,127,215,127,233,127,250,128,13,128,32,128,52,128,72,128,92,128,112,128,132,128,152,128,174,128,196,128,214,128,232,128,244,129,0,129,12,129,24,129,42,129,60,129,79,129,98,129,118,129,138,129,158,129,178,129,198,129,218,129,240,130,6,130,24,130,42,130,60,130,78,130,96,130,114,130,132,130,150,130,162,130,174,130,186,130,198,130,216,130,234,130,252,131,14,131,32,131,50,131,68,131,86,131,104,131,122,131,134,131,146,131,158,131,170,131,188,131,206,131,224,131,241,132,3,132,69,132,135,132,222,133,52,133,109,133,165,133,237,134,56,134,95,134,135,134,147,134,159,134,171,134,183,134,205,134,227,135,36,135,44,135,66,135,127,135,172,135,251,136,73,136,95,136,117,136,139,136,161,136,183,136,205,136,227,136,249,137,65,137,73,137,149,137,243,138,84,138,161,138,239,139,23,139,35,139,47,139,59,139,75,139,91,139,176,140,2,140,80,140,99,140,118,140,130,140,142,140,160,140,172,140,216,140,254,141,16,141,34,141,52,141,71,141,89,141,107,141,125,141,137,141,148,141,166,141,178,141,196,141,214,141,226,141,239,141,247,142,10,142,18,142,37,142,45,142,53,142,71,142,108,142,116,142,124,142,141,142,159,142,179,143,42,143,54,143,65,143,152,143,246,144,8,144,26,144,44,144,126,144,212,144,220,145,14,145,62,145,79,145,155,145,202,146,17,146,91,146,143,146,216,147,16,147,87,147,127,147,191,147,209,148,0,148,60,148,153,148,175,148,235,149,72,149,107,149,169,150,11,150,49,150,111,150,214,151,18,151,104,151,229,152,26,152,90,152,152,152,201,153,28,153,110,153,128,153,146,153,168,153,190,153,202,153,214,153,226,153,238,153,250,154,6,154,18,154,29,154,40,154,52,154,64,154,76,154,88,154,100,154,112,154,124,154,136,154,148,154,160,154,172,154,184,154,196,154,208,154,220,154,238,154,247,155,0,155,9,155,18,155,27,155,36,155,45,155,54,155,63,155,72,155,81,155,141,155,150,155,177,155,186,155,195,155,233,156,15,156,57,156,101,156,146,156,245,157,46,157,108,157,133,157,178,157,244,158,5,158,27,158,52,158,78,158,142,158,167,158,185,158,210,158,236,159,6,159,15,159,24,159,33,159,42,159,51,159,60,159,69,159,78,159,87,159,96,159,160,159,199,160,2,160,83,160,138,160,208,161,39,161,65,161,168,161,255,162,8,162,17,162,26,162,35,162,44,162,53,162,62,162,71,162,80,162,89,162,142,162,179,162,238,163,63,163,118,163,188,164,22,164,49,164,154,164,240,165,62,165,70,165,78,165,86,165,94,165,102,165,110,165,118,165,126,165,134,165,142,165,151,165,160,165,169,165,178,165,187,165,196,165,205,165,214,165,223,165,232,165,249,166,25,166,34,166,67,166,76,166,106,166,131,166,140,166,149,166,157,166,226,167,87,167,95,167,103,167,133,167,144,167,156,0,0,0,1,0,0,0,3,0,66,183,189,33,224,95,15,60,245,0,11,8,0,0,0,0,0,217,204,194,247,0,0,0,0,221,119,38,81,251,156,253,211,9,156,8,98,0,0,0,6,0,2,0,0,0,0,0,0,4,205,0,193,0,0,0,0,2,20,0,0,2,20,0,0,2,29,0,150,3,48,0,135,5,43,0,52,4,147,0,127,6,157,0,102,5,212,0,111,1,193,0,135,2,92,0,82,2,92,0,62,4,104,0,89,4,147,0,103,2,18,0,83,2,147,0,82,2,26,0,150,2,239,0,21,4,147,0,103,4,147,0,185,4,147,0,101,4,147,0,92,4,147,0,44,4,147,0,132,4,147,0,116,4,147,0,93,4,147,0,103,4,147,0,103,2,26,0,150,2,26,0,65,4,147,0,103,4,147,0,115,4,147,0,103,3,116,0,31,7,44,0,118,5,15,0,0,5,43,0,200,5,10,0,125,5,206,0,200,4,114,0,200,4,33,0,200,5,209,0,125,5,230,0,200,2,60,0,200,2,38,255,92,4,230,0,200,4,45,0,200,7,50,0,200,6,6,0,200,6,57,0,125,4,208,0,200,6,57,0,125,4,240,0,200,4,99,0,105,4,104,0,18,5,213,0,185,4,197,0,0,7,99,0,30,4,159,0,6,4,121,0,0,4,148,0,78,2,158,0,166,2,239,0,21,2,158,0,51,4,147,0,80,3,129,255,252,2,56,0,82,4,114,0,94,4,229,0,175,3,213,0,114,4,229,0,114,4,126,0,114,2,177,0,30,4,88,0,31,4,232,0,175,2,5,0,160,2,5,255,144,4,52,0,175,2,5,0,175,7,104,0,175,4,232,0,175,4,208,0,114,4,229,0,175,4,229,0,113,3,69,0,175,3,208,0,103,2,218,0,32,4,232,0,163,3,255,0,0,6,51,0,24,4,48,0,39,4,2,0,2,3,192,0,80,3,0,0,57,4,101,1,236,3,0,0,67,4,147,0,103,2,20,0,0,2,29,0,150,4,147,0,185,4,147,0,68,4,147,0,121,4,147,0,31,4,101,1,236,4,28,0,122,4,163,1,54,6,168,0,100,2,211,0,68,3,247,0,79,4,147,0,103,2,147,0,82,6,168,0,100,4,0,255,250,3,109,0,117,4,147,0,103,2,200,0,50,2,200,0,37,2,56,0,82,4,242,0,175,5,61,0,122,2,26,0,150,1,198,0,28,2,200,0,76,2,253,0,67,3,247,0,77,5,236,0,66,6,37,0,44,6,58,0,33,3,116,0,53,5,15,0,0,5,15,0,0,5,15,0,0,5,15,0,0,5,15,0,0,5,15,0,0,6,242,255,254,5,10,0,125,4,114,0,200,4,114,0,200,4,114,0,200,4,114,0,200,2,60,255,244,2,60,0,180,2,60,255,206,2,60,0,6,5,206,0,58,6,6,0,200,6,57,0,125,6,57,0,125,6,57,0,125,6,57,0,125,6,57,0,125,4,147,0,133,6,57,0,125,5,213,0,185,5,213,0,185,5,213,0,185,5,213,0,185,4,121,0,0,4,208,0,200,4,251,0,175,4,114,0,94,4,114,0,94,4,114,0,94,4,114,0,94,4,114,0,94,4,114,0,94,6,230,0,94,3,213,0,114,4,126,0,114,4,126,0,114,4,126,0,114,4,126,0,114,2,5,255,248,2,5,0,143,2,5,255,181,2,5,255,231,4,204,0,113,4,232,0,175,4,208,0,114,4,208,0,114,4,208,0,114,4,208,0,114,4,208,0,114,4,147,0,103,4,208,0,114,4,232,0,163,4,232,0,163,4,232,0,163,4,232,0,163,4,2,0,2,4,229,0,175,4,2,0,2,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,10,0,125,3,213,0,114,5,10,0,125,3,213,0,114,5,10,0,125,3,213,0,114,5,10,0,125,3,213,0,114,5,206,0,200,4,229,0,114,5,206,0,58,4,232,0,114,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,5,209,0,125,4,88,0,31,5,209,0,125,4,88,0,31,5,209,0,125,4,88,0,31,5,209,0,125,4,88,0,31,5,230,0,200,4,232,255,183,5,230,0,0,4,232,0,20,2,60,255,173,2,5,255,137,2,60,255,243,2,5,255,214,2,60,255,231,2,5,255,211,2,60,0,88,2,5,0,49,2,60,0,189,4,98,0,200,4,10,0,160,2,38,255,92,2,5,255,144,4,230,0,200,4,52,0,175,4,52,0,175,4,45,0,167,2,5,0,143,4,45,0,200,2,5,0,131,4,45,0,200,2,5,0,175,4,45,0,200,2,23,0,175,4,45,0,26,2,5,255,242,6,6,0,200,4,232,0,175,6,6,0,200,4,232,0,175,6,6,0,200,4,232,0,175,5,105,0,2,6,6,0,200,4,232,0,175,6,57,0,125,4,208,0,114,6,57,0,125,4,208,0,114,6,57,0,125,4,208,0,114,7,102,0,125,7,150,0,112,4,240,0,200,3,69,0,175,4,240,0,200,3,69,0,125,4,240,0,200,3,69,0,149,4,99,0,105,3,208,0,103,4,99,0,105,3,208,0,103,4,99,0,105,3,208,0,103,4,99,0,105,3,208,0,103,4,104,0,18,2,218,0,32,4,104,0,18,2,218,0,32,4,104,0,18,2,218,0,32,5,213,0,185,4,232,0,163,5,213,0,185,4,232,0,163,5,213,0,185,4,232,0,163,5,213,0,185,4,232,0,163,5,213,0,185,4,232,0,163,5,213,0,185,4,232,0,163,7,99,0,30,6,51,0,24,4,121,0,0,4,2,0,2,4,121,0,0,4,148,0,78,3,192,0,80,4,148,0,78,3,192,0,80,4,148,0,78,3,192,0,80,2,149,0,175,4,147,0,190,5,17,255,254,4,114,0,94,6,242,255,254,6,230,0,94,6,57,0,125,4,208,0,114,4,99,0,105,3,208,0,103,3,69,0,82,3,69,0,82,2,251,0,82,3,18,0,82,1,108,0,82,2,98,0,82,1,239,0,82,3,138,0,82,3,118,0,82,4,158,2,8,4,158,1,32,5,15,0,0,2,26,0,150,5,21,255,254,6,137,255,254,2,228,255,254,6,143,255,254,5,175,255,254,6,132,255,242,2,183,255,213,5,15,0,0,5,43,0,200,4,41,0,200,4,162,0,37,4,114,0,200,4,148,0,78,5,230,0,200,6,57,0,125,2,60,0,200,4,230,0,200,4,211,0,0,7,50,0,200,6,6,0,200,4,104,0,67,6,57,0,125,5,211,0,200,4,208,0,200,4,136,0,72,4,104,0,18,4,121,0,0,6,96,0,105,4,159,0,6,6,97,0,111,6,63,0,79,2,60,0,6,4,121,0,0,4,227,0,114,3,210,0,89,4,232,0,175,2,183,0,168,4,225,0,163,4,227,0,114,5,4,0,175,4,23,0,9,4,205,0,112,3,210,0,89,3,217,0,114,4,232,0,175,4,186,0,113,2,183,0,168,4,52,0,175,4,72,255,244,4,242,0,175,4,84,0,0,3,203,0,112,4,208,0,114,5,53,0,25,4,207,0,164,3,220,0,114,4,229,0,114,3,201,0,20,4,225,0,163,5,188,0,114,4,91,255,240,6,9,0,163,6,49,0,115,2,183,255,233,4,225,0,163,4,208,0,114,4,225,0,163,6,49,0,115,4,114,0,200,5,222,0,18,4,41,0,200,5,29,0,125,4,99,0,105,2,60,0,200,2,60,0,6,2,38,255,92,7,123,0,1,7,170,0,200,5,222,0,18,4,225,0,200,4,241,0,22,5,211,0,200,5,15,0,0,4,229,0,200,5,43,0,200,4,41,0,200,5,121,0,12,4,114,0,200,6,187,0,4,4,170,0,79,6,20,0,202,6,20,0,202,4,225,0,200,5,160,0,1,7,50,0,200,5,230,0,200,6,57,0,125,5,211,0,200,4,208,0,200,5,10,0,125,4,104,0,18,4,241,0,22,6,96,0,105,4,159,0,6,5,230,0,200,5,140,0,167,8,65,0,200,8,75,0,200,5,125,0,15,6,201,0,200,5,18,0,200,5,11,0,63,8,98,0,200,5,15,0,46,4,114,0,94,4,194,0,118,4,152,0,175,3,115,0,175,4,153,0,39,4,126,0,114,5,225,0,4,3,222,0,67,5,22,0,175,5,22,0,175,4,34,0,175,4,148,0,13,5,222,0,174,5,16,0,175,4,208,0,114,4,246,0,175,4,229,0,175,3,213,0,114,3,196,0,41,4,2,0,2,5,185,0,112,4,48,0,39,5,2,0,175,4,219,0,154,7,30,0,175,7,46,0,175,5,127,0,38,6,37,0,175,4,184,0,175,3,243,0,65,6,162,0,175,4,110,0,34,4,126,0,114,4,232,0,20,3,115,0,175,3,242,0,114,3,208,0,103,2,5,0,160,2,5,255,231,2,5,255,144,6,183,0,13,7,29,0,175,4,232,0,20,4,34,0,175,4,2,0,2,4,249,0,175,4,55,0,200,3,120,0,175,7,99,0,30,6,51,0,24,7,99,0,30,6,51,0,24,7,99,0,30,6,51,0,24,4,121,0,0,4,2,0,2,4,0,0,82,8,0,0,82,8,0,0,82,3,70,255,252,1,91,0,27,1,91,0,26,1,245,0,65,1,91,0,27,2,202,0,27,2,202,0,26,3,69,0,65,4,17,0,130,4,17,0,121,3,2,0,171,6,57,0,150,9,94,0,102,1,215,0,80,3,57,0,80,2,103,0,79,2,103,0,77,3,236,0,150,1,6,254,132,3,48,0,114,4,147,0,94,4,147,0,70,6,38,0,158,4,147,0,52,6,139,0,135,4,34,0,112,8,38,0,197,6,28,0,31,6,63,0,79,4,244,0,102,6,150,0,62,6,150,0,37,6,150,0,72,6,150,0,94,4,162,0,101,4,162,0,37,5,231,0,199,5,9,0,74,4,147,0,103,4,100,0,37,5,162,0,117,3,17,0,9,4,147,0,103,4,147,0,103,4,147,0,103,4,147,0,103,4,169,0,108,4,158,0,217,4,0,1,137,0,0,255,131,4,0,1,129,2,200,0,21,2,200,0,62,2,200,0,58,2,200,0,52,4,0,0,0,8,0,0,0,4,0,0,0,8,0,0,0,2,170,0,0,2,0,0,0,1,86,0,0,4,147,0,0,2,26,0,0,1,84,0,0,0,205,0,0,0,0,0,0,0,0,0,0,8,0,0,84,8,0,0,84,2,5,255,144,1,91,0,26,4,237,0,12,4,135,0,0,6,188,0,22,7,50,0,200,7,104,0,175,5,15,0,0,4,114,0,94,2,170,0,117,6,63,0,125,4,227,0,114,6,46,0,185,5,77,0,163,0,0,253,5,4,114,0,200,6,20,0,202,4,126,0,114,5,22,0,175,7,82,0,52,6,64,0,39,5,102,0,20,5,14,0,20,7,95,0,200,5,248,0,175,5,99,0,0,4,121,0,7,7,87,0,200,6,26,0,175,5,200,0,23,5,19,0,12,7,208,0,200,6,185,0,175,4,168,0,64,3,222,0,27,6,97,0,111,6,9,0,163,6,60,0,125,4,208,0,114,5,4,0,0,4,18,0,0,5,4,0,0,4,18,0,0,9,166,0,125,8,170,0,114,6,135,0,125,5,51,0,114,8,39,0,126,7,46,0,119,7,82,0,52,6,64,0,39,5,29,0,124,3,234,0,114,4,222,0,109,7,233,0,43,7,166,0,43,6,49,0,200,5,49,0,175,4,225,0,44,4,193,0,29,4,221,0,200,4,229,0,175,4,51,0,46,3,116,0,16,5,46,0,200,4,60,0,175,7,21,0,4,6,56,0,4,4,170,0,79,3,222,0,67,5,75,0,200,4,91,0,175,4,229,0,200,4,34,0,175,4,225,0,31,4,52,0,17,5,122,0,13,4,224,0,38,5,255,0,200,5,53,0,175,6,121,0,200,5,217,0,175,8,118,0,200,6,231,0,175,6,54,0,125,5,22,0,114,5,10,0,125,3,213,0,114,4,104,0,16,3,195,0,41,4,121,0,0,3,255,0,0,4,121,0,0,3,255,0,0,4,241,0,6,4,89,0,39,6,222,0,17,5,190,0,41,5,149,0,167,4,235,0,154,5,140,0,167,4,208,0,154,5,140,0,201,4,232,0,175,6,185,0,56,5,72,0,45,6,185,0,56,5,72,0,45,2,60,0,200,6,187,0,4,5,225,0,4,5,130,0,200,4,113,0,175,5,179,0,1,4,164,0,13,5,213,0,200,4,244,0,175,6,1,0,200,5,61,0,175,5,140,0,167,4,219,0,154,7,68,0,200,5,238,0,174,2,60,0,200,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,6,242,255,254,6,230,0,94,4,114,0,200,4,126,0,114,5,221,0,120,4,126,0,106,5,221,0,120,4,126,0,106,6,187,0,4,5,225,0,4,4,170,0,79,3,222,0,67,4,171,0,73,3,238,0,29,6,20,0,202,5,22,0,175,6,20,0,202,5,22,0,175,6,57,0,125,4,208,0,114,6,60,0,125,4,208,0,114,6,60,0,125,4,208,0,114,5,11,0,63,3,243,0,65,4,241,0,22,4,2,0,2,4,241,0,22,4,2,0,2,4,241,0,22,4,2,0,2,5,140,0,167,4,219,0,154,4,52,0,200,3,115,0,175,6,201,0,200,6,37,0,175,4,51,0,46,3,116,0,16,4,242,0,6,4,86,0,39,4,159,0,5,4,48,0,39,4,227,0,126,4,229,0,114,7,40,0,125,7,36,0,112,7,47,0,76,6,102,0,79,4,252,0,76,4,52,0,79,7,207,255,255,6,207,0,13,8,21,0,200,7,73,0,175,6,11,0,125,5,25,0,114,5,170,0,16,5,49,0,41,4,172,0,110,3,210,0,89,5,168,0,1,4,162,0,13,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,45,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,5,15,0,0,4,114,0,94,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,4,114,0,92,4,126,0,73,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,4,114,0,200,4,126,0,114,2,60,0,142,2,5,0,119,2,60,0,184,2,5,0,160,6,57,0,125,4,208,0,114,6,57,0,125,4,208,0,114,6,57,0,125,4,208,0,114,6,57,0,125,4,208,0,96,6,57,0,125,4,208,0,114,6,57,0,125,4,208,0,114,6,57,0,125,4,208,0,114,6,63,0,125,4,227,0,114,6,63,0,125,4,227,0,114,6,63,0,125,4,227,0,114,6,63,0,125,4,227,0,114,6,63,0,125,4,227,0,114,5,213,0,185,4,232,0,163,5,213,0,185,4,232,0,163,6,46,0,185,5,77,0,163,6,46,0,185,5,77,0,163,6,46,0,185,5,77,0,163,6,46,0,185,5,77,0,163,6,46,0,185,5,77,0,163,4,121,0,0,4,2,0,2,4,121,0,0,4,2,0,2,4,121,0,0,4,2,0,2,4,232,0,114,0,0,252,112,0,0,251,156,0,0,252,112,0,0,252,105,0,0,252,117,0,0,252,117,0,0,252,117,0,0,252,103,1,164,0,48,1,179,0,29,4,104,0,18,2,218,0,32,6,57,0,125,4,208,0,114,6,57,0,125,4,208,0,114,4,126,0,106,0,0,253,5,7,117,0,1,4,166,1,112,2,200,0,41,2,200,0,41,2,200,0,35,2,183,255,218,2,183,255,218,2,183,255,204,2,183,255,206,4,225,0,163,4,225,0,163,4,225,0,163,4,225,0,163,5,188,0,199,6,6,0,200,5,169,0,186,0,0,0,95,0,0,0,95,0,0,0,107,0,0,0,107,4,166,0,181,5,98,0,30,4,182,0,30,4,182,0,30,7,102,0,30,7,102,0,30,5,160,0,186,5,34,255,230,5,26,0,195,4,45,0,200,6,6,0,200,5,15,0,0,4,114,0,200,2,60,0,88,5,213,0,185,2,170,0,87,3,71,0,56,2,170,0,76,2,170,0,87,2,170,0,9,2,170,0,58,2,170,255,220,2,170,0,41,2,170,0,38,2,170,0,87,2,170,0,87,2,170,0,87,4,207,0,87,3,71,0,56,2,170,0,87,2,170,0,87,3,156,255,254,2,170,0,87,2,170,0,58,2,170,0,87,2,170,0,58,3,71,0,56,2,170,0,87,2,5,0,175,2,5,255,144,5,4,0,175,4,91,255,240,4,229,0,114,2,5,0,65,4,232,0,175,4,114,0,94,4,126,0,114,2,5,0,49,4,232,0,163,4,229,0,114,4,229,0,114,4,229,0,114,4,229,0,114,3,71,255,231,4,205,0,112,2,170,0,87,3,48,0,114,2,187,0,114,1,81,0,114,4,209,0,114,3,48,0,114,3,46,0,114,2,122,0,67,1,219,0,21,4,180,0,113,4,47,0,82,3,62,0,49,4,9,0,44,5,6,0,175,2,7,0,175,2,32,0,62,5,6,0,175,5,2,0,165,1,236,0,162,3,242,0,34,3,224,0,70,3,224,0,54,4,255,0,168,4,247,0,99,1,253,0,100,3,114,0,117,4,203,0,110,4,182,0,60,4,227,0,89,4,192,0,110,3,222,0,3,4,117,0,79,4,195,0,175,3,255,0,44,5,168,0,82,5,20,0,40,5,168,0,82,5,168,0,76,5,168,0,82,5,168,0,80,4,180,0,113,4,180,0,113,4,180,0,113,4,47,0,82,3,62,0,49,4,9,0,44,5,6,0,175,2,7,255,190,2,32,255,199,5,2,0,165,1,236,255,195,3,242,0,34,3,224,0,70,3,224,0,54,4,247,0,99,3,114,0,117,4,203,0,110,4,227,0,89,4,192,0,110,4,117,0,79,4,195,0,175,3,255,0,44,5,168,0,82,5,20,0,40,2,7,0,175,0,0,252,25,0,0,253,128,0,0,254,176,0,0,252,24,0,0,254,213,0,0,254,202,0,0,255,158,0,0,254,229,0,0,255,37,0,0,255,6,0,0,254,175,0,0,251,229,0,0,255,97,0,0,253,58,0,0,255,55,0,0,255,91,0,0,253,64,0,0,253,68,0,0,252,87,0,0,252,90,0,0,255,193,0,0,254,160,0,0,254,210,0,0,254,210,0,0,255,186,0,0,255,34,0,0,255,34,0,0,255,70,0,0,255,72,0,0,255,187,0,0,255,192,0,0,255,40,0,0,255,192,0,0,255,208,0,0,255,192,0,0,255,186,0,0,255,83,2,200,0,41,2,200,0,76,2,200,0,50,2,200,0,37,2,200,0,21,2,200,0,62,2,200,0,41,2,200,0,58,2,200,0,52,2,200,0,35,4,170,0,115,3,118,0,51,4,106,0,79,4,136,0,87,4,154,0,48,4,136,0,126,4,144,0,115,4,18,0,17,4,180,0,122,4,144,0,102,2,200,0,41,2,200,0,76,2,200,0,50,2,200,0,37,2,200,0,21,2,200,0,62,2,200,0,41,2,200,0,58,2,200,0,52,2,200,0,35,4,172,0,112,3,36,0,42,4,80,0,85,4,67,0,59,4,139,0,46,4,123,0,121,4,153,0,118,4,56,0,33,4,147,0,103,4,153,0,98,4,147,0,103,4,92,0,72,4,92,0,151,4,92,0,95,4,92,0,75,4,92,0,7,4,92,0,96,4,92,0,84,4,92,0,66,4,92,0,76,4,92,0,70,2,200,0,41,2,200,0,76,2,200,0,50,2,200,0,37,2,200,0,21,2,200,0,62,2,200,0,41,2,200,0,58,2,200,0,52,2,200,0,35,2,147,0,82,1,203,0,80,1,203,0,80,1,203,0,61,1,203,0,61,2,173,0,72,2,173,0,72,2,173,0,72,2,173,0,72,2,239,0,21,6,72,0,174,6,110,0,113,2,5,0,175,2,5,255,144,4,0,1,116,2,5,0,51,0,164,0,0,0,1,0,0,8,141,253,168,0,0,9,166,251,156,253,52,9,156,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,115,0,4,4,145,1,144,0,5,0,0,5,51,4,205,0,0,0,154,5,51,4,205,0,0,2,205,0,50,2,146,0,0,0,0,0,0,0,0,0,0,0,0,224,0,2,255,64,0,32,27,0,0,0,40,0,0,0,0,71,79,79,71,1,192,0,0,255,253,8,141,253,168,0,0,8,254,2,139,0,0,1,159,0,0,0,0,4,72,5,182,0,0,0,32,0,4,0,0,0,2,0,0,0,3,0,0,0,20,0,3,0,1,0,0,0,20,0,4,3,226,0,0,0,224,0,128,0,6,0,96,0,0,0,13,0,126,1,48,1,49,1,97,1,99,1,127,1,146,1,161,1,176,1,237,1,240,1,255,2,27,2,55,2,89,2,188,2,199,2,201,2,221,2,243,3,4,3,12,3,15,3,18,3,35,3,40,3,138,3,140,3,161,3,206,3,210,3,214,4,0,4,12,4,13,4,79,4,80,4,92,4,95,4,130,4,134,4,143,4,145,5,19,5,189,5,190,5,194,5,199,5,234,30,1,30,63,30,133,30,158,30,241,30,243,30,249,31,77,31,222,32,11,32,21,32,30,32,34,32,38,32,48,32,51,32,58,32,60,32,68,32,112,32,122,32,127,32,137,32,138,32,142,32,156,32,164,32,167,32,172,33,5,33,19,33,22,33,32,33,34,33,38,33,46,33,94,34,2,34,6,34,15,34,18,34,21,34,26,34,30,34,43,34,72,34,96,34,101,37,202,167,181,171,83,251,4,251,54,251,60,251,62,251,65,251,68,251,75,254,255,255,253,255,255,0,0,0,0,0,13,0,32,0,160,1,49,1,50,1,98,1,100,1,146,1,160,1,175,1,234,1,240,1,250,2,24,2,55,2,89,2,188,2,198,2,201,2,216,2,243,3,0,3,6,3,15,3,18,3,35,3,38,3,132,3,140,3,142,3,163,3,209,3,214,4,0,4,1,4,13,4,14,4,80,4,81,4,93,4,96,4,131,4,136,4,144,4,146,5,176,5,190,5,193,5,199,5,208,30,0,30,62,30,128,30,158,30,160,30,242,30,244,31,77,31,222,32,0,32,19,32,23,32,32,32,38,32,48,32,50,32,57,32,60,32,68,32,112,32,116,32,124,32,128,32,138,32,140,32,149,32,163,32,167,32,170,33,5,33,19,33,22,33,32,33,34,33,38,33,46,33,91,34,2,34,6,34,15,34,17,34,21,34,26,34,30,34,43,34,72,34,96,34,100,37,202,167,179,171,83,251,0,251,42,251,56,251,62,251,64,251,67,251,70,254,255,255,252,255,255,0,1,255,245,255,227,255,194,2,126,255,193,2,11,255,193,255,175,0,180,0,167,1,133,0,90,255,72,0,0,1,121,1,26,255,143,254,132,254,131,254,117,255,96,1,1,0,0,0,253,0,251,0,235,0,0,253,207,253,206,253,205,253,204,254,123,254,120,254,89,253,154,254,77,253,153,254,11,253,152,0,0,253,253,0,0,253,248,253,103,253,246,254,101,254,165,254,98,254,94,253,249,228,81,228,17,227,121,228,241,228,106,227,13,228,104,228,40,227,152,226,59,225,238,225,237,225,236,225,233,225,224,225,223,225,218,225,217,225,210,227,7,0,0,0,0,227,217,227,224,0,0,227,44,225,117,225,115,0,0,225,23,225,10,225,8,227,78,224,253,224,250,224,243,224,199,224,36,224,33,224,25,224,24,226,87,224,17,224,14,224,2,223,230,223,207,223,204,220,104,0,0,88,95,8,138,8,186,8,185,8,184,8,183,8,182,8,181,3,72,2,76,0,1,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,196,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,186,0,0,0,0,0,0,0,192,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,172,0,0,0,174,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,0,136,0,0,0,0,0,138,0,0,0,0,0,0,0,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,1,72,1,73,1,35,1,36,4,6,4,7,4,8,3,116,4,9,4,10,4,11,2,53,4,15,4,16,2,92,1,245,1,246,4,19,4,20,4,17,4,18,2,55,2,56,3,120,2,57,2,58,3,121,4,104,4,105,4,100,4,102,2,23,4,107,4,101,4,103,4,109,3,98,2,27,3,144,3,145,3,177,0,0,64,74,153,152,151,150,135,134,133,132,131,130,129,128,127,126,125,124,123,122,121,120,119,118,117,116,115,114,113,112,111,110,109,108,107,106,105,104,103,102,101,100,99,98,97,96,95,94,93,92,91,90,89,88,87,86,85,84,83,81,80,79,78,77,76,75,74,73,72,71,70,40,31,16,10,9,44,1,177,11,10,67,35,67,101,10,45,44,0,177,10,11,67,35,67,11,45,44,1,176,6,67,176,7,67,101,10,45,44,176,79,43,32,176,64,81,88,33,75,82,88,69,68,27,33,33,89,27,35,33,176,64,176,4,37,69,176,4,37,69,97,100,138,99,82,88,69,68,27,33,33,89,89,45,44,0,176,7,67,176,6,67,11,45,44,75,83,35,75,81,90,88,32,69,138,96,68,27,33,33,89,45,44,75,84,88,32,69,138,96,68,27,33,33,89,45,44,75,83,35,75,81,90,88,56,27,33,33,89,45,44,75,84,88,56,27,33,33,89,45,44,176,2,67,84,88,176,70,43,27,33,33,33,33,89,45,44,176,2,67,84,88,176,71,43,27,33,33,33,89,45,44,176,2,67,84,88,176,72,43,27,33,33,33,33,89,45,44,176,2,67,84,88,176,73,43,27,33,33,33,89,45,44,35,32,176,0,80,138,138,100,177,0,3,37,84,88,176,64,27,177,1,3,37,84,88,176,5,67,139,89,176,79,43,89,35,176,98,43,35,33,35,88,101,89,45,44,177,8,0,12,33,84,96,67,45,44,177,12,0,12,33,84,96,67,45,44,1,32,71,176,2,67,32,184,16,0,98,184,16,0,99,87,35,184,1,0,98,184,16,0,99,87,90,88,176,32,96,102,89,72,45,44,177,0,2,37,176,2,37,176,2,37,83,184,0,53,35,120,176,2,37,176,2,37,96,176,32,99,32,32,176,6,37,35,98,80,88,138,33,176,1,96,35,27,32,32,176,6,37,35,98,82,88,35,33,176,1,97,27,138,33,35,33,32,89,89,184,255,193,28,96,176,32,99,35,33,45,44,177,2,0,66,177,35,1,136,81,177,64,1,136,83,90,88,184,16,0,176,32,136,84,88,178,2,1,2,67,96,66,89,177,36,1,136,81,88,184,32,0,176,64,136,84,88,178,2,2,2,67,96,66,177,36,1,136,84,88,178,2,32,2,67,96,66,0,75,1,75,82,88,178,2,8,2,67,96,66,89,27,184,64,0,176,128,136,84,88,178,2,4,2,67,96,66,89,184,64,0,176,128,99,184,1,0,136,84,88,178,2,8,2,67,96,66,89,185,64,0,1,0,99,184,2,0,136,84,88,178,2,16,2,67,96,66,89,177,38,1,136,81,88,185,64,0,2,0,99,184,4,0,136,84,88,178,2,64,2,67,96,66,89,185,64,0,4,0,99,184,8,0,136,84,88,178,2,128,2,67,96,66,89,177,40,1,136,81,88,185,64,0,8,0,99,184,16,0,136,84,88,185,0,2,1,0,176,2,67,96,66,89,89,89,89,89,89,89,177,0,2,67,84,88,64,10,5,64,8,64,9,64,12,2,13,2,27,177,1,2,67,84,88,178,5,64,8,186,1,0,0,9,1,0,179,12,1,13,1,27,177,128,2,67,82,88,178,5,64,8,184,1,128,177,9,64,27,184,1,0,176,2,67,82,88,178,5,64,8,186,1,128,0,9,1,64,27,184,1,128,176,2,67,82,88,178,5,64,8,184,2,0,177,9,64,27,178,5,64,8,186,1,0,0,9,1,0,89,89,89,184,64,0,176,128,136,85,185,64,0,2,0,99,184,4,0,136,85,90,88,179,12,0,13,1,27,179,12,0,13,1,89,89,89,66,66,66,66,66,45,44,69,177,2,78,43,35,176,79,43,32,176,64,81,88,33,75,81,88,176,2,37,69,177,1,78,43,96,89,27,35,75,81,88,176,3,37,69,32,100,138,99,176,64,83,88,177,2,78,43,96,27,33,89,27,33,89,89,68,45,44,32,176,0,80,32,88,35,101,27,35,89,177,20,20,138,112,69,177,16,16,67,75,138,67,81,90,88,176,64,27,176,79,43,89,35,177,97,6,38,96,43,138,88,176,5,67,139,89,35,88,101,89,35,16,58,45,44,176,3,37,73,99,35,70,96,176,79,43,35,176,4,37,176,4,37,73,176,3,37,99,86,32,96,176,98,96,43,176,3,37,32,16,70,138,70,96,176,32,99,97,58,45,44,176,0,22,177,2,3,37,177,1,4,37,1,62,0,62,177,1,2,6,12,176,10,35,101,66,176,11,35,66,177,2,3,37,177,1,4,37,1,63,0,63,177,1,2,6,12,176,6,35,101,66,176,7,35,66,176,1,22,177,0,2,67,84,88,69,35,69,32,24,105,138,99,35,98,32,32,176,64,80,88,103,27,102,89,97,176,32,99,176,64,35,97,176,4,35,66,27,177,4,0,66,33,33,89,24,1,45,44,32,69,177,0,78,43,68,45,44,75,81,177,64,79,43,80,91,88,32,69,177,1,78,43,32,138,138,68,32,177,64,4,38,97,99,97,177,1,78,43,68,33,27,35,33,138,69,177,1,78,43,32,138,35,68,68,89,45,44,75,81,177,64,79,43,80,91,88,69,32,138,176,64,97,99,96,27,35,33,69,89,177,1,78,43,68,45,44,35,69,32,138,69,35,97,32,100,176,64,81,176,4,37,32,176,0,83,35,176,64,81,90,90,177,64,79,43,84,90,88,138,12,100,35,100,35,83,88,177,64,64,138,97,32,99,97,27,32,99,89,27,138,89,99,177,2,78,43,96,68,45,44,1,45,44,0,45,44,5,177,11,10,67,35,67,101,10,45,44,177,10,11,67,35,67,11,2,45,44,176,2,37,99,102,176,2,37,184,32,0,98,96,35,98,45,44,176,2,37,99,176,32,96,102,176,2,37,184,32,0,98,96,35,98,45,44,176,2,37,99,103,176,2,37,184,32,0,98,96,35,98,45,44,176,2,37,99,102,176,32,96,176,2,37,184,32,0,98,96,35,98,45,44,35,74,177,2,78,43,45,44,35,74,177,1,78,43,45,44,35,138,74,35,69,100,176,2,37,100,176,2,37,97,100,176,3,67,82,88,33,32,100,89,177,2,78,43,35,176,0,80,88,101,89,45,44,35,138,74,35,69,100,176,2,37,100,176,2,37,97,100,176,3,67,82,88,33,32,100,89,177,1,78,43,35,176,0,80,88,101,89,45,44,32,176,3,37,74,177,2,78,43,138,16,59,45,44,32,176,3,37,74,177,1,78,43,138,16,59,45,44,176,3,37,176,3,37,138,176,103,43,138,16,59,45,44,176,3,37,176,3,37,138,176,104,43,138,16,59,45,44,176,3,37,70,176,3,37,70,96,176,4,37,46,176,4,37,176,4,37,176,4,38,32,176,0,80,88,33,176,106,27,176,108,89,43,176,3,37,70,176,3,37,70,96,97,176,128,98,32,138,32,16,35,58,35,32,16,35,58,45,44,176,3,37,71,176,3,37,71,96,176,5,37,71,176,128,99,97,176,2,37,176,6,37,73,99,35,176,5,37,74,176,128,99,32,88,98,27,33,89,176,4,38,70,96,138,70,138,70,96,176,32,99,97,45,44,176,4,38,176,4,37,176,4,37,176,4,38,176,110,43,32,138,32,16,35,58,35,32,16,35,58,45,44,35,32,176,1,84,88,33,176,2,37,177,2,78,43,176,128,80,32,96,89,32,96,96,32,176,1,81,88,33,33,27,32,176,5,81,88,33,32,102,97,176,64,35,97,177,0,3,37,80,176,3,37,176,3,37,80,90,88,32,176,3,37,97,138,83,88,33,176,0,89,27,33,89,27,176,7,84,88,32,102,97,101,35,33,27,33,33,176,0,89,89,89,177,2,78,43,45,44,176,2,37,176,4,37,74,176,0,83,88,176,0,27,138,138,35,138,176,1,89,176,4,37,70,32,102,97,32,176,5,38,176,6,38,73,176,5,38,176,5,38,176,112,43,35,97,101,176,32,96,32,102,97,176,32,97,101,45,44,176,2,37,70,32,138,32,176,0,80,88,33,177,2,78,43,27,69,35,33,89,97,101,176,2,37,16,59,45,44,176,4,38,32,184,2,0,98,32,184,2,0,99,138,35,97,32,176,93,96,43,176,5,37,17,138,18,138,32,57,138,88,185,0,93,16,0,176,4,38,99,86,96,43,35,33,32,16,32,70,32,177,2,78,43,35,97,27,35,33,32,138,32,16,73,177,2,78,43,89,59,45,44,185,0,93,16,0,176,9,37,99,86,96,43,176,5,37,176,5,37,176,5,38,176,109,43,177,93,7,37,96,43,176,5,37,176,5,37,176,5,37,176,5,37,176,111,43,185,0,93,16,0,176,8,38,99,86,96,43,32,176,0,82,88,176,80,43,176,5,37,176,5,37,176,7,37,176,7,37,176,5,37,176,113,43,176,2,23,56,176,0,82,176,2,37,176,1,82,90,88,176,4,37,176,6,37,73,176,3,37,176,5,37,73,96,32,176,64,82,88,33,27,176,0,82,88,32,176,2,84,88,176,4,37,176,4,37,176,7,37,176,7,37,73,176,2,23,56,27,176,4,37,176,4,37,176,4,37,176,6,37,73,176,2,23,56,89,89,89,89,89,33,33,33,33,33,45,44,185,0,93,16,0,176,11,37,99,86,96,43,176,7,37,176,7,37,176,6,37,176,6,37,176,12,37,176,12,37,176,9,37,176,8,37,176,110,43,176,4,23,56,176,7,37,176,7,37,176,7,38,176,109,43,176,4,37,176,4,37,176,4,38,176,109,43,176,80,43,176,6,37,176,6,37,176,3,37,176,113,43,176,5,37,176,5,37,176,3,37,176,2,23,56,32,176,6,37,176,6,37,176,5,37,176,113,43,96,176,6,37,176,6,37,176,4,37,101,176,2,23,56,176,2,37,176,2,37,96,32,176,64,83,88,33,176,64,97,35,176,64,97,35,27,184,255,192,80,88,176,64,96,35,176,64,96,35,89,89,176,8,37,176,8,37,176,4,38,176,2,23,56,176,5,37,176,5,37,138,176,2,23,56,32,176,0,82,88,176,6,37,176,8,37,73,176,3,37,176,5,37,73,96,32,176,64,82,88,33,27,176,0,82,88,176,6,37,176,6,37,176,6,37,176,6,37,176,11,37,176,11,37,73,176,4,23,56,176,6,37,176,6,37,176,6,37,176,6,37,176,10,37,176,10,37,176,7,37,176,113,43,176,4,23,56,176,4,37,176,4,37,176,5,37,176,7,37,176,5,37,176,113,43,176,2,23,56,27,176,4,37,176,4,37,184,255,192,176,2,23,56,89,89,89,33,33,33,33,33,33,33,33,45,44,176,4,37,176,3,37,135,176,3,37,176,3,37,138,32,176,0,80,88,33,176,101,27,176,104,89,43,100,176,4,37,176,4,37,6,176,4,37,176,4,37,73,32,32,99,176,3,37,32,99,81,177,0,3,37,84,91,88,33,33,35,33,7,27,32,99,176,2,37,32,99,97,32,176,83,43,138,99,176,5,37,176,5,37,135,176,4,37,176,4,38,74,176,0,80,88,101,89,176,4,38,32,1,70,35,0,70,176,5,38,32,1,70,35,0,70,176,0,22,0,176,0,35,72,1,176,0,35,72,0,32,176,1,35,72,176,2,35,72,1,32,176,1,35,72,176,2,35,72,35,178,2,0,1,8,35,56,178,2,0,1,9,35,56,177,2,1,7,176,1,22,89,45,44,35,16,13,12,138,99,35,138,99,96,100,185,64,0,4,0,99,80,88,176,0,56,27,60,89,45,44,176,6,37,176,9,37,176,9,37,176,7,38,176,118,43,35,176,0,84,88,5,27,4,89,176,4,37,176,6,38,176,119,43,176,5,37,176,5,38,176,5,37,176,5,38,176,118,43,176,0,84,88,5,27,4,89,176,119,43,45,44,176,7,37,176,10,37,176,10,37,176,8,38,176,118,43,138,176,0,84,88,5,27,4,89,176,5,37,176,7,38,176,119,43,176,6,37,176,6,38,176,6,37,176,6,38,176,118,43,8,176,119,43,45,44,176,7,37,176,10,37,176,10,37,176,8,38,176,118,43,138,138,8,176,4,37,176,6,38,176,119,43,176,5,37,176,5,38,176,5,37,176,5,38,176,118,43,176,0,84,88,5,27,4,89,176,119,43,45,44,176,8,37,176,11,37,176,11,37,176,9,38,176,118,43,176,4,38,176,4,38,8,176,5,37,176,7,38,176,119,43,176,6,37,176,6,38,176,6,37,176,6,38,176,118,43,8,176,119,43,45,44,3,176,3,37,176,3,37,74,176,4,37,176,3,37,74,2,176,5,37,176,5,38,74,176,5,38,176,5,38,74,176,4,38,99,138,138,99,97,45,44,177,93,14,37,96,43,176,12,38,17,176,5,38,18,176,10,37,57,176,7,37,57,176,10,37,176,10,37,176,9,37,176,124,43,176,0,80,176,11,37,176,8,37,176,10,37,176,124,43,176,0,80,84,88,176,7,37,176,11,37,135,176,4,37,176,4,37,11,176,10,37,16,176,9,37,193,176,2,37,176,2,37,11,176,7,37,16,176,6,37,193,27,176,7,37,176,11,37,176,11,37,184,255,255,176,118,43,176,4,37,176,4,37,11,176,7,37,176,10,37,176,119,43,176,10,37,176,8,37,176,8,37,184,255,255,176,118,43,176,2,37,176,2,37,11,176,10,37,176,7,37,176,119,43,89,176,10,37,70,176,10,37,70,96,176,8,37,70,176,8,37,70,96,176,6,37,176,6,37,11,176,12,37,176,12,37,176,12,38,32,176,0,80,88,33,176,106,27,176,108,89,43,176,4,37,176,4,37,11,176,9,37,176,9,37,176,9,38,32,176,0,80,88,33,176,106,27,176,108,89,43,35,176,10,37,70,176,10,37,70,96,97,176,32,99,35,176,8,37,70,176,8,37,70,96,97,176,32,99,177,1,12,37,84,88,4,27,5,89,176,10,38,32,16,176,3,37,58,176,6,38,176,6,38,11,176,7,38,32,16,138,58,177,1,7,38,84,88,4,27,5,89,176,5,38,32,16,176,2,37,58,138,138,11,35,32,16,35,58,45,44,35,176,1,84,88,185,0,0,64,0,27,184,64,0,176,0,89,138,176,1,84,88,185,0,0,64,0,27,184,64,0,176,0,89,176,125,43,45,44,138,138,8,13,138,176,1,84,88,185,0,0,64,0,27,184,64,0,176,0,89,176,125,43,45,44,8,176,1,84,88,185,0,0,64,0,27,184,64,0,176,0,89,13,176,125,43,45,44,176,4,38,176,4,38,8,13,176,4,38,176,4,38,8,13,176,125,43,45,44,32,1,70,35,0,70,176,10,67,176,11,67,138,99,35,98,97,45,44,176,9,43,176,6,37,46,176,5,37,125,197,176,6,37,176,5,37,176,4,37,32,176,0,80,88,33,176,106,27,176,108,89,43,176,5,37,176,4,37,176,3,37,32,176,0,80,88,33,176,106,27,176,108,89,43,24,176,8,37,176,7,37,176,6,37,176,10,37,176,111,43,176,6,37,176,5,37,176,4,38,32,176,0,80,88,33,176,102,27,176,104,89,43,176,5,37,176,4,37,176,4,38,32,176,0,80,88,33,176,102,27,176,104,89,43,84,88,125,176,4,37,16,176,3,37,197,176,2,37,16,176,1,37,197,176,5,38,33,176,5,38,33,27,176,6,38,176,4,37,176,3,37,176,8,38,176,111,43,89,177,0,2,67,84,88,125,176,2,37,176,130,43,176,5,37,176,130,43,32,32,105,97,176,4,67,1,35,97,176,96,96,32,105,97,176,32,97,32,176,8,38,176,8,38,138,176,2,23,56,138,138,97,32,105,97,97,176,2,23,56,27,33,33,33,33,89,24,45,44,75,82,177,1,2,67,83,90,88,35,16,32,1,60,0,60,27,33,33,89,45,44,35,176,2,37,176,2,37,83,88,32,176,4,37,88,60,27,57,89,176,1,96,184,255,233,28,89,33,33,33,45,44,176,2,37,71,176,2,37,71,84,138,32,32,16,17,176,1,96,138,32,18,176,1,97,176,133,43,45,44,176,4,37,71,176,2,37,71,84,35,32,18,176,1,97,35,32,176,6,38,32,32,16,17,176,1,96,176,6,38,176,133,43,138,138,176,133,43,45,44,176,2,67,84,88,12,2,138,75,83,176,4,38,75,81,90,88,10,56,27,10,33,33,89,27,33,33,33,33,89,45,44,176,152,43,88,12,2,138,75,83,176,4,38,75,81,90,88,10,56,27,10,33,33,89,27,33,33,33,33,89,45,44,32,176,2,67,84,176,1,35,184,0,104,35,120,33,177,0,2,67,184,0,94,35,121,33,176,2,67,35,176,32,32,92,88,33,33,33,176,0,184,0,77,28,89,138,138,32,138,32,138,35,184,16,0,99,86,88,184,16,0,99,86,88,33,33,33,176,1,184,0,48,28,89,27,33,89,176,128,98,32,92,88,33,33,33,176,0,184,0,29,28,89,35,176,128,98,32,92,88,33,33,33,176,0,184,0,12,28,89,138,176,1,97,184,255,171,28,35,33,45,44,32,176,2,67,84,176,1,35,184,0,129,35,120,33,177,0,2,67,184,0,119,35,121,33,177,0,2,67,138,176,32,32,92,88,33,33,33,184,0,103,28,89,138,138,32,138,32,138,35,184,16,0,99,86,88,184,16,0,99,86,88,176,4,38,176,1,91,176,4,38,176,4,38,176,4,38,27,33,33,33,33,184,0,56,176,0,35,28,89,27,33,89,176,4,38,35,176,128,98,32,92,88,138,92,138,90,35,33,35,33,184,0,30,28,89,138,176,128,98,32,92,88,33,33,35,33,184,0,14,28,89,176,4,38,176,1,97,184,255,147,28,35,33,45,64,255,122,60,121,85,121,89,118,56,79,31,117,56,255,31,116,56,171,31,115,54,205,31,114,54,255,31,113,54,171,31,112,55,255,31,111,53,255,31,110,51,94,31,109,51,255,31,108,52,171,31,107,52,255,31,106,50,255,31,105,48,103,31,104,48,255,31,103,48,114,31,102,48,69,31,101,49,255,31,100,49,205,31,99,49,79,31,98,47,94,31,97,47,255,31,96,46,79,31,95,46,171,31,94,46,255,31,93,46,54,31,92,45,255,31,91,44,94,31,90,44,255,31,89,44,103,31,88,43,94,31,87,43,147,31,86,43,255,31,85,42,255,31,84,41,94,31,83,41,171,31,82,41,255,31,81,40,128,31,80,40,255,31,79,40,128,31,78,39,255,31,77,38,255,31,76,37,255,31,75,37,128,31,74,37,64,31,73,36,255,31,72,35,255,31,71,34,171,31,70,34,255,31,69,34,94,31,68,33,147,31,67,33,255,31,66,31,205,31,65,31,255,31,64,31,171,31,63,32,255,31,62,32,103,31,61,30,255,31,60,29,255,31,59,28,114,31,58,28,255,31,57,28,79,31,55,64,194,54,94,31,52,51,79,31,49,48,43,31,41,40,79,31,40,21,27,25,92,39,27,45,31,38,37,64,31,37,14,26,25,92,36,26,49,31,35,25,31,31,34,25,255,31,33,31,103,31,32,31,64,31,31,28,24,22,92,30,24,28,31,29,23,255,31,28,22,255,31,27,50,25,31,91,24,56,22,55,91,26,50,25,31,91,23,56,22,55,91,21,25,62,22,255,90,19,49,18,85,17,49,16,85,18,89,16,89,13,50,12,85,5,50,4,85,12,89,4,89,15,4,127,4,239,4,3,15,255,14,85,11,50,10,85,7,50,6,85,1,95,0,85,14,89,10,89,6,89,207,6,239,6,2,0,89,111,0,127,0,175,0,239,0,4,16,0,1,9,50,8,85,3,50,2,85,8,89,2,89,15,2,127,2,239,2,3,16,0,3,64,64,5,1,184,1,144,176,84,43,75,184,7,255,82,75,176,9,80,91,176,1,136,176,37,83,176,1,136,176,64,81,90,176,6,136,176,0,85,90,91,88,177,1,1,142,89,133,141,141,0,29,66,75,176,144,83,88,178,3,0,0,29,66,89,177,2,2,67,81,88,177,4,3,142,89,66,115,0,43,0,43,43,43,115,115,0,43,115,0,43,0,43,0,43,43,43,43,43,115,0,43,0,43,43,43,0,43,0,43,43,43,1,43,1,43,1,43,1,43,1,43,1,43,0,43,43,1,43,43,43,1,43,43,0,43,0,43,43,43,1,43,43,1,43,0,43,43,1,43,43,43,0,43,43,43,43,43,43,43,43,43,1,43,43,43,43,0,43,43,43,43,43,43,43,43,43,43,43,43,1,43,43,43,43,0,43,43,43,43,43,43,43,43,43,43,1,43,43,43,43,43,43,43,43,0,43,43,43,43,43,43,43,43,43,43,43,43,0,43,43,24,0,6,20,0,11,5,182,0,22,5,182,0,22,4,72,0,20,0,0,255,234,0,0,255,236,0,0,255,234,254,22,255,254,5,182,0,21,0,0,255,235,0,0,0,168,0,170,0,150,0,150,0,166,0,130,0,130,0,171,0,150,0,113,0,159,0,143,0,169,0,166,0,200,0,109,0,138,0,154,0,107,0,142,0,155,0,122,0,164,0,141,1,58,0,132,0,154,0,162,0,138,0,238,0,133,0,120,1,72,0,133,0,122,0,154,0,158,0,170,0,179,0,150,0,113,0,133,0,144,0,153,0,159,0,164,0,169,0,176,0,155,0,166,0,172,0,200,0,109,0,122,0,130,0,138,0,154,0,107,0,130,0,138,0,146,0,155,0,160,0,166,0,122,0,163,0,171,0,175,0,131,0,140,0,152,1,58,0,113,0,128,0,135,0,143,0,155,0,165,0,125,0,134,0,139,0,149,0,155,0,165,0,174,0,238,0,120,0,126,0,136,0,147,1,72,0,121,0,128,0,134,0,139,0,148,0,154,0,167,6,194,3,122,5,10,0,20,255,56,2,158,3,167,0,0,0,22,1,14,0,3,0,1,4,9,0,0,0,172,0,0,0,3,0,1,4,9,0,1,0,18,0,172,0,3,0,1,4,9,0,2,0,14,0,190,0,3,0,1,4,9,0,3,0,54,0,204,0,3,0,1,4,9,0,4,0,34,1,2,0,3,0,1,4,9,0,5,0,26,1,36,0,3,0,1,4,9,0,6,0,32,1,62,0,3,0,1,4,9,0,7,0,164,1,94,0,3,0,1,4,9,0,8,0,42,2,2,0,3,0,1,4,9,0,9,0,40,2,44,0,3,0,1,4,9,0,10,0,66,2,84,0,3,0,1,4,9,0,11,0,62,2,150,0,3,0,1,4,9,0,12,0,60,2,212,0,3,0,1,4,9,0,13,1,34,3,16,0,3,0,1,4,9,0,14,0,52,4,50,0,3,0,1,4,9,0,25,0,26,4,102,0,3,0,1,4,9,1,0,0,12,4,128,0,3,0,1,4,9,1,1,0,10,4,140,0,3,0,1,4,9,1,4,0,14,0,190,0,3,0,1,4,9,1,26,0,12,4,150,0,3,0,1,4,9,1,28,0,12,4,162,0,3,0,1,4,9,1,29,0,10,4,174,0,67,0,111,0,112,0,121,0,114,0,105,0,103,0,104,0,116,0,32,0,50,0,48,0,50,0,48,0,32,0,84,0,104,0,101,0,32,0,79,0,112,0,101,0,110,0,32,0,83,0,97,0,110,0,115,0,32,0,80,0,114,0,111,0,106,0,101,0,99,0,116,0,32,0,65,0,117,0,116,0,104,0,111,0,114,0,115,0,32,0,40,0,104,0,116,0,116,0,112,0,115,0,58,0,47,0,47,0,103,0,105,0,116,0,104,0,117,0,98,0,46,0,99,0,111,0,109,0,47,0,103,0,111,0,111,0,103,0,108,0,101,0,102,0,111,0,110,0,116,0,115,0,47,0,111,0,112,0,101,0,110,0,115,0,97,0,110,0,115,0,41,0,79,0,112,0,101,0,110,0,32,0,83,0,97,0,110,0,115,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,51,0,46,0,48,0,48,0,48,0,59,0,71,0,79,0,79,0,71,0,59,0,79,0,112,0,101,0,110,0,83,0,97,0,110,0,115,0,45,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,79,0,112,0,101,0,110,0,32,0,83,0,97,0,110,0,115,0,32,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,51,0,46,0,48,0,48,0,48,0,79,0,112,0,101,0,110,0,83,0,97,0,110,0,115,0,45,0,82,0,101,0,103,0,117,0,108,0,97,0,114,0,79,0,112,0,101,0,110,0,32,0,83,0,97,0,110,0,115,0,32,0,105,0,115,0,32,0,97,0,32,0,116,0,114,0,97,0,100,0,101,0,109,0,97,0,114,0,107,0,32,0,111,0,102,0,32,0,71,0,111,0,111,0,103,0,108,0,101,0,32,0,97,0,110,0,100,0,32,0,109,0,97,0,121,0,32,0,98,0,101,0,32,0,114,0,101,0,103,0,105,0,115,0,116,0,101,0,114,0,101,0,100,0,32,0,105,0,110,0,32,0,99,0,101,0,114,0,116,0,97,0,105,0,110,0,32,0,106,0,117,0,114,0,105,0,115,0,100,0,105,0,99,0,116,0,105,0,111,0,110,0,115,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,73,0,109,0,97,0,103,0,105,0,110,0,103,0,32,0,73,0,110,0,99,0,46,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,68,0,101,0,115,0,105,0,103,0,110,0,32,0,84,0,101,0,97,0,109,0,68,0,101,0,115,0,105,0,103,0,110,0,101,0,100,0,32,0,98,0,121,0,32,0,77,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,32,0,100,0,101,0,115,0,105,0,103,0,110,0,32,0,116,0,101,0,97,0,109,0,46,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,103,0,111,0,111,0,103,0,108,0,101,0,46,0,99,0,111,0,109,0,47,0,103,0,101,0,116,0,47,0,110,0,111,0,116,0,111,0,47,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,119,0,119,0,119,0,46,0,109,0,111,0,110,0,111,0,116,0,121,0,112,0,101,0,46,0,99,0,111,0,109,0,47,0,115,0,116,0,117,0,100,0,105,0,111,0,84,0,104,0,105,0,115,0,32,0,70,0,111,0,110,0,116,0,32,0,83,0,111,0,102,0,116,0,119,0,97,0,114,0,101,0,32,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,100,0,32,0,117,0,110,0,100,0,101,0,114,0,32,0,116,0,104,0,101,0,32,0,83,0,73,0,76,0,32,0,79,0,112,0,101,0,110,0,32,0,70,0,111,0,110,0,116,0,32,0,76,0,105,0,99,0,101,0,110,0,115,0,101,0,44,0,32,0,86,0,101,0,114,0,115,0,105,0,111,0,110,0,32,0,49,0,46,0,49,0,46,0,32,0,84,0,104,0,105,0,115,0,32,0,108,0,105,0,99,0,101,0,110,0,115,0,101,0,32,0,105,0,115,0,32,0,97,0,118,0,97,0,105,0,108,0,97,0,98,0,108,0,101,0,32,0,119,0,105,0,116,0,104,0,32,0,97,0,32,0,70,0,65,0,81,0,32,0,97,0,116,0,58,0,32,0,104,0,116,0,116,0,112,0,115,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,104,0,116,0,116,0,112,0,58,0,47,0,47,0,115,0,99,0,114,0,105,0,112,0,116,0,115,0,46,0,115,0,105,0,108,0,46,0,111,0,114,0,103,0,47,0,79,0,70,0,76,0,79,0,112,0,101,0,110,0,83,0,97,0,110,0,115,0,82,0,111,0,109,0,97,0,110,0,87,0,101,0,105,0,103,0,104,0,116,0,87,0,105,0,100,0,116,0,104,0,78,0,111,0,114,0,109,0,97,0,108,0,73,0,116,0,97,0,108,0,105,0,99,0,82,0,111,0,109,0,97,0,110,0,0,0,2,0,0,0,0,0,0,255,156,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,4,116,0,0,1,2,1,3,0,3,0,4,0,5,0,6,0,7,0,8,0,9,0,10,0,11,0,12,0,13,0,14,0,15,0,16,0,17,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,32,0,33,0,34,0,35,0,36,0,37,0,38,0,39,0,40,0,41,0,42,0,43,0,44,0,45,0,46,0,47,0,48,0,49,0,50,0,51,0,52,0,53,0,54,0,55,0,56,0,57,0,58,0,59,0,60,0,61,0,62,0,63,0,64,0,65,0,66,0,67,0,68,0,69,0,70,0,71,0,72,0,73,0,74,0,75,0,76,0,77,0,78,0,79,0,80,0,81,0,82,0,83,0,84,0,85,0,86,0,87,0,88,0,89,0,90,0,91,0,92,0,93,0,94,0,95,0,96,0,97,1,4,0,163,0,132,0,133,0,189,0,150,0,232,0,134,0,142,0,139,0,157,0,169,0,164,1,5,0,138,1,6,0,131,0,147,1,7,1,8,0,141,1,9,0,136,0,195,0,222,1,10,0,158,0,170,0,245,0,244,0,246,0,162,0,173,0,201,0,199,0,174,0,98,0,99,0,144,0,100,0,203,0,101,0,200,0,202,0,207,0,204,0,205,0,206,0,233,0,102,0,211,0,208,0,209,0,175,0,103,0,240,0,145,0,214,0,212,0,213,0,104,0,235,0,237,0,137,0,106,0,105,0,107,0,109,0,108,0,110,0,160,0,111,0,113,0,112,0,114,0,115,0,117,0,116,0,118,0,119,0,234,0,120,0,122,0,121,0,123,0,125,0,124,0,184,0,161,0,127,0,126,0,128,0,129,0,236,0,238,0,186,1,11,1,12,1,13,1,14,1,15,1,16,0,253,0,254,1,17,1,18,1,19,1,20,0,255,1,0,1,21,1,22,1,23,1,1,1,24,1,25,1,26,1,27,1,28,1,29,1,30,1,31,1,32,1,33,1,34,1,35,0,248,0,249,1,36,1,37,1,38,1,39,1,40,1,41,1,42,1,43,1,44,1,45,1,46,1,47,1,48,1,49,1,50,1,51,0,250,1,52,1,53,1,54,1,55,1,56,1,57,1,58,1,59,1,60,1,61,1,62,1,63,1,64,1,65,1,66,0,226,0,227,1,67,1,68,1,69,1,70,1,71,1,72,1,73,1,74,1,75,1,76,1,77,1,78,1,79,1,80,1,81,0,176,0,177,1,82,1,83,1,84,1,85,1,86,1,87,1,88,1,89,1,90,1,91,0,251,0,252,0,228,0,229,1,92,1,93,1,94,1,95,1,96,1,97,1,98,1,99,1,100,1,101,1,102,1,103,1,104,1,105,1,106,1,107,1,108,1,109,1,110,1,111,1,112,1,113,0,187,1,114,1,115,1,116,1,117,0,230,0,231,1,118,0,166,1,119,1,120,1,121,1,122,1,123,1,124,1,125,1,126,0,216,0,225,0,218,0,219,0,220,0,221,0,224,0,217,0,223,1,127,1,128,1,129,1,130,1,131,1,132,1,133,1,134,1,135,1,136,1,137,1,138,1,139,1,140,1,141,1,142,1,143,1,144,1,145,1,146,1,147,1,148,1,149,1,150,1,151,1,152,1,153,1,154,1,155,1,156,1,157,1,158,1,159,1,160,1,161,1,162,1,163,1,164,1,165,1,166,1,167,1,168,1,169,1,170,1,171,1,172,1,173,1,174,1,175,1,176,1,177,1,178,1,179,1,180,1,181,1,182,1,183,0,155,1,184,1,185,1,186,1,187,1,188,1,189,1,190,1,191,1,192,1,193,1,194,1,195,1,196,1,197,1,198,1,199,1,200,1,201,1,202,1,203,1,204,1,205,1,206,1,207,1,208,1,209,1,210,1,211,1,212,1,213,1,214,1,215,1,216,1,217,1,218,1,219,1,220,1,221,1,222,1,223,1,224,1,225,1,226,1,227,1,228,1,229,1,230,1,231,1,232,1,233,1,234,1,235,1,236,1,237,1,238,1,239,1,240,1,241,1,242,1,243,1,244,1,245,1,246,1,247,1,248,1,249,1,250,1,251,1,252,1,253,1,254,1,255,2,0,2,1,2,2,2,3,2,4,2,5,2,6,2,7,2,8,2,9,2,10,2,11,2,12,2,13,2,14,2,15,2,16,2,17,2,18,2,19,2,20,2,21,2,22,2,23,2,24,2,25,2,26,2,27,2,28,2,29,2,30,2,31,2,32,2,33,2,34,2,35,2,36,2,37,2,38,2,39,2,40,2,41,2,42,2,43,0,178,0,179,2,44,2,45,0,182,0,183,0,196,2,46,0,180,0,181,0,197,0,130,0,194,0,135,0,171,0,198,2,47,2,48,0,190,0,191,2,49,0,188,2,50,0,247,2,51,2,52,2,53,2,54,2,55,2,56,0,140,2,57,2,58,2,59,2,60,2,61,2,62,0,152,2,63,0,154,0,153,0,239,0,165,0,146,0,156,0,167,0,143,0,148,0,149,0,185,2,64,2,65,2,66,2,67,2,68,2,69,2,70,2,71,2,72,2,73,2,74,2,75,2,76,2,77,2,78,2,79,2,80,2,81,2,82,2,83,2,84,2,85,2,86,2,87,2,88,2,89,2,90,2,91,2,92,2,93,2,94,2,95,2,96,2,97,2,98,2,99,2,100,2,101,2,102,2,103,2,104,2,105,2,106,2,107,2,108,2,109,2,110,2,111,2,112,2,113,2,114,2,115,2,116,2,117,2,118,2,119,2,120,2,121,2,122,2,123,2,124,2,125,2,126,2,127,2,128,2,129,2,130,2,131,2,132,2,133,2,134,2,135,2,136,2,137,2,138,2,139,2,140,2,141,2,142,2,143,2,144,2,145,2,146,2,147,2,148,2,149,2,150,2,151,2,152,2,153,2,154,2,155,2,156,2,157,2,158,2,159,2,160,2,161,2,162,2,163,2,164,2,165,2,166,2,167,2,168,2,169,2,170,2,171,2,172,2,173,2,174,2,175,2,176,2,177,2,178,2,179,2,180,2,181,2,182,2,183,2,184,2,185,2,186,2,187,2,188,2,189,2,190,2,191,2,192,2,193,2,194,2,195,2,196,2,197,2,198,2,199,2,200,2,201,2,202,2,203,2,204,2,205,2,206,2,207,2,208,2,209,2,210,2,211,2,212,2,213,2,214,2,215,2,216,2,217,2,218,2,219,2,220,2,221,2,222,2,223,2,224,2,225,2,226,2,227,2,228,2,229,2,230,2,231,2,232,2,233,2,234,2,235,2,236,2,237,2,238,2,239,2,240,2,241,2,242,2,243,2,244,2,245,2,246,2,247,2,248,2,249,2,250,2,251,2,252,2,253,2,254,2,255,3,0,3,1,3,2,3,3,3,4,3,5,3,6,3,7,3,8,3,9,3,10,3,11,3,12,3,13,3,14,3,15,3,16,3,17,3,18,3,19,3,20,3,21,3,22,3,23,3,24,3,25,3,26,3,27,3,28,3,29,3,30,3,31,3,32,3,33,3,34,3,35,3,36,3,37,3,38,3,39,3,40,3,41,3,42,3,43,3,44,3,45,3,46,3,47,3,48,3,49,3,50,3,51,3,52,3,53,3,54,3,55,3,56,3,57,3,58,3,59,3,60,3,61,3,62,3,63,3,64,3,65,3,66,3,67,3,68,3,69,3,70,3,71,3,72,3,73,3,74,3,75,3,76,3,77,3,78,3,79,3,80,3,81,3,82,3,83,3,84,3,85,3,86,3,87,3,88,3,89,3,90,3,91,3,92,3,93,3,94,3,95,3,96,3,97,3,98,3,99,3,100,3,101,3,102,3,103,3,104,3,105,3,106,3,107,3,108,3,109,3,110,3,111,3,112,3,113,3,114,3,115,3,116,3,117,3,118,3,119,3,120,3,121,3,122,3,123,3,124,3,125,3,126,3,127,3,128,3,129,3,130,3,131,3,132,3,133,3,134,3,135,3,136,3,137,3,138,3,139,3,140,3,141,3,142,3,143,3,144,3,145,3,146,3,147,3,148,3,149,3,150,3,151,0,192,0,193,3,152,3,153,3,154,3,155,3,156,3,157,3,158,3,159,3,160,3,161,3,162,3,163,3,164,3,165,3,166,3,167,3,168,3,169,3,170,3,171,3,172,3,173,3,174,3,175,3,176,3,177,3,178,3,179,3,180,3,181,3,182,3,183,3,184,3,185,0,215,3,186,3,187,3,188,3,189,3,190,3,191,3,192,3,193,3,194,3,195,3,196,3,197,3,198,3,199,3,200,3,201,3,202,3,203,3,204,3,205,3,206,3,207,3,208,3,209,3,210,3,211,3,212,3,213,3,214,3,215,3,216,3,217,3,218,3,219,3,220,3,221,3,222,3,223,3,224,3,225,3,226,3,227,3,228,3,229,3,230,3,231,3,232,3,233,3,234,3,235,3,236,3,237,3,238,3,239,3,240,3,241,3,242,3,243,3,244,3,245,3,246,3,247,3,248,3,249,3,250,3,251,3,252,3,253,3,254,3,255,4,0,4,1,4,2,4,3,4,4,4,5,4,6,4,7,4,8,4,9,4,10,4,11,4,12,4,13,4,14,4,15,4,16,4,17,4,18,4,19,4,20,4,21,4,22,4,23,4,24,4,25,4,26,4,27,4,28,4,29,4,30,4,31,4,32,4,33,4,34,4,35,4,36,4,37,4,38,4,39,4,40,4,41,4,42,4,43,4,44,4,45,4,46,4,47,4,48,4,49,4,50,4,51,4,52,4,53,4,54,4,55,4,56,4,57,4,58,4,59,4,60,4,61,4,62,4,63,4,64,4,65,4,66,4,67,4,68,4,69,4,70,4,71,4,72,4,73,4,74,4,75,4,76,4,77,4,78,4,79,4,80,4,81,4,82,4,83,4,84,4,85,4,86,4,87,4,88,4,89,4,90,4,91,4,92,4,93,4,94,4,95,4,96,4,97,4,98,4,99,4,100,4,101,4,102,4,103,4,104,4,105,4,106,4,107,4,108,4,109,4,110,4,111,4,112,4,113,4,114,4,115,4,116,4,117,4,118,4,119,4,120,4,121,4,122,4,123,4,124,4,125,4,78,85,76,76,2,67,82,7,117,110,105,48,48,65,48,7,117,110,105,48,48,65,68,9,111,118,101,114,115,99,111,114,101,7,117,110,105,48,48,66,50,7,117,110,105,48,48,66,51,7,117,110,105,48,48,66,53,7,117,110,105,48,48,66,57,7,65,109,97,99,114,111,110,7,97,109,97,99,114,111,110,6,65,98,114,101,118,101,6,97,98,114,101,118,101,7,65,111,103,111,110,101,107,7,97,111,103,111,110,101,107,11,67,99,105,114,99,117,109,102,108,101,120,11,99,99,105,114,99,117,109,102,108,101,120,4,67,100,111,116,4,99,100,111,116,6,68,99,97,114,111,110,6,100,99,97,114,111,110,6,68,99,114,111,97,116,7,69,109,97,99,114,111,110,7,101,109,97,99,114,111,110,6,69,98,114,101,118,101,6,101,98,114,101,118,101,10,69,100,111,116,97,99,99,101,110,116,10,101,100,111,116,97,99,99,101,110,116,7,69,111,103,111,110,101,107,7,101,111,103,111,110,101,107,6,69,99,97,114,111,110,6,101,99,97,114,111,110,11,71,99,105,114,99,117,109,102,108,101,120,11,103,99,105,114,99,117,109,102,108,101,120,4,71,100,111,116,4,103,100,111,116,7,117,110,105,48,49,50,50,7,117,110,105,48,49,50,51,11,72,99,105,114,99,117,109,102,108,101,120,11,104,99,105,114,99,117,109,102,108,101,120,4,72,98,97,114,4,104,98,97,114,6,73,116,105,108,100,101,6,105,116,105,108,100,101,7,73,109,97,99,114,111,110,7,105,109,97,99,114,111,110,6,73,98,114,101,118,101,6,105,98,114,101,118,101,7,73,111,103,111,110,101,107,7,105,111,103,111,110,101,107,2,73,74,2,105,106,11,74,99,105,114,99,117,109,102,108,101,120,11,106,99,105,114,99,117,109,102,108,101,120,7,117,110,105,48,49,51,54,7,117,110,105,48,49,51,55,12,107,103,114,101,101,110,108,97,110,100,105,99,6,76,97,99,117,116,101,6,108,97,99,117,116,101,7,117,110,105,48,49,51,66,7,117,110,105,48,49,51,67,6,76,99,97,114,111,110,6,108,99,97,114,111,110,4,76,100,111,116,4,108,100,111,116,6,78,97,99,117,116,101,6,110,97,99,117,116,101,7,117,110,105,48,49,52,53,7,117,110,105,48,49,52,54,6,78,99,97,114,111,110,6,110,99,97,114,111,110,11,110,97,112,111,115,116,114,111,112,104,101,3,69,110,103,3,101,110,103,7,79,109,97,99,114,111,110,7,111,109,97,99,114,111,110,6,79,98,114,101,118,101,6,111,98,114,101,118,101,13,79,104,117,110,103,97,114,117,109,108,97,117,116,13,111,104,117,110,103,97,114,117,109,108,97,117,116,6,82,97,99,117,116,101,6,114,97,99,117,116,101,7,117,110,105,48,49,53,54,7,117,110,105,48,49,53,55,6,82,99,97,114,111,110,6,114,99,97,114,111,110,6,83,97,99,117,116,101,6,115,97,99,117,116,101,11,83,99,105,114,99,117,109,102,108,101,120,11,115,99,105,114,99,117,109,102,108,101,120,7,117,110,105,48,50,49,65,7,117,110,105,48,50,49,66,6,84,99,97,114,111,110,6,116,99,97,114,111,110,4,84,98,97,114,4,116,98,97,114,6,85,116,105,108,100,101,6,117,116,105,108,100,101,7,85,109,97,99,114,111,110,7,117,109,97,99,114,111,110,6,85,98,114,101,118,101,6,117,98,114,101,118,101,5,85,114,105,110,103,5,117,114,105,110,103,13,85,104,117,110,103,97,114,117,109,108,97,117,116,13,117,104,117,110,103,97,114,117,109,108,97,117,116,7,85,111,103,111,110,101,107,7,117,111,103,111,110,101,107,11,87,99,105,114,99,117,109,102,108,101,120,11,119,99,105,114,99,117,109,102,108,101,120,11,89,99,105,114,99,117,109,102,108,101,120,11,121,99,105,114,99,117,109,102,108,101,120,6,90,97,99,117,116,101,6,122,97,99,117,116,101,10,90,100,111,116,97,99,99,101,110,116,10,122,100,111,116,97,99,99,101,110,116,5,108,111,110,103,115,10,65,114,105,110,103,97,99,117,116,101,10,97,114,105,110,103,97,99,117,116,101,7,65,69,97,99,117,116,101,7,97,101,97,99,117,116,101,11,79,115,108,97,115,104,97,99,117,116,101,11,111,115,108,97,115,104,97,99,117,116,101,7,117,110,105,48,50,49,56,7,117,110,105,48,50,49,57,5,116,111,110,111,115,13,100,105,101,114,101,115,105,115,116,111,110,111,115,10,65,108,112,104,97,116,111,110,111,115,9,97,110,111,116,101,108,101,105,97,12,69,112,115,105,108,111,110,116,111,110,111,115,8,69,116,97,116,111,110,111,115,9,73,111,116,97,116,111,110,111,115,12,79,109,105,99,114,111,110,116,111,110,111,115,12,85,112,115,105,108,111,110,116,111,110,111,115,10,79,109,101,103,97,116,111,110,111,115,17,105,111,116,97,100,105,101,114,101,115,105,115,116,111,110,111,115,5,65,108,112,104,97,4,66,101,116,97,5,71,97,109,109,97,7,117,110,105,48,51,57,52,7,69,112,115,105,108,111,110,4,90,101,116,97,3,69,116,97,5,84,104,101,116,97,4,73,111,116,97,5,75,97,112,112,97,6,76,97,109,98,100,97,2,77,117,2,78,117,2,88,105,7,79,109,105,99,114,111,110,2,80,105,3,82,104,111,5,83,105,103,109,97,3,84,97,117,7,85,112,115,105,108,111,110,3,80,104,105,3,67,104,105,3,80,115,105,7,117,110,105,48,51,65,57,12,73,111,116,97,100,105,101,114,101,115,105,115,15,85,112,115,105,108,111,110,100,105,101,114,101,115,105,115,10,97,108,112,104,97,116,111,110,111,115,12,101,112,115,105,108,111,110,116,111,110,111,115,8,101,116,97,116,111,110,111,115,9,105,111,116,97,116,111,110,111,115,20,117,112,115,105,108,111,110,100,105,101,114,101,115,105,115,116,111,110,111,115,5,97,108,112,104,97,4,98,101,116,97,5,103,97,109,109,97,5,100,101,108,116,97,7,101,112,115,105,108,111,110,4,122,101,116,97,3,101,116,97,5,116,104,101,116,97,4,105,111,116,97,5,107,97,112,112,97,6,108,97,109,98,100,97,7,117,110,105,48,51,66,67,2,110,117,2,120,105,7,111,109,105,99,114,111,110,3,114,104,111,7,117,110,105,48,51,67,50,5,115,105,103,109,97,3,116,97,117,7,117,112,115,105,108,111,110,3,112,104,105,3,99,104,105,3,112,115,105,5,111,109,101,103,97,12,105,111,116,97,100,105,101,114,101,115,105,115,15,117,112,115,105,108,111,110,100,105,101,114,101,115,105,115,12,111,109,105,99,114,111,110,116,111,110,111,115,12,117,112,115,105,108,111,110,116,111,110,111,115,10,111,109,101,103,97,116,111,110,111,115,7,117,110,105,48,52,48,49,7,117,110,105,48,52,48,50,7,117,110,105,48,52,48,51,7,117,110,105,48,52,48,52,7,117,110,105,48,52,48,53,7,117,110,105,48,52,48,54,7,117,110,105,48,52,48,55,7,117,110,105,48,52,48,56,7,117,110,105,48,52,48,57,7,117,110,105,48,52,48,65,7,117,110,105,48,52,48,66,7,117,110,105,48,52,48,67,7,117,110,105,48,52,48,69,7,117,110,105,48,52,48,70,7,117,110,105,48,52,49,48,7,117,110,105,48,52,49,49,7,117,110,105,48,52,49,50,7,117,110,105,48,52,49,51,7,117,110,105,48,52,49,52,7,117,110,105,48,52,49,53,7,117,110,105,48,52,49,54,7,117,110,105,48,52,49,55,7,117,110,105,48,52,49,56,7,117,110,105,48,52,49,57,7,117,110,105,48,52,49,65,7,117,110,105,48,52,49,66,7,117,110,105,48,52,49,67,7,117,110,105,48,52,49,68,7,117,110,105,48,52,49,69,7,117,110,105,48,52,49,70,7,117,110,105,48,52,50,48,7,117,110,105,48,52,50,49,7,117,110,105,48,52,50,50,7,117,110,105,48,52,50,51,7,117,110,105,48,52,50,52,7,117,110,105,48,52,50,53,7,117,110,105,48,52,50,54,7,117,110,105,48,52,50,55,7,117,110,105,48,52,50,56,7,117,110,105,48,52,50,57,7,117,110,105,48,52,50,65,7,117,110,105,48,52,50,66,7,117,110,105,48,52,50,67,7,117,110,105,48,52,50,68,7,117,110,105,48,52,50,69,7,117,110,105,48,52,50,70,7,117,110,105,48,52,51,48,7,117,110,105,48,52,51,49,7,117,110,105,48,52,51,50,7,117,110,105,48,52,51,51,7,117,110,105,48,52,51,52,7,117,110,105,48,52,51,53,7,117,110,105,48,52,51,54,7,117,110,105,48,52,51,55,7,117,110,105,48,52,51,56,7,117,110,105,48,52,51,57,7,117,110,105,48,52,51,65,7,117,110,105,48,52,51,66,7,117,110,105,48,52,51,67,7,117,110,105,48,52,51,68,7,117,110,105,48,52,51,69,7,117,110,105,48,52,51,70,7,117,110,105,48,52,52,48,7,117,110,105,48,52,52,49,7,117,110,105,48,52,52,50,7,117,110,105,48,52,52,51,7,117,110,105,48,52,52,52,7,117,110,105,48,52,52,53,7,117,110,105,48,52,52,54,7,117,110,105,48,52,52,55,7,117,110,105,48,52,52,56,7,117,110,105,48,52,52,57,7,117,110,105,48,52,52,65,7,117,110,105,48,52,52,66,7,117,110,105,48,52,52,67,7,117,110,105,48,52,52,68,7,117,110,105,48,52,52,69,7,117,110,105,48,52,52,70,7,117,110,105,48,52,53,49,7,117,110,105,48,52,53,50,7,117,110,105,48,52,53,51,7,117,110,105,48,52,53,52,7,117,110,105,48,52,53,53,7,117,110,105,48,52,53,54,7,117,110,105,48,52,53,55,7,117,110,105,48,52,53,56,7,117,110,105,48,52,53,57,7,117,110,105,48,52,53,65,7,117,110,105,48,52,53,66,7,117,110,105,48,52,53,67,7,117,110,105,48,52,53,69,7,117,110,105,48,52,53,70,7,117,110,105,48,52,57,48,7,117,110,105,48,52,57,49,6,87,103,114,97,118,101,6,119,103,114,97,118,101,6,87,97,99,117,116,101,6,119,97,99,117,116,101,9,87,100,105,101,114,101,115,105,115,9,119,100,105,101,114,101,115,105,115,6,89,103,114,97,118,101,6,121,103,114,97,118,101,7,117,110,105,50,48,49,53,13,117,110,100,101,114,115,99,111,114,101,100,98,108,13,113,117,111,116,101,114,101,118,101,114,115,101,100,6,109,105,110,117,116,101,6,115,101,99,111,110,100,9,101,120,99,108,97,109,100,98,108,7,117,110,105,50,48,55,70,9,97,102,105,105,48,56,57,52,49,6,112,101,115,101,116,97,4,69,117,114,111,7,117,110,105,50,49,48,53,7,117,110,105,50,49,49,51,7,117,110,105,50,49,49,54,7,117,110,105,50,49,50,54,9,101,115,116,105,109,97,116,101,100,9,111,110,101,101,105,103,104,116,104,12,116,104,114,101,101,101,105,103,104,116,104,115,11,102,105,118,101,101,105,103,104,116,104,115,12,115,101,118,101,110,101,105,103,104,116,104,115,7,117,110,105,50,50,48,54,13,99,121,114,105,108,108,105,99,98,114,101,118,101,16,99,97,114,111,110,99,111,109,109,97,97,99,99,101,110,116,7,117,110,105,48,51,50,54,17,99,111,109,109,97,97,99,99,101,110,116,114,111,116,97,116,101,7,117,110,105,50,48,55,52,7,117,110,105,50,48,55,53,7,117,110,105,50,48,55,55,7,117,110,105,50,48,55,56,7,117,110,105,50,48,48,48,7,117,110,105,50,48,48,49,7,117,110,105,50,48,48,50,7,117,110,105,50,48,48,51,7,117,110,105,50,48,48,52,7,117,110,105,50,48,48,53,7,117,110,105,50,48,48,54,7,117,110,105,50,48,48,55,7,117,110,105,50,48,48,56,7,117,110,105,50,48,48,57,7,117,110,105,50,48,48,65,7,117,110,105,50,48,48,66,7,117,110,105,70,69,70,70,7,117,110,105,70,70,70,67,7,117,110,105,70,70,70,68,7,117,110,105,48,49,70,48,7,117,110,105,48,50,66,67,7,117,110,105,48,51,68,49,7,117,110,105,48,51,68,50,7,117,110,105,48,51,68,54,7,117,110,105,49,69,51,69,7,117,110,105,49,69,51,70,7,117,110,105,49,69,48,48,7,117,110,105,49,69,48,49,7,117,110,105,48,50,70,51,5,79,104,111,114,110,5,111,104,111,114,110,5,85,104,111,114,110,5,117,104,111,114,110,4,104,111,111,107,7,117,110,105,48,52,48,48,7,117,110,105,48,52,48,68,7,117,110,105,48,52,53,48,7,117,110,105,48,52,53,68,7,117,110,105,48,52,54,48,7,117,110,105,48,52,54,49,7,117,110,105,48,52,54,50,7,117,110,105,48,52,54,51,7,117,110,105,48,52,54,52,7,117,110,105,48,52,54,53,7,117,110,105,48,52,54,54,7,117,110,105,48,52,54,55,7,117,110,105,48,52,54,56,7,117,110,105,48,52,54,57,7,117,110,105,48,52,54,65,7,117,110,105,48,52,54,66,7,117,110,105,48,52,54,67,7,117,110,105,48,52,54,68,7,117,110,105,48,52,54,69,7,117,110,105,48,52,54,70,7,117,110,105,48,52,55,48,7,117,110,105,48,52,55,49,7,117,110,105,48,52,55,50,7,117,110,105,48,52,55,51,7,117,110,105,48,52,55,52,7,117,110,105,48,52,55,53,7,117,110,105,48,52,55,54,7,117,110,105,48,52,55,55,7,117,110,105,48,52,55,56,7,117,110,105,48,52,55,57,7,117,110,105,48,52,55,65,7,117,110,105,48,52,55,66,7,117,110,105,48,52,55,67,7,117,110,105,48,52,55,68,7,117,110,105,48,52,55,69,7,117,110,105,48,52,55,70,7,117,110,105,48,52,56,48,7,117,110,105,48,52,56,49,7,117,110,105,48,52,56,50,7,117,110,105,48,52,56,56,7,117,110,105,48,52,56,57,7,117,110,105,48,52,56,65,7,117,110,105,48,52,56,66,7,117,110,105,48,52,56,67,7,117,110,105,48,52,56,68,7,117,110,105,48,52,56,69,7,117,110,105,48,52,56,70,7,117,110,105,48,52,57,50,7,117,110,105,48,52,57,51,7,117,110,105,48,52,57,52,7,117,110,105,48,52,57,53,7,117,110,105,48,52,57,54,7,117,110,105,48,52,57,55,7,117,110,105,48,52,57,56,7,117,110,105,48,52,57,57,7,117,110,105,48,52,57,65,7,117,110,105,48,52,57,66,7,117,110,105,48,52,57,67,7,117,110,105,48,52,57,68,7,117,110,105,48,52,57,69,7,117,110,105,48,52,57,70,7,117,110,105,48,52,65,48,7,117,110,105,48,52,65,49,7,117,110,105,48,52,65,50,7,117,110,105,48,52,65,51,7,117,110,105,48,52,65,52,7,117,110,105,48,52,65,53,7,117,110,105,48,52,65,54,7,117,110,105,48,52,65,55,7,117,110,105,48,52,65,56,7,117,110,105,48,52,65,57,7,117,110,105,48,52,65,65,7,117,110,105,48,52,65,66,7,117,110,105,48,52,65,67,7,117,110,105,48,52,65,68,7,117,110,105,48,52,65,69,7,117,110,105,48,52,65,70,7,117,110,105,48,52,66,48,7,117,110,105,48,52,66,49,7,117,110,105,48,52,66,50,7,117,110,105,48,52,66,51,7,117,110,105,48,52,66,52,7,117,110,105,48,52,66,53,7,117,110,105,48,52,66,54,7,117,110,105,48,52,66,55,7,117,110,105,48,52,66,56,7,117,110,105,48,52,66,57,7,117,110,105,48,52,66,65,7,117,110,105,48,52,66,66,7,117,110,105,48,52,66,67,7,117,110,105,48,52,66,68,7,117,110,105,48,52,66,69,7,117,110,105,48,52,66,70,7,117,110,105,48,52,67,48,7,117,110,105,48,52,67,49,7,117,110,105,48,52,67,50,7,117,110,105,48,52,67,51,7,117,110,105,48,52,67,52,7,117,110,105,48,52,67,53,7,117,110,105,48,52,67,54,7,117,110,105,48,52,67,55,7,117,110,105,48,52,67,56,7,117,110,105,48,52,67,57,7,117,110,105,48,52,67,65,7,117,110,105,48,52,67,66,7,117,110,105,48,52,67,67,7,117,110,105,48,52,67,68,7,117,110,105,48,52,67,69,7,117,110,105,48,52,67,70,7,117,110,105,48,52,68,48,7,117,110,105,48,52,68,49,7,117,110,105,48,52,68,50,7,117,110,105,48,52,68,51,7,117,110,105,48,52,68,52,7,117,110,105,48,52,68,53,7,117,110,105,48,52,68,54,7,117,110,105,48,52,68,55,7,117,110,105,48,52,68,56,7,117,110,105,48,52,68,57,7,117,110,105,48,52,68,65,7,117,110,105,48,52,68,66,7,117,110,105,48,52,68,67,7,117,110,105,48,52,68,68,7,117,110,105,48,52,68,69,7,117,110,105,48,52,68,70,7,117,110,105,48,52,69,48,7,117,110,105,48,52,69,49,7,117,110,105,48,52,69,50,7,117,110,105,48,52,69,51,7,117,110,105,48,52,69,52,7,117,110,105,48,52,69,53,7,117,110,105,48,52,69,54,7,117,110,105,48,52,69,55,7,117,110,105,48,52,69,56,7,117,110,105,48,52,69,57,7,117,110,105,48,52,69,65,7,117,110,105,48,52,69,66,7,117,110,105,48,52,69,67,7,117,110,105,48,52,69,68,7,117,110,105,48,52,69,69,7,117,110,105,48,52,69,70,7,117,110,105,48,52,70,48,7,117,110,105,48,52,70,49,7,117,110,105,48,52,70,50,7,117,110,105,48,52,70,51,7,117,110,105,48,52,70,52,7,117,110,105,48,52,70,53,7,117,110,105,48,52,70,54,7,117,110,105,48,52,70,55,7,117,110,105,48,52,70,56,7,117,110,105,48,52,70,57,7,117,110,105,48,52,70,65,7,117,110,105,48,52,70,66,7,117,110,105,48,52,70,67,7,117,110,105,48,52,70,68,7,117,110,105,48,52,70,69,7,117,110,105,48,52,70,70,7,117,110,105,48,53,48,48,7,117,110,105,48,53,48,49,7,117,110,105,48,53,48,50,7,117,110,105,48,53,48,51,7,117,110,105,48,53,48,52,7,117,110,105,48,53,48,53,7,117,110,105,48,53,48,54,7,117,110,105,48,53,48,55,7,117,110,105,48,53,48,56,7,117,110,105,48,53,48,57,7,117,110,105,48,53,48,65,7,117,110,105,48,53,48,66,7,117,110,105,48,53,48,67,7,117,110,105,48,53,48,68,7,117,110,105,48,53,48,69,7,117,110,105,48,53,48,70,7,117,110,105,48,53,49,48,7,117,110,105,48,53,49,49,7,117,110,105,48,53,49,50,7,117,110,105,48,53,49,51,7,117,110,105,49,69,65,48,7,117,110,105,49,69,65,49,7,117,110,105,49,69,65,50,7,117,110,105,49,69,65,51,7,117,110,105,49,69,65,52,7,117,110,105,49,69,65,53,7,117,110,105,49,69,65,54,7,117,110,105,49,69,65,55,7,117,110,105,49,69,65,56,7,117,110,105,49,69,65,57,7,117,110,105,49,69,65,65,7,117,110,105,49,69,65,66,7,117,110,105,49,69,65,67,7,117,110,105,49,69,65,68,7,117,110,105,49,69,65,69,7,117,110,105,49,69,65,70,7,117,110,105,49,69,66,48,7,117,110,105,49,69,66,49,7,117,110,105,49,69,66,50,7,117,110,105,49,69,66,51,7,117,110,105,49,69,66,52,7,117,110,105,49,69,66,53,7,117,110,105,49,69,66,54,7,117,110,105,49,69,66,55,7,117,110,105,49,69,66,56,7,117,110,105,49,69,66,57,7,117,110,105,49,69,66,65,7,117,110,105,49,69,66,66,7,117,110,105,49,69,66,67,7,117,110,105,49,69,66,68,7,117,110,105,49,69,66,69,7,117,110,105,49,69,66,70,7,117,110,105,49,69,67,48,7,117,110,105,49,69,67,49,7,117,110,105,49,69,67,50,7,117,110,105,49,69,67,51,7,117,110,105,49,69,67,52,7,117,110,105,49,69,67,53,7,117,110,105,49,69,67,54,7,117,110,105,49,69,67,55,7,117,110,105,49,69,67,56,7,117,110,105,49,69,67,57,7,117,110,105,49,69,67,65,7,117,110,105,49,69,67,66,7,117,110,105,49,69,67,67,7,117,110,105,49,69,67,68,7,117,110,105,49,69,67,69,7,117,110,105,49,69,67,70,7,117,110,105,49,69,68,48,7,117,110,105,49,69,68,49,7,117,110,105,49,69,68,50,7,117,110,105,49,69,68,51,7,117,110,105,49,69,68,52,7,117,110,105,49,69,68,53,7,117,110,105,49,69,68,54,7,117,110,105,49,69,68,55,7,117,110,105,49,69,68,56,7,117,110,105,49,69,68,57,7,117,110,105,49,69,68,65,7,117,110,105,49,69,68,66,7,117,110,105,49,69,68,67,7,117,110,105,49,69,68,68,7,117,110,105,49,69,68,69,7,117,110,105,49,69,68,70,7,117,110,105,49,69,69,48,7,117,110,105,49,69,69,49,7,117,110,105,49,69,69,50,7,117,110,105,49,69,69,51,7,117,110,105,49,69,69,52,7,117,110,105,49,69,69,53,7,117,110,105,49,69,69,54,7,117,110,105,49,69,69,55,7,117,110,105,49,69,69,56,7,117,110,105,49,69,69,57,7,117,110,105,49,69,69,65,7,117,110,105,49,69,69,66,7,117,110,105,49,69,69,67,7,117,110,105,49,69,69,68,7,117,110,105,49,69,69,69,7,117,110,105,49,69,69,70,7,117,110,105,49,69,70,48,7,117,110,105,49,69,70,49,7,117,110,105,49,69,70,52,7,117,110,105,49,69,70,53,7,117,110,105,49,69,70,54,7,117,110,105,49,69,70,55,7,117,110,105,49,69,70,56,7,117,110,105,49,69,70,57,7,117,110,105,50,48,65,66,19,99,105,114,99,117,109,102,108,101,120,97,99,117,116,101,99,111,109,98,19,99,105,114,99,117,109,102,108,101,120,103,114,97,118,101,99,111,109,98,18,99,105,114,99,117,109,102,108,101,120,104,111,111,107,99,111,109,98,19,99,105,114,99,117,109,102,108,101,120,116,105,108,100,101,99,111,109,98,14,98,114,101,118,101,97,99,117,116,101,99,111,109,98,14,98,114,101,118,101,103,114,97,118,101,99,111,109,98,13,98,114,101,118,101,104,111,111,107,99,111,109,98,14,98,114,101,118,101,116,105,108,100,101,99,111,109,98,16,99,121,114,105,108,108,105,99,104,111,111,107,108,101,102,116,17,99,121,114,105,108,108,105,99,98,105,103,104,111,111,107,85,67,7,117,110,105,48,49,54,50,7,117,110,105,48,49,54,51,7,117,110,105,48,49,69,65,7,117,110,105,48,49,69,66,7,117,110,105,48,49,69,67,7,117,110,105,48,49,69,68,7,117,110,105,48,50,53,57,13,104,111,111,107,97,98,111,118,101,99,111,109,98,7,117,110,105,49,70,52,68,7,117,110,105,49,70,68,69,7,117,110,105,50,48,55,48,7,117,110,105,50,48,55,54,7,117,110,105,50,48,55,57,19,117,110,105,48,51,66,57,48,51,48,56,48,51,48,52,48,51,48,48,19,117,110,105,48,51,66,57,48,51,48,56,48,51,48,52,48,51,48,49,19,117,110,105,48,51,66,57,48,51,48,56,48,51,48,54,48,51,48,48,19,117,110,105,48,51,66,57,48,51,48,56,48,51,48,54,48,51,48,49,19,117,110,105,48,51,67,53,48,51,48,56,48,51,48,52,48,51,48,48,19,117,110,105,48,51,67,53,48,51,48,56,48,51,48,52,48,51,48,49,19,117,110,105,48,51,67,53,48,51,48,56,48,51,48,54,48,51,48,48,19,117,110,105,48,51,67,53,48,51,48,56,48,51,48,54,48,51,48,49,8,69,110,103,46,97,108,116,49,8,69,110,103,46,97,108,116,50,8,69,110,103,46,97,108,116,51,15,117,110,105,48,51,48,49,48,51,48,54,48,51,48,56,15,117,110,105,48,51,48,48,48,51,48,54,48,51,48,56,15,117,110,105,48,51,48,49,48,51,48,52,48,51,48,56,15,117,110,105,48,51,48,48,48,51,48,52,48,51,48,56,15,99,121,114,105,108,108,105,99,95,111,116,109,97,114,107,3,102,95,102,5,102,95,102,95,105,5,102,95,102,95,108,7,117,110,105,49,69,57,69,7,117,110,105,65,55,66,51,7,117,110,105,65,55,66,52,15,117,110,105,48,49,51,66,46,108,111,99,108,77,65,72,15,117,110,105,48,49,52,53,46,108,111,99,108,77,65,72,15,65,111,103,111,110,101,107,46,108,111,99,108,78,65,86,15,69,111,103,111,110,101,107,46,108,111,99,108,78,65,86,15,73,111,103,111,110,101,107,46,108,111,99,108,78,65,86,15,85,111,103,111,110,101,107,46,108,111,99,108,78,65,86,6,73,46,115,97,108,116,6,74,46,115,97,108,116,11,73,103,114,97,118,101,46,115,97,108,116,11,73,97,99,117,116,101,46,115,97,108,116,16,73,99,105,114,99,117,109,102,108,101,120,46,115,97,108,116,14,73,100,105,101,114,101,115,105,115,46,115,97,108,116,11,73,116,105,108,100,101,46,115,97,108,116,12,73,109,97,99,114,111,110,46,115,97,108,116,11,73,98,114,101,118,101,46,115,97,108,116,12,73,111,103,111,110,101,107,46,115,97,108,116,20,73,111,103,111,110,101,107,95,108,111,99,108,78,65,86,46,115,97,108,116,15,73,100,111,116,97,99,99,101,110,116,46,115,97,108,116,7,73,74,46,115,97,108,116,16,74,99,105,114,99,117,109,102,108,101,120,46,115,97,108,116,12,117,110,105,49,69,67,56,46,115,97,108,116,12,117,110,105,49,69,67,65,46,115,97,108,116,14,73,111,116,97,116,111,110,111,115,46,115,97,108,116,9,73,111,116,97,46,115,97,108,116,17,73,111,116,97,100,105,101,114,101,115,105,115,46,115,97,108,116,12,117,110,105,48,52,48,54,46,115,97,108,116,12,117,110,105,48,52,48,55,46,115,97,108,116,12,117,110,105,48,52,48,56,46,115,97,108,116,12,117,110,105,48,52,67,48,46,115,97,108,116,7,117,110,105,48,50,51,55,7,117,110,105,65,55,66,53,7,117,110,105,65,66,53,51,11,117,110,105,48,49,50,51,46,97,108,116,15,117,110,105,48,49,51,67,46,108,111,99,108,77,65,72,15,117,110,105,48,49,52,54,46,108,111,99,108,77,65,72,15,97,111,103,111,110,101,107,46,108,111,99,108,78,65,86,15,101,111,103,111,110,101,107,46,108,111,99,108,78,65,86,15,105,111,103,111,110,101,107,46,108,111,99,108,78,65,86,15,117,111,103,111,110,101,107,46,108,111,99,108,78,65,86,6,103,46,115,97,108,116,16,103,99,105,114,99,117,109,102,108,101,120,46,115,97,108,116,11,103,98,114,101,118,101,46,115,97,108,116,9,103,100,111,116,46,115,97,108,116,11,102,108,111,114,105,110,46,115,115,48,51,15,117,110,105,48,52,51,49,46,108,111,99,108,83,82,66,12,117,110,105,48,52,67,70,46,115,97,108,116,7,117,110,105,50,48,57,53,7,117,110,105,50,48,57,54,7,117,110,105,50,48,57,55,7,117,110,105,50,48,57,56,7,117,110,105,50,48,57,57,7,117,110,105,50,48,57,65,7,117,110,105,50,48,57,66,7,117,110,105,50,48,57,67,7,117,110,105,48,53,68,48,7,117,110,105,48,53,68,49,7,117,110,105,48,53,68,50,7,117,110,105,48,53,68,51,7,117,110,105,48,53,68,52,7,117,110,105,48,53,68,53,7,117,110,105,48,53,68,54,7,117,110,105,48,53,68,55,7,117,110,105,48,53,68,56,7,117,110,105,48,53,68,57,7,117,110,105,48,53,68,65,7,117,110,105,48,53,68,66,7,117,110,105,48,53,68,67,7,117,110,105,48,53,68,68,7,117,110,105,48,53,68,69,7,117,110,105,48,53,68,70,7,117,110,105,48,53,69,48,7,117,110,105,48,53,69,49,7,117,110,105,48,53,69,50,7,117,110,105,48,53,69,51,7,117,110,105,48,53,69,52,7,117,110,105,48,53,69,53,7,117,110,105,48,53,69,54,7,117,110,105,48,53,69,55,7,117,110,105,48,53,69,56,7,117,110,105,48,53,69,57,7,117,110,105,48,53,69,65,7,117,110,105,70,66,50,65,7,117,110,105,70,66,50,66,7,117,110,105,70,66,50,67,7,117,110,105,70,66,50,68,7,117,110,105,70,66,50,69,7,117,110,105,70,66,50,70,7,117,110,105,70,66,51,48,7,117,110,105,70,66,51,49,7,117,110,105,70,66,51,50,7,117,110,105,70,66,51,51,7,117,110,105,70,66,51,52,7,117,110,105,70,66,51,53,7,117,110,105,70,66,51,54,7,117,110,105,70,66,51,56,7,117,110,105,70,66,51,57,7,117,110,105,70,66,51,65,7,117,110,105,70,66,51,66,7,117,110,105,70,66,51,67,7,117,110,105,70,66,51,69,7,117,110,105,70,66,52,48,7,117,110,105,70,66,52,49,7,117,110,105,70,66,52,51,7,117,110,105,70,66,52,52,7,117,110,105,70,66,52,54,7,117,110,105,70,66,52,55,7,117,110,105,70,66,52,56,7,117,110,105,70,66,52,57,7,117,110,105,70,66,52,65,7,117,110,105,70,66,52,66,9,103,114,97,118,101,99,111,109,98,9,97,99,117,116,101,99,111,109,98,7,117,110,105,48,51,48,50,9,116,105,108,100,101,99,111,109,98,7,117,110,105,48,51,48,52,7,117,110,105,48,51,48,54,7,117,110,105,48,51,48,55,7,117,110,105,48,51,48,56,7,117,110,105,48,51,48,65,7,117,110,105,48,51,48,66,7,117,110,105,48,51,48,67,7,117,110,105,48,51,48,70,7,117,110,105,48,51,49,50,12,100,111,116,98,101,108,111,119,99,111,109,98,7,117,110,105,48,51,50,55,7,117,110,105,48,51,50,56,7,117,110,105,48,52,56,53,7,117,110,105,48,52,56,54,7,117,110,105,48,52,56,51,7,117,110,105,48,52,56,52,7,117,110,105,48,53,66,48,7,117,110,105,48,53,66,49,7,117,110,105,48,53,66,50,7,117,110,105,48,53,66,51,7,117,110,105,48,53,66,52,7,117,110,105,48,53,66,53,7,117,110,105,48,53,66,54,7,117,110,105,48,53,66,55,7,117,110,105,48,53,66,56,7,117,110,105,48,53,66,57,7,117,110,105,48,53,66,65,7,117,110,105,48,53,66,66,7,117,110,105,48,53,66,67,7,117,110,105,48,53,66,68,7,117,110,105,48,53,67,49,7,117,110,105,48,53,67,50,7,117,110,105,48,53,67,55,9,122,101,114,111,46,100,110,111,109,8,111,110,101,46,100,110,111,109,8,116,119,111,46,100,110,111,109,10,116,104,114,101,101,46,100,110,111,109,9,102,111,117,114,46,100,110,111,109,9,102,105,118,101,46,100,110,111,109,8,115,105,120,46,100,110,111,109,10,115,101,118,101,110,46,100,110,111,109,10,101,105,103,104,116,46,100,110,111,109,9,110,105,110,101,46,100,110,111,109,7,122,101,114,111,46,108,102,6,111,110,101,46,108,102,6,116,119,111,46,108,102,8,116,104,114,101,101,46,108,102,7,102,111,117,114,46,108,102,7,102,105,118,101,46,108,102,6,115,105,120,46,108,102,8,115,101,118,101,110,46,108,102,8,101,105,103,104,116,46,108,102,7,110,105,110,101,46,108,102,9,122,101,114,111,46,110,117,109,114,8,111,110,101,46,110,117,109,114,8,116,119,111,46,110,117,109,114,10,116,104,114,101,101,46,110,117,109,114,9,102,111,117,114,46,110,117,109,114,9,102,105,118,101,46,110,117,109,114,8,115,105,120,46,110,117,109,114,10,115,101,118,101,110,46,110,117,109,114,10,101,105,103,104,116,46,110,117,109,114,9,110,105,110,101,46,110,117,109,114,8,122,101,114,111,46,111,115,102,7,111,110,101,46,111,115,102,7,116,119,111,46,111,115,102,9,116,104,114,101,101,46,111,115,102,8,102,111,117,114,46,111,115,102,8,102,105,118,101,46,111,115,102,7,115,105,120,46,111,115,102,9,115,101,118,101,110,46,111,115,102,9,101,105,103,104,116,46,111,115,102,8,110,105,110,101,46,111,115,102,10,122,101,114,111,46,115,108,97,115,104,9,122,101,114,111,46,116,111,115,102,8,111,110,101,46,116,111,115,102,8,116,119,111,46,116,111,115,102,10,116,104,114,101,101,46,116,111,115,102,9,102,111,117,114,46,116,111,115,102,9,102,105,118,101,46,116,111,115,102,8,115,105,120,46,116,111,115,102,10,115,101,118,101,110,46,116,111,115,102,10,101,105,103,104,116,46,116,111,115,102,9,110,105,110,101,46,116,111,115,102,7,117,110,105,50,48,56,48,7,117,110,105,50,48,56,49,7,117,110,105,50,48,56,50,7,117,110,105,50,48,56,51,7,117,110,105,50,48,56,52,7,117,110,105,50,48,56,53,7,117,110,105,50,48,56,54,7,117,110,105,50,48,56,55,7,117,110,105,50,48,56,56,7,117,110,105,50,48,56,57,7,117,110,105,48,53,66,69,7,117,110,105,50,48,55,68,7,117,110,105,50,48,56,68,7,117,110,105,50,48,55,69,7,117,110,105,50,48,56,69,7,117,110,105,50,48,55,65,7,117,110,105,50,48,55,67,7,117,110,105,50,48,56,65,7,117,110,105,50,48,56,67,7,117,110,105,50,50,49,53,7,117,110,105,50,48,65,65,7,117,110,105,50,49,50,48,16,97,102,105,105,49,48,49,48,51,100,111,116,108,101,115,115,16,97,102,105,105,49,48,49,48,53,100,111,116,108,101,115,115,12,99,111,109,109,97,97,99,99,101,110,116,50,14,105,111,103,111,110,101,107,100,111,116,108,101,115,115,14,117,110,105,49,69,67,66,100,111,116,108,101,115,115,0,0,0,1,0,3,0,8,0,10,0,13,0,7,255,255,0,15,0,1,0,2,0,14,0,0,0,0,0,0,1,92,0,2,0,55,0,36,0,61,0,1,0,68,0,93,0,1,0,108,0,108,0,1,0,124,0,124,0,1,0,130,0,141,0,1,0,146,0,152,0,1,0,154,0,184,0,1,0,186,0,222,0,1,0,224,0,224,0,1,0,226,0,226,0,1,0,228,0,228,0,1,0,230,0,233,0,1,0,235,0,235,0,1,0,237,0,237,0,1,0,239,0,239,0,1,0,241,0,241,0,1,0,244,1,73,0,1,1,83,1,84,0,3,1,85,1,85,0,1,1,87,1,88,0,1,1,90,1,101,0,1,1,103,1,117,0,1,1,119,1,159,0,1,1,162,2,0,0,1,2,53,2,53,0,3,2,74,2,74,0,1,2,77,2,77,0,1,2,79,2,82,0,1,2,84,2,87,0,1,2,89,2,118,0,1,2,125,2,126,0,1,2,130,2,176,0,1,2,178,2,181,0,1,2,183,2,196,0,1,2,198,3,49,0,1,3,51,3,51,0,1,3,53,3,97,0,1,3,109,3,115,0,1,3,116,3,116,0,3,3,117,3,117,0,1,3,118,3,118,0,3,3,122,3,132,0,1,3,138,3,142,0,2,3,143,3,143,0,1,3,148,3,149,0,1,3,151,3,164,0,1,3,166,3,172,0,1,3,174,3,176,0,1,3,179,3,179,0,1,3,182,3,190,0,1,3,192,3,192,0,1,3,201,3,227,0,1,4,1,4,37,0,3,4,111,4,112,0,1,4,114,4,115,0,1,0,1,0,3,0,0,0,16,0,0,0,52,0,0,0,92,0,1,0,16,2,53,4,14,4,15,4,16,4,21,4,22,4,23,4,24,4,25,4,26,4,27,4,28,4,29,4,32,4,34,4,37,0,2,0,6,1,83,1,84,0,0,3,116,3,116,0,2,3,118,3,118,0,3,4,1,4,13,0,4,4,17,4,20,0,17,4,30,4,30,0,21,0,1,0,1,4,35,0,0,0,1,0,0,0,34,0,20,0,10,0,4,0,56,0,64,0,72,0,82,0,2,109,97,114,107,0,82,109,107,109,107,0,90,0,5,68,70,76,84,0,84,99,121,114,108,0,84,103,114,101,107,0,84,104,101,98,114,0,84,108,97,116,110,0,84,0,4,0,0,0,1,0,56,0,5,0,0,0,1,0,60,0,6,0,16,0,1,0,64,0,0,0,6,0,16,0,1,0,66,0,1,0,0,0,2,0,0,0,1,0,0,0,2,0,2,0,3,0,52,0,0,0,1,0,130,3,44,0,5,2,130,4,86,0,1,1,12,0,46,0,2,1,220,0,56,0,1,0,140,0,66,0,1,1,52,0,56,0,1,0,164,0,66,0,1,1,106,0,204,0,0,255,255,0,2,0,0,0,1,0,2,0,1,3,138,3,142,0,0,0,5,33,150,33,160,33,170,33,180,33,194,0,4,33,114,33,120,33,126,33,132,0,1,0,4,2,53,4,14,4,15,4,16,0,2,0,4,3,116,3,116,0,0,3,118,3,118,0,1,4,1,4,13,0,2,4,17,4,20,0,15,0,2,0,5,1,83,1,84,0,0,2,53,2,53,0,2,3,116,3,116,0,3,3,118,3,118,0,4,4,1,4,37,0,5,0,1,0,16,2,53,4,14,4,15,4,16,4,21,4,22,4,23,4,24,4,25,4,26,4,27,4,28,4,29,4,32,4,34,4,37,0,2,0,6,1,83,1,84,0,0,3,116,3,116,0,2,3,118,3,118,0,3,4,1,4,13,0,4,4,17,4,20,0,17,4,30,4,30,0,21,0,19,33,36,33,42,33,48,33,54,33,60,33,66,33,72,33,78,33,84,33,90,33,96,33,102,33,108,33,114,33,120,33,126,33,132,33,138,33,144,0,2,0,8,1,83,1,84,0,0,2,53,2,53,0,2,3,116,3,116,0,3,3,118,3,118,0,4,4,1,4,30,0,5,4,32,4,32,0,35,4,34,4,34,0,36,4,37,4,37,0,37,0,16,0,0,33,58,0,0,33,64,0,0,33,70,0,0,33,76,0,0,33,82,0,0,33,88,0,0,33,106,0,0,33,106,0,0,33,94,0,0,33,100,0,0,33,106,0,0,33,112,0,0,33,118,0,0,33,124,0,0,33,130,0,0,33,136,0,22,0,0,33,76,0,0,33,82,0,0,33,88,0,0,33,190,0,0,33,94,0,0,33,100,0,0,33,142,0,0,33,106,0,0,33,112,0,0,33,118,0,0,33,142,0,0,33,124,0,0,33,130,0,0,33,136,0,0,33,142,0,0,33,148,0,0,33,154,0,0,33,160,0,0,33,166,0,0,33,172,0,0,33,178,0,0,33,184,0,38,0,0,32,242,0,0,32,248,0,1,32,158,0,0,32,254,0,0,33,100,0,0,33,4,0,0,33,10,0,0,33,52,0,0,33,16,0,0,33,22,0,0,33,28,0,0,33,52,0,0,33,34,0,0,33,40,0,0,33,46,0,0,33,52,0,0,33,58,0,0,33,64,0,1,32,164,0,1,32,170,0,1,32,176,0,0,33,70,0,0,33,76,0,0,33,82,0,0,33,88,0,1,32,182,0,1,32,188,0,1,32,206,0,1,32,206,0,1,32,194,0,1,32,200,0,1,32,206,0,1,32,212,0,1,32,218,0,0,33,94,0,1,32,224,0,1,32,230,0,1,32,236,0,42,0,0,32,88,0,0,32,94,0,1,32,4,0,0,32,100,0,0,32,202,0,0,32,106,0,0,32,112,0,0,32,154,0,0,32,118,0,0,32,124,0,0,32,130,0,0,32,154,0,0,32,136,0,0,32,142,0,0,32,148,0,0,32,154,0,0,32,160,0,0,32,166,0,1,32,10,0,1,32,16,0,1,32,22,0,0,32,172,0,0,32,178,0,0,32,184,0,0,32,190,0,1,32,28,0,1,32,34,0,1,32,52,0,1,32,52,0,1,32,40,0,1,32,46,0,1,32,52,0,1,32,58,0,1,32,64,0,0,32,196,0,4,32,208,0,1,32,70,0,3,32,214,0,1,32,76,0,2,32,220,0,4,32,226,0,1,32,82,0,2,0,49,0,36,0,61,0,0,0,68,0,93,0,26,0,108,0,108,0,52,0,124,0,124,0,53,0,130,0,141,0,54,0,146,0,152,0,66,0,154,0,184,0,73,0,186,0,222,0,104,0,224,0,224,0,141,0,226,0,226,0,142,0,228,0,228,0,143,0,230,0,233,0,144,0,235,0,235,0,148,0,237,0,237,0,149,0,239,0,239,0,150,0,241,0,241,0,151,0,244,1,73,0,152,1,85,1,85,0,238,1,87,1,88,0,239,1,90,1,101,0,241,1,103,1,117,0,253,1,119,1,159,1,12,1,162,2,0,1,53,2,74,2,74,1,148,2,77,2,77,1,149,2,79,2,82,1,150,2,84,2,87,1,154,2,89,2,118,1,158,2,125,2,126,1,188,2,130,2,176,1,190,2,178,2,181,1,237,2,183,2,196,1,241,2,198,3,49,1,255,3,51,3,51,2,107,3,53,3,97,2,108,3,109,3,115,2,153,3,117,3,117,2,160,3,122,3,132,2,161,3,143,3,143,2,172,3,148,3,149,2,173,3,151,3,164,2,175,3,166,3,172,2,189,3,174,3,176,2,196,3,179,3,179,2,199,3,182,3,190,2,200,3,192,3,192,2,209,3,201,3,227,2,210,4,111,4,112,2,237,4,114,4,115,2,239,2,241,49,2,49,8,31,20,0,0,0,0,38,4,50,136,31,26,0,0,0,0,42,174,38,82,31,32,0,0,0,0,31,38,33,174,31,44,31,50,0,0,49,14,49,20,31,56,0,0,0,0,31,62,37,188,31,68,0,0,0,0,34,8,34,2,31,74,0,0,0,0,38,106,39,18,31,80,31,86,0,0,31,92,31,98,31,104,0,0,0,0,37,194,34,86,31,110,0,0,0,0,36,120,46,50,31,116,0,0,0,0,34,122,38,202,31,122,31,128,0,0,38,52,40,68,31,134,0,0,0,0,48,222,36,132,31,140,0,0,0,0,49,56,47,106,31,164,31,146,0,0,38,70,38,76,31,152,0,0,0,0,49,56,31,158,31,164,0,0,0,0,34,230,46,50,31,170,0,0,0,0,37,182,37,188,31,176,0,0,0,0,48,108,38,88,31,182,31,188,0,0,49,26,49,32,31,194,0,0,0,0,49,104,41,190,31,200,0,0,0,0,31,206,46,2,31,212,0,0,0,0,38,100,45,120,31,218,0,0,0,0,48,54,48,90,31,224,0,0,0,0,36,114,37,14,31,230,0,0,0,0,49,146,46,194,31,236,0,0,0,0,31,242,46,26,31,248,0,0,0,0,42,186,39,36,31,254,0,0,0,0,45,138,45,144,32,4,32,10,0,0,49,158,47,28,32,16,0,0,0,0,32,22,32,28,32,34,0,0,0,0,32,40,32,46,32,52,0,0,0,0,32,58,34,32,32,64,32,70,0,0,49,170,39,180,32,76,0,0,0,0,49,170,52,50,32,76,0,0,0,0,34,128,42,78,32,82,0,0,0,0,34,128,34,134,32,88,32,94,0,0,32,100,40,80,32,106,0,0,0,0,49,182,39,222,34,182,0,0,0,0,48,132,49,20,32,112,32,118,0,0,43,170,39,30,32,124,0,0,0,0,41,208,32,130,49,200,0,0,0,0,34,242,35,10,42,6,0,0,0,0,39,174,51,168,32,136,0,0,0,0,48,120,35,76,32,142,32,148,0,0,49,182,47,232,34,182,0,0,0,0,32,154,32,160,32,166,0,0,0,0,32,172,40,44,32,178,0,0,0,0,39,60,50,28,32,184,0,0,0,0,48,66,48,102,32,190,0,0,0,0,32,196,35,208,32,202,0,0,0,0,32,208,32,214,0,0,0,0,0,0,32,220,32,226,0,0,0,0,0,0,32,232,49,8,0,0,0,0,0,0,32,232,49,8,0,0,0,0,0,0,46,146,49,8,0,0,0,0,0,0,32,238,49,8,0,0,0,0,0,0,43,242,49,8,0,0,0,0,0,0,32,244,49,8,0,0,0,0,0,0,32,250,44,4,0,0,0,0,0,0,42,174,33,0,0,0,0,0,0,0,40,116,49,20,0,0,0,0,0,0,40,116,49,20,0,0,0,0,0,0,47,34,49,20,0,0,0,0,0,0,37,164,49,20,0,0,0,0,0,0,33,180,33,186,0,0,0,0,0,0,33,6,36,132,0,0,0,0,0,0,36,6,47,106,0,0,0,0,0,0,36,6,47,106,0,0,0,0,0,0,47,118,47,106,0,0,0,0,0,0,33,12,47,106,0,0,0,0,0,0,44,166,47,106,0,0,0,0,0,0,36,150,44,178,0,0,0,0,0,0,35,130,49,32,0,0,0,0,0,0,35,130,49,32,0,0,0,0,0,0,33,18,49,32,0,0,0,0,0,0,33,24,49,32,0,0,0,0,0,0,40,50,48,90,0,0,0,0,0,0,33,30,38,76,0,0,0,0,0,0,33,36,33,42,0,0,0,0,0,0,33,48,46,194,0,0,0,0,0,0,33,48,46,194,0,0,0,0,0,0,46,152,46,194,0,0,0,0,0,0,33,54,46,194,0,0,0,0,0,0,43,248,46,194,0,0,0,0,0,0,33,60,46,194,0,0,0,0,0,0,33,66,44,16,0,0,0,0,0,0,42,186,33,72,0,0,0,0,0,0,40,128,47,28,0,0,0,0,0,0,40,128,47,28,0,0,0,0,0,0,47,40,47,28,0,0,0,0,0,0,39,150,47,28,0,0,0,0,0,0,33,78,52,80,0,0,0,0,0,0,33,78,52,80,0,0,0,0,0,0,40,56,52,80,0,0,0,0,0,0,39,186,52,80,0,0,0,0,0,0,33,84,36,204,0,0,0,0,0,0,35,88,39,222,0,0,0,0,0,0,36,12,49,20,0,0,0,0,0,0,36,12,49,20,0,0,0,0,0,0,47,130,49,20,0,0,0,0,0,0,33,90,49,20,0,0,0,0,0,0,44,184,49,20,0,0,0,0,0,0,48,132,44,190,0,0,0,0,0,0,35,136,47,232,0,0,0,0,0,0,35,136,47,232,0,0,0,0,0,0,34,164,47,232,0,0,0,0,0,0,33,96,47,232,0,0,0,0,0,0,44,250,48,102,0,0,0,0,0,0,33,102,41,214,0,0,0,0,0,0,44,232,48,102,0,0,0,0,0,0,33,108,49,8,0,0,0,0,0,0,33,114,46,194,0,0,0,0,0,0,46,200,49,8,0,0,0,0,0,0,46,212,46,194,0,0,0,0,0,0,33,120,33,126,0,0,0,0,0,0,49,146,49,152,0,0,0,0,0,0,33,132,38,82,0,0,0,0,0,0,33,138,39,36,0,0,0,0,0,0,33,156,38,82,0,0,0,0,0,0,33,162,39,36,0,0,0,0,0,0,33,144,38,82,0,0,0,0,0,0,33,150,39,36,0,0,0,0,0,0,33,156,38,82,0,0,0,0,0,0,33,162,39,36,0,0,0,0,0,0,33,168,33,174,0,0,0,0,0,0,45,138,45,144,0,0,0,0,0,0,33,180,33,186,0,0,0,0,0,0,33,192,33,198,0,0,0,0,0,0,33,204,49,20,0,0,0,0,0,0,33,210,47,28,0,0,0,0,0,0,33,216,49,20,0,0,0,0,0,0,33,222,47,28,0,0,0,0,0,0,33,228,49,20,0,0,0,0,0,0,33,234,47,28,0,0,0,0,0,0,49,14,48,156,0,0,0,0,0,0,49,158,49,164,0,0,0,0,0,0,47,34,49,20,0,0,0,0,0,0,47,40,47,28,0,0,0,0,0,0,33,240,34,2,0,0,0,0,0,0,33,246,34,2,0,0,0,0,0,0,33,252,34,2,0,0,0,0,0,0,34,8,34,14,0,0,0,0,0,0,34,20,39,18,0,0,0,0,0,0,34,26,34,32,0,0,0,0,0,0,38,106,34,38,0,0,0,0,0,0,34,44,39,222,0,0,0,0,0,0,34,50,52,80,0,0,0,0,0,0,34,56,52,80,0,0,0,0,0,0,34,62,52,80,0,0,0,0,0,0,49,170,49,176,0,0,0,0,0,0,34,68,34,74,0,0,0,0,0,0,34,80,34,86,0,0,0,0,0,0,40,56,52,50,0,0,0,0,0,0,36,120,34,236,0,0,0,0,0,0,34,128,34,92,0,0,0,0,0,0,46,62,42,78,0,0,0,0,0,0,34,98,38,202,0,0,0,0,0,0,34,104,34,134,0,0,0,0,0,0,34,122,34,110,0,0,0,0,0,0,34,128,34,116,0,0,0,0,0,0,34,122,38,202,0,0,0,0,0,0,34,128,34,134,0,0,0,0,0,0,34,122,38,202,0,0,0,0,0,0,34,128,34,134,0,0,0,0,0,0,34,122,38,202,0,0,0,0,0,0,34,128,34,134,0,0,0,0,0,0,34,140,36,132,0,0,0,0,0,0,35,136,39,222,0,0,0,0,0,0,48,222,34,146,0,0,0,0,0,0,49,182,34,152,0,0,0,0,0,0,34,158,36,132,0,0,0,0,0,0,34,164,39,222,0,0,0,0,0,0,34,170,34,176,0,0,0,0,0,0,48,222,48,228,0,0,0,0,0,0,49,182,39,156,34,182,0,0,0,0,48,138,47,106,0,0,0,0,0,0,48,150,49,20,0,0,0,0,0,0,34,188,47,106,0,0,0,0,0,0,34,194,49,20,0,0,0,0,0,0,36,6,47,106,0,0,0,0,0,0,36,12,49,20,0,0,0,0,0,0,34,200,52,74,0,0,0,0,0,0,34,206,34,212,0,0,0,0,0,0,34,218,46,50,0,0,0,0,0,0,34,224,35,10,0,0,0,0,0,0,34,230,34,236,0,0,0,0,0,0,34,242,34,248,0,0,0,0,0,0,34,254,46,50,0,0,0,0,0,0,35,4,35,10,0,0,0,0,0,0,35,16,37,188,0,0,0,0,0,0,35,22,51,168,0,0,0,0,0,0,35,40,37,188,0,0,0,0,0,0,35,46,51,168,0,0,0,0,0,0,37,182,35,28,0,0,0,0,0,0,39,174,35,34,0,0,0,0,0,0,35,40,37,188,0,0,0,0,0,0,35,46,51,168,0,0,0,0,0,0,48,108,35,52,0,0,0,0,0,0,48,120,35,58,0,0,0,0,0,0,35,64,38,88,0,0,0,0,0,0,35,70,35,76,0,0,0,0,0,0,48,108,38,88,0,0,0,0,0,0,48,120,35,76,0,0,0,0,0,0,35,82,49,32,0,0,0,0,0,0,35,88,47,232,0,0,0,0,0,0,35,94,49,32,0,0,0,0,0,0,35,100,47,232,0,0,0,0,0,0,35,106,49,32,0,0,0,0,0,0,35,112,47,232,0,0,0,0,0,0,35,118,49,32,0,0,0,0,0,0,35,124,47,232,0,0,0,0,0,0,35,130,49,32,0,0,0,0,0,0,35,136,47,232,0,0,0,0,0,0,49,26,35,142,0,0,0,0,0,0,49,182,49,188,0,0,0,0,0,0,35,148,46,2,0,0,0,0,0,0,35,154,40,44,0,0,0,0,0,0,35,160,48,90,0,0,0,0,0,0,35,166,48,102,0,0,0,0,0,0,36,162,48,90,0,0,0,0,0,0,35,172,37,14,0,0,0,0,0,0,35,178,35,208,0,0,0,0,0,0,35,184,37,14,0,0,0,0,0,0,35,190,35,208,0,0,0,0,0,0,35,196,37,14,0,0,0,0,0,0,35,202,35,208,0,0,0,0,0,0,35,214,35,220,0,0,0,0,0,0,35,226,35,232,0,0,0,0,0,0,35,238,42,126,0,0,0,0,0,0,35,244,46,194,0,0,0,0,0,0,35,250,44,4,0,0,0,0,0,0,36,0,44,16,0,0,0,0,0,0,36,6,44,178,0,0,0,0,0,0,36,12,44,190,0,0,0,0,0,0,37,182,36,18,0,0,0,0,0,0,39,174,36,24,0,0,0,0,0,0,49,2,49,8,0,0,0,0,0,0,36,30,36,36,0,0,0,0,0,0,36,42,36,48,0,0,0,0,0,0,36,54,36,60,0,0,0,0,0,0,36,66,36,72,0,0,0,0,0,0,36,78,36,84,0,0,0,0,0,0,36,90,48,192,0,0,0,0,0,0,49,2,49,8,0,0,0,0,36,156,36,96,36,102,0,0,0,0,0,0,38,10,38,16,0,0,0,0,0,0,36,114,36,108,0,0,0,0,0,0,49,14,49,20,0,0,0,0,36,156,36,114,37,14,0,0,0,0,0,0,38,106,39,18,0,0,0,0,36,156,49,56,47,106,0,0,0,0,0,0,36,120,46,50,0,0,0,0,0,0,36,126,44,190,0,0,0,0,0,0,38,52,40,68,0,0,0,0,0,0,48,222,36,132,0,0,0,0,0,0,49,44,36,138,0,0,0,0,0,0,49,56,47,106,0,0,0,0,36,156,38,58,38,64,0,0,0,0,0,0,38,70,38,76,0,0,0,0,0,0,37,182,36,144,0,0,0,0,0,0,48,108,38,88,0,0,0,0,0,0,48,54,48,90,0,0,0,0,36,156,41,64,41,70,0,0,0,0,0,0,38,100,45,120,0,0,0,0,0,0,41,64,41,70,0,0,0,0,0,0,36,150,47,106,0,0,0,0,36,156,36,162,48,90,0,0,0,0,0,0,36,168,36,204,0,0,0,0,0,0,36,174,46,68,0,0,0,0,0,0,36,180,39,156,0,0,0,0,0,0,36,186,48,192,0,0,0,0,0,0,36,192,48,204,0,0,0,0,0,0,36,198,36,204,0,0,0,0,0,0,36,210,40,110,36,216,0,0,0,0,36,222,36,228,36,234,0,0,0,0,36,240,51,84,0,0,0,0,0,0,46,62,46,68,0,0,0,0,0,0,36,246,36,252,0,0,0,0,0,0,37,2,39,156,0,0,0,0,0,0,37,8,37,14,37,20,0,0,0,0,52,62,48,192,0,0,0,0,0,0,46,62,42,78,0,0,0,0,0,0,37,26,37,32,0,0,0,0,0,0,37,38,37,44,0,0,0,0,0,0,45,102,37,50,0,0,0,0,0,0,37,56,37,62,0,0,0,0,0,0,48,132,49,20,0,0,0,0,0,0,37,68,37,74,0,0,0,0,0,0,40,98,37,80,0,0,0,0,0,0,37,86,37,92,0,0,0,0,0,0,49,182,39,222,0,0,0,0,0,0,37,98,37,104,0,0,0,0,0,0,41,208,48,204,0,0,0,0,0,0,43,2,37,110,0,0,0,0,0,0,42,48,37,116,37,122,0,0,0,0,41,76,41,82,0,0,0,0,0,0,37,128,37,158,0,0,0,0,0,0,39,186,48,192,0,0,0,0,0,0,37,134,48,204,0,0,0,0,0,0,37,140,49,20,0,0,0,0,0,0,37,146,48,204,0,0,0,0,0,0,37,152,37,158,0,0,0,0,0,0,37,164,49,20,0,0,0,0,0,0,37,230,44,52,0,0,0,0,0,0,37,170,38,16,0,0,0,0,0,0,41,136,37,176,0,0,0,0,0,0,37,182,37,188,0,0,0,0,0,0,37,194,37,200,0,0,0,0,0,0,37,206,37,212,0,0,0,0,0,0,37,218,37,224,0,0,0,0,0,0,37,230,44,52,0,0,0,0,0,0,40,116,51,126,0,0,0,0,0,0,37,236,44,244,0,0,0,0,0,0,38,58,37,242,0,0,0,0,0,0,49,2,49,8,0,0,0,0,0,0,37,248,37,254,0,0,0,0,0,0,38,4,50,136,0,0,0,0,0,0,38,10,38,16,0,0,0,0,0,0,42,84,38,22,0,0,0,0,0,0,49,14,49,20,0,0,0,0,0,0,38,28,44,70,0,0,0,0,0,0,49,128,44,112,0,0,0,0,0,0,49,56,44,148,0,0,0,0,0,0,38,34,44,148,0,0,0,0,0,0,38,40,51,126,0,0,0,0,0,0,38,46,52,2,0,0,0,0,0,0,38,52,40,68,0,0,0,0,0,0,38,106,39,18,0,0,0,0,0,0,49,56,47,106,0,0,0,0,0,0,38,58,38,64,0,0,0,0,0,0,38,70,38,76,0,0,0,0,0,0,42,174,38,82,0,0,0,0,0,0,48,108,38,88,0,0,0,0,0,0,38,94,44,244,0,0,0,0,0,0,41,64,41,70,0,0,0,0,0,0,38,100,45,120,0,0,0,0,0,0,38,106,38,112,0,0,0,0,0,0,38,118,45,6,0,0,0,0,0,0,38,124,38,130,0,0,0,0,0,0,38,136,38,142,0,0,0,0,0,0,38,148,38,154,0,0,0,0,0,0,38,160,45,48,0,0,0,0,0,0,38,166,52,32,0,0,0,0,0,0,38,172,44,202,0,0,0,0,0,0,38,178,38,184,0,0,0,0,0,0,38,190,42,126,0,0,0,0,0,0,49,146,46,194,0,0,0,0,0,0,38,196,38,202,0,0,0,0,0,0,38,208,38,214,0,0,0,0,0,0,41,148,41,220,0,0,0,0,0,0,38,220,38,226,0,0,0,0,0,0,49,158,47,28,0,0,0,0,0,0,38,232,44,82,0,0,0,0,0,0,38,238,44,100,0,0,0,0,0,0,38,244,44,160,0,0,0,0,0,0,38,250,44,160,0,0,0,0,0,0,45,102,42,66,0,0,0,0,0,0,39,0,39,6,0,0,0,0,0,0,39,12,39,18,0,0,0,0,0,0,42,120,42,126,0,0,0,0,0,0,48,132,49,20,0,0,0,0,0,0,43,146,39,24,0,0,0,0,0,0,43,170,39,30,0,0,0,0,0,0,42,186,39,36,0,0,0,0,0,0,42,204,39,42,0,0,0,0,0,0,48,66,48,102,0,0,0,0,0,0,39,48,39,54,0,0,0,0,0,0,39,60,50,28,0,0,0,0,0,0,39,66,39,72,0,0,0,0,0,0,39,78,45,18,0,0,0,0,0,0,39,84,39,90,0,0,0,0,0,0,39,84,39,90,0,0,0,0,0,0,39,96,39,102,0,0,0,0,0,0,39,108,45,60,0,0,0,0,0,0,39,114,39,120,0,0,0,0,0,0,39,126,50,196,0,0,0,0,0,0,39,132,39,138,0,0,0,0,0,0,43,110,39,144,0,0,0,0,0,0,39,150,47,28,0,0,0,0,0,0,39,216,39,156,0,0,0,0,0,0,39,162,41,220,0,0,0,0,0,0,39,168,50,196,0,0,0,0,0,0,39,174,51,168,0,0,0,0,0,0,49,170,39,180,0,0,0,0,0,0,39,186,52,80,0,0,0,0,0,0,49,170,52,50,0,0,0,0,0,0,39,192,39,198,0,0,0,0,0,0,39,204,39,210,0,0,0,0,0,0,39,216,39,222,0,0,0,0,0,0,39,228,42,66,0,0,0,0,0,0,39,234,48,102,0,0,0,0,0,0,39,240,39,246,0,0,0,0,0,0,39,252,40,2,0,0,0,0,0,0,40,8,40,14,0,0,0,0,0,0,40,20,46,2,0,0,0,0,0,0,40,26,40,44,0,0,0,0,0,0,40,20,46,2,0,0,0,0,0,0,40,26,40,44,0,0,0,0,0,0,40,32,46,2,0,0,0,0,0,0,40,38,40,44,0,0,0,0,0,0,40,50,48,90,0,0,0,0,0,0,44,250,48,102,0,0,0,0,0,0,40,56,52,50,0,0,0,0,0,0,48,54,0,0,0,0,0,0,0,0,40,62,40,68,0,0,0,0,0,0,40,74,40,80,0,0,0,0,0,0,49,2,40,86,0,0,0,0,0,0,49,146,40,92,0,0,0,0,0,0,49,56,44,178,0,0,0,0,0,0,40,98,40,104,0,0,0,0,0,0,49,26,40,110,0,0,0,0,0,0,49,182,50,4,0,0,0,0,0,0,40,116,49,20,0,0,0,0,0,0,40,122,44,148,0,0,0,0,0,0,40,128,47,28,0,0,0,0,0,0,40,134,44,160,0,0,0,0,0,0,40,140,40,146,0,0,0,0,0,0,40,152,40,158,0,0,0,0,0,0,40,164,40,170,0,0,0,0,0,0,40,176,40,182,0,0,0,0,0,0,40,188,40,194,0,0,0,0,0,0,40,200,40,206,0,0,0,0,0,0,40,212,40,218,0,0,0,0,0,0,40,224,48,90,0,0,0,0,0,0,40,230,40,236,0,0,0,0,0,0,40,242,40,248,0,0,0,0,0,0,40,254,41,4,0,0,0,0,0,0,41,10,52,32,0,0,0,0,0,0,41,16,41,22,0,0,0,0,0,0,41,28,41,34,0,0,0,0,0,0,41,40,41,46,0,0,0,0,0,0,41,52,41,58,0,0,0,0,0,0,41,64,41,70,0,0,0,0,0,0,41,76,41,82,0,0,0,0,0,0,49,56,44,178,0,0,0,0,0,0,48,132,44,190,0,0,0,0,0,0,45,90,50,136,0,0,0,0,0,0,41,88,41,106,0,0,0,0,0,0,41,94,50,136,0,0,0,0,0,0,41,100,41,106,0,0,0,0,0,0,41,112,41,118,0,0,0,0,0,0,41,124,41,130,0,0,0,0,0,0,41,136,41,142,0,0,0,0,0,0,41,148,41,154,0,0,0,0,0,0,41,160,41,166,0,0,0,0,0,0,41,172,41,178,0,0,0,0,0,0,41,196,41,202,0,0,0,0,0,0,41,184,41,190,0,0,0,0,0,0,41,196,41,202,0,0,0,0,0,0,41,208,41,214,0,0,0,0,0,0,45,66,42,78,0,0,0,0,0,0,45,78,41,220,0,0,0,0,0,0,41,226,41,232,0,0,0,0,0,0,41,238,41,244,0,0,0,0,0,0,41,250,42,0,0,0,0,0,0,0,42,6,42,12,0,0,0,0,0,0,44,106,42,18,0,0,0,0,0,0,42,24,42,30,0,0,0,0,0,0,42,36,42,42,0,0,0,0,0,0,42,48,42,54,0,0,0,0,0,0,45,132,48,204,0,0,0,0,0,0,42,60,42,66,0,0,0,0,0,0,49,14,51,126,0,0,0,0,0,0,42,72,42,78,0,0,0,0,0,0,42,84,42,90,0,0,0,0,0,0,42,96,51,126,0,0,0,0,0,0,43,158,43,164,0,0,0,0,0,0,42,120,42,102,0,0,0,0,0,0,42,108,42,114,0,0,0,0,0,0,42,120,42,126,0,0,0,0,0,0,42,132,42,138,0,0,0,0,0,0,42,144,42,150,0,0,0,0,0,0,42,156,42,162,0,0,0,0,0,0,42,168,44,160,0,0,0,0,0,0,42,174,42,180,0,0,0,0,0,0,42,186,42,192,0,0,0,0,0,0,48,108,42,198,0,0,0,0,0,0,42,204,42,210,0,0,0,0,0,0,48,54,48,90,0,0,0,0,0,0,42,216,42,222,0,0,0,0,0,0,48,54,48,90,0,0,0,0,0,0,42,216,42,222,0,0,0,0,0,0,45,90,42,228,0,0,0,0,0,0,42,234,42,240,0,0,0,0,0,0,42,246,42,252,0,0,0,0,0,0,43,2,43,8,0,0,0,0,0,0,43,14,43,20,0,0,0,0,0,0,43,26,43,32,0,0,0,0,0,0,43,182,45,6,0,0,0,0,0,0,43,38,51,210,0,0,0,0,0,0,43,182,45,6,0,0,0,0,0,0,43,62,43,44,0,0,0,0,0,0,43,50,43,56,0,0,0,0,0,0,43,62,43,68,0,0,0,0,0,0,43,74,43,80,0,0,0,0,0,0,43,86,44,70,0,0,0,0,0,0,43,92,44,82,0,0,0,0,0,0,43,98,43,104,0,0,0,0,0,0,43,110,43,116,0,0,0,0,0,0,43,122,43,128,0,0,0,0,0,0,30,246,43,134,0,0,0,0,0,0,49,26,43,140,0,0,0,0,0,0,43,146,43,152,0,0,0,0,0,0,43,158,43,164,0,0,0,0,0,0,43,170,43,176,0,0,0,0,0,0,43,182,43,188,0,0,0,0,0,0,43,194,43,200,0,0,0,0,0,0,43,206,43,212,0,0,0,0,0,0,43,218,43,224,0,0,0,0,0,0,43,230,49,8,0,0,0,0,0,0,43,236,46,194,0,0,0,0,0,0,43,242,49,8,0,0,0,0,0,0,43,248,46,194,0,0,0,0,0,0,43,254,44,4,0,0,0,0,0,0,44,10,44,16,0,0,0,0,0,0,44,22,49,20,0,0,0,0,0,0,44,28,47,28,0,0,0,0,0,0,44,34,44,52,0,0,0,0,0,0,44,40,48,168,0,0,0,0,0,0,44,46,44,52,0,0,0,0,0,0,44,58,48,168,0,0,0,0,0,0,44,64,44,70,0,0,0,0,0,0,44,76,44,82,0,0,0,0,0,0,44,88,44,112,0,0,0,0,0,0,44,94,44,100,0,0,0,0,0,0,44,106,44,112,0,0,0,0,0,0,44,118,44,124,0,0,0,0,0,0,44,130,44,148,0,0,0,0,0,0,44,136,44,160,0,0,0,0,0,0,44,142,44,148,0,0,0,0,0,0,44,154,44,160,0,0,0,0,0,0,44,166,47,106,0,0,0,0,0,0,44,184,49,20,0,0,0,0,0,0,49,56,44,178,0,0,0,0,0,0,48,132,44,190,0,0,0,0,0,0,44,172,44,178,0,0,0,0,0,0,44,184,44,190,0,0,0,0,0,0,44,196,44,202,0,0,0,0,0,0,44,208,50,196,0,0,0,0,0,0,44,214,44,244,0,0,0,0,0,0,44,220,48,102,0,0,0,0,0,0,44,226,44,244,0,0,0,0,0,0,44,232,48,102,0,0,0,0,0,0,44,238,44,244,0,0,0,0,0,0,44,250,48,102,0,0,0,0,0,0,45,0,45,6,0,0,0,0,0,0,45,12,45,18,0,0,0,0,0,0,45,24,45,30,0,0,0,0,0,0,45,78,45,36,0,0,0,0,0,0,45,42,45,48,0,0,0,0,0,0,45,54,45,60,0,0,0,0,0,0,45,66,45,72,0,0,0,0,0,0,45,78,45,84,0,0,0,0,0,0,45,90,45,96,0,0,0,0,0,0,45,102,45,108,0,0,0,0,0,0,45,114,45,120,0,0,0,0,0,0,45,126,50,28,0,0,0,0,0,0,45,132,48,204,0,0,0,0,0,0,45,138,45,144,0,0,0,0,0,0,45,150,45,162,0,0,0,0,0,0,45,156,45,162,0,0,0,0,0,0,45,168,45,174,0,0,0,0,0,0,45,180,45,186,0,0,0,0,0,0,45,192,45,198,0,0,0,0,0,0,45,204,45,210,0,0,0,0,0,0,45,216,45,222,0,0,0,0,0,0,45,228,45,234,0,0,0,0,0,0,45,240,45,246,0,0,0,0,0,0,45,252,46,2,0,0,0,0,0,0,46,8,46,14,0,0,0,0,0,0,46,20,46,26,0,0,0,0,0,0,46,32,46,38,0,0,0,0,0,0,46,44,46,50,0,0,0,0,0,0,46,56,50,4,0,0,0,0,0,0,46,62,46,68,0,0,0,0,0,0,46,74,46,80,0,0,0,0,0,0,46,86,46,92,0,0,0,0,0,0,49,2,46,206,0,0,0,0,0,0,49,146,46,218,0,0,0,0,0,0,46,98,49,8,0,0,0,0,0,0,46,104,46,194,0,0,0,0,0,0,46,110,49,8,0,0,0,0,0,0,46,116,46,194,0,0,0,0,0,0,46,110,49,8,0,0,0,0,0,0,46,116,46,194,0,0,0,0,0,0,46,122,49,8,0,0,0,0,0,0,46,128,46,194,0,0,0,0,0,0,46,134,49,8,0,0,0,0,0,0,46,140,46,194,0,0,0,0,0,0,46,146,46,206,0,0,0,0,0,0,46,152,46,218,0,0,0,0,0,0,46,158,49,8,0,0,0,0,0,0,46,164,46,194,0,0,0,0,0,0,46,158,49,8,0,0,0,0,0,0,46,164,46,194,0,0,0,0,0,0,46,170,49,8,0,0,0,0,0,0,46,176,46,194,0,0,0,0,0,0,46,182,49,8,0,0,0,0,0,0,46,188,46,194,0,0,0,0,0,0,46,200,46,206,0,0,0,0,0,0,46,212,46,218,0,0,0,0,0,0,49,14,47,136,0,0,0,0,0,0,49,158,47,46,0,0,0,0,0,0,46,224,49,20,0,0,0,0,0,0,46,230,47,28,0,0,0,0,0,0,46,236,49,20,0,0,0,0,0,0,46,242,47,28,0,0,0,0,0,0,46,248,49,20,0,0,0,0,0,0,46,254,47,28,0,0,0,0,0,0,46,248,49,20,0,0,0,0,0,0,46,254,47,28,0,0,0,0,0,0,47,4,49,20,0,0,0,0,0,0,47,10,47,28,0,0,0,0,0,0,47,16,49,20,0,0,0,0,0,0,47,22,47,28,0,0,0,0,0,0,47,34,47,136,0,0,0,0,0,0,47,40,47,46,0,0,0,0,0,0,47,52,52,80,0,0,0,0,0,0,49,170,47,58,0,0,0,0,0,0,49,56,47,124,0,0,0,0,0,0,48,132,47,136,0,0,0,0,0,0,47,64,47,106,0,0,0,0,0,0,47,70,49,20,0,0,0,0,0,0,47,76,47,106,0,0,0,0,0,0,47,82,49,20,0,0,0,0,0,0,47,76,47,106,0,0,0,0,0,0,47,82,49,20,0,0,0,0,0,0,47,88,47,106,0,0,0,0,0,0,47,94,49,20,0,0,0,0,0,0,47,100,47,106,0,0,0,0,0,0,47,112,49,20,0,0,0,0,0,0,47,118,47,124,0,0,0,0,0,0,47,130,47,136,0,0,0,0,0,0,47,142,47,172,0,0,0,0,0,0,47,148,48,204,0,0,0,0,0,0,47,142,47,172,0,0,0,0,0,0,47,148,48,204,0,0,0,0,0,0,47,154,47,172,0,0,0,0,0,0,47,160,48,204,0,0,0,0,0,0,47,166,47,172,0,0,0,0,0,0,47,178,48,204,0,0,0,0,0,0,47,184,47,190,0,0,0,0,0,0,47,196,47,202,0,0,0,0,0,0,49,26,47,208,0,0,0,0,0,0,49,182,47,214,0,0,0,0,0,0,47,220,49,32,0,0,0,0,0,0,47,226,47,232,0,0,0,0,0,0,47,238,48,12,0,0,0,0,0,0,47,244,48,24,0,0,0,0,0,0,47,238,48,12,0,0,0,0,0,0,47,244,48,24,0,0,0,0,0,0,47,250,48,12,0,0,0,0,0,0,48,0,48,24,0,0,0,0,0,0,48,6,48,12,0,0,0,0,0,0,48,18,48,24,0,0,0,0,0,0,48,30,48,36,0,0,0,0,0,0,48,42,48,48,0,0,0,0,0,0,48,54,48,60,0,0,0,0,0,0,48,66,48,102,0,0,0,0,0,0,48,72,48,90,0,0,0,0,0,0,48,78,48,102,0,0,0,0,0,0,48,84,48,90,0,0,0,0,0,0,48,96,48,102,0,0,0,0,0,0,48,108,48,114,0,0,0,0,0,0,48,120,48,126,0,0,0,0,0,0,49,56,48,144,0,0,0,0,0,0,48,132,48,156,0,0,0,0,0,0,48,138,48,144,0,0,0,0,0,0,48,150,48,156,0,0,0,0,0,0,48,162,48,168,0,0,0,0,0,0,48,174,48,180,0,0,0,0,0,0,48,186,48,192,0,0,0,0,0,0,48,186,48,192,0,0,0,0,0,0,48,186,48,192,0,0,0,0,0,0,48,186,48,192,0,0,0,0,0,0,48,198,48,204,0,0,0,0,0,0,48,198,48,204,0,0,0,0,0,0,48,198,48,204,0,0,0,0,0,0,48,198,48,204,0,0,0,0,0,0,48,210,48,216,0,0,0,0,0,0,48,222,48,228,0,0,0,0,0,0,48,234,48,240,0,0,0,0,0,0,48,246,48,252,0,0,0,0,0,0,49,2,49,8,0,0,0,0,0,0,49,14,49,20,0,0,0,0,0,0,49,26,49,32,0,0,0,0,0,0,49,242,49,248,49,38,0,0,0,0,49,44,49,50,49,56,0,0,0,0,49,62,49,248,0,0,0,0,0,0,49,62,49,248,0,0,0,0,0,0,49,68,49,248,0,0,0,0,0,0,49,140,49,248,0,0,0,0,0,0,49,74,49,248,0,0,0,0,0,0,49,80,49,248,0,0,0,0,0,0,49,86,49,248,0,0,0,0,0,0,49,242,49,92,0,0,0,0,0,0,49,242,49,92,0,0,0,0,0,0,49,98,49,248,0,0,0,0,0,0,49,104,49,110,0,0,0,0,0,0,49,116,49,248,0,0,0,0,0,0,49,242,49,122,0,0,0,0,0,0,49,128,49,134,0,0,0,0,0,0,49,242,49,248,0,0,0,0,0,0,49,140,49,248,0,0,0,0,0,0,49,242,49,248,0,0,0,0,0,0,49,140,49,248,0,0,0,0,0,0,49,242,49,248,0,0,0,0,0,0,52,62,52,80,0,0,0,0,0,0,52,62,52,50,0,0,0,0,0,0,49,206,49,224,0,0,0,0,0,0,49,146,49,152,0,0,0,0,0,0,49,158,49,164,0,0,0,0,0,0,49,170,49,176,0,0,0,0,0,0,49,182,49,188,0,0,0,0,0,0,49,194,49,224,49,200,0,0,0,0,49,206,49,224,0,0,0,0,0,0,49,212,49,224,0,0,0,0,0,0,49,218,49,224,0,0,0,0,0,0,49,230,50,172,49,236,0,0,0,0,49,242,49,248,0,0,0,0,0,0,49,254,50,4,0,0,50,10,50,16,50,22,50,28,0,0,50,34,50,58,50,40,50,46,0,0,50,52,50,58,50,64,50,70,0,0,50,76,51,222,50,130,50,136,0,0,50,82,51,222,50,88,50,94,0,0,50,100,51,222,50,106,50,112,0,0,50,118,50,124,50,130,50,136,0,0,50,142,51,222,50,148,50,154,0,0,50,160,51,222,50,166,50,172,0,0,50,178,50,184,50,190,50,196,0,0,50,202,51,114,50,208,50,214,0,0,50,220,51,156,50,226,50,232,0,0,50,238,50,244,50,250,51,0,0,0,51,6,51,12,51,18,51,24,0,0,51,30,51,222,51,36,51,42,0,0,51,48,51,114,51,54,51,60,0,0,51,66,51,72,51,78,51,84,0,0,51,90,51,156,51,96,51,102,0,0,51,108,51,114,51,120,51,126,0,0,51,132,51,198,51,138,51,144,0,0,51,150,51,156,51,162,51,168,0,0,51,174,51,198,51,180,51,186,0,0,51,192,51,198,51,204,51,210,0,0,51,216,51,222,51,228,51,234,0,0,51,240,51,246,51,252,52,2,52,8,52,14,52,20,52,26,52,32,0,0,52,38,52,44,52,62,52,80,0,0,0,0,0,0,52,62,52,50,0,0,0,0,0,0,52,62,52,56,0,0,0,0,0,0,52,62,52,68,0,0,0,0,0,0,0,1,0,3,254,59,0,1,253,162,254,161,0,1,0,2,254,20,0,1,0,0,254,62,0,2,22,228,22,234,22,210,22,246,0,2,22,218,22,206,22,212,22,188,0,2,22,208,22,214,22,220,22,226,0,3,22,228,22,174,22,234,22,240,22,246,22,222,0,3,22,214,22,160,22,220,22,226,22,232,22,238,0,1,253,173,6,145,0,1,2,130,6,47,0,1,253,25,6,31,0,1,253,235,6,31,0,1,0,0,6,31,0,1,253,138,5,214,0,1,0,1,5,102,0,1,0,2,5,225,0,1,0,0,5,226,0,1,255,254,5,201,0,1,0,8,6,136,0,1,0,112,6,33,0,1,0,3,6,32,0,1,253,159,6,33,0,1,255,247,5,182,0,1,253,187,6,56,0,1,253,191,6,56,0,1,253,202,5,178,0,1,253,209,5,217,0,1,0,0,0,0,0,1,253,160,0,0,0,1,255,254,0,0,0,1,0,2,0,0,0,1,0,7,255,191,0,1,255,247,255,188,0,1,0,1,255,189,0,1,255,249,255,193,0,1,255,249,255,188,0,1,255,253,0,27,0,1,255,255,0,23,0,1,0,7,255,185,0,1,255,255,255,134,0,1,255,242,255,207,0,1,2,89,4,72,0,1,2,80,4,72,0,1,253,169,4,72,0,1,253,25,4,72,0,1,253,235,4,72,0,1,253,138,4,72,0,1,0,1,4,72,0,1,0,2,4,72,0,1,255,254,4,72,0,1,0,4,4,72,0,1,0,112,4,72,0,1,0,0,4,72,0,1,253,159,4,72,0,1,255,243,3,51,0,1,253,184,4,72,0,1,253,187,4,72,0,1,253,199,4,72,0,1,253,206,4,72,0,1,255,255,5,105,0,1,2,83,4,72,0,1,0,96,4,213,0,1,0,6,2,74,0,1,0,6,4,74,0,1,0,90,4,213,0,1,4,48,5,182,0,1,5,2,5,182,0,1,4,225,5,182,0,1,2,224,5,182,0,1,5,165,5,182,0,1,2,232,2,219,0,1,4,73,5,182,0,1,2,98,5,182,0,1,3,248,5,182,0,1,5,168,5,182,0,1,5,189,5,182,0,1,2,244,2,219,0,1,1,31,5,182,0,1,1,31,0,0,0,1,1,185,5,182,0,1,1,253,5,182,0,1,4,189,5,182,0,1,2,251,5,182,0,1,2,23,2,219,0,1,7,9,5,182,0,1,5,222,5,182,0,1,3,30,2,219,0,1,4,167,5,182,0,1,3,30,254,164,0,1,6,17,5,182,0,1,4,199,5,182,0,1,4,58,5,182,0,1,4,63,5,182,0,1,2,51,2,219,0,1,5,172,5,182,0,1,4,156,5,182,0,1,3,177,5,182,0,1,7,58,5,182,0,1,4,118,5,182,0,1,4,80,5,182,0,1,4,107,5,182,0,1,4,19,4,72,0,1,2,170,6,20,0,1,4,35,6,20,0,1,3,172,4,72,0,1,4,111,6,20,0,1,2,115,2,36,0,1,4,85,4,72,0,1,1,252,6,31,0,1,1,51,0,0,0,1,2,254,6,31,0,1,2,16,4,72,0,1,2,32,254,20,0,1,4,75,4,73,0,1,1,4,6,20,0,1,4,76,6,20,0,1,2,116,2,36,0,1,1,220,5,226,0,1,4,38,6,20,0,1,1,155,6,20,0,1,1,2,2,36,0,1,3,201,4,72,0,1,7,8,4,72,0,1,4,150,4,72,0,1,2,106,2,36,0,1,4,169,4,72,0,1,3,225,254,22,0,1,3,131,4,72,0,1,2,166,5,70,0,1,1,110,2,36,0,1,1,252,4,72,0,1,1,252,0,0,0,1,3,214,4,72,0,1,3,26,4,72,0,1,6,10,4,72,0,1,4,7,4,72,0,1,3,218,4,72,0,1,1,223,4,72,0,1,3,114,4,72,0,1,1,94,5,205,0,1,1,92,3,21,0,1,1,131,5,205,0,1,1,119,3,13,0,1,2,133,7,143,0,1,2,133,7,75,0,1,2,133,7,10,0,1,3,217,5,182,0,1,2,249,254,20,0,1,3,3,7,75,0,1,3,30,7,75,0,1,2,236,7,142,0,1,2,236,7,65,0,1,2,105,5,182,0,1,2,126,6,31,0,1,2,126,0,0,0,1,2,57,6,33,0,1,2,57,5,221,0,1,2,57,6,136,0,1,3,128,4,72,0,1,2,66,254,20,0,1,1,2,6,33,0,1,2,103,6,29,0,1,2,106,5,221,0,1,2,116,5,210,0,1,2,115,6,20,0,1,2,133,6,208,0,1,2,57,5,97,0,1,2,133,5,188,0,1,2,144,254,62,0,1,3,12,7,143,0,1,2,75,6,33,0,1,3,12,7,80,0,1,2,75,5,226,0,1,3,12,7,142,0,1,2,75,6,32,0,1,2,224,7,142,0,1,2,189,0,0,0,1,2,232,5,182,0,1,2,232,0,0,0,1,2,117,6,20,0,1,2,117,0,0,0,1,2,113,6,208,0,1,2,69,5,97,0,1,2,113,7,85,0,1,2,69,5,231,0,1,2,113,7,80,0,1,2,69,5,226,0,1,3,62,7,142,0,1,3,62,7,85,0,1,3,62,7,80,0,1,3,55,0,0,0,1,3,62,5,182,0,1,3,55,254,59,0,1,2,244,7,142,0,1,1,4,7,237,0,1,2,118,0,0,0,1,2,244,0,0,0,1,1,45,6,20,0,1,1,2,5,221,0,1,1,2,5,97,0,1,1,2,5,231,0,1,3,8,5,226,0,1,2,47,254,20,0,1,1,21,7,142,0,1,255,245,254,165,0,1,2,26,254,59,0,1,1,26,7,143,0,1,1,2,7,238,0,1,2,98,254,59,0,1,1,2,254,59,0,1,1,26,5,182,0,1,1,2,6,20,0,1,1,2,0,0,0,1,3,3,7,143,0,1,3,3,254,59,0,1,2,116,254,59,0,1,3,3,7,142,0,1,2,116,6,32,0,1,2,245,4,72,0,1,2,245,0,0,0,1,4,125,4,72,0,1,3,30,7,85,0,1,2,106,5,231,0,1,3,179,5,182,0,1,3,203,4,72,0,1,3,203,0,0,0,1,2,120,7,143,0,1,1,224,6,33,0,1,2,120,5,182,0,1,2,153,254,59,0,1,1,224,4,72,0,1,0,253,254,59,0,1,2,120,7,142,0,1,1,224,6,32,0,1,0,253,0,0,0,1,2,69,7,143,0,1,1,233,6,33,0,1,2,17,254,20,0,1,1,233,254,20,0,1,2,69,7,142,0,1,1,233,6,32,0,1,2,51,254,59,0,1,1,177,254,59,0,1,2,51,7,142,0,1,1,49,6,20,0,1,1,177,0,0,0,1,2,236,7,75,0,1,2,116,5,221,0,1,2,236,6,208,0,1,2,116,5,97,0,1,2,236,7,85,0,1,2,116,5,231,0,1,2,236,7,246,0,1,2,116,6,136,0,1,2,236,7,143,0,1,2,116,6,33,0,1,2,231,254,62,0,1,3,177,7,142,0,1,3,26,6,32,0,1,2,61,7,142,0,1,2,1,6,32,0,1,2,82,7,143,0,1,1,223,6,33,0,1,2,82,7,80,0,1,1,223,5,226,0,1,2,82,7,142,0,1,1,223,6,32,0,1,1,237,0,0,0,1,1,179,6,31,0,1,1,74,0,0,0,1,2,240,5,203,0,1,2,74,254,20,0,1,2,136,7,172,0,1,2,57,7,168,0,1,3,122,7,143,0,1,3,115,6,33,0,1,3,30,7,143,0,1,2,106,6,33,0,1,2,17,254,59,0,1,1,233,254,59,0,1,3,20,5,182,0,1,3,8,0,0,0,1,3,151,5,182,0,1,3,146,0,0,0,1,3,115,5,182,0,1,3,117,0,0,0,1,3,114,5,182,0,1,3,114,0,0,0,1,3,102,5,182,0,1,3,102,0,0,0,1,1,2,6,180,0,1,2,150,5,182,0,1,2,150,0,0,0,1,2,82,0,0,0,1,2,82,5,182,0,1,2,170,5,182,0,1,2,106,5,182,0,1,3,3,0,0,0,1,2,53,0,0,0,1,2,69,0,0,0,1,3,32,5,182,0,1,0,41,5,182,0,1,2,61,7,65,0,1,2,120,6,113,0,1,2,26,6,113,0,1,2,147,6,113,0,1,1,2,6,113,0,1,2,115,6,180,0,1,2,120,4,72,0,1,2,103,0,0,0,1,2,148,6,31,0,1,4,110,6,31,0,1,2,11,4,72,0,1,2,11,254,20,0,1,4,0,4,72,0,1,2,102,6,22,0,1,1,237,6,20,0,1,1,237,254,113,0,1,2,147,4,72,0,1,2,94,6,33,0,1,2,94,0,0,0,1,4,27,6,33,0,1,2,36,6,33,0,1,2,36,0,0,0,1,2,122,4,72,0,1,2,122,254,20,0,1,2,43,0,0,0,1,1,230,6,20,0,1,1,230,254,113,0,1,2,155,4,72,0,1,2,155,0,0,0,1,2,105,254,20,0,1,1,238,4,72,0,1,1,238,254,113,0,1,1,230,4,72,0,1,1,230,0,0,0,1,2,223,254,20,0,1,2,46,254,20,0,1,4,50,4,72,0,1,3,21,4,72,0,1,2,115,5,210,0,1,2,106,6,113,0,1,2,115,6,113,0,1,3,21,6,113,0,1,3,24,0,0,0,1,2,113,7,65,0,1,2,109,7,143,0,1,2,143,0,0,0,1,2,69,5,182,0,1,2,17,0,0,0,1,1,21,5,182,0,1,255,245,254,127,0,1,3,189,5,182,0,1,3,189,0,0,0,1,3,213,5,182,0,1,3,213,0,0,0,1,2,240,5,182,0,1,2,121,7,121,0,1,2,235,254,130,0,1,2,115,5,182,0,1,2,115,0,0,0,1,2,144,5,182,0,1,2,109,5,182,0,1,2,21,0,0,0,1,2,190,254,130,0,1,3,96,5,182,0,1,3,25,7,121,0,1,2,162,5,182,0,1,2,208,5,182,0,1,3,154,5,182,0,1,2,235,5,182,0,1,2,235,0,0,0,1,2,130,5,182,0,1,2,105,0,0,0,1,2,249,0,0,0,1,2,51,0,0,0,1,2,146,5,182,0,1,2,78,5,182,0,1,2,244,5,182,0,1,2,244,254,130,0,1,2,178,5,182,0,1,4,33,5,182,0,1,4,33,0,0,0,1,4,38,5,182,0,1,4,38,0,0,0,1,2,191,5,182,0,1,2,191,0,0,0,1,3,108,5,182,0,1,2,137,5,182,0,1,1,243,5,182,0,1,4,49,5,182,0,1,4,49,0,0,0,1,2,136,5,182,0,1,2,98,6,30,0,1,2,98,0,0,0,1,2,76,4,72,0,1,2,76,0,0,0,1,2,78,4,72,0,1,2,78,254,133,0,1,2,237,4,72,0,1,1,219,4,72,0,1,2,154,4,72,0,1,2,149,6,11,0,1,2,74,4,72,0,1,2,74,0,0,0,1,2,239,4,72,0,1,2,239,0,0,0,1,2,123,0,0,0,1,1,2,254,22,0,1,2,66,0,0,0,1,1,226,0,0,0,1,2,221,6,20,0,1,2,221,254,20,0,1,2,22,4,72,0,1,2,121,4,72,0,1,2,121,254,133,0,1,2,96,4,72,0,1,3,144,4,72,0,1,3,144,0,0,0,1,2,192,4,72,0,1,2,192,0,0,0,1,3,11,4,72,0,1,2,92,4,72,0,1,2,92,0,0,0,1,1,177,4,72,0,1,3,81,4,72,0,1,3,81,0,0,0,1,2,56,0,0,0,1,2,69,5,210,0,1,2,116,254,20,0,1,1,186,6,33,0,1,1,250,4,72,0,1,1,233,4,72,0,1,1,6,0,0,0,1,1,2,5,210,0,1,3,90,4,72,0,1,3,90,0,0,0,1,3,142,4,72,0,1,3,142,0,0,0,1,2,116,6,20,0,1,2,116,0,0,0,1,2,18,6,33,0,1,2,1,6,11,0,1,2,125,4,72,0,1,2,125,254,135,0,1,2,28,6,227,0,1,2,28,0,0,0,1,1,187,5,137,0,1,1,187,0,0,0,1,3,177,7,143,0,1,3,26,6,33,0,1,3,177,7,65,0,1,3,26,5,210,0,1,3,22,0,0,0,1,2,61,7,143,0,1,1,2,6,32,0,1,3,154,7,143,0,1,3,143,0,0,0,1,3,201,6,33,0,1,3,188,0,0,0,1,2,144,253,211,0,1,2,57,253,211,0,1,2,105,4,72,0,1,2,100,0,0,0,1,2,243,0,0,0,1,2,113,7,143,0,1,3,10,7,143,0,1,2,69,6,33,0,1,2,139,6,33,0,1,3,170,5,182,0,1,3,170,0,0,0,1,3,33,4,72,0,1,3,33,0,0,0,1,2,180,5,182,0,1,2,180,0,0,0,1,2,138,5,39,0,1,2,138,0,0,0,1,5,29,5,182,0,1,5,29,0,0,0,1,4,13,4,72,0,1,4,13,0,0,0,1,2,175,5,182,0,1,2,178,0,0,0,1,2,58,4,72,0,1,4,135,5,182,0,1,4,135,0,0,0,1,3,199,4,72,0,1,3,199,0,0,0,1,2,229,5,182,0,1,2,229,0,0,0,1,2,137,4,72,0,1,4,221,5,182,0,1,4,221,0,0,0,1,4,35,4,72,0,1,4,35,0,0,0,1,2,85,6,210,0,1,2,85,254,79,0,1,1,239,5,79,0,1,1,239,254,123,0,1,3,48,5,182,0,1,3,48,0,0,0,1,3,5,6,18,0,1,3,5,254,20,0,1,2,10,4,72,0,1,2,131,7,143,0,1,2,9,6,33,0,1,2,9,0,0,0,1,4,211,5,182,0,1,4,211,254,19,0,1,4,86,4,72,0,1,4,86,254,19,0,1,2,143,5,182,0,1,2,143,254,20,0,1,1,245,4,72,0,1,1,245,254,20,0,1,3,14,7,95,0,1,3,14,254,130,0,1,2,155,6,11,0,1,2,155,254,135,0,1,2,96,6,20,0,1,2,96,0,0,0,1,2,112,5,182,0,1,2,112,0,0,0,1,2,115,4,72,0,1,2,115,254,22,0,1,1,186,0,0,0,1,2,152,5,182,0,1,2,152,254,0,0,1,2,31,4,72,0,1,2,31,254,10,0,1,3,139,5,182,0,1,3,139,254,130,0,1,3,28,4,72,0,1,3,28,254,135,0,1,2,85,254,62,0,1,1,239,4,72,0,1,1,239,254,62,0,1,2,166,5,182,0,1,2,166,254,130,0,1,2,46,4,72,0,1,2,46,254,134,0,1,2,18,4,72,0,1,2,18,0,0,0,1,1,30,6,20,0,1,2,26,0,0,0,1,2,190,5,182,0,1,2,190,0,0,0,1,2,113,4,72,0,1,2,136,254,135,0,1,2,242,5,182,0,1,2,242,0,0,0,1,2,136,4,72,0,1,2,136,0,0,0,1,4,72,5,182,0,1,4,72,254,0,0,1,3,118,4,72,0,1,3,118,254,10,0,1,3,28,5,182,0,1,3,28,0,0,0,1,2,139,4,72,0,1,3,12,5,182,0,1,2,249,254,62,0,1,2,75,4,72,0,1,2,66,254,62,0,1,2,51,254,130,0,1,1,226,4,72,0,1,1,226,254,135,0,1,1,255,4,72,0,1,1,255,254,20,0,1,2,121,254,130,0,1,2,45,4,72,0,1,2,45,254,134,0,1,3,111,5,182,0,1,3,111,254,130,0,1,2,223,4,72,0,1,2,223,254,135,0,1,2,203,5,182,0,1,2,203,254,130,0,1,2,119,4,72,0,1,2,119,254,133,0,1,2,104,4,72,0,1,3,221,0,0,0,1,2,255,4,72,0,1,2,255,0,0,0,1,3,221,5,182,0,1,3,221,254,128,0,1,3,0,4,72,0,1,3,0,254,135,0,1,3,93,7,121,0,1,2,241,6,11,0,1,2,194,5,182,0,1,2,194,254,0,0,1,2,56,4,72,0,1,2,56,254,10,0,1,2,218,5,182,0,1,2,218,254,130,0,1,2,83,254,135,0,1,2,236,254,0,0,1,2,123,4,72,0,1,2,123,254,12,0,1,3,0,5,182,0,1,3,0,254,130,0,1,2,159,4,72,0,1,2,159,254,135,0,1,2,198,5,182,0,1,2,198,254,130,0,1,2,111,4,72,0,1,2,111,254,133,0,1,3,163,5,182,0,1,3,163,254,130,0,1,2,248,4,72,0,1,2,248,254,135,0,1,2,133,7,121,0,1,2,57,6,11,0,1,2,133,7,65,0,1,2,57,5,210,0,1,3,122,5,182,0,1,3,122,0,0,0,1,3,115,4,72,0,1,3,115,0,0,0,1,2,113,7,121,0,1,2,69,6,11,0,1,2,200,5,182,0,1,2,63,4,72,0,1,2,240,7,65,0,1,2,240,0,0,0,1,2,63,5,210,0,1,3,93,7,65,0,1,3,93,0,0,0,1,2,241,5,210,0,1,2,241,0,0,0,1,2,85,7,65,0,1,1,239,5,210,0,1,1,239,0,0,0,1,2,85,5,182,0,1,2,85,0,0,0,1,1,247,4,72,0,1,1,247,254,20,0,1,3,10,6,208,0,1,2,139,5,97,0,1,3,10,7,65,0,1,3,10,0,0,0,1,2,139,5,210,0,1,2,139,0,0,0,1,3,30,7,65,0,1,3,30,7,36,0,1,3,30,0,0,0,1,2,106,5,210,0,1,2,106,0,0,0,1,2,134,7,36,0,1,2,134,0,0,0,1,1,250,5,210,0,1,2,121,6,208,0,1,2,1,5,97,0,1,2,121,7,65,0,1,2,1,5,210,0,1,2,121,7,143,0,1,2,121,0,0,0,1,2,1,6,33,0,1,2,198,7,65,0,1,2,198,0,0,0,1,2,111,5,210,0,1,2,111,0,0,0,1,2,27,5,182,0,1,2,27,254,130,0,1,1,186,254,135,0,1,3,101,7,65,0,1,3,101,0,0,0,1,3,19,5,210,0,1,3,19,0,0,0,1,2,26,5,182,0,1,2,26,254,113,0,1,1,186,4,72,0,1,1,186,254,113,0,1,2,121,5,182,0,1,2,121,254,113,0,1,2,43,4,72,0,1,2,43,254,113,0,1,2,79,5,182,0,1,2,79,0,0,0,1,2,25,4,72,0,1,2,114,5,182,0,1,2,55,6,20,0,1,2,86,0,0,0,1,3,148,5,182,0,1,3,148,6,20,0,1,3,148,0,0,0,1,3,153,5,182,0,1,3,153,0,0,0,1,3,51,4,72,0,1,3,51,0,0,0,1,2,127,5,182,0,1,2,127,254,130,0,1,2,27,4,72,0,1,2,27,254,135,0,1,3,232,5,182,0,1,3,232,0,0,0,1,3,105,4,72,0,1,3,105,0,0,0,1,4,11,5,182,0,1,4,11,0,0,0,1,3,165,4,72,0,1,3,165,0,0,0,1,3,5,5,182,0,1,3,5,0,0,0,1,2,140,4,72,0,1,2,140,0,0,0,1,2,214,5,182,0,1,2,214,0,0,0,1,2,153,4,72,0,1,2,153,0,0,0,1,2,87,5,182,0,1,2,26,4,72,0,1,1,235,0,0,0,1,2,212,5,182,0,1,2,212,254,113,0,1,2,81,4,72,0,1,2,81,254,113,0,1,2,133,7,227,0,1,2,57,6,145,0,1,2,133,7,209,0,1,2,57,6,127,0,1,2,133,8,73,0,1,2,57,6,247,0,1,2,133,8,98,0,1,2,57,7,16,0,1,2,133,7,142,0,1,2,57,6,32,0,1,2,133,8,19,0,1,2,57,6,194,0,1,2,133,8,88,0,1,2,57,7,6,0,1,2,133,8,92,0,1,2,57,7,10,0,1,2,57,0,0,0,1,2,133,7,85,0,1,2,144,254,161,0,1,2,57,5,231,0,1,2,57,254,161,0,1,2,113,7,227,0,1,2,69,6,145,0,1,2,113,7,75,0,1,2,69,5,221,0,1,2,113,7,209,0,1,2,69,6,127,0,1,2,113,8,73,0,1,2,69,6,247,0,1,2,113,8,98,0,1,2,69,7,16,0,1,2,97,0,0,0,1,2,113,7,142,0,1,2,69,6,32,0,1,2,97,254,161,0,1,1,2,6,145,0,1,1,6,254,161,0,1,3,30,7,227,0,1,2,106,6,145,0,1,3,30,7,209,0,1,2,106,6,127,0,1,3,30,8,73,0,1,2,106,6,247,0,1,3,30,8,98,0,1,3,32,0,0,0,1,2,106,7,16,0,1,3,30,7,142,0,1,3,32,254,161,0,1,2,106,6,32,0,1,2,101,254,161,0,1,3,31,7,143,0,1,2,114,6,33,0,1,3,31,7,227,0,1,2,114,6,145,0,1,3,31,7,75,0,1,3,31,0,0,0,1,2,114,5,221,0,1,3,31,5,182,0,1,3,31,254,161,0,1,2,114,4,72,0,1,2,114,254,161,0,1,2,231,254,161,0,1,2,88,254,161,0,1,2,236,7,227,0,1,2,116,6,145,0,1,2,88,0,0,0,1,3,23,7,143,0,1,2,167,6,33,0,1,3,23,7,227,0,1,2,167,6,145,0,1,3,23,7,75,0,1,3,23,0,0,0,1,2,167,5,221,0,1,2,167,0,0,0,1,3,23,5,182,0,1,3,23,254,161,0,1,2,167,4,72,0,1,2,167,254,161,0,1,2,61,5,182,0,1,2,61,254,161,0,1,2,1,4,72,0,1,2,61,7,227,0,1,2,1,6,145,0,1,2,61,7,75,0,1,2,61,0,0,0,1,2,1,5,221,0,1,0,183,254,19,0,1,2,51,5,182,0,1,2,51,254,20,0,1,1,49,5,70,0,1,1,177,254,20,0,1,2,106,4,72,0,1,3,30,6,208,0,1,3,32,254,62,0,1,2,106,5,97,0,1,2,101,254,62,0,1,2,48,4,72,0,1,2,63,0,0,0,1,4,89,5,182,0,1,4,92,0,0,0,1,1,2,7,141,0,1,1,164,0,0,0,1,2,115,7,141,0,1,2,114,0,0,0,1,2,223,5,182,0,1,2,223,254,123,0,1,3,3,5,182,0,1,3,3,254,127,0,1,2,213,5,182,0,1,2,213,0,0,0,1,2,209,5,182,0,1,2,209,0,0,0,1,2,133,5,182,0,1,2,144,0,0,0,1,2,113,5,182,0,1,2,101,0,0,0,1,2,236,5,182,0,1,2,231,0,0,0,1,2,129,5,182,0,1,2,53,5,182,0,1,1,98,0,0,0,1,3,30,5,182,0,1,1,86,7,143,0,1,1,86,7,142,0,1,1,86,7,75,0,1,1,86,6,208,0,1,1,86,7,85,0,1,1,86,254,62,0,1,1,86,7,80,0,1,2,104,5,182,0,1,2,104,254,127,0,1,1,86,7,227,0,1,1,86,254,161,0,1,2,72,5,182,0,1,2,72,0,0,0,1,1,86,7,65,0,1,2,57,4,72,0,1,2,57,254,62,0,1,2,69,4,72,0,1,2,97,254,62,0,1,1,2,5,226,0,1,1,6,254,62,0,1,2,116,4,72,0,1,2,88,254,62,0,1,2,95,4,72,0,1,4,115,4,72,0,1,2,95,6,32,0,1,2,95,5,231,0,1,2,95,5,226,0,1,2,97,254,20,0,1,2,146,6,31,0,1,3,148,6,31,0,1,1,86,5,182,0,1,1,86,0,0,0,1,2,87,4,74,0,1,2,87,0,0,0,1,1,226,1,68,0,1,0,20,4,74,0,1,2,25,4,74,0,1,2,25,0,0,0,1,1,127,2,154,0,1,1,162,4,74,0,1,1,162,0,0,0,1,1,0,2,155,0,1,0,28,4,74,0,1,2,4,4,74,0,1,2,4,0,0,0,1,1,95,2,155,0,1,2,131,2,155,0,1,1,3,5,18,0,1,1,3,0,0,0,1,0,4,2,155,0,1,1,20,4,74,0,1,1,20,0,0,0,1,0,13,2,156,0,1,0,32,4,74,0,1,2,131,4,74,0,1,2,131,0,0,0,1,2,131,2,37,0,1,2,132,4,74,0,1,2,132,0,0,0,1,2,148,2,155,0,1,0,246,4,74,0,1,0,246,0,0,0,1,0,10,3,137,0,1,0,22,4,74,0,1,1,250,4,74,0,1,1,250,0,0,0,1,1,93,2,156,0,1,1,241,4,74,0,1,1,241,0,0,0,1,1,100,2,156,0,1,1,240,4,74,0,1,1,240,0,0,0,1,1,67,2,155,0,1,0,27,4,74,0,1,2,128,4,74,0,1,2,128,0,0,0,1,2,128,2,37,0,1,0,25,4,74,0,1,2,119,4,74,0,1,2,119,0,0,0,1,2,119,2,155,0,1,1,0,4,74,0,1,1,0,0,0,0,1,1,0,2,37,0,1,1,190,4,74,0,1,1,190,0,0,0,1,1,92,2,156,0,1,0,21,4,74,0,1,2,102,4,74,0,1,2,102,0,0,0,1,2,103,2,155,0,1,2,93,4,74,0,1,2,93,0,0,0,1,2,93,2,37,0,1,0,26,4,74,0,1,2,113,4,74,0,1,2,113,0,0,0,1,2,67,3,90,0,1,2,95,4,74,0,1,2,95,0,0,0,1,2,96,3,77,0,1,0,19,4,74,0,1,1,233,4,74,0,1,1,233,0,0,0,1,1,233,2,37,0,1,2,55,4,74,0,1,2,55,0,0,0,1,1,9,1,247,0,1,0,23,4,74,0,1,2,104,4,74,0,1,2,104,0,0,0,1,2,78,2,154,0,1,0,24,4,74,0,1,1,254,4,74,0,1,1,254,0,0,0,1,1,85,2,155,0,1,0,18,4,74,0,1,2,208,4,74,0,1,2,208,0,0,0,1,5,64,4,212,0,1,3,37,1,193,0,1,0,213,5,93,0,1,2,137,4,74,0,1,2,137,0,0,0,1,2,169,2,152,0,1,0,29,4,74,0,1,0,43,254,20,0,1,1,10,254,62,0,1,1,2,4,72,0,1,1,10,254,161,0,1,3,179,0,0,0,1,1,10,0,0,0,1,4,238,6,31,0,1,1,47,0,0,0,1,3,182,6,31,0,1,2,62,6,31,0,1,1,44,0,0,0,1,3,178,6,31,0,1,3,178,0,0,0,1,6,103,0,0,0,1,2,4,6,31,0,1,4,181,6,31,0,1,3,187,0,0,0,1,6,100,6,31,0,1,6,100,0,0,0,1,0,0,0,10,0,122,0,42,0,5,68,70,76,84,1,50,99,121,114,108,1,62,103,114,101,107,1,54,104,101,98,114,1,58,108,97,116,110,1,78,0,39,1,92,1,100,2,76,1,108,1,108,1,116,1,124,1,132,1,140,1,148,1,148,1,156,1,164,1,172,1,180,1,188,1,188,1,196,1,196,1,204,1,212,1,236,1,220,1,228,1,236,2,86,1,244,1,244,2,96,1,252,2,4,2,12,2,20,2,28,2,36,2,44,2,52,2,60,2,68,0,32,97,97,108,116,2,164,99,99,109,112,2,172,99,99,109,112,2,230,99,99,109,112,2,188,99,99,109,112,2,198,99,99,109,112,2,218,100,110,111,109,2,26,102,114,97,99,2,208,108,105,103,97,2,32,108,110,117,109,2,38,108,111,99,108,2,44,108,111,99,108,2,50,108,111,99,108,2,56,108,111,99,108,2,62,108,111,99,108,2,68,108,111,99,108,2,74,108,111,99,108,2,80,108,111,99,108,2,86,108,111,99,108,2,92,110,117,109,114,2,98,111,110,117,109,2,104,111,114,100,110,2,110,112,110,117,109,2,116,115,97,108,116,2,180,115,115,48,49,2,180,115,115,48,50,2,122,115,115,48,51,2,128,115,115,48,52,2,134,115,117,98,115,2,140,115,117,112,115,2,146,116,110,117,109,2,152,122,101,114,111,2,158,2,140,0,0,2,48,0,0,2,88,0,0,2,128,0,2,77,75,68,32,2,172,83,82,66,32,2,218,4,100,0,7,65,80,80,72,4,144,67,65,84,32,4,190,73,80,80,72,4,236,77,65,72,32,5,26,77,79,76,32,5,72,78,65,86,32,5,118,82,79,77,32,5,164,0,1,0,0,0,1,7,32,0,3,0,0,0,1,6,178,0,1,0,0,0,1,3,94,0,4,0,0,0,1,4,4,0,4,0,0,0,1,2,242,0,4,0,0,0,1,3,220,0,1,0,0,0,1,3,170,0,1,0,0,0,1,2,238,0,1,0,0,0,1,2,244,0,6,0,0,0,1,2,212,0,4,0,0,0,1,2,170,0,4,0,0,0,1,2,170,0,1,0,0,0,1,2,226,0,1,0,0,0,1,2,98,0,1,0,0,0,1,5,226,0,1,0,0,0,1,5,44,0,1,0,0,0,1,2,80,0,1,0,0,0,1,2,78,0,1,0,0,0,1,2,76,0,1,0,0,0,1,2,74,0,1,0,0,0,1,2,176,0,1,0,0,0,1,2,64,0,1,0,0,0,1,5,24,0,1,0,0,0,1,5,62,0,1,0,0,0,1,5,100,0,4,0,0,0,1,2,66,0,1,0,0,0,1,2,30,0,1,0,0,0,1,2,134,0,1,0,0,0,1,5,164,0,1,0,0,0,1,2,12,0,6,0,0,0,2,2,144,3,0,0,6,0,0,0,2,2,152,2,170,0,6,0,0,0,2,2,178,2,196,0,0,0,1,0,22,0,0,0,1,0,34,0,0,0,1,0,30,0,0,0,1,0,16,0,0,0,1,0,12,0,0,0,1,0,15,0,0,0,1,0,11,0,0,0,1,0,18,0,0,0,1,0,9,0,0,0,1,0,8,0,0,0,1,0,10,0,0,0,1,0,17,0,0,0,1,0,21,0,0,0,1,0,33,0,0,0,1,0,28,0,0,0,1,0,31,0,0,0,1,0,36,0,0,0,1,0,37,0,0,0,1,0,38,0,0,0,1,0,19,0,0,0,1,0,20,0,0,0,1,0,32,0,0,0,1,0,35,0,0,0,2,0,0,0,1,0,0,0,2,0,2,0,5,0,0,0,2,0,36,0,37,0,0,0,3,0,2,0,5,0,6,0,0,0,3,0,2,0,5,0,7,0,0,0,3,0,23,0,24,0,25,0,0,0,4,0,2,0,5,0,2,0,5,0,0,0,6,0,2,0,5,0,2,0,5,0,2,0,5,0,0,255,255,0,19,0,0,0,3,0,6,0,7,0,8,0,9,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,19,0,0,0,4,0,6,0,7,0,8,0,9,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,19,0,0,0,1,0,6,0,7,0,8,0,9,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,1,0,6,0,7,0,8,0,9,0,14,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,1,0,6,0,7,0,8,0,9,0,18,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,1,4,240,1,245,0,1,5,38,4,19,0,1,4,234,2,4,0,1,5,26,4,39,0,1,5,10,255,236,0,1,4,250,255,236,0,1,4,216,4,59,0,1,4,216,2,125,0,1,9,36,0,1,4,216,0,1,9,40,0,1,4,212,0,1,9,72,0,1,4,254,0,1,9,182,0,2,5,2,5,12,0,1,4,228,0,2,4,190,4,194,0,2,5,2,0,4,1,72,1,73,1,35,1,36,0,2,5,0,0,4,3,146,3,180,3,147,3,181,0,2,4,254,0,4,3,145,3,144,3,177,3,178,0,2,4,252,0,4,0,108,0,124,0,108,0,124,0,2,5,52,0,5,3,186,3,187,3,188,3,189,3,179,0,2,5,104,0,6,3,175,3,176,4,114,4,111,4,112,4,115,0,3,0,0,0,1,5,86,0,1,5,114,0,1,0,0,0,3,0,3,0,1,4,198,0,1,4,90,0,0,0,1,0,0,0,26,0,3,0,1,4,252,0,1,4,72,0,0,0,1,0,0,0,27,0,3,0,1,4,64,0,1,4,168,0,0,0,1,0,0,0,29,0,3,0,1,4,46,0,1,4,158,0,0,0,1,0,0,0,29,0,2,5,40,0,8,3,148,3,182,3,149,3,183,3,150,3,184,3,151,3,185,0,3,0,0,0,1,4,230,0,2,4,246,5,2,0,1,0,0,0,4,0,1,9,2,0,9,4,106,4,110,4,114,4,118,4,122,4,126,4,130,4,134,4,138,0,1,9,76,0,10,4,142,4,146,4,150,4,174,4,154,4,158,4,162,4,166,4,180,4,170,0,0,255,255,0,19,0,0,0,5,0,6,0,7,0,8,0,9,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,1,0,6,0,7,0,8,0,9,0,10,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,2,0,6,0,7,0,8,0,9,0,11,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,1,0,6,0,7,0,8,0,9,0,12,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,2,0,6,0,7,0,8,0,9,0,13,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,2,0,6,0,7,0,8,0,9,0,15,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,2,0,6,0,7,0,8,0,9,0,16,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,0,255,255,0,20,0,0,0,2,0,6,0,7,0,8,0,9,0,17,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,29,0,30,0,31,0,2,3,162,0,15,4,100,4,102,4,104,3,119,0,123,0,116,0,117,2,55,2,56,3,120,2,57,2,58,3,121,4,105,2,23,0,2,3,78,0,20,4,48,4,49,4,50,4,51,4,52,4,53,4,54,4,55,4,56,4,57,4,68,4,69,4,70,4,71,4,72,4,73,4,74,4,75,4,76,4,77,0,2,3,48,0,20,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,4,79,4,80,4,81,4,82,4,83,4,84,4,85,4,86,4,87,4,88,0,2,3,18,0,20,4,79,4,80,4,81,4,82,4,83,4,84,4,85,4,86,4,87,4,88,4,68,4,69,4,70,4,71,4,72,4,73,4,74,4,75,4,76,4,77,0,2,3,22,0,22,4,101,4,103,4,106,4,89,4,90,4,91,4,92,4,93,4,94,4,95,4,96,4,97,4,98,4,107,3,193,3,194,3,195,3,196,3,197,3,198,3,199,3,200,0,2,3,20,0,24,3,152,3,153,3,154,3,155,3,156,3,157,3,158,3,159,3,160,3,161,3,163,3,164,3,165,3,168,3,169,3,170,3,171,3,172,3,173,3,174,3,192,3,166,3,167,3,162,0,1,4,134,0,48,3,18,3,24,3,30,4,118,3,248,4,6,4,20,4,34,4,48,4,62,4,76,4,90,4,104,3,36,3,42,3,48,3,54,3,240,3,60,3,66,3,72,3,78,3,84,3,90,3,96,3,102,3,108,3,114,3,120,3,126,3,132,3,138,3,144,3,150,3,156,3,162,3,168,3,174,3,180,3,186,3,192,3,198,3,204,3,210,3,216,3,222,3,228,3,234,0,2,4,96,0,74,2,22,0,108,3,152,3,153,0,124,0,108,3,186,3,193,3,175,3,176,3,194,3,195,3,196,0,124,3,198,3,199,3,200,3,154,3,155,3,156,3,157,3,148,3,182,3,149,3,183,3,187,3,188,3,189,3,179,3,158,3,159,3,160,3,163,3,164,3,165,3,146,3,180,3,147,3,181,1,72,1,73,3,151,3,185,3,168,3,145,3,169,3,144,3,170,3,177,3,178,3,171,3,172,3,173,3,191,4,111,4,112,3,174,3,192,3,166,3,167,4,115,1,35,1,36,3,162,4,38,4,39,4,40,4,41,4,42,4,43,4,44,4,45,4,46,4,47,0,1,0,1,1,202,0,1,0,1,0,18,0,1,0,1,0,19,0,1,0,1,1,65,0,1,4,70,0,1,4,78,0,1,4,126,0,1,4,138,0,2,0,1,4,68,4,77,0,0,0,2,0,1,4,58,4,67,0,0,0,2,0,1,0,19,0,28,0,0,0,1,0,2,0,47,0,79,0,5,4,58,4,66,4,40,4,46,4,52,0,4,4,100,4,110,4,120,4,130,0,4,4,130,4,140,4,150,4,160,0,1,0,4,1,31,1,32,3,109,3,110,0,1,0,4,0,252,0,253,1,6,1,7,0,1,0,4,1,95,1,115,1,126,1,147,0,1,0,4,0,36,0,50,0,68,0,82,0,1,0,1,2,22,0,1,0,2,0,36,0,68,0,1,0,2,0,50,0,82,0,1,4,98,0,1,4,100,0,1,4,102,0,1,4,104,0,1,4,106,0,1,4,108,0,1,4,110,0,1,4,112,0,1,4,114,0,1,0,5,0,74,0,223,0,225,0,227,0,229,0,2,0,1,4,38,4,47,0,0,0,1,4,114,0,1,4,116,0,1,4,118,0,1,4,120,0,1,4,122,0,1,4,124,0,1,4,126,0,1,4,128,0,2,4,142,4,130,0,2,4,144,4,130,0,1,0,6,0,76,0,77,0,241,1,238,1,240,3,53,0,1,0,4,2,53,4,14,4,15,4,16,0,2,0,2,3,116,3,116,0,0,4,1,4,13,0,1,0,1,0,8,0,198,0,199,0,218,0,219,0,240,0,241,1,51,1,52,0,2,0,2,0,19,0,28,0,0,4,79,4,88,0,10,0,2,0,2,4,48,4,57,0,0,4,68,4,77,0,10,0,2,0,2,0,19,0,28,0,0,4,48,4,57,0,10,0,1,0,15,0,11,0,12,0,14,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,32,0,81,0,1,0,22,0,11,0,12,0,14,0,19,0,20,0,21,0,22,0,23,0,24,0,25,0,26,0,27,0,28,0,32,0,75,0,78,0,79,0,80,0,81,0,83,0,86,0,87,0,1,0,24,0,44,0,45,0,142,0,143,0,144,0,145,0,234,0,236,0,238,0,240,0,242,0,243,0,245,1,89,1,102,1,118,1,160,1,161,1,162,2,182,2,197,3,50,3,52,3,150,0,2,4,100,4,101,0,2,4,102,4,103,0,2,4,104,4,106,0,2,4,105,4,107,0,2,2,23,3,197,0,2,3,150,3,161,0,2,3,184,4,114,0,2,0,19,4,68,0,2,0,20,4,69,0,2,0,21,4,70,0,2,0,22,4,71,0,2,0,23,4,72,0,2,0,24,4,73,0,2,0,25,4,74,0,2,0,26,4,75,0,2,0,27,4,76,0,2,0,28,4,77,0,2,4,48,4,79,0,2,4,49,4,80,0,2,4,50,4,81,0,2,4,51,4,82,0,2,4,52,4,83,0,2,4,53,4,84,0,2,4,54,4,85,0,2,4,55,4,86,0,2,4,56,4,87,0,2,4,57,4,88,0,2,4,48,4,68,0,2,4,49,4,69,0,2,4,50,4,70,0,2,4,51,4,71,0,2,4,52,4,72,0,2,4,53,4,73,0,2,4,54,4,74,0,2,4,55,4,75,0,2,4,56,4,76,0,2,4,57,4,77,0,3,3,130,3,131,3,132,0,6,0,123,4,39,4,49,4,59,4,80,4,90,0,6,0,116,4,40,4,50,4,60,4,81,4,91,0,6,0,117,4,41,4,51,4,61,4,82,4,92,0,6,2,55,4,42,4,52,4,62,4,83,4,93,0,6,2,56,4,43,4,53,4,63,4,84,4,94,0,6,3,120,4,44,4,54,4,64,4,85,4,95,0,6,2,57,4,45,4,55,4,65,4,86,4,96,0,6,2,58,4,46,4,56,4,66,4,87,4,97,0,6,3,121,4,47,4,57,4,67,4,88,4,98,0,7,3,119,4,38,4,48,4,58,4,78,4,79,4,89,0,2,0,10,0,11,0,12,0,0,0,14,0,14,0,2,0,19,0,28,0,3,0,32,0,32,0,13,0,81,0,81,0,14,0,240,0,241,0,15,1,11,1,11,0,17,4,48,4,57,0,18,4,68,4,77,0,28,4,79,4,88,0,38,0,1,0,74,0,18,0,36,0,44,0,45,0,50,0,68,0,74,0,75,0,76,0,77,0,78,0,79,0,80,0,82,0,83,0,86,0,87,0,142,0,143,0,144,0,145,0,198,0,199,0,218,0,219,0,223,0,225,0,227,0,229,0,234,0,236,0,238,0,242,0,243,0,245,0,252,0,253,1,6,1,7,1,31,1,32,1,51,1,52,1,89,1,95,1,102,1,115,1,118,1,126,1,147,1,160,1,161,1,162,1,202,1,238,1,240,2,182,2,197,3,50,3,52,3,53,3,109,3,110,3,150,4,58,4,59,4,60,4,61,4,62,4,63,4,64,4,65,4,66,4,67,1,1,0,2,0,121,0,1,0,1,0,79,1,0,0,2,0,121,0,1,0,1,0,47,3,138,0,2,0,73,3,139,0,2,0,76,3,140,0,2,0,79,3,141,0,3,0,73,0,76,3,142,0,3,0,73,0,79,0,1,0,1,0,73,0,0,0,2,0,121,0,1,0,47,0,1,0,0,0,14,0,0,0,2,0,121,0,1,0,79,0,1,0,0,0,13,3,125,0,4,4,8,4,6,4,2,3,124,0,4,4,8,4,6,4,1,3,123,0,4,4,8,4,5,4,2,3,122,0,4,4,8,4,5,4,1,3,129,0,4,4,8,4,6,4,2,3,128,0,4,4,8,4,6,4,1,3,127,0,4,4,8,4,5,4,2,3,126,0,4,4,8,4,5,4,1,0,1,0,2,1,133,1,145,3,234,0,2,4,33,3,238,0,2,4,33,3,248,0,2,4,33,3,249,0,2,4,33,3,250,0,2,4,33,3,252,0,2,4,33,3,253,0,2,4,33,3,254,0,2,4,33,3,255,0,2,4,33,0,1,0,9,3,201,3,205,3,218,3,220,3,221,3,224,3,225,3,226,3,227,0,198,0,2,4,16,0,218,0,2,4,16,0,240,0,2,4,16,1,51,0,2,4,16,0,199,0,2,4,16,0,219,0,2,4,16,0,241,0,2,4,16,1,52,0,2,4,16,3,111,0,2,4,16,3,112,0,2,4,16,3,113,0,3,4,16,1,76,3,114,0,3,4,16,1,76,0,1,0,10,0,36,0,40,0,44,0,50,0,56,0,68,0,72,0,76,0,82,0,88,0,0,0,1,0,1,0,8,0,3,0,0,0,20,0,3,0,0,0,44,0,2,119,100,116,104,1,1,0,0,119,103,104,116,1,0,0,1,105,116,97,108,1,28,0,2,0,6,0,18,0,34,0,1,0,0,0,2,1,26,0,100,0,0,0,3,0,1,0,2,1,4,1,144,0,0,2,188,0,0,0,3,0,2,0,2,1,29,0,0,0,0,0,1,0,0,0,0};
 }
 
 #endif
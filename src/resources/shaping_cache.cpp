@@ -0,0 +1,61 @@
+#include "shaping_cache.h"
+
+namespace Flint {
+
+ShapingCache::ShapingCache(size_t capacity) : cache(capacity) {
+}
+
+std::shared_ptr<const ShapedParagraph> ShapingCache::find(uint32_t font_size, std::u32string_view text) {
+    auto paragraph = cache.find(KeyView(font_size, text));
+    if (paragraph == nullptr) {
+        return nullptr;
+    }
+
+    return *paragraph;
+}
+
+void ShapingCache::insert(uint32_t font_size,
+                          std::u32string_view text,
+                          std::shared_ptr<const ShapedParagraph> paragraph) {
+    // A zero capacity disables the cache, while the LRU cache keeps the most recently used entry.
+    if (cache.get_budget() == 0) {
+        return;
+    }
+
+    cache.insert({font_size, std::u32string(text)}, std::move(paragraph));
+}
+
+void ShapingCache::set_capacity(size_t new_capacity) {
+    cache.set_budget(new_capacity);
+
+    if (new_capacity == 0) {
+        cache.clear();
+    }
+}
+
+size_t ShapingCache::get_capacity() const {
+    return cache.get_budget();
+}
+
+ShapingCacheStats ShapingCache::get_stats() const {
+    auto cache_stats = cache.get_stats();
+
+    ShapingCacheStats stats;
+    stats.hits = cache_stats.hits;
+    stats.misses = cache_stats.misses;
+    stats.evictions = cache_stats.evictions;
+    stats.entry_count = cache_stats.entry_count;
+    stats.capacity = cache_stats.budget;
+
+    return stats;
+}
+
+void ShapingCache::reset_stats() {
+    cache.reset_stats();
+}
+
+void ShapingCache::clear() {
+    cache.clear();
+}
+
+} // namespace Flint
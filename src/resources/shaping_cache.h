@@ -0,0 +1,95 @@
+#ifndef FLINT_SHAPING_CACHE_H
+#define FLINT_SHAPING_CACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+
+#include "../common/lru_cache.h"
+
+namespace Flint {
+
+struct ShapedParagraph;
+
+struct ShapingCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+
+    size_t entry_count = 0;
+    size_t capacity = 0;
+};
+
+/// An LRU cache for shaped paragraphs, keyed by (font size in pixels, paragraph text).
+/// Direction and script are resolved from the text itself, so a font, a size and a text identify a shaping result.
+class ShapingCache {
+public:
+    static constexpr size_t DEFAULT_CAPACITY = 1024;
+
+    explicit ShapingCache(size_t capacity = DEFAULT_CAPACITY);
+
+    /// Returns nullptr if the paragraph is not cached. A hit marks the entry as the most recently used one.
+    /// Doesn't allocate, as the key is looked up by view.
+    std::shared_ptr<const ShapedParagraph> find(uint32_t font_size, std::u32string_view text);
+
+    /// Caches a shaped paragraph, evicting the least recently used entries if the capacity is exceeded.
+    void insert(uint32_t font_size, std::u32string_view text, std::shared_ptr<const ShapedParagraph> paragraph);
+
+    /// Set the maximum number of cached paragraphs.
+    void set_capacity(size_t new_capacity);
+
+    size_t get_capacity() const;
+
+    ShapingCacheStats get_stats() const;
+
+    void reset_stats();
+
+    void clear();
+
+private:
+    struct Key {
+        uint32_t font_size;
+        std::u32string text;
+    };
+
+    /// For lookups without copying the text into a key.
+    struct KeyView {
+        uint32_t font_size;
+        std::u32string_view text;
+
+        KeyView(uint32_t font_size, std::u32string_view text) : font_size(font_size), text(text) {
+        }
+
+        KeyView(const Key &key) : font_size(key.font_size), text(key.text) {
+        }
+    };
+
+    struct KeyHash {
+        using is_transparent = void;
+
+        size_t operator()(KeyView key) const {
+            return std::hash<std::u32string_view>()(key.text) ^ ((size_t)key.font_size * 0x9e3779b97f4a7c15ull);
+        }
+    };
+
+    struct KeyEqual {
+        using is_transparent = void;
+
+        bool operator()(KeyView a, KeyView b) const {
+            return a.font_size == b.font_size && a.text == b.text;
+        }
+    };
+
+    struct ParagraphCount {
+        size_t operator()(const std::shared_ptr<const ShapedParagraph> &) const {
+            return 1;
+        }
+    };
+
+    LruCache<Key, std::shared_ptr<const ShapedParagraph>, ParagraphCount, KeyHash, KeyEqual> cache;
+};
+
+} // namespace Flint
+
+#endif // FLINT_SHAPING_CACHE_H
@@ -0,0 +1,71 @@
+#include "stroked_glyph_cache.h"
+
+#include <bit>
+
+namespace Flint {
+
+size_t StrokedGlyphCache::KeyHash::operator()(const Key &key) const {
+    uint64_t hash = (uint64_t)key.font_size << 16 | key.glyph_index;
+    hash = hash * 0x9e3779b97f4a7c15ull ^ std::bit_cast<uint32_t>(key.stroke.width);
+    hash = hash * 0x9e3779b97f4a7c15ull ^ std::bit_cast<uint32_t>(key.stroke.skew);
+    hash = hash * 0x9e3779b97f4a7c15ull ^ (uint64_t)key.stroke.join;
+    return hash;
+}
+
+size_t StrokedGlyphCache::OutlineSize::operator()(const Pathfinder::Outline &outline) const {
+    size_t point_count = 0;
+    for (const auto &contour : outline.contours) {
+        point_count += contour.points.size();
+    }
+
+    // Each point comes with a flag.
+    return sizeof(Pathfinder::Outline) + point_count * (sizeof(Vec2F) + sizeof(Pathfinder::PointFlag));
+}
+
+StrokedGlyphCache::StrokedGlyphCache(size_t memory_budget) : cache(memory_budget) {
+}
+
+const Pathfinder::Outline *StrokedGlyphCache::find(uint16_t glyph_index,
+                                                   uint32_t font_size,
+                                                   const GlyphStroke &stroke) {
+    return cache.find(Key{glyph_index, font_size, stroke});
+}
+
+const Pathfinder::Outline &StrokedGlyphCache::insert(uint16_t glyph_index,
+                                                     uint32_t font_size,
+                                                     const GlyphStroke &stroke,
+                                                     Pathfinder::Outline outline) {
+    return cache.insert({glyph_index, font_size, stroke}, std::move(outline));
+}
+
+void StrokedGlyphCache::set_memory_budget(size_t new_budget) {
+    cache.set_budget(new_budget);
+}
+
+size_t StrokedGlyphCache::get_memory_budget() const {
+    return cache.get_budget();
+}
+
+GlyphCacheStats StrokedGlyphCache::get_stats() const {
+    auto cache_stats = cache.get_stats();
+
+    GlyphCacheStats stats;
+    stats.hits = cache_stats.hits;
+    stats.misses = cache_stats.misses;
+    stats.evictions = cache_stats.evictions;
+    stats.entry_count = cache_stats.entry_count;
+    stats.memory_usage = cache_stats.size;
+    stats.memory_budget = cache_stats.budget;
+
+    return stats;
+}
+
+void StrokedGlyphCache::reset_stats() {
+    cache.reset_stats();
+}
+
+void StrokedGlyphCache::clear() {
+    cache.clear();
+}
+
+} // namespace Flint
@@ -0,0 +1,82 @@
+#ifndef FLINT_STROKED_GLYPH_CACHE_H
+#define FLINT_STROKED_GLYPH_CACHE_H
+
+#include <pathfinder/prelude.h>
+
+#include <cstdint>
+
+#include "../common/lru_cache.h"
+#include "glyph_cache.h"
+
+namespace Flint {
+
+/// How a glyph outline is stroked. All lengths are in the glyph's baseline coordinates.
+struct GlyphStroke {
+    float width = 0;
+
+    Pathfinder::LineJoin join = Pathfinder::LineJoin::Round;
+
+    /// Horizontal shear applied before stroking, e.g. for italic text.
+    float skew = 0;
+
+    bool operator==(const GlyphStroke &other) const {
+        return width == other.width && join == other.join && skew == other.skew;
+    }
+};
+
+/// An LRU cache for stroked glyph outlines, keyed by (glyph index, font size in pixels, stroke).
+/// Stroking converts a glyph outline into a fillable one, which is too slow to do for every glyph in every frame.
+class StrokedGlyphCache {
+public:
+    static constexpr size_t DEFAULT_MEMORY_BUDGET = 4 * 1024 * 1024;
+
+    explicit StrokedGlyphCache(size_t memory_budget = DEFAULT_MEMORY_BUDGET);
+
+    /// Returns nullptr if the outline is not cached. A hit marks the entry as the most recently used one.
+    /// @note The returned pointer is only valid until the next insertion.
+    const Pathfinder::Outline *find(uint16_t glyph_index, uint32_t font_size, const GlyphStroke &stroke);
+
+    /// Caches a stroked outline, to be filled with the winding rule.
+    /// Evicts the least recently used entries if the memory budget is exceeded.
+    /// @note The returned reference is only valid until the next insertion.
+    const Pathfinder::Outline &insert(uint16_t glyph_index,
+                                      uint32_t font_size,
+                                      const GlyphStroke &stroke,
+                                      Pathfinder::Outline outline);
+
+    void set_memory_budget(size_t new_budget);
+
+    size_t get_memory_budget() const;
+
+    GlyphCacheStats get_stats() const;
+
+    void reset_stats();
+
+    void clear();
+
+private:
+    struct Key {
+        uint16_t glyph_index;
+        uint32_t font_size;
+        GlyphStroke stroke;
+
+        bool operator==(const Key &other) const {
+            return glyph_index == other.glyph_index && font_size == other.font_size && stroke == other.stroke;
+        }
+    };
+
+    struct KeyHash {
+        size_t operator()(const Key &key) const;
+    };
+
+    /// Estimated memory usage in bytes.
+    struct OutlineSize {
+        size_t operator()(const Pathfinder::Outline &outline) const;
+    };
+
+    LruCache<Key, Pathfinder::Outline, OutlineSize, KeyHash> cache;
+};
+
+} // namespace Flint
+
+#endif // FLINT_STROKED_GLYPH_CACHE_H
@@ -1,5 +1,6 @@
 #include "engine.h"
 
+#include <algorithm>
 #include <sstream>
 
 #include "../common/utils.h"
@@ -46,4 +47,52 @@ float Engine::get_fps() const {
     return fps;
 }
 
+void Engine::set_on_demand_rendering(bool enabled) {
+    on_demand_rendering = enabled;
+
+    // Draw the current state when switching.
+    request_redraw();
+}
+
+bool Engine::is_on_demand_rendering() const {
+    return on_demand_rendering;
+}
+
+void Engine::set_max_fps(float new_max_fps) {
+    max_fps = std::max(new_max_fps, 0.0f);
+}
+
+float Engine::get_max_fps() const {
+    return max_fps;
+}
+
+void Engine::request_redraw(double delay) {
+    auto time = std::chrono::steady_clock::now() +
+                std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(delay));
+
+    if (!redraw_time || time < *redraw_time) {
+        redraw_time = time;
+    }
+}
+
+double Engine::get_redraw_wait_time() const {
+    if (!redraw_time) {
+        return -1;
+    }
+
+    auto wait_time = std::chrono::duration<double>(*redraw_time - std::chrono::steady_clock::now()).count();
+
+    return std::max(wait_time, 0.0);
+}
+
+bool Engine::take_redraw_request() {
+    if (!redraw_time || *redraw_time > std::chrono::steady_clock::now()) {
+        return false;
+    }
+
+    redraw_time.reset();
+
+    return true;
+}
+
 } // namespace Flint
@@ -2,6 +2,7 @@
 #define FLINT_ENGINE_H
 
 #include <chrono>
+#include <optional>
 
 namespace Flint {
 
@@ -28,6 +29,28 @@ public:
 
     float get_fps() const;
 
+    /// In the on-demand rendering mode, the main loop sleeps until there's input, a window is resized or a frame
+    /// is requested, instead of processing and drawing the scene tree continuously.
+    void set_on_demand_rendering(bool enabled);
+
+    bool is_on_demand_rendering() const;
+
+    /// Cap the frame rate, e.g. for animating content in the on-demand rendering mode. Zero for no cap.
+    void set_max_fps(float new_max_fps);
+
+    float get_max_fps() const;
+
+    /// Request a frame in the on-demand rendering mode, at the latest after the delay in seconds.
+    /// Nodes request frames when they change through their setters. Call it after changing them in other ways.
+    /// @note Call it from the main thread.
+    void request_redraw(double delay = 0);
+
+    /// Seconds until the requested frame is due, or a negative value if no frame has been requested.
+    double get_redraw_wait_time() const;
+
+    /// If the requested frame is due. If so, the request is cleared, so that only new requests cause more frames.
+    bool take_redraw_request();
+
 private:
 #if defined(_WIN32) || defined(__APPLE__)
     std::chrono::time_point<std::chrono::steady_clock> last_time_updated_fps;
@@ -37,6 +60,12 @@ private:
     float fps = 0;
     double elapsed = 0;
     double delta = 0;
+
+    bool on_demand_rendering = false;
+    float max_fps = 0;
+
+    /// Time of the earliest requested frame.
+    std::optional<std::chrono::steady_clock::time_point> redraw_time;
 };
 
 } // namespace Flint
@@ -2,30 +2,11 @@
 
 #include <pathfinder/prelude.h>
 
-#include <codecvt>
-#include <locale>
-
 #include "../nodes/sub_window.h"
 #include "render_server.h"
 
 namespace Flint {
 
-std::string cpp11_codepoint_to_utf8(char32_t codepoint) {
-    char utf8[4];
-    char *end_of_utf8;
-
-    char32_t const *from = &codepoint;
-
-    std::mbstate_t mbs;
-    std::codecvt_utf8<char32_t> ccv;
-
-    if (ccv.out(mbs, from, from + 1, from, utf8, utf8 + 4, end_of_utf8)) {
-        throw std::runtime_error("Bad codepoint-to-utf8 conversion!");
-    }
-
-    return {utf8, end_of_utf8};
-}
-
 void InputEvent::consume() {
     consumed = true;
 }
@@ -184,6 +165,55 @@ void InputServer::initialize_window_callbacks(uint8_t window_index) {
 
 void InputServer::clear_events() {
     input_queue.clear();
+    raw_input_queue.clear();
+}
+
+void InputServer::coalesce_events() {
+    if (!event_coalescing_enabled) {
+        return;
+    }
+
+    raw_input_queue = input_queue;
+
+    // Merge in place, keeping the last merged event at the back.
+    size_t count = 0;
+
+    for (const auto &event : raw_input_queue) {
+        if (count > 0) {
+            auto &last = input_queue[count - 1];
+
+            if (last.type == event.type && last.window_index == event.window_index) {
+                if (event.type == InputEventType::MouseMotion) {
+                    last.args.mouse_motion.position = event.args.mouse_motion.position;
+                    last.args.mouse_motion.relative += event.args.mouse_motion.relative;
+                    continue;
+                }
+
+                if (event.type == InputEventType::MouseScroll) {
+                    last.args.mouse_scroll.x_delta += event.args.mouse_scroll.x_delta;
+                    last.args.mouse_scroll.y_delta += event.args.mouse_scroll.y_delta;
+                    continue;
+                }
+            }
+        }
+
+        input_queue[count++] = event;
+    }
+
+    input_queue.resize(count);
+}
+
+void InputServer::set_event_coalescing_enabled(bool enabled) {
+    event_coalescing_enabled = enabled;
+}
+
+bool InputServer::get_event_coalescing_enabled() const {
+    return event_coalescing_enabled;
+}
+
+const std::vector<InputEvent> &InputServer::get_raw_events() const {
+    // Empty unless the queue of this frame has been coalesced.
+    return raw_input_queue.empty() ? input_queue : raw_input_queue;
 }
 
 std::string InputServer::get_clipboard(uint8_t window_index) {
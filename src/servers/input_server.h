@@ -76,9 +76,6 @@ private:
     bool consumed = false;
 };
 
-/// Unicode codepoint to UTF8 string.
-std::string cpp11_codepoint_to_utf8(char32_t codepoint);
-
 /// wstring to UTF8 string.
 std::string ws_to_utf8(std::wstring const &s);
 
@@ -115,6 +112,21 @@ public:
 
     void clear_events();
 
+    /// Merge each run of consecutive mouse motion events of a window into one event, with the last position and the
+    /// sum of the relative motions, and each run of scroll events into one with the sum of the deltas.
+    /// The other events and the order of the events stay the same. Does nothing unless coalescing is enabled.
+    void coalesce_events();
+
+    /// Coalesce the events of each frame before they're dispatched, so that the nodes don't handle every motion
+    /// of high-rate mice. Disabled by default.
+    void set_event_coalescing_enabled(bool enabled);
+
+    bool get_event_coalescing_enabled() const;
+
+    /// The events of this frame before coalescing, for nodes which need the full-rate input, e.g. to draw strokes.
+    /// The same as the input queue if the events haven't been coalesced.
+    const std::vector<InputEvent> &get_raw_events() const;
+
     std::string get_clipboard(uint8_t window_index);
     void set_clipboard(uint8_t window_index, std::string text);
 
@@ -138,6 +150,11 @@ private:
     GLFWcursor *resize_tlbr_cursor, *resize_trbl_cursor;
 
     std::set<KeyCode> keys_pressed;
+
+    bool event_coalescing_enabled = false;
+
+    /// Copy of the input queue before coalescing.
+    std::vector<InputEvent> raw_input_queue;
 };
 
 } // namespace Flint
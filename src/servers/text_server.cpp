@@ -1,24 +1,99 @@
 #include "text_server.h"
 
+#include "../resources/default_resource.h"
+
 namespace Flint {
 
-void TextServer::load_font_from_file(const std::string& file_path) {
+std::shared_ptr<FontFace> TextServer::load_font_from_file(const std::string &file_path) {
+    auto find = faces.find(file_path);
+    if (find != faces.end()) {
+        return find->second;
+    }
+
+    std::shared_ptr<FontFace> face;
+
+    auto file = std::make_unique<MappedFile>(file_path);
+    if (file->is_valid()) {
+        face = std::make_shared<FontFace>(std::move(file));
+    } else {
+        // Fall back to reading the file, e.g. for assets not backed by a real file.
+        face = std::make_shared<FontFace>(Pathfinder::load_file_as_bytes(file_path));
+    }
+    faces[file_path] = face;
+
+    return face;
+}
+
+std::shared_ptr<FontFace> TextServer::load_font_from_memory(const std::string &font_id,
+                                                            const std::vector<char> &bytes) {
+    auto find = faces.find(font_id);
+    if (find != faces.end()) {
+        return find->second;
+    }
+
+    auto face = std::make_shared<FontFace>(bytes);
+    faces[font_id] = face;
+
+    return face;
 }
 
-void TextServer::load_font_from_momery(const std::vector<char>& bytes) {
+std::shared_ptr<FontFace> TextServer::load_font_from_static_memory(const std::string &font_id,
+                                                                   const void *data,
+                                                                   size_t size) {
+    auto find = faces.find(font_id);
+    if (find != faces.end()) {
+        return find->second;
+    }
+
+    auto face = std::make_shared<FontFace>(data, size);
+    faces[font_id] = face;
+
+    return face;
 }
 
-std::shared_ptr<std::vector<char>> TextServer::get_font(std::string font_id) {
-    auto find = raw_font_cache.find(font_id);
-    if (find != raw_font_cache.end()) {
-        return raw_font_cache[font_id];
+std::shared_ptr<FontFace> TextServer::get_font(const std::string &font_id) {
+    auto find = faces.find(font_id);
+    if (find != faces.end()) {
+        return find->second;
     }
     return nullptr;
 }
 
+void TextServer::add_fallback_font(const std::shared_ptr<Font> &font) {
+    if (font == nullptr) {
+        return;
+    }
+
+    fallback_fonts.push_back(font);
+    fallback_version++;
+}
+
+void TextServer::clear_fallback_fonts() {
+    fallback_fonts.clear();
+    fallback_version++;
+}
+
+uint64_t TextServer::get_fallback_version() const {
+    return fallback_version;
+}
+
+std::shared_ptr<Font> TextServer::find_fallback_font(std::u32string_view codepoints) {
+    for (auto &font : fallback_fonts) {
+        if (font->get_face()->get_coverage().contains_all(codepoints)) {
+            return font;
+        }
+    }
+
+    return DefaultResource::get_singleton()->get_default_font();
+}
+
+GlyphDiskCache &TextServer::get_glyph_disk_cache() {
+    return glyph_disk_cache;
+}
+
 void TextServer::cleanup() {
-    font_cache.clear();
-    raw_font_cache.clear();
+    fallback_fonts.clear();
+    faces.clear();
 }
 
 } // namespace Flint
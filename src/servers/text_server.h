@@ -2,29 +2,64 @@
 #define FLINT_TEXT_SERVER_H
 
 #include <string>
+#include <string_view>
 #include <unordered_map>
 
 #include "../resources/font.h"
+#include "../resources/font_face.h"
+#include "../resources/glyph_disk_cache.h"
 
 namespace Flint {
 
+/// Owns all loaded font faces, so fonts using the same font data share the parsed font tables.
+/// Also manages the fallback chain used for text the primary font doesn't cover.
 class TextServer {
 public:
-    void load_font_from_file(const std::string& file_path);
+    static TextServer *get_singleton() {
+        static TextServer singleton;
+        return &singleton;
+    }
 
-    void load_font_from_momery(const std::vector<char>& bytes);
+    /// Load a font face from a file. A face that has been loaded from the same path is reused.
+    /// The file is memory-mapped read-only instead of being read into memory.
+    std::shared_ptr<FontFace> load_font_from_file(const std::string &file_path);
 
-    std::shared_ptr<std::vector<char>> get_font(std::string font_id);
+    /// Load a font face from a copy of the bytes. A face that has been loaded with the same ID is reused.
+    std::shared_ptr<FontFace> load_font_from_memory(const std::string &font_id, const std::vector<char> &bytes);
+
+    /// Load a font face using the data in place without copying, e.g. a font embedded in the binary.
+    /// The data must stay valid as long as the face is alive.
+    std::shared_ptr<FontFace> load_font_from_static_memory(const std::string &font_id, const void *data, size_t size);
+
+    /// Returns nullptr if no face has been loaded with this ID. File faces use the file path as ID.
+    std::shared_ptr<FontFace> get_font(const std::string &font_id);
+
+    /// Fallback fonts are tried in the order they're added, before the default font.
+    void add_fallback_font(const std::shared_ptr<Font> &font);
+
+    void clear_fallback_fonts();
+
+    /// Changes whenever the fallback chain changes, so that shaping results can be invalidated.
+    uint64_t get_fallback_version() const;
+
+    /// Find the first fallback font covering all the codepoints. Returns the default font if there's none.
+    std::shared_ptr<Font> find_fallback_font(std::u32string_view codepoints);
+
+    /// Decoded glyphs persisted across runs. Not used until a cache file is opened, and saved when the app quits.
+    GlyphDiskCache &get_glyph_disk_cache();
 
     void cleanup();
 
 private:
     std::string clipboard;
 
-    // Cache for raw font data.
-    std::unordered_map<std::string, std::shared_ptr<std::vector<char>>> raw_font_cache;
+    std::unordered_map<std::string, std::shared_ptr<FontFace>> faces;
+
+    std::vector<std::shared_ptr<Font>> fallback_fonts;
+
+    uint64_t fallback_version = 0;
 
-    std::unordered_map<std::string, std::shared_ptr<Font>> font_cache;
+    GlyphDiskCache glyph_disk_cache;
 };
 
 } // namespace Flint
@@ -1,5 +1,7 @@
 #include "vector_server.h"
 
+#include <algorithm>
+
 #include "debug_server.h"
 
 namespace Flint {
@@ -16,6 +18,9 @@ void VectorServer::init(Pathfinder::Vec2I size,
 }
 
 void VectorServer::cleanup() {
+    // Cached scenes were built with the canvas.
+    emoji_scene_cache.clear();
+
     canvas.reset();
 }
 
@@ -25,6 +30,8 @@ void VectorServer::set_canvas_size(Vec2I new_size) {
         render_layers[i]->set_bounds(new_view_box);
         render_layers[i]->set_view_box(new_view_box);
     }
+
+    damage_all();
 }
 
 void VectorServer::set_dst_texture(const std::shared_ptr<Pathfinder::Texture> &texture) {
@@ -38,6 +45,161 @@ void VectorServer::submit_and_clear() {
     }
 
     reset_render_layers();
+
+    // Start over with an empty atlas, as glyphs that didn't fit have been drawn as paths.
+    if (glyph_atlas.is_full()) {
+        glyph_atlas.clear();
+    }
+}
+
+void VectorServer::submit_damage_and_clear() {
+    if (!partial_redraw_enabled_) {
+        submit_and_clear();
+        return;
+    }
+
+    update_background_layer();
+
+    // Paths drawn into render targets aren't in canvas coordinates.
+    bool has_render_targets = false;
+    for (const auto &layer : render_layers) {
+        for (const auto &item : layer->display_list) {
+            has_render_targets |= item.type == Pathfinder::DisplayItem::Type::PushRenderTarget;
+        }
+    }
+
+    if (full_damage || has_render_targets) {
+        draw_layers(std::nullopt, {}, true);
+    } else {
+        auto regions = get_damage_regions();
+
+        if (!regions.empty()) {
+            // Draw each layer once, scissored to the bounds of all regions, and skip the tiles between the regions.
+            auto bounds = regions.front();
+            std::vector<RectI> tile_rects;
+
+            // The regions are aligned to tiles already.
+            auto tile_size = Vec2F(Pathfinder::TILE_WIDTH, Pathfinder::TILE_HEIGHT);
+            for (const auto &region : regions) {
+                bounds = bounds.union_rect(region);
+                tile_rects.emplace_back((region.origin() / tile_size + Vec2F(0.5)).floor(),
+                                        (region.lower_right() / tile_size + Vec2F(0.5)).floor());
+            }
+
+            draw_layers(bounds, tile_rects, false);
+        }
+    }
+
+    damage_rects.clear();
+    full_damage = false;
+
+    reset_render_layers();
+
+    if (glyph_atlas.is_full()) {
+        glyph_atlas.clear();
+    }
+}
+
+void VectorServer::update_background_layer() {
+    auto canvas_rect = RectF({}, canvas->get_size().to_f32());
+
+    if (background_layer && background_layer->get_view_box() == canvas_rect &&
+        background_layer_color_.to_u32() == background_color.to_u32()) {
+        return;
+    }
+
+    // Fill the background instead of clearing it, as the damaged regions can't be cleared alone.
+    background_layer = std::make_shared<Pathfinder::Scene>(MAX_RENDER_LAYER, canvas_rect);
+    background_layer_color_ = background_color;
+
+    canvas->set_scene(background_layer);
+    canvas->set_fill_paint(Pathfinder::Paint::from_color(background_color));
+    canvas->fill_rect(canvas_rect);
+}
+
+void VectorServer::draw_layers(const std::optional<RectF> &scissor_rect,
+                               const std::vector<RectI> &tile_mask,
+                               bool clear_dst_texture) {
+    background_layer->set_scissor_rect(scissor_rect);
+    background_layer->set_tile_mask(tile_mask);
+    canvas->set_scene(background_layer);
+    canvas->draw(clear_dst_texture);
+
+    for (uint8_t i = 0; i < MAX_RENDER_LAYER; i++) {
+        render_layers[i]->set_scissor_rect(scissor_rect);
+        render_layers[i]->set_tile_mask(tile_mask);
+        canvas->set_scene(render_layers[i]);
+        canvas->draw(false);
+    }
+}
+
+std::vector<RectF> VectorServer::get_damage_regions() const {
+    auto canvas_rect = RectF({}, canvas->get_size().to_f32());
+
+    std::vector<RectF> regions;
+
+    for (const auto &rect : damage_rects) {
+        auto scaled_rect = RectF(rect.origin() * global_scale_, rect.lower_right() * global_scale_);
+
+        // Round out to whole tiles, which are what is redrawn anyway.
+        auto tile_size = Vec2F(Pathfinder::TILE_WIDTH, Pathfinder::TILE_HEIGHT);
+        auto region = RectF((scaled_rect.origin() / tile_size).floor().to_f32() * tile_size,
+                            (scaled_rect.lower_right() / tile_size).ceil().to_f32() * tile_size);
+
+        region = region.intersection(canvas_rect);
+        if (region.area() <= 0) {
+            continue;
+        }
+
+        // Merge the overlapping and adjacent regions, until none of them touch.
+        bool merged = true;
+        while (merged) {
+            merged = false;
+            for (size_t i = 0; i < regions.size(); i++) {
+                if (regions[i].intersects(region)) {
+                    region = region.union_rect(regions[i]);
+                    regions.erase(regions.begin() + i);
+                    merged = true;
+                    break;
+                }
+            }
+        }
+
+        regions.push_back(region);
+    }
+
+    if (regions.size() > MAX_DAMAGE_REGIONS) {
+        RectF union_region = regions.front();
+        for (const auto &region : regions) {
+            union_region = union_region.union_rect(region);
+        }
+        regions = {union_region};
+    }
+
+    return regions;
+}
+
+void VectorServer::set_partial_redraw_enabled(bool enabled) {
+    partial_redraw_enabled_ = enabled;
+
+    damage_all();
+}
+
+bool VectorServer::get_partial_redraw_enabled() const {
+    return partial_redraw_enabled_;
+}
+
+void VectorServer::add_damage_rect(const RectF &rect) {
+    if (!partial_redraw_enabled_ || full_damage) {
+        return;
+    }
+
+    damage_rects.push_back(rect);
+}
+
+void VectorServer::damage_all() {
+    full_damage = true;
+    damage_rects.clear();
 }
 
 std::shared_ptr<Pathfinder::Canvas> VectorServer::get_canvas() const {
@@ -226,15 +388,61 @@ void VectorServer::draw_style_line(const StyleLine &style_line, const Vec2F &sta
     canvas->restore_state();
 }
 
-void VectorServer::draw_glyphs(std::vector<Glyph> &glyphs,
-                               std::vector<Vec2F> &glyph_positions,
+void VectorServer::push_clip_rect(const RectF &rect) {
+    canvas->save_state();
+
+    auto dpi_scaling_xform = Pathfinder::Transform2::from_scale(Vec2F(global_scale_, global_scale_));
+    canvas->set_transform(dpi_scaling_xform * global_transform_offset);
+    canvas->clip_rect(rect);
+}
+
+void VectorServer::pop_clip_rect() {
+    canvas->restore_state();
+}
+
+void VectorServer::draw_glyphs(const GlyphRun &glyphs,
+                               const std::vector<Vec2F> &glyph_positions,
                                TextStyle text_style,
                                const Transform2 &transform,
                                const RectF &clip_box,
                                float alpha) {
-    if (glyphs.size() != glyph_positions.size()) {
-        Logger::error("Glyph count mismatches glyph position count!", "Flint");
-        return;
+    single_glyph_run_.clear();
+    single_glyph_run_.push_back({&glyphs, &glyph_positions, Vec2F()});
+
+    draw_glyph_runs(single_glyph_run_, text_style, transform, clip_box, alpha);
+}
+
+void VectorServer::draw_glyph_runs(const std::vector<PlacedGlyphRun> &runs,
+                                   TextStyle text_style,
+                                   const Transform2 &transform,
+                                   const RectF &clip_box,
+                                   float alpha) {
+    for (const auto &run : runs) {
+        if (run.glyphs->size() != run.glyph_positions->size()) {
+            Logger::error("Glyph count mismatches glyph position count!", "Flint");
+            return;
+        }
+    }
+
+    // Glyph outlines are fetched from the fonts' glyph caches.
+    // The fonts of all the runs are locked into one buffer, starting at the run's font start.
+    locked_fonts_.clear();
+    run_font_starts_.clear();
+    for (const auto &run : runs) {
+        run_font_starts_.push_back(locked_fonts_.size());
+        run.glyphs->lock_fonts(locked_fonts_);
+    }
+    const auto &fonts = locked_fonts_;
+
+    // A font used by several runs has its glyphs merged into the same paths.
+    path_fonts_.clear();
+    font_path_indices_.resize(fonts.size());
+    for (size_t i = 0; i < fonts.size(); i++) {
+        auto iter = std::find(path_fonts_.begin(), path_fonts_.end(), fonts[i].get());
+        if (iter == path_fonts_.end()) {
+            iter = path_fonts_.insert(path_fonts_.end(), fonts[i].get());
+        }
+        font_path_indices_[i] = iter - path_fonts_.begin();
     }
 
     text_style.color = text_style.color.apply_alpha(alpha);
@@ -246,110 +454,294 @@ void VectorServer::draw_glyphs(std::vector<Glyph> &glyphs,
 
     // Text clip.
     if (clip_box.is_valid()) {
-        auto clip_path = Pathfinder::Path2d();
-        clip_path.add_rect(clip_box, 0);
         canvas->set_transform(dpi_scaling_xform * global_transform_offset * transform);
-        canvas->clip_path(clip_path, Pathfinder::FillRule::Winding);
+        canvas->clip_rect(clip_box);
     }
 
-    auto skew_xform = Transform2::from_scale({1, 1});
-    if (text_style.italic) {
-        skew_xform = Transform2({1, 0, std::tan(-15.f * 3.1415926f / 180.f), 1}, {});
+    float skew = text_style.italic ? std::tan(-15.f * 3.1415926f / 180.f) : 0;
+    auto skew_xform = Transform2({1, 0, skew, 1}, {});
+
+    // Small glyphs can be drawn from the glyph atlas if they are only translated and uniformly scaled.
+    auto text_matrix = dpi_scaling_xform * global_transform_offset * transform;
+    float atlas_scale = text_matrix.m11();
+    bool use_glyph_atlas = glyph_atlas_enabled_ && !text_style.italic && !text_style.bold &&
+                           text_style.stroke_width == 0 && atlas_scale > 0 && text_matrix.m22() == atlas_scale &&
+                           text_matrix.m12() == 0 && text_matrix.m21() == 0;
+
+    // Atlas glyphs are grouped into strips, each of which is drawn as one textured rect.
+    // The glyphs of all the runs are indexed one after another.
+    atlas_glyphs_.clear();
+    atlas_strips_.clear();
+    atlas_glyph_strips_.clear();
+
+    if (use_glyph_atlas) {
+        for (size_t run_idx = 0; run_idx < runs.size(); run_idx++) {
+            const auto &run = runs[run_idx];
+            const auto &glyphs = *run.glyphs;
+
+            for (size_t i = 0; i < glyphs.size(); i++) {
+                const auto &font = fonts[run_font_starts_[run_idx] + glyphs.font_indices[i]];
+                const auto &run_font = glyphs.get_font(i);
+
+                auto &atlas_glyph = atlas_glyphs_.emplace_back();
+
+                if (font == nullptr || glyphs.has_flag(i, GlyphRun::FLAG_EMOJI | GlyphRun::FLAG_SKIP_DRAWING) ||
+                    (float)run_font.font_size * atlas_scale > glyph_atlas_max_font_size_) {
+                    continue;
+                }
+
+                auto glyph_global_transform = dpi_scaling_xform * global_transform_offset *
+                                              Transform2::from_translation((*run.glyph_positions)[i] + run.offset) *
+                                              transform * Transform2::from_translation({0, run_font.ascent});
+                auto origin = glyph_global_transform * Vec2F(0);
+
+                // Snap the origin to a subpixel step horizontally and to a pixel vertically.
+                int x_in_steps = (int)std::round(origin.x * GlyphAtlas::SUBPIXEL_STEPS);
+                int x = (int)std::floor((float)x_in_steps / GlyphAtlas::SUBPIXEL_STEPS);
+                int subpixel_step = x_in_steps - x * GlyphAtlas::SUBPIXEL_STEPS;
+
+                atlas_glyph.font = font.get();
+                atlas_glyph.glyph_index = glyphs.glyph_indices[i];
+                atlas_glyph.font_size = run_font.font_size;
+                atlas_glyph.origin = {x, (int)std::round(origin.y)};
+                atlas_glyph.subpixel_step = subpixel_step;
+            }
+        }
+
+        glyph_atlas.get_strips(atlas_glyphs_, atlas_scale, atlas_strips_, atlas_glyph_strips_);
+
+        canvas->set_transform(Transform2());
+
+        for (const auto &strip : atlas_strips_) {
+            if (strip.rect.area() == 0) {
+                continue;
+            }
+
+            // Map the strip's bitmap in the page to its position on the screen.
+            auto pattern = Pathfinder::Pattern::from_image(glyph_atlas.get_page_image(strip.page));
+            pattern.set_smoothing_enabled(false);
+            pattern.apply_transform(Transform2::from_translation((strip.origin - strip.rect.origin()).to_f32()));
+
+            // The page stores coverage only, the color comes from the base color.
+            auto paint = Pathfinder::Paint::from_pattern(pattern);
+            paint.set_base_color(text_style.color);
+            paint.get_overlay()->composite_op = Pathfinder::PaintCompositeOp::DestIn;
+            paint.get_overlay()->apply_composite_op = true;
+
+            canvas->set_fill_paint(paint);
+            canvas->fill_rect(RectI(strip.origin, strip.origin + strip.rect.size()).to_f32());
+        }
     }
 
+    // Glyph outlines sharing a paint are merged into one path in the text's space, already moved to their pen
+    // positions. A text run then becomes one draw path per font in the scene instead of one per glyph.
+    // Fonts are not merged with each other, as their contours may wind in opposite directions (e.g. TrueType and
+    // CFF), which would cancel out where glyphs of different fonts overlap under the nonzero rule.
+    auto text_space_xform = dpi_scaling_xform * global_transform_offset;
+
+    font_paths_.clear();
+    font_paths_.resize(path_fonts_.size());
+
+    // Glyph transform without the skew.
+    auto get_glyph_placement_xform = [&](const GlyphRun &glyphs, size_t i, Vec2F position) {
+        auto baseline_xform = Transform2::from_translation({0, glyphs.get_font(i).ascent});
+        return Transform2::from_translation(position) * transform * baseline_xform;
+    };
+
+    auto get_glyph_xform = [&](const GlyphRun &glyphs, size_t i, Vec2F position) {
+        return get_glyph_placement_xform(glyphs, i, position) * skew_xform;
+    };
+
+    // Stroking commutes with translation, rotation and uniform scaling. So if the text is only transformed by these,
+    // glyphs can be stroked once in their own space and the stroked outlines cached in the fonts, to be filled like
+    // regular glyphs. Other transforms stroke the merged path in every frame.
+    float stroke_scale = std::sqrt(transform.m11() * transform.m11() + transform.m21() * transform.m21());
+    bool use_stroked_glyph_cache = stroke_scale > 0 && std::abs(transform.m11() - transform.m22()) < 1e-5f &&
+                                   std::abs(transform.m12() + transform.m21()) < 1e-5f;
+
     // Draw glyph strokes. The strokes go below the fills.
-    for (int i = 0; i < glyphs.size(); i++) {
-        auto &g = glyphs[i];
-        auto &p = glyph_positions[i];
+    float stroke_width = text_style.stroke_width;
+    if (text_style.bold) {
+        stroke_width += STROKE_WIDTH_FOR_PSEUDO_BOLD_TEXT;
+    }
 
-        if (g.emoji || g.skip_drawing) {
-            continue;
+    if (stroke_width > 0) {
+        GlyphStroke glyph_stroke{stroke_width / stroke_scale, Pathfinder::LineJoin::Round, skew};
+
+        for (size_t run_idx = 0; run_idx < runs.size(); run_idx++) {
+            const auto &run = runs[run_idx];
+            const auto &glyphs = *run.glyphs;
+
+            for (size_t i = 0; i < glyphs.size(); i++) {
+                auto font_slot = run_font_starts_[run_idx] + glyphs.font_indices[i];
+                const auto &font = fonts[font_slot];
+                auto glyph_index = glyphs.glyph_indices[i];
+                auto font_size = glyphs.get_font(i).font_size;
+                auto position = (*run.glyph_positions)[i] + run.offset;
+
+                if (font == nullptr || glyphs.has_flag(i, GlyphRun::FLAG_EMOJI | GlyphRun::FLAG_SKIP_DRAWING)) {
+                    continue;
+                }
+
+                auto &paths = font_paths_[font_path_indices_[font_slot]];
+                paths.has_stroke = true;
+
+                if (use_stroked_glyph_cache) {
+                    auto &stroked_outline = font->get_stroked_glyph(glyph_index, font_size, glyph_stroke);
+                    paths.stroke.add_outline(stroked_outline, get_glyph_placement_xform(glyphs, i, position));
+                } else {
+                    auto &glyph_path = font->get_cached_glyph(glyph_index, font_size).path;
+                    paths.stroke.add_path(glyph_path, get_glyph_xform(glyphs, i, position));
+                }
+            }
         }
 
-        auto baseline_xform = Transform2::from_translation({0, g.ascent});
+        canvas->set_transform(text_space_xform);
 
-        auto glyph_global_transform =
-            dpi_scaling_xform * global_transform_offset * Transform2::from_translation(p) * transform * baseline_xform;
+        if (use_stroked_glyph_cache) {
+            canvas->set_fill_paint(Pathfinder::Paint::from_color(text_style.stroke_color));
+        } else {
+            canvas->set_stroke_paint(Pathfinder::Paint::from_color(text_style.stroke_color));
+            canvas->set_line_width(stroke_width);
+            canvas->set_line_join(Pathfinder::LineJoin::Round);
+        }
 
-        canvas->set_transform(glyph_global_transform * skew_xform);
+        for (auto &paths : font_paths_) {
+            if (!paths.has_stroke) {
+                continue;
+            }
 
-        // Add stroke if needed.
-        canvas->set_stroke_paint(Pathfinder::Paint::from_color(text_style.stroke_color));
-        float stroke_width = text_style.stroke_width;
-        if (text_style.bold) {
-            stroke_width += STROKE_WIDTH_FOR_PSEUDO_BOLD_TEXT;
+            if (use_stroked_glyph_cache) {
+                canvas->fill_path(paths.stroke, Pathfinder::FillRule::Winding);
+            } else {
+                canvas->stroke_path(paths.stroke);
+            }
         }
-        canvas->set_line_width(stroke_width);
-        canvas->set_line_join(Pathfinder::LineJoin::Round);
-        canvas->stroke_path(g.path);
     }
 
+    GlyphStroke bold_stroke{STROKE_WIDTH_FOR_PSEUDO_BOLD_TEXT / stroke_scale, Pathfinder::LineJoin::Bevel, skew};
+
     // Draw glyph fills.
-    for (int i = 0; i < glyphs.size(); i++) {
-        auto &g = glyphs[i];
-        auto &p = glyph_positions[i];
+    size_t run_glyph_start = 0;
+
+    for (size_t run_idx = 0; run_idx < runs.size(); run_idx++) {
+        const auto &run = runs[run_idx];
+        const auto &glyphs = *run.glyphs;
+
+        for (size_t i = 0; i < glyphs.size(); i++) {
+            auto font_slot = run_font_starts_[run_idx] + glyphs.font_indices[i];
+            const auto &font = fonts[font_slot];
+            const auto &run_font = glyphs.get_font(i);
+            auto p = (*run.glyph_positions)[i] + run.offset;
+            auto glyph_index = glyphs.glyph_indices[i];
+            bool emoji = glyphs.has_flag(i, GlyphRun::FLAG_EMOJI);
+
+            if (font == nullptr || glyphs.has_flag(i, GlyphRun::FLAG_SKIP_DRAWING)) {
+                continue;
+            }
 
-        if (g.skip_drawing) {
-            continue;
-        }
+            auto baseline_xform = Transform2::from_translation({0, run_font.ascent});
+
+            // No italic for emojis and debug boxes.
+            auto glyph_global_transform = dpi_scaling_xform * global_transform_offset *
+                                          Transform2::from_translation(p) * transform * baseline_xform;
 
-        auto baseline_xform = Transform2::from_translation({0, g.ascent});
+            if (use_glyph_atlas && atlas_glyph_strips_[run_glyph_start + i] >= 0) {
+                // Drawn with its strip.
+            } else if (!emoji) {
+                auto &paths = font_paths_[font_path_indices_[font_slot]];
 
-        // No italic for emojis and debug boxes.
-        auto glyph_global_transform =
-            dpi_scaling_xform * global_transform_offset * Transform2::from_translation(p) * transform * baseline_xform;
+                auto &glyph_path = font->get_cached_glyph(glyph_index, run_font.font_size).path;
+                paths.fill.add_path(glyph_path, get_glyph_xform(glyphs, i, p));
+                paths.has_fill = true;
 
-        if (!g.emoji) {
-            canvas->set_transform(glyph_global_transform * skew_xform);
+                if (text_style.bold && use_stroked_glyph_cache) {
+                    auto &stroked_outline = font->get_stroked_glyph(glyph_index, run_font.font_size, bold_stroke);
+                    paths.bold.add_outline(stroked_outline, get_glyph_placement_xform(glyphs, i, p));
+                }
+            } else if (auto svg_scene = emoji_scene_cache.get_scene(*font, glyph_index, *canvas)) {
+                // The emoji's svg size is always fixed for a specific font no matter what the font size you set.
+                auto svg_size = svg_scene->get_size();
+                auto glyph_size = glyphs.get_glyph_box(i).size();
 
-            // Add fill.
-            canvas->set_fill_paint(Pathfinder::Paint::from_color(text_style.color));
-            canvas->fill_path(g.path, Pathfinder::FillRule::Winding);
+                auto emoji_scale = Transform2::from_scale(glyph_size / svg_size);
 
-            // Use stroke to make a pseudo bold effect.
-            if (text_style.bold) {
-                canvas->set_stroke_paint(Pathfinder::Paint::from_color(text_style.color));
-                canvas->set_line_width(STROKE_WIDTH_FOR_PSEUDO_BOLD_TEXT);
-                canvas->set_line_join(Pathfinder::LineJoin::Bevel);
-                canvas->stroke_path(g.path);
+                canvas->get_scene()->append_scene(*(svg_scene->get_scene()), glyph_global_transform * emoji_scale);
             }
-        } else {
-            auto svg_scene = std::make_shared<Pathfinder::SvgScene>(g.svg, *canvas);
 
-            // The emoji's svg size is always fixed for a specific font no matter what the font size you set.
-            auto svg_size = svg_scene->get_size();
-            auto glyph_size = g.box.size();
+            if (text_style.debug) {
+                canvas->set_transform(glyph_global_transform);
+                canvas->set_line_width(1);
 
-            auto emoji_scale = Transform2::from_scale(glyph_size / svg_size);
+                // Add box.
+                // --------------------------------
+                Pathfinder::Path2d layout_path;
+                layout_path.add_rect(glyphs.get_glyph_box(i));
 
-            canvas->get_scene()->append_scene(*(svg_scene->get_scene()), glyph_global_transform * emoji_scale);
-        }
+                canvas->set_stroke_paint(Pathfinder::Paint::from_color(ColorU::green()));
+                canvas->stroke_path(layout_path);
+                // --------------------------------
 
-        if (text_style.debug) {
-            canvas->set_transform(glyph_global_transform);
-            canvas->set_line_width(1);
+                // Add bbox.
+                // --------------------------------
+                Pathfinder::Path2d bbox_path;
+                bbox_path.add_rect(font->get_cached_glyph(glyph_index, run_font.font_size).bbox);
+
+                canvas->set_stroke_paint(Pathfinder::Paint::from_color(ColorU::red()));
+                canvas->stroke_path(bbox_path);
+                // --------------------------------
+            }
+        }
 
-            // Add box.
-            // --------------------------------
-            Pathfinder::Path2d layout_path;
-            layout_path.add_rect(g.box);
+        run_glyph_start += glyphs.size();
+    }
 
-            canvas->set_stroke_paint(Pathfinder::Paint::from_color(ColorU::green()));
-            canvas->stroke_path(layout_path);
-            // --------------------------------
+    canvas->set_transform(text_space_xform);
+    canvas->set_fill_paint(Pathfinder::Paint::from_color(text_style.color));
+    canvas->set_stroke_paint(Pathfinder::Paint::from_color(text_style.color));
+    canvas->set_line_width(STROKE_WIDTH_FOR_PSEUDO_BOLD_TEXT);
+    canvas->set_line_join(Pathfinder::LineJoin::Bevel);
 
-            // Add bbox.
-            // --------------------------------
-            Pathfinder::Path2d bbox_path;
-            bbox_path.add_rect(g.bbox);
+    for (auto &paths : font_paths_) {
+        if (!paths.has_fill) {
+            continue;
+        }
 
-            canvas->set_stroke_paint(Pathfinder::Paint::from_color(ColorU::red()));
-            canvas->stroke_path(bbox_path);
-            // --------------------------------
+        // Use stroke to make a pseudo bold effect.
+        if (text_style.bold && use_stroked_glyph_cache) {
+            canvas->fill_path(paths.bold, Pathfinder::FillRule::Winding);
+        } else if (text_style.bold) {
+            canvas->stroke_path(paths.fill);
         }
+
+        canvas->fill_path(paths.fill, Pathfinder::FillRule::Winding);
     }
 
     canvas->restore_state();
+
+    // Don't keep the fonts alive until the next run.
+    locked_fonts_.clear();
+}
+
+void VectorServer::set_glyph_atlas_enabled(bool enabled) {
+    glyph_atlas_enabled_ = enabled;
+
+    // Release the pages.
+    if (!enabled) {
+        glyph_atlas = GlyphAtlas();
+    }
+}
+
+EmojiSceneCache &VectorServer::get_emoji_scene_cache() {
+    return emoji_scene_cache;
+}
+
+bool VectorServer::get_glyph_atlas_enabled() const {
+    return glyph_atlas_enabled_;
+}
+
+void VectorServer::set_glyph_atlas_max_font_size(float new_size) {
+    glyph_atlas_max_font_size_ = new_size;
 }
 
 std::shared_ptr<Pathfinder::SvgScene> VectorServer::load_svg(const std::string &path) {
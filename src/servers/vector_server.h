@@ -4,7 +4,9 @@
 #include <pathfinder/prelude.h>
 
 #include "../common/geometry.h"
+#include "../resources/emoji_scene_cache.h"
 #include "../resources/font.h"
+#include "../resources/glyph_atlas.h"
 #include "../resources/raster_image.h"
 #include "../resources/render_image.h"
 #include "../resources/style_box.h"
@@ -39,6 +41,23 @@ public:
 
     void submit_and_clear();
 
+    /// Like submit_and_clear(), but only the damaged regions are redrawn if partial redraw is enabled.
+    /// The rest of the destination texture is kept from the previous frame, so it must be the same texture.
+    void submit_damage_and_clear();
+
+    /// Redraw only the regions of the primary window which have changed. Off by default, as every change of how a
+    /// node looks has to be reported then, e.g. by Node::queue_redraw(). The background is filled with an opaque
+    /// color instead of being cleared.
+    void set_partial_redraw_enabled(bool enabled);
+
+    bool get_partial_redraw_enabled() const;
+
+    /// Report a rect in global coordinates to be redrawn in the next submission.
+    void add_damage_rect(const RectF &rect);
+
+    /// Redraw everything in the next submission, e.g. after the destination texture has been recreated.
+    void damage_all();
+
     void draw_line(Vec2F start, Vec2F end, float width, ColorU color);
 
     void draw_rectangle(const RectF &rect, float line_width, ColorU color, bool fill);
@@ -59,20 +78,44 @@ public:
 
     void draw_style_line(const StyleLine &style_line, const Vec2F &start, const Vec2F &end);
 
+    /// Clip anything drawn afterward to a rect in global coordinates, until the matching pop_clip_rect().
+    /// Nested clip rects are intersected. An axis-aligned clip rect is cheap, as it's applied while tiling the paths.
+    void push_clip_rect(const RectF &rect);
+
+    void pop_clip_rect();
+
     /**
      * @param transform
-     * @param clip_box Enable content clip, portion of anything drawn afterward
-     * outside the clip box will not show. The rect is in local coordinates and the transform will be applied to it.
-     * We shouldn't use clip path to achieve general content clip (like scrolling)
-     * since it's quite performance heavy and easily produces nested clipping.
+     * @param clip_box Enable content clip, portion of the glyphs outside the clip box will not show.
+     * The rect is in local coordinates and the transform will be applied to it.
      */
-    void draw_glyphs(std::vector<Glyph> &glyphs,
-                     std::vector<Vec2F> &glyph_positions,
+    void draw_glyphs(const GlyphRun &glyphs,
+                     const std::vector<Vec2F> &glyph_positions,
                      TextStyle text_style,
                      const Transform2 &transform,
                      const RectF &clip_box,
                      float alpha = 1.0f);
 
+    /// Draw several glyph runs as one text, e.g. the paragraphs of a label, whose glyphs are merged into the same
+    /// paths. Each run is moved by its offset in the text's local coordinates.
+    void draw_glyph_runs(const std::vector<PlacedGlyphRun> &runs,
+                         TextStyle text_style,
+                         const Transform2 &transform,
+                         const RectF &clip_box,
+                         float alpha = 1.0f);
+
+    /// Draw small text as textured rects from a rasterized glyph atlas instead of glyph paths.
+    /// Only text without italic, bold or stroke, drawn with a translation and a uniform scale, uses the atlas.
+    void set_glyph_atlas_enabled(bool enabled);
+
+    bool get_glyph_atlas_enabled() const;
+
+    /// Glyphs larger than this on the screen are always drawn as paths. In pixels.
+    void set_glyph_atlas_max_font_size(float new_size);
+
+    /// Parsed emoji scenes used by draw_glyphs.
+    EmojiSceneCache &get_emoji_scene_cache();
+
     std::shared_ptr<Pathfinder::SvgScene> load_svg(const std::string &path);
 
     std::shared_ptr<Pathfinder::Canvas> get_canvas() const;
@@ -83,18 +126,86 @@ public:
 
     void set_render_layer(uint8_t layer_id);
 
-    // Only used with ScrollContainer.
+    // Applied to everything drawn, after the node transforms. E.g. for drawing into a render target.
     Transform2 global_transform_offset;
 
+    /// Fills the background in the partial redraw mode. Matches the clear color of the swap chain pass.
+    ColorU background_color = ColorU(51, 51, 51, 255);
+
+    /// If there are more damaged regions after merging the overlapping ones, their union is redrawn instead.
+    /// Each tile of a redrawn layer is tested against the regions.
+    static constexpr size_t MAX_DAMAGE_REGIONS = 16;
+
 private:
     void reset_render_layers();
 
+    /// Damage rects in canvas pixels, rounded out to whole tiles and merged. Empty if everything should be redrawn.
+    std::vector<RectF> get_damage_regions() const;
+
+    /// Rebuild the background layer if the canvas size or the background color has changed.
+    void update_background_layer();
+
+    /// Draw the background and the layers, only inside the scissor rect if there's one, and only the tiles inside
+    /// the tile mask if it's not empty.
+    void draw_layers(const std::optional<RectF> &scissor_rect,
+                     const std::vector<RectI> &tile_mask,
+                     bool clear_dst_texture);
+
     // Never expose this.
     std::shared_ptr<Pathfinder::Canvas> canvas;
 
     std::array<std::shared_ptr<Pathfinder::Scene>, MAX_RENDER_LAYER> render_layers;
 
     float global_scale_ = 1.0f;
+
+    GlyphAtlas glyph_atlas;
+
+    EmojiSceneCache emoji_scene_cache;
+
+    /// Scratch buffer of the fonts of the glyph runs being drawn, reused to avoid an allocation per draw.
+    std::vector<std::shared_ptr<Font>> locked_fonts_;
+    /// Index of each run's first font in locked_fonts_.
+    std::vector<size_t> run_font_starts_;
+    /// Distinct fonts in locked_fonts_, each with its own merged paths.
+    std::vector<Font *> path_fonts_;
+    /// Index of the merged paths of each font in locked_fonts_.
+    std::vector<size_t> font_path_indices_;
+
+    /// Merged glyph paths of a font in draw_glyph_runs().
+    struct FontPaths {
+        Pathfinder::Path2d stroke;
+        Pathfinder::Path2d fill;
+        // Stroked glyph outlines for the pseudo bold effect, if they are cached.
+        Pathfinder::Path2d bold;
+        bool has_stroke = false;
+        bool has_fill = false;
+    };
+    /// Scratch buffer of the merged paths of each of path_fonts_.
+    std::vector<FontPaths> font_paths_;
+
+    /// Scratch buffer for draw_glyphs().
+    std::vector<PlacedGlyphRun> single_glyph_run_;
+
+    // Scratch buffers of the atlas glyphs of the glyph run being drawn.
+    std::vector<AtlasGlyphInstance> atlas_glyphs_;
+    std::vector<AtlasStrip> atlas_strips_;
+    std::vector<int32_t> atlas_glyph_strips_;
+
+    bool glyph_atlas_enabled_ = false;
+
+    float glyph_atlas_max_font_size_ = 24;
+
+    bool partial_redraw_enabled_ = false;
+
+    /// Damage rects in global coordinates since the last submission.
+    std::vector<RectF> damage_rects;
+
+    bool full_damage = true;
+
+    /// A single rect filling the canvas with the background color, kept until either of them changes.
+    std::shared_ptr<Pathfinder::Scene> background_layer;
+
+    ColorU background_layer_color_;
 };
 
 } // namespace Flint
@@ -0,0 +1,18 @@
+#ifndef FLINT_TESTS_CHECK_H
+#define FLINT_TESTS_CHECK_H
+
+#include <iostream>
+
+/// Number of failed checks, which the tests return as their exit status.
+inline int check_failures = 0;
+
+/// Report a failed condition and carry on, so that one run shows all the failures.
+#define CHECK(condition)                                                                       \
+    do {                                                                                       \
+        if (!(condition)) {                                                                    \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": check failed: " #condition << "\n"; \
+            check_failures++;                                                                  \
+        }                                                                                      \
+    } while (false)
+
+#endif // FLINT_TESTS_CHECK_H
@@ -0,0 +1,143 @@
+#include <servers/input_server.h>
+
+#include <vector>
+
+#include "check.h"
+
+using namespace Flint;
+
+namespace {
+
+InputEvent make_motion(uint8_t window_index, Vec2F relative, Vec2F position) {
+    InputEvent event;
+    event.type = InputEventType::MouseMotion;
+    event.window_index = window_index;
+    event.args.mouse_motion.relative = relative;
+    event.args.mouse_motion.position = position;
+    return event;
+}
+
+InputEvent make_scroll(uint8_t window_index, float y_delta) {
+    InputEvent event;
+    event.type = InputEventType::MouseScroll;
+    event.window_index = window_index;
+    event.args.mouse_scroll.x_delta = 0;
+    event.args.mouse_scroll.y_delta = y_delta;
+    return event;
+}
+
+InputEvent make_button(uint8_t window_index, bool pressed) {
+    InputEvent event;
+    event.type = InputEventType::MouseButton;
+    event.window_index = window_index;
+    event.args.mouse_button.button = 0;
+    event.args.mouse_button.pressed = pressed;
+    return event;
+}
+
+InputEvent make_text(uint32_t codepoint) {
+    InputEvent event;
+    event.type = InputEventType::Text;
+    event.args.text.codepoint = codepoint;
+    return event;
+}
+
+std::vector<InputEvent> make_events() {
+    return {
+        make_motion(0, {1, 0}, {1, 0}),
+        make_motion(0, {2, 1}, {3, 1}),
+        make_motion(0, {1, 1}, {4, 2}),
+        make_button(0, true),
+        make_motion(0, {1, 0}, {5, 2}),
+        // Another window.
+        make_motion(1, {1, 0}, {1, 0}),
+        make_motion(0, {1, 0}, {6, 2}),
+        make_scroll(0, 1),
+        make_scroll(0, 2),
+        make_text('a'),
+        make_scroll(0, 4),
+        make_button(0, false),
+    };
+}
+
+void test_disabled() {
+    auto input_server = InputServer::get_singleton();
+    input_server->set_event_coalescing_enabled(false);
+
+    input_server->clear_events();
+    input_server->input_queue = make_events();
+
+    input_server->coalesce_events();
+
+    CHECK(input_server->input_queue.size() == make_events().size());
+    CHECK(&input_server->get_raw_events() == &input_server->input_queue);
+}
+
+void test_coalescing_order() {
+    auto input_server = InputServer::get_singleton();
+    input_server->set_event_coalescing_enabled(true);
+
+    input_server->clear_events();
+    input_server->input_queue = make_events();
+
+    input_server->coalesce_events();
+
+    const auto &events = input_server->input_queue;
+    CHECK(events.size() == 9);
+    if (events.size() != 9) {
+        return;
+    }
+
+    // A run of motions becomes its last position and the sum of the relative motions.
+    CHECK(events[0].type == InputEventType::MouseMotion);
+    CHECK(events[0].args.mouse_motion.position == Vec2F(4, 2));
+    CHECK(events[0].args.mouse_motion.relative == Vec2F(4, 2));
+
+    CHECK(events[1].type == InputEventType::MouseButton);
+    CHECK(events[1].args.mouse_button.pressed);
+
+    // Motions of different windows are not merged.
+    CHECK(events[2].type == InputEventType::MouseMotion);
+    CHECK(events[2].window_index == 0);
+    CHECK(events[2].args.mouse_motion.position == Vec2F(5, 2));
+
+    CHECK(events[3].type == InputEventType::MouseMotion);
+    CHECK(events[3].window_index == 1);
+
+    CHECK(events[4].type == InputEventType::MouseMotion);
+    CHECK(events[4].window_index == 0);
+    CHECK(events[4].args.mouse_motion.position == Vec2F(6, 2));
+
+    // A run of scrolls becomes the sum of the deltas.
+    CHECK(events[5].type == InputEventType::MouseScroll);
+    CHECK(events[5].args.mouse_scroll.y_delta == 3);
+
+    CHECK(events[6].type == InputEventType::Text);
+    CHECK(events[6].args.text.codepoint == 'a');
+
+    // Not merged across other events.
+    CHECK(events[7].type == InputEventType::MouseScroll);
+    CHECK(events[7].args.mouse_scroll.y_delta == 4);
+
+    CHECK(events[8].type == InputEventType::MouseButton);
+    CHECK(!events[8].args.mouse_button.pressed);
+
+    // The raw events stay available.
+    const auto &raw_events = input_server->get_raw_events();
+    CHECK(raw_events.size() == make_events().size());
+    if (raw_events.size() == make_events().size()) {
+        CHECK(raw_events[1].args.mouse_motion.position == Vec2F(3, 1));
+    }
+
+    input_server->clear_events();
+    CHECK(input_server->get_raw_events().empty());
+}
+
+} // namespace
+
+int main() {
+    test_disabled();
+    test_coalescing_order();
+
+    return check_failures == 0 ? 0 : 1;
+}
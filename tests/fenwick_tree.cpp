@@ -0,0 +1,114 @@
+#include <common/fenwick_tree.h>
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include "check.h"
+
+using namespace Flint;
+
+namespace {
+
+uint64_t get_expected_prefix_sum(const std::vector<uint32_t> &values, size_t count) {
+    uint64_t sum = 0;
+    for (size_t i = 0; i < count; i++) {
+        sum += values[i];
+    }
+
+    return sum;
+}
+
+/// Largest count whose prefix sum is not greater than the sum.
+size_t get_expected_find(const std::vector<uint32_t> &values, uint64_t sum) {
+    size_t count = 0;
+    while (count < values.size() && get_expected_prefix_sum(values, count + 1) <= sum) {
+        count++;
+    }
+
+    return count;
+}
+
+void check_tree(const FenwickTree<uint64_t> &tree, const std::vector<uint32_t> &values) {
+    CHECK(tree.size() == values.size());
+
+    for (size_t count = 0; count <= values.size(); count++) {
+        CHECK(tree.get_prefix_sum(count) == get_expected_prefix_sum(values, count));
+    }
+
+    uint64_t total = get_expected_prefix_sum(values, values.size());
+    for (uint64_t sum = 0; sum <= total + 1; sum++) {
+        CHECK(tree.find(sum) == get_expected_find(values, sum));
+    }
+}
+
+void test_empty() {
+    FenwickTree<uint64_t> tree;
+    CHECK(tree.size() == 0);
+    CHECK(tree.find(0) == 0);
+
+    tree.assign(std::vector<uint32_t>());
+    CHECK(tree.size() == 0);
+    CHECK(tree.get_prefix_sum(0) == 0);
+    CHECK(tree.find(5) == 0);
+}
+
+void test_lookups() {
+    std::vector<uint32_t> values = {3, 1, 4, 1, 5};
+
+    FenwickTree<uint64_t> tree;
+    tree.assign(values);
+
+    CHECK(tree.get_prefix_sum(2) == 4);
+    CHECK(tree.get_prefix_sum(5) == 14);
+
+    // The value at index 2 covers the sums [4, 8).
+    CHECK(tree.find(3) == 1);
+    CHECK(tree.find(4) == 2);
+    CHECK(tree.find(7) == 2);
+    CHECK(tree.find(8) == 3);
+
+    // Past the end.
+    CHECK(tree.find(14) == 5);
+    CHECK(tree.find(100) == 5);
+
+    check_tree(tree, values);
+}
+
+void test_random_updates() {
+    std::mt19937 random(42);
+
+    // Sizes around the powers of two, where the tree descent changes.
+    for (size_t size : {1, 2, 3, 7, 8, 9, 16, 33, 100}) {
+        std::vector<uint32_t> values(size);
+        for (auto &value : values) {
+            // Zeros too, which find() skips.
+            value = random() % 4;
+        }
+
+        FenwickTree<uint64_t> tree;
+        tree.assign(values);
+        check_tree(tree, values);
+
+        for (int update = 0; update < 20; update++) {
+            size_t index = random() % size;
+            uint32_t new_value = random() % 6;
+
+            // Negative deltas wrap around.
+            tree.add(index, (uint64_t)new_value - values[index]);
+            values[index] = new_value;
+
+            check_tree(tree, values);
+        }
+    }
+}
+
+} // namespace
+
+int main() {
+    test_empty();
+    test_lookups();
+    test_random_updates();
+
+    return check_failures == 0 ? 0 : 1;
+}
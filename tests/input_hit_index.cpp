@@ -0,0 +1,139 @@
+#include <nodes/input_hit_index.h>
+#include <nodes/ui/node_ui.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "check.h"
+
+using namespace Flint;
+
+namespace {
+
+/// Records the mouse events it gets.
+class Probe : public NodeUi {
+public:
+    Probe(std::string name, std::vector<std::string> &log, bool clips = false)
+        : name(std::move(name)), log(log), clips(clips) {
+        // Plain UI nodes get all the mouse events, see NodeUi::wants_mouse_input_outside_rect().
+        type = NodeType::Panel;
+    }
+
+    void input(InputEvent &event) override {
+        log.push_back(name);
+    }
+
+    bool ignore_mouse_input_outside_rect() const override {
+        return clips;
+    }
+
+private:
+    std::string name;
+    std::vector<std::string> &log;
+    bool clips;
+};
+
+using Log = std::vector<std::string>;
+
+std::shared_ptr<Probe> add_probe(Node &parent,
+                                 const std::string &name,
+                                 Log &log,
+                                 Vec2F position,
+                                 Vec2F size,
+                                 bool clips = false) {
+    auto probe = std::make_shared<Probe>(name, log, clips);
+    probe->set_position(position);
+    probe->set_size(size);
+    parent.add_child(probe);
+    return probe;
+}
+
+/// Like the transform pass.
+void update_global_positions(Node &node, Vec2F parent_global_position) {
+    auto global_position = parent_global_position;
+    if (node.is_ui_node()) {
+        auto ui_node = dynamic_cast<NodeUi *>(&node);
+        ui_node->calc_global_position(parent_global_position);
+        global_position = ui_node->get_global_position();
+    }
+
+    for (size_t i = 0; i < node.get_all_child_count(); i++) {
+        update_global_positions(*node.get_all_child(i), global_position);
+    }
+}
+
+Log click(InputHitIndex &hit_index, Node &root, Log &log, Vec2F position) {
+    InputServer::get_singleton()->cursor_position = position;
+
+    InputEvent event;
+    event.type = InputEventType::MouseButton;
+    event.args.mouse_button.button = 0;
+    event.args.mouse_button.pressed = true;
+    event.args.mouse_button.position = position;
+
+    log.clear();
+    hit_index.dispatch(&root, event);
+    return log;
+}
+
+void test_queries() {
+    Log log;
+
+    auto root = std::make_shared<Node>();
+
+    auto a = add_probe(*root, "a", log, {0, 0}, {100, 100});
+    add_probe(*a, "a1", log, {10, 10}, {20, 20});
+    auto b = add_probe(*root, "b", log, {200, 0}, {100, 100});
+    // Covers too many cells to be binned.
+    add_probe(*root, "large", log, {0, 0}, {2000, 2000});
+    // Its child sticks out of it, where it gets no mouse events.
+    auto clip = add_probe(*root, "clip", log, {400, 0}, {100, 100}, true);
+    add_probe(*clip, "clip1", log, {50, 50}, {100, 100});
+
+    update_global_positions(*root, {});
+
+    InputHitIndex hit_index;
+
+    // Children before their parents, then the siblings in order.
+    CHECK(click(hit_index, *root, log, {20, 20}) == Log({"a1", "a", "large"}));
+    CHECK(click(hit_index, *root, log, {50, 50}) == Log({"a", "large"}));
+    CHECK(click(hit_index, *root, log, {250, 50}) == Log({"b", "large"}));
+    CHECK(click(hit_index, *root, log, {150, 50}) == Log({"large"}));
+    CHECK(click(hit_index, *root, log, {3000, 3000}) == Log({}));
+
+    CHECK(click(hit_index, *root, log, {460, 60}) == Log({"large", "clip1", "clip"}));
+    CHECK(click(hit_index, *root, log, {520, 120}) == Log({"large"}));
+
+    // Moved nodes are found at their new rects once the index is invalidated, like every frame.
+    b->set_position({0, 200});
+    update_global_positions(*root, {});
+    hit_index.invalidate();
+
+    CHECK(click(hit_index, *root, log, {250, 50}) == Log({"large"}));
+    CHECK(click(hit_index, *root, log, {50, 250}) == Log({"b", "large"}));
+
+    // Removed and hidden nodes are dropped without invalidating.
+    root->remove_child(0);
+
+    // Removed nodes are not kept alive by the index.
+    std::weak_ptr<Probe> removed = a;
+    a.reset();
+    CHECK(removed.expired());
+
+    CHECK(click(hit_index, *root, log, {20, 20}) == Log({"large"}));
+
+    b->set_visibility(false);
+    CHECK(click(hit_index, *root, log, {50, 250}) == Log({"large"}));
+
+    b->set_visibility(true);
+    CHECK(click(hit_index, *root, log, {50, 250}) == Log({"b", "large"}));
+}
+
+} // namespace
+
+int main() {
+    test_queries();
+
+    return check_failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,100 @@
+#include <common/line_break.h>
+
+#include <string>
+#include <vector>
+
+#include "check.h"
+
+using namespace Flint;
+
+namespace {
+
+/// Indices of the codepoints a line may start at.
+std::vector<size_t> get_breaks(std::u32string_view text) {
+    std::vector<bool> break_opportunities;
+    find_line_break_opportunities(text, break_opportunities);
+
+    CHECK(break_opportunities.size() == text.size());
+
+    std::vector<size_t> breaks;
+    for (size_t i = 0; i < break_opportunities.size(); i++) {
+        if (break_opportunities[i]) {
+            breaks.push_back(i);
+        }
+    }
+
+    return breaks;
+}
+
+void test_classes() {
+    CHECK(get_line_break_class(U'a') == LineBreakClass::AL);
+    CHECK(get_line_break_class(U' ') == LineBreakClass::SP);
+    CHECK(get_line_break_class(U'\n') == LineBreakClass::LF);
+    CHECK(get_line_break_class(U'\r') == LineBreakClass::CR);
+    CHECK(get_line_break_class(U'(') == LineBreakClass::OP);
+    CHECK(get_line_break_class(U')') == LineBreakClass::CP);
+    CHECK(get_line_break_class(U'-') == LineBreakClass::HY);
+    CHECK(get_line_break_class(U'7') == LineBreakClass::NU);
+    CHECK(get_line_break_class(U'\u00A0') == LineBreakClass::GL);
+    CHECK(get_line_break_class(U'\u200B') == LineBreakClass::ZW);
+    CHECK(get_line_break_class(U'\u200D') == LineBreakClass::ZWJ);
+    CHECK(get_line_break_class(U'世') == LineBreakClass::ID);
+}
+
+void test_break_opportunities() {
+    using Breaks = std::vector<size_t>;
+
+    CHECK(get_breaks(U"").empty());
+
+    // LB2: never at the start.
+    CHECK(get_breaks(U"a").empty());
+
+    // LB18: after spaces, LB7: not before them.
+    CHECK(get_breaks(U"hello world") == Breaks({6}));
+    CHECK(get_breaks(U"a  b") == Breaks({3}));
+
+    // LB4, LB5: mandatory breaks after line feeds, not between CR and LF.
+    CHECK(get_breaks(U"a\nb") == Breaks({2}));
+    CHECK(get_breaks(U"a\r\nb") == Breaks({3}));
+    CHECK(get_breaks(U"\n\n") == Breaks({1}));
+
+    // LB8: after a zero width space.
+    CHECK(get_breaks(U"a\u200Bb") == Breaks({2}));
+
+    // LB12: not around non-breaking glue.
+    CHECK(get_breaks(U"a\u00A0b") == Breaks({}));
+
+    // LB14, LB13: not after an opening or before a closing parenthesis.
+    CHECK(get_breaks(U"(a) b") == Breaks({4}));
+
+    // LB21: after a hyphen, but not before it.
+    CHECK(get_breaks(U"well-known") == Breaks({5}));
+
+    // LB25: not inside numbers.
+    CHECK(get_breaks(U"1.5 $20") == Breaks({4}));
+
+    // LB31: between ideographs.
+    CHECK(get_breaks(U"世界") == Breaks({1}));
+    CHECK(get_breaks(U"a世") == Breaks({1}));
+
+    // LB9: combining marks stay with their base.
+    CHECK(get_breaks(U"e\u0301 e\u0301") == Breaks({3}));
+
+    // LB8a: not after a zero width joiner, so emoji sequences stay together.
+    CHECK(get_breaks(U"\U0001F468\u200D\U0001F469") == Breaks({}));
+
+    // LB30b: not between an emoji base and its modifier.
+    CHECK(get_breaks(U"\U0001F44D\U0001F3FD") == Breaks({}));
+
+    // LB30a: only between pairs of regional indicators.
+    CHECK(get_breaks(U"\U0001F1FA\U0001F1F8\U0001F1EB\U0001F1F7") == Breaks({2}));
+}
+
+} // namespace
+
+int main() {
+    test_classes();
+    test_break_opportunities();
+
+    return check_failures == 0 ? 0 : 1;
+}
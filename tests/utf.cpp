@@ -0,0 +1,148 @@
+#include <common/utf.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "check.h"
+
+using namespace Flint;
+
+namespace {
+
+void test_round_trips() {
+    std::vector<std::string> texts = {
+        "",
+        "a",
+        // Long enough for the ASCII fast path, with a tail.
+        "The quick brown fox jumps over the lazy dog.",
+        "h\xC3\xA9llo \xE4\xB8\x96\xE7\x95\x8C \xF0\x9F\x98\x80",
+        // ASCII runs around multibyte characters, across the 16-byte blocks.
+        "0123456789abcde\xC3\xA9" "0123456789abcdef\xE4\xB8\x96",
+        // U+007F, U+0080, U+07FF, U+0800, U+FFFF, U+10000 and U+10FFFF.
+        "\x7F\xC2\x80\xDF\xBF\xE0\xA0\x80\xEF\xBF\xBF\xF0\x90\x80\x80\xF4\x8F\xBF\xBF",
+    };
+
+    for (const auto &text : texts) {
+        CHECK(validate_utf8(text));
+
+        std::u32string utf32;
+        utf8_to_utf32(text, utf32);
+        CHECK(utf32_to_utf8(utf32) == text);
+
+        std::u16string utf16;
+        utf8_to_utf16(text, utf16);
+        CHECK(utf16_to_utf8(utf16) == text);
+    }
+
+    std::u32string utf32;
+    utf8_to_utf32("a\xE4\xB8\x96\xF0\x9F\x98\x80", utf32);
+    CHECK(utf32 == U"a世\U0001F600");
+
+    // A surrogate pair outside the BMP.
+    std::u16string utf16;
+    utf8_to_utf16("\xF0\x9F\x98\x80", utf16);
+    CHECK(utf16 == u"\xD83D\xDE00");
+
+    CHECK(codepoint_to_utf8(U'é') == "\xC3\xA9");
+    CHECK(codepoint_to_utf8(U'\U0010FFFF') == "\xF4\x8F\xBF\xBF");
+}
+
+void test_invalid_utf8() {
+    std::vector<std::string> invalid_texts = {
+        // Lone continuation byte.
+        "\x80",
+        // Overlong forms.
+        "\xC0\xAF",
+        "\xE0\x80\xAF",
+        "\xF0\x80\x80\xAF",
+        // Surrogate.
+        "\xED\xA0\x80",
+        // Beyond U+10FFFF.
+        "\xF4\x90\x80\x80",
+        "\xF5\x80\x80\x80",
+        // Truncated sequences.
+        "\xE4\xB8",
+        "\xF0\x9F\x98",
+        // Missing continuation byte.
+        "\xC3" "a",
+    };
+
+    for (const auto &text : invalid_texts) {
+        CHECK(!validate_utf8(text));
+
+        std::u32string utf32(utf32_capacity_for_utf8(text.size()), 0);
+        CHECK(!convert_utf8_to_utf32(text, utf32).valid);
+
+        std::u16string utf16(utf16_capacity_for_utf8(text.size()), 0);
+        CHECK(!convert_utf8_to_utf16(text, utf16).valid);
+
+        bool thrown = false;
+        try {
+            std::u32string result;
+            utf8_to_utf32(text, result);
+        } catch (const std::runtime_error &) {
+            thrown = true;
+        }
+        CHECK(thrown);
+    }
+
+    // Conversion stops at the invalid sequence.
+    std::string text = "abc\xC0\xAF" "def";
+    std::u32string utf32(utf32_capacity_for_utf8(text.size()), 0);
+    auto result = convert_utf8_to_utf32(text, utf32);
+    CHECK(!result.valid);
+    CHECK(result.read == 3);
+    CHECK(result.written == 3);
+    CHECK(utf32.substr(0, 3) == U"abc");
+
+    // Each invalid byte becomes a replacement character.
+    std::u32string lossy;
+    utf8_to_utf32_lossy("a\xC0\xAF" "b\xE4\xB8\x96", lossy);
+    CHECK(lossy == U"a\uFFFD\uFFFDb世");
+}
+
+void test_invalid_utf16_and_utf32() {
+    std::string utf8(utf8_capacity_for_utf16(4), 0);
+
+    // Lone surrogates.
+    CHECK(!convert_utf16_to_utf8(u"a\xD800", utf8).valid);
+    CHECK(!convert_utf16_to_utf8(u"\xDC00" "a", utf8).valid);
+    CHECK(!convert_utf16_to_utf8(u"\xD800" "a", utf8).valid);
+
+    utf8.assign(utf8_capacity_for_utf32(2), 0);
+    CHECK(!convert_utf32_to_utf8(std::u32string(1, (char32_t)0xD800), utf8).valid);
+    CHECK(!convert_utf32_to_utf8(std::u32string(1, (char32_t)0x110000), utf8).valid);
+
+    char bytes[4];
+    CHECK(encode_utf8(0xD800, bytes) == 0);
+    CHECK(encode_utf8(0x110000, bytes) == 0);
+    CHECK(encode_utf8(0x1F600, bytes) == 4);
+    CHECK(std::string(bytes, 4) == "\xF0\x9F\x98\x80");
+}
+
+void test_small_destination() {
+    // Stops when the destination is full, without splitting a character.
+    std::u32string utf32(2, 0);
+    auto result = convert_utf8_to_utf32("abc", utf32);
+    CHECK(result.valid);
+    CHECK(result.read == 2);
+    CHECK(result.written == 2);
+
+    std::string utf8(3, 0);
+    result = convert_utf32_to_utf8(U"a世", utf8);
+    CHECK(result.valid);
+    CHECK(result.read == 1);
+    CHECK(result.written == 1);
+}
+
+} // namespace
+
+int main() {
+    test_round_trips();
+    test_invalid_utf8();
+    test_invalid_utf16_and_utf32();
+    test_small_destination();
+
+    return check_failures == 0 ? 0 : 1;
+}
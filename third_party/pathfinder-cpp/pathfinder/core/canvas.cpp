@@ -208,6 +208,22 @@ void Canvas::push_path(Outline &outline, PathOp path_op, FillRule fill_rule) {
     path.fill_rule = fill_rule;
     path.blend_mode = blend_mode;
 
+    if (current_state.scissor_rect) {
+        // Destructive blend modes affect the whole view box, which a scissor rect doesn't cover exactly.
+        if (is_blend_mode_destructive(blend_mode)) {
+            Path2d scissor_path;
+            scissor_path.add_rect(*current_state.scissor_rect);
+
+            ClipPath scissor_clip_path;
+            scissor_clip_path.outline = scissor_path.into_outline();
+            scissor_clip_path.clip_path = clip_path;
+
+            path.clip_path = std::make_shared<uint32_t>(scene->push_clip_path(scissor_clip_path));
+        } else {
+            path.scissor_rect = current_state.scissor_rect;
+        }
+    }
+
     scene->push_draw_path(path);
 }
 
@@ -262,6 +278,25 @@ void Canvas::clip_path(Path2d &path, FillRule fill_rule) {
     current_state.clip_path = std::make_shared<uint32_t>(clip_path_id);
 }
 
+void Canvas::clip_rect(const RectF &rect) {
+    const auto &transform = current_state.transform;
+
+    if (transform.m12() != 0 || transform.m21() != 0) {
+        Path2d path;
+        path.add_rect(rect);
+        clip_path(path, FillRule::Winding);
+        return;
+    }
+
+    auto scissor_rect = transform * rect;
+
+    if (current_state.scissor_rect) {
+        scissor_rect = current_state.scissor_rect->intersection(scissor_rect);
+    }
+
+    current_state.scissor_rect = scissor_rect;
+}
+
 Paint Canvas::fill_paint() const {
     return current_state.fill_paint;
 }
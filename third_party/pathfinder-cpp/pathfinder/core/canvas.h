@@ -2,6 +2,7 @@
 #define PATHFINDER_CANVAS_H
 
 #include <memory>
+#include <optional>
 
 #include "path2d.h"
 #include "renderer.h"
@@ -38,6 +39,9 @@ struct BrushState {
 
     // The clip path is scene-dependent, so remember to clear it when switching between scenes.
     std::shared_ptr<uint32_t> clip_path; // Optional
+
+    // Axis-aligned clip rect in scene coordinates, applied while tiling. Optional.
+    std::optional<RectF> scissor_rect;
 };
 
 enum class PathOp {
@@ -128,6 +132,10 @@ public:
     void stroke_path(Path2d &path2d);
 
     void clip_path(Path2d &path2d, FillRule fill_rule);
+
+    /// Clip by a rect in the current transform. It's much cheaper than clip_path() if the transform keeps the rect
+    /// axis-aligned, as it needs no clip tiles. Otherwise, it falls back to clip_path().
+    void clip_rect(const RectF &rect);
     // ------------------------------------------------
 
     // Drawing rectangles
@@ -32,9 +32,14 @@ std::shared_ptr<BuiltDrawPath> prepare_draw_path_for_gpu_binning(Scene &scene,
 
     auto path_bounds = transform * draw_path.outline.bounds;
 
-    // Clip the draw path by the view box.
+    // Clip the draw path by the view box and the scissor rect.
     auto intersection = path_bounds.intersection(effective_view_box);
 
+    auto scissor_rect = scene.get_effective_scissor_rect(draw_path);
+    if (scissor_rect) {
+        intersection = intersection.intersection(transform * *scissor_rect);
+    }
+
     if (intersection.is_valid()) {
         path_bounds = intersection;
     } else {
@@ -10,6 +10,9 @@
 
 namespace Pathfinder {
 
+/// For flattening curves when applying scissor rects on the CPU. Same as the D3D9 tiler.
+constexpr float SCISSOR_FLATTENING_TOLERANCE = 1.0f;
+
 struct BuiltSegments {
     SegmentsD3D11 draw_segments;
     SegmentsD3D11 clip_segments;
@@ -30,7 +33,15 @@ struct BuiltSegments {
         built_segments.draw_segment_ranges.reserve(scene.draw_paths.size());
 
         for (const auto &draw_path : scene.draw_paths) {
-            auto range = built_segments.draw_segments.add_path(draw_path.outline);
+            // Segments are tiled on the GPU, so the scissor rect is applied to them beforehand.
+            Range range;
+            auto scissor_rect = scene.get_effective_scissor_rect(draw_path);
+            if (scissor_rect) {
+                range = built_segments.draw_segments.add_path(
+                    draw_path.outline.clamped_to_rect(*scissor_rect, SCISSOR_FLATTENING_TOLERANCE));
+            } else {
+                range = built_segments.draw_segments.add_path(draw_path.outline);
+            }
             built_segments.draw_segment_ranges.push_back(range);
         }
 
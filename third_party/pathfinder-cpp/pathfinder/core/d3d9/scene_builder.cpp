@@ -59,6 +59,11 @@ std::vector<DrawTileBatchD3D9> build_tile_batches_for_draw_path_display_item(
                 continue;
             }
 
+            // Tiles outside the tile mask are kept as they are in the destination texture.
+            if (!scene.is_tile_in_mask(tile.tile_x, tile.tile_y)) {
+                continue;
+            }
+
             draw_tile_batch->tiles.push_back(tile);
 
             // Z buffer is only meant for visible SOLID tiles and not for any ALPHA tiles.
@@ -210,6 +215,7 @@ BuiltPath SceneBuilderD3D9::build_clip_path_on_cpu(const PathBuildParams &params
                 path_object.outline,
                 path_object.fill_rule,
                 params.view_box,
+                std::nullopt,
                 path_object.clip_path,
                 {},
                 tiling_path_info);
@@ -243,6 +249,7 @@ BuiltDrawPath SceneBuilderD3D9::build_draw_path_on_cpu(const DrawPathBuildParams
                 path_object.outline,
                 path_object.fill_rule,
                 params.path_build_params.view_box,
+                scene->get_effective_scissor_rect(path_object),
                 path_object.clip_path,
                 params.built_clip_paths,
                 path_info);
@@ -128,13 +128,29 @@ bool clip_line_segment_to_rect(LineSegmentF &line_segment, const RectF &rect) {
 /// Nehab and Hoppe, "Random-Access Rendering of General Vector Graphics" 2006.
 /// The algorithm to step through tiles is Amanatides and Woo, "A Fast Voxel Traversal Algorithm for
 /// Ray Tracing" 1987: http://www.cse.yorku.ca/~amana/research/grid.pdf
-void process_line_segment(LineSegmentF line_segment, SceneBuilderD3D9 &scene_builder, ObjectBuilder &object_builder) {
+void process_line_segment(LineSegmentF line_segment,
+                          SceneBuilderD3D9 &scene_builder,
+                          ObjectBuilder &object_builder,
+                          const std::optional<RectF> &scissor_rect) {
     // Validate the tile coordinates. This an attempt that tries to avoid an endless WHILE loop below.
     if (!line_segment.is_valid()) {
         Logger::error("Invalid line segment!");
         return;
     }
 
+    // Clamp the line segment to the scissor rect. Unlike the view box clipping below, the pieces outside are moved
+    // onto the rect edges instead of being dropped, so the fill is clipped exactly even if the rect isn't aligned to
+    // the tiles.
+    if (scissor_rect) {
+        LineSegmentF pieces[5];
+        int piece_count = clamp_line_segment_to_rect(line_segment, *scissor_rect, pieces);
+
+        for (int i = 0; i < piece_count; i++) {
+            process_line_segment(pieces[i], scene_builder, object_builder, std::nullopt);
+        }
+        return;
+    }
+
     // Clip the line segment if it intersects the view box bounds.
     {
         // Clip by the view box.
@@ -279,12 +295,15 @@ void process_line_segment(LineSegmentF line_segment, SceneBuilderD3D9 &scene_bui
 }
 
 /// Recursive call.
-void process_segment(Segment &segment, SceneBuilderD3D9 &scene_builder, ObjectBuilder &object_builder) {
+void process_segment(Segment &segment,
+                     SceneBuilderD3D9 &scene_builder,
+                     ObjectBuilder &object_builder,
+                     const std::optional<RectF> &scissor_rect) {
     // TODO(pcwalton): Stop degree elevating.
     // 1. If the segment is a quadratic curve, convert it into a cubic one, then process it.
     if (segment.is_quadratic()) {
         auto cubic = segment.to_cubic();
-        process_segment(cubic, scene_builder, object_builder);
+        process_segment(cubic, scene_builder, object_builder, scissor_rect);
 
         // Remember to return to avoid running code below.
         return;
@@ -293,7 +312,7 @@ void process_segment(Segment &segment, SceneBuilderD3D9 &scene_builder, ObjectBu
     // 2. If the segment is a line or a cubic curve that is flat enough, go to next step.
     if (segment.is_line() || (segment.is_cubic() && segment.is_flat(FLATTENING_TOLERANCE))) {
         // (Next step) Process the segment as a line segment.
-        process_line_segment(segment.baseline, scene_builder, object_builder);
+        process_line_segment(segment.baseline, scene_builder, object_builder, scissor_rect);
 
         // Remember to return to avoid running code below.
         return;
@@ -303,8 +322,8 @@ void process_segment(Segment &segment, SceneBuilderD3D9 &scene_builder, ObjectBu
     Segment prev, next;
     segment.split(0.5f, prev, next);
 
-    process_segment(prev, scene_builder, object_builder);
-    process_segment(next, scene_builder, object_builder);
+    process_segment(prev, scene_builder, object_builder, scissor_rect);
+    process_segment(next, scene_builder, object_builder, scissor_rect);
 }
 
 Tiler::Tiler(SceneBuilderD3D9 &_scene_builder,
@@ -312,13 +331,19 @@ Tiler::Tiler(SceneBuilderD3D9 &_scene_builder,
              Outline _outline,
              FillRule fill_rule,
              const RectF &view_box,
+             const std::optional<RectF> &_scissor_rect,
              const std::shared_ptr<uint32_t> &clip_path_id,
              const std::vector<BuiltPath> &built_clip_paths,
              TilingPathInfo path_info)
-    : scene_builder(_scene_builder), outline(std::move(_outline)) {
+    : scene_builder(_scene_builder), outline(std::move(_outline)), scissor_rect(_scissor_rect) {
     // The intersection rect of the path bounds and the view box.
     auto bounds = outline.bounds.intersection(view_box);
 
+    // No tiles outside the scissor rect.
+    if (scissor_rect) {
+        bounds = bounds.intersection(*scissor_rect);
+    }
+
     if (clip_path_id) {
         clip_path = std::make_shared<BuiltPath>(built_clip_paths[*clip_path_id]);
     }
@@ -349,7 +374,7 @@ void Tiler::generate_fills() {
                 break;
             }
 
-            process_segment(segment, scene_builder, object_builder);
+            process_segment(segment, scene_builder, object_builder, scissor_rect);
         }
     }
 }
@@ -1,6 +1,8 @@
 #ifndef PATHFINDER_D3D9_TILER_H
 #define PATHFINDER_D3D9_TILER_H
 
+#include <optional>
+
 #include "../data/data.h"
 #include "../data/path.h"
 #include "object_builder.h"
@@ -16,6 +18,7 @@ public:
           Outline _outline,
           FillRule fill_rule,
           const RectF& view_box,
+          const std::optional<RectF>& _scissor_rect,
           const std::shared_ptr<uint32_t>& clip_path_id,
           const std::vector<BuiltPath>& built_clip_paths,
           TilingPathInfo path_info);
@@ -32,6 +35,8 @@ private:
 
     std::shared_ptr<BuiltPath> clip_path; // Optional
 
+    std::optional<RectF> scissor_rect;
+
     /// Process all paths of the attached shape.
     void generate_fills();
 
@@ -1,5 +1,6 @@
 #include "line_segment.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
@@ -109,4 +110,63 @@ LineSegmentF LineSegmentF::apply_transform(const Transform2 &transform) const {
     return {transform * from(), transform * to()};
 }
 
+int clamp_line_segment_to_rect(const LineSegmentF &segment, const RectF &rect, LineSegmentF (&pieces)[5]) {
+    auto from = segment.from();
+    auto to = segment.to();
+
+    // Inside the rect, no clamping.
+    if (from.x >= rect.left && from.x <= rect.right && from.y >= rect.top && from.y <= rect.bottom &&
+        to.x >= rect.left && to.x <= rect.right && to.y >= rect.top && to.y <= rect.bottom) {
+        pieces[0] = segment;
+        return 1;
+    }
+
+    auto vector = segment.vector();
+
+    // Segment parameters where the segment crosses the edge lines. Each piece in between stays on one side of each
+    // line, so it's clamped by clamping its end points.
+    float crossings[6];
+    int crossing_count = 0;
+
+    crossings[crossing_count++] = 0;
+
+    auto add_crossing = [&](float start, float delta, float edge) {
+        if (delta != 0) {
+            float t = (edge - start) / delta;
+            if (t > 0 && t < 1) {
+                crossings[crossing_count++] = t;
+            }
+        }
+    };
+
+    add_crossing(from.x, vector.x, rect.left);
+    add_crossing(from.x, vector.x, rect.right);
+    add_crossing(from.y, vector.y, rect.top);
+    add_crossing(from.y, vector.y, rect.bottom);
+
+    std::sort(crossings + 1, crossings + crossing_count);
+
+    crossings[crossing_count++] = 1;
+
+    auto clamp_point = [&](const Vec2F &point) {
+        return point.max(rect.origin()).min(rect.lower_right());
+    };
+
+    int piece_count = 0;
+
+    auto piece_from = clamp_point(from);
+
+    for (int i = 1; i < crossing_count; i++) {
+        auto piece_to = clamp_point(i == crossing_count - 1 ? to : segment.sample(crossings[i]));
+
+        if (piece_to != piece_from) {
+            pieces[piece_count++] = LineSegmentF(piece_from, piece_to);
+        }
+
+        piece_from = piece_to;
+    }
+
+    return piece_count;
+}
+
 } // namespace Pathfinder
@@ -108,6 +108,12 @@ struct LineSegmentF {
     }
 };
 
+/// Splits a line segment where it crosses the lines of the rect edges, and moves the pieces outside of the rect onto
+/// its edges. For a closed contour, this keeps the winding numbers inside the rect and zeroes them outside, so filling
+/// the clamped pieces clips the fill to the rect. Degenerate pieces are dropped.
+/// Returns the number of pieces.
+int clamp_line_segment_to_rect(const LineSegmentF &segment, const RectF &rect, LineSegmentF (&pieces)[5]);
+
 } // namespace Pathfinder
 
 #endif // PATHFINDER_LINE_SEGMENT_H
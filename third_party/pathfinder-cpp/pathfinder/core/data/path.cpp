@@ -1,6 +1,7 @@
 #include "path.h"
 
 #include "../../common/math/basic.h"
+#include "segment.h"
 
 namespace Pathfinder {
 
@@ -37,4 +38,58 @@ void Outline::push_contour(const Contour &_contour) {
     }
 }
 
+/// Flatten a segment into line segments, clamping them to the rect.
+void push_clamped_segment(Segment &segment, const RectF &rect, float flattening_tolerance, Contour &contour) {
+    if (segment.is_quadratic()) {
+        auto cubic = segment.to_cubic();
+        push_clamped_segment(cubic, rect, flattening_tolerance, contour);
+        return;
+    }
+
+    if (segment.is_line() || (segment.is_cubic() && segment.is_flat(flattening_tolerance))) {
+        LineSegmentF pieces[5];
+        int piece_count = clamp_line_segment_to_rect(segment.baseline, rect, pieces);
+
+        for (int i = 0; i < piece_count; i++) {
+            if (contour.is_empty()) {
+                contour.push_endpoint(pieces[i].from());
+            }
+            contour.push_endpoint(pieces[i].to());
+        }
+        return;
+    }
+
+    Segment prev, next;
+    segment.split(0.5f, prev, next);
+
+    push_clamped_segment(prev, rect, flattening_tolerance, contour);
+    push_clamped_segment(next, rect, flattening_tolerance, contour);
+}
+
+Outline Outline::clamped_to_rect(const RectF &rect, float flattening_tolerance) const {
+    Outline clamped_outline;
+
+    for (const auto &contour : contours) {
+        Contour clamped_contour;
+
+        auto segments_iter = SegmentsIter(contour.points, contour.flags, contour.closed);
+
+        while (!segments_iter.has_no_next()) {
+            auto segment = segments_iter.get_next(true);
+
+            if (segment.kind == SegmentKind::None) {
+                break;
+            }
+
+            push_clamped_segment(segment, rect, flattening_tolerance, clamped_contour);
+        }
+
+        clamped_contour.close();
+
+        clamped_outline.push_contour(clamped_contour);
+    }
+
+    return clamped_outline;
+}
+
 } // namespace Pathfinder
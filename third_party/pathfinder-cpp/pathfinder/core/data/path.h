@@ -1,6 +1,8 @@
 #ifndef PATHFINDER_PATH_H
 #define PATHFINDER_PATH_H
 
+#include <memory>
+#include <optional>
 #include <vector>
 
 #include "../../common/color.h"
@@ -24,6 +26,10 @@ public:
 
     /// Add a new contour to this shape.
     void push_contour(const Contour &_contour);
+
+    /// Returns a flattened copy whose fill, with either fill rule, is this outline's fill clipped to the rect.
+    /// For where a scissor rect can't be applied while tiling.
+    Outline clamped_to_rect(const RectF &rect, float flattening_tolerance) const;
 };
 
 /// A thin wrapper over Outline, which describes a path that can be drawn.
@@ -37,6 +43,10 @@ struct DrawPath {
     /// The ID of an optional clip shape that will be used to clip this shape.
     std::shared_ptr<uint32_t> clip_path; // Optional
 
+    /// An optional axis-aligned clip rect in scene coordinates. Unlike a clip path, it's applied to the segments
+    /// while tiling, so it needs no clip tiles.
+    std::optional<RectF> scissor_rect;
+
     /// How to fill this shape (winding or even-odd).
     FillRule fill_rule = FillRule::Winding;
 
@@ -82,6 +82,10 @@ struct PaintContents {
 struct PaintOverlay {
     PaintCompositeOp composite_op = PaintCompositeOp::SrcIn;
     PaintContents contents;
+
+    /// The color texture is combined with the base color by SrcIn unless this is set, in which case composite_op is
+    /// used. E.g. for coverage-only images tinted by the base color, which need DestIn.
+    bool apply_composite_op = false;
 };
 
 /// Defines how a shape is to be filled: with a solid color, gradient, or pattern.
@@ -171,7 +175,6 @@ struct PaintLocationsInfo {
     std::vector<PaintMetadata> paint_metadata;
     GradientTileBuilder gradient_tile_builder;
     std::vector<ImageTexelInfo> image_texel_info;
-    std::set<uint64_t> used_image_hashes;
 };
 
 /// Metadata related to the color texture.
@@ -194,6 +197,9 @@ struct PaintColorTextureMetadata {
     /// How the color texture is to be composited over the base color.
     PaintCompositeOp composite_op;
 
+    /// If the color combine mode follows composite_op instead of always being SrcIn.
+    bool apply_composite_op = false;
+
     /// How much of a border there needs to be around the image.
     ///
     /// The border ensures clamp-to-edge yields the right result.
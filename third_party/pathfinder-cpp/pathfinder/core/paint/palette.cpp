@@ -74,6 +74,19 @@ FilterParams compute_filter_params(const PaintFilter &filter,
     return filter_params;
 }
 
+/// Copy the pixels of a rect of an image, e.g. for uploading a changed part of it.
+static std::shared_ptr<std::vector<ColorU>> copy_image_rect(const Image &image, const RectI &rect) {
+    auto texels = std::make_shared<std::vector<ColorU>>();
+    texels->reserve(rect.area());
+
+    for (int32_t y = rect.min_y(); y < rect.max_y(); y++) {
+        auto row = image.pixels.begin() + y * image.size.x;
+        texels->insert(texels->end(), row + rect.min_x(), row + rect.max_x());
+    }
+
+    return texels;
+}
+
 Palette::Palette(uint32_t _scene_id) : scene_id(_scene_id) {}
 
 uint32_t Palette::push_paint(const Paint &paint) {
@@ -113,7 +126,8 @@ RenderTargetDesc Palette::get_render_target(RenderTargetId render_target_id) con
 }
 
 std::vector<PaintMetadata> Palette::build_paint_info(Renderer *renderer) {
-    auto paint_texture_manager = std::make_shared<PaintTextureManager>();
+    auto paint_texture_manager = renderer->get_paint_texture_manager();
+    paint_texture_manager->build_count++;
 
     std::vector<TextureLocation> transient_paint_locations;
 
@@ -162,8 +176,8 @@ std::vector<PaintMetadata> Palette::build_paint_info(Renderer *renderer) {
     // Free transient locations and unused images, now that they're no longer needed.
     free_transient_locations(*paint_texture_manager, transient_paint_locations);
 
-    // Frees images that are cached but not used this frame.
-    free_unused_images(*paint_texture_manager, paint_locations_info.used_image_hashes);
+    // Frees images that are cached but haven't been used for a while.
+    free_unused_images(*paint_texture_manager);
 
     return paint_locations_info.paint_metadata;
 }
@@ -180,6 +194,12 @@ std::vector<TextureMetadataEntry> Palette::create_texture_metadata(const std::ve
 
             // Changed from SrcIn to DestIn to get pure shadow.
             entry.color_combine_mode = ColorCombineMode::SrcIn;
+
+            // Only paints which ask for it honour their composite op.
+            if (metadata.color_texture_metadata->apply_composite_op &&
+                metadata.color_texture_metadata->composite_op == PaintCompositeOp::DestIn) {
+                entry.color_combine_mode = ColorCombineMode::DestIn;
+            }
         } else {
             // No color combine mode if there's no need to mix with a color texture.
             entry.color_combine_mode = ColorCombineMode::None;
@@ -216,7 +236,6 @@ PaintLocationsInfo Palette::assign_paint_locations(const std::shared_ptr<PaintTe
     //    paint_metadata.reserve(paints.size());
     GradientTileBuilder gradient_tile_builder;
     std::vector<ImageTexelInfo> image_texel_info;
-    std::set<uint64_t> used_image_hashes;
 
     // Traverse paints.
     for (const auto &paint : paints) {
@@ -256,6 +275,7 @@ PaintLocationsInfo Palette::assign_paint_locations(const std::shared_ptr<PaintTe
                 color_texture_metadata->sampling_flags = sampling_flags;
                 color_texture_metadata->transform = Transform2();
                 color_texture_metadata->composite_op = overlay->composite_op;
+                color_texture_metadata->apply_composite_op = overlay->apply_composite_op;
                 color_texture_metadata->border = Vec2I();
             }
             // Pattern.
@@ -285,25 +305,42 @@ PaintLocationsInfo Palette::assign_paint_locations(const std::shared_ptr<PaintTe
                     auto &cached_images = texture_manager->cached_images;
 
                     // Check cache.
-                    if (cached_images.find(image_hash) != cached_images.end()) {
-                        location = cached_images[image_hash];
-                        // Mark this image cache as being used in this frame.
-                        used_image_hashes.insert(image_hash);
+                    auto iter = cached_images.find(image_hash);
+                    if (iter != cached_images.end()) {
+                        // Cached images have already been uploaded, apart from the changes of mutable images.
+                        location = iter->second.location;
+
+                        if (auto dirty_rect = image->take_dirty_rect()) {
+                            image_texel_info.push_back(ImageTexelInfo{
+                                TextureLocation{
+                                    location.page,
+                                    *dirty_rect + location.rect.origin(),
+                                },
+                                copy_image_rect(*image, *dirty_rect),
+                            });
+                        }
                     } else {
                         // Leave a pixel of border on the side.
                         auto allocation_mode = AllocationMode::OwnPage;
                         location = allocator.allocate(image->size + border * 2, allocation_mode);
                         location.rect = location.rect.contract(border);
-                        cached_images[image_hash] = location;
+                        iter = cached_images.insert({image_hash, CachedImage{location}}).first;
+
+                        // Only upload new images, and only once even if many paints share the image.
+                        image_texel_info.push_back(ImageTexelInfo{
+                            TextureLocation{
+                                location.page,
+                                location.rect,
+                            },
+                            std::make_shared<std::vector<ColorU>>(image->pixels),
+                        });
+
+                        // The whole image is uploaded.
+                        image->take_dirty_rect();
                     }
 
-                    image_texel_info.push_back(ImageTexelInfo{
-                        TextureLocation{
-                            location.page,
-                            location.rect,
-                        },
-                        std::make_shared<std::vector<ColorU>>(image->pixels),
-                    });
+                    // Mark this image cache as being used in this build.
+                    iter->second.last_used_build = texture_manager->build_count;
                 }
 
                 TextureSamplingFlags sampling_flags;
@@ -340,6 +377,7 @@ PaintLocationsInfo Palette::assign_paint_locations(const std::shared_ptr<PaintTe
                 color_texture_metadata->filter = paint_filter;
                 color_texture_metadata->transform = Transform2::from_translation(border.to_f32());
                 color_texture_metadata->composite_op = overlay->composite_op;
+                color_texture_metadata->apply_composite_op = overlay->apply_composite_op;
                 color_texture_metadata->border = border;
             }
         }
@@ -352,7 +390,6 @@ PaintLocationsInfo Palette::assign_paint_locations(const std::shared_ptr<PaintTe
         paint_metadata,
         gradient_tile_builder,
         image_texel_info,
-        used_image_hashes,
     };
 }
 
@@ -416,26 +453,22 @@ void Palette::free_transient_locations(PaintTextureManager &texture_manager,
     }
 }
 
-// Frees images that are cached but not used this frame.
-void Palette::free_unused_images(PaintTextureManager &texture_manager, const std::set<uint64_t> &used_image_hashes) {
+// Frees images that are cached but haven't been used for a while.
+void Palette::free_unused_images(PaintTextureManager &texture_manager) {
     auto &cached_images = texture_manager.cached_images;
     auto &allocator = texture_manager.allocator;
 
-    std::vector<uint64_t> image_hashes_to_remove;
-    for (auto &image : cached_images) {
-        // Check if this cache has been used in the current frame.
-        bool keep = used_image_hashes.find(image.first) != used_image_hashes.end();
+    for (auto iter = cached_images.begin(); iter != cached_images.end();) {
+        bool keep = texture_manager.build_count - iter->second.last_used_build < PaintTextureManager::MAX_IDLE_BUILDS;
 
-        // Free it if it hasn't.
+        // Free it if it hasn't been drawn recently.
         if (!keep) {
-            allocator.free(image.second);
-            image_hashes_to_remove.push_back(image.first);
+            allocator.free(iter->second.location);
+            iter = cached_images.erase(iter);
+        } else {
+            ++iter;
         }
     }
-
-    for (auto &hash : image_hashes_to_remove) {
-        cached_images.erase(hash);
-    }
 }
 
 MergedPaletteInfo Palette::append_palette(const Palette &palette, const Transform2 &transform) {
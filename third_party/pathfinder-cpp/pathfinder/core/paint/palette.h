@@ -25,10 +25,24 @@ struct MergedPaletteInfo {
     std::map<uint16_t, uint16_t> paint_mapping;
 };
 
-// Caches CPU texture images from scene to scene.
+struct CachedImage {
+    TextureLocation location;
+
+    /// The build which drew the image last.
+    uint64_t last_used_build = 0;
+};
+
+// Caches CPU texture images from scene to scene. The renderer keeps it, so that images are only uploaded again
+// when they change.
 struct PaintTextureManager {
+    /// Images which haven't been drawn by this many scene builds are freed. A frame usually builds several scenes,
+    /// e.g. one per layer, so an image drawn in every frame stays cached.
+    static constexpr uint64_t MAX_IDLE_BUILDS = 64;
+
     TextureAllocator allocator;
-    std::map<uint64_t, TextureLocation> cached_images;
+    std::map<uint64_t, CachedImage> cached_images;
+
+    uint64_t build_count = 0;
 };
 
 struct FilterParams {
@@ -83,8 +97,8 @@ private:
     static void free_transient_locations(PaintTextureManager &texture_manager,
                                          const std::vector<TextureLocation> &transient_paint_locations);
 
-    // Frees images that are cached but not used this frame.
-    static void free_unused_images(PaintTextureManager &texture_manager, const std::set<uint64_t> &used_image_hashes);
+    // Frees images that are cached but haven't been used for a while.
+    static void free_unused_images(PaintTextureManager &texture_manager);
 
     std::vector<TextureLocation> assign_render_target_locations(
         const std::shared_ptr<PaintTextureManager> &texture_manager,
@@ -1,7 +1,34 @@
 #include "pattern.h"
 
+#include <atomic>
+
 namespace Pathfinder {
 
+std::shared_ptr<Image> Image::new_mutable(Vec2I size, ColorU color) {
+    static std::atomic<uint64_t> next_id = 0;
+
+    auto image = std::shared_ptr<Image>(new Image());
+    image->size = size;
+    image->pixels.assign(size.area(), color);
+    image->opaque = false;
+
+    // Hash a unique ID instead of the pixels, which will change.
+    uint64_t id = next_id++;
+    image->pixels_hash = fnv_hash(reinterpret_cast<const char *>(&id), sizeof(id));
+
+    return image;
+}
+
+void Image::mark_dirty(const RectI &rect) {
+    dirty_rect = dirty_rect ? dirty_rect->union_rect(rect) : rect;
+}
+
+std::optional<RectI> Image::take_dirty_rect() {
+    auto rect = dirty_rect;
+    dirty_rect.reset();
+    return rect;
+}
+
 bool Pattern::repeat_x() const {
     return (flags.value & PatternFlags::REPEAT_X) != 0x0;
 }
@@ -4,11 +4,14 @@
 //! Raster image patterns.
 
 #include <cstdint>
+#include <memory>
+#include <optional>
 #include <utility>
 #include <vector>
 
 #include "../../common/color.h"
 #include "../../common/math/basic.h"
+#include "../../common/math/rect.h"
 #include "../../common/math/transform2.h"
 #include "../../common/math/vec2.h"
 #include "../../gpu/texture.h"
@@ -36,11 +39,31 @@ public:
     Vec2I size;
     std::vector<ColorU> pixels;
     uint64_t pixels_hash;
+    bool opaque = true;
+
+    /// Create an image whose pixels can be changed in place after it has been drawn, see mark_dirty().
+    /// It's identified by a unique ID instead of the hash of its pixels, and it's never treated as opaque.
+    static std::shared_ptr<Image> new_mutable(Vec2I size, ColorU color);
+
+    /// Report that the pixels inside a rect of a mutable image have changed. If the image is still cached by the
+    /// texture manager, only the changed rects are uploaded again when it's drawn next.
+    /// @note Only meant for images drawn by a single renderer, which takes the changed rect.
+    void mark_dirty(const RectI &rect);
+
+    /// Returns the union of the rects changed since the last call and resets it.
+    std::optional<RectI> take_dirty_rect();
 
     Image(Vec2I _size, const std::vector<ColorU> &_pixels) {
         size = _size;
         pixels = _pixels;
         pixels_hash = fnv_hash(reinterpret_cast<const char *>(pixels.data()), pixels.size() * 4);
+
+        for (const auto &pixel : pixels) {
+            if (!pixel.is_opaque()) {
+                opaque = false;
+                break;
+            }
+        }
     }
 
     /// Returns a non-cryptographic hash of the image, which should be globally unique.
@@ -56,6 +79,11 @@ public:
 
         return res;
     }
+
+private:
+    Image() = default;
+
+    std::optional<RectI> dirty_rect;
 };
 
 /// A raster image target that can be rendered to and later reused as a pattern.
@@ -95,7 +123,11 @@ struct PatternSource {
 
     /// Returns true if this pattern is obviously opaque.
     bool is_opaque() const {
-        // We assume all images and render targets are opaque for the sake of simplicity.
+        if (type == Type::Image) {
+            return image->opaque;
+        }
+
+        // We assume all render targets and textures are opaque for the sake of simplicity.
         return true;
     }
 
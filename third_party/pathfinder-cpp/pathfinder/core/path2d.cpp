@@ -159,6 +159,30 @@ void Path2d::add_circle(const Vec2F &center, float radius) {
     close_path();
 }
 
+void Path2d::add_path(const Path2d &path, const Transform2 &transform) {
+    flush_current_contour();
+
+    for (auto contour : path.outline.contours) {
+        contour.transform(transform);
+        outline.push_contour(contour);
+    }
+
+    if (!path.current_contour.is_empty()) {
+        auto contour = path.current_contour;
+        contour.transform(transform);
+        outline.push_contour(contour);
+    }
+}
+
+void Path2d::add_outline(const Outline &other, const Transform2 &transform) {
+    flush_current_contour();
+
+    for (auto contour : other.contours) {
+        contour.transform(transform);
+        outline.push_contour(contour);
+    }
+}
+
 Outline Path2d::into_outline() {
     flush_current_contour();
     return outline;
@@ -31,6 +31,12 @@ public:
     void add_rect_with_corners(const RectF &rect, const RectF &corner_radius);
 
     void add_circle(const Vec2F &center, float radius);
+
+    /// Append the contours of another path with a transform applied, like `addPath()` of the HTML canvas.
+    void add_path(const Path2d &path, const Transform2 &transform);
+
+    /// Append the contours of an outline with a transform applied.
+    void add_outline(const Outline &outline, const Transform2 &transform);
     // -----------------------------------------------
 
     /// Returns the outline.
@@ -14,6 +14,8 @@ Renderer::Renderer(const std::shared_ptr<Device> &_device, const std::shared_ptr
     : device(_device), queue(_queue) {
     allocator = std::make_shared<GpuMemoryAllocator>(device);
 
+    paint_texture_manager = std::make_shared<PaintTextureManager>();
+
     // Area-Lut texture.
     auto image_buffer = ImageBuffer::from_memory({std::begin(area_lut_png), std::end(area_lut_png)}, false);
 
@@ -60,6 +62,10 @@ void Renderer::allocate_pattern_texture_page(uint64_t page_id, Vec2I texture_siz
     pattern_texture_pages[page_id] = std::make_shared<PatternTexturePage>(framebuffer_id, false);
 }
 
+std::shared_ptr<PaintTextureManager> Renderer::get_paint_texture_manager() const {
+    return paint_texture_manager;
+}
+
 void Renderer::declare_render_target(RenderTargetId render_target_id, TextureLocation location) {
     while (render_target_locations.size() < render_target_id.render_target + 1) {
         render_target_locations.push_back(TextureLocation{std::numeric_limits<uint32_t>::max(), RectI()});
@@ -20,6 +20,8 @@ const uint32_t MASK_TILES_DOWN = 256;
 const uint32_t MASK_FRAMEBUFFER_WIDTH = TILE_WIDTH * MASK_TILES_ACROSS;
 const uint32_t MASK_FRAMEBUFFER_HEIGHT = TILE_HEIGHT / 4 * MASK_TILES_DOWN;
 
+struct PaintTextureManager;
+
 struct RenderTarget {
     std::shared_ptr<Texture> texture;
 };
@@ -67,6 +69,10 @@ public:
 
     void upload_texel_data(std::vector<ColorU> &texels, TextureLocation location);
 
+    /// Where the images of the scenes are placed in the pattern texture pages. It's kept from scene to scene, so
+    /// that images stay uploaded while they're drawn.
+    std::shared_ptr<PaintTextureManager> get_paint_texture_manager() const;
+
     void declare_render_target(RenderTargetId render_target_id, TextureLocation location);
 
     virtual void set_up_pipelines() = 0;
@@ -126,6 +132,8 @@ protected:
     // -----------------------------------------------
     std::vector<TextureLocation> render_target_locations;
     std::vector<std::shared_ptr<PatternTexturePage>> pattern_texture_pages;
+
+    std::shared_ptr<PaintTextureManager> paint_texture_manager;
     // -----------------------------------------------
 
     std::vector<std::shared_ptr<Sampler>> samplers;
@@ -2,6 +2,7 @@
 
 #include "d3d11/scene_builder.h"
 #include "d3d9/scene_builder.h"
+#include "path2d.h"
 #include "renderer.h"
 
 namespace Pathfinder {
@@ -111,6 +112,24 @@ void Scene::append_scene(const Scene &scene, const Transform2 &transform) {
 
         new_draw_path.outline.transform(transform);
 
+        // A scissor rect stays one if the transform keeps it axis-aligned. Otherwise, it becomes a clip path.
+        if (draw_path.scissor_rect) {
+            if (transform.m12() == 0 && transform.m21() == 0) {
+                new_draw_path.scissor_rect = transform * *draw_path.scissor_rect;
+            } else {
+                Path2d scissor_path;
+                scissor_path.add_rect(*draw_path.scissor_rect);
+
+                ClipPath scissor_clip_path;
+                scissor_clip_path.outline = scissor_path.into_outline();
+                scissor_clip_path.outline.transform(transform);
+                scissor_clip_path.clip_path = new_draw_path.clip_path;
+
+                new_draw_path.clip_path = std::make_shared<uint32_t>(push_clip_path(scissor_clip_path));
+                new_draw_path.scissor_rect = std::nullopt;
+            }
+        }
+
         draw_paths.push_back(new_draw_path);
     }
 
@@ -188,4 +207,48 @@ void Scene::set_bounds(const RectF &new_bounds) {
     epoch.next();
 }
 
+void Scene::set_scissor_rect(const std::optional<RectF> &new_scissor_rect) {
+    scissor_rect = new_scissor_rect;
+    epoch.next();
+}
+
+std::optional<RectF> Scene::get_scissor_rect() const {
+    return scissor_rect;
+}
+
+std::optional<RectF> Scene::get_effective_scissor_rect(const DrawPath &draw_path) const {
+    if (!scissor_rect) {
+        return draw_path.scissor_rect;
+    }
+    if (!draw_path.scissor_rect) {
+        return scissor_rect;
+    }
+
+    // An empty intersection is kept as is, so that nothing is tiled.
+    return scissor_rect->intersection(*draw_path.scissor_rect);
+}
+
+void Scene::set_tile_mask(const std::vector<RectI> &new_tile_rects) {
+    tile_mask = new_tile_rects;
+    epoch.next();
+}
+
+const std::vector<RectI> &Scene::get_tile_mask() const {
+    return tile_mask;
+}
+
+bool Scene::is_tile_in_mask(int32_t tile_x, int32_t tile_y) const {
+    if (tile_mask.empty()) {
+        return true;
+    }
+
+    for (const auto &rect : tile_mask) {
+        if (tile_x >= rect.left && tile_x < rect.right && tile_y >= rect.top && tile_y < rect.bottom) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 } // namespace Pathfinder
@@ -3,6 +3,7 @@
 
 #include <limits>
 #include <map>
+#include <optional>
 #include <vector>
 
 #include "../common/math/basic.h"
@@ -126,11 +127,36 @@ public:
 
     void set_bounds(const RectF &new_bounds);
 
+    /// Clip all the draw paths to an axis-aligned rect in scene coordinates when the scene is built, on top of their
+    /// own scissor rects. Nothing outside of it is tiled, e.g. for redrawing a part of a kept destination texture.
+    /// Unlike the view box, it doesn't change the tile grid.
+    void set_scissor_rect(const std::optional<RectF> &new_scissor_rect);
+
+    std::optional<RectF> get_scissor_rect() const;
+
+    /// The scissor rect of a draw path combined with the scene's one.
+    std::optional<RectF> get_effective_scissor_rect(const DrawPath &draw_path) const;
+
+    /// Only draw the tiles inside these rects (in tiles), e.g. for redrawing several parts of a kept destination
+    /// texture inside one scissor rect which bounds them. Empty to draw all tiles.
+    /// @note The D3D9 level skips the other tiles when batching. The D3D11 level bins tiles on the GPU and draws the
+    /// whole scissor rect, which gives the same result, just with more work.
+    void set_tile_mask(const std::vector<RectI> &new_tile_rects);
+
+    const std::vector<RectI> &get_tile_mask() const;
+
+    /// If a tile is inside the tile mask.
+    bool is_tile_in_mask(int32_t tile_x, int32_t tile_y) const;
+
 private:
     RectF bounds;
 
     /// Scene-wide clipping control.
     RectF view_box;
+
+    std::optional<RectF> scissor_rect;
+
+    std::vector<RectI> tile_mask;
 };
 
 } // namespace Pathfinder
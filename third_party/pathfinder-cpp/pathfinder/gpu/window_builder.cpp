@@ -24,21 +24,36 @@ float WindowBuilder::get_dpi_scaling_factor(uint8_t window_index) const {
     return get_window(window_index).lock()->get_dpi_scaling_factor();
 }
 
-void WindowBuilder::poll_events() {
-    // Reset window flags.
-    {
-        primary_window_->just_resized_ = false;
+void WindowBuilder::reset_window_flags() {
+    primary_window_->just_resized_ = false;
 
-        for (auto w : sub_windows_) {
-            w->just_resized_ = false;
-        }
+    for (auto w : sub_windows_) {
+        w->just_resized_ = false;
     }
+}
+
+void WindowBuilder::poll_events() {
+    reset_window_flags();
 
 #ifndef __ANDROID__
     glfwPollEvents();
 #endif
 }
 
+void WindowBuilder::wait_events(double timeout) {
+    reset_window_flags();
+
+#ifndef __ANDROID__
+    if (timeout < 0) {
+        glfwWaitEvents();
+    } else if (timeout == 0) {
+        glfwPollEvents();
+    } else {
+        glfwWaitEventsTimeout(timeout);
+    }
+#endif
+}
+
 void WindowBuilder::set_fullscreen(bool fullscreen) {
     if (primary_window_->fullscreen_ == fullscreen) {
         return;
@@ -39,9 +39,15 @@ public:
 
     void poll_events();
 
+    /// Like poll_events(), but sleeps until there's an event or the timeout in seconds has passed.
+    /// A negative timeout waits for an event without timing out.
+    void wait_events(double timeout);
+
     void set_fullscreen(bool fullscreen);
 
 protected:
+    void reset_window_flags();
+
 #ifndef __ANDROID__
     static GLFWwindow *glfw_window_init(const Vec2I &logical_size,
                                         const std::string &title,